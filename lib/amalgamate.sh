@@ -0,0 +1,70 @@
+#!/bin/sh
+#
+# Write the single-header amalgamation of Errol to standard output:
+#
+#   sh amalgamate.sh [libdir] > errol_all.h
+#
+# The header declares the API. One translation unit defines
+# ERROL_IMPLEMENTATION before including it to compile the library in, or
+# any number define ERROL_STATIC to get private static inline copies the
+# compiler can inline at each call site. The implementation is C only.
+#
+
+dir=${1:-$(dirname "$0")}
+
+# print a file, replacing local includes with their contents
+
+inline_file() {
+	while IFS= read -r line; do
+		case "$line" in
+		'#include "errol.h"')
+			;;
+		'#include "'*'"')
+			name=${line#'#include "'}
+			name=${name%'"'}
+			printf '/* begin %s */\n' "$name"
+			inline_file "$dir/$name"
+			printf '/* end %s */\n' "$name"
+			;;
+		*)
+			printf '%s\n' "$line"
+			;;
+		esac
+	done < "$1"
+}
+
+cat <<EOF
+/*
+ * errol_all.h: Errol as a single header, generated by amalgamate.sh from
+ * errol.h and errol.c. Do not edit.
+ */
+
+#ifndef ERROL_ALL_H
+#define ERROL_ALL_H
+
+#ifdef ERROL_STATIC
+#define ERROL_IMPLEMENTATION
+#define ERRDEF static inline
+#endif
+
+#include <stdbool.h>
+
+EOF
+
+inline_file "$dir/errol.h"
+
+cat <<EOF
+
+#endif
+
+#if defined(ERROL_IMPLEMENTATION) && !defined(ERROL_ALL_IMPLEMENTED)
+#define ERROL_ALL_IMPLEMENTED
+
+EOF
+
+inline_file "$dir/errol.c"
+
+cat <<EOF
+
+#endif
+EOF
@@ -432,437 +432,871 @@ static uint64_t errol_enum3[432] = {
 	0x6d175d226331d03a,
 	0x6d4b9445072f4374,
 };
-static struct errol_slab_t errol_enum3_data[432] = {
-	{ "40648030339495312", 69 },
-	{ "4498645355592131", -134 },
-	{ "678321594594593", 244 },
-	{ "36539702510912277", -230 },
-	{ "56819570380646536", -70 },
-	{ "42452693975546964", 175 },
-	{ "34248868699178663", 291 },
-	{ "34037810581283983", -267 },
-	{ "67135881167178176", -188 },
-	{ "74973710847373845", -108 },
-	{ "60272377639347644", -45 },
-	{ "1316415380484425", 116 },
-	{ "64433314612521525", 218 },
-	{ "31961502891542243", 263 },
-	{ "4407140524515149", 303 },
-	{ "69928982131052126", -291 },
-	{ "5331838923808276", -248 },
-	{ "24766435002945523", -208 },
-	{ "21509066976048781", -149 },
-	{ "2347200170470694", -123 },
-	{ "51404180294474556", -89 },
-	{ "12320586499023201", -56 },
-	{ "38099461575161174", 45 },
-	{ "3318949537676913", 79 },
-	{ "48988560059074597", 136 },
-	{ "7955843973866726", 209 },
-	{ "2630089515909384", 227 },
-	{ "11971601492124911", 258 },
-	{ "35394816534699092", 284 },
-	{ "47497368114750945", 299 },
-	{ "54271187548763685", 305 },
-	{ "2504414972009504", -302 },
-	{ "69316187906522606", -275 },
-	{ "53263359599109627", -252 },
-	{ "24384437085962037", -239 },
-	{ "3677854139813342", -213 },
-	{ "44318030915155535", -195 },
-	{ "28150140033551147", -162 },
-	{ "1157373742186464", -143 },
-	{ "2229658838863212", -132 },
-	{ "67817280930489786", -117 },
-	{ "56966478488538934", -92 },
-	{ "49514357246452655", -74 },
-	{ "74426102121433776", -64 },
-	{ "78851753593748485", -55 },
-	{ "19024128529074359", -25 },
-	{ "32118580932839778", 57 },
-	{ "17693166778887419", 72 },
-	{ "78117757194253536", 88 },
-	{ "56627018760181905", 122 },
-	{ "35243988108650928", 153 },
-	{ "38624526316654214", 194 },
-	{ "2397422026462446", 213 },
-	{ "37862966954556723", 224 },
-	{ "56089100059334965", 237 },
-	{ "3666156212014994", 249 },
-	{ "47886405968499643", 258 },
-	{ "48228872759189434", 272 },
-	{ "29980574575739863", 289 },
-	{ "37049827284413546", 297 },
-	{ "37997894491800756", 300 },
-	{ "37263572163337027", 304 },
-	{ "16973149506391291", 308 },
-	{ "391314839376485", -304 },
-	{ "38797447671091856", -300 },
-	{ "54994366114768736", -281 },
-	{ "23593494977819109", -270 },
-	{ "61359116592542813", -265 },
-	{ "1332959730952069", -248 },
-	{ "6096109271490509", -240 },
-	{ "22874741188249992", -231 },
-	{ "33104948806015703", -227 },
-	{ "21670630627577332", -209 },
-	{ "70547825868713855", -201 },
-	{ "54981742371928845", -192 },
-	{ "27843818440071113", -171 },
-	{ "4504022405368184", -161 },
-	{ "2548351460621656", -148 },
-	{ "4629494968745856", -143 },
-	{ "557414709715803", -133 },
-	{ "23897004381644022", -131 },
-	{ "33057350728075958", -117 },
-	{ "47628822744182433", -112 },
-	{ "22520091703825729", -96 },
-	{ "1285104507361864", -89 },
-	{ "46239793787746783", -81 },
-	{ "330095714976351", -73 },
-	{ "4994144928421182", -66 },
-	{ "77003665618895", -58 },
-	{ "49282345996092803", -56 },
-	{ "66534156679273626", -48 },
-	{ "24661175471861008", -36 },
-	{ "45035996273704964", 39 },
-	{ "32402369146794532", 51 },
-	{ "42859354584576066", 61 },
-	{ "1465909318208761", 71 },
-	{ "70772667115549675", 72 },
-	{ "18604316837693468", 86 },
-	{ "38329392744333992", 113 },
-	{ "21062646087750798", 117 },
-	{ "972708181182949", 132 },
-	{ "36683053719290777", 146 },
-	{ "32106017483029628", 166 },
-	{ "41508952543121158", 190 },
-	{ "45072812455233127", 205 },
-	{ "59935550661561155", 212 },
-	{ "40270821632825953", 217 },
-	{ "60846862848160256", 219 },
-	{ "42788225889846894", 225 },
-	{ "28044550029667482", 237 },
-	{ "46475406389115295", 240 },
-	{ "7546114860200514", 246 },
-	{ "7332312424029988", 249 },
-	{ "23943202984249821", 258 },
-	{ "15980751445771122", 263 },
-	{ "21652206566352648", 272 },
-	{ "65171333649148234", 278 },
-	{ "70789633069398184", 284 },
-	{ "68600253110025576", 290 },
-	{ "4234784709771466", 295 },
-	{ "14819930913765419", 298 },
-	{ "9499473622950189", 299 },
-	{ "71272819274635585", 302 },
-	{ "16959746108988652", 304 },
-	{ "13567796887190921", 305 },
-	{ "4735325513114182", 306 },
-	{ "67892598025565165", 308 },
-	{ "81052743999542975", -307 },
-	{ "4971131903427841", -303 },
-	{ "19398723835545928", -300 },
-	{ "29232758945460627", -298 },
-	{ "27497183057384368", -281 },
-	{ "17970091719480621", -275 },
-	{ "22283747288943228", -274 },
-	{ "47186989955638217", -270 },
-	{ "6819439187504402", -266 },
-	{ "47902021250710456", -262 },
-	{ "41378294570975613", -249 },
-	{ "2665919461904138", -248 },
-	{ "3421423777071132", -247 },
-	{ "12192218542981019", -239 },
-	{ "7147520638007367", -235 },
-	{ "45749482376499984", -231 },
-	{ "80596937390013985", -229 },
-	{ "26761990828289327", -214 },
-	{ "18738512510673039", -211 },
-	{ "619160875073638", -209 },
-	{ "403997300048931", -206 },
-	{ "22159015457577768", -195 },
-	{ "13745435592982211", -192 },
-	{ "33567940583589088", -188 },
-	{ "4812711195250522", -184 },
-	{ "3591036630219558", -167 },
-	{ "1126005601342046", -161 },
-	{ "5047135806497922", -154 },
-	{ "43018133952097563", -149 },
-	{ "45209911804158747", -146 },
-	{ "2314747484372928", -143 },
-	{ "65509428048152994", -138 },
-	{ "2787073548579015", -133 },
-	{ "1114829419431606", -132 },
-	{ "4459317677726424", -132 },
-	{ "32269008655522087", -128 },
-	{ "16528675364037979", -117 },
-	{ "66114701456151916", -117 },
-	{ "54934856534126976", -116 },
-	{ "21168365664081082", -111 },
-	{ "67445733463759384", -104 },
-	{ "45590931008842566", -95 },
-	{ "8031903171011649", -91 },
-	{ "2570209014723728", -89 },
-	{ "6516605505584466", -89 },
-	{ "32943123175907307", -78 },
-	{ "82523928744087755", -74 },
-	{ "28409785190323268", -70 },
-	{ "52853886779813977", -69 },
-	{ "30417302377115577", -65 },
-	{ "1925091640472375", -58 },
-	{ "30801466247558002", -57 },
-	{ "24641172998046401", -56 },
-	{ "19712938398437121", -55 },
-	{ "43129529027318865", -52 },
-	{ "15068094409836911", -45 },
-	{ "48658418478920193", -41 },
-	{ "49322350943722016", -36 },
-	{ "38048257058148717", -25 },
-	{ "14411294198511291", 45 },
-	{ "32745697577386472", 48 },
-	{ "16059290466419889", 57 },
-	{ "64237161865679556", 57 },
-	{ "8003248329710242", 63 },
-	{ "81296060678990625", 69 },
-	{ "8846583389443709", 71 },
-	{ "35386333557774838", 72 },
-	{ "21606114462319112", 74 },
-	{ "18413733104063271", 84 },
-	{ "35887030159858487", 87 },
-	{ "2825769263311679", 104 },
-	{ "2138446062528161", 114 },
-	{ "52656615219377", 116 },
-	{ "16850116870200639", 118 },
-	{ "48635409059147446", 132 },
-	{ "12247140014768649", 136 },
-	{ "16836228873919609", 138 },
-	{ "5225574770881846", 147 },
-	{ "42745323906998127", 155 },
-	{ "10613173493886741", 175 },
-	{ "10377238135780289", 190 },
-	{ "29480080280199528", 191 },
-	{ "4679330956996797", 201 },
-	{ "3977921986933363", 209 },
-	{ "56560320317673966", 210 },
-	{ "1198711013231223", 213 },
-	{ "4794844052924892", 213 },
-	{ "16108328653130381", 218 },
-	{ "57878622568856074", 219 },
-	{ "18931483477278361", 224 },
-	{ "4278822588984689", 225 },
-	{ "1315044757954692", 227 },
-	{ "14022275014833741", 237 },
-	{ "5143975308105889", 237 },
-	{ "64517311884236306", 238 },
-	{ "3391607972972965", 244 },
-	{ "3773057430100257", 246 },
-	{ "1833078106007497", 249 },
-	{ "64766168833734675", 249 },
-	{ "1197160149212491", 258 },
-	{ "2394320298424982", 258 },
-	{ "4788640596849964", 258 },
-	{ "1598075144577112", 263 },
-	{ "3196150289154224", 263 },
-	{ "83169412421960475", 271 },
-	{ "43304413132705296", 272 },
-	{ "5546524276967009", 277 },
-	{ "3539481653469909", 284 },
-	{ "7078963306939818", 284 },
-	{ "14990287287869931", 289 },
-	{ "34300126555012788", 290 },
-	{ "17124434349589332", 291 },
-	{ "2117392354885733", 295 },
-	{ "47639264836707725", 296 },
-	{ "7409965456882709", 297 },
-	{ "29639861827530837", 298 },
-	{ "79407577493590275", 299 },
-	{ "18998947245900378", 300 },
-	{ "35636409637317792", 302 },
-	{ "23707742595255608", 303 },
-	{ "47415485190511216", 303 },
-	{ "33919492217977303", 304 },
-	{ "6783898443595461", 304 },
-	{ "27135593774381842", 305 },
-	{ "2367662756557091", 306 },
-	{ "44032152438472327", 307 },
-	{ "33946299012782582", 308 },
-	{ "17976931348623157", 309 },
-	{ "40526371999771488", -307 },
-	{ "1956574196882425", -304 },
-	{ "78262967875297", -304 },
-	{ "1252207486004752", -302 },
-	{ "5008829944019008", -302 },
-	{ "1939872383554593", -300 },
-	{ "3879744767109186", -300 },
-	{ "44144884605471774", -291 },
-	{ "45129663866844427", -289 },
-	{ "2749718305738437", -281 },
-	{ "5499436611476874", -281 },
-	{ "35940183438961242", -275 },
-	{ "71880366877922484", -275 },
-	{ "44567494577886457", -274 },
-	{ "25789638850173173", -270 },
-	{ "17018905290641991", -267 },
-	{ "3409719593752201", -266 },
-	{ "6135911659254281", -265 },
-	{ "23951010625355228", -262 },
-	{ "51061856989121905", -260 },
-	{ "4137829457097561", -249 },
-	{ "13329597309520689", -248 },
-	{ "26659194619041378", -248 },
-	{ "53318389238082755", -248 },
-	{ "1710711888535566", -247 },
-	{ "6842847554142264", -247 },
-	{ "609610927149051", -240 },
-	{ "1219221854298102", -239 },
-	{ "2438443708596204", -239 },
-	{ "2287474118824999", -231 },
-	{ "4574948237649998", -231 },
-	{ "18269851255456139", -230 },
-	{ "40298468695006992", -229 },
-	{ "16552474403007851", -227 },
-	{ "39050270537318193", -217 },
-	{ "1838927069906671", -213 },
-	{ "7355708279626684", -213 },
-	{ "37477025021346077", -211 },
-	{ "43341261255154663", -209 },
-	{ "12383217501472761", -208 },
-	{ "2019986500244655", -206 },
-	{ "35273912934356928", -201 },
-	{ "47323883490786093", -199 },
-	{ "2215901545757777", -195 },
-	{ "4431803091515554", -195 },
-	{ "27490871185964422", -192 },
-	{ "64710073234908765", -189 },
-	{ "57511323531737074", -188 },
-	{ "2406355597625261", -184 },
-	{ "75862936714499446", -176 },
-	{ "1795518315109779", -167 },
-	{ "7182073260439116", -167 },
-	{ "563002800671023", -162 },
-	{ "2252011202684092", -161 },
-	{ "2523567903248961", -154 },
-	{ "10754533488024391", -149 },
-	{ "37436263604934127", -149 },
-	{ "1274175730310828", -148 },
-	{ "5096702921243312", -148 },
-	{ "11573737421864639", -143 },
-	{ "23147474843729279", -143 },
-	{ "46294949687458557", -143 },
-	{ "36067106647774144", -141 },
-	{ "44986453555921307", -134 },
-	{ "27870735485790148", -133 },
-	{ "55741470971580295", -133 },
-	{ "11148294194316059", -132 },
-	{ "22296588388632118", -132 },
-	{ "44593176777264236", -132 },
-	{ "11948502190822011", -131 },
-	{ "47794008763288043", -131 },
-	{ "1173600085235347", -123 },
-	{ "4694400340941388", -123 },
-	{ "1652867536403798", -117 },
-	{ "3305735072807596", -117 },
-	{ "6611470145615192", -117 },
-	{ "27467428267063488", -116 },
-	{ "4762882274418243", -112 },
-	{ "10584182832040541", -111 },
-	{ "42336731328162165", -111 },
-	{ "33722866731879692", -104 },
-	{ "69097540994131414", -98 },
-	{ "45040183407651457", -96 },
-	{ "5696647848853893", -92 },
-	{ "40159515855058247", -91 },
-	{ "12851045073618639", -89 },
-	{ "25702090147237278", -89 },
-	{ "3258302752792233", -89 },
-	{ "5140418029447456", -89 },
-	{ "23119896893873391", -81 },
-	{ "51753157237874753", -81 },
-	{ "67761208324172855", -77 },
-	{ "8252392874408775", -74 },
-	{ "1650478574881755", -73 },
-	{ "660191429952702", -73 },
-	{ "3832399419240467", -70 },
-	{ "26426943389906988", -69 },
-	{ "2497072464210591", -66 },
-	{ "15208651188557789", -65 },
-	{ "37213051060716888", -64 },
-	{ "55574205388093594", -61 },
-	{ "385018328094475", -58 },
-	{ "15400733123779001", -57 },
-	{ "61602932495116004", -57 },
-	{ "14784703798827841", -56 },
-	{ "29569407597655683", -56 },
-	{ "9856469199218561", -56 },
-	{ "39425876796874242", -55 },
-	{ "21564764513659432", -52 },
-	{ "35649516398744314", -48 },
-	{ "51091836539008967", -47 },
-	{ "30136188819673822", -45 },
-	{ "4865841847892019", -41 },
-	{ "33729482964455627", -38 },
-	{ "2466117547186101", -36 },
-	{ "4932235094372202", -36 },
-	{ "1902412852907436", -25 },
-	{ "3804825705814872", -25 },
-	{ "80341375308088225", 44 },
-	{ "28822588397022582", 45 },
-	{ "57645176794045164", 45 },
-	{ "65491395154772944", 48 },
-	{ "64804738293589064", 51 },
-	{ "1605929046641989", 57 },
-	{ "3211858093283978", 57 },
-	{ "6423716186567956", 57 },
-	{ "4001624164855121", 63 },
-	{ "4064803033949531", 69 },
-	{ "8129606067899062", 69 },
-	{ "4384946084578497", 70 },
-	{ "2931818636417522", 71 },
-	{ "884658338944371", 71 },
-	{ "1769316677888742", 72 },
-	{ "3538633355777484", 72 },
-	{ "7077266711554968", 72 },
-	{ "43212228924638223", 74 },
-	{ "6637899075353826", 79 },
-	{ "36827466208126543", 84 },
-	{ "37208633675386937", 86 },
-	{ "39058878597126768", 88 },
-	{ "57654578150150385", 91 },
-	{ "5651538526623358", 104 },
-	{ "76658785488667984", 113 },
-	{ "4276892125056322", 114 },
-	{ "263283076096885", 116 },
-	{ "10531323043875399", 117 },
-	{ "42125292175501597", 117 },
-	{ "33700233740401277", 118 },
-	{ "44596066840334405", 125 },
-	{ "9727081811829489", 132 },
-	{ "61235700073843246", 135 },
-	{ "24494280029537298", 136 },
-	{ "4499029632233837", 137 },
-	{ "18341526859645389", 146 },
-	{ "2612787385440923", 147 },
-	{ "6834859331393543", 147 },
-	{ "70487976217301855", 153 },
-	{ "40366692112133834", 160 },
-	{ "64212034966059256", 166 },
-	{ "21226346987773482", 175 },
-	{ "51886190678901447", 189 },
-	{ "20754476271560579", 190 },
-	{ "83017905086242315", 190 },
-	{ "58960160560399056", 191 },
-	{ "66641177824100826", 194 },
-	{ "5493127645170153", 201 },
-	{ "39779219869333628", 209 },
-	{ "79558439738667255", 209 },
-	{ "50523702331566894", 210 },
-	{ "40933393326155808", 212 },
-	{ "81866786652311615", 212 },
-	{ "11987110132312231", 213 },
-	{ "23974220264624462", 213 },
-	{ "47948440529248924", 213 },
-	{ "8054164326565191", 217 },
-	{ "32216657306260762", 218 },
-	{ "30423431424080128", 219 },
+static const uint64_t errol_enum3_sig[432] = {
+	40648030339495312,
+	4498645355592131,
+	678321594594593,
+	36539702510912277,
+	56819570380646536,
+	42452693975546964,
+	34248868699178663,
+	34037810581283983,
+	67135881167178176,
+	74973710847373845,
+	60272377639347644,
+	1316415380484425,
+	64433314612521525,
+	31961502891542243,
+	4407140524515149,
+	69928982131052126,
+	5331838923808276,
+	24766435002945523,
+	21509066976048781,
+	2347200170470694,
+	51404180294474556,
+	12320586499023201,
+	38099461575161174,
+	3318949537676913,
+	48988560059074597,
+	7955843973866726,
+	2630089515909384,
+	11971601492124911,
+	35394816534699092,
+	47497368114750945,
+	54271187548763685,
+	2504414972009504,
+	69316187906522606,
+	53263359599109627,
+	24384437085962037,
+	3677854139813342,
+	44318030915155535,
+	28150140033551147,
+	1157373742186464,
+	2229658838863212,
+	67817280930489786,
+	56966478488538934,
+	49514357246452655,
+	74426102121433776,
+	78851753593748485,
+	19024128529074359,
+	32118580932839778,
+	17693166778887419,
+	78117757194253536,
+	56627018760181905,
+	35243988108650928,
+	38624526316654214,
+	2397422026462446,
+	37862966954556723,
+	56089100059334965,
+	3666156212014994,
+	47886405968499643,
+	48228872759189434,
+	29980574575739863,
+	37049827284413546,
+	37997894491800756,
+	37263572163337027,
+	16973149506391291,
+	391314839376485,
+	38797447671091856,
+	54994366114768736,
+	23593494977819109,
+	61359116592542813,
+	1332959730952069,
+	6096109271490509,
+	22874741188249992,
+	33104948806015703,
+	21670630627577332,
+	70547825868713855,
+	54981742371928845,
+	27843818440071113,
+	4504022405368184,
+	2548351460621656,
+	4629494968745856,
+	557414709715803,
+	23897004381644022,
+	33057350728075958,
+	47628822744182433,
+	22520091703825729,
+	1285104507361864,
+	46239793787746783,
+	330095714976351,
+	4994144928421182,
+	77003665618895,
+	49282345996092803,
+	66534156679273626,
+	24661175471861008,
+	45035996273704964,
+	32402369146794532,
+	42859354584576066,
+	1465909318208761,
+	70772667115549675,
+	18604316837693468,
+	38329392744333992,
+	21062646087750798,
+	972708181182949,
+	36683053719290777,
+	32106017483029628,
+	41508952543121158,
+	45072812455233127,
+	59935550661561155,
+	40270821632825953,
+	60846862848160256,
+	42788225889846894,
+	28044550029667482,
+	46475406389115295,
+	7546114860200514,
+	7332312424029988,
+	23943202984249821,
+	15980751445771122,
+	21652206566352648,
+	65171333649148234,
+	70789633069398184,
+	68600253110025576,
+	4234784709771466,
+	14819930913765419,
+	9499473622950189,
+	71272819274635585,
+	16959746108988652,
+	13567796887190921,
+	4735325513114182,
+	67892598025565165,
+	81052743999542975,
+	4971131903427841,
+	19398723835545928,
+	29232758945460627,
+	27497183057384368,
+	17970091719480621,
+	22283747288943228,
+	47186989955638217,
+	6819439187504402,
+	47902021250710456,
+	41378294570975613,
+	2665919461904138,
+	3421423777071132,
+	12192218542981019,
+	7147520638007367,
+	45749482376499984,
+	80596937390013985,
+	26761990828289327,
+	18738512510673039,
+	619160875073638,
+	403997300048931,
+	22159015457577768,
+	13745435592982211,
+	33567940583589088,
+	4812711195250522,
+	3591036630219558,
+	1126005601342046,
+	5047135806497922,
+	43018133952097563,
+	45209911804158747,
+	2314747484372928,
+	65509428048152994,
+	2787073548579015,
+	1114829419431606,
+	4459317677726424,
+	32269008655522087,
+	16528675364037979,
+	66114701456151916,
+	54934856534126976,
+	21168365664081082,
+	67445733463759384,
+	45590931008842566,
+	8031903171011649,
+	2570209014723728,
+	6516605505584466,
+	32943123175907307,
+	82523928744087755,
+	28409785190323268,
+	52853886779813977,
+	30417302377115577,
+	1925091640472375,
+	30801466247558002,
+	24641172998046401,
+	19712938398437121,
+	43129529027318865,
+	15068094409836911,
+	48658418478920193,
+	49322350943722016,
+	38048257058148717,
+	14411294198511291,
+	32745697577386472,
+	16059290466419889,
+	64237161865679556,
+	8003248329710242,
+	81296060678990625,
+	8846583389443709,
+	35386333557774838,
+	21606114462319112,
+	18413733104063271,
+	35887030159858487,
+	2825769263311679,
+	2138446062528161,
+	52656615219377,
+	16850116870200639,
+	48635409059147446,
+	12247140014768649,
+	16836228873919609,
+	5225574770881846,
+	42745323906998127,
+	10613173493886741,
+	10377238135780289,
+	29480080280199528,
+	4679330956996797,
+	3977921986933363,
+	56560320317673966,
+	1198711013231223,
+	4794844052924892,
+	16108328653130381,
+	57878622568856074,
+	18931483477278361,
+	4278822588984689,
+	1315044757954692,
+	14022275014833741,
+	5143975308105889,
+	64517311884236306,
+	3391607972972965,
+	3773057430100257,
+	1833078106007497,
+	64766168833734675,
+	1197160149212491,
+	2394320298424982,
+	4788640596849964,
+	1598075144577112,
+	3196150289154224,
+	83169412421960475,
+	43304413132705296,
+	5546524276967009,
+	3539481653469909,
+	7078963306939818,
+	14990287287869931,
+	34300126555012788,
+	17124434349589332,
+	2117392354885733,
+	47639264836707725,
+	7409965456882709,
+	29639861827530837,
+	79407577493590275,
+	18998947245900378,
+	35636409637317792,
+	23707742595255608,
+	47415485190511216,
+	33919492217977303,
+	6783898443595461,
+	27135593774381842,
+	2367662756557091,
+	44032152438472327,
+	33946299012782582,
+	17976931348623157,
+	40526371999771488,
+	1956574196882425,
+	78262967875297,
+	1252207486004752,
+	5008829944019008,
+	1939872383554593,
+	3879744767109186,
+	44144884605471774,
+	45129663866844427,
+	2749718305738437,
+	5499436611476874,
+	35940183438961242,
+	71880366877922484,
+	44567494577886457,
+	25789638850173173,
+	17018905290641991,
+	3409719593752201,
+	6135911659254281,
+	23951010625355228,
+	51061856989121905,
+	4137829457097561,
+	13329597309520689,
+	26659194619041378,
+	53318389238082755,
+	1710711888535566,
+	6842847554142264,
+	609610927149051,
+	1219221854298102,
+	2438443708596204,
+	2287474118824999,
+	4574948237649998,
+	18269851255456139,
+	40298468695006992,
+	16552474403007851,
+	39050270537318193,
+	1838927069906671,
+	7355708279626684,
+	37477025021346077,
+	43341261255154663,
+	12383217501472761,
+	2019986500244655,
+	35273912934356928,
+	47323883490786093,
+	2215901545757777,
+	4431803091515554,
+	27490871185964422,
+	64710073234908765,
+	57511323531737074,
+	2406355597625261,
+	75862936714499446,
+	1795518315109779,
+	7182073260439116,
+	563002800671023,
+	2252011202684092,
+	2523567903248961,
+	10754533488024391,
+	37436263604934127,
+	1274175730310828,
+	5096702921243312,
+	11573737421864639,
+	23147474843729279,
+	46294949687458557,
+	36067106647774144,
+	44986453555921307,
+	27870735485790148,
+	55741470971580295,
+	11148294194316059,
+	22296588388632118,
+	44593176777264236,
+	11948502190822011,
+	47794008763288043,
+	1173600085235347,
+	4694400340941388,
+	1652867536403798,
+	3305735072807596,
+	6611470145615192,
+	27467428267063488,
+	4762882274418243,
+	10584182832040541,
+	42336731328162165,
+	33722866731879692,
+	69097540994131414,
+	45040183407651457,
+	5696647848853893,
+	40159515855058247,
+	12851045073618639,
+	25702090147237278,
+	3258302752792233,
+	5140418029447456,
+	23119896893873391,
+	51753157237874753,
+	67761208324172855,
+	8252392874408775,
+	1650478574881755,
+	660191429952702,
+	3832399419240467,
+	26426943389906988,
+	2497072464210591,
+	15208651188557789,
+	37213051060716888,
+	55574205388093594,
+	385018328094475,
+	15400733123779001,
+	61602932495116004,
+	14784703798827841,
+	29569407597655683,
+	9856469199218561,
+	39425876796874242,
+	21564764513659432,
+	35649516398744314,
+	51091836539008967,
+	30136188819673822,
+	4865841847892019,
+	33729482964455627,
+	2466117547186101,
+	4932235094372202,
+	1902412852907436,
+	3804825705814872,
+	80341375308088225,
+	28822588397022582,
+	57645176794045164,
+	65491395154772944,
+	64804738293589064,
+	1605929046641989,
+	3211858093283978,
+	6423716186567956,
+	4001624164855121,
+	4064803033949531,
+	8129606067899062,
+	4384946084578497,
+	2931818636417522,
+	884658338944371,
+	1769316677888742,
+	3538633355777484,
+	7077266711554968,
+	43212228924638223,
+	6637899075353826,
+	36827466208126543,
+	37208633675386937,
+	39058878597126768,
+	57654578150150385,
+	5651538526623358,
+	76658785488667984,
+	4276892125056322,
+	263283076096885,
+	10531323043875399,
+	42125292175501597,
+	33700233740401277,
+	44596066840334405,
+	9727081811829489,
+	61235700073843246,
+	24494280029537298,
+	4499029632233837,
+	18341526859645389,
+	2612787385440923,
+	6834859331393543,
+	70487976217301855,
+	40366692112133834,
+	64212034966059256,
+	21226346987773482,
+	51886190678901447,
+	20754476271560579,
+	83017905086242315,
+	58960160560399056,
+	66641177824100826,
+	5493127645170153,
+	39779219869333628,
+	79558439738667255,
+	50523702331566894,
+	40933393326155808,
+	81866786652311615,
+	11987110132312231,
+	23974220264624462,
+	47948440529248924,
+	8054164326565191,
+	32216657306260762,
+	30423431424080128,
+};
+static const int16_t errol_enum3_exp[432] = {
+	69,
+	-134,
+	244,
+	-230,
+	-70,
+	175,
+	291,
+	-267,
+	-188,
+	-108,
+	-45,
+	116,
+	218,
+	263,
+	303,
+	-291,
+	-248,
+	-208,
+	-149,
+	-123,
+	-89,
+	-56,
+	45,
+	79,
+	136,
+	209,
+	227,
+	258,
+	284,
+	299,
+	305,
+	-302,
+	-275,
+	-252,
+	-239,
+	-213,
+	-195,
+	-162,
+	-143,
+	-132,
+	-117,
+	-92,
+	-74,
+	-64,
+	-55,
+	-25,
+	57,
+	72,
+	88,
+	122,
+	153,
+	194,
+	213,
+	224,
+	237,
+	249,
+	258,
+	272,
+	289,
+	297,
+	300,
+	304,
+	308,
+	-304,
+	-300,
+	-281,
+	-270,
+	-265,
+	-248,
+	-240,
+	-231,
+	-227,
+	-209,
+	-201,
+	-192,
+	-171,
+	-161,
+	-148,
+	-143,
+	-133,
+	-131,
+	-117,
+	-112,
+	-96,
+	-89,
+	-81,
+	-73,
+	-66,
+	-58,
+	-56,
+	-48,
+	-36,
+	39,
+	51,
+	61,
+	71,
+	72,
+	86,
+	113,
+	117,
+	132,
+	146,
+	166,
+	190,
+	205,
+	212,
+	217,
+	219,
+	225,
+	237,
+	240,
+	246,
+	249,
+	258,
+	263,
+	272,
+	278,
+	284,
+	290,
+	295,
+	298,
+	299,
+	302,
+	304,
+	305,
+	306,
+	308,
+	-307,
+	-303,
+	-300,
+	-298,
+	-281,
+	-275,
+	-274,
+	-270,
+	-266,
+	-262,
+	-249,
+	-248,
+	-247,
+	-239,
+	-235,
+	-231,
+	-229,
+	-214,
+	-211,
+	-209,
+	-206,
+	-195,
+	-192,
+	-188,
+	-184,
+	-167,
+	-161,
+	-154,
+	-149,
+	-146,
+	-143,
+	-138,
+	-133,
+	-132,
+	-132,
+	-128,
+	-117,
+	-117,
+	-116,
+	-111,
+	-104,
+	-95,
+	-91,
+	-89,
+	-89,
+	-78,
+	-74,
+	-70,
+	-69,
+	-65,
+	-58,
+	-57,
+	-56,
+	-55,
+	-52,
+	-45,
+	-41,
+	-36,
+	-25,
+	45,
+	48,
+	57,
+	57,
+	63,
+	69,
+	71,
+	72,
+	74,
+	84,
+	87,
+	104,
+	114,
+	116,
+	118,
+	132,
+	136,
+	138,
+	147,
+	155,
+	175,
+	190,
+	191,
+	201,
+	209,
+	210,
+	213,
+	213,
+	218,
+	219,
+	224,
+	225,
+	227,
+	237,
+	237,
+	238,
+	244,
+	246,
+	249,
+	249,
+	258,
+	258,
+	258,
+	263,
+	263,
+	271,
+	272,
+	277,
+	284,
+	284,
+	289,
+	290,
+	291,
+	295,
+	296,
+	297,
+	298,
+	299,
+	300,
+	302,
+	303,
+	303,
+	304,
+	304,
+	305,
+	306,
+	307,
+	308,
+	309,
+	-307,
+	-304,
+	-304,
+	-302,
+	-302,
+	-300,
+	-300,
+	-291,
+	-289,
+	-281,
+	-281,
+	-275,
+	-275,
+	-274,
+	-270,
+	-267,
+	-266,
+	-265,
+	-262,
+	-260,
+	-249,
+	-248,
+	-248,
+	-248,
+	-247,
+	-247,
+	-240,
+	-239,
+	-239,
+	-231,
+	-231,
+	-230,
+	-229,
+	-227,
+	-217,
+	-213,
+	-213,
+	-211,
+	-209,
+	-208,
+	-206,
+	-201,
+	-199,
+	-195,
+	-195,
+	-192,
+	-189,
+	-188,
+	-184,
+	-176,
+	-167,
+	-167,
+	-162,
+	-161,
+	-154,
+	-149,
+	-149,
+	-148,
+	-148,
+	-143,
+	-143,
+	-143,
+	-141,
+	-134,
+	-133,
+	-133,
+	-132,
+	-132,
+	-132,
+	-131,
+	-131,
+	-123,
+	-123,
+	-117,
+	-117,
+	-117,
+	-116,
+	-112,
+	-111,
+	-111,
+	-104,
+	-98,
+	-96,
+	-92,
+	-91,
+	-89,
+	-89,
+	-89,
+	-89,
+	-81,
+	-81,
+	-77,
+	-74,
+	-73,
+	-73,
+	-70,
+	-69,
+	-66,
+	-65,
+	-64,
+	-61,
+	-58,
+	-57,
+	-57,
+	-56,
+	-56,
+	-56,
+	-55,
+	-52,
+	-48,
+	-47,
+	-45,
+	-41,
+	-38,
+	-36,
+	-36,
+	-25,
+	-25,
+	44,
+	45,
+	45,
+	48,
+	51,
+	57,
+	57,
+	57,
+	63,
+	69,
+	69,
+	70,
+	71,
+	71,
+	72,
+	72,
+	72,
+	74,
+	79,
+	84,
+	86,
+	88,
+	91,
+	104,
+	113,
+	114,
+	116,
+	117,
+	117,
+	118,
+	125,
+	132,
+	135,
+	136,
+	137,
+	146,
+	147,
+	147,
+	153,
+	160,
+	166,
+	175,
+	189,
+	190,
+	190,
+	191,
+	194,
+	201,
+	209,
+	209,
+	210,
+	212,
+	212,
+	213,
+	213,
+	213,
+	217,
+	218,
+	219,
 };
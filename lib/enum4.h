@@ -466,471 +466,939 @@ static uint64_t errol_enum4[466] = {
 	0x728279b2c40fddb7,
 	0x737a37935f3b71c8,
 };
-static struct errol_slab_t errol_enum4_data[466] = {
-	{ "45035996273704964", 39 },
-	{ "3815292988911787", -153 },
-	{ "29480080280199528", 191 },
-	{ "44692281266648703", -258 },
-	{ "45590931008842566", -95 },
-	{ "263283076096885", 116 },
-	{ "8660882626541059", 272 },
-	{ "23802549887508958", -288 },
-	{ "3231978400391448", -205 },
-	{ "11148294194316059", -132 },
-	{ "4932235094372202", -36 },
-	{ "5545129224676696", 67 },
-	{ "1579729660450949", 142 },
-	{ "64517311884236306", 238 },
-	{ "47497368114750945", 299 },
-	{ "1939872383554593", -300 },
-	{ "3218322462039769", -273 },
-	{ "45674628138640346", -231 },
-	{ "28150140033551147", -162 },
-	{ "28934343554661598", -144 },
-	{ "27467428267063488", -116 },
-	{ "26426943389906988", -69 },
-	{ "5497935665131539", -17 },
-	{ "6423716186567956", 57 },
-	{ "4328301679886463", 84 },
-	{ "52542458920095267", 124 },
-	{ "12635241255698069", 184 },
-	{ "39779219869333628", 209 },
-	{ "24049003101035467", 255 },
-	{ "34300126555012788", 290 },
-	{ "23707742595255608", 303 },
-	{ "156525935750594", -303 },
-	{ "4469168098652816", -294 },
-	{ "54994366114768736", -281 },
-	{ "3548008708901906", -264 },
-	{ "30480546357452547", -240 },
-	{ "2019986500244655", -206 },
-	{ "6471007323490877", -189 },
-	{ "45040224053681835", -161 },
-	{ "18083964721663499", -145 },
-	{ "46294949687458557", -143 },
-	{ "47794008763288043", -131 },
-	{ "14994742169474769", -107 },
-	{ "8252392874408775", -74 },
-	{ "74426102121433776", -64 },
-	{ "1902412852907436", -25 },
-	{ "31687037536784963", -9 },
-	{ "22661283172575339", 47 },
-	{ "56249190794585755", 63 },
-	{ "35386333557774838", 72 },
-	{ "21384460625281608", 114 },
-	{ "421252921755016", 117 },
-	{ "9797712011814919", 136 },
-	{ "45095779868958055", 159 },
-	{ "1037723813578029", 190 },
-	{ "26316426035188758", 194 },
-	{ "50964926104335406", 222 },
-	{ "36661562120149938", 249 },
-	{ "21652206566352648", 272 },
-	{ "34643530506164237", 273 },
-	{ "47639264836707725", 296 },
-	{ "18998947245900378", 300 },
-	{ "37263572163337027", 304 },
-	{ "8105274399954298", -307 },
-	{ "1252207486004752", -302 },
-	{ "279323006165801", -295 },
-	{ "14876593679693099", -289 },
-	{ "30196920764723862", -285 },
-	{ "42102548538193536", -275 },
-	{ "6819439187504402", -266 },
-	{ "4790202125071046", -262 },
-	{ "26659194619041378", -248 },
-	{ "12192218542981019", -239 },
-	{ "59250402719813605", -220 },
-	{ "16159892001957239", -205 },
-	{ "4431803091515554", -195 },
-	{ "7182073260439116", -167 },
-	{ "11260056013420459", -161 },
-	{ "2523567903248961", -154 },
-	{ "45209911804158747", -146 },
-	{ "72335858886653996", -145 },
-	{ "11573737421864639", -143 },
-	{ "65687577493869365", -136 },
-	{ "44593176777264236", -132 },
-	{ "1652867536403798", -117 },
-	{ "41682387786962985", -114 },
-	{ "59978968677899076", -107 },
-	{ "20011197127335019", -87 },
-	{ "28409785190323268", -70 },
-	{ "1520865118855779", -65 },
-	{ "3372948296445563", -38 },
-	{ "475603213226859", -26 },
-	{ "44310273383417846", -23 },
-	{ "63226123031280186", -11 },
-	{ "1951348294374041", -7 },
-	{ "3399192475886301", 46 },
-	{ "32118580932839778", 57 },
-	{ "32985092799227993", 62 },
-	{ "1386282306169174", 67 },
-	{ "8846583389443709", 71 },
-	{ "1614179517443508", 82 },
-	{ "3482974734743573", 92 },
-	{ "55816446133962727", 114 },
-	{ "105313230438754", 117 },
-	{ "1685011687020064", 118 },
-	{ "9727081811829489", 132 },
-	{ "33672457747839218", 138 },
-	{ "1834152685964539", 146 },
-	{ "20555924814300128", 173 },
-	{ "50540965022792275", 184 },
-	{ "4150895254312116", 190 },
-	{ "6579106508797189", 193 },
-	{ "12841718812147129", 199 },
-	{ "40933393326155808", 212 },
-	{ "78451019754227266", 234 },
-	{ "50105430353470027", 248 },
-	{ "73323124240299875", 249 },
-	{ "7201805647305757", 262 },
-	{ "43304413132705296", 272 },
-	{ "17321765253082118", 273 },
-	{ "55465242769670085", 277 },
-	{ "68600253110025576", 290 },
-	{ "37049827284413546", 297 },
-	{ "9499473622950189", 299 },
-	{ "37997894491800756", 300 },
-	{ "47415485190511216", 303 },
-	{ "4403215243847233", 307 },
-	{ "4052637199977149", -307 },
-	{ "391314839376485", -304 },
-	{ "4971131903427841", -303 },
-	{ "37189244174230887", -302 },
-	{ "29232758945460627", -298 },
-	{ "1117292024663204", -294 },
-	{ "37191484199232746", -290 },
-	{ "5950637471877239", -289 },
-	{ "6437165690795765", -287 },
-	{ "27497183057384368", -281 },
-	{ "21051274269096768", -275 },
-	{ "2228374728894323", -274 },
-	{ "3409719593752201", -266 },
-	{ "1774004354450953", -264 },
-	{ "2395101062535523", -262 },
-	{ "5106185698912191", -260 },
-	{ "13329597309520689", -248 },
-	{ "53318389238082755", -248 },
-	{ "6096109271490509", -240 },
-	{ "24384437085962037", -239 },
-	{ "1846590122393039", -221 },
-	{ "26761990828289327", -214 },
-	{ "8079946000978619", -206 },
-	{ "2717490528888193", -205 },
-	{ "2215901545757777", -195 },
-	{ "663629462180001", -194 },
-	{ "1795518315109779", -167 },
-	{ "53583889700087966", -163 },
-	{ "5630028006710229", -162 },
-	{ "22520112026840918", -161 },
-	{ "42879299305192207", -155 },
-	{ "5047135806497922", -154 },
-	{ "37436263604934127", -149 },
-	{ "9041982360831749", -146 },
-	{ "36167929443326998", -145 },
-	{ "14467171777330799", -144 },
-	{ "57868687109323196", -144 },
-	{ "23147474843729279", -143 },
-	{ "5033183761326151", -143 },
-	{ "27870735485790148", -133 },
-	{ "22296588388632118", -132 },
-	{ "11948502190822011", -131 },
-	{ "4132168841009495", -118 },
-	{ "6611470145615192", -117 },
-	{ "54934856534126976", -116 },
-	{ "74973710847373845", -108 },
-	{ "29989484338949538", -107 },
-	{ "22520091703825729", -96 },
-	{ "5002799281833755", -88 },
-	{ "32943123175907307", -78 },
-	{ "2640765719810808", -72 },
-	{ "56819570380646536", -70 },
-	{ "1426989259361117", -68 },
-	{ "37213051060716888", -64 },
-	{ "51091836539008967", -47 },
-	{ "2466117547186101", -36 },
-	{ "32849406733814457", -34 },
-	{ "951206426453718", -26 },
-	{ "3804825705814872", -25 },
-	{ "4885506904107883", -20 },
-	{ "2933586004318867", -16 },
-	{ "7921759384196241", -10 },
-	{ "1738509105540162", -7 },
-	{ "39026965887480817", -7 },
-	{ "8034137530808823", 44 },
-	{ "5665320793143835", 46 },
-	{ "16059290466419889", 57 },
-	{ "6013265967485603", 57 },
-	{ "42859354584576066", 61 },
-	{ "14062297698646439", 63 },
-	{ "69314115308458695", 66 },
-	{ "2772564612338348", 67 },
-	{ "44232916947218547", 71 },
-	{ "17693166778887419", 72 },
-	{ "70772667115549675", 72 },
-	{ "6456718069774032", 82 },
-	{ "3588703015985849", 87 },
-	{ "47515954917074126", 98 },
-	{ "42768921250563217", 114 },
-	{ "1316415380484425", 116 },
-	{ "52656615219377", 116 },
-	{ "210626460877508", 117 },
-	{ "842505843510032", 117 },
-	{ "3370023374040128", 118 },
-	{ "4459606684033441", 125 },
-	{ "38908327247317957", 133 },
-	{ "39190848047259677", 137 },
-	{ "36927280332359847", 139 },
-	{ "3159459320901898", 142 },
-	{ "3668305371929078", 146 },
-	{ "6341013498592991", 162 },
-	{ "48793894436576386", 179 },
-	{ "25270482511396138", 184 },
-	{ "51886190678901447", 189 },
-	{ "2075447627156058", 190 },
-	{ "83017905086242315", 190 },
-	{ "32895532543985947", 193 },
-	{ "13158213017594379", 194 },
-	{ "52632852070377516", 194 },
-	{ "4507281245523313", 205 },
-	{ "79558439738667255", 209 },
-	{ "3042343142408013", 219 },
-	{ "3509249584028482", 225 },
-	{ "19852517257680211", 236 },
-	{ "39422120694202386", 244 },
-	{ "1833078106007497", 249 },
-	{ "3666156212014994", 249 },
-	{ "7332312424029988", 249 },
-	{ "2404900310103547", 255 },
-	{ "56348546058834866", 265 },
-	{ "2165220656635265", 272 },
-	{ "433044131327053", 272 },
-	{ "866088262654106", 272 },
-	{ "1732176525308212", 273 },
-	{ "3464353050616424", 273 },
-	{ "5546524276967009", 277 },
-	{ "3430012655501279", 290 },
-	{ "6860025311002558", 290 },
-	{ "4763926483670773", 296 },
-	{ "3704982728441355", 297 },
-	{ "4749736811475095", 299 },
-	{ "949947362295019", 299 },
-	{ "1899894724590038", 300 },
-	{ "3799789449180076", 300 },
-	{ "2370774259525561", 303 },
-	{ "4741548519051122", 303 },
-	{ "3726357216333703", 304 },
-	{ "17976931348623157", 309 },
-	{ "40526371999771488", -307 },
-	{ "81052743999542975", -307 },
-	{ "1956574196882425", -304 },
-	{ "78262967875297", -304 },
-	{ "313051871501188", -303 },
-	{ "626103743002376", -303 },
-	{ "2504414972009504", -302 },
-	{ "5008829944019008", -302 },
-	{ "3879744767109186", -300 },
-	{ "1396615030829005", -295 },
-	{ "558646012331602", -295 },
-	{ "2234584049326408", -294 },
-	{ "69928982131052126", -291 },
-	{ "7438296839846549", -290 },
-	{ "29753187359386197", -289 },
-	{ "11901274943754479", -288 },
-	{ "47605099775017915", -288 },
-	{ "15098460382361931", -285 },
-	{ "60393841529447725", -285 },
-	{ "2749718305738437", -281 },
-	{ "5499436611476874", -281 },
-	{ "2105127426909677", -275 },
-	{ "4210254853819354", -275 },
-	{ "4456749457788646", -274 },
-	{ "34097195937522008", -266 },
-	{ "68194391875044016", -266 },
-	{ "17740043544509529", -264 },
-	{ "35480087089019057", -264 },
-	{ "23951010625355228", -262 },
-	{ "47902021250710456", -262 },
-	{ "51061856989121905", -260 },
-	{ "22346140633324351", -258 },
-	{ "53263359599109627", -252 },
-	{ "1332959730952069", -248 },
-	{ "2665919461904138", -248 },
-	{ "5331838923808276", -248 },
-	{ "3048054635745255", -240 },
-	{ "609610927149051", -240 },
-	{ "1219221854298102", -239 },
-	{ "2438443708596204", -239 },
-	{ "4567462813864035", -231 },
-	{ "3693180244786078", -221 },
-	{ "5925040271981361", -220 },
-	{ "2676199082828933", -214 },
-	{ "403997300048931", -206 },
-	{ "807994600097862", -206 },
-	{ "1615989200195724", -205 },
-	{ "32319784003914477", -205 },
-	{ "22159015457577768", -195 },
-	{ "44318030915155535", -195 },
-	{ "3318147310900005", -194 },
-	{ "64710073234908765", -189 },
-	{ "75862936714499446", -176 },
-	{ "3591036630219558", -167 },
-	{ "38114390291351186", -166 },
-	{ "5358388970008797", -163 },
-	{ "2815014003355115", -162 },
-	{ "563002800671023", -162 },
-	{ "1126005601342046", -161 },
-	{ "2252011202684092", -161 },
-	{ "4504022405368184", -161 },
-	{ "25235679032489608", -154 },
-	{ "50471358064979216", -154 },
-	{ "38152929889117867", -153 },
-	{ "4648842410144081", -151 },
-	{ "3743626360493413", -149 },
-	{ "4520991180415875", -146 },
-	{ "904198236083175", -146 },
-	{ "180839647216635", -145 },
-	{ "36167929443327", -145 },
-	{ "72335858886654", -145 },
-	{ "144671717773308", -144 },
-	{ "289343435546616", -144 },
-	{ "578686871093232", -144 },
-	{ "1157373742186464", -143 },
-	{ "2314747484372928", -143 },
-	{ "4629494968745856", -143 },
-	{ "42225432151248827", -137 },
-	{ "44986453555921307", -134 },
-	{ "55741470971580295", -133 },
-	{ "1114829419431606", -132 },
-	{ "2229658838863212", -132 },
-	{ "4459317677726424", -132 },
-	{ "23897004381644022", -131 },
-	{ "32269008655522087", -128 },
-	{ "826433768201899", -118 },
-	{ "3305735072807596", -117 },
-	{ "67817280930489786", -117 },
-	{ "2746742826706349", -116 },
-	{ "5493485653412698", -116 },
-	{ "4168238778696299", -114 },
-	{ "7497371084737385", -108 },
-	{ "1499474216947477", -107 },
-	{ "2998948433894954", -107 },
-	{ "5997896867789908", -107 },
-	{ "45040183407651457", -96 },
-	{ "4559093100884257", -95 },
-	{ "10005598563667509", -87 },
-	{ "40022394254670037", -87 },
-	{ "3294312317590731", -78 },
-	{ "1320382859905404", -72 },
-	{ "5281531439621616", -72 },
-	{ "2840978519032327", -70 },
-	{ "5681957038064654", -70 },
-	{ "52853886779813977", -69 },
-	{ "2853978518722234", -68 },
-	{ "3041730237711558", -65 },
-	{ "3721305106071689", -64 },
-	{ "7442610212143378", -64 },
-	{ "33729482964455627", -38 },
-	{ "24661175471861008", -36 },
-	{ "49322350943722016", -36 },
-	{ "16424703366907229", -34 },
-	{ "2378016066134295", -26 },
-	{ "9512064264537179", -26 },
-	{ "19024128529074359", -25 },
-	{ "38048257058148717", -25 },
-	{ "42759994497846727", -25 },
-	{ "4431027338341785", -23 },
-	{ "54979356651315386", -17 },
-	{ "29335860043188667", -16 },
-	{ "3021168083759621", -13 },
-	{ "6322612303128019", -11 },
-	{ "15843518768392481", -9 },
-	{ "869254552770081", -8 },
-	{ "19513482943740408", -7 },
-	{ "3477018211080324", -7 },
-	{ "3902696588748082", -7 },
-	{ "80341375308088225", 44 },
-	{ "33991924758863007", 46 },
-	{ "56653207931438347", 46 },
-	{ "11330641586287669", 47 },
-	{ "45322566345150677", 47 },
-	{ "1605929046641989", 57 },
-	{ "3211858093283978", 57 },
-	{ "64237161865679556", 57 },
-	{ "55202181816261166", 60 },
-	{ "4285935458457607", 61 },
-	{ "7031148849323219", 62 },
-	{ "28124595397292878", 63 },
-	{ "34657057654229348", 66 },
-	{ "13862823061691739", 67 },
-	{ "27725646123383478", 67 },
-	{ "55451292246766956", 67 },
-	{ "3776763733298609", 68 },
-	{ "4423291694721855", 71 },
-	{ "884658338944371", 71 },
-	{ "1769316677888742", 72 },
-	{ "3538633355777484", 72 },
-	{ "7077266711554968", 72 },
-	{ "3228359034887016", 82 },
-	{ "43283016798864627", 84 },
-	{ "35887030159858487", 87 },
-	{ "34829747347435726", 92 },
-	{ "6901257826767179", 97 },
-	{ "4751595491707413", 98 },
-	{ "2138446062528161", 114 },
-	{ "4276892125056322", 114 },
-	{ "13164153804844249", 116 },
-	{ "26328307609688498", 116 },
-	{ "52656615219376996", 116 },
-	{ "10531323043875399", 117 },
-	{ "21062646087750798", 117 },
-	{ "42125292175501597", 117 },
-	{ "8425058435100319", 117 },
-	{ "16850116870200639", 118 },
-	{ "33700233740401277", 118 },
-	{ "7059520027153709", 119 },
-	{ "44596066840334405", 125 },
-	{ "6808957268280643", 132 },
-	{ "19454163623658978", 133 },
-	{ "61235700073843246", 135 },
-	{ "19595424023629839", 137 },
-	{ "16836228873919609", 138 },
-	{ "67344915495678436", 138 },
-	{ "15797296604509488", 142 },
-	{ "31594593209018977", 142 },
-	{ "18341526859645389", 146 },
-	{ "36683053719290777", 146 },
-	{ "22547889934479028", 159 },
-	{ "63410134985929905", 162 },
-	{ "3335268166877591", 164 },
-	{ "41111849628600257", 173 },
-	{ "4879389443657639", 179 },
-	{ "1263524125569807", 184 },
-	{ "2527048251139614", 184 },
-	{ "5054096502279228", 184 },
-	{ "10377238135780289", 190 },
-	{ "20754476271560579", 190 },
-	{ "41508952543121158", 190 },
-	{ "6438249631475533", 190 },
-	{ "8301790508624232", 190 },
-	{ "58960160560399056", 191 },
-	{ "3289553254398595", 193 },
-	{ "657910650879719", 193 },
-	{ "1315821301759438", 194 },
-	{ "2631642603518876", 194 },
-	{ "5263285207037752", 194 },
-	{ "25683437624294257", 199 },
-	{ "54971967907878166", 206 },
-	{ "3977921986933363", 209 },
-	{ "7955843973866726", 209 },
-	{ "81866786652311615", 212 },
-	{ "6084686284816026", 219 },
-	{ "1754624792014241", 225 },
-	{ "7018499168056964", 225 },
-	{ "7845101975422727", 234 },
-	{ "39705034515360423", 236 },
-	{ "6451731188423631", 238 },
-	{ "3942212069420239", 244 },
-	{ "18330781060074969", 249 },
+static const uint64_t errol_enum4_sig[466] = {
+	45035996273704964,
+	3815292988911787,
+	29480080280199528,
+	44692281266648703,
+	45590931008842566,
+	263283076096885,
+	8660882626541059,
+	23802549887508958,
+	3231978400391448,
+	11148294194316059,
+	4932235094372202,
+	5545129224676696,
+	1579729660450949,
+	64517311884236306,
+	47497368114750945,
+	1939872383554593,
+	3218322462039769,
+	45674628138640346,
+	28150140033551147,
+	28934343554661598,
+	27467428267063488,
+	26426943389906988,
+	5497935665131539,
+	6423716186567956,
+	4328301679886463,
+	52542458920095267,
+	12635241255698069,
+	39779219869333628,
+	24049003101035467,
+	34300126555012788,
+	23707742595255608,
+	156525935750594,
+	4469168098652816,
+	54994366114768736,
+	3548008708901906,
+	30480546357452547,
+	2019986500244655,
+	6471007323490877,
+	45040224053681835,
+	18083964721663499,
+	46294949687458557,
+	47794008763288043,
+	14994742169474769,
+	8252392874408775,
+	74426102121433776,
+	1902412852907436,
+	31687037536784963,
+	22661283172575339,
+	56249190794585755,
+	35386333557774838,
+	21384460625281608,
+	421252921755016,
+	9797712011814919,
+	45095779868958055,
+	1037723813578029,
+	26316426035188758,
+	50964926104335406,
+	36661562120149938,
+	21652206566352648,
+	34643530506164237,
+	47639264836707725,
+	18998947245900378,
+	37263572163337027,
+	8105274399954298,
+	1252207486004752,
+	279323006165801,
+	14876593679693099,
+	30196920764723862,
+	42102548538193536,
+	6819439187504402,
+	4790202125071046,
+	26659194619041378,
+	12192218542981019,
+	59250402719813605,
+	16159892001957239,
+	4431803091515554,
+	7182073260439116,
+	11260056013420459,
+	2523567903248961,
+	45209911804158747,
+	72335858886653996,
+	11573737421864639,
+	65687577493869365,
+	44593176777264236,
+	1652867536403798,
+	41682387786962985,
+	59978968677899076,
+	20011197127335019,
+	28409785190323268,
+	1520865118855779,
+	3372948296445563,
+	475603213226859,
+	44310273383417846,
+	63226123031280186,
+	1951348294374041,
+	3399192475886301,
+	32118580932839778,
+	32985092799227993,
+	1386282306169174,
+	8846583389443709,
+	1614179517443508,
+	3482974734743573,
+	55816446133962727,
+	105313230438754,
+	1685011687020064,
+	9727081811829489,
+	33672457747839218,
+	1834152685964539,
+	20555924814300128,
+	50540965022792275,
+	4150895254312116,
+	6579106508797189,
+	12841718812147129,
+	40933393326155808,
+	78451019754227266,
+	50105430353470027,
+	73323124240299875,
+	7201805647305757,
+	43304413132705296,
+	17321765253082118,
+	55465242769670085,
+	68600253110025576,
+	37049827284413546,
+	9499473622950189,
+	37997894491800756,
+	47415485190511216,
+	4403215243847233,
+	4052637199977149,
+	391314839376485,
+	4971131903427841,
+	37189244174230887,
+	29232758945460627,
+	1117292024663204,
+	37191484199232746,
+	5950637471877239,
+	6437165690795765,
+	27497183057384368,
+	21051274269096768,
+	2228374728894323,
+	3409719593752201,
+	1774004354450953,
+	2395101062535523,
+	5106185698912191,
+	13329597309520689,
+	53318389238082755,
+	6096109271490509,
+	24384437085962037,
+	1846590122393039,
+	26761990828289327,
+	8079946000978619,
+	2717490528888193,
+	2215901545757777,
+	663629462180001,
+	1795518315109779,
+	53583889700087966,
+	5630028006710229,
+	22520112026840918,
+	42879299305192207,
+	5047135806497922,
+	37436263604934127,
+	9041982360831749,
+	36167929443326998,
+	14467171777330799,
+	57868687109323196,
+	23147474843729279,
+	5033183761326151,
+	27870735485790148,
+	22296588388632118,
+	11948502190822011,
+	4132168841009495,
+	6611470145615192,
+	54934856534126976,
+	74973710847373845,
+	29989484338949538,
+	22520091703825729,
+	5002799281833755,
+	32943123175907307,
+	2640765719810808,
+	56819570380646536,
+	1426989259361117,
+	37213051060716888,
+	51091836539008967,
+	2466117547186101,
+	32849406733814457,
+	951206426453718,
+	3804825705814872,
+	4885506904107883,
+	2933586004318867,
+	7921759384196241,
+	1738509105540162,
+	39026965887480817,
+	8034137530808823,
+	5665320793143835,
+	16059290466419889,
+	6013265967485603,
+	42859354584576066,
+	14062297698646439,
+	69314115308458695,
+	2772564612338348,
+	44232916947218547,
+	17693166778887419,
+	70772667115549675,
+	6456718069774032,
+	3588703015985849,
+	47515954917074126,
+	42768921250563217,
+	1316415380484425,
+	52656615219377,
+	210626460877508,
+	842505843510032,
+	3370023374040128,
+	4459606684033441,
+	38908327247317957,
+	39190848047259677,
+	36927280332359847,
+	3159459320901898,
+	3668305371929078,
+	6341013498592991,
+	48793894436576386,
+	25270482511396138,
+	51886190678901447,
+	2075447627156058,
+	83017905086242315,
+	32895532543985947,
+	13158213017594379,
+	52632852070377516,
+	4507281245523313,
+	79558439738667255,
+	3042343142408013,
+	3509249584028482,
+	19852517257680211,
+	39422120694202386,
+	1833078106007497,
+	3666156212014994,
+	7332312424029988,
+	2404900310103547,
+	56348546058834866,
+	2165220656635265,
+	433044131327053,
+	866088262654106,
+	1732176525308212,
+	3464353050616424,
+	5546524276967009,
+	3430012655501279,
+	6860025311002558,
+	4763926483670773,
+	3704982728441355,
+	4749736811475095,
+	949947362295019,
+	1899894724590038,
+	3799789449180076,
+	2370774259525561,
+	4741548519051122,
+	3726357216333703,
+	17976931348623157,
+	40526371999771488,
+	81052743999542975,
+	1956574196882425,
+	78262967875297,
+	313051871501188,
+	626103743002376,
+	2504414972009504,
+	5008829944019008,
+	3879744767109186,
+	1396615030829005,
+	558646012331602,
+	2234584049326408,
+	69928982131052126,
+	7438296839846549,
+	29753187359386197,
+	11901274943754479,
+	47605099775017915,
+	15098460382361931,
+	60393841529447725,
+	2749718305738437,
+	5499436611476874,
+	2105127426909677,
+	4210254853819354,
+	4456749457788646,
+	34097195937522008,
+	68194391875044016,
+	17740043544509529,
+	35480087089019057,
+	23951010625355228,
+	47902021250710456,
+	51061856989121905,
+	22346140633324351,
+	53263359599109627,
+	1332959730952069,
+	2665919461904138,
+	5331838923808276,
+	3048054635745255,
+	609610927149051,
+	1219221854298102,
+	2438443708596204,
+	4567462813864035,
+	3693180244786078,
+	5925040271981361,
+	2676199082828933,
+	403997300048931,
+	807994600097862,
+	1615989200195724,
+	32319784003914477,
+	22159015457577768,
+	44318030915155535,
+	3318147310900005,
+	64710073234908765,
+	75862936714499446,
+	3591036630219558,
+	38114390291351186,
+	5358388970008797,
+	2815014003355115,
+	563002800671023,
+	1126005601342046,
+	2252011202684092,
+	4504022405368184,
+	25235679032489608,
+	50471358064979216,
+	38152929889117867,
+	4648842410144081,
+	3743626360493413,
+	4520991180415875,
+	904198236083175,
+	180839647216635,
+	36167929443327,
+	72335858886654,
+	144671717773308,
+	289343435546616,
+	578686871093232,
+	1157373742186464,
+	2314747484372928,
+	4629494968745856,
+	42225432151248827,
+	44986453555921307,
+	55741470971580295,
+	1114829419431606,
+	2229658838863212,
+	4459317677726424,
+	23897004381644022,
+	32269008655522087,
+	826433768201899,
+	3305735072807596,
+	67817280930489786,
+	2746742826706349,
+	5493485653412698,
+	4168238778696299,
+	7497371084737385,
+	1499474216947477,
+	2998948433894954,
+	5997896867789908,
+	45040183407651457,
+	4559093100884257,
+	10005598563667509,
+	40022394254670037,
+	3294312317590731,
+	1320382859905404,
+	5281531439621616,
+	2840978519032327,
+	5681957038064654,
+	52853886779813977,
+	2853978518722234,
+	3041730237711558,
+	3721305106071689,
+	7442610212143378,
+	33729482964455627,
+	24661175471861008,
+	49322350943722016,
+	16424703366907229,
+	2378016066134295,
+	9512064264537179,
+	19024128529074359,
+	38048257058148717,
+	42759994497846727,
+	4431027338341785,
+	54979356651315386,
+	29335860043188667,
+	3021168083759621,
+	6322612303128019,
+	15843518768392481,
+	869254552770081,
+	19513482943740408,
+	3477018211080324,
+	3902696588748082,
+	80341375308088225,
+	33991924758863007,
+	56653207931438347,
+	11330641586287669,
+	45322566345150677,
+	1605929046641989,
+	3211858093283978,
+	64237161865679556,
+	55202181816261166,
+	4285935458457607,
+	7031148849323219,
+	28124595397292878,
+	34657057654229348,
+	13862823061691739,
+	27725646123383478,
+	55451292246766956,
+	3776763733298609,
+	4423291694721855,
+	884658338944371,
+	1769316677888742,
+	3538633355777484,
+	7077266711554968,
+	3228359034887016,
+	43283016798864627,
+	35887030159858487,
+	34829747347435726,
+	6901257826767179,
+	4751595491707413,
+	2138446062528161,
+	4276892125056322,
+	13164153804844249,
+	26328307609688498,
+	52656615219376996,
+	10531323043875399,
+	21062646087750798,
+	42125292175501597,
+	8425058435100319,
+	16850116870200639,
+	33700233740401277,
+	7059520027153709,
+	44596066840334405,
+	6808957268280643,
+	19454163623658978,
+	61235700073843246,
+	19595424023629839,
+	16836228873919609,
+	67344915495678436,
+	15797296604509488,
+	31594593209018977,
+	18341526859645389,
+	36683053719290777,
+	22547889934479028,
+	63410134985929905,
+	3335268166877591,
+	41111849628600257,
+	4879389443657639,
+	1263524125569807,
+	2527048251139614,
+	5054096502279228,
+	10377238135780289,
+	20754476271560579,
+	41508952543121158,
+	6438249631475533,
+	8301790508624232,
+	58960160560399056,
+	3289553254398595,
+	657910650879719,
+	1315821301759438,
+	2631642603518876,
+	5263285207037752,
+	25683437624294257,
+	54971967907878166,
+	3977921986933363,
+	7955843973866726,
+	81866786652311615,
+	6084686284816026,
+	1754624792014241,
+	7018499168056964,
+	7845101975422727,
+	39705034515360423,
+	6451731188423631,
+	3942212069420239,
+	18330781060074969,
+};
+static const int16_t errol_enum4_exp[466] = {
+	39,
+	-153,
+	191,
+	-258,
+	-95,
+	116,
+	272,
+	-288,
+	-205,
+	-132,
+	-36,
+	67,
+	142,
+	238,
+	299,
+	-300,
+	-273,
+	-231,
+	-162,
+	-144,
+	-116,
+	-69,
+	-17,
+	57,
+	84,
+	124,
+	184,
+	209,
+	255,
+	290,
+	303,
+	-303,
+	-294,
+	-281,
+	-264,
+	-240,
+	-206,
+	-189,
+	-161,
+	-145,
+	-143,
+	-131,
+	-107,
+	-74,
+	-64,
+	-25,
+	-9,
+	47,
+	63,
+	72,
+	114,
+	117,
+	136,
+	159,
+	190,
+	194,
+	222,
+	249,
+	272,
+	273,
+	296,
+	300,
+	304,
+	-307,
+	-302,
+	-295,
+	-289,
+	-285,
+	-275,
+	-266,
+	-262,
+	-248,
+	-239,
+	-220,
+	-205,
+	-195,
+	-167,
+	-161,
+	-154,
+	-146,
+	-145,
+	-143,
+	-136,
+	-132,
+	-117,
+	-114,
+	-107,
+	-87,
+	-70,
+	-65,
+	-38,
+	-26,
+	-23,
+	-11,
+	-7,
+	46,
+	57,
+	62,
+	67,
+	71,
+	82,
+	92,
+	114,
+	117,
+	118,
+	132,
+	138,
+	146,
+	173,
+	184,
+	190,
+	193,
+	199,
+	212,
+	234,
+	248,
+	249,
+	262,
+	272,
+	273,
+	277,
+	290,
+	297,
+	299,
+	300,
+	303,
+	307,
+	-307,
+	-304,
+	-303,
+	-302,
+	-298,
+	-294,
+	-290,
+	-289,
+	-287,
+	-281,
+	-275,
+	-274,
+	-266,
+	-264,
+	-262,
+	-260,
+	-248,
+	-248,
+	-240,
+	-239,
+	-221,
+	-214,
+	-206,
+	-205,
+	-195,
+	-194,
+	-167,
+	-163,
+	-162,
+	-161,
+	-155,
+	-154,
+	-149,
+	-146,
+	-145,
+	-144,
+	-144,
+	-143,
+	-143,
+	-133,
+	-132,
+	-131,
+	-118,
+	-117,
+	-116,
+	-108,
+	-107,
+	-96,
+	-88,
+	-78,
+	-72,
+	-70,
+	-68,
+	-64,
+	-47,
+	-36,
+	-34,
+	-26,
+	-25,
+	-20,
+	-16,
+	-10,
+	-7,
+	-7,
+	44,
+	46,
+	57,
+	57,
+	61,
+	63,
+	66,
+	67,
+	71,
+	72,
+	72,
+	82,
+	87,
+	98,
+	114,
+	116,
+	116,
+	117,
+	117,
+	118,
+	125,
+	133,
+	137,
+	139,
+	142,
+	146,
+	162,
+	179,
+	184,
+	189,
+	190,
+	190,
+	193,
+	194,
+	194,
+	205,
+	209,
+	219,
+	225,
+	236,
+	244,
+	249,
+	249,
+	249,
+	255,
+	265,
+	272,
+	272,
+	272,
+	273,
+	273,
+	277,
+	290,
+	290,
+	296,
+	297,
+	299,
+	299,
+	300,
+	300,
+	303,
+	303,
+	304,
+	309,
+	-307,
+	-307,
+	-304,
+	-304,
+	-303,
+	-303,
+	-302,
+	-302,
+	-300,
+	-295,
+	-295,
+	-294,
+	-291,
+	-290,
+	-289,
+	-288,
+	-288,
+	-285,
+	-285,
+	-281,
+	-281,
+	-275,
+	-275,
+	-274,
+	-266,
+	-266,
+	-264,
+	-264,
+	-262,
+	-262,
+	-260,
+	-258,
+	-252,
+	-248,
+	-248,
+	-248,
+	-240,
+	-240,
+	-239,
+	-239,
+	-231,
+	-221,
+	-220,
+	-214,
+	-206,
+	-206,
+	-205,
+	-205,
+	-195,
+	-195,
+	-194,
+	-189,
+	-176,
+	-167,
+	-166,
+	-163,
+	-162,
+	-162,
+	-161,
+	-161,
+	-161,
+	-154,
+	-154,
+	-153,
+	-151,
+	-149,
+	-146,
+	-146,
+	-145,
+	-145,
+	-145,
+	-144,
+	-144,
+	-144,
+	-143,
+	-143,
+	-143,
+	-137,
+	-134,
+	-133,
+	-132,
+	-132,
+	-132,
+	-131,
+	-128,
+	-118,
+	-117,
+	-117,
+	-116,
+	-116,
+	-114,
+	-108,
+	-107,
+	-107,
+	-107,
+	-96,
+	-95,
+	-87,
+	-87,
+	-78,
+	-72,
+	-72,
+	-70,
+	-70,
+	-69,
+	-68,
+	-65,
+	-64,
+	-64,
+	-38,
+	-36,
+	-36,
+	-34,
+	-26,
+	-26,
+	-25,
+	-25,
+	-25,
+	-23,
+	-17,
+	-16,
+	-13,
+	-11,
+	-9,
+	-8,
+	-7,
+	-7,
+	-7,
+	44,
+	46,
+	46,
+	47,
+	47,
+	57,
+	57,
+	57,
+	60,
+	61,
+	62,
+	63,
+	66,
+	67,
+	67,
+	67,
+	68,
+	71,
+	71,
+	72,
+	72,
+	72,
+	82,
+	84,
+	87,
+	92,
+	97,
+	98,
+	114,
+	114,
+	116,
+	116,
+	116,
+	117,
+	117,
+	117,
+	117,
+	118,
+	118,
+	119,
+	125,
+	132,
+	133,
+	135,
+	137,
+	138,
+	138,
+	142,
+	142,
+	146,
+	146,
+	159,
+	162,
+	164,
+	173,
+	179,
+	184,
+	184,
+	184,
+	190,
+	190,
+	190,
+	190,
+	190,
+	191,
+	193,
+	193,
+	194,
+	194,
+	194,
+	199,
+	206,
+	209,
+	209,
+	212,
+	219,
+	225,
+	225,
+	234,
+	236,
+	238,
+	244,
+	249,
 };
@@ -1,13 +1,19 @@
 #include <assert.h>
 #include <float.h>
 #include <math.h>
+#include <stdarg.h>
 #include <stdbool.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <wchar.h>
 #include "errol.h"
 #include "itoa_c.h"
 
+#ifdef __SSE2__
+#include <immintrin.h>
+#endif
+
 /*
  * floating point format definitions
  */
@@ -39,6 +45,12 @@ static inline __uint128_t fpeint(double from)
 #define ERROL0_EPSILON	0.0000001
 #define ERROL1_EPSILON  8.77e-15
 
+/*
+ * conversion cache of the calling thread
+ */
+
+static _Thread_local struct errol_cache_t *errol_cache;
+
 
 /**
  * High-precision data structure.
@@ -49,6 +61,88 @@ struct hp_t {
 	fpnum_t val, off;
 };
 
+#ifdef __SSE2__
+/**
+ * Packed high-precision data structure for the two boundaries of Errol3.
+ *   @val, off: The values and offsets.
+ */
+
+struct hp2_t {
+	__m128d val, off;
+};
+#endif
+
+#ifdef __AVX2__
+/**
+ * Packed high-precision data structure for the four boundaries of Errol1.
+ *   @val, off: The values and offsets.
+ */
+
+struct hp4_t {
+	__m256d val, off;
+};
+#endif
+
+/**
+ * Wide power-of-ten data structure, holding the value w * 2^exp.
+ *   @w: The 256-bit significand, least significant word first.
+ *   @exp: The binary exponent.
+ */
+
+struct pow256_t {
+	uint64_t w[4];
+	int32_t exp;
+};
+
+/**
+ * Integer power-of-ten data structure, holding the value w * 2^exp.
+ *   @w: The 128-bit significand, least significant word first.
+ *   @exp: The binary exponent.
+ */
+
+struct pow128_t {
+	uint64_t w[2];
+	int32_t exp;
+};
+
+/**
+ * Formatted output data structure, counting the length past the end of
+ * the buffer.
+ *   @buf: The output buffer.
+ *   @size: The buffer size.
+ *   @len: The output length.
+ *   @fail: Whether a conversion failed.
+ */
+
+struct fmt_t {
+	char *buf;
+	size_t size, len;
+	bool fail;
+};
+
+/**
+ * Conversion specification data structure.
+ *   @flags: The FMT_* flags.
+ *   @width: The minimum width.
+ *   @prec: The precision, negative if omitted.
+ *   @conv: The conversion character.
+ */
+
+struct spec_t {
+	int flags, width, prec;
+	char conv;
+};
+
+/*
+ * conversion specification flags
+ */
+
+#define FMT_LEFT  0x01
+#define FMT_PLUS  0x02
+#define FMT_SPACE 0x04
+#define FMT_ALT   0x08
+#define FMT_ZERO  0x10
+
 
 /*
  * lookup table data
@@ -57,6 +151,10 @@ struct hp_t {
 #include "lookup.h"
 #include "enum3.h"
 #include "enum4.h"
+#include "lookupq.h"
+#include "lookuph.h"
+#include "lookupi.h"
+#include "lookupx.h"
 
 /*
  * high-precision constants
@@ -69,16 +167,65 @@ struct hp_t {
 static void inline hp_normalize(struct hp_t *hp);
 static void inline hp_mul10(struct hp_t *hp);
 static void inline hp_div10(struct hp_t *hp);
+#ifdef __SSE2__
+static void inline hp2_normalize(struct hp2_t *hp);
+static void inline hp2_mul10(struct hp2_t *hp);
+static void inline hp2_div10(struct hp2_t *hp);
+static __m128d inline hp2_digit(const struct hp2_t *hp);
+static int hp2_gen(struct hp_t high, struct hp_t low, int exp, char *buf);
+#endif
+#ifdef __AVX2__
+static void inline hp4_normalize(struct hp4_t *hp);
+static void inline hp4_mul10(struct hp4_t *hp);
+static void inline hp4_div10(struct hp4_t *hp);
+static __m256d inline hp4_digit(const struct hp4_t *hp);
+static int hp4_gen(struct hp_t inhi, struct hp_t inlo, struct hp_t outhi, struct hp_t outlo, int exp, char *buf, bool *opt);
+#endif
 static struct hp_t hp_prod(struct hp_t in, double val);
 static int inline mismatch10(uint64_t a, uint64_t b);
 static int inline table_lower_bound(uint64_t *table, int n, uint64_t k);
 
-/*
- * inline function instantiations
- */
-
-extern inline char *u32toa(uint32_t value, char *buffer);
-extern inline char *u64toa(uint64_t value, char *buffer);
+static int errol3u_seq(double val, char *buf, struct errol_seq_t *seq);
+static bool errol_short(double val, char *buf, int *exp);
+static int errol_wide(__uint128_t m, int q, bool asym, char *buf);
+static __uint128_t range_scale(const uint64_t w[static 4], int pe, uint64_t m, int q, int x, bool up);
+static int errol_directed(double val, bool up, char *buf);
+static int inline limb_mul(uint32_t *limb, int n, uint64_t f);
+static int errol_narrow(uint64_t m, int q, bool asym, int d, char *buf);
+static int errol_fix(uint64_t m, int q, bool asym, char *buf);
+static uint64_t fix_shortest(uint64_t m, int q, bool asym, int *exp);
+static int json_abs(double val, char *buf);
+static uint64_t round_digits(uint64_t m, int q, int n, int *exp);
+static int digits_scale(uint64_t m, int q, int n, uint64_t lo, __uint128_t *d);
+static int inline width_len(int k, int n, bool sci);
+static int width_digits(int k, int n, int width);
+static bool width_over(uint64_t c, int e);
+static char *width_write(char *p, const char *dig, int k, int n, bool sci);
+static void fmt_put(struct fmt_t *out, const char *str, size_t n);
+static void fmt_fill(struct fmt_t *out, char ch, int n);
+static void fmt_lead(struct fmt_t *out, const struct spec_t *spec, const char *pre, int len);
+static void fmt_trail(struct fmt_t *out, const struct spec_t *spec, int len);
+static void fmt_int(struct fmt_t *out, struct spec_t *spec, uint64_t val, bool neg);
+static void fmt_str(struct fmt_t *out, struct spec_t *spec, const char *str);
+static void fmt_defer(struct fmt_t *out, const struct spec_t *spec, const char *mod, ...);
+static bool fmt_posix(const char *fmt);
+static void fmt_float(struct fmt_t *out, struct spec_t *spec, double val);
+static void fmt_hex(struct fmt_t *out, struct spec_t *spec, double val, const char *pre);
+static int fmt_exp(double val);
+static int fmt_round(double val, int n, char *dig, int *k);
+static uint64_t inline fix_mul(const struct pow128_t *pow, uint64_t b, int sh);
+static uint64_t narrow_scale(uint64_t b, int s, int x, bool *exact);
+static int narrow_shortest(uint64_t lo, uint64_t mid2, uint64_t hi, int tie, char *buf);
+static uint64_t narrow_pick(uint64_t lo, uint64_t mid2, uint64_t hi, int tie, int *t) __attribute__((noinline));
+static uint64_t sub_scale(const uint64_t pow[static 13], uint64_t b, int sh, bool *exact);
+static void inline pow10q(int x, uint64_t w[static 4], int *exp);
+static void inline w_mul(uint64_t *r, const uint64_t *a, int na, const uint64_t *b, int nb);
+static __uint128_t inline w_shr(const uint64_t r[static 6], int sh);
+static int inline mismatch10q(__uint128_t a, __uint128_t b);
+static bool errolq_exact(__uint128_t b, int s, int x);
+static int errolq_tie(__uint128_t m, int q, int x);
+static int errolq_shortest(__uint128_t lo, __uint128_t mid2, __uint128_t hi, int tie, char *buf);
+static int range_shortest(__uint128_t lo, __uint128_t hi, char *buf);
 
 /*
  * intrinsics
@@ -225,6 +372,9 @@ int errol1_dtoa(double val, char *buf, bool *opt)
 	hp_normalize(&outhi);
 	hp_normalize(&outlo);
 
+#ifdef __AVX2__
+	return hp4_gen(inhi, inlo, outhi, outlo, exp, buf, opt);
+#else
 	/* normalized boundaries */
 
 	while(inhi.val > 10.0 || (inhi.val == 10.0 && inhi.off >= 0.0))
@@ -279,6 +429,7 @@ int errol1_dtoa(double val, char *buf, bool *opt)
 	*buf = '\0';
 
 	return exp;
+#endif
 }
 
 /**
@@ -364,8 +515,8 @@ int errol3_dtoa(double val, char *buf)
 	int i = table_lower_bound(errol_enum3, n, k.i);
 	if (i < n && errol_enum3[i] == k.i)
 	{
-		strcpy(buf, errol_enum3_data[i].str);
-		return errol_enum3_data[i].exp;
+		*u64toa(errol_enum3_sig[i], buf) = '\0';
+		return errol_enum3_exp[i];
 	}
 
 	return errol3u_dtoa(val, buf);
@@ -379,6 +530,59 @@ int errol3_dtoa(double val, char *buf)
  */
 
 int errol3u_dtoa(double val, char *buf)
+{
+	return errol3u_seq(val, buf, NULL);
+}
+
+/**
+ * Initialize an exponent cache for errol_seq_dtoa.
+ *   @seq: The cache.
+ */
+
+void errol_seq_init(struct errol_seq_t *seq)
+{
+	seq->key = UINT64_MAX;
+}
+
+/**
+ * Corrected Errol3 double to ASCII conversion with an exponent cache. The
+ * lookup index, its scale, and the scaled gap of the previous call's binade
+ * are reused while the exponent bits are unchanged. Only normal values
+ * below 1e-5 and values from 2^128 take the cached path, and the
+ * normalization still runs per value, so the saving is small. The output
+ * is identical to errol3_dtoa.
+ *   @seq: The exponent cache.
+ *   @val: The value.
+ *   @buf: The output buffer.
+ *   &returns: The exponent.
+ */
+
+int errol_seq_dtoa(struct errol_seq_t *seq, double val, char *buf)
+{
+	errol_bits_t k = { val };
+
+	int n = sizeof(errol_enum3) / sizeof(uint64_t);
+	int i = table_lower_bound(errol_enum3, n, k.i);
+	if (i < n && errol_enum3[i] == k.i)
+	{
+		*u64toa(errol_enum3_sig[i], buf) = '\0';
+		return errol_enum3_exp[i];
+	}
+
+	return errol3u_seq(val, buf, seq);
+}
+
+/**
+ * Uncorrected Errol3 double to ASCII conversion, optionally reusing the
+ * binade state of a sequence: the lookup index, its scale, and the gaps to
+ * the neighbours times that scale.
+ *   @val: The value.
+ *   @buf: The output buffer.
+ *   @seq: The exponent cache, or null.
+ *   &returns: The exponent.
+ */
+
+static int errol3u_seq(double val, char *buf, struct errol_seq_t *seq)
 {
 	int e;
 	double ten, lten;
@@ -386,26 +590,46 @@ int errol3u_dtoa(double val, char *buf)
 	struct hp_t mid;
 	struct hp_t high = { val, 0.0 };
 	struct hp_t low = { val, 0.0 };
+	struct errol_seq_t st;
+	errol_bits_t bits = { val };
 
-	/* check if in integer or fixed range */
+	/* check if in integer, fixed, or small range */
 
 	if((val > 9.007199254740992e15) && (val < 3.40282366920938e+38))
 		return errol_int(val, buf);
 	else if((val >= 16.0) && (val <= 9.007199254740992e15))
 		return errol_fixed(val, buf);
+	else if((val >= 1e-5) && (val < 16.0))
+		return errol_short(val, buf, &exp) ? exp : errol_small(val, buf);
+	else if(val < 2.2250738585072014e-308)
+		return errol_subnormal(val, buf);
 
-	/* normalize the midpoint */
+	/* find the lookup index and the scaled gaps of the binade */
 
-	frexp(val, &e);
-	exp = 307 + (double)e*0.30103;
-	if(exp < 20)
-		exp = 20;
-	else if(exp >= LOOKUP_TABLE_LEN)
-		exp = LOOKUP_TABLE_LEN - 1;
+	if((seq != NULL) && (seq->key == (bits.i >> 52)))
+		st = *seq;
+	else {
+		frexp(val, &e);
+		exp = 307 + (double)e*0.30103;
+		if(exp < 20)
+			exp = 20;
+		else if(exp >= LOOKUP_TABLE_LEN)
+			exp = LOOKUP_TABLE_LEN - 1;
+
+		st.key = bits.i >> 52;
+		st.exp = exp;
+		st.lten = lookup_table[exp].val;
+		st.gap = (fpnext(val) - val) * st.lten;
+		if(seq != NULL)
+			*seq = st;
+	}
+
+	/* normalize the midpoint */
 
+	exp = st.exp;
 	mid = lookup_table[exp];
 	mid = hp_prod(mid, val);
-	lten = lookup_table[exp].val;
+	lten = st.lten;
 	ten = 1.0;
 
 	exp -= 307;
@@ -419,13 +643,19 @@ int errol3u_dtoa(double val, char *buf)
 	/* compute boundaries */
 
 	high.val = mid.val;
-	high.off = mid.off + (fpnext(val) - val) * lten * ten / 2.0;
+	high.off = mid.off + st.gap * ten / 2.0;
 	low.val = mid.val;
-	low.off = mid.off + (fpprev(val) - val) * lten * ten / 2.0;
+	if((bits.i & ((1ULL << 52) - 1)) != 0)
+		low.off = mid.off + -st.gap * ten / 2.0;
+	else
+		low.off = mid.off + (fpprev(val) - val) * lten * ten / 2.0;
 
 	hp_normalize(&high);
 	hp_normalize(&low);
 
+#ifdef __SSE2__
+	return hp2_gen(high, low, exp, buf);
+#else
 	/* normalized boundaries */
 
 	while(high.val > 10.0 || (high.val == 10.0 && high.off >= 0.0))
@@ -466,6 +696,7 @@ int errol3u_dtoa(double val, char *buf)
 	*buf = '\0';
 
 	return exp;
+#endif
 }
 
 /**
@@ -483,8 +714,8 @@ int errol4_dtoa(double val, char *buf)
 	int i = table_lower_bound(errol_enum4, n, k.i);
 	if (i < n && errol_enum4[i] == k.i)
 	{
-		strcpy(buf, errol_enum4_data[i].str);
-		return errol_enum4_data[i].exp;
+		*u64toa(errol_enum4_sig[i], buf) = '\0';
+		return errol_enum4_exp[i];
 	}
 
 	return errol4u_dtoa(val, buf);
@@ -570,6 +801,57 @@ int errol4u_dtoa(double val, char *buf)
 	return exp;
 }
 
+/**
+ * Errol5 double to ASCII conversion, guaranteed correct and optimal without a
+ * correction table. The exact paths cover the integer, fixed, small and
+ * subnormal ranges; elsewhere the boundaries are scaled by the 256-bit powers
+ * of ten of the wide conversion instead of a double-double.
+ *   @val: The value.
+ *   @buf: The output buffer.
+ *   &returns: The exponent.
+ */
+
+int errol5_dtoa(double val, char *buf)
+{
+	int exp;
+	errol_bits_t bits = { val };
+	uint64_t m = bits.i & ((1ULL << 52) - 1);
+	unsigned int bexp = (bits.i >> 52) & 0x7FF;
+
+	if((val > 9.007199254740992e15) && (val < 3.40282366920938e+38))
+		return errol_int(val, buf);
+	else if((val >= 16.0) && (val <= 9.007199254740992e15))
+		return errol_fixed(val, buf);
+	else if((val >= 1e-5) && (val < 16.0))
+		return errol_short(val, buf, &exp) ? exp : errol_small(val, buf);
+	else if(val < 2.2250738585072014e-308)
+		return errol_subnormal(val, buf);
+
+	return errol_wide(m | (1ULL << 52), (int)bexp - 1075, (m == 0) && (bexp > 1), buf);
+}
+
+/**
+ * Errol6 double to ASCII conversion, guaranteed correct and optimal using
+ * integer arithmetic only. The boundaries are scaled by 128-bit truncated
+ * powers of ten, so the result does not depend on the floating point
+ * environment or on compiler flags.
+ *   @val: The value.
+ *   @buf: The output buffer.
+ *   &returns: The exponent.
+ */
+
+int errol6_dtoa(double val, char *buf)
+{
+	errol_bits_t bits = { val };
+	uint64_t m = bits.i & ((1ULL << 52) - 1);
+	unsigned int bexp = (bits.i >> 52) & 0x7FF;
+
+	if(bexp == 0)
+		return errol_fix(m, -1074, false, buf);
+
+	return errol_fix(m | (1ULL << 52), (int)bexp - 1075, (m == 0) && (bexp > 1), buf);
+}
+
 
 /**
  * Integer conversion algorithm, guaranteed correct, optimal, and best.
@@ -588,8 +870,8 @@ int errol_int(double val, char *buf)
 	assert((val > 9.007199254740992e15) && val < (3.40282366920938e38));
 
 	mid = (__uint128_t)val;
-	low = mid - fpeint((fpnext(val) - val) / 2.0);
-	high = mid + fpeint((val - fpprev(val)) / 2.0);
+	low = mid - fpeint((val - fpprev(val)) / 2.0);
+	high = mid + fpeint((fpnext(val) - val) / 2.0);
 
 	bits.d = val;
 	if(bits.i & 0x1)
@@ -621,12 +903,17 @@ int errol_int(double val, char *buf)
 	if (lf != hf)
 		mi += 19;
 
-	char *p = u64toa(m64, buf) - 1;
-
 	if (mi != 0)
-		p[-1] += (*p >= '5');
-	else
-		++p;
+	{
+		__uint128_t unit = (__uint128_t)x * ((lf != hf) ? (uint64_t)1e18 : 1) * 10;
+
+		/* round the midpoint, staying above the narrower lower gap */
+		m64 = m64 / 10 + (m64 % 10 >= 5);
+		if (m64 * unit <= low)
+			m64++;
+	}
+
+	char *p = u64toa(m64, buf);
 
 	exp = p - buf + mi;
 	*p = '\0';
@@ -702,165 +989,3034 @@ int errol_fixed(double val, char *buf)
 
 
 /**
- * Normalize the number by factoring in the error.
- *   @hp: The float pair.
+ * Small value conversion algorithm, guaranteed correct, optimal, and best.
+ *   @val: The val.
+ *   @buf: The output buffer.
+ *   &return: The exponent.
  */
 
-static inline void hp_normalize(struct hp_t *hp)
+int errol_small(double val, char *buf)
 {
-	fpnum_t val = hp->val;
+	errol_bits_t bits = { val };
+	uint64_t m = (bits.i & ((1ULL << 52) - 1)) | (1ULL << 52);
+	int bexp = (bits.i >> 52) & 0x7FF;
 
-	hp->val += hp->off;
-	hp->off += val - hp->val;
+	assert((val >= 1e-5) && (val < 16.0));
+
+	return errol_narrow(m, bexp - 1023 - 52, (m == (1ULL << 52)), 17, buf);
 }
 
+
+#ifdef __SIZEOF_FLOAT128__
 /**
- * Multiply the high-precision number by ten.
- *   @hp: The high-precision number
+ * Errol binary128 to ASCII conversion, guaranteed correct and optimal.
+ *   @val: The value.
+ *   @buf: The output buffer, at least 40 bytes.
+ *   &returns: The exponent.
  */
 
-static inline void hp_mul10(struct hp_t *hp)
+int errolq_dtoa(__float128 val, char *buf)
 {
-	fpnum_t off, val = hp->val;
+	int q;
+	errol_qbits_t bits = { val };
+	__uint128_t m, one = 1;
+	unsigned int bexp;
+
+	bexp = (bits.i >> 112) & 0x7FFF;
+	m = bits.i & ((one << 112) - 1);
+	if(bexp > 0) {
+		m |= one << 112;
+		q = (int)bexp - 16383 - 112;
+	}
+	else
+		q = 1 - 16383 - 112;
 
-	hp->val *= 10.0;
-	hp->off *= 10.0;
-	
-	off = hp->val;
-	off -= val * 8.0;
-	off -= val * 2.0;
+	return errol_wide(m, q, (m == (one << 112)) && (bexp > 1), buf);
+}
+#endif
 
-	hp->off -= off;
+/**
+ * Errol x87 extended precision to ASCII conversion, guaranteed correct and
+ * optimal.
+ *   @val: The value.
+ *   @buf: The output buffer, at least 24 bytes.
+ *   &returns: The exponent.
+ */
 
-	hp_normalize(hp);
+int errol_ldtoa(long double val, char *buf)
+{
+	int q;
+	errol_ldbits_t bits = { val };
+	unsigned int bexp;
+
+	bexp = bits.s.exp & 0x7FFF;
+	q = ((bexp > 0) ? (int)bexp : 1) - 16383 - 63;
+
+	return errol_wide(bits.s.m, q, (bits.s.m == (1ULL << 63)) && (bexp > 1), buf);
 }
 
 /**
- * Divide the high-precision number by ten.
- *   @hp: The high-precision number
+ * Shortest decimal within a closed interval of positive doubles. Among the
+ * shortest candidates, the one nearest to the midpoint is chosen, with ties
+ * going to the larger. When lo equals hi and is not a short decimal, the
+ * shortest representation of the value is returned instead.
+ *   @lo: The lower bound.
+ *   @hi: The upper bound.
+ *   @buf: The output buffer, at least 40 bytes.
+ *   &returns: The exponent.
  */
 
-static inline void hp_div10(struct hp_t *hp)
+int errol_shortest_in(double lo, double hi, char *buf)
 {
-	double val = hp->val;
+	int e, x, pe, ql, qh;
+	uint64_t w[4], ml, mh;
+	__uint128_t l, h;
+	errol_bits_t bl = { lo }, bh = { hi };
 
-	hp->val /= 10.0;
-	hp->off /= 10.0;
+	assert((lo > 0.0) && (lo <= hi) && (hi <= DBL_MAX));
 
-	val -= hp->val * 8.0;
-	val -= hp->val * 2.0;
+	ml = bl.i & ((1ULL << 52) - 1);
+	ql = ((bl.i >> 52) > 0) ? ((int)(bl.i >> 52) - 1075) : -1074;
+	if((bl.i >> 52) > 0)
+		ml |= 1ULL << 52;
 
-	hp->off += val / 10.0;
+	mh = bh.i & ((1ULL << 52) - 1);
+	qh = ((bh.i >> 52) > 0) ? ((int)(bh.i >> 52) - 1075) : -1074;
+	if((bh.i >> 52) > 0)
+		mh |= 1ULL << 52;
 
-	hp_normalize(hp);
-}
+	/* scale both bounds by the power that brings hi into [10^35, 10^37) */
 
-static inline double gethi(double in)
-{
-	errol_bits_t v = { .d = in };
+	e = qh + 63 - __builtin_clzll(mh);
+	x = 35 - (int)floor(e * 0.30102999566398119521);
+	pow10q(x, w, &pe);
 
-	//v.i += 0x0000000004000000;
-	v.i &= 0xFFFFFFFFF8000000;
+	h = range_scale(w, pe, mh, qh, x, false);
+	if(e - (ql + 63 - __builtin_clzll(ml)) < 128)
+		l = range_scale(w, pe, ml, ql, x, true);
+	else
+		l = 1;
 
-	return v.d;
+	if(l > h)
+		return errol6_dtoa(lo, buf);
+
+	return range_shortest(l, h, buf) - x;
 }
 
 /**
- * Split a double into two halves.
- *   @val: The double.
- *   @hi: The high bits.
- *   @lo: The low bits.
+ * Shortest decimal within a relative tolerance of a double, for lossy
+ * output. When the tolerance does not reach past the neighbouring doubles,
+ * the shortest representation of the value is returned instead. Negative
+ * values are written as '-' and the digits of the magnitude, and zero of
+ * either sign as "0" with exponent zero.
+ *   @val: The value, finite.
+ *   @tol: The relative tolerance, in [0, 1).
+ *   @buf: The output buffer, at least 41 bytes.
+ *   &returns: The exponent.
  */
 
-static inline void split(double val, double *hi, double *lo)
+int errol_dtoa_tol(double val, double tol, char *buf)
 {
-	//double t = (134217728.0 + 1.0) * val;
+	double lo, hi;
 
-	//*hi = t - (t - val);
-	//if(*hi != gethi(val)) 
-	//*lo = val - *hi;
+	assert(isfinite(val) && (tol >= 0.0) && (tol < 1.0));
 
-	*hi = gethi(val);
-	*lo = val - *hi;
+	if(val == 0.0)
+		return buf[0] = '0', buf[1] = '\0', 0;
+	else if(val < 0.0)
+		return *buf = '-', errol_dtoa_tol(-val, tol, buf + 1);
+
+	lo = val - val * tol;
+	hi = val + val * tol;
+	if(hi > DBL_MAX)
+		hi = DBL_MAX;
+
+	if((lo >= fpprev(val)) && (hi <= fpnext(val)))
+		return errol6_dtoa(val, buf);
+
+	return errol_shortest_in((lo > 0.0) ? lo : fpnext(0.0), hi, buf);
 }
 
 /**
- * Compute the product of an HP number and a double.
- *   @in: The HP number.
- *   @val: The double.
- *   &returns: The HP number.
+ * Shortest decimal that is at least the exact value and reads back as the
+ * value, for upper bounds in interval arithmetic. Negative values are
+ * written as '-' and errol_dtoa_down() of the magnitude, and zero of
+ * either sign as "0" with exponent zero.
+ *   @val: The value, finite.
+ *   @buf: The output buffer, at least 41 bytes.
+ *   &returns: The exponent.
  */
 
-static struct hp_t hp_prod(struct hp_t in, double val)
+int errol_dtoa_up(double val, char *buf)
 {
-	double p, hi, lo, e;
-
-	double hi2, lo2;
-	split(in.val, &hi, &lo);
-	split(val, &hi2, &lo2);
-
-	p = in.val * val;
-	e = ((hi * hi2 - p) + lo * hi2 + hi * lo2) + lo * lo2;
+	if(val == 0.0)
+		return buf[0] = '0', buf[1] = '\0', 0;
+	else if(val < 0.0)
+		return *buf = '-', errol_dtoa_down(-val, buf + 1);
 
-	return (struct hp_t){ p, in.off * val + e };
+	return errol_directed(val, true, buf);
 }
 
 /**
- * Given two different integers with the same length in terms of the number
- * of decimal digits, index the digits from the right-most position starting
- * from zero, find the first index where the digits in the two integers
- * divergent starting from the highest index.
- *   @a: Integer a.
- *   @b: Integer b.
- *   &returns: An index within [0, 19).
+ * Shortest decimal that is at most the exact value and reads back as the
+ * value, for lower bounds in interval arithmetic. Negative values are
+ * written as '-' and errol_dtoa_up() of the magnitude, and zero of
+ * either sign as "0" with exponent zero.
+ *   @val: The value, finite.
+ *   @buf: The output buffer, at least 41 bytes.
+ *   &returns: The exponent.
  */
 
-static inline int mismatch10(uint64_t a, uint64_t b)
+int errol_dtoa_down(double val, char *buf)
 {
-	uint64_t pow10 = 10000000000U;
-	uint64_t af = a / pow10;
-	uint64_t bf = b / pow10;
-	int i = 0;
-
-	if (af != bf)
-	{
-		i = 10;
-		a = af;
-		b = bf;
-	}
-
-	for (;; ++i)
-	{
-		a /= 10;
-		b /= 10;
+	if(val == 0.0)
+		return buf[0] = '0', buf[1] = '\0', 0;
+	else if(val < 0.0)
+		return *buf = '-', errol_dtoa_up(-val, buf + 1);
 
-		if (a == b)
-			return i;
-	}
+	return errol_directed(val, false, buf);
 }
 
 /**
- * Find the insertion point for a key in a level-order array.
- *   @table: The target array.
- *   @n: Array size.
- *   @k: The key to find.
- *   &returns: The insertion point.
+ * Exact decimal expansion of a double, with every significant digit.
+ *   @val: The value.
+ *   @buf: The output buffer, at least ERR_EXACT_LEN bytes.
+ *   &returns: The exponent.
  */
 
-static inline int table_lower_bound(uint64_t *table, int n, uint64_t k)
+int errol_dtoa_exact(double val, char *buf)
 {
-	int i = n, j = 0;
+	static const uint32_t pow5[14] = {
+		1, 5, 25, 125, 625, 3125, 15625, 78125, 390625, 1953125, 9765625,
+		48828125, 244140625, 1220703125
+	};
+
+	int i, j, k, n, q, s, len;
+	uint64_t m, c;
+	uint32_t small[8], limb[ERR_EXACT_LEN / 9 + 1];
+	const uint32_t *pow;
+	char *p;
+	errol_bits_t bits = { val };
 
-	while (j < n)
-	{
-		if (table[j] < k)
+	assert((val > 0.0) && (val <= DBL_MAX));
+
+	m = bits.i & ((1ULL << 52) - 1);
+	q = ((bits.i >> 52) > 0) ? ((int)(bits.i >> 52) - 1075) : -1074;
+	if((bits.i >> 52) > 0)
+		m |= 1ULL << 52;
+
+	s = __builtin_ctzll(m);
+	m >>= s;
+	q += s;
+
+	/* the digits are m * 2^q, or m * 5^-q scaled by 10^q, in base 10^9 limbs */
+
+	small[0] = m % 1000000000;
+	small[1] = (m / 1000000000) % 1000000000;
+	small[2] = m / 1000000000000000000;
+	n = small[2] ? 3 : (small[1] ? 2 : 1);
+
+	/* the remainder of the power goes into the significand */
+
+	k = (q >= 0) ? q : -q;
+	for(i = k % 64; i > 0; i -= s) {
+		if(q >= 0)
+			s = (i < 32) ? i : 32, n = limb_mul(small, n, 1ULL << s);
+		else
+			s = (i < 13) ? i : 13, n = limb_mul(small, n, pow5[s]);
+	}
+
+	/* and multiples of 64 come from the table */
+
+	if(q >= 0) {
+		pow = lookupx_pow2 + lookupx_pow2_off[k / 64];
+		len = lookupx_pow2_off[k / 64 + 1] - lookupx_pow2_off[k / 64];
+	}
+	else {
+		pow = lookupx_pow5 + lookupx_pow5_off[k / 64];
+		len = lookupx_pow5_off[k / 64 + 1] - lookupx_pow5_off[k / 64];
+	}
+
+	c = 0;
+	for(i = 0; i < n + len - 1; i++) {
+		for(j = (i < len) ? 0 : (i - len + 1); (j < n) && (j <= i); j++)
+			c += (uint64_t)small[j] * pow[i - j];
+
+		limb[i] = c % 1000000000;
+		c /= 1000000000;
+	}
+
+	for(n = i; c > 0; c /= 1000000000)
+		limb[n++] = c % 1000000000;
+
+	/* print the leading limb, then nine digits per limb */
+
+	p = u32toa(limb[n - 1], buf);
+	for(i = n - 2; i >= 0; i--, p += 9) {
+		uint32_t v = limb[i], hi = v / 100000, lo = v % 100000;
+
+		p[0] = '0' + hi / 1000;
+		memcpy(p + 1, cDigitsLut + 2 * ((hi / 10) % 100), 2);
+		p[3] = '0' + hi % 10;
+		p[4] = '0' + lo / 10000;
+		memcpy(p + 5, cDigitsLut + 2 * ((lo / 100) % 100), 2);
+		memcpy(p + 7, cDigitsLut + 2 * (lo % 100), 2);
+	}
+
+	/* only integers carry trailing zeros */
+
+	n = (int)(p - buf) + ((q < 0) ? q : 0);
+	while(p[-1] == '0')
+		p--;
+
+	*p = '\0';
+
+	return n;
+}
+
+/**
+ * Order-preserving key of a double. Byte order of the keys, with a key
+ * sorting before any key it prefixes, matches numeric order. Both zeros
+ * share a key and NaN sorts after infinity.
+ *   @val: The value.
+ *   @buf: The output buffer, at least ERR_KEY_LEN bytes.
+ *   &returns: The key length.
+ */
+
+int errol_sortkey(double val, char *buf)
+{
+	int n, exp;
+	bool neg;
+
+	if(isnan(val))
+		return buf[0] = '5', buf[1] = '\0', 1;
+	else if(val == 0.0)
+		return buf[0] = '2', buf[1] = '\0', 1;
+	else if(isinf(val))
+		return buf[0] = (val < 0.0) ? '0' : '4', buf[1] = '\0', 1;
+
+	/* class, biased exponent, then the shortest digits */
+
+	neg = val < 0.0;
+	exp = errol6_dtoa(fabs(val), buf + 4) + 400;
+	n = strlen(buf + 4) + 4;
+
+	if(neg) {
+		int i;
+
+		exp = 999 - exp;
+		for(i = 4; i < n; i++)
+			buf[i] = '0' + '9' - buf[i];
+
+		buf[n++] = ':';
+		buf[n] = '\0';
+	}
+
+	buf[0] = neg ? '1' : '3';
+	buf[1] = '0' + exp / 100;
+	buf[2] = '0' + (exp / 10) % 10;
+	buf[3] = '0' + exp % 10;
+
+	return n;
+}
+
+/**
+ * Decode a key produced by errol_sortkey().
+ *   @key: The key.
+ *   &returns: The value, or NaN for a malformed key.
+ */
+
+double errol_sortkey_decode(const char *key)
+{
+	int i, exp;
+	bool neg;
+	char str[ERR_KEY_LEN + 8];
+
+	switch(key[0]) {
+	case '0': return -INFINITY;
+	case '2': return 0.0;
+	case '4': return INFINITY;
+	case '1':
+	case '3': break;
+	default: return NAN;
+	}
+
+	neg = key[0] == '1';
+	for(i = 1, exp = 0; i < 4; i++) {
+		if((key[i] < '0') || (key[i] > '9'))
+			return NAN;
+
+		exp = 10 * exp + key[i] - '0';
+	}
+
+	exp = (neg ? (999 - exp) : exp) - 400;
+
+	/* rebuild 0.digits followed by the exponent */
+
+	str[0] = '0';
+	str[1] = '.';
+	for(i = 4; (key[i] >= '0') && (key[i] <= '9') && (i < 21); i++)
+		str[i - 2] = neg ? ('0' + '9' - key[i]) : key[i];
+
+	if(i == 4)
+		return NAN;
+
+	sprintf(str + i - 2, "e%d", exp);
+
+	return neg ? -strtod(str, NULL) : strtod(str, NULL);
+}
+
+/**
+ * Convert a double to an IEEE 754 decimal64 in the binary integer decimal
+ * encoding. The coefficient is the value correctly rounded to 16 digits,
+ * or in shortest mode the shortest digits when they fit in 16 digits.
+ *   @val: The value.
+ *   @shortest: Use the shortest digits when they fit.
+ *   &returns: The decimal64 bit pattern.
+ */
+
+uint64_t errol_to_decimal64_bid(double val, bool shortest)
+{
+	int q, exp;
+	bool asym;
+	uint64_t m, c, sign;
+	errol_bits_t bits = { val };
+
+	sign = bits.i & (1ULL << 63);
+	m = bits.i & ((1ULL << 52) - 1);
+
+	if(isnan(val))
+		return sign | 0x7C00000000000000ULL;
+	else if(isinf(val))
+		return sign | 0x7800000000000000ULL;
+	else if(val == 0.0)
+		return sign | (398ULL << 53);
+
+	asym = (m == 0) && (((bits.i >> 52) & 0x7FF) > 1);
+	q = (((bits.i >> 52) & 0x7FF) > 0) ? ((int)((bits.i >> 52) & 0x7FF) - 1075) : -1074;
+	if(((bits.i >> 52) & 0x7FF) > 0)
+		m |= 1ULL << 52;
+
+	c = 10000000000000000ULL;
+	if(shortest)
+		c = fix_shortest(m, q, asym, &exp);
+
+	if(c >= 10000000000000000ULL)
+		c = round_digits(m, q, 16, &exp);
+
+	/* every double lies within the decimal64 exponent range */
+
+	if(c < (1ULL << 53))
+		return sign | ((uint64_t)(exp + 398) << 53) | c;
+	else
+		return sign | (3ULL << 61) | ((uint64_t)(exp + 398) << 51) | (c & ((1ULL << 51) - 1));
+}
+
+/**
+ * JSON double to ASCII conversion, following ECMAScript Number::toString:
+ * fixed notation for 1e-6 <= |val| < 1e21 and exponent notation otherwise.
+ * Negative zero is written as "0", and NaN and infinities as "null".
+ *   @val: The value.
+ *   @buf: The output buffer, at least ERR_JSON_LEN bytes.
+ *   &returns: The length of the string.
+ */
+
+int errol_json_dtoa(double val, char *buf)
+{
+	if(!isfinite(val))
+		return memcpy(buf, "null", 5), 4;
+	else if(val == 0.0)
+		return memcpy(buf, "0", 2), 1;
+	else if(val < 0.0)
+		return *buf = '-', json_abs(-val, buf + 1) + 1;
+	else
+		return json_abs(val, buf);
+}
+
+/**
+ * Shortest digits of a double as an integer, for writers that produce
+ * their own characters.
+ *   @val: The value, finite and nonzero. The sign is ignored.
+ *   @exp: Out. The decimal exponent e, with the value c * 10^e.
+ *   &returns: The digits c, without trailing zeros.
+ */
+
+uint64_t errol_digits(double val, int *exp)
+{
+	int q;
+	uint64_t m, c;
+	errol_bits_t bits = { val };
+
+	assert(isfinite(val) && (val != 0.0));
+
+	m = bits.i & ((1ULL << 52) - 1);
+	q = (((bits.i >> 52) & 0x7FF) > 0) ? ((int)((bits.i >> 52) & 0x7FF) - 1075) : -1074;
+	if(((bits.i >> 52) & 0x7FF) > 0)
+		m |= 1ULL << 52;
+
+	c = fix_shortest(m, q, (m == (1ULL << 52)) && (q > -1074), exp);
+	while((c % 10) == 0)
+		c /= 10, (*exp)++;
+
+	return c;
+}
+
+/**
+ * Fixed-width double to ASCII conversion, for aligned columns. The shorter
+ * of fixed and exponent notation is written together with its padding.
+ * With ERR_WIDTH_ROUND, digits are rounded off until the number fits, and
+ * a field too narrow for the number is filled with '#'. Digits that would
+ * round past DBL_MAX are truncated instead.
+ *   @val: The value.
+ *   @width: The field width, at least one.
+ *   @flags: ERR_WIDTH_LEFT to align left, ERR_WIDTH_ROUND to allow rounding.
+ *   @buf: The output buffer, at least width + 1 bytes.
+ *   &returns: The field width.
+ */
+
+int errol_dtoa_width(double val, int width, int flags, char *buf)
+{
+	int d, e, k, n, q, len, fix, sci;
+	bool neg;
+	char dig[24], *p = buf;
+	const char *str = NULL;
+	uint64_t m, c;
+	errol_bits_t bits = { val };
+
+	assert(width > 0);
+
+	neg = bits.i >> 63;
+	if(isnan(val))
+		str = "nan";
+	else if(isinf(val))
+		str = neg ? "-inf" : "inf";
+	else if(val == 0.0)
+		str = neg ? "-0" : "0";
+
+	if(str != NULL) {
+		len = strlen(str);
+		if(len > width)
+			goto fill;
+
+		if(!(flags & ERR_WIDTH_LEFT))
+			memset(p, ' ', width - len), p += width - len;
+
+		memcpy(p, str, len);
+		p += len;
+	}
+	else {
+		m = bits.i & ((1ULL << 52) - 1);
+		q = (((bits.i >> 52) & 0x7FF) > 0) ? ((int)((bits.i >> 52) & 0x7FF) - 1075) : -1074;
+		if(((bits.i >> 52) & 0x7FF) > 0)
+			m |= 1ULL << 52;
+
+		c = fix_shortest(m, q, (m == (1ULL << 52)) && (q > -1074), &e);
+		d = 0;
+
+		/* round to the most digits that fit, retrying if a carry widens it */
+
+		for(;;) {
+			while((c % 10) == 0)
+				c /= 10, e++;
+
+			k = u64toa(c, dig) - dig;
+			n = e + k;
+			fix = width_len(k, n, false) + neg;
+			sci = width_len(k, n, true) + neg;
+			if((fix <= width) || (sci <= width))
+				break;
+			else if(!(flags & ERR_WIDTH_ROUND))
+				goto fill;
+
+			/* a carry can still make a single digit fit, e.g. 0.95 to 1 */
+
+			if(d == 1)
+				goto fill;
+
+			d = (d == 0) ? width_digits(k, n, width - neg) : (d - 1);
+			if(d < 1)
+				d = 1;
+
+			/* rounding past DBL_MAX would read back as infinity, so truncate */
+
+			c = round_digits(m, q, d, &e);
+			if(width_over(c, e))
+				c--;
+		}
+
+		len = (fix <= sci) ? fix : sci;
+		if(!(flags & ERR_WIDTH_LEFT))
+			memset(p, ' ', width - len), p += width - len;
+
+		if(neg)
+			*p++ = '-';
+
+		p = width_write(p, dig, k, n, fix > sci);
+	}
+
+	if(flags & ERR_WIDTH_LEFT)
+		memset(p, ' ', width - len), p += width - len;
+
+	*p = '\0';
+
+	return width;
+
+fill:
+	memset(buf, '#', width);
+	buf[width] = '\0';
+
+	return width;
+}
+
+/**
+ * Format into a buffer like snprintf, with floating-point conversions
+ * done by Errol.
+ *   @buf: The output buffer.
+ *   @size: The buffer size.
+ *   @fmt: The format string.
+ *   &returns: The length of the full output, excluding the terminator.
+ */
+
+int errol_snprintf(char *buf, size_t size, const char *fmt, ...)
+{
+	int len;
+	va_list args;
+
+	va_start(args, fmt);
+	len = errol_vsnprintf(buf, size, fmt, args);
+	va_end(args);
+
+	return len;
+}
+
+/**
+ * Format into a buffer like vsnprintf, with floating-point conversions
+ * done by Errol. Long doubles, under the 'L' or 'll' modifier, and wide
+ * characters and strings, under 'l', are formatted by the C library's
+ * vsnprintf. So is the whole format if it uses the POSIX grouping flag or
+ * positional arguments.
+ *   @buf: The output buffer.
+ *   @size: The buffer size.
+ *   @fmt: The format string.
+ *   @args: The argument list.
+ *   &returns: The length of the full output, excluding the terminator.
+ */
+
+int errol_vsnprintf(char *buf, size_t size, const char *fmt, va_list args)
+{
+	char mod;
+	const char *s;
+	struct spec_t spec;
+	struct fmt_t out = { buf, size, 0, false };
+
+	if(fmt_posix(fmt))
+		return vsnprintf(buf, size, fmt, args);
+
+	for(;;) {
+		for(s = fmt; (*s != '\0') && (*s != '%'); s++)
+			;
+
+		fmt_put(&out, fmt, s - fmt);
+		if(*s == '\0')
+			break;
+
+		/* flags, width, precision, and length modifier */
+
+		fmt = s + 1;
+		for(spec.flags = 0; ; fmt++) {
+			if(*fmt == '-')
+				spec.flags |= FMT_LEFT;
+			else if(*fmt == '+')
+				spec.flags |= FMT_PLUS;
+			else if(*fmt == ' ')
+				spec.flags |= FMT_SPACE;
+			else if(*fmt == '#')
+				spec.flags |= FMT_ALT;
+			else if(*fmt == '0')
+				spec.flags |= FMT_ZERO;
+			else
+				break;
+		}
+
+		if(*fmt == '*') {
+			spec.width = va_arg(args, int), fmt++;
+			if(spec.width < 0)
+				spec.flags |= FMT_LEFT, spec.width = -spec.width;
+		}
+		else {
+			for(spec.width = 0; (*fmt >= '0') && (*fmt <= '9'); fmt++)
+				spec.width = 10 * spec.width + (*fmt - '0');
+		}
+
+		spec.prec = -1;
+		if(*fmt == '.') {
+			if(*++fmt == '*')
+				spec.prec = va_arg(args, int), fmt++;
+			else {
+				for(spec.prec = 0; (*fmt >= '0') && (*fmt <= '9'); fmt++)
+					spec.prec = 10 * spec.prec + (*fmt - '0');
+			}
+		}
+
+		mod = '\0';
+		if((fmt[0] == 'h') && (fmt[1] == 'h'))
+			mod = 'H', fmt += 2;
+		else if((fmt[0] == 'l') && (fmt[1] == 'l'))
+			mod = 'q', fmt += 2;
+		else if((*fmt != '\0') && strchr("hljztL", *fmt))
+			mod = *fmt++;
+
+		spec.conv = *fmt;
+		if(spec.conv == '\0')
+			break;
+
+		fmt++;
+		switch(spec.conv) {
+		case 'd':
+		case 'i':
+			{
+				int64_t v;
+
+				if(mod == 'H')
+					v = (signed char)va_arg(args, int);
+				else if(mod == 'h')
+					v = (short)va_arg(args, int);
+				else if(mod == 'l')
+					v = va_arg(args, long);
+				else if(mod == 'q')
+					v = va_arg(args, long long);
+				else if(mod == 'j')
+					v = va_arg(args, intmax_t);
+				else if((mod == 'z') || (mod == 't'))
+					v = va_arg(args, ptrdiff_t);
+				else
+					v = va_arg(args, int);
+
+				fmt_int(&out, &spec, (v < 0) ? -(uint64_t)v : (uint64_t)v, v < 0);
+			}
+			break;
+
+		case 'u':
+		case 'o':
+		case 'x':
+		case 'X':
+			{
+				uint64_t v;
+
+				if(mod == 'H')
+					v = (unsigned char)va_arg(args, unsigned int);
+				else if(mod == 'h')
+					v = (unsigned short)va_arg(args, unsigned int);
+				else if(mod == 'l')
+					v = va_arg(args, unsigned long);
+				else if(mod == 'q')
+					v = va_arg(args, unsigned long long);
+				else if(mod == 'j')
+					v = va_arg(args, uintmax_t);
+				else if((mod == 'z') || (mod == 't'))
+					v = va_arg(args, size_t);
+				else
+					v = va_arg(args, unsigned int);
+
+				fmt_int(&out, &spec, v, false);
+			}
+			break;
+
+		case 'p':
+			{
+				void *v = va_arg(args, void *);
+
+				if(v == NULL)
+					fmt_str(&out, &spec, "(nil)");
+				else
+					spec.flags |= FMT_ALT, fmt_int(&out, &spec, (uintptr_t)v, false);
+			}
+			break;
+
+		case 'c':
+			if(mod == 'l') {
+				fmt_defer(&out, &spec, "l", va_arg(args, wint_t));
+				break;
+			}
+
+			{
+				char c = (char)va_arg(args, int);
+
+				spec.flags &= ~FMT_ZERO;
+				fmt_lead(&out, &spec, "", 1);
+				fmt_put(&out, &c, 1);
+				fmt_trail(&out, &spec, 1);
+			}
+			break;
+
+		case 's':
+			if(mod == 'l') {
+				fmt_defer(&out, &spec, "l", va_arg(args, const wchar_t *));
+				break;
+			}
+
+			{
+				const char *v = va_arg(args, const char *);
+
+				if(v == NULL)
+					v = ((spec.prec < 0) || (spec.prec >= 6)) ? "(null)" : "";
+
+				fmt_str(&out, &spec, v);
+			}
+			break;
+
+		case 'e':
+		case 'E':
+		case 'f':
+		case 'F':
+		case 'g':
+		case 'G':
+		case 'a':
+		case 'A':
+			if((mod == 'L') || (mod == 'q'))
+				fmt_defer(&out, &spec, "L", va_arg(args, long double));
+			else
+				fmt_float(&out, &spec, va_arg(args, double));
+			break;
+
+		case 'n':
+			if(mod == 'H')
+				*va_arg(args, signed char *) = out.len;
+			else if(mod == 'h')
+				*va_arg(args, short *) = out.len;
+			else if(mod == 'l')
+				*va_arg(args, long *) = out.len;
+			else if(mod == 'q')
+				*va_arg(args, long long *) = out.len;
+			else if(mod == 'j')
+				*va_arg(args, intmax_t *) = out.len;
+			else if((mod == 'z') || (mod == 't'))
+				*va_arg(args, ptrdiff_t *) = out.len;
+			else
+				*va_arg(args, int *) = out.len;
+			break;
+
+		case '%':
+			fmt_put(&out, "%", 1);
+			break;
+
+		default:
+			fmt_put(&out, s, fmt - s);
+		}
+	}
+
+	if(size > 0)
+		buf[(out.len < size) ? out.len : (size - 1)] = '\0';
+
+	return out.fail ? -1 : (int)out.len;
+}
+
+/**
+ * Subnormal conversion algorithm, guaranteed correct, optimal, and best.
+ *   @val: The val.
+ *   @buf: The output buffer.
+ *   &return: The exponent.
+ */
+
+int errol_subnormal(double val, char *buf)
+{
+	int e, x;
+	bool lex, hex;
+	errol_bits_t bits = { val };
+	uint64_t m, lo, mid2, hi, p5 = 1, base = 5, pow[13];
+
+	assert((val > 0.0) && (val < 2.2250738585072014e-308));
+
+	/* scale by 5^x = 5^325 5^(x-325) into [10^17, 10^19) in constant time */
+
+	m = bits.i;
+	e = -1074 + 63 - __builtin_clzll(m);
+	x = 17 - (int)floor(e * 0.30102999566398119521);
+
+	for(int i = x - LOOKUPQ_POW5_EXP; i != 0; i >>= 1, base *= base) {
+		if(i & 0x1)
+			p5 *= base;
+	}
+
+	w_mul(pow, lookupq_pow5, 12, &p5, 1);
+
+	/* boundaries in units of 2^-1076 and the doubled midpoint */
+
+	lo = sub_scale(pow, 4 * m - 2, 1076 - x, &lex);
+	mid2 = sub_scale(pow, 4 * m, 1075 - x, NULL);
+	hi = sub_scale(pow, 4 * m + 2, 1076 - x, &hex);
+
+	/* exact boundaries are included only for even significands */
+
+	lo = lex ? (lo + (m & 0x1)) : (lo + 1);
+	hi = hex ? (hi - (m & 0x1)) : hi;
+
+	return narrow_shortest(lo, mid2, hi, -1, buf) - x;
+}
+
+
+/**
+ * Create a direct-mapped conversion cache.
+ *   @bits: The number of index bits, for 2^bits entries.
+ *   &returns: The cache, or null on allocation failure.
+ */
+
+struct errol_cache_t *errol_cache_new(unsigned int bits)
+{
+	size_t i;
+	struct errol_cache_t *cache;
+
+	assert((bits > 0) && (bits < 32));
+
+	cache = malloc(sizeof(struct errol_cache_t));
+	if(cache == NULL)
+		return NULL;
+
+	cache->memo = malloc(((size_t)1 << bits) * sizeof(struct errol_memo_t));
+	if(cache->memo == NULL)
+		return free(cache), NULL;
+
+	/* empty slots hold a NaN pattern, which is never a key */
+	for(i = 0; i < ((size_t)1 << bits); i++)
+		cache->memo[i].key = ~0ULL;
+
+	cache->bits = bits;
+	cache->hits = cache->misses = 0;
+
+	return cache;
+}
+
+/**
+ * Delete a conversion cache.
+ *   @cache: The cache, no longer selected by any thread.
+ */
+
+void errol_cache_delete(struct errol_cache_t *cache)
+{
+	free(cache->memo);
+	free(cache);
+}
+
+/**
+ * Select the conversion cache used by the calling thread. Each thread must
+ * select its own cache, so the cache is never locked.
+ *   @cache: The cache, or null to disable caching.
+ */
+
+void errol_cache_select(struct errol_cache_t *cache)
+{
+	errol_cache = cache;
+}
+
+/**
+ * Cached Errol3 double to ASCII conversion, using the cache selected by the
+ * calling thread.
+ *   @val: The value, finite.
+ *   @buf: The output buffer, at least 18 bytes.
+ *   &returns: The exponent.
+ */
+
+int errol3c_dtoa(double val, char *buf)
+{
+	errol_bits_t k = { val };
+	struct errol_cache_t *cache = errol_cache;
+	struct errol_memo_t *memo;
+
+	if(cache == NULL)
+		return errol3_dtoa(val, buf);
+
+	memo = &cache->memo[(k.i * 0x9E3779B97F4A7C15) >> (64 - cache->bits)];
+	if(memo->key == k.i) {
+		cache->hits++;
+		memcpy(buf, memo->slab.str, sizeof(memo->slab.str));
+
+		return memo->slab.exp;
+	}
+
+	cache->misses++;
+	memo->key = k.i;
+	memo->slab.exp = errol3_dtoa(val, memo->slab.str);
+	memcpy(buf, memo->slab.str, sizeof(memo->slab.str));
+
+	return memo->slab.exp;
+}
+
+
+/**
+ * Errol binary32 to ASCII conversion, guaranteed correct and optimal.
+ *   @val: The value.
+ *   @buf: The output buffer, at least 12 bytes.
+ *   &returns: The exponent.
+ */
+
+int errol_ftoa(float val, char *buf)
+{
+	int q;
+	errol_fbits_t bits = { val };
+	uint32_t m = bits.i & 0x7FFFFF;
+	unsigned int bexp = (bits.i >> 23) & 0xFF;
+
+	if(bexp > 0) {
+		m |= 1 << 23;
+		q = (int)bexp - 127 - 23;
+	}
+	else
+		q = 1 - 127 - 23;
+
+	return errol_narrow(m, q, (m == (1 << 23)) && (bexp > 1), 9, buf);
+}
+
+/**
+ * Corrected Errol3 double to ASCII conversion that emits the binary32
+ * shortest representation for doubles exactly representable as floats, as
+ * when the value was upcast from a float.
+ *   @val: The value.
+ *   @buf: The output buffer.
+ *   &returns: The exponent.
+ */
+
+int errol3f_dtoa(double val, char *buf)
+{
+	errol_bits_t bits = { val };
+	int e = (int)((bits.i >> 52) & 0x7FF) - 1023;
+
+	/* floats leave the low 29 bits clear, and more below the normal range */
+
+	if((e >= -149) && (e <= 127)) {
+		int z = (e < -126) ? (29 - 126 - e) : 29;
+
+		if((bits.i & ((1ULL << z) - 1)) == 0)
+			return errol_ftoa((float)val, buf);
+	}
+
+	return errol3_dtoa(val, buf);
+}
+
+/**
+ * Table based binary16 to ASCII conversion, guaranteed correct and optimal.
+ * The sign bit is ignored. Infinities and NaNs, which the table leaves out,
+ * are written as "inf" and "nan".
+ *   @val: The bit pattern.
+ *   @buf: The output buffer, at least 6 bytes.
+ *   &returns: The exponent, or ERR_NONFINITE.
+ */
+
+int errol_h_dtoa(uint16_t val, char *buf)
+{
+	uint32_t ent;
+
+	if((val & 0x7C00) == 0x7C00)
+		return memcpy(buf, (val & 0x3FF) ? "nan" : "inf", 4), ERR_NONFINITE;
+
+	ent = lookuph_table[val & 0x7FFF];
+
+	*u32toa(ent >> 8, buf) = '\0';
+
+	return (int8_t)ent;
+}
+
+/**
+ * Table based bfloat16 to ASCII conversion, guaranteed correct and optimal.
+ * The sign bit is ignored. Infinities and NaNs, which the table leaves out,
+ * are written as "inf" and "nan".
+ *   @val: The bit pattern.
+ *   @buf: The output buffer, at least 5 bytes.
+ *   &returns: The exponent, or ERR_NONFINITE.
+ */
+
+int errol_bf16_dtoa(uint16_t val, char *buf)
+{
+	uint32_t ent;
+
+	if((val & 0x7F80) == 0x7F80)
+		return memcpy(buf, (val & 0x7F) ? "nan" : "inf", 4), ERR_NONFINITE;
+
+	ent = lookupbf_table[val & 0x7FFF];
+
+	*u32toa(ent >> 8, buf) = '\0';
+
+	return (int8_t)ent;
+}
+
+/**
+ * Convert an array of binary16 values, as errol_h_dtoa.
+ *   @val: The bit patterns.
+ *   @n: The number of values.
+ *   @out: The output slabs.
+ */
+
+void errol_h_dtoa_n(const uint16_t *val, size_t n, struct errol_slab_t *out)
+{
+	size_t i;
+
+	for(i = 0; i < n; i++)
+		out[i].exp = errol_h_dtoa(val[i], out[i].str);
+}
+
+/**
+ * Convert an array of bfloat16 values, as errol_bf16_dtoa.
+ *   @val: The bit patterns.
+ *   @n: The number of values.
+ *   @out: The output slabs.
+ */
+
+void errol_bf16_dtoa_n(const uint16_t *val, size_t n, struct errol_slab_t *out)
+{
+	size_t i;
+
+	for(i = 0; i < n; i++)
+		out[i].exp = errol_bf16_dtoa(val[i], out[i].str);
+}
+
+
+/**
+ * Normalize the number by factoring in the error.
+ *   @hp: The float pair.
+ */
+
+static inline void hp_normalize(struct hp_t *hp)
+{
+	fpnum_t val = hp->val;
+
+	hp->val += hp->off;
+	hp->off += val - hp->val;
+}
+
+/**
+ * Multiply the high-precision number by ten.
+ *   @hp: The high-precision number
+ */
+
+static inline void hp_mul10(struct hp_t *hp)
+{
+	fpnum_t off, val = hp->val;
+
+	hp->val *= 10.0;
+	hp->off *= 10.0;
+	
+	off = hp->val;
+	off -= val * 8.0;
+	off -= val * 2.0;
+
+	hp->off -= off;
+
+	hp_normalize(hp);
+}
+
+/**
+ * Divide the high-precision number by ten.
+ *   @hp: The high-precision number
+ */
+
+static inline void hp_div10(struct hp_t *hp)
+{
+	double val = hp->val;
+
+	hp->val /= 10.0;
+	hp->off /= 10.0;
+
+	val -= hp->val * 8.0;
+	val -= hp->val * 2.0;
+
+	hp->off += val / 10.0;
+
+	hp_normalize(hp);
+}
+
+#ifdef __SSE2__
+/**
+ * Normalize two packed numbers by factoring in the error.
+ *   @hp: The packed float pairs.
+ */
+
+static inline void hp2_normalize(struct hp2_t *hp)
+{
+	__m128d val = hp->val;
+
+	hp->val = _mm_add_pd(hp->val, hp->off);
+	hp->off = _mm_add_pd(hp->off, _mm_sub_pd(val, hp->val));
+}
+
+/**
+ * Multiply two packed high-precision numbers by ten.
+ *   @hp: The packed high-precision numbers.
+ */
+
+static inline void hp2_mul10(struct hp2_t *hp)
+{
+	__m128d off, val = hp->val;
+
+	hp->val = _mm_mul_pd(hp->val, _mm_set1_pd(10.0));
+	hp->off = _mm_mul_pd(hp->off, _mm_set1_pd(10.0));
+
+	off = _mm_sub_pd(hp->val, _mm_mul_pd(val, _mm_set1_pd(8.0)));
+	off = _mm_sub_pd(off, _mm_mul_pd(val, _mm_set1_pd(2.0)));
+
+	hp->off = _mm_sub_pd(hp->off, off);
+
+	hp2_normalize(hp);
+}
+
+/**
+ * Divide two packed high-precision numbers by ten.
+ *   @hp: The packed high-precision numbers.
+ */
+
+static inline void hp2_div10(struct hp2_t *hp)
+{
+	__m128d val = hp->val;
+
+	hp->val = _mm_div_pd(hp->val, _mm_set1_pd(10.0));
+	hp->off = _mm_div_pd(hp->off, _mm_set1_pd(10.0));
+
+	val = _mm_sub_pd(val, _mm_mul_pd(hp->val, _mm_set1_pd(8.0)));
+	val = _mm_sub_pd(val, _mm_mul_pd(hp->val, _mm_set1_pd(2.0)));
+
+	hp->off = _mm_add_pd(hp->off, _mm_div_pd(val, _mm_set1_pd(10.0)));
+
+	hp2_normalize(hp);
+}
+
+/**
+ * Retrieve the leading digits of two packed high-precision numbers, one
+ * less when the value is a whole number with a negative offset.
+ *   @hp: The packed high-precision numbers.
+ *   &returns: The packed digits.
+ */
+
+static inline __m128d hp2_digit(const struct hp2_t *hp)
+{
+	__m128d dig, adj;
+
+	dig = _mm_cvtepi32_pd(_mm_cvttpd_epi32(hp->val));
+	adj = _mm_and_pd(_mm_cmpeq_pd(hp->val, dig), _mm_cmplt_pd(hp->off, _mm_setzero_pd()));
+
+	/* rarely taken, keeping the adjustment off the dependency chain */
+	if(_mm_movemask_pd(adj) != 0)
+		dig = _mm_sub_pd(dig, _mm_and_pd(adj, _mm_set1_pd(1.0)));
+
+	return dig;
+}
+
+/**
+ * Generate the digits of Errol3 from the two boundaries, advancing both in
+ * lockstep.
+ *   @high: The high boundary.
+ *   @low: The low boundary.
+ *   @exp: The exponent.
+ *   @buf: The output buffer.
+ *   &returns: The exponent.
+ */
+
+static int hp2_gen(struct hp_t high, struct hp_t low, int exp, char *buf)
+{
+	struct hp2_t hp;
+	__m128d dig;
+
+	hp.val = _mm_set_pd(low.val, high.val);
+	hp.off = _mm_set_pd(low.off, high.off);
+
+	/* normalized boundaries */
+
+	while(high.val > 10.0 || (high.val == 10.0 && high.off >= 0.0)) {
+		exp++, hp2_div10(&hp);
+		high.val = _mm_cvtsd_f64(hp.val), high.off = _mm_cvtsd_f64(hp.off);
+	}
+
+	while(high.val < 1.0 || (high.val == 1.0 && high.off < 0.0)) {
+		exp--, hp2_mul10(&hp);
+		high.val = _mm_cvtsd_f64(hp.val), high.off = _mm_cvtsd_f64(hp.off);
+	}
+
+	/* digit generation */
+
+	while(true) {
+		dig = hp2_digit(&hp);
+		if(!(_mm_movemask_pd(_mm_cmpeq_pd(dig, _mm_unpackhi_pd(dig, dig))) & 0x1))
+			break;
+
+		*buf++ = _mm_cvttsd_si32(dig) + '0';
+		hp.val = _mm_sub_pd(hp.val, dig);
+		hp2_mul10(&hp);
+	}
+
+	double tmp = (_mm_cvtsd_f64(hp.val) + _mm_cvtsd_f64(_mm_unpackhi_pd(hp.val, hp.val))) / 2.0;
+	uint8_t mdig = tmp + 0.5;
+	if((mdig - tmp) == 0.5 && (mdig & 0x1))
+		mdig--;
+
+	*buf++ = mdig + '0';
+	*buf = '\0';
+
+	return exp;
+}
+#endif
+
+#ifdef __AVX2__
+/**
+ * Normalize four packed numbers by factoring in the error.
+ *   @hp: The packed float pairs.
+ */
+
+static inline void hp4_normalize(struct hp4_t *hp)
+{
+	__m256d val = hp->val;
+
+	hp->val = _mm256_add_pd(hp->val, hp->off);
+	hp->off = _mm256_add_pd(hp->off, _mm256_sub_pd(val, hp->val));
+}
+
+/**
+ * Multiply four packed high-precision numbers by ten.
+ *   @hp: The packed high-precision numbers.
+ */
+
+static inline void hp4_mul10(struct hp4_t *hp)
+{
+	__m256d off, val = hp->val;
+
+	hp->val = _mm256_mul_pd(hp->val, _mm256_set1_pd(10.0));
+	hp->off = _mm256_mul_pd(hp->off, _mm256_set1_pd(10.0));
+
+	off = _mm256_sub_pd(hp->val, _mm256_mul_pd(val, _mm256_set1_pd(8.0)));
+	off = _mm256_sub_pd(off, _mm256_mul_pd(val, _mm256_set1_pd(2.0)));
+
+	hp->off = _mm256_sub_pd(hp->off, off);
+
+	hp4_normalize(hp);
+}
+
+/**
+ * Divide four packed high-precision numbers by ten.
+ *   @hp: The packed high-precision numbers.
+ */
+
+static inline void hp4_div10(struct hp4_t *hp)
+{
+	__m256d val = hp->val;
+
+	hp->val = _mm256_div_pd(hp->val, _mm256_set1_pd(10.0));
+	hp->off = _mm256_div_pd(hp->off, _mm256_set1_pd(10.0));
+
+	val = _mm256_sub_pd(val, _mm256_mul_pd(hp->val, _mm256_set1_pd(8.0)));
+	val = _mm256_sub_pd(val, _mm256_mul_pd(hp->val, _mm256_set1_pd(2.0)));
+
+	hp->off = _mm256_add_pd(hp->off, _mm256_div_pd(val, _mm256_set1_pd(10.0)));
+
+	hp4_normalize(hp);
+}
+
+/**
+ * Retrieve the leading digits of four packed high-precision numbers, one
+ * less when the value is a whole number with a negative offset.
+ *   @hp: The packed high-precision numbers.
+ *   &returns: The packed digits.
+ */
+
+static inline __m256d hp4_digit(const struct hp4_t *hp)
+{
+	__m256d dig, adj;
+
+	dig = _mm256_round_pd(hp->val, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+	adj = _mm256_and_pd(_mm256_cmp_pd(hp->val, dig, _CMP_EQ_OQ), _mm256_cmp_pd(hp->off, _mm256_setzero_pd(), _CMP_LT_OQ));
+
+	/* rarely taken, keeping the adjustment off the dependency chain */
+	if(_mm256_movemask_pd(adj) != 0)
+		dig = _mm256_sub_pd(dig, _mm256_and_pd(adj, _mm256_set1_pd(1.0)));
+
+	return dig;
+}
+
+/**
+ * Generate the digits of Errol1 from the inner and outer boundaries,
+ * advancing all four in lockstep.
+ *   @inhi, inlo: The inner boundaries.
+ *   @outhi, outlo: The outer boundaries.
+ *   @exp: The exponent.
+ *   @buf: The output buffer.
+ *   @opt: The optimality flag.
+ *   &returns: The exponent.
+ */
+
+static int hp4_gen(struct hp_t inhi, struct hp_t inlo, struct hp_t outhi, struct hp_t outlo, int exp, char *buf, bool *opt)
+{
+	struct hp4_t hp;
+	__m256d dig;
+	int32_t idig[4];
+
+	hp.val = _mm256_set_pd(outlo.val, outhi.val, inlo.val, inhi.val);
+	hp.off = _mm256_set_pd(outlo.off, outhi.off, inlo.off, inhi.off);
+
+	/* normalized boundaries */
+
+	while(inhi.val > 10.0 || (inhi.val == 10.0 && inhi.off >= 0.0)) {
+		exp++, hp4_div10(&hp);
+		inhi.val = _mm256_cvtsd_f64(hp.val), inhi.off = _mm256_cvtsd_f64(hp.off);
+	}
+
+	while(inhi.val < 1.0 || (inhi.val == 1.0 && inhi.off < 0.0)) {
+		exp--, hp4_mul10(&hp);
+		inhi.val = _mm256_cvtsd_f64(hp.val), inhi.off = _mm256_cvtsd_f64(hp.off);
+	}
+
+	/* digit generation */
+
+	*opt = true;
+
+	while(inhi.val != 0.0 || inhi.off != 0.0) {
+		dig = hp4_digit(&hp);
+		_mm_storeu_si128((__m128i *)idig, _mm256_cvttpd_epi32(dig));
+
+		if(idig[1] != idig[0])
+			break;
+
+		*buf++ = idig[0] + '0';
+		if(idig[3] != idig[2])
+			*opt = false;
+
+		hp.val = _mm256_sub_pd(hp.val, dig);
+		hp4_mul10(&hp);
+		inhi.val = _mm256_cvtsd_f64(hp.val), inhi.off = _mm256_cvtsd_f64(hp.off);
+	}
+
+	double mdig = (inhi.val + _mm_cvtsd_f64(_mm_unpackhi_pd(_mm256_castpd256_pd128(hp.val), _mm256_castpd256_pd128(hp.val)))) / 2.0 + 0.5;
+	*buf++ = (uint8_t)mdig + '0';
+	*buf = '\0';
+
+	return exp;
+}
+#endif
+
+static inline double gethi(double in)
+{
+	errol_bits_t v = { .d = in };
+
+	//v.i += 0x0000000004000000;
+	v.i &= 0xFFFFFFFFF8000000;
+
+	return v.d;
+}
+
+/**
+ * Split a double into two halves.
+ *   @val: The double.
+ *   @hi: The high bits.
+ *   @lo: The low bits.
+ */
+
+static inline void split(double val, double *hi, double *lo)
+{
+	//double t = (134217728.0 + 1.0) * val;
+
+	//*hi = t - (t - val);
+	//if(*hi != gethi(val)) 
+	//*lo = val - *hi;
+
+	*hi = gethi(val);
+	*lo = val - *hi;
+}
+
+/**
+ * Compute the product of an HP number and a double.
+ *   @in: The HP number.
+ *   @val: The double.
+ *   &returns: The HP number.
+ */
+
+static struct hp_t hp_prod(struct hp_t in, double val)
+{
+	double p, hi, lo, e;
+
+	double hi2, lo2;
+	split(in.val, &hi, &lo);
+	split(val, &hi2, &lo2);
+
+	p = in.val * val;
+	e = ((hi * hi2 - p) + lo * hi2 + hi * lo2) + lo * lo2;
+
+	return (struct hp_t){ p, in.off * val + e };
+}
+
+/**
+ * Given two different integers with the same length in terms of the number
+ * of decimal digits, index the digits from the right-most position starting
+ * from zero, find the first index where the digits in the two integers
+ * divergent starting from the highest index.
+ *   @a: Integer a.
+ *   @b: Integer b.
+ *   &returns: An index within [0, 19).
+ */
+
+static inline int mismatch10(uint64_t a, uint64_t b)
+{
+	uint64_t pow10 = 10000000000U;
+	uint64_t af = a / pow10;
+	uint64_t bf = b / pow10;
+	int i = 0;
+
+	if (af != bf)
+	{
+		i = 10;
+		a = af;
+		b = bf;
+	}
+
+	for (;; ++i)
+	{
+		a /= 10;
+		b /= 10;
+
+		if (a == b)
+			return i;
+	}
+}
+
+/**
+ * Find the insertion point for a key in a level-order array.
+ *   @table: The target array.
+ *   @n: Array size.
+ *   @k: The key to find.
+ *   &returns: The insertion point.
+ */
+
+static inline int table_lower_bound(uint64_t *table, int n, uint64_t k)
+{
+	int i = n, j = 0;
+
+	while (j < n)
+	{
+		if (table[j] < k)
 			j = 2 * j + 2;
 		else
-		{
-			i = j;
-			j = 2 * j + 1;
+		{
+			i = j;
+			j = 2 * j + 1;
+		}
+	}
+
+	return i;
+}
+
+
+/**
+ * Short decimal conversion algorithm, for values with at most six fractional
+ * digits. Below 2^33 the rounding interval is narrower than 10^-6, so it
+ * holds at most one candidate with six fractional digits. The candidate is
+ * the value rounded at that scale, and dropping its trailing zeros leaves the
+ * shortest output.
+ *   @val: The value, below 2^33.
+ *   @buf: The output buffer.
+ *   @exp: Out. The exponent.
+ *   &returns: True if the value is a short decimal.
+ */
+
+static bool errol_short(double val, char *buf, int *exp)
+{
+	int sh;
+	char *p;
+	errol_bits_t bits = { val };
+	uint64_t m, n;
+	__uint128_t mk, rem, dist;
+	static const uint64_t pow = 1000000;
+
+	/* the asymmetric interval at a power of two is left to the full path */
+
+	m = bits.i & ((1ULL << 52) - 1);
+	if(m == 0)
+		return false;
+
+	m |= 1ULL << 52;
+	sh = 1075 - (int)((bits.i >> 52) & 0x7FF);
+
+	/* round val 10^6 to nearest, the interval excludes any tie */
+
+	mk = (__uint128_t)m * pow;
+	n = mk >> sh;
+	rem = mk - ((__uint128_t)n << sh);
+	if(rem >> (sh - 1))
+		n++, dist = ((__uint128_t)1 << sh) - rem;
+	else
+		dist = rem;
+
+	/* the boundaries are inclusive only for even significands */
+
+	if((2 * dist > pow) || ((2 * dist == pow) && (m & 0x1)) || (n == 0))
+		return false;
+
+	*exp = -6;
+	while((n % 10) == 0)
+		n /= 10, (*exp)++;
+
+	p = u64toa(n, buf);
+	*p = '\0';
+	*exp += p - buf;
+
+	return true;
+}
+
+/**
+ * Wide conversion algorithm for significands of up to 113 bits. The
+ * boundaries are scaled into [10^35, 10^37) using a 256-bit power of ten and
+ * the shortest decimal is found using integer arithmetic.
+ *   @m: The significand.
+ *   @q: The binary exponent.
+ *   @asym: Whether the lower gap is half of the upper gap.
+ *   @buf: The output buffer.
+ *   &returns: The exponent.
+ */
+
+static int errol_wide(__uint128_t m, int q, bool asym, char *buf)
+{
+	int e, x, pe, sh;
+	__uint128_t lo, mid2, hi;
+	uint64_t w[4], v[2], r[6];
+
+	e = q + 127;
+	e -= ((uint64_t)(m >> 64) != 0) ? __builtin_clzll(m >> 64) : 64 + __builtin_clzll(m);
+
+	/* scale the boundaries into [10^35, 10^37) */
+
+	x = 35 - (int)floor(e * 0.30102999566398119521);
+	pow10q(x, w, &pe);
+	sh = -(pe + q - 2);
+
+	lo = asym ? (4 * m - 1) : (4 * m - 2);
+	v[0] = (uint64_t)lo, v[1] = (uint64_t)(lo >> 64);
+	w_mul(r, w, 4, v, 2);
+	lo = w_shr(r, sh - 1);
+
+	v[0] = (uint64_t)(4 * m), v[1] = (uint64_t)((4 * m) >> 64);
+	w_mul(r, w, 4, v, 2);
+	mid2 = w_shr(r, sh - 1);
+
+	v[0] = (uint64_t)(4 * m + 2), v[1] = (uint64_t)((4 * m + 2) >> 64);
+	w_mul(r, w, 4, v, 2);
+	hi = w_shr(r, sh - 1);
+
+	/* exact boundaries are included only for even significands */
+
+	if(asym ? errolq_exact(4 * m - 1, q - 2, x) : errolq_exact(2 * m - 1, q - 1, x))
+		lo = ((lo + 1) >> 1) + (m & 0x1);
+	else
+		lo = (lo >> 1) + 1;
+
+	if(errolq_exact(2 * m + 1, q - 1, x))
+		hi = ((hi + 1) >> 1) - (m & 0x1);
+	else
+		hi = hi >> 1;
+
+	return errolq_shortest(lo, mid2, hi, errolq_tie(m, q, x), buf) - x;
+}
+
+/**
+ * Scale the value m 2^q by the 256-bit power of ten w 2^pe, approximating
+ * 10^x, and round it to an integer.
+ *   @w: The power of ten.
+ *   @pe: The binary exponent of the power.
+ *   @m: The significand.
+ *   @q: The binary exponent.
+ *   @x: The decimal exponent.
+ *   @up: Round up if set, otherwise round down.
+ *   &returns: The rounded result.
+ */
+
+static __uint128_t range_scale(const uint64_t w[static 4], int pe, uint64_t m, int q, int x, bool up)
+{
+	int z = __builtin_ctzll(m);
+	uint64_t v[2], r[6];
+	__uint128_t res;
+
+	/* an odd significand makes the exactness test precise */
+
+	m >>= z, q += z;
+
+	v[0] = m, v[1] = 0;
+	w_mul(r, w, 4, v, 2);
+	res = w_shr(r, -(pe + q) - 1);
+
+	if(errolq_exact(m, q, x))
+		return (res + 1) >> 1;
+
+	return (res >> 1) + (up ? 1 : 0);
+}
+
+/**
+ * Directed conversion algorithm. The rounding interval is cut at the value,
+ * keeping the half above it when rounding up or the half below it when
+ * rounding down, and the candidate nearest to the value is chosen.
+ *   @val: The value.
+ *   @up: Round up if set, otherwise round down.
+ *   @buf: The output buffer.
+ *   &returns: The exponent.
+ */
+
+static int errol_directed(double val, bool up, char *buf)
+{
+	int e, x, pe, q;
+	bool asym;
+	uint64_t m, w[4];
+	__uint128_t lo, hi;
+	errol_bits_t bits = { val };
+
+	assert((val > 0.0) && (val <= DBL_MAX));
+
+	m = bits.i & ((1ULL << 52) - 1);
+	asym = (m == 0) && ((bits.i >> 52) > 1);
+	q = ((bits.i >> 52) > 0) ? ((int)(bits.i >> 52) - 1075) : -1074;
+	if((bits.i >> 52) > 0)
+		m |= 1ULL << 52;
+
+	e = q + 63 - __builtin_clzll(m);
+	x = 35 - (int)floor(e * 0.30102999566398119521);
+	pow10q(x, w, &pe);
+
+	/* exact boundaries are included only for even significands */
+
+	if(up) {
+		lo = range_scale(w, pe, m, q, x, true);
+		hi = range_scale(w, pe, 2 * m + 1, q - 1, x, false);
+		if((m & 0x1) && errolq_exact(2 * m + 1, q - 1, x))
+			hi--;
+
+		return errolq_shortest(lo, 2 * lo, hi, -1, buf) - x;
+	}
+	else {
+		if(asym)
+			lo = range_scale(w, pe, 4 * m - 1, q - 2, x, true);
+		else
+			lo = range_scale(w, pe, 2 * m - 1, q - 1, x, true);
+
+		if((m & 0x1) && errolq_exact(2 * m - 1, q - 1, x))
+			lo++;
+
+		hi = range_scale(w, pe, m, q, x, false);
+
+		return errolq_shortest(lo, 2 * hi, hi, -1, buf) - x;
+	}
+}
+
+/**
+ * Multiply a base 10^9 integer by a small factor in place.
+ *   @limb: The limbs, least significant first.
+ *   @n: The number of limbs.
+ *   @f: The factor, at most 2^32.
+ *   &returns: The new number of limbs.
+ */
+
+static int inline limb_mul(uint32_t *limb, int n, uint64_t f)
+{
+	int i;
+	uint64_t c = 0;
+
+	for(i = 0; i < n; i++) {
+		c += limb[i] * f;
+		limb[i] = c % 1000000000;
+		c /= 1000000000;
+	}
+
+	while(c > 0) {
+		limb[n++] = c % 1000000000;
+		c /= 1000000000;
+	}
+
+	return n;
+}
+
+
+/**
+ * Narrow conversion algorithm for significands of up to 53 bits with a
+ * moderate exponent. The boundaries are scaled exactly into
+ * [10^d, 10^(d+2)) and the shortest decimal is found using integer
+ * arithmetic.
+ *   @m: The significand.
+ *   @q: The binary exponent.
+ *   @asym: Whether the lower gap is half of the upper gap.
+ *   @d: The scale, 9 for floats or 17 for doubles.
+ *   @buf: The output buffer.
+ *   &returns: The exponent.
+ */
+
+static int errol_narrow(uint64_t m, int q, bool asym, int d, char *buf)
+{
+	int e, x;
+	bool lex, hex;
+	uint64_t lo, mid2, hi;
+
+	e = q + 63 - __builtin_clzll(m);
+	x = d - (int)floor(e * 0.30102999566398119521);
+
+	lo = narrow_scale(asym ? (4 * m - 1) : (4 * m - 2), q - 2, x, &lex);
+	mid2 = narrow_scale(4 * m, q - 1, x, NULL);
+	hi = narrow_scale(4 * m + 2, q - 2, x, &hex);
+
+	/* exact boundaries are included only for even significands */
+
+	lo = lex ? (lo + (m & 0x1)) : (lo + 1);
+	hi = hex ? (hi - (m & 0x1)) : hi;
+
+	return narrow_shortest(lo, mid2, hi, errolq_tie(m, q, x), buf) - x;
+}
+
+/**
+ * Fixed point conversion algorithm for significands of up to 53 bits.
+ *   @m: The significand.
+ *   @q: The binary exponent.
+ *   @asym: Whether the lower gap is half of the upper gap.
+ *   @buf: The output buffer.
+ *   &returns: The exponent.
+ */
+
+static int errol_fix(uint64_t m, int q, bool asym, char *buf)
+{
+	int exp;
+	char *p;
+
+	p = u64toa(fix_shortest(m, q, asym, &exp), buf);
+	*p = '\0';
+
+	return exp + (p - buf);
+}
+
+/**
+ * JSON double to ASCII conversion of a positive finite value. Split out
+ * of errol_json_dtoa, leaving the special cases and the sign there small
+ * enough to inline into callers.
+ *   @val: The value.
+ *   @buf: The output buffer.
+ *   &returns: The length of the string.
+ */
+
+static int json_abs(double val, char *buf)
+{
+	int k, n, q;
+	char dig[20], *p = buf;
+	uint64_t m, c;
+	errol_bits_t bits = { val };
+
+	m = bits.i & ((1ULL << 52) - 1);
+	q = (((bits.i >> 52) & 0x7FF) > 0) ? ((int)((bits.i >> 52) & 0x7FF) - 1075) : -1074;
+	if(((bits.i >> 52) & 0x7FF) > 0)
+		m |= 1ULL << 52;
+
+	c = fix_shortest(m, q, (m == (1ULL << 52)) && (q > -1074), &n);
+	while((c % 10) == 0)
+		c /= 10, n++;
+
+	/* digits s with value s * 10^(n - k) */
+
+	k = u64toa(c, dig) - dig;
+	n += k;
+
+	if((k <= n) && (n <= 21)) {
+		memcpy(p, dig, k);
+		memset(p + k, '0', n - k);
+		p += n;
+	}
+	else if((0 < n) && (n <= 21)) {
+		memcpy(p, dig, n);
+		p[n] = '.';
+		memcpy(p + n + 1, dig + n, k - n);
+		p += k + 1;
+	}
+	else if((-6 < n) && (n <= 0)) {
+		memcpy(p, "0.000000", 2 - n);
+		memcpy(p + 2 - n, dig, k);
+		p += 2 - n + k;
+	}
+	else {
+		*p++ = dig[0];
+		if(k > 1) {
+			*p++ = '.';
+			memcpy(p, dig + 1, k - 1);
+			p += k - 1;
+		}
+
+		*p++ = 'e';
+		*p++ = (n > 0) ? '+' : '-';
+		p = u32toa((n > 0) ? (n - 1) : (1 - n), p);
+	}
+
+	*p = '\0';
+
+	return p - buf;
+}
+
+/**
+ * Shortest digits of m 2^q as an integer. The boundaries are scaled into
+ * [10^17, 10^19) by a 128-bit truncated power of ten, and the shortest
+ * decimal is found using integer arithmetic.
+ *   @m: The significand.
+ *   @q: The binary exponent.
+ *   @asym: Whether the lower gap is half of the upper gap.
+ *   @exp: Out. The decimal exponent of the last digit.
+ *   &returns: The digits.
+ */
+
+static uint64_t fix_shortest(uint64_t m, int q, bool asym, int *exp)
+{
+	int e, t, x, sh;
+	uint64_t c;
+	uint64_t lo, mid2, hi;
+	const struct pow128_t *pow;
+
+	/* floor(e log10(2)) is (e * 78913) >> 18 for |e| <= 1650 */
+
+	e = q + 63 - __builtin_clzll(m);
+	x = 17 - ((e * 78913) >> 18);
+	pow = &lookupi_table[x - LOOKUPI_TABLE_MIN];
+	sh = -(pow->exp + q - 2);
+
+	lo = fix_mul(pow, asym ? (4 * m - 1) : (4 * m - 2), sh - 1);
+	mid2 = fix_mul(pow, 4 * m, sh - 1);
+	hi = fix_mul(pow, 4 * m + 2, sh - 1);
+
+	/* exact boundaries are included only for even significands */
+
+	if(asym ? errolq_exact(4 * m - 1, q - 2, x) : errolq_exact(2 * m - 1, q - 1, x))
+		lo = ((lo + 1) >> 1) + (m & 0x1);
+	else
+		lo = (lo >> 1) + 1;
+
+	if(errolq_exact(2 * m + 1, q - 1, x))
+		hi = ((hi + 1) >> 1) - (m & 0x1);
+	else
+		hi = hi >> 1;
+
+	c = narrow_pick(lo, mid2, hi, errolq_tie(m, q, x), &t);
+	*exp = t - x;
+
+	return c;
+}
+
+/**
+ * Round m 2^q to n significant digits, to nearest with ties to even.
+ *   @m: The significand.
+ *   @q: The binary exponent.
+ *   @n: The number of digits, between 1 and 19.
+ *   @exp: Out. The decimal exponent of the last digit.
+ *   &returns: The digits, in [10^(n-1), 10^n).
+ */
+
+static uint64_t round_digits(uint64_t m, int q, int n, int *exp)
+{
+	int i, x, z = __builtin_ctzll(m);
+	uint64_t c, lo = 1;
+	__uint128_t d;
+
+	for(i = 1; i < n; i++)
+		lo *= 10;
+
+	/* an odd significand makes the tie test precise */
+
+	m >>= z, q += z;
+	x = digits_scale(m, q, n, lo, &d);
+
+	c = d >> 1;
+	if((d & 0x1) && (!errolq_exact(m, q + 1, x) || (c & 0x1)))
+		c++;
+
+	if(c == 10 * lo)
+		c = lo, x--;
+
+	*exp = -x;
+
+	return c;
+}
+
+/**
+ * Scale m 2^q by the power of ten placing it in [10^(n-1), 10^n).
+ *   @m: The significand.
+ *   @q: The binary exponent.
+ *   @n: The number of digits.
+ *   @lo: The lower bound, 10^(n-1).
+ *   @d: Out. The value 2 m 2^q 10^x, truncated.
+ *   &returns: The decimal exponent x.
+ */
+
+static int digits_scale(uint64_t m, int q, int n, uint64_t lo, __uint128_t *d)
+{
+	int x, pe;
+	uint64_t w[4];
+
+	x = (n - 1) - (((q + 63 - __builtin_clzll(m)) * 78913) >> 18);
+
+	/* the estimate is at most one digit short */
+
+	for(;;) {
+		pow10q(x, w, &pe);
+		*d = range_scale(w, pe, m, q + 1, x, false);
+		if(*d < 2 * (__uint128_t)lo)
+			x++;
+		else if(*d >= 20 * (__uint128_t)lo)
+			x--;
+		else
+			return x;
+	}
+}
+
+/**
+ * Length of the digits s, with value 0.s * 10^n, in fixed or exponent
+ * notation.
+ *   @k: The number of digits.
+ *   @n: The decimal exponent.
+ *   @sci: Use exponent notation if set.
+ *   &returns: The length.
+ */
+
+static int inline width_len(int k, int n, bool sci)
+{
+	int e = (n > 0) ? (n - 1) : (1 - n);
+
+	if(sci)
+		return k + (k > 1) + 1 + (n <= 0) + ((e >= 100) ? 3 : ((e >= 10) ? 2 : 1));
+	else if(n >= k)
+		return n;
+	else if(n > 0)
+		return k + 1;
+	else
+		return 2 - n + k;
+}
+
+/**
+ * Most digits, fewer than k, of a number 0.s * 10^n that fit in a width.
+ *   @k: The number of digits.
+ *   @n: The decimal exponent.
+ *   @width: The available width.
+ *   &returns: The number of digits, below one if none fit.
+ */
+
+static int width_digits(int k, int n, int width)
+{
+	int fix, sci, e = (n > 0) ? (n - 1) : (1 - n);
+
+	/* integers cost n at up to n digits and d + 1 past that */
+
+	if(n > 0)
+		fix = (width - 1 > n) ? (width - 1) : ((n <= width) ? n : 0);
+	else
+		fix = width - 2 + n;
+
+	sci = width - 1 - (n <= 0) - ((e >= 100) ? 3 : ((e >= 10) ? 2 : 1));
+	if(sci > 1)
+		sci--;
+
+	if(fix < sci)
+		fix = sci;
+
+	return (fix < k - 1) ? fix : (k - 1);
+}
+
+/**
+ * Check if a decimal lies above DBL_MAX, 1.797693134862315708...e308.
+ *   @c: The digits, nonzero.
+ *   @e: The decimal exponent of the last digit.
+ *   &returns: True if above.
+ */
+
+static bool width_over(uint64_t c, int e)
+{
+	int k = 1;
+
+	for(uint64_t t = c; t >= 10; t /= 10)
+		k++;
+
+	if(e + k != 309)
+		return e + k > 309;
+
+	for(; k < 19; k++)
+		c *= 10;
+
+	return c > 1797693134862315708ULL;
+}
+
+/**
+ * Write the digits s, with value 0.s * 10^n, in fixed or exponent notation.
+ *   @p: The output pointer.
+ *   @dig: The digits.
+ *   @k: The number of digits.
+ *   @n: The decimal exponent.
+ *   @sci: Use exponent notation if set.
+ *   &returns: The end of the output.
+ */
+
+static char *width_write(char *p, const char *dig, int k, int n, bool sci)
+{
+	if(sci) {
+		*p++ = dig[0];
+		if(k > 1) {
+			*p++ = '.';
+			memcpy(p, dig + 1, k - 1);
+			p += k - 1;
+		}
+
+		*p++ = 'e';
+		if(n <= 0)
+			*p++ = '-';
+
+		return u32toa((n > 0) ? (n - 1) : (1 - n), p);
+	}
+	else if(n >= k) {
+		memcpy(p, dig, k);
+		memset(p + k, '0', n - k);
+
+		return p + n;
+	}
+	else if(n > 0) {
+		memcpy(p, dig, n);
+		p[n] = '.';
+		memcpy(p + n + 1, dig + n, k - n);
+
+		return p + k + 1;
+	}
+	else {
+		p[0] = '0';
+		p[1] = '.';
+		memset(p + 2, '0', -n);
+		memcpy(p + 2 - n, dig, k);
+
+		return p + 2 - n + k;
+	}
+}
+
+/**
+ * Append a string to formatted output, truncating at the buffer end.
+ *   @out: The output.
+ *   @str: The string.
+ *   @n: The string length.
+ */
+
+static void fmt_put(struct fmt_t *out, const char *str, size_t n)
+{
+	if(out->len < out->size)
+		memcpy(out->buf + out->len, str, (n < out->size - out->len) ? n : (out->size - out->len));
+
+	out->len += n;
+}
+
+/**
+ * Append a run of a character to formatted output.
+ *   @out: The output.
+ *   @ch: The character.
+ *   @n: The run length, nothing if not positive.
+ */
+
+static void fmt_fill(struct fmt_t *out, char ch, int n)
+{
+	if(n <= 0)
+		return;
+
+	if(out->len < out->size)
+		memset(out->buf + out->len, ch, ((size_t)n < out->size - out->len) ? (size_t)n : (out->size - out->len));
+
+	out->len += n;
+}
+
+/**
+ * Write the padding and prefix before a field.
+ *   @out: The output.
+ *   @spec: The specification.
+ *   @pre: The sign or base prefix.
+ *   @len: The field length, including the prefix.
+ */
+
+static void fmt_lead(struct fmt_t *out, const struct spec_t *spec, const char *pre, int len)
+{
+	if(!(spec->flags & (FMT_LEFT | FMT_ZERO)))
+		fmt_fill(out, ' ', spec->width - len);
+
+	fmt_put(out, pre, strlen(pre));
+	if((spec->flags & (FMT_LEFT | FMT_ZERO)) == FMT_ZERO)
+		fmt_fill(out, '0', spec->width - len);
+}
+
+/**
+ * Write the padding after a left-justified field.
+ *   @out: The output.
+ *   @spec: The specification.
+ *   @len: The field length.
+ */
+
+static void fmt_trail(struct fmt_t *out, const struct spec_t *spec, int len)
+{
+	if(spec->flags & FMT_LEFT)
+		fmt_fill(out, ' ', spec->width - len);
+}
+
+/**
+ * Format an integer for the d, i, u, o, x, X, and p conversions.
+ *   @out: The output.
+ *   @spec: The specification.
+ *   @val: The magnitude.
+ *   @neg: The sign.
+ */
+
+static void fmt_int(struct fmt_t *out, struct spec_t *spec, uint64_t val, bool neg)
+{
+	int n, prec;
+	char dig[24], pre[3] = "", *s, *e;
+	const char *hex = (spec->conv == 'X') ? "0123456789ABCDEF" : "0123456789abcdef";
+
+	if((spec->conv == 'o') || (spec->conv == 'x') || (spec->conv == 'X') || (spec->conv == 'p')) {
+		unsigned int sh = (spec->conv == 'o') ? 3 : 4;
+
+		s = e = dig + sizeof(dig);
+		do
+			*--s = hex[val & ((1 << sh) - 1)];
+		while(val >>= sh);
+	}
+	else
+		s = dig, e = u64toa(val, dig);
+
+	/* a zero precision prints nothing for zero */
+
+	prec = (spec->prec >= 0) ? spec->prec : 1;
+	n = ((prec == 0) && (e - s == 1) && (*s == '0')) ? 0 : (e - s);
+
+	if((spec->conv == 'd') || (spec->conv == 'i'))
+		pre[0] = neg ? '-' : ((spec->flags & FMT_PLUS) ? '+' : ((spec->flags & FMT_SPACE) ? ' ' : '\0'));
+	else if((spec->conv == 'o') && (spec->flags & FMT_ALT) && ((n == 0) || (*s != '0')))
+		prec = (prec > n + 1) ? prec : (n + 1);
+	else if((spec->conv != 'o') && (spec->conv != 'u') && (spec->flags & FMT_ALT) && (n > 0) && ((n > 1) || (*s != '0')))
+		pre[0] = '0', pre[1] = (spec->conv == 'X') ? 'X' : 'x';
+
+	if(spec->prec >= 0)
+		spec->flags &= ~FMT_ZERO;
+
+	prec = (prec > n) ? (prec - n) : 0;
+	fmt_lead(out, spec, pre, strlen(pre) + prec + n);
+	fmt_fill(out, '0', prec);
+	fmt_put(out, s, n);
+	fmt_trail(out, spec, strlen(pre) + prec + n);
+}
+
+/**
+ * Format a string for the s conversion.
+ *   @out: The output.
+ *   @spec: The specification.
+ *   @str: The string.
+ */
+
+static void fmt_str(struct fmt_t *out, struct spec_t *spec, const char *str)
+{
+	int n;
+	const char *end;
+
+	/* a precision bounds the read, so the string need not end */
+
+	if(spec->prec < 0)
+		n = strlen(str);
+	else
+		end = memchr(str, '\0', spec->prec), n = (end != NULL) ? (end - str) : spec->prec;
+
+	spec->flags &= ~FMT_ZERO;
+	fmt_lead(out, spec, "", n);
+	fmt_put(out, str, n);
+	fmt_trail(out, spec, n);
+}
+
+/**
+ * Format one conversion with the C library's vsnprintf, for the arguments
+ * Errol does not format itself. A failed conversion, such as a wide string
+ * that cannot be encoded, fails the whole output as in the C library.
+ *   @out: The output.
+ *   @spec: The specification.
+ *   @mod: The length modifier.
+ *   @...: The argument.
+ */
+
+static void fmt_defer(struct fmt_t *out, const struct spec_t *spec, const char *mod, ...)
+{
+	int len;
+	char fmt[40], tmp[512], *p = fmt, *str = tmp;
+	va_list args;
+
+	*p++ = '%';
+	for(int i = 0; i < 5; i++) {
+		if(spec->flags & (FMT_LEFT << i))
+			*p++ = "-+ #0"[i];
+	}
+
+	if(spec->width > 0)
+		p = u32toa(spec->width, p);
+
+	if(spec->prec >= 0)
+		*p++ = '.', p = u32toa(spec->prec, p);
+
+	memcpy(p, mod, strlen(mod));
+	p += strlen(mod);
+	*p++ = spec->conv;
+	*p = '\0';
+
+	va_start(args, mod);
+	len = vsnprintf(tmp, sizeof(tmp), fmt, args);
+	va_end(args);
+
+	if(len >= (int)sizeof(tmp)) {
+		str = malloc(len + 1);
+		if(str != NULL) {
+			va_start(args, mod);
+			vsnprintf(str, len + 1, fmt, args);
+			va_end(args);
+		}
+	}
+
+	if((len < 0) || (str == NULL))
+		out->fail = true;
+	else
+		fmt_put(out, str, len);
+
+	if(str != tmp)
+		free(str);
+}
+
+/**
+ * Check if a format uses the POSIX grouping flag or positional arguments,
+ * which Errol leaves to the C library.
+ *   @fmt: The format.
+ *   &returns: True if the format uses either.
+ */
+
+static bool fmt_posix(const char *fmt)
+{
+	size_t n;
+	const char *p;
+
+	while((fmt = strchr(fmt, '%')) != NULL) {
+		if(*++fmt == '%') {
+			fmt++;
+			continue;
+		}
+
+		for(p = fmt; (*p >= '0') && (*p <= '9'); p++)
+			;
+
+		if((p > fmt) && (*p == '$'))
+			return true;
+
+		n = strspn(fmt, "-+ #0'");
+		if(memchr(fmt, '\'', n) != NULL)
+			return true;
+
+		fmt += n;
+	}
+
+	return false;
+}
+
+/**
+ * Format a double for the e, E, f, F, g, G, a, and A conversions.
+ *   @out: The output.
+ *   @spec: The specification.
+ *   @val: The value.
+ */
+
+static void fmt_float(struct fmt_t *out, struct spec_t *spec, double val)
+{
+	bool sci, upper = (spec->conv >= 'A') && (spec->conv <= 'Z');
+	int i, e, k, n, len, prec, alt = (spec->flags & FMT_ALT) ? 1 : 0;
+	char pre[2] = "", dig[ERR_EXACT_LEN + 1], exp[16];
+
+	pre[0] = signbit(val) ? '-' : ((spec->flags & FMT_PLUS) ? '+' : ((spec->flags & FMT_SPACE) ? ' ' : '\0'));
+	val = fabs(val);
+
+	if(!isfinite(val)) {
+		spec->flags &= ~FMT_ZERO;
+		len = strlen(pre) + 3;
+		fmt_lead(out, spec, pre, len);
+		fmt_put(out, isnan(val) ? (upper ? "NAN" : "nan") : (upper ? "INF" : "inf"), 3);
+		fmt_trail(out, spec, len);
+
+		return;
+	}
+	else if((spec->conv | 0x20) == 'a') {
+		fmt_hex(out, spec, val, pre);
+
+		return;
+	}
+
+	/* the digits 0.s * 10^e, with k significant digits and zeros past them */
+
+	prec = (spec->prec >= 0) ? spec->prec : 6;
+	k = 0, e = 1;
+	switch(spec->conv | 0x20) {
+	case 'e':
+		if(val != 0.0)
+			e = fmt_round(val, prec + 1, dig, &k);
+
+		sci = true;
+		break;
+
+	case 'f':
+		n = (val != 0.0) ? (fmt_exp(val) + prec) : -1;
+		if(n > 0)
+			e = fmt_round(val, n, dig, &k);
+		else if(n == 0) {
+			e = errol_dtoa_exact(val, dig) + 1;
+			if((dig[0] > '5') || ((dig[0] == '5') && (dig[1] != '\0')))
+				dig[0] = '1', k = 1;
+			else
+				e = 1;
+		}
+
+		sci = false;
+		break;
+
+	default:
+		prec = (prec > 0) ? prec : 1;
+		if(val != 0.0)
+			e = fmt_round(val, prec, dig, &k);
+
+		/* the exponent picks the notation, then trailing zeros go */
+
+		sci = (e - 1 >= prec) || (e - 1 < -4);
+		prec = sci ? (prec - 1) : (prec - e);
+		if(!alt)
+			prec = sci ? (k - 1) : (k - e);
+
+		prec = (prec > 0) ? prec : 0;
+		break;
+	}
+
+	/* lengths of the integer part, point, fraction, and exponent */
+
+	if(sci) {
+		exp[0] = upper ? 'E' : 'e';
+		exp[1] = ((k > 0) && (e <= 0)) ? '-' : '+';
+		i = (k > 0) ? ((e > 0) ? (e - 1) : (1 - e)) : 0;
+		if(i < 10)
+			exp[2] = '0', exp[3] = '0' + i, exp[4] = '\0';
+		else
+			*u32toa(i, exp + 2) = '\0';
+
+		len = 1 + strlen(exp);
+	}
+	else
+		len = (e > 0) ? e : 1;
+
+	len += strlen(pre) + ((prec > 0) || alt) + prec;
+	fmt_lead(out, spec, pre, len);
+
+	if(sci) {
+		fmt_put(out, (k > 0) ? dig : "0", 1);
+		n = 1;
+	}
+	else if(e > 0) {
+		fmt_put(out, dig, (k < e) ? k : e);
+		fmt_fill(out, '0', e - k);
+		n = e;
+	}
+	else {
+		fmt_put(out, "0", 1);
+		n = e;
+	}
+
+	if((prec > 0) || alt)
+		fmt_put(out, ".", 1);
+
+	/* the fraction holds digits n to n + prec, after any leading zeros */
+
+	i = (n < 0) ? ((-n < prec) ? -n : prec) : 0;
+	fmt_fill(out, '0', i);
+	if(n + prec > 0) {
+		int lo = (n > 0) ? n : 0, hi = (k < n + prec) ? k : (n + prec);
+
+		if(hi > lo)
+			fmt_put(out, dig + lo, hi - lo), i += hi - lo;
+	}
+
+	fmt_fill(out, '0', prec - i);
+
+	if(sci)
+		fmt_put(out, exp, strlen(exp));
+
+	fmt_trail(out, spec, len);
+}
+
+/**
+ * Format a finite double in hexadecimal for the a and A conversions.
+ *   @out: The output.
+ *   @spec: The specification.
+ *   @val: The magnitude.
+ *   @pre: The sign prefix.
+ */
+
+static void fmt_hex(struct fmt_t *out, struct spec_t *spec, double val, const char *pre)
+{
+	bool upper = (spec->conv == 'A');
+	int i, n, e, len, alt = (spec->flags & FMT_ALT) ? 1 : 0;
+	char pfx[4], dig[16], exp[16];
+	uint64_t m, rem, half;
+	const char *hex = upper ? "0123456789ABCDEF" : "0123456789abcdef";
+	errol_bits_t bits = { val };
+
+	m = bits.i & ((1ULL << 52) - 1);
+	e = (val == 0.0) ? 0 : (((bits.i >> 52) > 0) ? ((int)(bits.i >> 52) - 1023) : -1022);
+	dig[0] = ((bits.i >> 52) > 0) ? '1' : '0';
+
+	/* shortest digits, or rounded to even with the leading digit last at zero precision */
+
+	if(spec->prec < 0)
+		n = (m == 0) ? 0 : (13 - __builtin_ctzll(m) / 4);
+	else if(spec->prec < 13) {
+		n = spec->prec;
+		rem = m & ((1ULL << (52 - 4 * n)) - 1);
+		half = 1ULL << (51 - 4 * n);
+		m >>= 52 - 4 * n;
+		if((rem > half) || ((rem == half) && ((n > 0) ? (m & 0x1) : (dig[0] & 0x1))))
+			m++;
+
+		if(m >> (4 * n))
+			m = 0, dig[0]++;
+
+		m <<= 52 - 4 * n;
+	}
+	else
+		n = spec->prec;
+
+	for(i = 1; (i <= n) && (i <= 13); i++)
+		dig[i] = hex[(m >> (52 - 4 * i)) & 0xf];
+
+	exp[0] = upper ? 'P' : 'p';
+	exp[1] = (e < 0) ? '-' : '+';
+	*u32toa((e < 0) ? -e : e, exp + 2) = '\0';
+
+	i = 0;
+	if(pre[0] != '\0')
+		pfx[i++] = pre[0];
+
+	pfx[i++] = '0';
+	pfx[i++] = upper ? 'X' : 'x';
+	pfx[i] = '\0';
+
+	len = strlen(pfx) + 1 + ((n > 0) || alt) + n + strlen(exp);
+	fmt_lead(out, spec, pfx, len);
+	fmt_put(out, dig, 1);
+	if((n > 0) || alt)
+		fmt_put(out, ".", 1);
+
+	fmt_put(out, dig + 1, (n < 13) ? n : 13);
+	fmt_fill(out, '0', n - 13);
+	fmt_put(out, exp, strlen(exp));
+	fmt_trail(out, spec, len);
+}
+
+/**
+ * Decimal exponent of a positive double, n with the double in
+ * [10^(n-1), 10^n).
+ *   @val: The value.
+ *   &returns: The exponent.
+ */
+
+static int fmt_exp(double val)
+{
+	int q, z;
+	uint64_t m;
+	__uint128_t d;
+	errol_bits_t bits = { val };
+
+	m = bits.i & ((1ULL << 52) - 1);
+	q = ((bits.i >> 52) > 0) ? ((int)(bits.i >> 52) - 1075) : -1074;
+	if((bits.i >> 52) > 0)
+		m |= 1ULL << 52;
+
+	z = __builtin_ctzll(m);
+
+	return 1 - digits_scale(m >> z, q + z, 1, 1, &d);
+}
+
+/**
+ * Round a positive double to n significant digits, to nearest with ties
+ * to even, with trailing zeros removed.
+ *   @val: The value.
+ *   @n: The number of digits, at least one.
+ *   @dig: The digit buffer, at least ERR_EXACT_LEN bytes.
+ *   @k: Out. The number of digits kept.
+ *   &returns: The exponent e, with the result 0.s * 10^e.
+ */
+
+static int fmt_round(double val, int n, char *dig, int *k)
+{
+	int e, q;
+	bool up;
+	uint64_t m, c;
+	errol_bits_t bits = { val };
+
+	if(n <= 19) {
+		m = bits.i & ((1ULL << 52) - 1);
+		q = ((bits.i >> 52) > 0) ? ((int)(bits.i >> 52) - 1075) : -1074;
+		if((bits.i >> 52) > 0)
+			m |= 1ULL << 52;
+
+		c = round_digits(m, q, n, &e);
+		while((c % 10) == 0)
+			c /= 10, e++;
+
+		*k = u64toa(c, dig) - dig;
+
+		return e + *k;
+	}
+
+	/* past 19 digits, round the exact expansion */
+
+	e = errol_dtoa_exact(val, dig);
+	*k = strlen(dig);
+	if(*k <= n)
+		return e;
+
+	up = (dig[n] > '5') || ((dig[n] == '5') && ((*k > n + 1) || (dig[n - 1] & 0x1)));
+	for(*k = n; dig[*k - 1] == (up ? '9' : '0'); )
+		if(--*k == 0)
+			break;
+
+	if(*k == 0)
+		dig[0] = '1', *k = 1, e++;
+	else if(up)
+		dig[*k - 1]++;
+
+	return e;
+}
+
+/**
+ * Exactly scale an integer by 2^s 10^x and truncate it.
+ *   @b: The integer.
+ *   @s: The binary exponent.
+ *   @x: The decimal exponent.
+ *   @exact: Out. Set if the scaling was exact, unless null.
+ *   &returns: The truncated result.
+ */
+
+static uint64_t narrow_scale(uint64_t b, int s, int x, bool *exact)
+{
+	int i, sh = s + x;
+	uint64_t r[6] = { 0 }, p[2], res, pow64 = 1, base64 = 5;
+	__uint128_t pow = 1, base = 5, rem, prod;
+
+	/* a single word product suffices for 5^27 and below */
+
+	if((x >= 0) && (x <= 27) && (b < (1ULL << 56)) && (sh < 0)) {
+		for(i = x; i != 0; i >>= 1, base64 *= base64) {
+			if(i & 0x1)
+				pow64 *= base64;
 		}
+
+		prod = (__uint128_t)b * pow64;
+		if(exact != NULL)
+			*exact = (prod & ((((__uint128_t)1) << -sh) - 1)) == 0;
+
+		return prod >> -sh;
 	}
 
-	return i;
+	for(i = (x >= 0) ? x : -x; i != 0; i >>= 1, base *= base) {
+		if(i & 0x1)
+			pow *= base;
+	}
+
+	if(x < 0) {
+		assert(sh >= 0);
+
+		res = __udivmodti4((__uint128_t)b << sh, pow, &rem);
+		if(exact != NULL)
+			*exact = (rem == 0);
+
+		return res;
+	}
+
+	p[0] = (uint64_t)pow, p[1] = (uint64_t)(pow >> 64);
+	w_mul(r, &b, 1, p, 2);
+
+	if(sh >= 0) {
+		if(exact != NULL)
+			*exact = true;
+
+		return r[0] << sh;
+	}
+
+	res = w_shr(r, -sh);
+	if(exact != NULL) {
+		*exact = true;
+		for(i = 0; i < -sh; i += 64)
+			*exact &= ((-sh - i >= 64) ? r[i / 64] : (r[i / 64] & ((1ULL << (-sh - i)) - 1))) == 0;
+	}
+
+	return res;
+}
+
+/**
+ * Exactly scale an integer by a 13-word power of five and 2^-sh, and
+ * truncate it.
+ *   @pow: The power of five.
+ *   @b: The integer.
+ *   @sh: The shift amount.
+ *   @exact: Out. Set if the scaling was exact, unless null.
+ *   &returns: The truncated result.
+ */
+
+static uint64_t sub_scale(const uint64_t pow[static 13], uint64_t b, int sh, bool *exact)
+{
+	int i, k = sh / 64, j = sh % 64;
+	uint64_t r[14];
+
+	w_mul(r, pow, 13, &b, 1);
+
+	if(exact != NULL) {
+		*exact = (j == 0) || ((r[k] & ((1ULL << j) - 1)) == 0);
+		for(i = 0; i < k; i++)
+			*exact &= (r[i] == 0);
+	}
+
+	return (j == 0) ? r[k] : ((r[k] >> j) | (r[k+1] << (64 - j)));
+}
+
+/**
+ * Write the shortest decimal within a 64-bit integer interval, as in
+ * errolq_shortest().
+ *   @lo: The inclusive lower bound.
+ *   @mid2: Twice the midpoint, truncated.
+ *   @hi: The inclusive upper bound.
+ *   @tie: The digit position where the midpoint is an exact tie.
+ *   @buf: The output buffer.
+ *   &returns: The decimal exponent relative to the integer scale.
+ */
+
+static int narrow_shortest(uint64_t lo, uint64_t mid2, uint64_t hi, int tie, char *buf)
+{
+	int t;
+	char *p;
+
+	p = u64toa(narrow_pick(lo, mid2, hi, tie, &t), buf);
+	*p = '\0';
+
+	return t + (p - buf);
+}
+
+/**
+ * Pick the shortest decimal within a 64-bit integer interval. Kept out of
+ * line: inlined into fix_shortest, as in a static amalgamated copy, GCC
+ * emits code for it that runs at half speed.
+ *   @lo: The inclusive lower bound.
+ *   @mid2: Twice the midpoint, truncated.
+ *   @hi: The inclusive upper bound.
+ *   @tie: The digit position where the midpoint is an exact tie.
+ *   @t: Out. The number of trailing digits dropped.
+ *   &returns: The digits.
+ */
+
+static uint64_t narrow_pick(uint64_t lo, uint64_t mid2, uint64_t hi, int tie, int *t)
+{
+	int i;
+	uint64_t c, pow = 1;
+
+	*t = mismatch10(lo - 1, hi);
+	for(i = 0; i < *t; i++)
+		pow *= 10;
+
+	if(*t == tie) {
+		c = (mid2 + 1) / (2 * pow);
+		c += c & 0x1;
+	}
+	else {
+		c = mid2 / (2 * pow);
+		c += ((mid2 - c * 2 * pow) >= pow);
+	}
+
+	if(c < (lo + pow - 1) / pow)
+		c++;
+	else if(c > hi / pow)
+		c--;
+
+	return c;
+}
+
+
+/**
+ * Retrieve a power of ten as a 256-bit significand, truncated.
+ *   @x: The decimal exponent.
+ *   @w: The output significand.
+ *   @exp: The output binary exponent.
+ */
+
+static inline void pow10q(int x, uint64_t w[static 4], int *exp)
+{
+	int i, j, k, b, s;
+	uint64_t r[6];
+	const struct pow256_t *pow;
+
+	i = (x - LOOKUPQ_TABLE_MIN) / LOOKUPQ_TABLE_STEP;
+	j = (x - LOOKUPQ_TABLE_MIN) % LOOKUPQ_TABLE_STEP;
+	assert((x >= LOOKUPQ_TABLE_MIN) && (i < LOOKUPQ_TABLE_LEN));
+
+	pow = &lookupq_table[i];
+	if(j == 0) {
+		memcpy(w, pow->w, 4 * sizeof(uint64_t));
+		*exp = pow->exp;
+		return;
+	}
+
+	w_mul(r, pow->w, 4, lookupq_small[j], 2);
+
+	s = ((r[5] != 0) ? 383 - __builtin_clzll(r[5]) : 319 - __builtin_clzll(r[4])) - 255;
+	k = s / 64;
+	b = s % 64;
+
+	for(i = 0; i < 4; i++)
+		w[i] = (r[i+k] >> b) | (((b != 0) && (i + k + 1 < 6)) ? r[i+k+1] << (64 - b) : 0);
+
+	*exp = pow->exp + s;
+}
+
+/**
+ * Multiply two multi-word integers.
+ *   @r: The output, with room for na + nb words.
+ *   @a: The first integer, least significant word first.
+ *   @na: The number of words in a.
+ *   @b: The second integer, least significant word first.
+ *   @nb: The number of words in b.
+ */
+
+static inline void w_mul(uint64_t *r, const uint64_t *a, int na, const uint64_t *b, int nb)
+{
+	int i, j;
+
+	for(i = 0; i < na + nb; i++)
+		r[i] = 0;
+
+	for(i = 0; i < na; i++) {
+		uint64_t c = 0;
+
+		for(j = 0; j < nb; j++) {
+			__uint128_t t = (__uint128_t)a[i] * b[j] + r[i+j] + c;
+
+			r[i+j] = (uint64_t)t;
+			c = t >> 64;
+		}
+
+		r[i+nb] = c;
+	}
+}
+
+/**
+ * Shift a six-word integer right, keeping the low 128 bits.
+ *   @r: The integer.
+ *   @sh: The shift amount.
+ *   &returns: The shifted integer.
+ */
+
+static inline __uint128_t w_shr(const uint64_t r[static 6], int sh)
+{
+	int k = sh / 64, b = sh % 64;
+	__uint128_t v;
+	uint64_t ex;
+
+	assert((sh >= 0) && (k + 1 < 6));
+
+	v = r[k] | ((__uint128_t)r[k+1] << 64);
+	ex = (k + 2 < 6) ? r[k+2] : 0;
+	if(b != 0)
+		v = (v >> b) | ((__uint128_t)ex << (128 - b));
+
+	return v;
+}
+
+/**
+ * Multiply an integer by a 128-bit power of ten and shift the 192-bit
+ * product right.
+ *   @pow: The power of ten.
+ *   @b: The integer.
+ *   @sh: The shift amount, between 64 and 127.
+ *   &returns: The shifted product.
+ */
+
+static inline uint64_t fix_mul(const struct pow128_t *pow, uint64_t b, int sh)
+{
+	__uint128_t lo, hi;
+
+	assert((sh >= 64) && (sh < 128));
+
+	lo = (__uint128_t)pow->w[0] * b;
+	hi = (__uint128_t)pow->w[1] * b + (uint64_t)(lo >> 64);
+
+	return (uint64_t)(hi >> (sh - 64));
+}
+
+/**
+ * Find the highest decimal digit position where two 128-bit integers
+ * differ, as in mismatch10().
+ *   @a: Integer a.
+ *   @b: Integer b.
+ *   &returns: An index within [0, 39).
+ */
+
+static inline int mismatch10q(__uint128_t a, __uint128_t b)
+{
+	__uint128_t ar, br, pow19 = (__uint128_t)1e19;
+	uint64_t af, bf;
+
+	af = __udivmodti4(a, pow19, &ar);
+	bf = __udivmodti4(b, pow19, &br);
+	if(af != bf)
+		return 19 + mismatch10(af, bf);
+
+	return mismatch10(ar, br);
+}
+
+/**
+ * Check if the boundary b * 2^s * 10^x is an integer. Wherever it may be one,
+ * the boundaries lie on a grid far coarser than the 2^-131 error of the
+ * scaled boundaries, so only exact integers need their truncation undone.
+ *   @b: The odd numerator.
+ *   @s: The binary exponent.
+ *   @x: The decimal exponent.
+ *   &returns: True if an integer.
+ */
+
+static bool errolq_exact(__uint128_t b, int s, int x)
+{
+	__uint128_t pow = 1;
+
+	if(s + x < 0)
+		return false;
+	else if(x >= 0)
+		return true;
+	else if(x < -49)
+		return false;
+
+	for(int i = x; i < 0; i++)
+		pow *= 5;
+
+	return (b % pow) == 0;
+}
+
+/**
+ * Find the decimal digit position where the value m * 2^q * 10^x lies
+ * exactly halfway between two integer multiples of the power of ten.
+ *   @m: The significand.
+ *   @q: The binary exponent.
+ *   @x: The decimal exponent.
+ *   &returns: The position, or negative if the value is never a tie.
+ */
+
+static int errolq_tie(__uint128_t m, int q, int x)
+{
+	int z, t;
+	__uint128_t pow = 1;
+
+	z = ((uint64_t)m != 0) ? __builtin_ctzll(m) : 64 + __builtin_ctzll(m >> 64);
+	t = z + q + 1 + x;
+	if((t < 0) || (t - x > 48))
+		return -1;
+
+	for(int i = x; i < t; i++)
+		pow *= 5;
+
+	return ((m >> z) % pow == 0) ? t : -1;
+}
+
+/**
+ * Write the shortest decimal within an integer interval, choosing the
+ * candidate nearest to the midpoint.
+ *   @lo: The inclusive lower bound.
+ *   @mid2: Twice the midpoint, truncated.
+ *   @hi: The inclusive upper bound.
+ *   @tie: The digit position where the midpoint is an exact tie.
+ *   @buf: The output buffer.
+ *   &returns: The decimal exponent relative to the integer scale.
+ */
+
+static int errolq_shortest(__uint128_t lo, __uint128_t mid2, __uint128_t hi, int tie, char *buf)
+{
+	int t;
+	char *p;
+	__uint128_t c, rem, pow = 1, pow19 = (__uint128_t)1e19;
+
+	t = mismatch10q(lo - 1, hi);
+	for(int i = 0; i < t; i++)
+		pow *= 10;
+
+	if(t == tie) {
+		c = __udivmodti4(mid2 + 1, 2 * pow, NULL);
+		c += c & 0x1;
+	}
+	else {
+		c = __udivmodti4(mid2, 2 * pow, &rem);
+		c += (rem >= pow);
+	}
+
+	if(c < __udivmodti4(lo + pow - 1, pow, NULL))
+		c++;
+	else if(c > __udivmodti4(hi, pow, NULL))
+		c--;
+
+	if(c >= pow19) {
+		p = u64toa(__udivmodti4(c, pow19, &rem), buf);
+		for(int i = 18; i >= 0; i--, rem /= 10)
+			p[i] = '0' + (uint64_t)rem % 10;
+		p += 19;
+	}
+	else
+		p = u64toa(c, buf);
+
+	*p = '\0';
+
+	return t + (p - buf);
+}
+
+/**
+ * Write the decimal with the fewest significant digits within an integer
+ * interval, choosing the candidate nearest to the midpoint with ties going
+ * to the larger. Each decade of the interval holds its own shortest
+ * candidates, so the decades are compared.
+ *   @lo: The inclusive lower bound, positive.
+ *   @hi: The inclusive upper bound, below 10^37.
+ *   @buf: The output buffer.
+ *   &returns: The decimal exponent relative to the integer scale.
+ */
+
+static int range_shortest(__uint128_t lo, __uint128_t hi, char *buf)
+{
+	int d, t, len, blen = 64, bt = 0;
+	char *p;
+	__uint128_t a, b, c, dec, pow, rem, dist, mid2 = lo + hi, pow19 = (__uint128_t)1e19;
+	__uint128_t bc = 0, bdist = 0;
+
+	for(d = 0, dec = 1; dec <= hi; d++, dec *= 10) {
+		if(10 * dec <= lo)
+			continue;
+
+		/* within the decade, the multiples of 10^t are the shortest */
+
+		a = (lo > dec) ? lo : dec;
+		b = (hi < 10 * dec - 1) ? hi : (10 * dec - 1);
+		t = (a == dec) ? d : mismatch10q(a - 1, b);
+		len = d - t + 1;
+		if(len > blen)
+			continue;
+
+		pow = 1;
+		for(int i = 0; i < t; i++)
+			pow *= 10;
+
+		c = __udivmodti4(mid2, 2 * pow, &rem);
+		c += (rem >= pow);
+		if(c < __udivmodti4(a + pow - 1, pow, NULL))
+			c = __udivmodti4(a + pow - 1, pow, NULL);
+		else if(c > __udivmodti4(b, pow, NULL))
+			c = __udivmodti4(b, pow, NULL);
+
+		dist = (2 * c * pow > mid2) ? (2 * c * pow - mid2) : (mid2 - 2 * c * pow);
+		if((len < blen) || (dist <= bdist))
+			blen = len, bt = t, bc = c, bdist = dist;
+	}
+
+	if(bc >= pow19) {
+		p = u64toa(__udivmodti4(bc, pow19, &rem), buf);
+		for(int i = 18; i >= 0; i--, rem /= 10)
+			p[i] = '0' + (uint64_t)rem % 10;
+		p += 19;
+	}
+	else
+		p = u64toa(bc, buf);
+
+	*p = '\0';
+
+	return bt + (p - buf);
 }
@@ -9,6 +9,8 @@ extern "C" {
  * common headers
  */
 
+#include <stdarg.h>
+#include <stddef.h>
 #include <stdint.h>
 
 /*
@@ -17,17 +19,61 @@ extern "C" {
 
 #define ERR_LEN   512
 #define ERR_DEPTH 4
+#define ERR_EXACT_LEN 768
+#define ERR_KEY_LEN 24
+#define ERR_JSON_LEN 32
+#define ERR_WIDTH_LEFT  0x1
+#define ERR_WIDTH_ROUND 0x2
+#define ERR_NONFINITE INT16_MIN
 
-int errol0_dtoa(double val, char *buf);
-int errol1_dtoa(double val, char *buf, bool *opt);
-int errol2_dtoa(double val, char *buf, bool *opt);
-int errol3_dtoa(double val, char *buf);
-int errol3u_dtoa(double val, char *buf);
-int errol4_dtoa(double val, char *buf);
-int errol4u_dtoa(double val, char *buf);
+/*
+ * ERRDEF prefixes the declarations. The amalgamated errol_all.h defines
+ * it as `static inline` under ERROL_STATIC, giving each includer its own
+ * inlinable copy.
+ */
+
+#ifndef ERRDEF
+#define ERRDEF
+#endif
 
-int errol_int(double val, char *buf);
-int errol_fixed(double val, char *buf);
+ERRDEF int errol0_dtoa(double val, char *buf);
+ERRDEF int errol1_dtoa(double val, char *buf, bool *opt);
+ERRDEF int errol2_dtoa(double val, char *buf, bool *opt);
+ERRDEF int errol3_dtoa(double val, char *buf);
+ERRDEF int errol3u_dtoa(double val, char *buf);
+ERRDEF int errol4_dtoa(double val, char *buf);
+ERRDEF int errol4u_dtoa(double val, char *buf);
+ERRDEF int errol5_dtoa(double val, char *buf);
+ERRDEF int errol6_dtoa(double val, char *buf);
+ERRDEF int errol3f_dtoa(double val, char *buf);
+
+ERRDEF int errol_int(double val, char *buf);
+ERRDEF int errol_fixed(double val, char *buf);
+ERRDEF int errol_small(double val, char *buf);
+ERRDEF int errol_subnormal(double val, char *buf);
+
+ERRDEF int errol_ftoa(float val, char *buf);
+#ifdef __SIZEOF_FLOAT128__
+ERRDEF int errolq_dtoa(__float128 val, char *buf);
+#endif
+ERRDEF int errol_ldtoa(long double val, char *buf);
+
+ERRDEF int errol_shortest_in(double lo, double hi, char *buf);
+ERRDEF int errol_dtoa_tol(double val, double tol, char *buf);
+ERRDEF int errol_dtoa_up(double val, char *buf);
+ERRDEF int errol_dtoa_down(double val, char *buf);
+ERRDEF int errol_dtoa_exact(double val, char *buf);
+ERRDEF int errol_sortkey(double val, char *buf);
+ERRDEF double errol_sortkey_decode(const char *key);
+ERRDEF uint64_t errol_to_decimal64_bid(double val, bool shortest);
+ERRDEF int errol_json_dtoa(double val, char *buf);
+ERRDEF uint64_t errol_digits(double val, int *exp);
+ERRDEF int errol_dtoa_width(double val, int width, int flags, char *buf);
+ERRDEF int errol_snprintf(char *buf, size_t size, const char *fmt, ...);
+ERRDEF int errol_vsnprintf(char *buf, size_t size, const char *fmt, va_list args);
+
+ERRDEF int errol_h_dtoa(uint16_t val, char *buf);
+ERRDEF int errol_bf16_dtoa(uint16_t val, char *buf);
 
 struct errol_err_t {
 	double val;
@@ -40,11 +86,59 @@ struct errol_slab_t {
 	int exp;
 };
 
+ERRDEF void errol_h_dtoa_n(const uint16_t *val, size_t n, struct errol_slab_t *out);
+ERRDEF void errol_bf16_dtoa_n(const uint16_t *val, size_t n, struct errol_slab_t *out);
+
+struct errol_memo_t {
+	uint64_t key;
+	struct errol_slab_t slab;
+};
+
+struct errol_cache_t {
+	unsigned int bits;
+	uint64_t hits, misses;
+	struct errol_memo_t *memo;
+};
+
+ERRDEF struct errol_cache_t *errol_cache_new(unsigned int bits);
+ERRDEF void errol_cache_delete(struct errol_cache_t *cache);
+ERRDEF void errol_cache_select(struct errol_cache_t *cache);
+ERRDEF int errol3c_dtoa(double val, char *buf);
+
+struct errol_seq_t {
+	uint64_t key;
+	int exp;
+	double lten, gap;
+};
+
+ERRDEF void errol_seq_init(struct errol_seq_t *seq);
+ERRDEF int errol_seq_dtoa(struct errol_seq_t *seq, double val, char *buf);
+
 typedef union {
 	double d;
 	uint64_t i;
 } errol_bits_t;
 
+typedef union {
+	float f;
+	uint32_t i;
+} errol_fbits_t;
+
+#ifdef __SIZEOF_FLOAT128__
+typedef union {
+	__float128 q;
+	__uint128_t i;
+} errol_qbits_t;
+#endif
+
+typedef union {
+	long double ld;
+	struct {
+		uint64_t m;
+		uint16_t exp;
+	} s;
+} errol_ldbits_t;
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,382 @@
+#ifndef ERROL_HPP
+#define ERROL_HPP
+
+/*
+ * common headers
+ */
+
+#include <cstdint>
+#include <ios>
+#include <iterator>
+#include <locale>
+#include <ostream>
+#include <vector>
+#include "errol.h"
+
+/*
+ * errol stream and character-type declarations
+ */
+
+namespace errol {
+
+/**
+ * Format a double as num_put does in the classic locale, building the
+ * printf conversion from the stream flags and precision. As in
+ * libstdc++, fixed ignores uppercase there.
+ *   @buf: The output buffer.
+ *   @size: The buffer size.
+ *   @str: The stream state.
+ *   @val: The value.
+ *   &returns: The length of the full output.
+ */
+
+inline int stream_format(char *buf, size_t size, const std::ios_base &str, double val)
+{
+	char fmt[8], *f = fmt;
+	std::ios_base::fmtflags flags = str.flags(), field = flags & std::ios_base::floatfield;
+#ifdef __GLIBCXX__
+	bool fixed_upper = false;
+#else
+	bool fixed_upper = (flags & std::ios_base::uppercase);
+#endif
+
+	*f++ = '%';
+	if(flags & std::ios_base::showpos)
+		*f++ = '+';
+
+	if(flags & std::ios_base::showpoint)
+		*f++ = '#';
+
+	/* fixed and scientific together mean hexadecimal, without a precision */
+
+	if(field == (std::ios_base::fixed | std::ios_base::scientific)) {
+		*f++ = (flags & std::ios_base::uppercase) ? 'A' : 'a';
+		*f = '\0';
+
+		return errol_snprintf(buf, size, fmt, val);
+	}
+
+	*f++ = '.';
+	*f++ = '*';
+	if(field == std::ios_base::fixed)
+		*f++ = fixed_upper ? 'F' : 'f';
+	else if(field == std::ios_base::scientific)
+		*f++ = (flags & std::ios_base::uppercase) ? 'E' : 'e';
+	else
+		*f++ = (flags & std::ios_base::uppercase) ? 'G' : 'g';
+
+	*f = '\0';
+
+	return errol_snprintf(buf, size, fmt, (int)str.precision(), val);
+}
+
+/**
+ * Write formatted characters with the stream width, fill, and
+ * adjustment, resetting the width.
+ *   @out: The output iterator.
+ *   @str: The stream state.
+ *   @fill: The fill character.
+ *   @ct: The character conversion facet.
+ *   @buf: The formatted characters.
+ *   @len: The number of characters.
+ *   &returns: The output iterator past the written characters.
+ */
+
+template<class CharT, class OutputIt>
+OutputIt stream_write(OutputIt out, std::ios_base &str, CharT fill, const std::ctype<CharT> &ct, const char *buf, int len)
+{
+	int i, split = 0;
+	std::streamsize pad = (str.width() > len) ? (str.width() - len) : 0;
+	std::ios_base::fmtflags adjust = str.flags() & std::ios_base::adjustfield;
+
+	/* internal padding goes after a sign, or else after a base prefix */
+
+	if(adjust == std::ios_base::internal) {
+		if((buf[0] == '+') || (buf[0] == '-'))
+			split = 1;
+		else if((buf[0] == '0') && ((buf[1] == 'x') || (buf[1] == 'X')))
+			split = 2;
+	}
+	else if(adjust != std::ios_base::left)
+		for(; pad > 0; pad--)
+			*out++ = fill;
+
+	for(i = 0; i < split; i++)
+		*out++ = ct.widen(buf[i]);
+
+	if(adjust == std::ios_base::internal)
+		for(; pad > 0; pad--)
+			*out++ = fill;
+
+	for(; i < len; i++)
+		*out++ = ct.widen(buf[i]);
+
+	for(; pad > 0; pad--)
+		*out++ = fill;
+
+	str.width(0);
+
+	return out;
+}
+
+/**
+ * Numeric output facet formatting doubles with Errol. Imbuing a stream
+ * with it speeds up `os << double` without changing call sites:
+ *
+ *   os.imbue(std::locale(os.getloc(), new errol::num_put<char>));
+ *
+ * Locales with a decimal point other than '.' or with digit grouping,
+ * and long doubles, fall back to std::num_put.
+ */
+
+template<class CharT, class OutputIt = std::ostreambuf_iterator<CharT>>
+class num_put : public std::num_put<CharT, OutputIt> {
+public:
+	typedef CharT char_type;
+	typedef OutputIt iter_type;
+
+	explicit num_put(size_t refs = 0) : std::num_put<CharT, OutputIt>(refs) { }
+
+protected:
+	using std::num_put<CharT, OutputIt>::do_put;
+
+	/**
+	 * Format a double.
+	 *   @out: The output iterator.
+	 *   @str: The stream state.
+	 *   @fill: The fill character.
+	 *   @val: The value.
+	 *   &returns: The output iterator past the written characters.
+	 */
+
+	iter_type do_put(iter_type out, std::ios_base &str, char_type fill, double val) const override
+	{
+		int len;
+		char buf[512];
+		const std::ctype<CharT> &ct = std::use_facet<std::ctype<CharT>>(str.getloc());
+		const std::numpunct<CharT> &np = std::use_facet<std::numpunct<CharT>>(str.getloc());
+
+		if((np.decimal_point() != ct.widen('.')) || !np.grouping().empty())
+			return std::num_put<CharT, OutputIt>::do_put(out, str, fill, val);
+
+		len = stream_format(buf, sizeof(buf), str, val);
+		if(len < (int)sizeof(buf))
+			return stream_write(out, str, fill, ct, buf, len);
+
+		std::vector<char> big(len + 1);
+		stream_format(big.data(), big.size(), str, val);
+
+		return stream_write(out, str, fill, ct, big.data(), len);
+	}
+};
+
+/**
+ * Manipulator value for put_double.
+ *   @val: The value.
+ */
+
+struct put_double_t {
+	double val;
+};
+
+/**
+ * Manipulator formatting a double with Errol under the stream flags,
+ * precision, width, and fill, but ignoring the locale: `os <<
+ * errol::put_double(x)` needs no imbued facet.
+ *   @val: The value.
+ *   &returns: The manipulator.
+ */
+
+inline put_double_t put_double(double val)
+{
+	return put_double_t{ val };
+}
+
+/**
+ * Write a double from the put_double manipulator.
+ *   @os: The stream.
+ *   @put: The manipulator.
+ *   &returns: The stream.
+ */
+
+template<class CharT, class Traits>
+std::basic_ostream<CharT, Traits> &operator<<(std::basic_ostream<CharT, Traits> &os, put_double_t put)
+{
+	int len;
+	char buf[512];
+	typename std::basic_ostream<CharT, Traits>::sentry sentry(os);
+
+	if(!sentry)
+		return os;
+
+	std::ostreambuf_iterator<CharT, Traits> out(os);
+	const std::ctype<CharT> &ct = std::use_facet<std::ctype<CharT>>(os.getloc());
+
+	len = stream_format(buf, sizeof(buf), os, put.val);
+	if(len < (int)sizeof(buf))
+		out = stream_write(out, os, os.fill(), ct, buf, len);
+	else {
+		std::vector<char> big(len + 1);
+
+		stream_format(big.data(), big.size(), os, put.val);
+		out = stream_write(out, os, os.fill(), ct, big.data(), len);
+	}
+
+	if(out.failed())
+		os.setstate(std::ios_base::badbit);
+
+	return os;
+}
+
+/**
+ * Digit pairs "00" to "99" in a character type, laid out as cDigitsLut.
+ *   @pair: The digit pairs.
+ */
+
+template<class CharT>
+struct digits_lut {
+	CharT pair[200];
+
+	digits_lut()
+	{
+		for(int i = 0; i < 100; i++)
+			pair[2 * i] = CharT('0' + i / 10), pair[2 * i + 1] = CharT('0' + i % 10);
+	}
+};
+
+/**
+ * Retrieve the digit pairs of a character type, widened once on first use.
+ *   &returns: The digit pairs.
+ */
+
+template<class CharT>
+const CharT *digit_pairs()
+{
+	static const digits_lut<CharT> lut;
+
+	return lut.pair;
+}
+
+/**
+ * Write an integer in a character type, two digits at a time.
+ *   @val: The value.
+ *   @buf: The output buffer, at least 20 characters.
+ *   &returns: The end of the digits.
+ */
+
+template<class CharT>
+CharT *u64tos(uint64_t val, CharT *buf)
+{
+	int n = 1;
+	CharT *p;
+	const CharT *lut = digit_pairs<CharT>();
+
+	for(uint64_t t = 10; (n < 20) && (val >= t); t *= 10)
+		n++;
+
+	for(p = buf + n; val >= 100; val /= 100) {
+		const CharT *d = lut + 2 * (val % 100);
+
+		*--p = d[1];
+		*--p = d[0];
+	}
+
+	if(val >= 10)
+		p[-1] = lut[2 * val + 1], p[-2] = lut[2 * val];
+	else
+		p[-1] = CharT('0' + val);
+
+	return buf + n;
+}
+
+/**
+ * Shortest double to digits in a character type, as errol6_dtoa but
+ * without the char intermediate.
+ *   @val: The value, finite and nonzero. The sign is ignored.
+ *   @buf: The output buffer, at least 18 characters.
+ *   &returns: The exponent e, with the value 0.s * 10^e.
+ */
+
+template<class CharT>
+int dtoa(double val, CharT *buf)
+{
+	int exp;
+	CharT *p = u64tos(errol_digits(val, &exp), buf);
+
+	*p = CharT('\0');
+
+	return exp + (p - buf);
+}
+
+/**
+ * Double to ECMAScript Number::toString text in a character type, as
+ * errol_json_dtoa but without the char intermediate.
+ *   @val: The value.
+ *   @buf: The output buffer, at least ERR_JSON_LEN characters.
+ *   &returns: The length of the text.
+ */
+
+template<class CharT>
+int json_dtoa(double val, CharT *buf)
+{
+	int i, k, n;
+	CharT dig[20], *p = buf;
+
+	if((val != val) || (val - val != 0.0)) {
+		for(i = 0; i < 4; i++)
+			buf[i] = CharT("null"[i]);
+
+		return buf[4] = CharT('\0'), 4;
+	}
+	else if(val == 0.0)
+		return buf[0] = CharT('0'), buf[1] = CharT('\0'), 1;
+
+	if(val < 0.0)
+		*p++ = CharT('-');
+
+	/* digits s with value s * 10^(n - k) */
+
+	k = u64tos(errol_digits(val, &n), dig) - dig;
+	n += k;
+
+	if((k <= n) && (n <= 21)) {
+		for(i = 0; i < n; i++)
+			*p++ = (i < k) ? dig[i] : CharT('0');
+	}
+	else if((0 < n) && (n <= 21)) {
+		for(i = 0; i < n; i++)
+			*p++ = dig[i];
+
+		for(*p++ = CharT('.'); i < k; i++)
+			*p++ = dig[i];
+	}
+	else if((-6 < n) && (n <= 0)) {
+		*p++ = CharT('0');
+		*p++ = CharT('.');
+		for(i = n; i < 0; i++)
+			*p++ = CharT('0');
+
+		for(i = 0; i < k; i++)
+			*p++ = dig[i];
+	}
+	else {
+		*p++ = dig[0];
+		if(k > 1) {
+			*p++ = CharT('.');
+			for(i = 1; i < k; i++)
+				*p++ = dig[i];
+		}
+
+		*p++ = CharT('e');
+		*p++ = (n > 0) ? CharT('+') : CharT('-');
+		p = u64tos((n > 0) ? (n - 1) : (1 - n), p);
+	}
+
+	*p = CharT('\0');
+
+	return p - buf;
+}
+
+}
+
+#endif
@@ -20,7 +20,7 @@
 
 #include <stdint.h>
 
-const char cDigitsLut[200] = {
+static const char cDigitsLut[200] = {
 	'0', '0', '0', '1', '0', '2', '0', '3', '0', '4', '0', '5', '0', '6',
 	'0', '7', '0', '8', '0', '9', '1', '0', '1', '1', '1', '2', '1', '3',
 	'1', '4', '1', '5', '1', '6', '1', '7', '1', '8', '1', '9', '2', '0',
@@ -38,7 +38,7 @@ const char cDigitsLut[200] = {
 	'9', '8', '9', '9'
 };
 
-inline char *u32toa(uint32_t value, char *buffer)
+static inline char *u32toa(uint32_t value, char *buffer)
 {
 	if (value < 10000)
 	{
@@ -115,7 +115,7 @@ inline char *u32toa(uint32_t value, char *buffer)
 	return buffer;
 }
 
-inline char *u64toa(uint64_t value, char *buffer)
+static inline char *u64toa(uint64_t value, char *buffer)
 {
 	const uint64_t kTen8 = 100000000;
 	const uint64_t kTen9 = kTen8 * 10;
@@ -0,0 +1,8052 @@
+static const uint32_t lookuph_table[0x7C00] = {
+	0x00000000, 0x000006f9, 0x000001fa, 0x000002fa, 0x000018fa, 0x000003fa, 0x000024fa, 0x000004fa,
+	0x000005fa, 0x000036fa, 0x000006fa, 0x000042fa, 0x000007fa, 0x000008fa, 0x000053fa, 0x000009fa,
+	0x00005ffa, 0x000001fb, 0x00000bfb, 0x000071fb, 0x00000cfb, 0x00007dfb, 0x00000dfb, 0x00000efb,
+	0x00008ffb, 0x00000ffb, 0x00009bfb, 0x000010fb, 0x0000a7fb, 0x000011fb, 0x000012fb, 0x0000b9fb,
+	0x000013fb, 0x0000c5fb, 0x000002fb, 0x000015fb, 0x0000d7fb, 0x000016fb, 0x0000e2fb, 0x000017fb,
+	0x000018fb, 0x0000f4fb, 0x000019fb, 0x000100fb, 0x00001afb, 0x00001bfb, 0x000112fb, 0x00001cfb,
+	0x00011efb, 0x00001dfb, 0x000003fb, 0x000130fb, 0x00001ffb, 0x00013cfb, 0x000020fb, 0x000021fb,
+	0x00014efb, 0x000022fb, 0x00015afb, 0x000023fb, 0x000024fb, 0x00016cfb, 0x000025fb, 0x000178fb,
+	0x000026fb, 0x000027fb, 0x000189fb, 0x000004fb, 0x000195fb, 0x000029fb, 0x00002afb, 0x0001a7fb,
+	0x00002bfb, 0x0001b3fb, 0x00002cfb, 0x00002dfb, 0x0001c5fb, 0x00002efb, 0x0001d1fb, 0x00002ffb,
+	0x0001ddfb, 0x000030fb, 0x000031fb, 0x0001effb, 0x000005fb, 0x0001fbfb, 0x000033fb, 0x000034fb,
+	0x00020dfb, 0x000035fb, 0x000218fb, 0x000036fb, 0x000037fb, 0x00022afb, 0x000038fb, 0x000236fb,
+	0x000039fb, 0x00003afb, 0x000248fb, 0x00003bfb, 0x000254fb, 0x000006fb, 0x00003dfb, 0x000266fb,
+	0x00003efb, 0x000272fb, 0x00003ffb, 0x000040fb, 0x000284fb, 0x000041fb, 0x000290fb, 0x000042fb,
+	0x000043fb, 0x0002a2fb, 0x000044fb, 0x0002adfb, 0x000045fb, 0x000007fb, 0x0002bffb, 0x000047fb,
+	0x0002cbfb, 0x000048fb, 0x000049fb, 0x0002ddfb, 0x00004afb, 0x0002e9fb, 0x00004bfb, 0x0002f5fb,
+	0x00004cfb, 0x00004dfb, 0x000307fb, 0x00004efb, 0x000313fb, 0x00004ffb, 0x000008fb, 0x000325fb,
+	0x000051fb, 0x000331fb, 0x000052fb, 0x000053fb, 0x000342fb, 0x000054fb, 0x00034efb, 0x000055fb,
+	0x000056fb, 0x000360fb, 0x000057fb, 0x00036cfb, 0x000058fb, 0x000059fb, 0x00037efb, 0x000009fb,
+	0x00038afb, 0x00005bfb, 0x00005cfb, 0x00039cfb, 0x00005dfb, 0x0003a8fb, 0x00005efb, 0x00005ffb,
+	0x0003bafb, 0x000060fb, 0x0003c6fb, 0x000061fb, 0x000062fb, 0x0003d7fb, 0x000063fb, 0x0003e3fb,
+	0x000001fc, 0x000065fc, 0x0003f5fc, 0x000066fc, 0x000401fc, 0x000067fc, 0x000068fc, 0x000413fc,
+	0x000069fc, 0x00041ffc, 0x00006afc, 0x00042bfc, 0x00006bfc, 0x00006cfc, 0x00043dfc, 0x00006dfc,
+	0x000449fc, 0x00000bfc, 0x00006ffc, 0x00045bfc, 0x000070fc, 0x000467fc, 0x000071fc, 0x000072fc,
+	0x000478fc, 0x000073fc, 0x000484fc, 0x000074fc, 0x000075fc, 0x000496fc, 0x000076fc, 0x0004a2fc,
+	0x000077fc, 0x00000cfc, 0x0004b4fc, 0x000079fc, 0x0004c0fc, 0x00007afc, 0x00007bfc, 0x0004d2fc,
+	0x00007cfc, 0x0004defc, 0x00007dfc, 0x00007efc, 0x0004f0fc, 0x00007ffc, 0x0004fcfc, 0x000080fc,
+	0x000081fc, 0x00050dfc, 0x00000dfc, 0x000519fc, 0x000083fc, 0x000084fc, 0x00052bfc, 0x000085fc,
+	0x000537fc, 0x000086fc, 0x000087fc, 0x000549fc, 0x000088fc, 0x000555fc, 0x000089fc, 0x000561fc,
+	0x00008afc, 0x00008bfc, 0x000573fc, 0x00000efc, 0x00057ffc, 0x00008dfc, 0x00008efc, 0x000591fc,
+	0x00008ffc, 0x00059cfc, 0x000090fc, 0x000091fc, 0x0005aefc, 0x000092fc, 0x0005bafc, 0x000093fc,
+	0x000094fc, 0x0005ccfc, 0x000095fc, 0x0005d8fc, 0x00000ffc, 0x000097fc, 0x0005eafc, 0x000098fc,
+	0x0005f6fc, 0x000099fc, 0x00009afc, 0x000608fc, 0x00009bfc, 0x000614fc, 0x00009cfc, 0x00009dfc,
+	0x000626fc, 0x00009efc, 0x000631fc, 0x00009ffc, 0x000010fc, 0x000643fc, 0x0000a1fc, 0x00064ffc,
+	0x0000a2fc, 0x0000a3fc, 0x000661fc, 0x0000a4fc, 0x00066dfc, 0x0000a5fc, 0x000679fc, 0x0000a6fc,
+	0x0000a7fc, 0x00068bfc, 0x0000a8fc, 0x000697fc, 0x0000a9fc, 0x000011fc, 0x0006a9fc, 0x0000abfc,
+	0x0006b5fc, 0x0000acfc, 0x0000adfc, 0x0006c6fc, 0x0000aefc, 0x0006d2fc, 0x0000affc, 0x0000b0fc,
+	0x0006e4fc, 0x0000b1fc, 0x0006f0fc, 0x0000b2fc, 0x0000b3fc, 0x000702fc, 0x000012fc, 0x00070efc,
+	0x0000b5fc, 0x0000b6fc, 0x000720fc, 0x0000b7fc, 0x00072cfc, 0x0000b8fc, 0x0000b9fc, 0x00073efc,
+	0x0000bafc, 0x00074afc, 0x0000bbfc, 0x0000bcfc, 0x00075cfc, 0x0000bdfc, 0x000767fc, 0x000013fc,
+	0x0000bffc, 0x000779fc, 0x0000c0fc, 0x000785fc, 0x0000c1fc, 0x0000c2fc, 0x000797fc, 0x0000c3fc,
+	0x0007a3fc, 0x0000c4fc, 0x0007affc, 0x0000c5fc, 0x0000c6fc, 0x0007c1fc, 0x0000c7fc, 0x0007cdfc,
+	0x000002fc, 0x0000c9fc, 0x0007dffc, 0x0000cafc, 0x0007ebfc, 0x0000cbfc, 0x0000ccfc, 0x0007fcfc,
+	0x0000cdfc, 0x000808fc, 0x0000cefc, 0x0000cffc, 0x00081afc, 0x0000d0fc, 0x000826fc, 0x0000d1fc,
+	0x000015fc, 0x000838fc, 0x0000d3fc, 0x000844fc, 0x0000d4fc, 0x0000d5fc, 0x000856fc, 0x0000d6fc,
+	0x000862fc, 0x0000d7fc, 0x0000d8fc, 0x000874fc, 0x0000d9fc, 0x000880fc, 0x0000dafc, 0x0000dbfc,
+	0x000891fc, 0x000016fc, 0x00089dfc, 0x0000ddfc, 0x0000defc, 0x0008affc, 0x0000dffc, 0x0008bbfc,
+	0x0000e0fc, 0x0000e1fc, 0x0008cdfc, 0x0000e2fc, 0x0008d9fc, 0x0000e3fc, 0x0008e5fc, 0x0000e4fc,
+	0x0000e5fc, 0x0008f7fc, 0x000017fc, 0x000903fc, 0x0000e7fc, 0x0000e8fc, 0x000915fc, 0x0000e9fc,
+	0x000921fc, 0x0000eafc, 0x0000ebfc, 0x000932fc, 0x0000ecfc, 0x00093efc, 0x0000edfc, 0x0000eefc,
+	0x000950fc, 0x0000effc, 0x00095cfc, 0x000018fc, 0x0000f1fc, 0x00096efc, 0x0000f2fc, 0x00097afc,
+	0x0000f3fc, 0x0000f4fc, 0x00098cfc, 0x0000f5fc, 0x000998fc, 0x0000f6fc, 0x0000f7fc, 0x0009aafc,
+	0x0000f8fc, 0x0009b6fc, 0x0000f9fc, 0x000019fc, 0x0009c7fc, 0x0000fbfc, 0x0009d3fc, 0x0000fcfc,
+	0x0000fdfc, 0x0009e5fc, 0x0000fefc, 0x0009f1fc, 0x0000fffc, 0x000100fc, 0x000a03fc, 0x000101fc,
+	0x000a0ffc, 0x000102fc, 0x000a1bfc, 0x000103fc, 0x00001afc, 0x000a2dfc, 0x000105fc, 0x000a39fc,
+	0x000106fc, 0x000107fc, 0x000a4bfc, 0x000108fc, 0x000a56fc, 0x000109fc, 0x00010afc, 0x000a68fc,
+	0x00010bfc, 0x000a74fc, 0x00010cfc, 0x00010dfc, 0x000a86fc, 0x00001bfc, 0x000a92fc, 0x00010ffc,
+	0x000110fc, 0x000aa4fc, 0x000111fc, 0x000ab0fc, 0x000112fc, 0x000113fc, 0x000ac2fc, 0x000114fc,
+	0x000acefc, 0x000115fc, 0x000116fc, 0x000ae0fc, 0x000117fc, 0x000aebfc, 0x00001cfc, 0x000119fc,
+	0x000afdfc, 0x00011afc, 0x000b09fc, 0x00011bfc, 0x00011cfc, 0x000b1bfc, 0x00011dfc, 0x000b27fc,
+	0x00011efc, 0x000b33fc, 0x00011ffc, 0x000120fc, 0x000b45fc, 0x000121fc, 0x000b51fc, 0x00001dfc,
+	0x000123fc, 0x000b63fc, 0x000124fc, 0x000b6ffc, 0x000125fc, 0x000126fc, 0x000b80fc, 0x000127fc,
+	0x000b8cfc, 0x000128fc, 0x000129fc, 0x000b9efc, 0x00012afc, 0x000baafc, 0x00012bfc, 0x000003fc,
+	0x000bbcfc, 0x00012dfc, 0x000bc8fc, 0x00012efc, 0x00012ffc, 0x000bdafc, 0x000130fc, 0x000be6fc,
+	0x000131fc, 0x000132fc, 0x000bf8fc, 0x000133fc, 0x000c04fc, 0x000134fc, 0x000135fc, 0x000c15fc,
+	0x00001ffc, 0x000c21fc, 0x000137fc, 0x000138fc, 0x000c33fc, 0x000139fc, 0x000c3ffc, 0x00013afc,
+	0x00013bfc, 0x000c51fc, 0x00013cfc, 0x000c5dfc, 0x00013dfc, 0x000c69fc, 0x00013efc, 0x00013ffc,
+	0x000c7bfc, 0x000020fc, 0x000c87fc, 0x000141fc, 0x000142fc, 0x000c99fc, 0x000143fc, 0x000ca5fc,
+	0x000144fc, 0x000145fc, 0x000cb6fc, 0x000146fc, 0x000cc2fc, 0x000147fc, 0x000148fc, 0x000cd4fc,
+	0x000149fc, 0x000ce0fc, 0x000021fc, 0x00014bfc, 0x000cf2fc, 0x00014cfc, 0x000cfefc, 0x00014dfc,
+	0x00014efc, 0x000d10fc, 0x00014ffc, 0x000d1cfc, 0x000150fc, 0x000151fc, 0x000d2efc, 0x000152fc,
+	0x000d3afc, 0x000153fc, 0x000022fc, 0x000d4bfc, 0x000155fc, 0x000d57fc, 0x000156fc, 0x000157fc,
+	0x000d69fc, 0x000158fc, 0x000d75fc, 0x000159fc, 0x00015afc, 0x000d87fc, 0x00015bfc, 0x000d93fc,
+	0x00015cfc, 0x000d9ffc, 0x00015dfc, 0x000023fc, 0x000db1fc, 0x00015ffc, 0x000dbdfc, 0x000160fc,
+	0x000161fc, 0x000dcffc, 0x000162fc, 0x000ddafc, 0x000163fc, 0x000164fc, 0x000decfc, 0x000165fc,
+	0x000df8fc, 0x000166fc, 0x000167fc, 0x000e0afc, 0x000024fc, 0x000e16fc, 0x000169fc, 0x00016afc,
+	0x000e28fc, 0x00016bfc, 0x000e34fc, 0x00016cfc, 0x00016dfc, 0x000e46fc, 0x00016efc, 0x000e52fc,
+	0x00016ffc, 0x000170fc, 0x000e64fc, 0x000171fc, 0x000e6ffc, 0x000025fc, 0x000173fc, 0x000e81fc,
+	0x000174fc, 0x000e8dfc, 0x000175fc, 0x000176fc, 0x000e9ffc, 0x000177fc, 0x000eabfc, 0x000178fc,
+	0x000eb7fc, 0x000179fc, 0x00017afc, 0x000ec9fc, 0x00017bfc, 0x000ed5fc, 0x000026fc, 0x00017dfc,
+	0x000ee7fc, 0x00017efc, 0x000ef3fc, 0x00017ffc, 0x000180fc, 0x000f04fc, 0x000181fc, 0x000f10fc,
+	0x000182fc, 0x000183fc, 0x000f22fc, 0x000184fc, 0x000f2efc, 0x000185fc, 0x000027fc, 0x000f40fc,
+	0x000187fc, 0x000f4cfc, 0x000188fc, 0x000189fc, 0x000f5efc, 0x00018afc, 0x000f6afc, 0x00018bfc,
+	0x00018cfc, 0x000f7cfc, 0x00018dfc, 0x000f88fc, 0x00018efc, 0x00018ffc, 0x000f9afc, 0x000004fc,
+	0x000fa5fc, 0x000191fc, 0x000192fc, 0x000fb7fc, 0x000193fc, 0x000fc3fc, 0x000194fc, 0x000195fc,
+	0x000fd5fc, 0x000196fc, 0x000fe1fc, 0x000197fc, 0x000fedfc, 0x000198fc, 0x000199fc, 0x000ffffc,
+	0x000029fc, 0x00100bfc, 0x00019bfc, 0x00019cfc, 0x00101dfc, 0x00019dfc, 0x001029fc, 0x00019efc,
+	0x00019ffc, 0x00103afc, 0x0001a0fc, 0x001046fc, 0x0001a1fc, 0x0001a2fc, 0x001058fc, 0x0001a3fc,
+	0x001064fc, 0x00002afc, 0x0001a5fc, 0x001076fc, 0x0001a6fc, 0x001082fc, 0x0001a7fc, 0x0001a8fc,
+	0x001094fc, 0x0001a9fc, 0x0010a0fc, 0x0001aafc, 0x0001abfc, 0x0010b2fc, 0x0001acfc, 0x0010befc,
+	0x0001adfc, 0x00002bfc, 0x0010cffc, 0x0001affc, 0x0010dbfc, 0x0001b0fc, 0x0001b1fc, 0x0010edfc,
+	0x0001b2fc, 0x0010f9fc, 0x0001b3fc, 0x0001b4fc, 0x00110bfc, 0x0001b5fc, 0x001117fc, 0x0001b6fc,
+	0x001123fc, 0x0001b7fc, 0x00002cfc, 0x001135fc, 0x0001b9fc, 0x001141fc, 0x0001bafc, 0x0001bbfc,
+	0x001153fc, 0x0001bcfc, 0x00115ffc, 0x0001bdfc, 0x0001befc, 0x001170fc, 0x0001bffc, 0x00117cfc,
+	0x0001c0fc, 0x0001c1fc, 0x00118efc, 0x00002dfc, 0x00119afc, 0x0001c3fc, 0x0001c4fc, 0x0011acfc,
+	0x0001c5fc, 0x0011b8fc, 0x0001c6fc, 0x0001c7fc, 0x0011cafc, 0x0001c8fc, 0x0011d6fc, 0x0001c9fc,
+	0x0001cafc, 0x0011e8fc, 0x0001cbfc, 0x0011f4fc, 0x00002efc, 0x0001cdfc, 0x001205fc, 0x0001cefc,
+	0x001211fc, 0x0001cffc, 0x0001d0fc, 0x001223fc, 0x0001d1fc, 0x00122ffc, 0x0001d2fc, 0x0001d3fc,
+	0x001241fc, 0x0001d4fc, 0x00124dfc, 0x0001d5fc, 0x001259fc, 0x00002ffc, 0x0001d7fc, 0x00126bfc,
+	0x0001d8fc, 0x001277fc, 0x0001d9fc, 0x0001dafc, 0x001289fc, 0x0001dbfc, 0x001294fc, 0x0001dcfc,
+	0x0001ddfc, 0x0012a6fc, 0x0001defc, 0x0012b2fc, 0x0001dffc, 0x000030fc, 0x0012c4fc, 0x0001e1fc,
+	0x0012d0fc, 0x0001e2fc, 0x0001e3fc, 0x0012e2fc, 0x0001e4fc, 0x0012eefc, 0x0001e5fc, 0x0001e6fc,
+	0x001300fc, 0x0001e7fc, 0x00130cfc, 0x0001e8fc, 0x0001e9fc, 0x00131efc, 0x000031fc, 0x001329fc,
+	0x0001ebfc, 0x0001ecfc, 0x00133bfc, 0x0001edfc, 0x001347fc, 0x0001eefc, 0x0001effc, 0x001359fc,
+	0x0001f0fc, 0x001365fc, 0x0001f1fc, 0x001371fc, 0x0001f2fc, 0x0001f3fc, 0x001383fc, 0x000005fc,
+	0x00138ffc, 0x0001f5fc, 0x0001f6fc, 0x0013a1fc, 0x0001f7fc, 0x0013adfc, 0x0001f8fc, 0x0001f9fc,
+	0x0013befc, 0x0001fafc, 0x0013cafc, 0x0001fbfc, 0x0001fcfc, 0x0013dcfc, 0x0001fdfc, 0x0013e8fc,
+	0x000033fc, 0x0001fffc, 0x0013fafc, 0x000200fc, 0x001406fc, 0x000201fc, 0x000202fc, 0x001418fc,
+	0x000203fc, 0x001424fc, 0x000204fc, 0x000205fc, 0x001436fc, 0x000206fc, 0x001442fc, 0x000207fc,
+	0x000034fc, 0x001453fc, 0x000209fc, 0x00145ffc, 0x00020afc, 0x00020bfc, 0x001471fc, 0x00020cfc,
+	0x00147dfc, 0x00020dfc, 0x00020efc, 0x00148ffc, 0x00020ffc, 0x00149bfc, 0x000210fc, 0x0014a7fc,
+	0x000211fc, 0x000035fc, 0x0014b9fc, 0x000213fc, 0x0014c5fc, 0x000214fc, 0x000215fc, 0x0014d7fc,
+	0x000216fc, 0x0014e3fc, 0x000217fc, 0x000218fc, 0x0014f4fc, 0x000219fc, 0x001500fc, 0x00021afc,
+	0x00021bfc, 0x001512fc, 0x000036fc, 0x00151efc, 0x00021dfc, 0x00021efc, 0x001530fc, 0x00021ffc,
+	0x00153cfc, 0x000220fc, 0x000221fc, 0x00154efc, 0x000222fc, 0x00155afc, 0x000223fc, 0x000224fc,
+	0x00156cfc, 0x000225fc, 0x001578fc, 0x000037fc, 0x000227fc, 0x001589fc, 0x000228fc, 0x001595fc,
+	0x000229fc, 0x00022afc, 0x0015a7fc, 0x00022bfc, 0x0015b3fc, 0x00022cfc, 0x00022dfc, 0x0015c5fc,
+	0x00022efc, 0x0015d1fc, 0x00022ffc, 0x0015ddfc, 0x000038fc, 0x000231fc, 0x0015effc, 0x000232fc,
+	0x0015fbfc, 0x000233fc, 0x000234fc, 0x00160dfc, 0x000235fc, 0x001618fc, 0x000236fc, 0x000237fc,
+	0x00162afc, 0x000238fc, 0x001636fc, 0x000239fc, 0x000039fc, 0x001648fc, 0x00023bfc, 0x001654fc,
+	0x00023cfc, 0x00023dfc, 0x001666fc, 0x00023efc, 0x001672fc, 0x00023ffc, 0x000240fc, 0x001684fc,
+	0x000241fc, 0x001690fc, 0x000242fc, 0x000243fc, 0x0016a2fc, 0x00003afc, 0x0016adfc, 0x000245fc,
+	0x000246fc, 0x0016bffc, 0x000247fc, 0x0016cbfc, 0x000248fc, 0x000249fc, 0x0016ddfc, 0x00024afc,
+	0x0016e9fc, 0x00024bfc, 0x0016f5fc, 0x00024cfc, 0x00024dfc, 0x001707fc, 0x00003bfc, 0x001713fc,
+	0x00024ffc, 0x000250fc, 0x001725fc, 0x000251fc, 0x001731fc, 0x000252fc, 0x000253fc, 0x001743fc,
+	0x000254fc, 0x00174efc, 0x000255fc, 0x000256fc, 0x001760fc, 0x000257fc, 0x00176cfc, 0x000006fc,
+	0x000259fc, 0x00177efc, 0x00025afc, 0x00178afc, 0x00025bfc, 0x00025cfc, 0x00179cfc, 0x00025dfc,
+	0x0017a8fc, 0x00025efc, 0x00025ffc, 0x0017bafc, 0x000260fc, 0x0017c6fc, 0x000261fc, 0x00003dfc,
+	0x0017d8fc, 0x000263fc, 0x0017e3fc, 0x000264fc, 0x000265fc, 0x0017f5fc, 0x000266fc, 0x001801fc,
+	0x000267fc, 0x000268fc, 0x001813fc, 0x000269fc, 0x00181ffc, 0x00026afc, 0x00182bfc, 0x00026bfc,
+	0x00003efc, 0x00183dfc, 0x00026dfc, 0x001849fc, 0x00026efc, 0x00026ffc, 0x00185bfc, 0x000270fc,
+	0x001867fc, 0x000271fc, 0x000272fc, 0x001878fc, 0x000273fc, 0x001884fc, 0x000274fc, 0x000275fc,
+	0x001896fc, 0x00003ffc, 0x0018a2fc, 0x000277fc, 0x000278fc, 0x0018b4fc, 0x000279fc, 0x0018c0fc,
+	0x00027afc, 0x00027bfc, 0x0018d2fc, 0x00027cfc, 0x0018defc, 0x00027dfc, 0x00027efc, 0x0018f0fc,
+	0x00027ffc, 0x0018fcfc, 0x000040fc, 0x000281fc, 0x00190dfc, 0x000282fc, 0x001919fc, 0x000283fc,
+	0x000284fc, 0x00192bfc, 0x000285fc, 0x001937fc, 0x000286fc, 0x000287fc, 0x001949fc, 0x000288fc,
+	0x001955fc, 0x000289fc, 0x001961fc, 0x000041fc, 0x00028bfc, 0x001973fc, 0x00028cfc, 0x00197ffc,
+	0x00028dfc, 0x00028efc, 0x001991fc, 0x00028ffc, 0x00199dfc, 0x000290fc, 0x000291fc, 0x0019aefc,
+	0x000292fc, 0x0019bafc, 0x000293fc, 0x000042fc, 0x0019ccfc, 0x000295fc, 0x0019d8fc, 0x000296fc,
+	0x000297fc, 0x0019eafc, 0x000298fc, 0x0019f6fc, 0x000299fc, 0x00029afc, 0x001a08fc, 0x00029bfc,
+	0x001a14fc, 0x00029cfc, 0x00029dfc, 0x001a26fc, 0x000043fc, 0x001a32fc, 0x00029ffc, 0x0002a0fc,
+	0x001a43fc, 0x0002a1fc, 0x001a4ffc, 0x0002a2fc, 0x0002a3fc, 0x001a61fc, 0x0002a4fc, 0x001a6dfc,
+	0x0002a5fc, 0x0002a6fc, 0x001a7ffc, 0x0002a7fc, 0x001a8bfc, 0x000044fc, 0x001a97fc, 0x0002a9fc,
+	0x0002aafc, 0x001aa9fc, 0x0002abfc, 0x001ab5fc, 0x0002acfc, 0x0002adfc, 0x001ac7fc, 0x0002aefc,
+	0x001ad2fc, 0x0002affc, 0x0002b0fc, 0x001ae4fc, 0x0002b1fc, 0x001af0fc, 0x000045fc, 0x0002b3fc,
+	0x001b02fc, 0x0002b4fc, 0x001b0efc, 0x0002b5fc, 0x0002b6fc, 0x001b20fc, 0x0002b7fc, 0x001b2cfc,
+	0x0002b8fc, 0x0002b9fc, 0x001b3efc, 0x0002bafc, 0x001b4afc, 0x0002bbfc, 0x000007fc, 0x001b5cfc,
+	0x0002bdfc, 0x001b67fc, 0x0002befc, 0x0002bffc, 0x001b79fc, 0x0002c0fc, 0x001b85fc, 0x0002c1fc,
+	0x0002c2fc, 0x001b97fc, 0x0002c3fc, 0x001ba3fc, 0x0002c4fc, 0x001baffc, 0x0002c5fc, 0x000047fc,
+	0x001bc1fc, 0x0002c7fc, 0x001bcdfc, 0x0002c8fc, 0x0002c9fc, 0x001bdffc, 0x0002cafc, 0x001bebfc,
+	0x0002cbfc, 0x0002ccfc, 0x001bfcfc, 0x0002cdfc, 0x001c08fc, 0x0002cefc, 0x0002cffc, 0x001c1afc,
+	0x000048fc, 0x001c26fc, 0x0002d1fc, 0x0002d2fc, 0x001c38fc, 0x0002d3fc, 0x001c44fc, 0x0002d4fc,
+	0x0002d5fc, 0x001c56fc, 0x0002d6fc, 0x001c62fc, 0x0002d7fc, 0x0002d8fc, 0x001c74fc, 0x0002d9fc,
+	0x001c80fc, 0x000049fc, 0x0002dbfc, 0x001c91fc, 0x0002dcfc, 0x001c9dfc, 0x0002ddfc, 0x0002defc,
+	0x001caffc, 0x0002dffc, 0x001cbbfc, 0x0002e0fc, 0x0002e1fc, 0x001ccdfc, 0x0002e2fc, 0x001cd9fc,
+	0x0002e3fc, 0x001ce5fc, 0x00004afc, 0x0002e5fc, 0x001cf7fc, 0x0002e6fc, 0x001d03fc, 0x0002e7fc,
+	0x0002e8fc, 0x001d15fc, 0x0002e9fc, 0x001d21fc, 0x0002eafc, 0x0002ebfc, 0x001d32fc, 0x0002ecfc,
+	0x001d3efc, 0x0002edfc, 0x00004bfc, 0x001d50fc, 0x0002effc, 0x001d5cfc, 0x0002f0fc, 0x0002f1fc,
+	0x001d6efc, 0x0002f2fc, 0x001d7afc, 0x0002f3fc, 0x0002f4fc, 0x001d8cfc, 0x0002f5fc, 0x001d98fc,
+	0x0002f6fc, 0x0002f7fc, 0x001daafc, 0x00004cfc, 0x001db6fc, 0x0002f9fc, 0x0002fafc, 0x001dc7fc,
+	0x0002fbfc, 0x001dd3fc, 0x0002fcfc, 0x0002fdfc, 0x001de5fc, 0x0002fefc, 0x001df1fc, 0x0002fffc,
+	0x000300fc, 0x001e03fc, 0x000301fc, 0x001e0ffc, 0x00004dfc, 0x001e1bfc, 0x000303fc, 0x000304fc,
+	0x001e2dfc, 0x000305fc, 0x001e39fc, 0x000306fc, 0x000307fc, 0x001e4bfc, 0x000308fc, 0x001e56fc,
+	0x000309fc, 0x00030afc, 0x001e68fc, 0x00030bfc, 0x001e74fc, 0x00004efc, 0x00030dfc, 0x001e86fc,
+	0x00030efc, 0x001e92fc, 0x00030ffc, 0x000310fc, 0x001ea4fc, 0x000311fc, 0x001eb0fc, 0x000312fc,
+	0x000313fc, 0x001ec2fc, 0x000314fc, 0x001ecefc, 0x000315fc, 0x00004ffc, 0x001ee0fc, 0x000317fc,
+	0x001eebfc, 0x000318fc, 0x000319fc, 0x001efdfc, 0x00031afc, 0x001f09fc, 0x00031bfc, 0x00031cfc,
+	0x001f1bfc, 0x00031dfc, 0x001f27fc, 0x00031efc, 0x00031ffc, 0x001f39fc, 0x000008fc, 0x001f45fc,
+	0x000321fc, 0x001f51fc, 0x000322fc, 0x000323fc, 0x001f63fc, 0x000324fc, 0x001f6ffc, 0x000325fc,
+	0x000326fc, 0x001f81fc, 0x000327fc, 0x001f8cfc, 0x000328fc, 0x000329fc, 0x001f9efc, 0x000051fc,
+	0x001faafc, 0x00032bfc, 0x00032cfc, 0x001fbcfc, 0x00032dfc, 0x001fc8fc, 0x00032efc, 0x00032ffc,
+	0x001fdafc, 0x000330fc, 0x001fe6fc, 0x000331fc, 0x000332fc, 0x001ff8fc, 0x000333fc, 0x002004fc,
+	0x000052fc, 0x000335fc, 0x002016fc, 0x000336fc, 0x002021fc, 0x000337fc, 0x000338fc, 0x002033fc,
+	0x000339fc, 0x00203ffc, 0x00033afc, 0x00033bfc, 0x002051fc, 0x00033cfc, 0x00205dfc, 0x00033dfc,
+	0x002069fc, 0x000053fc, 0x00033ffc, 0x00207bfc, 0x000340fc, 0x002087fc, 0x000341fc, 0x000342fc,
+	0x002099fc, 0x000343fc, 0x0020a5fc, 0x000344fc, 0x000345fc, 0x0020b6fc, 0x000346fc, 0x0020c2fc,
+	0x000347fc, 0x000054fc, 0x0020d4fc, 0x000349fc, 0x0020e0fc, 0x00034afc, 0x00034bfc, 0x0020f2fc,
+	0x00034cfc, 0x0020fefc, 0x00034dfc, 0x00034efc, 0x002110fc, 0x00034ffc, 0x00211cfc, 0x000350fc,
+	0x000351fc, 0x00212efc, 0x000055fc, 0x00213afc, 0x000353fc, 0x000354fc, 0x00214bfc, 0x000355fc,
+	0x002157fc, 0x000356fc, 0x000357fc, 0x002169fc, 0x000358fc, 0x002175fc, 0x000359fc, 0x00035afc,
+	0x002187fc, 0x00035bfc, 0x002193fc, 0x000056fc, 0x00219ffc, 0x00035dfc, 0x00035efc, 0x0021b1fc,
+	0x00035ffc, 0x0021bdfc, 0x000360fc, 0x000361fc, 0x0021cffc, 0x000362fc, 0x0021dbfc, 0x000363fc,
+	0x000364fc, 0x0021ecfc, 0x000365fc, 0x0021f8fc, 0x000057fc, 0x000367fc, 0x00220afc, 0x000368fc,
+	0x002216fc, 0x000369fc, 0x00036afc, 0x002228fc, 0x00036bfc, 0x002234fc, 0x00036cfc, 0x00036dfc,
+	0x002246fc, 0x00036efc, 0x002252fc, 0x00036ffc, 0x000058fc, 0x002264fc, 0x000371fc, 0x002270fc,
+	0x000372fc, 0x000373fc, 0x002281fc, 0x000374fc, 0x00228dfc, 0x000375fc, 0x000376fc, 0x00229ffc,
+	0x000377fc, 0x0022abfc, 0x000378fc, 0x000379fc, 0x0022bdfc, 0x000059fc, 0x0022c9fc, 0x00037bfc,
+	0x0022d5fc, 0x00037cfc, 0x00037dfc, 0x0022e7fc, 0x00037efc, 0x0022f3fc, 0x00037ffc, 0x000380fc,
+	0x002305fc, 0x000381fc, 0x002310fc, 0x000382fc, 0x000383fc, 0x002322fc, 0x000009fc, 0x00232efc,
+	0x000385fc, 0x000386fc, 0x002340fc, 0x000387fc, 0x00234cfc, 0x000388fc, 0x000389fc, 0x00235efc,
+	0x00038afc, 0x00236afc, 0x00038bfc, 0x00038cfc, 0x00237cfc, 0x00038dfc, 0x002388fc, 0x00005bfc,
+	0x00038ffc, 0x00239afc, 0x000390fc, 0x0023a5fc, 0x000391fc, 0x000392fc, 0x0023b7fc, 0x000393fc,
+	0x0023c3fc, 0x000394fc, 0x000395fc, 0x0023d5fc, 0x000396fc, 0x0023e1fc, 0x000397fc, 0x0023edfc,
+	0x00005cfc, 0x000399fc, 0x0023fffc, 0x00039afc, 0x00240bfc, 0x00039bfc, 0x00039cfc, 0x00241dfc,
+	0x00039dfc, 0x002429fc, 0x00039efc, 0x00039ffc, 0x00243afc, 0x0003a0fc, 0x002446fc, 0x0003a1fc,
+	0x00005dfc, 0x002458fc, 0x0003a3fc, 0x002464fc, 0x0003a4fc, 0x0003a5fc, 0x002476fc, 0x0003a6fc,
+	0x002482fc, 0x0003a7fc, 0x0003a8fc, 0x002494fc, 0x0003a9fc, 0x0024a0fc, 0x0003aafc, 0x0003abfc,
+	0x0024b2fc, 0x00005efc, 0x0024befc, 0x0003adfc, 0x0003aefc, 0x0024cffc, 0x0003affc, 0x0024dbfc,
+	0x0003b0fc, 0x0003b1fc, 0x0024edfc, 0x0003b2fc, 0x0024f9fc, 0x0003b3fc, 0x0003b4fc, 0x00250bfc,
+	0x0003b5fc, 0x002517fc, 0x00005ffc, 0x002523fc, 0x0003b7fc, 0x0003b8fc, 0x002535fc, 0x0003b9fc,
+	0x002541fc, 0x0003bafc, 0x0003bbfc, 0x002553fc, 0x0003bcfc, 0x00255ffc, 0x0003bdfc, 0x0003befc,
+	0x002570fc, 0x0003bffc, 0x00257cfc, 0x000060fc, 0x0003c1fc, 0x00258efc, 0x0003c2fc, 0x00259afc,
+	0x0003c3fc, 0x0003c4fc, 0x0025acfc, 0x0003c5fc, 0x0025b8fc, 0x0003c6fc, 0x0003c7fc, 0x0025cafc,
+	0x0003c8fc, 0x0025d6fc, 0x0003c9fc, 0x000061fc, 0x0025e8fc, 0x0003cbfc, 0x0025f4fc, 0x0003ccfc,
+	0x0003cdfc, 0x002605fc, 0x0003cefc, 0x002611fc, 0x0003cffc, 0x0003d0fc, 0x002623fc, 0x0003d1fc,
+	0x00262ffc, 0x0003d2fc, 0x0003d3fc, 0x002641fc, 0x000062fc, 0x00264dfc, 0x0003d5fc, 0x002659fc,
+	0x0003d6fc, 0x0003d7fc, 0x00266bfc, 0x0003d8fc, 0x002677fc, 0x0003d9fc, 0x0003dafc, 0x002689fc,
+	0x0003dbfc, 0x002694fc, 0x0003dcfc, 0x0003ddfc, 0x0026a6fc, 0x000063fc, 0x0026b2fc, 0x0003dffc,
+	0x0003e0fc, 0x0026c4fc, 0x0003e1fc, 0x0026d0fc, 0x0003e2fc, 0x0003e3fc, 0x0026e2fc, 0x0003e4fc,
+	0x0026eefc, 0x0003e5fc, 0x0003e6fc, 0x002700fc, 0x0003e7fc, 0x00270cfc, 0x000001fd, 0x0003e9fd,
+	0x00271efd, 0x0003eafd, 0x00272afd, 0x0003ebfd, 0x0003ecfd, 0x00273bfd, 0x0003edfd, 0x002747fd,
+	0x0003eefd, 0x0003effd, 0x002759fd, 0x0003f0fd, 0x002765fd, 0x0003f1fd, 0x000065fd, 0x002777fd,
+	0x0003f3fd, 0x002783fd, 0x0003f4fd, 0x00278ffd, 0x0003f5fd, 0x0003f6fd, 0x0027a1fd, 0x0003f7fd,
+	0x0027adfd, 0x0003f8fd, 0x0003f9fd, 0x0027bffd, 0x0003fafd, 0x0027cafd, 0x0003fbfd, 0x000066fd,
+	0x0027dcfd, 0x0003fdfd, 0x0027e8fd, 0x0003fefd, 0x0003fffd, 0x0027fafd, 0x000400fd, 0x002806fd,
+	0x000401fd, 0x000402fd, 0x002818fd, 0x000403fd, 0x002824fd, 0x000404fd, 0x000405fd, 0x002836fd,
+	0x000067fd, 0x002842fd, 0x000407fd, 0x000408fd, 0x002854fd, 0x000409fd, 0x00285ffd, 0x00040afd,
+	0x00040bfd, 0x002871fd, 0x00040cfd, 0x00287dfd, 0x00040dfd, 0x00040efd, 0x00288ffd, 0x00040ffd,
+	0x00289bfd, 0x000068fd, 0x0028a7fd, 0x000411fd, 0x000412fd, 0x0028b9fd, 0x000413fd, 0x0028c5fd,
+	0x000414fd, 0x000415fd, 0x0028d7fd, 0x000416fd, 0x0028e3fd, 0x000417fd, 0x000418fd, 0x0028f4fd,
+	0x000419fd, 0x002900fd, 0x000069fd, 0x00041bfd, 0x002912fd, 0x00041cfd, 0x00291efd, 0x00041dfd,
+	0x00041efd, 0x002930fd, 0x00041ffd, 0x00293cfd, 0x000420fd, 0x000421fd, 0x00294efd, 0x000422fd,
+	0x00295afd, 0x000423fd, 0x00006afd, 0x00296cfd, 0x000425fd, 0x002978fd, 0x000426fd, 0x000427fd,
+	0x002989fd, 0x000428fd, 0x002995fd, 0x000429fd, 0x00042afd, 0x0029a7fd, 0x00042bfd, 0x0029b3fd,
+	0x00042cfd, 0x00042dfd, 0x0029c5fd, 0x00006bfd, 0x0029d1fd, 0x00042ffd, 0x0029ddfd, 0x000430fd,
+	0x000431fd, 0x0029effd, 0x000432fd, 0x0029fbfd, 0x000433fd, 0x000434fd, 0x002a0dfd, 0x000435fd,
+	0x002a19fd, 0x000436fd, 0x000437fd, 0x002a2afd, 0x00006cfd, 0x002a36fd, 0x000439fd, 0x00043afd,
+	0x002a48fd, 0x00043bfd, 0x002a54fd, 0x00043cfd, 0x00043dfd, 0x002a66fd, 0x00043efd, 0x002a72fd,
+	0x00043ffd, 0x000440fd, 0x002a84fd, 0x000441fd, 0x002a90fd, 0x00006dfd, 0x000443fd, 0x002aa2fd,
+	0x000444fd, 0x002aaefd, 0x000445fd, 0x000446fd, 0x002abffd, 0x000447fd, 0x002acbfd, 0x000448fd,
+	0x000449fd, 0x002addfd, 0x00044afd, 0x002ae9fd, 0x00044bfd, 0x00000bfd, 0x002afbfd, 0x00044dfd,
+	0x002b07fd, 0x00044efd, 0x002b13fd, 0x00044ffd, 0x000450fd, 0x002b25fd, 0x000451fd, 0x002b31fd,
+	0x000452fd, 0x000453fd, 0x002b43fd, 0x000454fd, 0x002b4efd, 0x000455fd, 0x00006ffd, 0x002b60fd,
+	0x000457fd, 0x002b6cfd, 0x000458fd, 0x000459fd, 0x002b7efd, 0x00045afd, 0x002b8afd, 0x00045bfd,
+	0x00045cfd, 0x002b9cfd, 0x00045dfd, 0x002ba8fd, 0x00045efd, 0x00045ffd, 0x002bbafd, 0x000070fd,
+	0x002bc6fd, 0x000461fd, 0x000462fd, 0x002bd8fd, 0x000463fd, 0x002be3fd, 0x000464fd, 0x000465fd,
+	0x002bf5fd, 0x000466fd, 0x002c01fd, 0x000467fd, 0x000468fd, 0x002c13fd, 0x000469fd, 0x002c1ffd,
+	0x000071fd, 0x002c2bfd, 0x00046bfd, 0x00046cfd, 0x002c3dfd, 0x00046dfd, 0x002c49fd, 0x00046efd,
+	0x00046ffd, 0x002c5bfd, 0x000470fd, 0x002c67fd, 0x000471fd, 0x000472fd, 0x002c78fd, 0x000473fd,
+	0x002c84fd, 0x000072fd, 0x000475fd, 0x002c96fd, 0x000476fd, 0x002ca2fd, 0x000477fd, 0x000478fd,
+	0x002cb4fd, 0x000479fd, 0x002cc0fd, 0x00047afd, 0x00047bfd, 0x002cd2fd, 0x00047cfd, 0x002cdefd,
+	0x00047dfd, 0x000073fd, 0x002cf0fd, 0x00047ffd, 0x002cfcfd, 0x000480fd, 0x000481fd, 0x002d0dfd,
+	0x000482fd, 0x002d19fd, 0x000483fd, 0x000484fd, 0x002d2bfd, 0x000485fd, 0x002d37fd, 0x000486fd,
+	0x000487fd, 0x002d49fd, 0x000074fd, 0x002d55fd, 0x000489fd, 0x002d61fd, 0x00048afd, 0x00048bfd,
+	0x002d73fd, 0x00048cfd, 0x002d7ffd, 0x00048dfd, 0x00048efd, 0x002d91fd, 0x00048ffd, 0x002d9dfd,
+	0x000490fd, 0x000491fd, 0x002daefd, 0x000075fd, 0x002dbafd, 0x000493fd, 0x000494fd, 0x002dccfd,
+	0x000495fd, 0x002dd8fd, 0x000496fd, 0x000497fd, 0x002deafd, 0x000498fd, 0x002df6fd, 0x000499fd,
+	0x00049afd, 0x002e08fd, 0x00049bfd, 0x002e14fd, 0x000076fd, 0x00049dfd, 0x002e26fd, 0x00049efd,
+	0x002e32fd, 0x00049ffd, 0x0004a0fd, 0x002e43fd, 0x0004a1fd, 0x002e4ffd, 0x0004a2fd, 0x0004a3fd,
+	0x002e61fd, 0x0004a4fd, 0x002e6dfd, 0x0004a5fd, 0x000077fd, 0x002e7ffd, 0x0004a7fd, 0x002e8bfd,
+	0x0004a8fd, 0x002e97fd, 0x0004a9fd, 0x0004aafd, 0x002ea9fd, 0x0004abfd, 0x002eb5fd, 0x0004acfd,
+	0x0004adfd, 0x002ec7fd, 0x0004aefd, 0x002ed2fd, 0x0004affd, 0x00000cfd, 0x002ee4fd, 0x0004b1fd,
+	0x002ef0fd, 0x0004b2fd, 0x0004b3fd, 0x002f02fd, 0x0004b4fd, 0x002f0efd, 0x0004b5fd, 0x0004b6fd,
+	0x002f20fd, 0x0004b7fd, 0x002f2cfd, 0x0004b8fd, 0x0004b9fd, 0x002f3efd, 0x000079fd, 0x002f4afd,
+	0x0004bbfd, 0x0004bcfd, 0x002f5cfd, 0x0004bdfd, 0x002f68fd, 0x0004befd, 0x0004bffd, 0x002f79fd,
+	0x0004c0fd, 0x002f85fd, 0x0004c1fd, 0x0004c2fd, 0x002f97fd, 0x0004c3fd, 0x002fa3fd, 0x00007afd,
+	0x0004c5fd, 0x0004c6fd, 0x0004c7fd, 0x0004c8fd, 0x0004c9fd, 0x0004cbfd, 0x0004ccfd, 0x0004cdfd,
+	0x00007bfd, 0x0004cffd, 0x0004d1fd, 0x0004d2fd, 0x0004d3fd, 0x0004d4fd, 0x0004d5fd, 0x0004d7fd,
+	0x00007cfd, 0x0004d9fd, 0x0004dafd, 0x0004dbfd, 0x0004ddfd, 0x0004defd, 0x0004dffd, 0x0004e0fd,
+	0x0004e1fd, 0x00007dfd, 0x0004e4fd, 0x0004e5fd, 0x0004e6fd, 0x0004e7fd, 0x0004e8fd, 0x0004eafd,
+	0x0004ebfd, 0x00007efd, 0x0004edfd, 0x0004eefd, 0x0004f0fd, 0x0004f1fd, 0x0004f2fd, 0x0004f3fd,
+	0x0004f4fd, 0x00007ffd, 0x0004f7fd, 0x0004f8fd, 0x0004f9fd, 0x0004fafd, 0x0004fcfd, 0x0004fdfd,
+	0x0004fefd, 0x0004fffd, 0x000080fd, 0x000501fd, 0x000503fd, 0x000504fd, 0x000505fd, 0x000506fd,
+	0x000507fd, 0x000509fd, 0x000081fd, 0x00050bfd, 0x00050cfd, 0x00050dfd, 0x00050ffd, 0x000510fd,
+	0x000511fd, 0x000512fd, 0x000513fd, 0x00000dfd, 0x000516fd, 0x000517fd, 0x000518fd, 0x000519fd,
+	0x00051bfd, 0x00051cfd, 0x00051dfd, 0x000083fd, 0x00051ffd, 0x000520fd, 0x000522fd, 0x000523fd,
+	0x000524fd, 0x000525fd, 0x000526fd, 0x000084fd, 0x000529fd, 0x00052afd, 0x00052bfd, 0x00052cfd,
+	0x00052efd, 0x00052ffd, 0x000530fd, 0x000531fd, 0x000085fd, 0x000534fd, 0x000535fd, 0x000536fd,
+	0x000537fd, 0x000538fd, 0x00053afd, 0x00053bfd, 0x000086fd, 0x00053dfd, 0x00053efd, 0x00053ffd,
+	0x000541fd, 0x000542fd, 0x000543fd, 0x000544fd, 0x000087fd, 0x000547fd, 0x000548fd, 0x000549fd,
+	0x00054afd, 0x00054bfd, 0x00054dfd, 0x00054efd, 0x00054ffd, 0x000088fd, 0x000551fd, 0x000553fd,
+	0x000554fd, 0x000555fd, 0x000556fd, 0x000557fd, 0x000559fd, 0x000089fd, 0x00055bfd, 0x00055cfd,
+	0x00055dfd, 0x00055efd, 0x000560fd, 0x000561fd, 0x000562fd, 0x000563fd, 0x00008afd, 0x000566fd,
+	0x000567fd, 0x000568fd, 0x000569fd, 0x00056afd, 0x00056cfd, 0x00056dfd, 0x00008bfd, 0x00056ffd,
+	0x000570fd, 0x000572fd, 0x000573fd, 0x000574fd, 0x000575fd, 0x000576fd, 0x00000efd, 0x000579fd,
+	0x00057afd, 0x00057bfd, 0x00057cfd, 0x00057dfd, 0x00057ffd, 0x000580fd, 0x000581fd, 0x00008dfd,
+	0x000583fd, 0x000585fd, 0x000586fd, 0x000587fd, 0x000588fd, 0x000589fd, 0x00058bfd, 0x00008efd,
+	0x00058dfd, 0x00058efd, 0x00058ffd, 0x000591fd, 0x000592fd, 0x000593fd, 0x000594fd, 0x000595fd,
+	0x00008ffd, 0x000598fd, 0x000599fd, 0x00059afd, 0x00059bfd, 0x00059cfd, 0x00059efd, 0x00059ffd,
+	0x000090fd, 0x0005a1fd, 0x0005a2fd, 0x0005a4fd, 0x0005a5fd, 0x0005a6fd, 0x0005a7fd, 0x0005a8fd,
+	0x000091fd, 0x0005abfd, 0x0005acfd, 0x0005adfd, 0x0005aefd, 0x0005b0fd, 0x0005b1fd, 0x0005b2fd,
+	0x0005b3fd, 0x000092fd, 0x0005b6fd, 0x0005b7fd, 0x0005b8fd, 0x0005b9fd, 0x0005bafd, 0x0005bbfd,
+	0x0005bdfd, 0x000093fd, 0x0005bffd, 0x0005c0fd, 0x0005c1fd, 0x0005c3fd, 0x0005c4fd, 0x0005c5fd,
+	0x0005c6fd, 0x0005c7fd, 0x000094fd, 0x0005cafd, 0x0005cbfd, 0x0005ccfd, 0x0005cdfd, 0x0005cffd,
+	0x0005d0fd, 0x0005d1fd, 0x000095fd, 0x0005d3fd, 0x0005d5fd, 0x0005d6fd, 0x0005d7fd, 0x0005d8fd,
+	0x0005d9fd, 0x0005dafd, 0x00000ffd, 0x0005ddfd, 0x0005defd, 0x0005dffd, 0x0005e0fd, 0x0005e2fd,
+	0x0005e3fd, 0x0005e4fd, 0x0005e5fd, 0x000097fd, 0x0005e8fd, 0x0005e9fd, 0x0005eafd, 0x0005ebfd,
+	0x0005ecfd, 0x0005eefd, 0x0005effd, 0x000098fd, 0x0005f1fd, 0x0005f2fd, 0x0005f3fd, 0x0005f5fd,
+	0x0005f6fd, 0x0005f7fd, 0x0005f8fd, 0x000099fd, 0x0005fbfd, 0x0005fcfd, 0x0005fdfd, 0x0005fefd,
+	0x0005fffd, 0x000601fd, 0x000602fd, 0x000603fd, 0x00009afd, 0x000605fd, 0x000607fd, 0x000608fd,
+	0x000609fd, 0x00060afd, 0x00060bfd, 0x00060dfd, 0x00009bfd, 0x00060ffd, 0x000610fd, 0x000611fd,
+	0x000612fd, 0x000614fd, 0x000615fd, 0x000616fd, 0x000617fd, 0x00009cfd, 0x00061afd, 0x00061bfd,
+	0x00061cfd, 0x00061dfd, 0x00061efd, 0x000620fd, 0x000621fd, 0x00009dfd, 0x000623fd, 0x000624fd,
+	0x000626fd, 0x000627fd, 0x000628fd, 0x000629fd, 0x00062afd, 0x00009efd, 0x00062dfd, 0x00062efd,
+	0x00062ffd, 0x000630fd, 0x000631fd, 0x000633fd, 0x000634fd, 0x000635fd, 0x00009ffd, 0x000637fd,
+	0x000639fd, 0x00063afd, 0x00063bfd, 0x00063cfd, 0x00063dfd, 0x00063ffd, 0x000010fd, 0x000641fd,
+	0x000642fd, 0x000643fd, 0x000645fd, 0x000646fd, 0x000647fd, 0x000648fd, 0x000649fd, 0x0000a1fd,
+	0x00064cfd, 0x00064dfd, 0x00064efd, 0x00064ffd, 0x000650fd, 0x000652fd, 0x000653fd, 0x0000a2fd,
+	0x000655fd, 0x000656fd, 0x000658fd, 0x000659fd, 0x00065afd, 0x00065bfd, 0x00065cfd, 0x0000a3fd,
+	0x00065ffd, 0x000660fd, 0x000661fd, 0x000662fd, 0x000664fd, 0x000665fd, 0x000666fd, 0x000667fd,
+	0x0000a4fd, 0x00066afd, 0x00066bfd, 0x00066cfd, 0x00066dfd, 0x00066efd, 0x00066ffd, 0x000671fd,
+	0x0000a5fd, 0x000673fd, 0x000674fd, 0x000675fd, 0x000677fd, 0x000678fd, 0x000679fd, 0x00067afd,
+	0x00067bfd, 0x0000a6fd, 0x00067efd, 0x00067ffd, 0x000680fd, 0x000681fd, 0x000683fd, 0x000684fd,
+	0x000685fd, 0x0000a7fd, 0x000687fd, 0x000689fd, 0x00068afd, 0x00068bfd, 0x00068cfd, 0x00068dfd,
+	0x00068efd, 0x0000a8fd, 0x000691fd, 0x000692fd, 0x000693fd, 0x000694fd, 0x000696fd, 0x000697fd,
+	0x000698fd, 0x000699fd, 0x0000a9fd, 0x00069cfd, 0x00069dfd, 0x00069efd, 0x00069ffd, 0x0006a0fd,
+	0x0006a2fd, 0x0006a3fd, 0x000011fd, 0x0006a5fd, 0x0006a6fd, 0x0006a8fd, 0x0006a9fd, 0x0006aafd,
+	0x0006abfd, 0x0006acfd, 0x0000abfd, 0x0006affd, 0x0006b0fd, 0x0006b1fd, 0x0006b2fd, 0x0006b3fd,
+	0x0006b5fd, 0x0006b6fd, 0x0006b7fd, 0x0000acfd, 0x0006b9fd, 0x0006bbfd, 0x0006bcfd, 0x0006bdfd,
+	0x0006befd, 0x0006bffd, 0x0006c1fd, 0x0000adfd, 0x0006c3fd, 0x0006c4fd, 0x0006c5fd, 0x0006c6fd,
+	0x0006c8fd, 0x0006c9fd, 0x0006cafd, 0x0006cbfd, 0x0000aefd, 0x0006cefd, 0x0006cffd, 0x0006d0fd,
+	0x0006d1fd, 0x0006d2fd, 0x0006d4fd, 0x0006d5fd, 0x0000affd, 0x0006d7fd, 0x0006d8fd, 0x0006dafd,
+	0x0006dbfd, 0x0006dcfd, 0x0006ddfd, 0x0006defd, 0x0000b0fd, 0x0006e1fd, 0x0006e2fd, 0x0006e3fd,
+	0x0006e4fd, 0x0006e5fd, 0x0006e7fd, 0x0006e8fd, 0x0006e9fd, 0x0000b1fd, 0x0006ebfd, 0x0006edfd,
+	0x0006eefd, 0x0006effd, 0x0006f0fd, 0x0006f1fd, 0x0006f3fd, 0x0000b2fd, 0x0006f5fd, 0x0006f6fd,
+	0x0006f7fd, 0x0006f9fd, 0x0006fafd, 0x0006fbfd, 0x0006fcfd, 0x0006fdfd, 0x0000b3fd, 0x000700fd,
+	0x000701fd, 0x000702fd, 0x000703fd, 0x000704fd, 0x000706fd, 0x000707fd, 0x000012fd, 0x000709fd,
+	0x00070afd, 0x00070cfd, 0x00070dfd, 0x00070efd, 0x00070ffd, 0x000710fd, 0x0000b5fd, 0x000713fd,
+	0x000714fd, 0x000715fd, 0x000716fd, 0x000718fd, 0x000719fd, 0x00071afd, 0x00071bfd, 0x0000b6fd,
+	0x00071efd, 0x00071ffd, 0x000720fd, 0x000721fd, 0x000722fd, 0x000723fd, 0x000725fd, 0x0000b7fd,
+	0x000727fd, 0x000728fd, 0x000729fd, 0x00072bfd, 0x00072cfd, 0x00072dfd, 0x00072efd, 0x00072ffd,
+	0x0000b8fd, 0x000732fd, 0x000733fd, 0x000734fd, 0x000735fd, 0x000737fd, 0x000738fd, 0x000739fd,
+	0x0000b9fd, 0x00073bfd, 0x00073dfd, 0x00073efd, 0x00073ffd, 0x000740fd, 0x000741fd, 0x000742fd,
+	0x0000bafd, 0x000745fd, 0x000746fd, 0x000747fd, 0x000748fd, 0x00074afd, 0x00074bfd, 0x00074cfd,
+	0x00074dfd, 0x0000bbfd, 0x000750fd, 0x000751fd, 0x000752fd, 0x000753fd, 0x000754fd, 0x000756fd,
+	0x000757fd, 0x0000bcfd, 0x000759fd, 0x00075afd, 0x00075cfd, 0x00075dfd, 0x00075efd, 0x00075ffd,
+	0x000760fd, 0x0000bdfd, 0x000763fd, 0x000764fd, 0x000765fd, 0x000766fd, 0x000767fd, 0x000769fd,
+	0x00076afd, 0x00076bfd, 0x000013fd, 0x00076dfd, 0x00076ffd, 0x000770fd, 0x000771fd, 0x000772fd,
+	0x000773fd, 0x000775fd, 0x0000bffd, 0x000777fd, 0x000778fd, 0x000779fd, 0x00077bfd, 0x00077cfd,
+	0x00077dfd, 0x00077efd, 0x00077ffd, 0x0000c0fd, 0x000782fd, 0x000783fd, 0x000784fd, 0x000785fd,
+	0x000786fd, 0x000788fd, 0x000789fd, 0x0000c1fd, 0x00078bfd, 0x00078cfd, 0x00078efd, 0x00078ffd,
+	0x000790fd, 0x000791fd, 0x000792fd, 0x0000c2fd, 0x000795fd, 0x000796fd, 0x000797fd, 0x000798fd,
+	0x000799fd, 0x00079bfd, 0x00079cfd, 0x00079dfd, 0x0000c3fd, 0x00079ffd, 0x0007a1fd, 0x0007a2fd,
+	0x0007a3fd, 0x0007a4fd, 0x0007a5fd, 0x0007a7fd, 0x0000c4fd, 0x0007a9fd, 0x0007aafd, 0x0007abfd,
+	0x0007adfd, 0x0007aefd, 0x0007affd, 0x0007b0fd, 0x0007b1fd, 0x0000c5fd, 0x0007b4fd, 0x0007b5fd,
+	0x0007b6fd, 0x0007b7fd, 0x0007b8fd, 0x0007bafd, 0x0007bbfd, 0x0000c6fd, 0x0007bdfd, 0x0007befd,
+	0x0007c0fd, 0x0007c1fd, 0x0007c2fd, 0x0007c3fd, 0x0007c4fd, 0x0000c7fd, 0x0007c7fd, 0x0007c8fd,
+	0x0007c9fd, 0x0007cafd, 0x0007ccfd, 0x0007cdfd, 0x0007cefd, 0x0007cffd, 0x000002fd, 0x0007d2fd,
+	0x0007d3fd, 0x0007d4fd, 0x0007d5fd, 0x0007d6fd, 0x0007d7fd, 0x0007d9fd, 0x0000c9fd, 0x0007dbfd,
+	0x0007dcfd, 0x0007ddfd, 0x0007dffd, 0x0007e0fd, 0x0007e1fd, 0x0007e2fd, 0x0000cafd, 0x0007e5fd,
+	0x0007e6fd, 0x0007e7fd, 0x0007e8fd, 0x0007e9fd, 0x0007ebfd, 0x0007ecfd, 0x0007edfd, 0x0000cbfd,
+	0x0007effd, 0x0007f1fd, 0x0007f2fd, 0x0007f3fd, 0x0007f4fd, 0x0007f5fd, 0x0007f6fd, 0x0000ccfd,
+	0x0007f9fd, 0x0007fafd, 0x0007fbfd, 0x0007fcfd, 0x0007fefd, 0x0007fffd, 0x000800fd, 0x000801fd,
+	0x0000cdfd, 0x000804fd, 0x000805fd, 0x000806fd, 0x000807fd, 0x000808fd, 0x00080afd, 0x00080bfd,
+	0x0000cefd, 0x00080dfd, 0x00080efd, 0x000810fd, 0x000811fd, 0x000812fd, 0x000813fd, 0x000814fd,
+	0x0000cffd, 0x000817fd, 0x000818fd, 0x000819fd, 0x00081afd, 0x00081bfd, 0x00081dfd, 0x00081efd,
+	0x00081ffd, 0x0000d0fd, 0x000821fd, 0x000823fd, 0x000824fd, 0x000825fd, 0x000826fd, 0x000827fd,
+	0x000829fd, 0x0000d1fd, 0x00082bfd, 0x00082cfd, 0x00082dfd, 0x00082ffd, 0x000830fd, 0x000831fd,
+	0x000832fd, 0x000833fd, 0x000015fd, 0x000836fd, 0x000837fd, 0x000838fd, 0x000839fd, 0x00083afd,
+	0x00083cfd, 0x00083dfd, 0x0000d3fd, 0x00083ffd, 0x000840fd, 0x000842fd, 0x000843fd, 0x000844fd,
+	0x000845fd, 0x000846fd, 0x0000d4fd, 0x000849fd, 0x00084afd, 0x00084bfd, 0x00084cfd, 0x00084efd,
+	0x00084ffd, 0x000850fd, 0x000851fd, 0x0000d5fd, 0x000853fd, 0x000855fd, 0x000856fd, 0x000857fd,
+	0x000858fd, 0x000859fd, 0x00085bfd, 0x0000d6fd, 0x00085dfd, 0x00085efd, 0x00085ffd, 0x000861fd,
+	0x000862fd, 0x000863fd, 0x000864fd, 0x000865fd, 0x0000d7fd, 0x000868fd, 0x000869fd, 0x00086afd,
+	0x00086bfd, 0x00086cfd, 0x00086efd, 0x00086ffd, 0x0000d8fd, 0x000871fd, 0x000872fd, 0x000874fd,
+	0x000875fd, 0x000876fd, 0x000877fd, 0x000878fd, 0x0000d9fd, 0x00087bfd, 0x00087cfd, 0x00087dfd,
+	0x00087efd, 0x000880fd, 0x000881fd, 0x000882fd, 0x000883fd, 0x0000dafd, 0x000886fd, 0x000887fd,
+	0x000888fd, 0x000889fd, 0x00088afd, 0x00088bfd, 0x00088dfd, 0x0000dbfd, 0x00088ffd, 0x000890fd,
+	0x000891fd, 0x000893fd, 0x000894fd, 0x000895fd, 0x000896fd, 0x000016fd, 0x000899fd, 0x00089afd,
+	0x00089bfd, 0x00089cfd, 0x00089dfd, 0x00089ffd, 0x0008a0fd, 0x0008a1fd, 0x0000ddfd, 0x0008a3fd,
+	0x0008a5fd, 0x0008a6fd, 0x0008a7fd, 0x0008a8fd, 0x0008a9fd, 0x0008aafd, 0x0000defd, 0x0008adfd,
+	0x0008aefd, 0x0008affd, 0x0008b0fd, 0x0008b2fd, 0x0008b3fd, 0x0008b4fd, 0x0008b5fd, 0x0000dffd,
+	0x0008b8fd, 0x0008b9fd, 0x0008bafd, 0x0008bbfd, 0x0008bcfd, 0x0008befd, 0x0008bffd, 0x0000e0fd,
+	0x0008c1fd, 0x0008c2fd, 0x0008c4fd, 0x0008c5fd, 0x0008c6fd, 0x0008c7fd, 0x0008c8fd, 0x0000e1fd,
+	0x0008cbfd, 0x0008ccfd, 0x0008cdfd, 0x0008cefd, 0x0008cffd, 0x0008d1fd, 0x0008d2fd, 0x0008d3fd,
+	0x0000e2fd, 0x0008d5fd, 0x0008d7fd, 0x0008d8fd, 0x0008d9fd, 0x0008dafd, 0x0008dbfd, 0x0008ddfd,
+	0x0000e3fd, 0x0008dffd, 0x0008e0fd, 0x0008e1fd, 0x0008e3fd, 0x0008e4fd, 0x0008e5fd, 0x0008e6fd,
+	0x0008e7fd, 0x0000e4fd, 0x0008eafd, 0x0008ebfd, 0x0008ecfd, 0x0008edfd, 0x0008eefd, 0x0008f0fd,
+	0x0008f1fd, 0x0000e5fd, 0x0008f3fd, 0x0008f4fd, 0x0008f6fd, 0x0008f7fd, 0x0008f8fd, 0x0008f9fd,
+	0x0008fafd, 0x000017fd, 0x0008fdfd, 0x0008fefd, 0x0008fffd, 0x000900fd, 0x000902fd, 0x000903fd,
+	0x000904fd, 0x000905fd, 0x0000e7fd, 0x000907fd, 0x000909fd, 0x00090afd, 0x00090bfd, 0x00090cfd,
+	0x00090dfd, 0x00090ffd, 0x0000e8fd, 0x000911fd, 0x000912fd, 0x000913fd, 0x000915fd, 0x000916fd,
+	0x000917fd, 0x000918fd, 0x000919fd, 0x0000e9fd, 0x00091cfd, 0x00091dfd, 0x00091efd, 0x00091ffd,
+	0x000921fd, 0x000922fd, 0x000923fd, 0x0000eafd, 0x000925fd, 0x000926fd, 0x000928fd, 0x000929fd,
+	0x00092afd, 0x00092bfd, 0x00092cfd, 0x0000ebfd, 0x00092ffd, 0x000930fd, 0x000931fd, 0x000932fd,
+	0x000934fd, 0x000935fd, 0x000936fd, 0x000937fd, 0x0000ecfd, 0x00093afd, 0x00093bfd, 0x00093cfd,
+	0x00093dfd, 0x00093efd, 0x00093ffd, 0x000941fd, 0x0000edfd, 0x000943fd, 0x000944fd, 0x000945fd,
+	0x000947fd, 0x000948fd, 0x000949fd, 0x00094afd, 0x0000eefd, 0x00094dfd, 0x00094efd, 0x00094ffd,
+	0x000950fd, 0x000951fd, 0x000953fd, 0x000954fd, 0x000955fd, 0x0000effd, 0x000957fd, 0x000959fd,
+	0x00095afd, 0x00095bfd, 0x00095cfd, 0x00095dfd, 0x00095efd, 0x000018fd, 0x000961fd, 0x000962fd,
+	0x000963fd, 0x000964fd, 0x000966fd, 0x000967fd, 0x000968fd, 0x000969fd, 0x0000f1fd, 0x00096cfd,
+	0x00096dfd, 0x00096efd, 0x00096ffd, 0x000970fd, 0x000972fd, 0x000973fd, 0x0000f2fd, 0x000975fd,
+	0x000976fd, 0x000978fd, 0x000979fd, 0x00097afd, 0x00097bfd, 0x00097cfd, 0x0000f3fd, 0x00097ffd,
+	0x000980fd, 0x000981fd, 0x000982fd, 0x000983fd, 0x000985fd, 0x000986fd, 0x000987fd, 0x0000f4fd,
+	0x000989fd, 0x00098cfd, 0x00098efd, 0x000991fd, 0x0000f5fd, 0x000995fd, 0x000998fd, 0x00099afd,
+	0x0000f6fd, 0x00099ffd, 0x0009a1fd, 0x0009a4fd, 0x0000f7fd, 0x0009a8fd, 0x0009abfd, 0x0009adfd,
+	0x0000f8fd, 0x0009b2fd, 0x0009b4fd, 0x0009b7fd, 0x0000f9fd, 0x0009bbfd, 0x0009befd, 0x0009c0fd,
+	0x0009c3fd, 0x000019fd, 0x0009c7fd, 0x0009cafd, 0x0009ccfd, 0x0000fbfd, 0x0009d1fd, 0x0009d3fd,
+	0x0009d6fd, 0x0000fcfd, 0x0009dafd, 0x0009ddfd, 0x0009dffd, 0x0000fdfd, 0x0009e4fd, 0x0009e6fd,
+	0x0009e9fd, 0x0000fefd, 0x0009eefd, 0x0009f0fd, 0x0009f2fd, 0x0009f5fd, 0x0000fffd, 0x0009f9fd,
+	0x0009fcfd, 0x0009fefd, 0x000100fd, 0x000a03fd, 0x000a05fd, 0x000a08fd, 0x000101fd, 0x000a0dfd,
+	0x000a0ffd, 0x000a11fd, 0x000102fd, 0x000a16fd, 0x000a18fd, 0x000a1bfd, 0x000103fd, 0x000a20fd,
+	0x000a22fd, 0x000a24fd, 0x000a27fd, 0x00001afd, 0x000a2cfd, 0x000a2efd, 0x000a30fd, 0x000105fd,
+	0x000a35fd, 0x000a37fd, 0x000a3afd, 0x000106fd, 0x000a3ffd, 0x000a41fd, 0x000a43fd, 0x000107fd,
+	0x000a48fd, 0x000a4bfd, 0x000a4dfd, 0x000108fd, 0x000a52fd, 0x000a54fd, 0x000a56fd, 0x000109fd,
+	0x000a5bfd, 0x000a5efd, 0x000a60fd, 0x000a62fd, 0x00010afd, 0x000a67fd, 0x000a6afd, 0x000a6cfd,
+	0x00010bfd, 0x000a71fd, 0x000a73fd, 0x000a75fd, 0x00010cfd, 0x000a7afd, 0x000a7dfd, 0x000a7ffd,
+	0x00010dfd, 0x000a84fd, 0x000a86fd, 0x000a89fd, 0x00001bfd, 0x000a8dfd, 0x000a90fd, 0x000a92fd,
+	0x000a94fd, 0x00010ffd, 0x000a99fd, 0x000a9cfd, 0x000a9efd, 0x000110fd, 0x000aa3fd, 0x000aa5fd,
+	0x000aa8fd, 0x000111fd, 0x000aacfd, 0x000aaffd, 0x000ab1fd, 0x000112fd, 0x000ab6fd, 0x000ab8fd,
+	0x000abbfd, 0x000113fd, 0x000abffd, 0x000ac2fd, 0x000ac4fd, 0x000ac7fd, 0x000114fd, 0x000acbfd,
+	0x000acefd, 0x000ad0fd, 0x000115fd, 0x000ad5fd, 0x000ad7fd, 0x000adafd, 0x000116fd, 0x000adefd,
+	0x000ae1fd, 0x000ae3fd, 0x000117fd, 0x000ae8fd, 0x000aeafd, 0x000aedfd, 0x00001cfd, 0x000af1fd,
+	0x000af4fd, 0x000af6fd, 0x000af9fd, 0x000119fd, 0x000afdfd, 0x000b00fd, 0x000b02fd, 0x00011afd,
+	0x000b07fd, 0x000b09fd, 0x000b0cfd, 0x00011bfd, 0x000b10fd, 0x000b13fd, 0x000b15fd, 0x00011cfd,
+	0x000b1afd, 0x000b1cfd, 0x000b1ffd, 0x00011dfd, 0x000b23fd, 0x000b26fd, 0x000b28fd, 0x000b2bfd,
+	0x00011efd, 0x000b2ffd, 0x000b32fd, 0x000b34fd, 0x00011ffd, 0x000b39fd, 0x000b3bfd, 0x000b3efd,
+	0x000120fd, 0x000b42fd, 0x000b45fd, 0x000b47fd, 0x000121fd, 0x000b4cfd, 0x000b4efd, 0x000b51fd,
+	0x00001dfd, 0x000b56fd, 0x000b58fd, 0x000b5afd, 0x000b5dfd, 0x000123fd, 0x000b61fd, 0x000b64fd,
+	0x000b66fd, 0x000124fd, 0x000b6bfd, 0x000b6dfd, 0x000b70fd, 0x000125fd, 0x000b75fd, 0x000b77fd,
+	0x000b79fd, 0x000126fd, 0x000b7efd, 0x000b80fd, 0x000b83fd, 0x000127fd, 0x000b88fd, 0x000b8afd,
+	0x000b8cfd, 0x000b8ffd, 0x000128fd, 0x000b94fd, 0x000b96fd, 0x000b98fd, 0x000129fd, 0x000b9dfd,
+	0x000b9ffd, 0x000ba2fd, 0x00012afd, 0x000ba7fd, 0x000ba9fd, 0x000babfd, 0x00012bfd, 0x000bb0fd,
+	0x000bb3fd, 0x000bb5fd, 0x000003fd, 0x000bbafd, 0x000bbcfd, 0x000bbefd, 0x00012dfd, 0x000bc3fd,
+	0x000bc6fd, 0x000bc8fd, 0x000bcafd, 0x00012efd, 0x000bcffd, 0x000bd2fd, 0x000bd4fd, 0x00012ffd,
+	0x000bd9fd, 0x000bdbfd, 0x000bddfd, 0x000130fd, 0x000be2fd, 0x000be5fd, 0x000be7fd, 0x000131fd,
+	0x000becfd, 0x000beefd, 0x000bf1fd, 0x000132fd, 0x000bf5fd, 0x000bf8fd, 0x000bfafd, 0x000bfcfd,
+	0x000133fd, 0x000c01fd, 0x000c04fd, 0x000c06fd, 0x000134fd, 0x000c0bfd, 0x000c0dfd, 0x000c10fd,
+	0x000135fd, 0x000c14fd, 0x000c17fd, 0x000c19fd, 0x00001ffd, 0x000c1efd, 0x000c20fd, 0x000c23fd,
+	0x000137fd, 0x000c27fd, 0x000c2afd, 0x000c2cfd, 0x000c2ffd, 0x000138fd, 0x000c33fd, 0x000c36fd,
+	0x000c38fd, 0x000139fd, 0x000c3dfd, 0x000c3ffd, 0x000c42fd, 0x00013afd, 0x000c46fd, 0x000c49fd,
+	0x000c4bfd, 0x00013bfd, 0x000c50fd, 0x000c52fd, 0x000c55fd, 0x00013cfd, 0x000c59fd, 0x000c5cfd,
+	0x000c5efd, 0x000c61fd, 0x00013dfd, 0x000c65fd, 0x000c68fd, 0x000c6afd, 0x00013efd, 0x000c6ffd,
+	0x000c71fd, 0x000c74fd, 0x00013ffd, 0x000c78fd, 0x000c7bfd, 0x000c7dfd, 0x000020fd, 0x000c82fd,
+	0x000c84fd, 0x000c87fd, 0x000141fd, 0x000c8bfd, 0x000c8efd, 0x000c90fd, 0x000c93fd, 0x000142fd,
+	0x000c97fd, 0x000c9afd, 0x000c9cfd, 0x000143fd, 0x000ca1fd, 0x000ca3fd, 0x000ca6fd, 0x000144fd,
+	0x000caafd, 0x000cadfd, 0x000caffd, 0x000145fd, 0x000cb4fd, 0x000cb6fd, 0x000cb9fd, 0x000146fd,
+	0x000cbefd, 0x000cc0fd, 0x000cc2fd, 0x000cc5fd, 0x000147fd, 0x000cc9fd, 0x000cccfd, 0x000ccefd,
+	0x000148fd, 0x000cd3fd, 0x000cd5fd, 0x000cd8fd, 0x000149fd, 0x000cddfd, 0x000cdffd, 0x000ce1fd,
+	0x000021fd, 0x000ce6fd, 0x000ce8fd, 0x000cebfd, 0x00014bfd, 0x000cf0fd, 0x000cf2fd, 0x000cf4fd,
+	0x000cf7fd, 0x00014cfd, 0x000cfcfd, 0x000cfefd, 0x000d00fd, 0x00014dfd, 0x000d05fd, 0x000d07fd,
+	0x000d0afd, 0x00014efd, 0x000d0ffd, 0x000d11fd, 0x000d13fd, 0x00014ffd, 0x000d18fd, 0x000d1bfd,
+	0x000d1dfd, 0x000150fd, 0x000d22fd, 0x000d24fd, 0x000d26fd, 0x000151fd, 0x000d2bfd, 0x000d2efd,
+	0x000d30fd, 0x000d32fd, 0x000152fd, 0x000d37fd, 0x000d3afd, 0x000d3cfd, 0x000153fd, 0x000d41fd,
+	0x000d43fd, 0x000d45fd, 0x000022fd, 0x000d4afd, 0x000d4dfd, 0x000d4ffd, 0x000155fd, 0x000d54fd,
+	0x000d56fd, 0x000d59fd, 0x000156fd, 0x000d5dfd, 0x000d60fd, 0x000d62fd, 0x000d64fd, 0x000157fd,
+	0x000d69fd, 0x000d6cfd, 0x000d6efd, 0x000158fd, 0x000d73fd, 0x000d75fd, 0x000d78fd, 0x000159fd,
+	0x000d7cfd, 0x000d7ffd, 0x000d81fd, 0x00015afd, 0x000d86fd, 0x000d88fd, 0x000d8bfd, 0x00015bfd,
+	0x000d8ffd, 0x000d92fd, 0x000d94fd, 0x000d97fd, 0x00015cfd, 0x000d9bfd, 0x000d9efd, 0x000da0fd,
+	0x00015dfd, 0x000da5fd, 0x000da7fd, 0x000daafd, 0x000023fd, 0x000daefd, 0x000db1fd, 0x000db3fd,
+	0x00015ffd, 0x000db8fd, 0x000dbafd, 0x000dbdfd, 0x000160fd, 0x000dc1fd, 0x000dc4fd, 0x000dc6fd,
+	0x000dc9fd, 0x000161fd, 0x000dcdfd, 0x000dd0fd, 0x000dd2fd, 0x000162fd, 0x000dd7fd, 0x000dd9fd,
+	0x000ddcfd, 0x000163fd, 0x000de0fd, 0x000de3fd, 0x000de5fd, 0x000164fd, 0x000deafd, 0x000decfd,
+	0x000deffd, 0x000165fd, 0x000df4fd, 0x000df6fd, 0x000df8fd, 0x000dfbfd, 0x000166fd, 0x000dfffd,
+	0x000e02fd, 0x000e04fd, 0x000167fd, 0x000e09fd, 0x000e0bfd, 0x000e0efd, 0x000024fd, 0x000e13fd,
+	0x000e15fd, 0x000e17fd, 0x000169fd, 0x000e1cfd, 0x000e1efd, 0x000e21fd, 0x00016afd, 0x000e26fd,
+	0x000e28fd, 0x000e2afd, 0x000e2dfd, 0x00016bfd, 0x000e31fd, 0x000e34fd, 0x000e36fd, 0x00016cfd,
+	0x000e3bfd, 0x000e3dfd, 0x000e40fd, 0x00016dfd, 0x000e45fd, 0x000e47fd, 0x000e49fd, 0x00016efd,
+	0x000e4efd, 0x000e50fd, 0x000e53fd, 0x00016ffd, 0x000e58fd, 0x000e5afd, 0x000e5cfd, 0x000e5ffd,
+	0x000170fd, 0x000e64fd, 0x000e66fd, 0x000e68fd, 0x000171fd, 0x000e6dfd, 0x000e6ffd, 0x000e72fd,
+	0x000025fd, 0x000e77fd, 0x000e79fd, 0x000e7bfd, 0x000173fd, 0x000e80fd, 0x000e83fd, 0x000e85fd,
+	0x000174fd, 0x000e8afd, 0x000e8cfd, 0x000e8efd, 0x000175fd, 0x000e93fd, 0x000e96fd, 0x000e98fd,
+	0x000e9afd, 0x000176fd, 0x000e9ffd, 0x000ea2fd, 0x000ea4fd, 0x000177fd, 0x000ea9fd, 0x000eabfd,
+	0x000eadfd, 0x000178fd, 0x000eb2fd, 0x000eb5fd, 0x000eb7fd, 0x000179fd, 0x000ebcfd, 0x000ebefd,
+	0x000ec1fd, 0x00017afd, 0x000ec5fd, 0x000ec8fd, 0x000ecafd, 0x000eccfd, 0x00017bfd, 0x000ed1fd,
+	0x000ed4fd, 0x000ed6fd, 0x000026fd, 0x000edbfd, 0x000eddfd, 0x000ee0fd, 0x00017dfd, 0x000ee4fd,
+	0x000ee7fd, 0x000ee9fd, 0x00017efd, 0x000eeefd, 0x000ef0fd, 0x000ef3fd, 0x00017ffd, 0x000ef7fd,
+	0x000efafd, 0x000efcfd, 0x000efffd, 0x000180fd, 0x000f03fd, 0x000f06fd, 0x000f08fd, 0x000181fd,
+	0x000f0dfd, 0x000f0ffd, 0x000f12fd, 0x000182fd, 0x000f16fd, 0x000f19fd, 0x000f1bfd, 0x000183fd,
+	0x000f20fd, 0x000f22fd, 0x000f25fd, 0x000184fd, 0x000f29fd, 0x000f2cfd, 0x000f2efd, 0x000f31fd,
+	0x000185fd, 0x000f35fd, 0x000f38fd, 0x000f3afd, 0x000027fd, 0x000f3ffd, 0x000f41fd, 0x000f44fd,
+	0x000187fd, 0x000f48fd, 0x000f4bfd, 0x000f4dfd, 0x000188fd, 0x000f52fd, 0x000f54fd, 0x000f57fd,
+	0x000189fd, 0x000f5cfd, 0x000f5efd, 0x000f60fd, 0x000f63fd, 0x00018afd, 0x000f67fd, 0x000f6afd,
+	0x000f6cfd, 0x00018bfd, 0x000f71fd, 0x000f73fd, 0x000f76fd, 0x00018cfd, 0x000f7bfd, 0x000f7dfd,
+	0x000f7ffd, 0x00018dfd, 0x000f84fd, 0x000f86fd, 0x000f89fd, 0x00018efd, 0x000f8efd, 0x000f90fd,
+	0x000f92fd, 0x000f95fd, 0x00018ffd, 0x000f9afd, 0x000f9cfd, 0x000f9efd, 0x000004fd, 0x000fa3fd,
+	0x000fa5fd, 0x000fa8fd, 0x000191fd, 0x000fadfd, 0x000faffd, 0x000fb1fd, 0x000192fd, 0x000fb6fd,
+	0x000fb9fd, 0x000fbbfd, 0x000193fd, 0x000fc0fd, 0x000fc2fd, 0x000fc4fd, 0x000194fd, 0x000fc9fd,
+	0x000fccfd, 0x000fcefd, 0x000fd0fd, 0x000195fd, 0x000fd5fd, 0x000fd8fd, 0x000fdafd, 0x000196fd,
+	0x000fdffd, 0x000fe1fd, 0x000fe3fd, 0x000197fd, 0x000fe8fd, 0x000febfd, 0x000fedfd, 0x000198fd,
+	0x000ff2fd, 0x000ff4fd, 0x000ff6fd, 0x000199fd, 0x000ffbfd, 0x000ffefd, 0x001000fd, 0x001002fd,
+	0x000029fd, 0x001007fd, 0x00100afd, 0x00100cfd, 0x00019bfd, 0x001011fd, 0x001013fd, 0x001015fd,
+	0x00019cfd, 0x00101afd, 0x00101dfd, 0x00101ffd, 0x00019dfd, 0x001024fd, 0x001026fd, 0x001029fd,
+	0x00019efd, 0x00102dfd, 0x001030fd, 0x001032fd, 0x001034fd, 0x00019ffd, 0x001039fd, 0x00103cfd,
+	0x00103efd, 0x0001a0fd, 0x001043fd, 0x001045fd, 0x001048fd, 0x0001a1fd, 0x00104cfd, 0x00104ffd,
+	0x001051fd, 0x0001a2fd, 0x001056fd, 0x001058fd, 0x00105bfd, 0x0001a3fd, 0x00105ffd, 0x001062fd,
+	0x001064fd, 0x001067fd, 0x00002afd, 0x00106bfd, 0x00106efd, 0x001070fd, 0x0001a5fd, 0x001075fd,
+	0x001077fd, 0x00107afd, 0x0001a6fd, 0x00107efd, 0x001081fd, 0x001083fd, 0x0001a7fd, 0x001088fd,
+	0x00108afd, 0x00108dfd, 0x0001a8fd, 0x001091fd, 0x001094fd, 0x001096fd, 0x001099fd, 0x0001a9fd,
+	0x00109dfd, 0x0010a0fd, 0x0010a2fd, 0x0001aafd, 0x0010a7fd, 0x0010a9fd, 0x0010acfd, 0x0001abfd,
+	0x0010b0fd, 0x0010b3fd, 0x0010b5fd, 0x0001acfd, 0x0010bafd, 0x0010bcfd, 0x0010bffd, 0x0001adfd,
+	0x0010c4fd, 0x0010c6fd, 0x0010c8fd, 0x0010cbfd, 0x00002bfd, 0x0010cffd, 0x0010d2fd, 0x0010d4fd,
+	0x0001affd, 0x0010d9fd, 0x0010dbfd, 0x0010defd, 0x0001b0fd, 0x0010e3fd, 0x0010e5fd, 0x0010e7fd,
+	0x0001b1fd, 0x0010ecfd, 0x0010eefd, 0x0010f1fd, 0x0001b2fd, 0x0010f6fd, 0x0010f8fd, 0x0010fafd,
+	0x0010fdfd, 0x0001b3fd, 0x001102fd, 0x001104fd, 0x001106fd, 0x0001b4fd, 0x00110bfd, 0x00110dfd,
+	0x001110fd, 0x0001b5fd, 0x001115fd, 0x001117fd, 0x001119fd, 0x0001b6fd, 0x00111efd, 0x001121fd,
+	0x001123fd, 0x0001b7fd, 0x001128fd, 0x00112afd, 0x00112cfd, 0x00002cfd, 0x001131fd, 0x001134fd,
+	0x001136fd, 0x001138fd, 0x0001b9fd, 0x00113dfd, 0x001140fd, 0x001142fd, 0x0001bafd, 0x001147fd,
+	0x001149fd, 0x00114bfd, 0x0001bbfd, 0x001150fd, 0x001153fd, 0x001155fd, 0x0001bcfd, 0x00115afd,
+	0x00115cfd, 0x00115ffd, 0x0001bdfd, 0x001163fd, 0x001166fd, 0x001168fd, 0x00116afd, 0x0001befd,
+	0x00116ffd, 0x001172fd, 0x001174fd, 0x0001bffd, 0x001179fd, 0x00117bfd, 0x00117efd, 0x0001c0fd,
+	0x001182fd, 0x001185fd, 0x001187fd, 0x0001c1fd, 0x00118cfd, 0x00118efd, 0x001191fd, 0x00002dfd,
+	0x001195fd, 0x001198fd, 0x00119afd, 0x00119cfd, 0x0001c3fd, 0x0011a1fd, 0x0011a4fd, 0x0011a6fd,
+	0x0001c4fd, 0x0011abfd, 0x0011adfd, 0x0011b0fd, 0x0001c5fd, 0x0011b4fd, 0x0011b7fd, 0x0011b9fd,
+	0x0001c6fd, 0x0011befd, 0x0011c0fd, 0x0011c3fd, 0x0001c7fd, 0x0011c7fd, 0x0011cafd, 0x0011ccfd,
+	0x0011cffd, 0x0001c8fd, 0x0011d3fd, 0x0011d6fd, 0x0011d8fd, 0x0001c9fd, 0x0011ddfd, 0x0011dffd,
+	0x0011e2fd, 0x0001cafd, 0x0011e6fd, 0x0011e9fd, 0x0011ebfd, 0x0001cbfd, 0x0011f0fd, 0x0011f2fd,
+	0x0011f5fd, 0x00002efd, 0x0011f9fd, 0x0011fcfd, 0x0011fefd, 0x001201fd, 0x0001cdfd, 0x001205fd,
+	0x001208fd, 0x00120afd, 0x0001cefd, 0x00120ffd, 0x001211fd, 0x001214fd, 0x0001cffd, 0x001218fd,
+	0x00121bfd, 0x00121dfd, 0x0001d0fd, 0x001222fd, 0x001224fd, 0x001227fd, 0x0001d1fd, 0x00122cfd,
+	0x00122efd, 0x001230fd, 0x001233fd, 0x0001d2fd, 0x001237fd, 0x00123afd, 0x00123cfd, 0x0001d3fd,
+	0x001241fd, 0x001243fd, 0x001246fd, 0x0001d4fd, 0x00124bfd, 0x00124dfd, 0x00124ffd, 0x0001d5fd,
+	0x001254fd, 0x001256fd, 0x001259fd, 0x00002ffd, 0x00125efd, 0x001260fd, 0x001262fd, 0x001265fd,
+	0x0001d7fd, 0x00126afd, 0x00126cfd, 0x00126efd, 0x0001d8fd, 0x001273fd, 0x001275fd, 0x001278fd,
+	0x0001d9fd, 0x00127dfd, 0x00127ffd, 0x001281fd, 0x0001dafd, 0x001286fd, 0x001289fd, 0x00128bfd,
+	0x0001dbfd, 0x001290fd, 0x001292fd, 0x001294fd, 0x0001dcfd, 0x001299fd, 0x00129cfd, 0x00129efd,
+	0x0012a0fd, 0x0001ddfd, 0x0012a5fd, 0x0012a8fd, 0x0012aafd, 0x0001defd, 0x0012affd, 0x0012b1fd,
+	0x0012b3fd, 0x0001dffd, 0x0012b8fd, 0x0012bbfd, 0x0012bdfd, 0x000030fd, 0x0012c2fd, 0x0012c4fd,
+	0x0012c7fd, 0x0001e1fd, 0x0012cbfd, 0x0012cefd, 0x0012d0fd, 0x0012d2fd, 0x0001e2fd, 0x0012d7fd,
+	0x0012dafd, 0x0012dcfd, 0x0001e3fd, 0x0012e1fd, 0x0012e3fd, 0x0012e6fd, 0x0001e4fd, 0x0012eafd,
+	0x0012edfd, 0x0012effd, 0x0001e5fd, 0x0012f4fd, 0x0012f6fd, 0x0012f9fd, 0x0001e6fd, 0x0012fdfd,
+	0x001300fd, 0x001302fd, 0x001305fd, 0x0001e7fd, 0x001309fd, 0x00130cfd, 0x00130efd, 0x0001e8fd,
+	0x001313fd, 0x001318fd, 0x0001e9fd, 0x001321fd, 0x000031fd, 0x00132bfd, 0x0001ebfd, 0x001334fd,
+	0x0001ecfd, 0x00133efd, 0x0001edfd, 0x001347fd, 0x0001eefd, 0x001351fd, 0x0001effd, 0x00135afd,
+	0x0001f0fd, 0x001364fd, 0x0001f1fd, 0x00136dfd, 0x0001f2fd, 0x001377fd, 0x0001f3fd, 0x001380fd,
+	0x001385fd, 0x000005fd, 0x00138ffd, 0x0001f5fd, 0x001398fd, 0x0001f6fd, 0x0013a2fd, 0x0001f7fd,
+	0x0013abfd, 0x0001f8fd, 0x0013b5fd, 0x0001f9fd, 0x0013befd, 0x0001fafd, 0x0013c8fd, 0x0001fbfd,
+	0x0013d2fd, 0x0001fcfd, 0x0013dbfd, 0x0001fdfd, 0x0013e5fd, 0x0013e9fd, 0x000033fd, 0x0013f3fd,
+	0x0001fffd, 0x0013fcfd, 0x000200fd, 0x001406fd, 0x000201fd, 0x001410fd, 0x000202fd, 0x001419fd,
+	0x000203fd, 0x001423fd, 0x000204fd, 0x00142cfd, 0x000205fd, 0x001436fd, 0x000206fd, 0x00143ffd,
+	0x000207fd, 0x001449fd, 0x00144efd, 0x000034fd, 0x001457fd, 0x000209fd, 0x001461fd, 0x00020afd,
+	0x00146afd, 0x00020bfd, 0x001474fd, 0x00020cfd, 0x00147dfd, 0x00020dfd, 0x001487fd, 0x00020efd,
+	0x001490fd, 0x00020ffd, 0x00149afd, 0x000210fd, 0x0014a3fd, 0x000211fd, 0x0014adfd, 0x000035fd,
+	0x0014b6fd, 0x0014bbfd, 0x000213fd, 0x0014c5fd, 0x000214fd, 0x0014cefd, 0x000215fd, 0x0014d8fd,
+	0x000216fd, 0x0014e1fd, 0x000217fd, 0x0014ebfd, 0x000218fd, 0x0014f4fd, 0x000219fd, 0x0014fefd,
+	0x00021afd, 0x001507fd, 0x00021bfd, 0x001511fd, 0x000036fd, 0x00151bfd, 0x00151ffd, 0x00021dfd,
+	0x001529fd, 0x00021efd, 0x001532fd, 0x00021ffd, 0x00153cfd, 0x000220fd, 0x001545fd, 0x000221fd,
+	0x00154ffd, 0x000222fd, 0x001559fd, 0x000223fd, 0x001562fd, 0x000224fd, 0x00156cfd, 0x000225fd,
+	0x001575fd, 0x000037fd, 0x00157ffd, 0x001583fd, 0x000227fd, 0x00158dfd, 0x000228fd, 0x001597fd,
+	0x000229fd, 0x0015a0fd, 0x00022afd, 0x0015aafd, 0x00022bfd, 0x0015b3fd, 0x00022cfd, 0x0015bdfd,
+	0x00022dfd, 0x0015c6fd, 0x00022efd, 0x0015d0fd, 0x00022ffd, 0x0015d9fd, 0x000038fd, 0x0015e3fd,
+	0x0015e8fd, 0x000231fd, 0x0015f1fd, 0x000232fd, 0x0015fbfd, 0x000233fd, 0x001604fd, 0x000234fd,
+	0x00160efd, 0x000235fd, 0x001617fd, 0x000236fd, 0x001621fd, 0x000237fd, 0x00162afd, 0x000238fd,
+	0x001634fd, 0x000239fd, 0x00163dfd, 0x000039fd, 0x001647fd, 0x00023bfd, 0x001651fd, 0x001655fd,
+	0x00023cfd, 0x00165ffd, 0x00023dfd, 0x001668fd, 0x00023efd, 0x001672fd, 0x00023ffd, 0x00167bfd,
+	0x000240fd, 0x001685fd, 0x000241fd, 0x00168efd, 0x000242fd, 0x001698fd, 0x000243fd, 0x0016a2fd,
+	0x00003afd, 0x0016abfd, 0x000245fd, 0x0016b5fd, 0x0016b9fd, 0x000246fd, 0x0016c3fd, 0x000247fd,
+	0x0016ccfd, 0x000248fd, 0x0016d6fd, 0x000249fd, 0x0016e0fd, 0x00024afd, 0x0016e9fd, 0x00024bfd,
+	0x0016f3fd, 0x00024cfd, 0x0016fcfd, 0x00024dfd, 0x001706fd, 0x00003bfd, 0x00170ffd, 0x00024ffd,
+	0x001719fd, 0x00171efd, 0x000250fd, 0x001727fd, 0x000251fd, 0x001731fd, 0x000252fd, 0x00173afd,
+	0x000253fd, 0x001744fd, 0x000254fd, 0x00174dfd, 0x000255fd, 0x001757fd, 0x000256fd, 0x001760fd,
+	0x000257fd, 0x00176afd, 0x000006fd, 0x001773fd, 0x000259fd, 0x00177dfd, 0x00025afd, 0x001786fd,
+	0x00178bfd, 0x00025bfd, 0x001795fd, 0x00025cfd, 0x00179efd, 0x00025dfd, 0x0017a8fd, 0x00025efd,
+	0x0017b1fd, 0x00025ffd, 0x0017bbfd, 0x000260fd, 0x0017c4fd, 0x000261fd, 0x0017cefd, 0x00003dfd,
+	0x0017d8fd, 0x000263fd, 0x0017e1fd, 0x000264fd, 0x0017ebfd, 0x0017effd, 0x000265fd, 0x0017f9fd,
+	0x000266fd, 0x001802fd, 0x000267fd, 0x00180cfd, 0x000268fd, 0x001816fd, 0x000269fd, 0x00181ffd,
+	0x00026afd, 0x001829fd, 0x00026bfd, 0x001832fd, 0x00003efd, 0x00183cfd, 0x00026dfd, 0x001845fd,
+	0x00026efd, 0x00184ffd, 0x001853fd, 0x00026ffd, 0x00185dfd, 0x000270fd, 0x001867fd, 0x000271fd,
+	0x001870fd, 0x000272fd, 0x00187afd, 0x000273fd, 0x001883fd, 0x000274fd, 0x00188dfd, 0x000275fd,
+	0x001896fd, 0x00003ffd, 0x0018a0fd, 0x000277fd, 0x0018a9fd, 0x000278fd, 0x0018b3fd, 0x000279fd,
+	0x0018bcfd, 0x0018c1fd, 0x00027afd, 0x0018cbfd, 0x00027bfd, 0x0018d4fd, 0x00027cfd, 0x0018defd,
+	0x00027dfd, 0x0018e7fd, 0x00027efd, 0x0018f1fd, 0x00027ffd, 0x0018fafd, 0x000040fd, 0x001904fd,
+	0x000281fd, 0x00190dfd, 0x000282fd, 0x001917fd, 0x000283fd, 0x001921fd, 0x001925fd, 0x000284fd,
+	0x00192ffd, 0x000285fd, 0x001938fd, 0x000286fd, 0x001942fd, 0x000287fd, 0x00194bfd, 0x000288fd,
+	0x001955fd, 0x000289fd, 0x00195ffd, 0x000041fd, 0x001968fd, 0x00028bfd, 0x001972fd, 0x00028cfd,
+	0x00197bfd, 0x00028dfd, 0x001985fd, 0x001989fd, 0x00028efd, 0x001993fd, 0x00028ffd, 0x00199dfd,
+	0x000290fd, 0x0019a6fd, 0x000291fd, 0x0019b0fd, 0x000292fd, 0x0019b9fd, 0x000293fd, 0x0019c3fd,
+	0x000042fd, 0x0019ccfd, 0x000295fd, 0x0019d6fd, 0x000296fd, 0x0019dffd, 0x000297fd, 0x0019e9fd,
+	0x0019eefd, 0x000298fd, 0x0019f7fd, 0x000299fd, 0x001a01fd, 0x00029afd, 0x001a0afd, 0x00029bfd,
+	0x001a14fd, 0x00029cfd, 0x001a1dfd, 0x00029dfd, 0x001a27fd, 0x000043fd, 0x001a30fd, 0x00029ffd,
+	0x001a3afd, 0x0002a0fd, 0x001a43fd, 0x0002a1fd, 0x001a4dfd, 0x0002a2fd, 0x001a56fd, 0x001a5bfd,
+	0x0002a3fd, 0x001a65fd, 0x0002a4fd, 0x001a6efd, 0x0002a5fd, 0x001a78fd, 0x0002a6fd, 0x001a81fd,
+	0x0002a7fd, 0x001a8bfd, 0x000044fd, 0x001a94fd, 0x0002a9fd, 0x001a9efd, 0x0002aafd, 0x001aa8fd,
+	0x0002abfd, 0x001ab1fd, 0x0002acfd, 0x001abbfd, 0x001abffd, 0x0002adfd, 0x001ac9fd, 0x0002aefd,
+	0x001ad2fd, 0x0002affd, 0x001adcfd, 0x0002b0fd, 0x001ae6fd, 0x0002b1fd, 0x001aeffd, 0x000045fd,
+	0x001af9fd, 0x0002b3fd, 0x001b02fd, 0x0002b4fd, 0x001b0cfd, 0x0002b5fd, 0x001b15fd, 0x0002b6fd,
+	0x001b1ffd, 0x001b24fd, 0x0002b7fd, 0x001b2dfd, 0x0002b8fd, 0x001b37fd, 0x0002b9fd, 0x001b40fd,
+	0x0002bafd, 0x001b4afd, 0x0002bbfd, 0x001b53fd, 0x000007fd, 0x001b5dfd, 0x0002bdfd, 0x001b66fd,
+	0x0002befd, 0x001b70fd, 0x0002bffd, 0x001b79fd, 0x0002c0fd, 0x001b83fd, 0x0002c1fd, 0x001b8cfd,
+	0x001b91fd, 0x0002c2fd, 0x001b9bfd, 0x0002c3fd, 0x001ba4fd, 0x0002c4fd, 0x001baefd, 0x0002c5fd,
+	0x001bb7fd, 0x000047fd, 0x001bc1fd, 0x0002c7fd, 0x001bcafd, 0x0002c8fd, 0x001bd4fd, 0x0002c9fd,
+	0x001bddfd, 0x0002cafd, 0x001be7fd, 0x0002cbfd, 0x001bf1fd, 0x001bf5fd, 0x0002ccfd, 0x001bfffd,
+	0x0002cdfd, 0x001c08fd, 0x0002cefd, 0x001c12fd, 0x0002cffd, 0x001c1bfd, 0x000048fd, 0x001c25fd,
+	0x0002d1fd, 0x001c2ffd, 0x0002d2fd, 0x001c38fd, 0x0002d3fd, 0x001c42fd, 0x0002d4fd, 0x001c4bfd,
+	0x0002d5fd, 0x001c55fd, 0x001c59fd, 0x0002d6fd, 0x001c63fd, 0x0002d7fd, 0x001c6dfd, 0x0002d8fd,
+	0x001c76fd, 0x0002d9fd, 0x001c80fd, 0x000049fd, 0x001c89fd, 0x0002dbfd, 0x001c93fd, 0x0002dcfd,
+	0x001c9cfd, 0x0002ddfd, 0x001ca6fd, 0x0002defd, 0x001caffd, 0x0002dffd, 0x001cb9fd, 0x001cbefd,
+	0x0002e0fd, 0x001cc7fd, 0x0002e1fd, 0x001cd1fd, 0x0002e2fd, 0x001cdafd, 0x0002e3fd, 0x001ce4fd,
+	0x00004afd, 0x001cedfd, 0x0002e5fd, 0x001cf7fd, 0x0002e6fd, 0x001d00fd, 0x0002e7fd, 0x001d0afd,
+	0x0002e8fd, 0x001d13fd, 0x0002e9fd, 0x001d1dfd, 0x0002eafd, 0x001d27fd, 0x001d2bfd, 0x0002ebfd,
+	0x001d35fd, 0x0002ecfd, 0x001d3efd, 0x0002edfd, 0x001d48fd, 0x00004bfd, 0x001d51fd, 0x0002effd,
+	0x001d5bfd, 0x0002f0fd, 0x001d64fd, 0x0002f1fd, 0x001d6efd, 0x0002f2fd, 0x001d78fd, 0x0002f3fd,
+	0x001d81fd, 0x0002f4fd, 0x001d8bfd, 0x001d8ffd, 0x0002f5fd, 0x001d99fd, 0x0002f6fd, 0x001da2fd,
+	0x0002f7fd, 0x001dacfd, 0x00004cfd, 0x001db6fd, 0x0002f9fd, 0x001dbffd, 0x0002fafd, 0x001dc9fd,
+	0x0002fbfd, 0x001dd2fd, 0x0002fcfd, 0x001ddcfd, 0x0002fdfd, 0x001de5fd, 0x0002fefd, 0x001deffd,
+	0x001df4fd, 0x0002fffd, 0x001dfdfd, 0x000300fd, 0x001e07fd, 0x000301fd, 0x001e10fd, 0x00004dfd,
+	0x001e1afd, 0x000303fd, 0x001e23fd, 0x000304fd, 0x001e2dfd, 0x000305fd, 0x001e36fd, 0x000306fd,
+	0x001e40fd, 0x000307fd, 0x001e49fd, 0x000308fd, 0x001e53fd, 0x000309fd, 0x001e5cfd, 0x001e61fd,
+	0x00030afd, 0x001e6bfd, 0x00030bfd, 0x001e74fd, 0x00004efd, 0x001e7efd, 0x00030dfd, 0x001e87fd,
+	0x00030efd, 0x001e91fd, 0x00030ffd, 0x001e9afd, 0x000310fd, 0x001ea4fd, 0x000311fd, 0x001eaefd,
+	0x000312fd, 0x001eb7fd, 0x000313fd, 0x001ec1fd, 0x001ec5fd, 0x000314fd, 0x001ecffd, 0x000315fd,
+	0x001ed8fd, 0x00004ffd, 0x001ee2fd, 0x000317fd, 0x001eebfd, 0x000318fd, 0x001ef5fd, 0x000319fd,
+	0x001efffd, 0x00031afd, 0x001f08fd, 0x00031bfd, 0x001f12fd, 0x00031cfd, 0x001f1bfd, 0x00031dfd,
+	0x001f25fd, 0x001f29fd, 0x00031efd, 0x001f33fd, 0x00031ffd, 0x001f3dfd, 0x000008fd, 0x001f46fd,
+	0x000321fd, 0x001f50fd, 0x000322fd, 0x001f59fd, 0x000323fd, 0x001f63fd, 0x000324fd, 0x001f6cfd,
+	0x000325fd, 0x001f76fd, 0x000326fd, 0x001f7ffd, 0x000327fd, 0x001f89fd, 0x000328fd, 0x001f92fd,
+	0x001f97fd, 0x000329fd, 0x001fa1fd, 0x000051fd, 0x001faafd, 0x00032bfd, 0x001fb4fd, 0x00032cfd,
+	0x001fbdfd, 0x00032dfd, 0x001fc7fd, 0x00032efd, 0x001fd0fd, 0x00032ffd, 0x001fdafd, 0x000330fd,
+	0x001fe3fd, 0x000331fd, 0x001fedfd, 0x000332fd, 0x001ff7fd, 0x001ffbfd, 0x000333fd, 0x002005fd,
+	0x000052fd, 0x00200efd, 0x000335fd, 0x002018fd, 0x000336fd, 0x002021fd, 0x000337fd, 0x00202bfd,
+	0x000338fd, 0x002035fd, 0x000339fd, 0x00203efd, 0x00033afd, 0x002048fd, 0x00033bfd, 0x002051fd,
+	0x00033cfd, 0x00205bfd, 0x00205ffd, 0x00033dfd, 0x002069fd, 0x000053fd, 0x002073fd, 0x00033ffd,
+	0x00207cfd, 0x000340fd, 0x002086fd, 0x000341fd, 0x00208ffd, 0x000342fd, 0x002099fd, 0x000343fd,
+	0x0020a2fd, 0x000344fd, 0x0020acfd, 0x000345fd, 0x0020b5fd, 0x000346fd, 0x0020bffd, 0x0020c4fd,
+	0x000347fd, 0x0020cdfd, 0x000054fd, 0x0020d7fd, 0x000349fd, 0x0020e0fd, 0x00034afd, 0x0020eafd,
+	0x00034bfd, 0x0020f3fd, 0x00034cfd, 0x0020fdfd, 0x00034dfd, 0x002106fd, 0x00034efd, 0x002110fd,
+	0x00034ffd, 0x002119fd, 0x000350fd, 0x002123fd, 0x000351fd, 0x00212cfd, 0x002131fd, 0x000055fd,
+	0x00213bfd, 0x000353fd, 0x002144fd, 0x000354fd, 0x00214efd, 0x000355fd, 0x002157fd, 0x000356fd,
+	0x002161fd, 0x000357fd, 0x00216afd, 0x000358fd, 0x002174fd, 0x000359fd, 0x00217efd, 0x00035afd,
+	0x002187fd, 0x00035bfd, 0x002191fd, 0x002195fd, 0x000056fd, 0x00219ffd, 0x00035dfd, 0x0021a8fd,
+	0x00035efd, 0x0021b2fd, 0x00035ffd, 0x0021bcfd, 0x000360fd, 0x0021c5fd, 0x000361fd, 0x0021cffd,
+	0x000362fd, 0x0021d8fd, 0x000363fd, 0x0021e2fd, 0x000364fd, 0x0021ebfd, 0x000365fd, 0x0021f5fd,
+	0x0021fafd, 0x000057fd, 0x002203fd, 0x000367fd, 0x00220dfd, 0x000368fd, 0x002216fd, 0x000369fd,
+	0x002220fd, 0x00036afd, 0x002229fd, 0x00036bfd, 0x002233fd, 0x00036cfd, 0x00223cfd, 0x00036dfd,
+	0x002246fd, 0x00036efd, 0x00224ffd, 0x00036ffd, 0x002259fd, 0x000058fd, 0x002262fd, 0x002267fd,
+	0x000371fd, 0x002271fd, 0x000372fd, 0x00227afd, 0x000373fd, 0x002284fd, 0x000374fd, 0x00228dfd,
+	0x000375fd, 0x002297fd, 0x000376fd, 0x0022a0fd, 0x000377fd, 0x0022aafd, 0x000378fd, 0x0022b3fd,
+	0x000379fd, 0x0022bdfd, 0x000059fd, 0x0022c7fd, 0x0022cbfd, 0x00037bfd, 0x0022d5fd, 0x00037cfd,
+	0x0022defd, 0x00037dfd, 0x0022e8fd, 0x00037efd, 0x0022f1fd, 0x00037ffd, 0x0022fbfd, 0x000380fd,
+	0x002305fd, 0x000381fd, 0x00230efd, 0x000382fd, 0x002318fd, 0x000383fd, 0x002321fd, 0x000009fd,
+	0x00232bfd, 0x00232ffd, 0x000385fd, 0x002339fd, 0x000386fd, 0x002343fd, 0x000387fd, 0x00234cfd,
+	0x000388fd, 0x002356fd, 0x000389fd, 0x00235ffd, 0x00038afd, 0x002369fd, 0x00038bfd, 0x002372fd,
+	0x00038cfd, 0x00237cfd, 0x00038dfd, 0x002385fd, 0x00005bfd, 0x00238ffd, 0x002394fd, 0x00038ffd,
+	0x00239dfd, 0x000390fd, 0x0023a7fd, 0x000391fd, 0x0023b0fd, 0x000392fd, 0x0023bafd, 0x000393fd,
+	0x0023c3fd, 0x000394fd, 0x0023cdfd, 0x000395fd, 0x0023d6fd, 0x000396fd, 0x0023e0fd, 0x000397fd,
+	0x0023e9fd, 0x00005cfd, 0x0023f3fd, 0x000399fd, 0x0023fcfd, 0x002401fd, 0x00039afd, 0x00240bfd,
+	0x00039bfd, 0x002414fd, 0x00039cfd, 0x00241efd, 0x00039dfd, 0x002427fd, 0x00039efd, 0x002431fd,
+	0x00039ffd, 0x00243afd, 0x0003a0fd, 0x002444fd, 0x0003a1fd, 0x00244efd, 0x00005dfd, 0x002457fd,
+	0x0003a3fd, 0x002461fd, 0x002465fd, 0x0003a4fd, 0x00246ffd, 0x0003a5fd, 0x002478fd, 0x0003a6fd,
+	0x002482fd, 0x0003a7fd, 0x00248cfd, 0x0003a8fd, 0x002495fd, 0x0003a9fd, 0x00249ffd, 0x0003aafd,
+	0x0024a8fd, 0x0003abfd, 0x0024b2fd, 0x00005efd, 0x0024bbfd, 0x0003adfd, 0x0024c5fd, 0x0024cafd,
+	0x0003aefd, 0x0024d3fd, 0x0003affd, 0x0024ddfd, 0x0003b0fd, 0x0024e6fd, 0x0003b1fd, 0x0024f0fd,
+	0x0003b2fd, 0x0024f9fd, 0x0003b3fd, 0x002503fd, 0x0003b4fd, 0x00250cfd, 0x0003b5fd, 0x002516fd,
+	0x00005ffd, 0x00251ffd, 0x0003b7fd, 0x002529fd, 0x0003b8fd, 0x002532fd, 0x002537fd, 0x0003b9fd,
+	0x002541fd, 0x0003bafd, 0x00254afd, 0x0003bbfd, 0x002554fd, 0x0003bcfd, 0x00255dfd, 0x0003bdfd,
+	0x002567fd, 0x0003befd, 0x002570fd, 0x0003bffd, 0x00257afd, 0x000060fd, 0x002584fd, 0x0003c1fd,
+	0x00258dfd, 0x0003c2fd, 0x002597fd, 0x00259bfd, 0x0003c3fd, 0x0025a5fd, 0x0003c4fd, 0x0025aefd,
+	0x0003c5fd, 0x0025b8fd, 0x0003c6fd, 0x0025c1fd, 0x0003c7fd, 0x0025cbfd, 0x0003c8fd, 0x0025d5fd,
+	0x0003c9fd, 0x0025defd, 0x000061fd, 0x0025e8fd, 0x0003cbfd, 0x0025f1fd, 0x0003ccfd, 0x0025fbfd,
+	0x0025fffd, 0x0003cdfd, 0x002609fd, 0x0003cefd, 0x002613fd, 0x0003cffd, 0x00261cfd, 0x0003d0fd,
+	0x0003d1fd, 0x00262ffd, 0x0003d2fd, 0x0003d3fd, 0x000062fd, 0x0003d5fd, 0x0003d6fd, 0x0003d7fd,
+	0x0003d8fd, 0x0003d9fd, 0x0003dafd, 0x0003dbfd, 0x0003dcfd, 0x0003ddfd, 0x000063fd, 0x0003dffd,
+	0x0003e0fd, 0x0003e1fd, 0x0003e2fd, 0x0003e3fd, 0x0003e4fd, 0x0003e5fd, 0x0003e6fd, 0x002701fd,
+	0x0003e7fd, 0x000001fe, 0x0003e9fe, 0x0003eafe, 0x0003ebfe, 0x0003ecfe, 0x0003edfe, 0x0003eefe,
+	0x0003effe, 0x0003f0fe, 0x0003f1fe, 0x000065fe, 0x0003f3fe, 0x0003f4fe, 0x0003f5fe, 0x0003f6fe,
+	0x0003f7fe, 0x0003f8fe, 0x0003f9fe, 0x0003fafe, 0x0003fbfe, 0x0027d3fe, 0x000066fe, 0x0003fdfe,
+	0x0003fefe, 0x0003fffe, 0x000400fe, 0x000401fe, 0x000402fe, 0x000403fe, 0x000404fe, 0x000405fe,
+	0x000067fe, 0x000407fe, 0x000408fe, 0x000409fe, 0x00040afe, 0x00040bfe, 0x00040cfe, 0x00040dfe,
+	0x00040efe, 0x00040ffe, 0x00289bfe, 0x000068fe, 0x000411fe, 0x000412fe, 0x000413fe, 0x000414fe,
+	0x000415fe, 0x000416fe, 0x000417fe, 0x000418fe, 0x000419fe, 0x000069fe, 0x00041bfe, 0x00041cfe,
+	0x00041dfe, 0x00041efe, 0x00041ffe, 0x000420fe, 0x000421fe, 0x000422fe, 0x000423fe, 0x00006afe,
+	0x00296dfe, 0x000425fe, 0x000426fe, 0x000427fe, 0x000428fe, 0x000429fe, 0x00042afe, 0x00042bfe,
+	0x00042cfe, 0x00042dfe, 0x00006bfe, 0x00042ffe, 0x000430fe, 0x000431fe, 0x000432fe, 0x000433fe,
+	0x000434fe, 0x000435fe, 0x000436fe, 0x000437fe, 0x00006cfe, 0x002a35fe, 0x000439fe, 0x00043afe,
+	0x00043bfe, 0x00043cfe, 0x00043dfe, 0x00043efe, 0x00043ffe, 0x000440fe, 0x000441fe, 0x00006dfe,
+	0x000443fe, 0x000444fe, 0x000445fe, 0x000446fe, 0x000447fe, 0x000448fe, 0x000449fe, 0x00044afe,
+	0x00044bfe, 0x00000bfe, 0x00044dfe, 0x002b07fe, 0x00044efe, 0x00044ffe, 0x000450fe, 0x000451fe,
+	0x000452fe, 0x000453fe, 0x000454fe, 0x000455fe, 0x00006ffe, 0x000457fe, 0x000458fe, 0x000459fe,
+	0x00045afe, 0x00045bfe, 0x00045cfe, 0x00045dfe, 0x00045efe, 0x00045ffe, 0x000070fe, 0x000461fe,
+	0x002bcffe, 0x000462fe, 0x000463fe, 0x000464fe, 0x000465fe, 0x000466fe, 0x000467fe, 0x000468fe,
+	0x000469fe, 0x000071fe, 0x00046bfe, 0x00046cfe, 0x00046dfe, 0x00046efe, 0x00046ffe, 0x000470fe,
+	0x000471fe, 0x000472fe, 0x000473fe, 0x000072fe, 0x000475fe, 0x000476fe, 0x002ca1fe, 0x000477fe,
+	0x000478fe, 0x000479fe, 0x00047afe, 0x00047bfe, 0x00047cfe, 0x00047dfe, 0x000073fe, 0x00047ffe,
+	0x000480fe, 0x000481fe, 0x000482fe, 0x000483fe, 0x000484fe, 0x000485fe, 0x000486fe, 0x000487fe,
+	0x000074fe, 0x000489fe, 0x00048afe, 0x00048bfe, 0x002d73fe, 0x00048cfe, 0x00048dfe, 0x00048efe,
+	0x00048ffe, 0x000490fe, 0x000491fe, 0x000075fe, 0x000493fe, 0x000494fe, 0x000495fe, 0x000496fe,
+	0x000497fe, 0x000498fe, 0x000499fe, 0x00049afe, 0x00049bfe, 0x000076fe, 0x00049dfe, 0x00049efe,
+	0x00049ffe, 0x002e3bfe, 0x0004a0fe, 0x0004a1fe, 0x0004a2fe, 0x0004a3fe, 0x0004a4fe, 0x0004a5fe,
+	0x000077fe, 0x0004a7fe, 0x0004a8fe, 0x0004a9fe, 0x0004aafe, 0x0004abfe, 0x0004acfe, 0x0004adfe,
+	0x0004aefe, 0x0004affe, 0x00000cfe, 0x0004b1fe, 0x0004b2fe, 0x0004b3fe, 0x0004b4fe, 0x002f0dfe,
+	0x0004b5fe, 0x0004b6fe, 0x0004b7fe, 0x0004b8fe, 0x0004b9fe, 0x000079fe, 0x0004bbfe, 0x0004bcfe,
+	0x0004bdfe, 0x0004befe, 0x0004bffe, 0x0004c0fe, 0x0004c1fe, 0x0004c2fe, 0x0004c3fe, 0x00007afe,
+	0x0004c5fe, 0x0004c6fe, 0x0004c7fe, 0x0004c8fe, 0x002fd5fe, 0x0004c9fe, 0x0004cafe, 0x0004cbfe,
+	0x0004ccfe, 0x0004cdfe, 0x00007bfe, 0x0004cffe, 0x0004d0fe, 0x0004d1fe, 0x0004d2fe, 0x0004d3fe,
+	0x0004d4fe, 0x0004d5fe, 0x0004d6fe, 0x0004d7fe, 0x00007cfe, 0x0004d9fe, 0x0004dafe, 0x0004dbfe,
+	0x0004dcfe, 0x0004ddfe, 0x0030a7fe, 0x0004defe, 0x0004dffe, 0x0004e0fe, 0x0004e1fe, 0x00007dfe,
+	0x0004e3fe, 0x0004e4fe, 0x0004e5fe, 0x0004e6fe, 0x0004e7fe, 0x0004e8fe, 0x0004e9fe, 0x0004eafe,
+	0x0004ebfe, 0x00007efe, 0x0004edfe, 0x0004eefe, 0x0004effe, 0x0004f0fe, 0x0004f1fe, 0x0004f2fe,
+	0x003179fe, 0x0004f3fe, 0x0004f4fe, 0x0004f5fe, 0x00007ffe, 0x0004f7fe, 0x0004f8fe, 0x0004f9fe,
+	0x0004fafe, 0x0004fbfe, 0x0004fcfe, 0x0004fdfe, 0x0004fefe, 0x0004fffe, 0x000080fe, 0x000501fe,
+	0x000502fe, 0x000503fe, 0x000504fe, 0x000505fe, 0x000506fe, 0x003241fe, 0x000507fe, 0x000508fe,
+	0x000509fe, 0x000081fe, 0x00050bfe, 0x00050cfe, 0x00050dfe, 0x00050efe, 0x00050ffe, 0x000510fe,
+	0x000511fe, 0x000512fe, 0x000513fe, 0x00000dfe, 0x000515fe, 0x000516fe, 0x000517fe, 0x000518fe,
+	0x000519fe, 0x00051afe, 0x00051bfe, 0x003313fe, 0x00051cfe, 0x00051dfe, 0x000083fe, 0x00051ffe,
+	0x000520fe, 0x000521fe, 0x000522fe, 0x000523fe, 0x000524fe, 0x000525fe, 0x000526fe, 0x000527fe,
+	0x000084fe, 0x000529fe, 0x00052afe, 0x00052bfe, 0x00052cfe, 0x00052dfe, 0x00052efe, 0x00052ffe,
+	0x0033dbfe, 0x000530fe, 0x000531fe, 0x000085fe, 0x000533fe, 0x000534fe, 0x000535fe, 0x000536fe,
+	0x000537fe, 0x000538fe, 0x000539fe, 0x00053afe, 0x00053bfe, 0x000086fe, 0x00053dfe, 0x00053efe,
+	0x00053ffe, 0x000540fe, 0x000541fe, 0x000542fe, 0x000543fe, 0x000544fe, 0x0034adfe, 0x000545fe,
+	0x000087fe, 0x000547fe, 0x000548fe, 0x000549fe, 0x00054afe, 0x00054bfe, 0x00054cfe, 0x00054dfe,
+	0x00054efe, 0x00054ffe, 0x000088fe, 0x000551fe, 0x000552fe, 0x000553fe, 0x000554fe, 0x000555fe,
+	0x000556fe, 0x000557fe, 0x000558fe, 0x003575fe, 0x000559fe, 0x000089fe, 0x00055bfe, 0x00055cfe,
+	0x00055dfe, 0x00055efe, 0x00055ffe, 0x000560fe, 0x000561fe, 0x000562fe, 0x000563fe, 0x00008afe,
+	0x000565fe, 0x000566fe, 0x000567fe, 0x000568fe, 0x000569fe, 0x00056afe, 0x00056bfe, 0x00056cfe,
+	0x00056dfe, 0x003647fe, 0x00008bfe, 0x00056ffe, 0x000570fe, 0x000571fe, 0x000572fe, 0x000573fe,
+	0x000574fe, 0x000575fe, 0x000576fe, 0x000577fe, 0x00000efe, 0x000579fe, 0x00057afe, 0x00057bfe,
+	0x00057cfe, 0x00057dfe, 0x00057efe, 0x00057ffe, 0x000580fe, 0x000581fe, 0x00008dfe, 0x003719fe,
+	0x000583fe, 0x000584fe, 0x000585fe, 0x000586fe, 0x000587fe, 0x000588fe, 0x000589fe, 0x00058afe,
+	0x00058bfe, 0x00008efe, 0x00058dfe, 0x00058efe, 0x00058ffe, 0x000590fe, 0x000591fe, 0x000592fe,
+	0x000593fe, 0x000594fe, 0x000595fe, 0x00008ffe, 0x0037e1fe, 0x000597fe, 0x000598fe, 0x000599fe,
+	0x00059afe, 0x00059bfe, 0x00059cfe, 0x00059dfe, 0x00059efe, 0x00059ffe, 0x000090fe, 0x0005a1fe,
+	0x0005a2fe, 0x0005a3fe, 0x0005a4fe, 0x0005a5fe, 0x0005a6fe, 0x0005a7fe, 0x0005a8fe, 0x0005a9fe,
+	0x000091fe, 0x0005abfe, 0x0038b3fe, 0x0005acfe, 0x0005adfe, 0x0005aefe, 0x0005affe, 0x0005b0fe,
+	0x0005b1fe, 0x0005b2fe, 0x0005b3fe, 0x000092fe, 0x0005b5fe, 0x0005b6fe, 0x0005b7fe, 0x0005b8fe,
+	0x0005b9fe, 0x0005bafe, 0x0005bbfe, 0x0005bcfe, 0x0005bdfe, 0x000093fe, 0x0005bffe, 0x00397bfe,
+	0x0005c0fe, 0x0005c1fe, 0x0005c2fe, 0x0005c3fe, 0x0005c4fe, 0x0005c5fe, 0x0005c6fe, 0x0005c7fe,
+	0x000094fe, 0x0005c9fe, 0x0005cafe, 0x0005cbfe, 0x0005ccfe, 0x0005cdfe, 0x0005cefe, 0x0005cffe,
+	0x0005d0fe, 0x0005d1fe, 0x000095fe, 0x0005d3fe, 0x0005d4fe, 0x003a4dfe, 0x0005d5fe, 0x0005d6fe,
+	0x0005d7fe, 0x0005d8fe, 0x0005d9fe, 0x0005dafe, 0x0005dbfe, 0x00000ffe, 0x0005ddfe, 0x0005defe,
+	0x0005dffe, 0x0005e0fe, 0x0005e1fe, 0x0005e2fe, 0x0005e3fe, 0x0005e4fe, 0x0005e5fe, 0x000097fe,
+	0x0005e7fe, 0x0005e8fe, 0x0005e9fe, 0x003b1ffe, 0x0005eafe, 0x0005ebfe, 0x0005ecfe, 0x0005edfe,
+	0x0005eefe, 0x0005effe, 0x000098fe, 0x0005f1fe, 0x0005f2fe, 0x0005f3fe, 0x0005f4fe, 0x0005f5fe,
+	0x0005f6fe, 0x0005f7fe, 0x0005f8fe, 0x0005f9fe, 0x000099fe, 0x0005fbfe, 0x0005fcfe, 0x0005fdfe,
+	0x003be7fe, 0x0005fefe, 0x0005fffe, 0x000600fe, 0x000601fe, 0x000602fe, 0x000603fe, 0x00009afe,
+	0x000605fe, 0x000606fe, 0x000607fe, 0x000608fe, 0x000609fe, 0x00060afe, 0x00060bfe, 0x00060cfe,
+	0x00060dfe, 0x00009bfe, 0x00060ffe, 0x000610fe, 0x000611fe, 0x000612fe, 0x003cb9fe, 0x000613fe,
+	0x000614fe, 0x000615fe, 0x000616fe, 0x000617fe, 0x00009cfe, 0x000619fe, 0x00061afe, 0x00061bfe,
+	0x00061cfe, 0x00061dfe, 0x00061efe, 0x00061ffe, 0x000620fe, 0x000621fe, 0x00009dfe, 0x000623fe,
+	0x000624fe, 0x000625fe, 0x000626fe, 0x003d81fe, 0x000627fe, 0x000628fe, 0x000629fe, 0x00062afe,
+	0x00062bfe, 0x00009efe, 0x00062dfe, 0x00062efe, 0x00062ffe, 0x000630fe, 0x000631fe, 0x000632fe,
+	0x000633fe, 0x000634fe, 0x000635fe, 0x00009ffe, 0x000637fe, 0x000638fe, 0x000639fe, 0x00063afe,
+	0x00063bfe, 0x003e53fe, 0x00063cfe, 0x00063dfe, 0x00063efe, 0x00063ffe, 0x000010fe, 0x000641fe,
+	0x000642fe, 0x000643fe, 0x000644fe, 0x000645fe, 0x000646fe, 0x000647fe, 0x000648fe, 0x000649fe,
+	0x0000a1fe, 0x00064bfe, 0x00064cfe, 0x00064dfe, 0x00064efe, 0x00064ffe, 0x000650fe, 0x003f25fe,
+	0x000651fe, 0x000652fe, 0x000653fe, 0x0000a2fe, 0x000655fe, 0x000656fe, 0x000657fe, 0x000658fe,
+	0x000659fe, 0x00065afe, 0x00065bfe, 0x00065cfe, 0x00065dfe, 0x0000a3fe, 0x00065ffe, 0x000660fe,
+	0x000661fe, 0x000662fe, 0x000663fe, 0x000664fe, 0x003fedfe, 0x000665fe, 0x000666fe, 0x000667fe,
+	0x0000a4fe, 0x000669fe, 0x00066afe, 0x00066bfe, 0x00066cfe, 0x00066dfe, 0x00066efe, 0x00066ffe,
+	0x000670fe, 0x000671fe, 0x0000a5fe, 0x000673fe, 0x000674fe, 0x000675fe, 0x000676fe, 0x000677fe,
+	0x000678fe, 0x000679fe, 0x0040bffe, 0x00067afe, 0x00067bfe, 0x0000a6fe, 0x00067dfe, 0x00067efe,
+	0x00067ffe, 0x000680fe, 0x000681fe, 0x000682fe, 0x000683fe, 0x000684fe, 0x000685fe, 0x0000a7fe,
+	0x000687fe, 0x000688fe, 0x000689fe, 0x00068afe, 0x00068bfe, 0x00068cfe, 0x00068dfe, 0x004187fe,
+	0x00068efe, 0x00068ffe, 0x0000a8fe, 0x000691fe, 0x000692fe, 0x000693fe, 0x000694fe, 0x000695fe,
+	0x000696fe, 0x000697fe, 0x000698fe, 0x000699fe, 0x0000a9fe, 0x00069bfe, 0x00069cfe, 0x00069dfe,
+	0x00069efe, 0x00069ffe, 0x0006a0fe, 0x0006a1fe, 0x0006a2fe, 0x004259fe, 0x0006a3fe, 0x000011fe,
+	0x0006a5fe, 0x0006a6fe, 0x0006a7fe, 0x0006a8fe, 0x0006a9fe, 0x0006aafe, 0x0006abfe, 0x0006acfe,
+	0x0006adfe, 0x0000abfe, 0x0006affe, 0x0006b0fe, 0x0006b1fe, 0x0006b2fe, 0x0006b3fe, 0x0006b4fe,
+	0x0006b5fe, 0x0006b6fe, 0x004321fe, 0x0006b7fe, 0x0000acfe, 0x0006b9fe, 0x0006bafe, 0x0006bbfe,
+	0x0006bcfe, 0x0006bdfe, 0x0006befe, 0x0006bffe, 0x0006c0fe, 0x0006c1fe, 0x0000adfe, 0x0006c3fe,
+	0x0006c4fe, 0x0006c5fe, 0x0006c6fe, 0x0006c7fe, 0x0006c8fe, 0x0006c9fe, 0x0006cafe, 0x0006cbfe,
+	0x0043f3fe, 0x0000aefe, 0x0006cdfe, 0x0006cefe, 0x0006cffe, 0x0006d0fe, 0x0006d1fe, 0x0006d2fe,
+	0x0006d3fe, 0x0006d4fe, 0x0006d5fe, 0x0000affe, 0x0006d7fe, 0x0006d8fe, 0x0006d9fe, 0x0006dafe,
+	0x0006dbfe, 0x0006dcfe, 0x0006ddfe, 0x0006defe, 0x0006dffe, 0x0000b0fe, 0x0044c5fe, 0x0006e1fe,
+	0x0006e2fe, 0x0006e3fe, 0x0006e4fe, 0x0006e5fe, 0x0006e6fe, 0x0006e7fe, 0x0006e8fe, 0x0006e9fe,
+	0x0000b1fe, 0x0006ebfe, 0x0006ecfe, 0x0006edfe, 0x0006eefe, 0x0006effe, 0x0006f0fe, 0x0006f1fe,
+	0x0006f2fe, 0x0006f3fe, 0x0000b2fe, 0x00458dfe, 0x0006f5fe, 0x0006f6fe, 0x0006f7fe, 0x0006f8fe,
+	0x0006f9fe, 0x0006fafe, 0x0006fbfe, 0x0006fcfe, 0x0006fdfe, 0x0000b3fe, 0x0006fffe, 0x000700fe,
+	0x000701fe, 0x000702fe, 0x000703fe, 0x000704fe, 0x000705fe, 0x000706fe, 0x000707fe, 0x000012fe,
+	0x000709fe, 0x00465ffe, 0x00070afe, 0x00070bfe, 0x00070cfe, 0x00070dfe, 0x00070efe, 0x00070ffe,
+	0x000710fe, 0x000711fe, 0x0000b5fe, 0x000713fe, 0x000714fe, 0x000715fe, 0x000716fe, 0x000717fe,
+	0x000718fe, 0x000719fe, 0x00071afe, 0x00071bfe, 0x0000b6fe, 0x00071dfe, 0x004727fe, 0x00071efe,
+	0x00071ffe, 0x000720fe, 0x000721fe, 0x000722fe, 0x000723fe, 0x000724fe, 0x000725fe, 0x0000b7fe,
+	0x000727fe, 0x000728fe, 0x000729fe, 0x00072afe, 0x00072bfe, 0x00072cfe, 0x00072dfe, 0x00072efe,
+	0x00072ffe, 0x0000b8fe, 0x000731fe, 0x000732fe, 0x0047f9fe, 0x000733fe, 0x000734fe, 0x000735fe,
+	0x000736fe, 0x000737fe, 0x000738fe, 0x000739fe, 0x0000b9fe, 0x00073bfe, 0x00073cfe, 0x00073dfe,
+	0x00073efe, 0x00073ffe, 0x000740fe, 0x000741fe, 0x000742fe, 0x000743fe, 0x0000bafe, 0x000745fe,
+	0x000746fe, 0x000747fe, 0x0048cbfe, 0x000748fe, 0x000749fe, 0x00074afe, 0x00074bfe, 0x00074cfe,
+	0x00074dfe, 0x0000bbfe, 0x00074ffe, 0x000750fe, 0x000751fe, 0x000752fe, 0x000753fe, 0x000754fe,
+	0x000755fe, 0x000756fe, 0x000757fe, 0x0000bcfe, 0x000759fe, 0x00075afe, 0x00075bfe, 0x004993fe,
+	0x00075cfe, 0x00075dfe, 0x00075efe, 0x00075ffe, 0x000760fe, 0x000761fe, 0x0000bdfe, 0x000763fe,
+	0x000764fe, 0x000765fe, 0x000766fe, 0x000767fe, 0x000768fe, 0x000769fe, 0x00076afe, 0x00076bfe,
+	0x000013fe, 0x00076dfe, 0x00076efe, 0x00076ffe, 0x000770fe, 0x004a65fe, 0x000771fe, 0x000772fe,
+	0x000773fe, 0x000774fe, 0x000775fe, 0x0000bffe, 0x000777fe, 0x000778fe, 0x000779fe, 0x00077afe,
+	0x00077bfe, 0x00077cfe, 0x00077dfe, 0x00077efe, 0x00077ffe, 0x0000c0fe, 0x000781fe, 0x000782fe,
+	0x000783fe, 0x000784fe, 0x004b2dfe, 0x000785fe, 0x000786fe, 0x000787fe, 0x000788fe, 0x000789fe,
+	0x0000c1fe, 0x00078bfe, 0x00078cfe, 0x00078dfe, 0x00078efe, 0x00078ffe, 0x000790fe, 0x000791fe,
+	0x000792fe, 0x000793fe, 0x0000c2fe, 0x000795fe, 0x000796fe, 0x000797fe, 0x000798fe, 0x000799fe,
+	0x004bfffe, 0x00079afe, 0x00079bfe, 0x00079cfe, 0x00079dfe, 0x0000c3fe, 0x00079ffe, 0x0007a0fe,
+	0x0007a1fe, 0x0007a3fe, 0x0007a5fe, 0x0007a7fe, 0x0000c4fe, 0x0007abfe, 0x0007adfe, 0x0007aefe,
+	0x0007b0fe, 0x0000c5fe, 0x0007b4fe, 0x0007b6fe, 0x0007b8fe, 0x0007bafe, 0x0000c6fe, 0x0007befe,
+	0x0007c0fe, 0x0007c2fe, 0x0007c3fe, 0x0000c7fe, 0x0007c7fe, 0x0007c9fe, 0x0007cbfe, 0x0007cdfe,
+	0x0007cffe, 0x000002fe, 0x0007d3fe, 0x0007d5fe, 0x0007d7fe, 0x0007d8fe, 0x0000c9fe, 0x0007dcfe,
+	0x0007defe, 0x0007e0fe, 0x0007e2fe, 0x0000cafe, 0x0007e6fe, 0x0007e8fe, 0x0007eafe, 0x0007ecfe,
+	0x0000cbfe, 0x0007effe, 0x0007f1fe, 0x0007f3fe, 0x0007f5fe, 0x0007f7fe, 0x0000ccfe, 0x0007fbfe,
+	0x0007fdfe, 0x0007fffe, 0x000800fe, 0x0000cdfe, 0x000804fe, 0x000806fe, 0x000808fe, 0x00080afe,
+	0x0000cefe, 0x00080efe, 0x000810fe, 0x000812fe, 0x000814fe, 0x0000cffe, 0x000817fe, 0x000819fe,
+	0x00081bfe, 0x00081dfe, 0x00081ffe, 0x0000d0fe, 0x000823fe, 0x000825fe, 0x000827fe, 0x000829fe,
+	0x0000d1fe, 0x00082cfe, 0x00082efe, 0x000830fe, 0x000832fe, 0x000015fe, 0x000836fe, 0x000838fe,
+	0x00083afe, 0x00083cfe, 0x0000d3fe, 0x00083ffe, 0x000841fe, 0x000843fe, 0x000845fe, 0x0000d4fe,
+	0x000849fe, 0x00084bfe, 0x00084dfe, 0x00084ffe, 0x000851fe, 0x0000d5fe, 0x000854fe, 0x000856fe,
+	0x000858fe, 0x00085afe, 0x0000d6fe, 0x00085efe, 0x000860fe, 0x000862fe, 0x000864fe, 0x0000d7fe,
+	0x000867fe, 0x000869fe, 0x00086bfe, 0x00086dfe, 0x0000d8fe, 0x000871fe, 0x000873fe, 0x000875fe,
+	0x000877fe, 0x000879fe, 0x0000d9fe, 0x00087cfe, 0x00087efe, 0x000880fe, 0x000882fe, 0x0000dafe,
+	0x000886fe, 0x000888fe, 0x00088afe, 0x00088cfe, 0x0000dbfe, 0x000890fe, 0x000891fe, 0x000893fe,
+	0x000895fe, 0x000016fe, 0x000899fe, 0x00089bfe, 0x00089dfe, 0x00089ffe, 0x0008a1fe, 0x0000ddfe,
+	0x0008a5fe, 0x0008a6fe, 0x0008a8fe, 0x0008aafe, 0x0000defe, 0x0008aefe, 0x0008b0fe, 0x0008b2fe,
+	0x0008b4fe, 0x0000dffe, 0x0008b8fe, 0x0008bafe, 0x0008bbfe, 0x0008bdfe, 0x0000e0fe, 0x0008c1fe,
+	0x0008c3fe, 0x0008c5fe, 0x0008c7fe, 0x0008c9fe, 0x0000e1fe, 0x0008cdfe, 0x0008cefe, 0x0008d0fe,
+	0x0008d2fe, 0x0000e2fe, 0x0008d6fe, 0x0008d8fe, 0x0008dafe, 0x0008dcfe, 0x0000e3fe, 0x0008e0fe,
+	0x0008e2fe, 0x0008e3fe, 0x0008e5fe, 0x0000e4fe, 0x0008e9fe, 0x0008ebfe, 0x0008edfe, 0x0008effe,
+	0x0008f1fe, 0x0000e5fe, 0x0008f5fe, 0x0008f7fe, 0x0008f8fe, 0x0008fafe, 0x000017fe, 0x0008fefe,
+	0x000900fe, 0x000902fe, 0x000904fe, 0x0000e7fe, 0x000908fe, 0x00090afe, 0x00090cfe, 0x00090dfe,
+	0x0000e8fe, 0x000911fe, 0x000913fe, 0x000915fe, 0x000917fe, 0x000919fe, 0x0000e9fe, 0x00091dfe,
+	0x00091ffe, 0x000921fe, 0x000922fe, 0x0000eafe, 0x000926fe, 0x000928fe, 0x00092afe, 0x00092cfe,
+	0x0000ebfe, 0x000930fe, 0x000932fe, 0x000934fe, 0x000935fe, 0x0000ecfe, 0x000939fe, 0x00093bfe,
+	0x00093dfe, 0x00093ffe, 0x000941fe, 0x0000edfe, 0x000945fe, 0x000947fe, 0x000949fe, 0x00094afe,
+	0x0000eefe, 0x00094efe, 0x000950fe, 0x000952fe, 0x000954fe, 0x0000effe, 0x000958fe, 0x00095afe,
+	0x00095cfe, 0x00095efe, 0x000018fe, 0x000961fe, 0x000963fe, 0x000965fe, 0x000967fe, 0x000969fe,
+	0x0000f1fe, 0x00096dfe, 0x00096ffe, 0x000971fe, 0x000973fe, 0x0000f2fe, 0x000976fe, 0x000978fe,
+	0x00097afe, 0x00097cfe, 0x0000f3fe, 0x000980fe, 0x000982fe, 0x000984fe, 0x000986fe, 0x0000f4fe,
+	0x000989fe, 0x00098bfe, 0x00098dfe, 0x00098ffe, 0x000991fe, 0x0000f5fe, 0x000995fe, 0x000997fe,
+	0x000999fe, 0x00099bfe, 0x0000f6fe, 0x00099efe, 0x0009a0fe, 0x0009a2fe, 0x0009a4fe, 0x0000f7fe,
+	0x0009a8fe, 0x0009aafe, 0x0009acfe, 0x0009aefe, 0x0000f8fe, 0x0009b1fe, 0x0009b3fe, 0x0009b5fe,
+	0x0009b7fe, 0x0000f9fe, 0x0009bbfe, 0x0009bdfe, 0x0009bffe, 0x0009c1fe, 0x0009c3fe, 0x000019fe,
+	0x0009c6fe, 0x0009c8fe, 0x0009cafe, 0x0009ccfe, 0x0000fbfe, 0x0009d0fe, 0x0009d2fe, 0x0009d4fe,
+	0x0009d6fe, 0x0000fcfe, 0x0009dafe, 0x0009dbfe, 0x0009ddfe, 0x0009dffe, 0x0000fdfe, 0x0009e3fe,
+	0x0009e5fe, 0x0009e7fe, 0x0009e9fe, 0x0009ebfe, 0x0000fefe, 0x0009eefe, 0x0009f0fe, 0x0009f2fe,
+	0x0009f4fe, 0x0000fffe, 0x0009f8fe, 0x0009fafe, 0x0009fcfe, 0x0009fefe, 0x000100fe, 0x000a02fe,
+	0x000a03fe, 0x000a05fe, 0x000a07fe, 0x000101fe, 0x000a0bfe, 0x000a0dfe, 0x000a0ffe, 0x000a11fe,
+	0x000a13fe, 0x000102fe, 0x000a17fe, 0x000a18fe, 0x000a1afe, 0x000a1cfe, 0x000103fe, 0x000a20fe,
+	0x000a22fe, 0x000a24fe, 0x000a26fe, 0x00001afe, 0x000a2afe, 0x000a2cfe, 0x000a2dfe, 0x000a2ffe,
+	0x000105fe, 0x000a33fe, 0x000a35fe, 0x000a37fe, 0x000a39fe, 0x000a3bfe, 0x000106fe, 0x000a3ffe,
+	0x000a41fe, 0x000a42fe, 0x000a44fe, 0x000107fe, 0x000a48fe, 0x000a4afe, 0x000a4cfe, 0x000a4efe,
+	0x000108fe, 0x000a52fe, 0x000a54fe, 0x000a55fe, 0x000a57fe, 0x000109fe, 0x000a5bfe, 0x000a5dfe,
+	0x000a5ffe, 0x000a61fe, 0x000a63fe, 0x00010afe, 0x000a67fe, 0x000a69fe, 0x000a6afe, 0x000a6cfe,
+	0x00010bfe, 0x000a70fe, 0x000a72fe, 0x000a74fe, 0x000a76fe, 0x00010cfe, 0x000a7afe, 0x000a7cfe,
+	0x000a7efe, 0x000a7ffe, 0x00010dfe, 0x000a83fe, 0x000a85fe, 0x000a87fe, 0x000a89fe, 0x000a8bfe,
+	0x00001bfe, 0x000a8ffe, 0x000a91fe, 0x000a93fe, 0x000a94fe, 0x00010ffe, 0x000a98fe, 0x000a9afe,
+	0x000a9cfe, 0x000a9efe, 0x000110fe, 0x000aa2fe, 0x000aa4fe, 0x000aa6fe, 0x000aa8fe, 0x000111fe,
+	0x000aabfe, 0x000aadfe, 0x000aaffe, 0x000ab1fe, 0x000ab3fe, 0x000112fe, 0x000ab7fe, 0x000ab9fe,
+	0x000abbfe, 0x000abcfe, 0x000113fe, 0x000ac0fe, 0x000ac2fe, 0x000ac4fe, 0x000ac6fe, 0x000114fe,
+	0x000acafe, 0x000accfe, 0x000acefe, 0x000ad0fe, 0x000115fe, 0x000ad3fe, 0x000ad5fe, 0x000ad7fe,
+	0x000ad9fe, 0x000adbfe, 0x000116fe, 0x000adffe, 0x000ae1fe, 0x000ae3fe, 0x000ae5fe, 0x000117fe,
+	0x000ae8fe, 0x000aeafe, 0x000aecfe, 0x000aeefe, 0x00001cfe, 0x000af2fe, 0x000af4fe, 0x000af6fe,
+	0x000af8fe, 0x000119fe, 0x000afbfe, 0x000afdfe, 0x000afffe, 0x000b01fe, 0x00011afe, 0x000b05fe,
+	0x000b07fe, 0x000b09fe, 0x000b0bfe, 0x000b0dfe, 0x00011bfe, 0x000b10fe, 0x000b12fe, 0x000b14fe,
+	0x000b16fe, 0x00011cfe, 0x000b1afe, 0x000b1cfe, 0x000b1efe, 0x000b20fe, 0x00011dfe, 0x000b23fe,
+	0x000b25fe, 0x000b27fe, 0x000b29fe, 0x00011efe, 0x000b2dfe, 0x000b2ffe, 0x000b31fe, 0x000b33fe,
+	0x000b35fe, 0x00011ffe, 0x000b38fe, 0x000b3afe, 0x000b3cfe, 0x000b3efe, 0x000120fe, 0x000b42fe,
+	0x000b44fe, 0x000b46fe, 0x000b48fe, 0x000121fe, 0x000b4cfe, 0x000b4dfe, 0x000b4ffe, 0x000b51fe,
+	0x00001dfe, 0x000b55fe, 0x000b57fe, 0x000b59fe, 0x000b5bfe, 0x000b5dfe, 0x000123fe, 0x000b61fe,
+	0x000b62fe, 0x000b64fe, 0x000b66fe, 0x000124fe, 0x000b6afe, 0x000b6cfe, 0x000b6efe, 0x000b70fe,
+	0x000125fe, 0x000b74fe, 0x000b76fe, 0x000b77fe, 0x000b79fe, 0x000126fe, 0x000b7dfe, 0x000b7ffe,
+	0x000b81fe, 0x000b83fe, 0x000b85fe, 0x000127fe, 0x000b89fe, 0x000b8afe, 0x000b8cfe, 0x000b8efe,
+	0x000128fe, 0x000b92fe, 0x000b94fe, 0x000b96fe, 0x000b98fe, 0x000129fe, 0x000b9cfe, 0x000b9efe,
+	0x000b9ffe, 0x000ba1fe, 0x00012afe, 0x000ba5fe, 0x000ba7fe, 0x000ba9fe, 0x000babfe, 0x000badfe,
+	0x00012bfe, 0x000bb1fe, 0x000bb3fe, 0x000bb4fe, 0x000bb6fe, 0x000003fe, 0x000bbafe, 0x000bbcfe,
+	0x000bbefe, 0x000bc0fe, 0x00012dfe, 0x000bc4fe, 0x000bc6fe, 0x000bc8fe, 0x000bc9fe, 0x00012efe,
+	0x000bcdfe, 0x000bcffe, 0x000bd1fe, 0x000bd3fe, 0x000bd5fe, 0x00012ffe, 0x000bd9fe, 0x000bdbfe,
+	0x000bdcfe, 0x000bdefe, 0x000130fe, 0x000be2fe, 0x000be4fe, 0x000be6fe, 0x000be8fe, 0x000131fe,
+	0x000becfe, 0x000beefe, 0x000bf0fe, 0x000bf1fe, 0x000132fe, 0x000bf5fe, 0x000bf7fe, 0x000bf9fe,
+	0x000bfbfe, 0x000bfdfe, 0x000133fe, 0x000c01fe, 0x000c03fe, 0x000c05fe, 0x000c06fe, 0x000134fe,
+	0x000c0afe, 0x000c0cfe, 0x000c0efe, 0x000c10fe, 0x000135fe, 0x000c14fe, 0x000c16fe, 0x000c18fe,
+	0x000c1afe, 0x00001ffe, 0x000c1dfe, 0x000c1ffe, 0x000c21fe, 0x000c23fe, 0x000c25fe, 0x000137fe,
+	0x000c29fe, 0x000c2bfe, 0x000c2dfe, 0x000c2ffe, 0x000138fe, 0x000c32fe, 0x000c34fe, 0x000c36fe,
+	0x000c38fe, 0x000139fe, 0x000c3cfe, 0x000c3efe, 0x000c40fe, 0x000c42fe, 0x00013afe, 0x000c45fe,
+	0x000c47fe, 0x000c49fe, 0x000c4bfe, 0x000c4dfe, 0x00013bfe, 0x000c51fe, 0x000c53fe, 0x000c55fe,
+	0x000c57fe, 0x00013cfe, 0x000c5afe, 0x000c5cfe, 0x000c5efe, 0x000c60fe, 0x00013dfe, 0x000c64fe,
+	0x000c66fe, 0x000c68fe, 0x000c6afe, 0x00013efe, 0x000c6dfe, 0x000c6ffe, 0x000c71fe, 0x000c73fe,
+	0x00013ffe, 0x000c77fe, 0x000c79fe, 0x000c7bfe, 0x000c7dfe, 0x000c7ffe, 0x000020fe, 0x000c82fe,
+	0x000c84fe, 0x000c86fe, 0x000c88fe, 0x000141fe, 0x000c8cfe, 0x000c8efe, 0x000c90fe, 0x000c92fe,
+	0x000142fe, 0x000c96fe, 0x000c97fe, 0x000c99fe, 0x000c9bfe, 0x000143fe, 0x000c9ffe, 0x000ca1fe,
+	0x000ca3fe, 0x000ca5fe, 0x000ca7fe, 0x000144fe, 0x000caafe, 0x000cacfe, 0x000caefe, 0x000cb0fe,
+	0x000145fe, 0x000cb4fe, 0x000cb6fe, 0x000cb8fe, 0x000cbafe, 0x000146fe, 0x000cbefe, 0x000cbffe,
+	0x000cc1fe, 0x000cc3fe, 0x000147fe, 0x000cc7fe, 0x000cc9fe, 0x000ccbfe, 0x000ccdfe, 0x000ccffe,
+	0x000148fe, 0x000cd3fe, 0x000cd4fe, 0x000cd6fe, 0x000cd8fe, 0x000149fe, 0x000cdcfe, 0x000cdefe,
+	0x000ce0fe, 0x000ce2fe, 0x000021fe, 0x000ce6fe, 0x000ce8fe, 0x000ce9fe, 0x000cebfe, 0x00014bfe,
+	0x000ceffe, 0x000cf1fe, 0x000cf3fe, 0x000cf5fe, 0x000cf7fe, 0x00014cfe, 0x000cfbfe, 0x000cfdfe,
+	0x000cfefe, 0x000d00fe, 0x00014dfe, 0x000d04fe, 0x000d06fe, 0x000d08fe, 0x000d0afe, 0x00014efe,
+	0x000d0efe, 0x000d10fe, 0x000d11fe, 0x000d13fe, 0x00014ffe, 0x000d17fe, 0x000d19fe, 0x000d1bfe,
+	0x000d1dfe, 0x000d1ffe, 0x000150fe, 0x000d23fe, 0x000d25fe, 0x000d26fe, 0x000d28fe, 0x000151fe,
+	0x000d2cfe, 0x000d2efe, 0x000d30fe, 0x000d32fe, 0x000152fe, 0x000d36fe, 0x000d38fe, 0x000d3afe,
+	0x000d3bfe, 0x000153fe, 0x000d3ffe, 0x000d41fe, 0x000d43fe, 0x000d45fe, 0x000d47fe, 0x000022fe,
+	0x000d4bfe, 0x000d4dfe, 0x000d4ffe, 0x000d50fe, 0x000155fe, 0x000d54fe, 0x000d56fe, 0x000d58fe,
+	0x000d5afe, 0x000156fe, 0x000d5efe, 0x000d60fe, 0x000d62fe, 0x000d64fe, 0x000157fe, 0x000d67fe,
+	0x000d69fe, 0x000d6bfe, 0x000d6dfe, 0x000d6ffe, 0x000158fe, 0x000d73fe, 0x000d75fe, 0x000d77fe,
+	0x000d78fe, 0x000159fe, 0x000d7cfe, 0x000d7efe, 0x000d80fe, 0x000d82fe, 0x00015afe, 0x000d86fe,
+	0x000d88fe, 0x000d8afe, 0x000d8cfe, 0x00015bfe, 0x000d8ffe, 0x000d91fe, 0x000d93fe, 0x000d95fe,
+	0x000d97fe, 0x00015cfe, 0x000d9bfe, 0x000d9dfe, 0x000d9ffe, 0x000da1fe, 0x00015dfe, 0x000da4fe,
+	0x000da6fe, 0x000da8fe, 0x000daafe, 0x000023fe, 0x000daefe, 0x000db0fe, 0x000db2fe, 0x000db4fe,
+	0x00015ffe, 0x000db7fe, 0x000db9fe, 0x000dbbfe, 0x000dbdfe, 0x000160fe, 0x000dc1fe, 0x000dc3fe,
+	0x000dc5fe, 0x000dc7fe, 0x000dc9fe, 0x000161fe, 0x000dccfe, 0x000dcefe, 0x000dd0fe, 0x000dd2fe,
+	0x000162fe, 0x000dd6fe, 0x000dd8fe, 0x000ddafe, 0x000ddcfe, 0x000163fe, 0x000ddffe, 0x000de1fe,
+	0x000de3fe, 0x000de5fe, 0x000164fe, 0x000de9fe, 0x000debfe, 0x000dedfe, 0x000deffe, 0x000df1fe,
+	0x000165fe, 0x000df4fe, 0x000df6fe, 0x000df8fe, 0x000dfafe, 0x000166fe, 0x000dfefe, 0x000e00fe,
+	0x000e02fe, 0x000e04fe, 0x000167fe, 0x000e08fe, 0x000e09fe, 0x000e0bfe, 0x000e0dfe, 0x000024fe,
+	0x000e11fe, 0x000e13fe, 0x000e15fe, 0x000e17fe, 0x000e19fe, 0x000169fe, 0x000e1dfe, 0x000e1efe,
+	0x000e20fe, 0x000e22fe, 0x00016afe, 0x000e26fe, 0x000e28fe, 0x000e2afe, 0x000e2cfe, 0x00016bfe,
+	0x000e30fe, 0x000e31fe, 0x000e33fe, 0x000e35fe, 0x00016cfe, 0x000e39fe, 0x000e3bfe, 0x000e3dfe,
+	0x000e3ffe, 0x000e41fe, 0x00016dfe, 0x000e45fe, 0x000e46fe, 0x000e48fe, 0x000e4afe, 0x00016efe,
+	0x000e4efe, 0x000e50fe, 0x000e52fe, 0x000e54fe, 0x00016ffe, 0x000e58fe, 0x000e5afe, 0x000e5bfe,
+	0x000e5dfe, 0x000170fe, 0x000e61fe, 0x000e63fe, 0x000e65fe, 0x000e67fe, 0x000e69fe, 0x000171fe,
+	0x000e6dfe, 0x000e6ffe, 0x000e70fe, 0x000e72fe, 0x000025fe, 0x000e76fe, 0x000e78fe, 0x000e7afe,
+	0x000e7cfe, 0x000173fe, 0x000e80fe, 0x000e82fe, 0x000e84fe, 0x000e85fe, 0x000174fe, 0x000e89fe,
+	0x000e8bfe, 0x000e8dfe, 0x000e8ffe, 0x000e91fe, 0x000175fe, 0x000e95fe, 0x000e97fe, 0x000e98fe,
+	0x000e9afe, 0x000176fe, 0x000e9efe, 0x000ea0fe, 0x000ea2fe, 0x000ea4fe, 0x000177fe, 0x000ea8fe,
+	0x000eaafe, 0x000eacfe, 0x000eadfe, 0x000178fe, 0x000eb1fe, 0x000eb3fe, 0x000eb5fe, 0x000eb7fe,
+	0x000eb9fe, 0x000179fe, 0x000ebdfe, 0x000ebffe, 0x000ec1fe, 0x000ec2fe, 0x00017afe, 0x000ec6fe,
+	0x000ec8fe, 0x000ecafe, 0x000eccfe, 0x00017bfe, 0x000ed0fe, 0x000ed2fe, 0x000ed4fe, 0x000ed6fe,
+	0x000026fe, 0x000ed9fe, 0x000edbfe, 0x000eddfe, 0x000edffe, 0x000ee1fe, 0x00017dfe, 0x000ee5fe,
+	0x000ee7fe, 0x000ee9fe, 0x000eebfe, 0x00017efe, 0x000eeefe, 0x000ef0fe, 0x000ef2fe, 0x000ef4fe,
+	0x00017ffe, 0x000ef8fe, 0x000efafe, 0x000efcfe, 0x000efefe, 0x000180fe, 0x000f01fe, 0x000f03fe,
+	0x000f05fe, 0x000f07fe, 0x000f09fe, 0x000181fe, 0x000f0dfe, 0x000f0ffe, 0x000f11fe, 0x000f13fe,
+	0x000182fe, 0x000f16fe, 0x000f18fe, 0x000f1afe, 0x000f1cfe, 0x000183fe, 0x000f20fe, 0x000f22fe,
+	0x000f24fe, 0x000f26fe, 0x000184fe, 0x000f29fe, 0x000f2bfe, 0x000f2dfe, 0x000f2ffe, 0x000185fe,
+	0x000f33fe, 0x000f35fe, 0x000f37fe, 0x000f39fe, 0x000f3bfe, 0x000027fe, 0x000f3efe, 0x000f40fe,
+	0x000f42fe, 0x000187fe, 0x000f4afe, 0x000f4efe, 0x000188fe, 0x000f55fe, 0x000189fe, 0x000f5dfe,
+	0x000f61fe, 0x00018afe, 0x000f68fe, 0x00018bfe, 0x000f70fe, 0x000f74fe, 0x00018cfe, 0x000f7bfe,
+	0x000f7ffe, 0x00018dfe, 0x000f87fe, 0x00018efe, 0x000f8ffe, 0x000f92fe, 0x00018ffe, 0x000f9afe,
+	0x000f9efe, 0x000004fe, 0x000fa5fe, 0x000191fe, 0x000fadfe, 0x000fb1fe, 0x000192fe, 0x000fb9fe,
+	0x000193fe, 0x000fc0fe, 0x000fc4fe, 0x000194fe, 0x000fccfe, 0x000fcffe, 0x000195fe, 0x000fd7fe,
+	0x000196fe, 0x000fdffe, 0x000fe2fe, 0x000197fe, 0x000feafe, 0x000feefe, 0x000198fe, 0x000ff6fe,
+	0x000199fe, 0x000ffdfe, 0x001001fe, 0x000029fe, 0x001009fe, 0x00019bfe, 0x001010fe, 0x001014fe,
+	0x00019cfe, 0x00101cfe, 0x001020fe, 0x00019dfe, 0x001027fe, 0x00019efe, 0x00102ffe, 0x001033fe,
+	0x00019ffe, 0x00103afe, 0x00103efe, 0x0001a0fe, 0x001046fe, 0x0001a1fe, 0x00104dfe, 0x001051fe,
+	0x0001a2fe, 0x001059fe, 0x0001a3fe, 0x001060fe, 0x001064fe, 0x00002afe, 0x00106cfe, 0x001070fe,
+	0x0001a5fe, 0x001077fe, 0x0001a6fe, 0x00107ffe, 0x001083fe, 0x0001a7fe, 0x00108afe, 0x0001a8fe,
+	0x001092fe, 0x001096fe, 0x0001a9fe, 0x00109dfe, 0x0010a1fe, 0x0001aafe, 0x0010a9fe, 0x0001abfe,
+	0x0010b0fe, 0x0010b4fe, 0x0001acfe, 0x0010bcfe, 0x0010c0fe, 0x0001adfe, 0x0010c7fe, 0x00002bfe,
+	0x0010cffe, 0x0010d3fe, 0x0001affe, 0x0010dafe, 0x0001b0fe, 0x0010e2fe, 0x0010e6fe, 0x0001b1fe,
+	0x0010edfe, 0x0010f1fe, 0x0001b2fe, 0x0010f9fe, 0x0001b3fe, 0x001101fe, 0x001104fe, 0x0001b4fe,
+	0x00110cfe, 0x001110fe, 0x0001b5fe, 0x001117fe, 0x0001b6fe, 0x00111ffe, 0x001123fe, 0x0001b7fe,
+	0x00112bfe, 0x00002cfe, 0x001132fe, 0x001136fe, 0x0001b9fe, 0x00113efe, 0x001141fe, 0x0001bafe,
+	0x001149fe, 0x0001bbfe, 0x001151fe, 0x001154fe, 0x0001bcfe, 0x00115cfe, 0x001160fe, 0x0001bdfe,
+	0x001168fe, 0x0001befe, 0x00116ffe, 0x001173fe, 0x0001bffe, 0x00117bfe, 0x0001c0fe, 0x001182fe,
+	0x001186fe, 0x0001c1fe, 0x00118efe, 0x001192fe, 0x00002dfe, 0x001199fe, 0x0001c3fe, 0x0011a1fe,
+	0x0011a5fe, 0x0001c4fe, 0x0011acfe, 0x0011b0fe, 0x0001c5fe, 0x0011b8fe, 0x0001c6fe, 0x0011bffe,
+	0x0011c3fe, 0x0001c7fe, 0x0011cbfe, 0x0001c8fe, 0x0011d2fe, 0x0011d6fe, 0x0001c9fe, 0x0011defe,
+	0x0011e2fe, 0x0001cafe, 0x0011e9fe, 0x0001cbfe, 0x0011f1fe, 0x0011f5fe, 0x00002efe, 0x0011fcfe,
+	0x0001cdfe, 0x001204fe, 0x001208fe, 0x0001cefe, 0x00120ffe, 0x001213fe, 0x0001cffe, 0x00121bfe,
+	0x0001d0fe, 0x001222fe, 0x001226fe, 0x0001d1fe, 0x00122efe, 0x001232fe, 0x0001d2fe, 0x001239fe,
+	0x0001d3fe, 0x001241fe, 0x001245fe, 0x0001d4fe, 0x00124cfe, 0x0001d5fe, 0x001254fe, 0x001258fe,
+	0x00002ffe, 0x001260fe, 0x001263fe, 0x0001d7fe, 0x00126bfe, 0x0001d8fe, 0x001273fe, 0x001276fe,
+	0x0001d9fe, 0x00127efe, 0x001282fe, 0x0001dafe, 0x001289fe, 0x0001dbfe, 0x001291fe, 0x001295fe,
+	0x0001dcfe, 0x00129dfe, 0x0001ddfe, 0x0012a4fe, 0x0012a8fe, 0x0001defe, 0x0012b0fe, 0x0012b3fe,
+	0x0001dffe, 0x0012bbfe, 0x000030fe, 0x0012c3fe, 0x0012c7fe, 0x0001e1fe, 0x0012cefe, 0x0012d2fe,
+	0x0001e2fe, 0x0012dafe, 0x0001e3fe, 0x0012e1fe, 0x0012e5fe, 0x0001e4fe, 0x0012edfe, 0x0001e5fe,
+	0x0012f4fe, 0x0012f8fe, 0x0001e6fe, 0x001300fe, 0x001304fe, 0x0001e7fe, 0x00130bfe, 0x0001e8fe,
+	0x001313fe, 0x001317fe, 0x0001e9fe, 0x00131efe, 0x001322fe, 0x000031fe, 0x00132afe, 0x0001ebfe,
+	0x001331fe, 0x001335fe, 0x0001ecfe, 0x00133dfe, 0x0001edfe, 0x001344fe, 0x001348fe, 0x0001eefe,
+	0x001350fe, 0x001354fe, 0x0001effe, 0x00135bfe, 0x0001f0fe, 0x001363fe, 0x001367fe, 0x0001f1fe,
+	0x00136efe, 0x0001f2fe, 0x001376fe, 0x00137afe, 0x0001f3fe, 0x001381fe, 0x001385fe, 0x000005fe,
+	0x00138dfe, 0x0001f5fe, 0x001395fe, 0x001398fe, 0x0001f6fe, 0x0013a0fe, 0x0013a4fe, 0x0001f7fe,
+	0x0013abfe, 0x0001f8fe, 0x0013b3fe, 0x0013b7fe, 0x0001f9fe, 0x0013befe, 0x0001fafe, 0x0013c6fe,
+	0x0013cafe, 0x0001fbfe, 0x0013d2fe, 0x0013d5fe, 0x0001fcfe, 0x0013ddfe, 0x0001fdfe, 0x0013e5fe,
+	0x0013e8fe, 0x000033fe, 0x0013f0fe, 0x0013f4fe, 0x0001fffe, 0x0013fcfe, 0x000200fe, 0x001403fe,
+	0x001407fe, 0x000201fe, 0x00140ffe, 0x000202fe, 0x001416fe, 0x00141afe, 0x000203fe, 0x001422fe,
+	0x001425fe, 0x000204fe, 0x00142dfe, 0x000205fe, 0x001435fe, 0x001439fe, 0x000206fe, 0x001440fe,
+	0x001444fe, 0x000207fe, 0x00144cfe, 0x000034fe, 0x001453fe, 0x001457fe, 0x000209fe, 0x00145ffe,
+	0x00020afe, 0x001466fe, 0x00146afe, 0x00020bfe, 0x001472fe, 0x001476fe, 0x00020cfe, 0x00147dfe,
+	0x00020dfe, 0x001485fe, 0x001489fe, 0x00020efe, 0x001490fe, 0x00020ffe, 0x001498fe, 0x00149cfe,
+	0x000210fe, 0x0014a3fe, 0x0014a7fe, 0x000211fe, 0x0014affe, 0x000035fe, 0x0014b6fe, 0x0014bafe,
+	0x000213fe, 0x0014c2fe, 0x0014c6fe, 0x000214fe, 0x0014cdfe, 0x000215fe, 0x0014d5fe, 0x0014d9fe,
+	0x000216fe, 0x0014e0fe, 0x000217fe, 0x0014e8fe, 0x0014ecfe, 0x000218fe, 0x0014f3fe, 0x0014f7fe,
+	0x000219fe, 0x0014fffe, 0x00021afe, 0x001507fe, 0x00150afe, 0x00021bfe, 0x001512fe, 0x001516fe,
+	0x000036fe, 0x00151dfe, 0x00021dfe, 0x001525fe, 0x001529fe, 0x00021efe, 0x001530fe, 0x00021ffe,
+	0x001538fe, 0x00153cfe, 0x000220fe, 0x001544fe, 0x001547fe, 0x000221fe, 0x00154ffe, 0x000222fe,
+	0x001557fe, 0x00155afe, 0x000223fe, 0x001562fe, 0x001566fe, 0x000224fe, 0x00156efe, 0x000225fe,
+	0x001575fe, 0x001579fe, 0x000037fe, 0x001581fe, 0x000227fe, 0x001588fe, 0x00158cfe, 0x000228fe,
+	0x001594fe, 0x001597fe, 0x000229fe, 0x00159ffe, 0x00022afe, 0x0015a7fe, 0x0015abfe, 0x00022bfe,
+	0x0015b2fe, 0x0015b6fe, 0x00022cfe, 0x0015befe, 0x00022dfe, 0x0015c5fe, 0x0015c9fe, 0x00022efe,
+	0x0015d1fe, 0x00022ffe, 0x0015d8fe, 0x0015dcfe, 0x000038fe, 0x0015e4fe, 0x0015e8fe, 0x000231fe,
+	0x0015effe, 0x000232fe, 0x0015f7fe, 0x0015fbfe, 0x000233fe, 0x001602fe, 0x000234fe, 0x00160afe,
+	0x00160efe, 0x000235fe, 0x001615fe, 0x001619fe, 0x000236fe, 0x001621fe, 0x000237fe, 0x001628fe,
+	0x00162cfe, 0x000238fe, 0x001634fe, 0x001638fe, 0x000239fe, 0x00163ffe, 0x000039fe, 0x001647fe,
+	0x00164bfe, 0x00023bfe, 0x001652fe, 0x00023cfe, 0x00165afe, 0x00165efe, 0x00023dfe, 0x001665fe,
+	0x001669fe, 0x00023efe, 0x001671fe, 0x00023ffe, 0x001679fe, 0x00167cfe, 0x000240fe, 0x001684fe,
+	0x001688fe, 0x000241fe, 0x00168ffe, 0x000242fe, 0x001697fe, 0x00169bfe, 0x000243fe, 0x0016a3fe,
+	0x00003afe, 0x0016aafe, 0x0016aefe, 0x000245fe, 0x0016b6fe, 0x0016b9fe, 0x000246fe, 0x0016c1fe,
+	0x000247fe, 0x0016c9fe, 0x0016ccfe, 0x000248fe, 0x0016d4fe, 0x0016d8fe, 0x000249fe, 0x0016e0fe,
+	0x00024afe, 0x0016e7fe, 0x0016ebfe, 0x00024bfe, 0x0016f3fe, 0x00024cfe, 0x0016fafe, 0x0016fefe,
+	0x00024dfe, 0x001706fe, 0x00170afe, 0x00003bfe, 0x001711fe, 0x00024ffe, 0x001719fe, 0x00171dfe,
+	0x000250fe, 0x001724fe, 0x001728fe, 0x000251fe, 0x001730fe, 0x000252fe, 0x001737fe, 0x00173bfe,
+	0x000253fe, 0x001743fe, 0x000254fe, 0x00174afe, 0x00174efe, 0x000255fe, 0x001756fe, 0x00175afe,
+	0x000256fe, 0x001761fe, 0x000257fe, 0x001769fe, 0x00176dfe, 0x000006fe, 0x001774fe, 0x000259fe,
+	0x00177cfe, 0x001780fe, 0x00025afe, 0x001787fe, 0x00178bfe, 0x00025bfe, 0x001793fe, 0x00025cfe,
+	0x00179afe, 0x00179efe, 0x00025dfe, 0x0017a6fe, 0x0017aafe, 0x00025efe, 0x0017b1fe, 0x00025ffe,
+	0x0017b9fe, 0x0017bdfe, 0x000260fe, 0x0017c4fe, 0x000261fe, 0x0017ccfe, 0x0017d0fe, 0x00003dfe,
+	0x0017d8fe, 0x0017dbfe, 0x000263fe, 0x0017e3fe, 0x000264fe, 0x0017ebfe, 0x0017eefe, 0x000265fe,
+	0x0017f6fe, 0x0017fafe, 0x000266fe, 0x001801fe, 0x000267fe, 0x001809fe, 0x00180dfe, 0x000268fe,
+	0x001815fe, 0x000269fe, 0x00181cfe, 0x001820fe, 0x00026afe, 0x001828fe, 0x00182bfe, 0x00026bfe,
+	0x001833fe, 0x00003efe, 0x00183bfe, 0x00183ffe, 0x00026dfe, 0x001846fe, 0x00184afe, 0x00026efe,
+	0x001852fe, 0x00026ffe, 0x001859fe, 0x00185dfe, 0x000270fe, 0x001865fe, 0x000271fe, 0x00186cfe,
+	0x001870fe, 0x000272fe, 0x001878fe, 0x00187cfe, 0x000273fe, 0x001883fe, 0x000274fe, 0x00188bfe,
+	0x00188ffe, 0x000275fe, 0x001896fe, 0x00189afe, 0x00003ffe, 0x0018a2fe, 0x000277fe, 0x0018a9fe,
+	0x0018adfe, 0x000278fe, 0x0018b5fe, 0x000279fe, 0x0018bcfe, 0x0018c0fe, 0x00027afe, 0x0018c8fe,
+	0x0018ccfe, 0x00027bfe, 0x0018d3fe, 0x00027cfe, 0x0018dbfe, 0x0018dffe, 0x00027dfe, 0x0018e6fe,
+	0x00027efe, 0x0018eefe, 0x0018f2fe, 0x00027ffe, 0x0018f9fe, 0x0018fdfe, 0x000040fe, 0x001905fe,
+	0x000281fe, 0x00190dfe, 0x001910fe, 0x000282fe, 0x001918fe, 0x00191cfe, 0x000283fe, 0x001923fe,
+	0x000284fe, 0x00192bfe, 0x00192ffe, 0x000285fe, 0x001936fe, 0x000286fe, 0x00193efe, 0x001942fe,
+	0x000287fe, 0x00194afe, 0x00194dfe, 0x000288fe, 0x001955fe, 0x000289fe, 0x00195dfe, 0x001960fe,
+	0x000041fe, 0x001968fe, 0x00196cfe, 0x00028bfe, 0x001974fe, 0x00028cfe, 0x00197bfe, 0x00197ffe,
+	0x00028dfe, 0x001987fe, 0x00028efe, 0x00198efe, 0x001992fe, 0x00028ffe, 0x00199afe, 0x00199dfe,
+	0x000290fe, 0x0019a5fe, 0x000291fe, 0x0019adfe, 0x0019b1fe, 0x000292fe, 0x0019b8fe, 0x0019bcfe,
+	0x000293fe, 0x0019c4fe, 0x000042fe, 0x0019cbfe, 0x0019cffe, 0x000295fe, 0x0019d7fe, 0x000296fe,
+	0x0019defe, 0x0019e2fe, 0x000297fe, 0x0019eafe, 0x0019eefe, 0x000298fe, 0x0019f5fe, 0x000299fe,
+	0x0019fdfe, 0x001a01fe, 0x00029afe, 0x001a08fe, 0x001a0cfe, 0x00029bfe, 0x001a14fe, 0x00029cfe,
+	0x001a1bfe, 0x001a1ffe, 0x00029dfe, 0x001a27fe, 0x000043fe, 0x001a2efe, 0x001a32fe, 0x00029ffe,
+	0x001a3afe, 0x001a3efe, 0x0002a0fe, 0x001a45fe, 0x0002a1fe, 0x001a4dfe, 0x001a51fe, 0x0002a2fe,
+	0x001a58fe, 0x0002a3fe, 0x001a60fe, 0x001a64fe, 0x0002a4fe, 0x001a6bfe, 0x001a6ffe, 0x0002a5fe,
+	0x001a77fe, 0x0002a6fe, 0x001a7ffe, 0x001a82fe, 0x0002a7fe, 0x001a8afe, 0x001a8efe, 0x000044fe,
+	0x001a95fe, 0x0002a9fe, 0x001a9dfe, 0x001aa1fe, 0x0002aafe, 0x001aa8fe, 0x0002abfe, 0x001ab0fe,
+	0x001ab4fe, 0x0002acfe, 0x001abcfe, 0x001abffe, 0x0002adfe, 0x001ac7fe, 0x0002aefe, 0x001acffe,
+	0x001ad2fe, 0x0002affe, 0x001adafe, 0x001adefe, 0x0002b0fe, 0x001ae6fe, 0x0002b1fe, 0x001aedfe,
+	0x001af1fe, 0x000045fe, 0x001af9fe, 0x0002b3fe, 0x001b00fe, 0x001b04fe, 0x0002b4fe, 0x001b0cfe,
+	0x001b0ffe, 0x0002b5fe, 0x001b17fe, 0x0002b6fe, 0x001b1ffe, 0x001b23fe, 0x0002b7fe, 0x001b2afe,
+	0x001b2efe, 0x0002b8fe, 0x001b36fe, 0x0002b9fe, 0x001b3dfe, 0x001b41fe, 0x0002bafe, 0x001b49fe,
+	0x0002bbfe, 0x001b50fe, 0x001b54fe, 0x000007fe, 0x001b5cfe, 0x001b60fe, 0x0002bdfe, 0x001b67fe,
+	0x0002befe, 0x001b6ffe, 0x001b73fe, 0x0002bffe, 0x001b7afe, 0x0002c0fe, 0x001b82fe, 0x001b86fe,
+	0x0002c1fe, 0x001b8dfe, 0x001b91fe, 0x0002c2fe, 0x001b99fe, 0x0002c3fe, 0x001ba0fe, 0x001ba4fe,
+	0x0002c4fe, 0x001bacfe, 0x001bb0fe, 0x0002c5fe, 0x001bb7fe, 0x000047fe, 0x001bbffe, 0x001bc3fe,
+	0x0002c7fe, 0x001bcafe, 0x0002c8fe, 0x001bd2fe, 0x001bd6fe, 0x0002c9fe, 0x001bddfe, 0x001be1fe,
+	0x0002cafe, 0x001be9fe, 0x0002cbfe, 0x001bf1fe, 0x001bf4fe, 0x0002ccfe, 0x001bfcfe, 0x001c00fe,
+	0x0002cdfe, 0x001c07fe, 0x0002cefe, 0x001c0ffe, 0x001c13fe, 0x0002cffe, 0x001c1bfe, 0x000048fe,
+	0x001c22fe, 0x001c26fe, 0x0002d1fe, 0x001c2efe, 0x001c31fe, 0x0002d2fe, 0x001c39fe, 0x0002d3fe,
+	0x001c41fe, 0x001c44fe, 0x0002d4fe, 0x001c4cfe, 0x001c50fe, 0x0002d5fe, 0x001c58fe, 0x0002d6fe,
+	0x001c5ffe, 0x001c63fe, 0x0002d7fe, 0x001c6bfe, 0x0002d8fe, 0x001c72fe, 0x001c76fe, 0x0002d9fe,
+	0x001c7efe, 0x001c82fe, 0x000049fe, 0x001c89fe, 0x0002dbfe, 0x001c91fe, 0x001c95fe, 0x0002dcfe,
+	0x001c9cfe, 0x001ca0fe, 0x0002ddfe, 0x001ca8fe, 0x0002defe, 0x001caffe, 0x001cb3fe, 0x0002dffe,
+	0x001cbbfe, 0x0002e0fe, 0x001cc2fe, 0x001cc6fe, 0x0002e1fe, 0x001ccefe, 0x001cd2fe, 0x0002e2fe,
+	0x001cd9fe, 0x0002e3fe, 0x001ce1fe, 0x001ce5fe, 0x00004afe, 0x001cecfe, 0x0002e5fe, 0x001cf4fe,
+	0x001cf8fe, 0x0002e6fe, 0x001cfffe, 0x001d03fe, 0x0002e7fe, 0x001d0bfe, 0x0002e8fe, 0x001d12fe,
+	0x001d16fe, 0x0002e9fe, 0x001d1efe, 0x001d22fe, 0x0002eafe, 0x001d29fe, 0x0002ebfe, 0x001d31fe,
+	0x001d35fe, 0x0002ecfe, 0x001d3cfe, 0x0002edfe, 0x001d44fe, 0x001d48fe, 0x00004bfe, 0x001d50fe,
+	0x001d53fe, 0x0002effe, 0x001d5bfe, 0x0002f0fe, 0x001d63fe, 0x001d66fe, 0x0002f1fe, 0x001d6efe,
+	0x001d72fe, 0x0002f2fe, 0x001d79fe, 0x0002f3fe, 0x001d81fe, 0x001d85fe, 0x0002f4fe, 0x001d8dfe,
+	0x0002f5fe, 0x001d94fe, 0x001d98fe, 0x0002f6fe, 0x001da0fe, 0x001da3fe, 0x0002f7fe, 0x001dabfe,
+	0x00004cfe, 0x001db3fe, 0x001db7fe, 0x0002f9fe, 0x001dbefe, 0x001dc2fe, 0x0002fafe, 0x001dcafe,
+	0x0002fbfe, 0x001dd1fe, 0x001dd5fe, 0x0002fcfe, 0x001dddfe, 0x0002fdfe, 0x001de4fe, 0x001de8fe,
+	0x0002fefe, 0x001df0fe, 0x001df4fe, 0x0002fffe, 0x001dfbfe, 0x000300fe, 0x001e03fe, 0x001e07fe,
+	0x000301fe, 0x001e0efe, 0x001e12fe, 0x00004dfe, 0x001e1afe, 0x000303fe, 0x001e21fe, 0x001e25fe,
+	0x000304fe, 0x001e2dfe, 0x000305fe, 0x001e34fe, 0x001e38fe, 0x000306fe, 0x001e40fe, 0x001e44fe,
+	0x000307fe, 0x001e4bfe, 0x000308fe, 0x001e53fe, 0x001e57fe, 0x000309fe, 0x001e5efe, 0x00030afe,
+	0x001e66fe, 0x001e6afe, 0x00030bfe, 0x001e71fe, 0x001e75fe, 0x00004efe, 0x001e7dfe, 0x00030dfe,
+	0x001e84fe, 0x00030efe, 0x00030ffe, 0x001e9bfe, 0x000310fe, 0x000311fe, 0x000312fe, 0x001ebafe,
+	0x000313fe, 0x000314fe, 0x000315fe, 0x00004ffe, 0x001ee0fe, 0x000317fe, 0x000318fe, 0x000319fe,
+	0x001efffe, 0x00031afe, 0x00031bfe, 0x00031cfe, 0x001f1dfe, 0x00031dfe, 0x00031efe, 0x00031ffe,
+	0x001f3cfe, 0x000008fe, 0x000321fe, 0x000322fe, 0x001f5afe, 0x000323fe, 0x000324fe, 0x000325fe,
+	0x000326fe, 0x001f80fe, 0x000327fe, 0x000328fe, 0x000329fe, 0x001f9ffe, 0x000051fe, 0x00032bfe,
+	0x00032cfe, 0x001fbdfe, 0x00032dfe, 0x00032efe, 0x00032ffe, 0x001fdcfe, 0x000330fe, 0x000331fe,
+	0x000332fe, 0x000333fe, 0x002002fe, 0x000052fe, 0x000335fe, 0x000336fe, 0x002020fe, 0x000337fe,
+	0x000338fe, 0x000339fe, 0x00203ffe, 0x00033afe, 0x00033bfe, 0x00033cfe, 0x00205efe, 0x00033dfe,
+	0x000053fe, 0x00033ffe, 0x00207cfe, 0x000340fe, 0x000341fe, 0x000342fe, 0x000343fe, 0x0020a2fe,
+	0x000344fe, 0x000345fe, 0x000346fe, 0x0020c1fe, 0x000347fe, 0x000054fe, 0x000349fe, 0x0020dffe,
+	0x00034afe, 0x00034bfe, 0x00034cfe, 0x0020fefe, 0x00034dfe, 0x00034efe, 0x00034ffe, 0x000350fe,
+	0x002124fe, 0x000351fe, 0x000055fe, 0x000353fe, 0x002142fe, 0x000354fe, 0x000355fe, 0x000356fe,
+	0x002161fe, 0x000357fe, 0x000358fe, 0x000359fe, 0x00217ffe, 0x00035afe, 0x00035bfe, 0x000056fe,
+	0x00219efe, 0x00035dfe, 0x00035efe, 0x00035ffe, 0x000360fe, 0x0021c4fe, 0x000361fe, 0x000362fe,
+	0x000363fe, 0x0021e3fe, 0x000364fe, 0x000365fe, 0x000057fe, 0x002201fe, 0x000367fe, 0x000368fe,
+	0x000369fe, 0x002220fe, 0x00036afe, 0x00036bfe, 0x00036cfe, 0x00223efe, 0x00036dfe, 0x00036efe,
+	0x00036ffe, 0x000058fe, 0x002264fe, 0x000371fe, 0x000372fe, 0x000373fe, 0x002283fe, 0x000374fe,
+	0x000375fe, 0x000376fe, 0x0022a1fe, 0x000377fe, 0x000378fe, 0x000379fe, 0x0022c0fe, 0x000059fe,
+	0x00037bfe, 0x00037cfe, 0x00037dfe, 0x0022e6fe, 0x00037efe, 0x00037ffe, 0x000380fe, 0x002305fe,
+	0x000381fe, 0x000382fe, 0x000383fe, 0x002323fe, 0x000009fe, 0x000385fe, 0x000386fe, 0x002342fe,
+	0x000387fe, 0x000388fe, 0x000389fe, 0x002360fe, 0x00038afe, 0x00038bfe, 0x00038cfe, 0x00038dfe,
+	0x002386fe, 0x00005bfe, 0x00038ffe, 0x000390fe, 0x0023a5fe, 0x000391fe, 0x000392fe, 0x000393fe,
+	0x0023c3fe, 0x000394fe, 0x000395fe, 0x000396fe, 0x0023e2fe, 0x000397fe, 0x00005cfe, 0x000399fe,
+	0x00039afe, 0x002408fe, 0x00039bfe, 0x00039cfe, 0x00039dfe, 0x002426fe, 0x00039efe, 0x00039ffe,
+	0x0003a0fe, 0x002445fe, 0x0003a1fe, 0x00005dfe, 0x0003a3fe, 0x002463fe, 0x0003a4fe, 0x0003a5fe,
+	0x0003a6fe, 0x002482fe, 0x0003a7fe, 0x0003a8fe, 0x0003a9fe, 0x0003aafe, 0x0024a8fe, 0x0003abfe,
+	0x00005efe, 0x0003adfe, 0x0024c7fe, 0x0003aefe, 0x0003affe, 0x0003b0fe, 0x0024e5fe, 0x0003b1fe,
+	0x0003b2fe, 0x0003b3fe, 0x002504fe, 0x0003b4fe, 0x0003b5fe, 0x00005ffe, 0x0003b7fe, 0x00252afe,
+	0x0003b8fe, 0x0003b9fe, 0x0003bafe, 0x002548fe, 0x0003bbfe, 0x0003bcfe, 0x0003bdfe, 0x002567fe,
+	0x0003befe, 0x0003bffe, 0x000060fe, 0x002585fe, 0x0003c1fe, 0x0003c2fe, 0x0003c3fe, 0x0025a4fe,
+	0x0003c4fe, 0x0003c5fe, 0x0003c6fe, 0x0003c7fe, 0x0025cafe, 0x0003c8fe, 0x0003c9fe, 0x000061fe,
+	0x0025e9fe, 0x0003cbfe, 0x0003ccfe, 0x0003cdfe, 0x002607fe, 0x0003cefe, 0x0003cffe, 0x0003d0fe,
+	0x002626fe, 0x0003d1fe, 0x0003d2fe, 0x0003d3fe, 0x002644fe, 0x000062fe, 0x0003d5fe, 0x0003d6fe,
+	0x0003d7fe, 0x00266afe, 0x0003d8fe, 0x0003d9fe, 0x0003dafe, 0x002689fe, 0x0003dbfe, 0x0003dcfe,
+	0x0003ddfe, 0x0026a7fe, 0x000063fe, 0x0003dffe, 0x0003e0fe, 0x0026c6fe, 0x0003e1fe, 0x0003e2fe,
+	0x0003e3fe, 0x0003e4fe, 0x0026ecfe, 0x0003e5fe, 0x0003e6fe, 0x0003e7fe, 0x00270bfe, 0x000001ff,
+	0x0003e9ff, 0x0003eaff, 0x002729ff, 0x0003ebff, 0x0003ecff, 0x0003edff, 0x002748ff, 0x0003eeff,
+	0x0003efff, 0x0003f0ff, 0x002766ff, 0x0003f1ff, 0x000065ff, 0x0003f3ff, 0x0003f4ff, 0x00278cff,
+	0x0003f5ff, 0x0003f6ff, 0x0003f7ff, 0x0027abff, 0x0003f8ff, 0x0003f9ff, 0x0003faff, 0x0027c9ff,
+	0x0003fbff, 0x000066ff, 0x0003fdff, 0x0027e8ff, 0x0003feff, 0x0003ffff, 0x000400ff, 0x000401ff,
+	0x00280eff, 0x000402ff, 0x000403ff, 0x000404ff, 0x00282cff, 0x000405ff, 0x000067ff, 0x000407ff,
+	0x00284bff, 0x000408ff, 0x000409ff, 0x00040aff, 0x002869ff, 0x00040bff, 0x00040cff, 0x00040dff,
+	0x002888ff, 0x00040eff, 0x00040fff, 0x000068ff, 0x000411ff, 0x0028aeff, 0x000412ff, 0x000413ff,
+	0x000414ff, 0x0028cdff, 0x000415ff, 0x000416ff, 0x000417ff, 0x0028ebff, 0x000418ff, 0x000419ff,
+	0x000069ff, 0x00290aff, 0x00041bff, 0x00041cff, 0x00041dff, 0x00041eff, 0x002930ff, 0x00041fff,
+	0x000420ff, 0x000421ff, 0x00294eff, 0x000422ff, 0x000423ff, 0x00006aff, 0x00296dff, 0x000425ff,
+	0x000426ff, 0x000427ff, 0x00298bff, 0x000428ff, 0x000429ff, 0x00042aff, 0x0029aaff, 0x00042bff,
+	0x00042cff, 0x00042dff, 0x00006bff, 0x0029d0ff, 0x00042fff, 0x000430ff, 0x000431ff, 0x0029efff,
+	0x000432ff, 0x000433ff, 0x000434ff, 0x002a0dff, 0x000435ff, 0x000436ff, 0x000437ff, 0x002a2cff,
+	0x00006cff, 0x000439ff, 0x00043aff, 0x002a4aff, 0x00043bff, 0x00043cff, 0x00043dff, 0x00043eff,
+	0x002a70ff, 0x00043fff, 0x000440ff, 0x000441ff, 0x002a8fff, 0x00006dff, 0x000443ff, 0x000444ff,
+	0x002aadff, 0x000445ff, 0x000446ff, 0x000447ff, 0x002accff, 0x000448ff, 0x000449ff, 0x00044aff,
+	0x00044bff, 0x002af2ff, 0x00000bff, 0x00044dff, 0x00044eff, 0x002b10ff, 0x00044fff, 0x000450ff,
+	0x000451ff, 0x002b2fff, 0x000452ff, 0x000453ff, 0x000454ff, 0x002b4eff, 0x000455ff, 0x00006fff,
+	0x000457ff, 0x002b6cff, 0x000458ff, 0x000459ff, 0x00045aff, 0x00045bff, 0x002b92ff, 0x00045cff,
+	0x00045dff, 0x00045eff, 0x002bb1ff, 0x00045fff, 0x000070ff, 0x000461ff, 0x002bcfff, 0x000462ff,
+	0x000463ff, 0x000464ff, 0x002beeff, 0x000465ff, 0x000466ff, 0x000467ff, 0x000468ff, 0x002c14ff,
+	0x000469ff, 0x000071ff, 0x00046bff, 0x002c32ff, 0x00046cff, 0x00046dff, 0x00046eff, 0x002c51ff,
+	0x00046fff, 0x000470ff, 0x000471ff, 0x002c6fff, 0x000472ff, 0x000473ff, 0x000072ff, 0x002c8eff,
+	0x000475ff, 0x000476ff, 0x000477ff, 0x000478ff, 0x002cb4ff, 0x000479ff, 0x00047aff, 0x00047bff,
+	0x002cd3ff, 0x00047cff, 0x00047dff, 0x000073ff, 0x002cf1ff, 0x00047fff, 0x000480ff, 0x000481ff,
+	0x002d10ff, 0x000482ff, 0x000483ff, 0x000484ff, 0x002d2eff, 0x000485ff, 0x000486ff, 0x000487ff,
+	0x000074ff, 0x002d54ff, 0x000489ff, 0x00048aff, 0x00048bff, 0x002d73ff, 0x00048cff, 0x00048dff,
+	0x00048eff, 0x002d91ff, 0x00048fff, 0x000490ff, 0x000491ff, 0x002db0ff, 0x000075ff, 0x000493ff,
+	0x000494ff, 0x000495ff, 0x002dd6ff, 0x000496ff, 0x000497ff, 0x000498ff, 0x002df5ff, 0x000499ff,
+	0x00049aff, 0x00049bff, 0x002e13ff, 0x000076ff, 0x00049dff, 0x00049eff, 0x002e32ff, 0x00049fff,
+	0x0004a0ff, 0x0004a1ff, 0x002e50ff, 0x0004a2ff, 0x0004a3ff, 0x0004a4ff, 0x0004a5ff, 0x002e76ff,
+	0x000077ff, 0x0004a7ff, 0x0004a8ff, 0x002e95ff, 0x0004a9ff, 0x0004aaff, 0x0004abff, 0x002eb3ff,
+	0x0004acff, 0x0004adff, 0x0004aeff, 0x002ed2ff, 0x0004afff, 0x00000cff, 0x0004b1ff, 0x0004b2ff,
+	0x002ef8ff, 0x0004b3ff, 0x0004b4ff, 0x0004b5ff, 0x002f16ff, 0x0004b6ff, 0x0004b7ff, 0x0004b8ff,
+	0x002f35ff, 0x0004b9ff, 0x000079ff, 0x0004bbff, 0x002f53ff, 0x0004bcff, 0x0004bdff, 0x0004beff,
+	0x002f72ff, 0x0004bfff, 0x0004c0ff, 0x0004c1ff, 0x0004c2ff, 0x002f98ff, 0x0004c3ff, 0x00007aff,
+	0x0004c5ff, 0x002fb7ff, 0x0004c6ff, 0x0004c7ff, 0x0004c8ff, 0x002fd5ff, 0x0004c9ff, 0x0004caff,
+	0x0004cbff, 0x002ff4ff, 0x0004ccff, 0x0004cdff, 0x00007bff, 0x0004cfff, 0x00301aff, 0x0004d0ff,
+	0x0004d1ff, 0x0004d2ff, 0x003038ff, 0x0004d3ff, 0x0004d4ff, 0x0004d5ff, 0x003057ff, 0x0004d6ff,
+	0x0004d7ff, 0x00007cff, 0x003075ff, 0x0004d9ff, 0x0004daff, 0x0004dbff, 0x003094ff, 0x0004dcff,
+	0x0004ddff, 0x0004deff, 0x0004dfff, 0x0030baff, 0x0004e0ff, 0x0004e1ff, 0x00007dff, 0x0030d9ff,
+	0x0004e3ff, 0x0004e4ff, 0x0004e5ff, 0x0030f7ff, 0x0004e6ff, 0x0004e7ff, 0x0004e8ff, 0x003116ff,
+	0x0004e9ff, 0x0004eaff, 0x0004ebff, 0x003134ff, 0x00007eff, 0x0004edff, 0x0004eeff, 0x0004efff,
+	0x00315aff, 0x0004f0ff, 0x0004f1ff, 0x0004f2ff, 0x003179ff, 0x0004f3ff, 0x0004f4ff, 0x0004f5ff,
+	0x003197ff, 0x00007fff, 0x0004f7ff, 0x0004f8ff, 0x0031b6ff, 0x0004f9ff, 0x0004faff, 0x0004fbff,
+	0x0004fcff, 0x0031dcff, 0x0004fdff, 0x0004feff, 0x0004ffff, 0x0031faff, 0x000080ff, 0x000501ff,
+	0x000502ff, 0x003219ff, 0x000503ff, 0x000504ff, 0x000505ff, 0x003238ff, 0x000506ff, 0x000507ff,
+	0x000508ff, 0x003256ff, 0x000509ff, 0x000081ff, 0x00050bff, 0x00050cff, 0x00327cff, 0x00050dff,
+	0x00050eff, 0x00050fff, 0x00329bff, 0x000510ff, 0x000511ff, 0x000512ff, 0x0032b9ff, 0x000513ff,
+	0x00000dff, 0x000515ff, 0x0032d8ff, 0x000516ff, 0x000517ff, 0x000518ff, 0x000519ff, 0x0032feff,
+	0x00051aff, 0x00051bff, 0x00051cff, 0x00331cff, 0x00051dff, 0x000083ff, 0x00051fff, 0x00333bff,
+	0x000520ff, 0x000521ff, 0x000522ff, 0x003359ff, 0x000523ff, 0x000524ff, 0x000525ff, 0x003378ff,
+	0x000526ff, 0x000527ff, 0x000084ff, 0x000529ff, 0x00339eff, 0x00052aff, 0x00052bff, 0x00052cff,
+	0x0033bdff, 0x00052dff, 0x00052eff, 0x00052fff, 0x0033dbff, 0x000530ff, 0x000531ff, 0x000085ff,
+	0x0033faff, 0x000533ff, 0x000534ff, 0x000535ff, 0x003418ff, 0x000536ff, 0x000537ff, 0x000538ff,
+	0x000539ff, 0x00343eff, 0x00053aff, 0x00053bff, 0x000086ff, 0x00345dff, 0x00053dff, 0x00053eff,
+	0x00053fff, 0x00347bff, 0x000540ff, 0x000541ff, 0x000542ff, 0x00349aff, 0x000543ff, 0x000544ff,
+	0x000545ff, 0x000087ff, 0x0034c0ff, 0x000547ff, 0x000548ff, 0x000549ff, 0x0034dfff, 0x00054aff,
+	0x00054bff, 0x00054cff, 0x0034fdff, 0x00054dff, 0x00054eff, 0x00054fff, 0x00351cff, 0x000088ff,
+	0x000551ff, 0x000552ff, 0x00353aff, 0x000553ff, 0x000554ff, 0x000555ff, 0x000556ff, 0x003560ff,
+	0x000557ff, 0x000558ff, 0x000559ff, 0x00357fff, 0x000089ff, 0x00055bff, 0x00055cff, 0x00359dff,
+	0x00055dff, 0x00055eff, 0x00055fff, 0x0035bcff, 0x000560ff, 0x000561ff, 0x000562ff, 0x000563ff,
+	0x0035e2ff, 0x00008aff, 0x000565ff, 0x000566ff, 0x003600ff, 0x000567ff, 0x000568ff, 0x000569ff,
+	0x00361fff, 0x00056aff, 0x00056bff, 0x00056cff, 0x00363dff, 0x00056dff, 0x00008bff, 0x00056fff,
+	0x00365cff, 0x000570ff, 0x000571ff, 0x000572ff, 0x000573ff, 0x003682ff, 0x000574ff, 0x000575ff,
+	0x000576ff, 0x0036a1ff, 0x000577ff, 0x00000eff, 0x000579ff, 0x0036bfff, 0x00057aff, 0x00057bff,
+	0x00057cff, 0x0036deff, 0x00057dff, 0x00057eff, 0x00057fff, 0x000580ff, 0x003704ff, 0x000581ff,
+	0x00008dff, 0x000583ff, 0x003722ff, 0x000584ff, 0x000585ff, 0x000586ff, 0x003741ff, 0x000587ff,
+	0x000588ff, 0x000589ff, 0x00375fff, 0x00058aff, 0x00058bff, 0x00008eff, 0x00377eff, 0x00058dff,
+	0x00058eff, 0x00058fff, 0x000590ff, 0x0037a4ff, 0x000591ff, 0x000592ff, 0x000593ff, 0x0037c3ff,
+	0x000594ff, 0x000595ff, 0x00008fff, 0x0037e1ff, 0x000597ff, 0x000598ff, 0x000599ff, 0x003800ff,
+	0x00059aff, 0x00059bff, 0x00059cff, 0x00381eff, 0x00059dff, 0x00059eff, 0x00059fff, 0x000090ff,
+	0x003844ff, 0x0005a1ff, 0x0005a2ff, 0x0005a3ff, 0x003863ff, 0x0005a4ff, 0x0005a5ff, 0x0005a6ff,
+	0x003881ff, 0x0005a7ff, 0x0005a8ff, 0x0005a9ff, 0x0038a0ff, 0x000091ff, 0x0005abff, 0x0005acff,
+	0x0005adff, 0x0038c6ff, 0x0005aeff, 0x0005afff, 0x0005b0ff, 0x0038e5ff, 0x0005b1ff, 0x0005b2ff,
+	0x0005b3ff, 0x003903ff, 0x000092ff, 0x0005b5ff, 0x0005b6ff, 0x003922ff, 0x0005b7ff, 0x0005b8ff,
+	0x0005b9ff, 0x003940ff, 0x0005baff, 0x0005bbff, 0x0005bcff, 0x0005bdff, 0x003966ff, 0x000093ff,
+	0x0005bfff, 0x0005c0ff, 0x003985ff, 0x0005c1ff, 0x0005c2ff, 0x0005c3ff, 0x0039a3ff, 0x0005c4ff,
+	0x0005c5ff, 0x0005c6ff, 0x0039c2ff, 0x0005c7ff, 0x000094ff, 0x0005c9ff, 0x0005caff, 0x0039e8ff,
+	0x0005cbff, 0x0005ccff, 0x0005cdff, 0x003a06ff, 0x0005ceff, 0x0005cfff, 0x0005d0ff, 0x003a25ff,
+	0x0005d1ff, 0x000095ff, 0x0005d3ff, 0x003a43ff, 0x0005d4ff, 0x0005d5ff, 0x0005d6ff, 0x003a62ff,
+	0x0005d7ff, 0x0005d8ff, 0x0005d9ff, 0x0005daff, 0x003a88ff, 0x0005dbff, 0x00000fff, 0x0005ddff,
+	0x003aa7ff, 0x0005deff, 0x0005dfff, 0x0005e0ff, 0x003ac5ff, 0x0005e1ff, 0x0005e2ff, 0x0005e3ff,
+	0x003ae4ff, 0x0005e4ff, 0x0005e5ff, 0x000097ff, 0x0005e7ff, 0x003b0aff, 0x0005e8ff, 0x0005e9ff,
+	0x0005eaff, 0x003b28ff, 0x0005ebff, 0x0005ecff, 0x0005edff, 0x003b47ff, 0x0005eeff, 0x0005efff,
+	0x000098ff, 0x003b65ff, 0x0005f1ff, 0x0005f2ff, 0x0005f3ff, 0x003b84ff, 0x0005f4ff, 0x0005f5ff,
+	0x0005f6ff, 0x0005f7ff, 0x003baaff, 0x0005f8ff, 0x0005f9ff, 0x000099ff, 0x003bc9ff, 0x0005fbff,
+	0x0005fcff, 0x0005fdff, 0x003be7ff, 0x0005feff, 0x0005ffff, 0x000600ff, 0x003c06ff, 0x000601ff,
+	0x000602ff, 0x000603ff, 0x003c24ff, 0x00009aff, 0x000605ff, 0x000606ff, 0x000607ff, 0x003c4aff,
+	0x000608ff, 0x000609ff, 0x00060aff, 0x003c69ff, 0x00060bff, 0x00060cff, 0x00060dff, 0x003c87ff,
+	0x00009bff, 0x00060fff, 0x000610ff, 0x003ca6ff, 0x000611ff, 0x000612ff, 0x000613ff, 0x000614ff,
+	0x003cccff, 0x000615ff, 0x000616ff, 0x000617ff, 0x003ceaff, 0x00009cff, 0x000619ff, 0x00061aff,
+	0x00061bff, 0x00061cff, 0x00061eff, 0x00061fff, 0x000621ff, 0x00009dff, 0x000624ff, 0x000625ff,
+	0x000627ff, 0x000628ff, 0x00062aff, 0x00009eff, 0x00062dff, 0x00062eff, 0x000630ff, 0x000631ff,
+	0x000633ff, 0x000634ff, 0x00009fff, 0x000637ff, 0x000639ff, 0x00063bff, 0x00063cff, 0x00063eff,
+	0x00063fff, 0x000010ff, 0x000642ff, 0x000644ff, 0x000645ff, 0x000647ff, 0x000648ff, 0x0000a1ff,
+	0x00064bff, 0x00064dff, 0x00064eff, 0x000650ff, 0x000651ff, 0x000653ff, 0x0000a2ff, 0x000656ff,
+	0x000658ff, 0x000659ff, 0x00065bff, 0x00065cff, 0x0000a3ff, 0x00065fff, 0x000661ff, 0x000662ff,
+	0x000664ff, 0x000665ff, 0x000667ff, 0x0000a4ff, 0x00066aff, 0x00066bff, 0x00066dff, 0x00066eff,
+	0x000670ff, 0x0000a5ff, 0x000673ff, 0x000675ff, 0x000676ff, 0x000678ff, 0x000679ff, 0x00067bff,
+	0x0000a6ff, 0x00067eff, 0x00067fff, 0x000681ff, 0x000682ff, 0x000684ff, 0x0000a7ff, 0x000687ff,
+	0x000688ff, 0x00068aff, 0x00068bff, 0x00068dff, 0x00068eff, 0x0000a8ff, 0x000692ff, 0x000693ff,
+	0x000695ff, 0x000696ff, 0x000698ff, 0x000699ff, 0x0000a9ff, 0x00069cff, 0x00069eff, 0x00069fff,
+	0x0006a1ff, 0x0006a2ff, 0x000011ff, 0x0006a5ff, 0x0006a7ff, 0x0006a8ff, 0x0006aaff, 0x0006abff,
+	0x0006adff, 0x0000abff, 0x0006b0ff, 0x0006b2ff, 0x0006b3ff, 0x0006b5ff, 0x0006b6ff, 0x0000acff,
+	0x0006b9ff, 0x0006bbff, 0x0006bcff, 0x0006beff, 0x0006bfff, 0x0006c1ff, 0x0000adff, 0x0006c4ff,
+	0x0006c5ff, 0x0006c7ff, 0x0006c8ff, 0x0006caff, 0x0000aeff, 0x0006cdff, 0x0006cfff, 0x0006d0ff,
+	0x0006d2ff, 0x0006d3ff, 0x0006d5ff, 0x0000afff, 0x0006d8ff, 0x0006d9ff, 0x0006dbff, 0x0006dcff,
+	0x0006deff, 0x0000b0ff, 0x0006e1ff, 0x0006e2ff, 0x0006e4ff, 0x0006e5ff, 0x0006e7ff, 0x0006e8ff,
+	0x0000b1ff, 0x0006ecff, 0x0006edff, 0x0006efff, 0x0006f0ff, 0x0006f2ff, 0x0006f3ff, 0x0000b2ff,
+	0x0006f6ff, 0x0006f8ff, 0x0006f9ff, 0x0006fbff, 0x0006fcff, 0x0000b3ff, 0x0006ffff, 0x000701ff,
+	0x000702ff, 0x000704ff, 0x000705ff, 0x000707ff, 0x000012ff, 0x00070aff, 0x00070cff, 0x00070dff,
+	0x00070fff, 0x000710ff, 0x0000b5ff, 0x000713ff, 0x000715ff, 0x000716ff, 0x000718ff, 0x000719ff,
+	0x00071bff, 0x0000b6ff, 0x00071eff, 0x00071fff, 0x000721ff, 0x000722ff, 0x000724ff, 0x0000b7ff,
+	0x000727ff, 0x000729ff, 0x00072aff, 0x00072cff, 0x00072dff, 0x00072fff, 0x0000b8ff, 0x000732ff,
+	0x000733ff, 0x000735ff, 0x000736ff, 0x000738ff, 0x0000b9ff, 0x00073bff, 0x00073cff, 0x00073eff,
+	0x00073fff, 0x000741ff, 0x000743ff, 0x0000baff, 0x000746ff, 0x000747ff, 0x000749ff, 0x00074aff,
+	0x00074cff, 0x00074dff, 0x0000bbff, 0x000750ff, 0x000752ff, 0x000753ff, 0x000755ff, 0x000756ff,
+	0x0000bcff, 0x000759ff, 0x00075bff, 0x00075cff, 0x00075eff, 0x000760ff, 0x000761ff, 0x0000bdff,
+	0x000764ff, 0x000766ff, 0x000767ff, 0x000769ff, 0x00076aff, 0x000013ff, 0x00076dff, 0x00076fff,
+	0x000770ff, 0x000772ff, 0x000773ff, 0x000775ff, 0x0000bfff, 0x000778ff, 0x000779ff, 0x00077bff,
+	0x00077dff, 0x00077eff, 0x0000c0ff, 0x000781ff, 0x000783ff, 0x000784ff, 0x000786ff, 0x000787ff,
+	0x000789ff, 0x0000c1ff, 0x00078cff, 0x00078dff, 0x00078fff, 0x000790ff, 0x000792ff, 0x0000c2ff,
+	0x000795ff, 0x000796ff, 0x000798ff, 0x000799ff, 0x00079bff, 0x00079dff, 0x0000c3ff, 0x0007a0ff,
+	0x0007a1ff, 0x0007a3ff, 0x0007a4ff, 0x0007a6ff, 0x0007a7ff, 0x0000c4ff, 0x0007aaff, 0x0007acff,
+	0x0007adff, 0x0007afff, 0x0007b0ff, 0x0000c5ff, 0x0007b3ff, 0x0007b5ff, 0x0007b6ff, 0x0007b8ff,
+	0x0007baff, 0x0007bbff, 0x0000c6ff, 0x0007beff, 0x0007c0ff, 0x0007c1ff, 0x0007c3ff, 0x0007c4ff,
+	0x0000c7ff, 0x0007c7ff, 0x0007c9ff, 0x0007caff, 0x0007ccff, 0x0007cdff, 0x0007cfff, 0x000002ff,
+	0x0007d2ff, 0x0007d3ff, 0x0007d5ff, 0x0007d7ff, 0x0007d8ff, 0x0000c9ff, 0x0007dbff, 0x0007ddff,
+	0x0007deff, 0x0007e0ff, 0x0007e1ff, 0x0007e3ff, 0x0000caff, 0x0007e6ff, 0x0007e7ff, 0x0007e9ff,
+	0x0007eaff, 0x0007ecff, 0x0000cbff, 0x0007efff, 0x0007f0ff, 0x0007f2ff, 0x0007f4ff, 0x0007f5ff,
+	0x0007f7ff, 0x0000ccff, 0x0007faff, 0x0007fbff, 0x0007fdff, 0x0007feff, 0x000800ff, 0x0000cdff,
+	0x000803ff, 0x000804ff, 0x000806ff, 0x000807ff, 0x000809ff, 0x00080aff, 0x0000ceff, 0x00080dff,
+	0x00080fff, 0x000811ff, 0x000812ff, 0x000814ff, 0x000815ff, 0x0000cfff, 0x000818ff, 0x00081aff,
+	0x00081bff, 0x00081dff, 0x00081eff, 0x0000d0ff, 0x000821ff, 0x000823ff, 0x000824ff, 0x000826ff,
+	0x000827ff, 0x000829ff, 0x0000d1ff, 0x00082cff, 0x00082eff, 0x00082fff, 0x000831ff, 0x000832ff,
+	0x000015ff, 0x000835ff, 0x000837ff, 0x000838ff, 0x00083aff, 0x00083bff, 0x00083dff, 0x0000d3ff,
+	0x000840ff, 0x000841ff, 0x000843ff, 0x000844ff, 0x000846ff, 0x0000d4ff, 0x000849ff, 0x00084aff,
+	0x00084cff, 0x00084eff, 0x00084fff, 0x000851ff, 0x0000d5ff, 0x000854ff, 0x000855ff, 0x000857ff,
+	0x000858ff, 0x00085aff, 0x0000d6ff, 0x00085dff, 0x00085eff, 0x000860ff, 0x000861ff, 0x000863ff,
+	0x000864ff, 0x0000d7ff, 0x000867ff, 0x000869ff, 0x00086bff, 0x00086cff, 0x00086eff, 0x00086fff,
+	0x0000d8ff, 0x000872ff, 0x000874ff, 0x000875ff, 0x000877ff, 0x000878ff, 0x0000d9ff, 0x00087bff,
+	0x00087dff, 0x00087eff, 0x000880ff, 0x000881ff, 0x000883ff, 0x0000daff, 0x000886ff, 0x000888ff,
+	0x000889ff, 0x00088bff, 0x00088cff, 0x0000dbff, 0x00088fff, 0x000891ff, 0x000892ff, 0x000894ff,
+	0x000895ff, 0x000897ff, 0x000016ff, 0x00089aff, 0x00089bff, 0x00089dff, 0x00089eff, 0x0008a0ff,
+	0x0000ddff, 0x0008a3ff, 0x0008a5ff, 0x0008a6ff, 0x0008a8ff, 0x0008a9ff, 0x0008abff, 0x0000deff,
+	0x0008aeff, 0x0008afff, 0x0008b1ff, 0x0008b2ff, 0x0008b4ff, 0x0000dfff, 0x0008b7ff, 0x0008b8ff,
+	0x0008baff, 0x0008bbff, 0x0008bdff, 0x0008beff, 0x0000e0ff, 0x0008c2ff, 0x0008c3ff, 0x0008c5ff,
+	0x0008c6ff, 0x0008c8ff, 0x0008c9ff, 0x0000e1ff, 0x0008ccff, 0x0008ceff, 0x0008cfff, 0x0008d1ff,
+	0x0008d2ff, 0x0000e2ff, 0x0008d5ff, 0x0008d7ff, 0x0008d8ff, 0x0008daff, 0x0008dbff, 0x0008ddff,
+	0x0000e3ff, 0x0008e0ff, 0x0008e2ff, 0x0008e3ff, 0x0008e5ff, 0x0008e6ff, 0x0000e4ff, 0x0008e9ff,
+	0x0008ebff, 0x0008ecff, 0x0008eeff, 0x0008efff, 0x0008f1ff, 0x0000e5ff, 0x0008f4ff, 0x0008f5ff,
+	0x0008f7ff, 0x0008f8ff, 0x0008faff, 0x000017ff, 0x0008fdff, 0x0008ffff, 0x000900ff, 0x000902ff,
+	0x000903ff, 0x000905ff, 0x0000e7ff, 0x000908ff, 0x000909ff, 0x00090bff, 0x00090cff, 0x00090eff,
+	0x0000e8ff, 0x000911ff, 0x000912ff, 0x000914ff, 0x000915ff, 0x000917ff, 0x000918ff, 0x0000e9ff,
+	0x00091cff, 0x00091dff, 0x00091fff, 0x000920ff, 0x000922ff, 0x000923ff, 0x0000eaff, 0x000926ff,
+	0x000928ff, 0x000929ff, 0x00092bff, 0x00092cff, 0x0000ebff, 0x00092fff, 0x000931ff, 0x000932ff,
+	0x000934ff, 0x000935ff, 0x000937ff, 0x0000ecff, 0x00093aff, 0x00093cff, 0x00093dff, 0x00093fff,
+	0x000940ff, 0x0000edff, 0x000943ff, 0x000945ff, 0x000946ff, 0x000948ff, 0x000949ff, 0x00094bff,
+	0x0000eeff, 0x00094eff, 0x00094fff, 0x000951ff, 0x000952ff, 0x000954ff, 0x0000efff, 0x000957ff,
+	0x000959ff, 0x00095aff, 0x00095cff, 0x00095dff, 0x00095fff, 0x000018ff, 0x000962ff, 0x000963ff,
+	0x000965ff, 0x000966ff, 0x000968ff, 0x0000f1ff, 0x00096bff, 0x00096cff, 0x00096eff, 0x00096fff,
+	0x000971ff, 0x000973ff, 0x0000f2ff, 0x000976ff, 0x000977ff, 0x000979ff, 0x00097aff, 0x00097cff,
+	0x00097dff, 0x0000f3ff, 0x000980ff, 0x000982ff, 0x000983ff, 0x000985ff, 0x000986ff, 0x0000f4ff,
+	0x000989ff, 0x00098bff, 0x00098cff, 0x00098eff, 0x000990ff, 0x000991ff, 0x0000f5ff, 0x000994ff,
+	0x000996ff, 0x000997ff, 0x000999ff, 0x00099aff, 0x0000f6ff, 0x00099dff, 0x00099fff, 0x0009a0ff,
+	0x0009a2ff, 0x0009a3ff, 0x0009a5ff, 0x0000f7ff, 0x0009a8ff, 0x0009a9ff, 0x0009abff, 0x0009adff,
+	0x0009aeff, 0x0000f8ff, 0x0009b1ff, 0x0009b3ff, 0x0009b4ff, 0x0009b6ff, 0x0009b7ff, 0x0009b9ff,
+	0x0000f9ff, 0x0009bcff, 0x0009bdff, 0x0009bfff, 0x0009c0ff, 0x0009c2ff, 0x000019ff, 0x0009c5ff,
+	0x0009c6ff, 0x0009c8ff, 0x0009c9ff, 0x0009cbff, 0x0009cdff, 0x0000fbff, 0x0009d0ff, 0x0009d1ff,
+	0x0009d3ff, 0x0009d4ff, 0x0009d6ff, 0x0009d7ff, 0x0000fcff, 0x0009daff, 0x0009dcff, 0x0009ddff,
+	0x0009dfff, 0x0009e0ff, 0x0000fdff, 0x0009e3ff, 0x0009e5ff, 0x0009e6ff, 0x0009e8ff, 0x0009eaff,
+	0x0009ebff, 0x0000feff, 0x0009eeff, 0x0009f0ff, 0x0009f1ff, 0x0009f3ff, 0x0009f4ff, 0x0000ffff,
+	0x0009f7ff, 0x0009f9ff, 0x0009faff, 0x0009fcff, 0x0009fdff, 0x0009ffff, 0x000100ff, 0x000a02ff,
+	0x000a03ff, 0x000a05ff, 0x000a07ff, 0x000a08ff, 0x000101ff, 0x000a0bff, 0x000a0dff, 0x000a0eff,
+	0x000a10ff, 0x000a11ff, 0x000a13ff, 0x000102ff, 0x000a16ff, 0x000a17ff, 0x000a19ff, 0x000a1aff,
+	0x000a1cff, 0x000103ff, 0x000a1fff, 0x000a20ff, 0x000a22ff, 0x000a24ff, 0x000a25ff, 0x000a27ff,
+	0x00001aff, 0x000a2aff, 0x000a2bff, 0x000a2dff, 0x000a2eff, 0x000a30ff, 0x000105ff, 0x000a33ff,
+	0x000a34ff, 0x000a36ff, 0x000a37ff, 0x000a39ff, 0x000a3aff, 0x000106ff, 0x000a3dff, 0x000a3fff,
+	0x000a41ff, 0x000a42ff, 0x000a44ff, 0x000a45ff, 0x000107ff, 0x000a48ff, 0x000a4aff, 0x000a4bff,
+	0x000a4dff, 0x000a4eff, 0x000108ff, 0x000a51ff, 0x000a53ff, 0x000a54ff, 0x000a56ff, 0x000a57ff,
+	0x000a59ff, 0x000109ff, 0x000a5cff, 0x000a5eff, 0x000a5fff, 0x000a61ff, 0x000a62ff, 0x00010aff,
+	0x000a65ff, 0x000a67ff, 0x000a68ff, 0x000a6aff, 0x000a6bff, 0x000a6dff, 0x00010bff, 0x000a70ff,
+	0x000a71ff, 0x000a73ff, 0x000a74ff, 0x000a76ff, 0x00010cff, 0x000a79ff, 0x000a7aff, 0x000a7cff,
+	0x000a7eff, 0x000a7fff, 0x000a81ff, 0x00010dff, 0x000a84ff, 0x000a85ff, 0x000a87ff, 0x000a88ff,
+	0x000a8aff, 0x00001bff, 0x000a8dff, 0x000a8eff, 0x000a90ff, 0x000a91ff, 0x000a93ff, 0x000a94ff,
+	0x00010fff, 0x000a97ff, 0x000a99ff, 0x000a9bff, 0x000a9cff, 0x000a9eff, 0x000a9fff, 0x000110ff,
+	0x000aa2ff, 0x000aa4ff, 0x000aa5ff, 0x000aa7ff, 0x000aa8ff, 0x000111ff, 0x000aabff, 0x000aadff,
+	0x000aaeff, 0x000ab0ff, 0x000ab1ff, 0x000ab3ff, 0x000112ff, 0x000ab6ff, 0x000ab8ff, 0x000ab9ff,
+	0x000abbff, 0x000abcff, 0x000113ff, 0x000abfff, 0x000ac1ff, 0x000ac2ff, 0x000ac4ff, 0x000ac5ff,
+	0x000ac7ff, 0x000114ff, 0x000acaff, 0x000acbff, 0x000acdff, 0x000aceff, 0x000ad0ff, 0x000115ff,
+	0x000ad3ff, 0x000ad5ff, 0x000ad6ff, 0x000ad8ff, 0x000ad9ff, 0x000adbff, 0x000116ff, 0x000adeff,
+	0x000adfff, 0x000ae1ff, 0x000ae2ff, 0x000ae4ff, 0x000117ff, 0x000ae7ff, 0x000ae8ff, 0x000aeaff,
+	0x000aebff, 0x000aedff, 0x000aeeff, 0x00001cff, 0x000af2ff, 0x000af3ff, 0x000af5ff, 0x000af6ff,
+	0x000af8ff, 0x000af9ff, 0x000119ff, 0x000afcff, 0x000afeff, 0x000affff, 0x000b01ff, 0x000b02ff,
+	0x00011aff, 0x000b05ff, 0x000b07ff, 0x000b08ff, 0x000b0aff, 0x000b0bff, 0x000b0dff, 0x00011bff,
+	0x000b10ff, 0x000b12ff, 0x000b13ff, 0x000b15ff, 0x000b16ff, 0x00011cff, 0x000b19ff, 0x000b1bff,
+	0x000b1cff, 0x000b1eff, 0x000b1fff, 0x000b21ff, 0x00011dff, 0x000b24ff, 0x000b25ff, 0x000b27ff,
+	0x000b28ff, 0x000b2aff, 0x00011eff, 0x000b2dff, 0x000b2fff, 0x000b30ff, 0x000b32ff, 0x000b33ff,
+	0x000b35ff, 0x00011fff, 0x000b38ff, 0x000b39ff, 0x000b3bff, 0x000b3cff, 0x000b3eff, 0x000120ff,
+	0x000b41ff, 0x000b42ff, 0x000b44ff, 0x000b45ff, 0x000b47ff, 0x000b48ff, 0x000121ff, 0x000b4cff,
+	0x000b4dff, 0x000b4fff, 0x000b50ff, 0x000b52ff, 0x000b53ff, 0x00001dff, 0x000b56ff, 0x000b58ff,
+	0x000b59ff, 0x000b5bff, 0x000b5cff, 0x000123ff, 0x000b5fff, 0x000b61ff, 0x000b62ff, 0x000b64ff,
+	0x000b65ff, 0x000b67ff, 0x000124ff, 0x000b6aff, 0x000b6cff, 0x000b6dff, 0x000b6fff, 0x000b70ff,
+	0x000125ff, 0x000b73ff, 0x000b75ff, 0x000b76ff, 0x000b78ff, 0x000b79ff, 0x000b7bff, 0x000126ff,
+	0x000b7eff, 0x000b7fff, 0x000b81ff, 0x000b82ff, 0x000b84ff, 0x000127ff, 0x000b87ff, 0x000b89ff,
+	0x000b8aff, 0x000b8cff, 0x000b8dff, 0x000b8fff, 0x000128ff, 0x000b92ff, 0x000b93ff, 0x000b95ff,
+	0x000b96ff, 0x000b98ff, 0x000129ff, 0x000b9bff, 0x000b9cff, 0x000b9eff, 0x000b9fff, 0x000ba1ff,
+	0x000ba3ff, 0x00012aff, 0x000ba6ff, 0x000ba7ff, 0x000ba9ff, 0x000baaff, 0x000bacff, 0x000badff,
+	0x00012bff, 0x000bb0ff, 0x000bb2ff, 0x000bb3ff, 0x000bb5ff, 0x000bb6ff, 0x000003ff, 0x000bb9ff,
+	0x000bbbff, 0x000bbcff, 0x000bbeff, 0x000bc0ff, 0x000bc1ff, 0x00012dff, 0x000bc4ff, 0x000bc6ff,
+	0x000bc7ff, 0x000bc9ff, 0x000bcaff, 0x00012eff, 0x000bcdff, 0x000bcfff, 0x000bd0ff, 0x000bd2ff,
+	0x000bd3ff, 0x000bd5ff, 0x00012fff, 0x000bd8ff, 0x000bd9ff, 0x000bdbff, 0x000bdcff, 0x000bdeff,
+	0x000130ff, 0x000be1ff, 0x000be3ff, 0x000be4ff, 0x000be6ff, 0x000be7ff, 0x000be9ff, 0x000131ff,
+	0x000becff, 0x000bedff, 0x000befff, 0x000bf0ff, 0x000bf2ff, 0x000132ff, 0x000bf5ff, 0x000bf6ff,
+	0x000bf8ff, 0x000bf9ff, 0x000bfbff, 0x000bfdff, 0x000133ff, 0x000c00ff, 0x000c01ff, 0x000c03ff,
+	0x000c04ff, 0x000c06ff, 0x000c07ff, 0x000134ff, 0x000c0aff, 0x000c0cff, 0x000c0dff, 0x000c0fff,
+	0x000c10ff, 0x000135ff, 0x000c13ff, 0x000c15ff, 0x000c16ff, 0x000c18ff, 0x000c1aff, 0x000c1bff,
+	0x00001fff, 0x000c1eff, 0x000c20ff, 0x000c21ff, 0x000c23ff, 0x000c24ff, 0x000137ff, 0x000c27ff,
+	0x000c29ff, 0x000c2aff, 0x000c2cff, 0x000c2dff, 0x000c2fff, 0x000138ff, 0x000c32ff, 0x000c33ff,
+	0x000c35ff, 0x000c38ff, 0x000139ff, 0x000c3eff, 0x000c41ff, 0x00013aff, 0x000c47ff, 0x000c4aff,
+	0x00013bff, 0x000c50ff, 0x000c54ff, 0x00013cff, 0x000c5aff, 0x000c5dff, 0x000c60ff, 0x00013dff,
+	0x000c66ff, 0x000c69ff, 0x00013eff, 0x000c6fff, 0x000c72ff, 0x00013fff, 0x000c78ff, 0x000c7bff,
+	0x000c7eff, 0x000020ff, 0x000c84ff, 0x000c87ff, 0x000141ff, 0x000c8eff, 0x000c91ff, 0x000142ff,
+	0x000c97ff, 0x000c9aff, 0x000143ff, 0x000ca0ff, 0x000ca3ff, 0x000ca6ff, 0x000144ff, 0x000cacff,
+	0x000cafff, 0x000145ff, 0x000cb5ff, 0x000cb8ff, 0x000146ff, 0x000cbeff, 0x000cc1ff, 0x000cc4ff,
+	0x000147ff, 0x000ccbff, 0x000cceff, 0x000148ff, 0x000cd4ff, 0x000cd7ff, 0x000149ff, 0x000cddff,
+	0x000ce0ff, 0x000021ff, 0x000ce6ff, 0x000ce9ff, 0x000cecff, 0x00014bff, 0x000cf2ff, 0x000cf5ff,
+	0x00014cff, 0x000cfbff, 0x000cfeff, 0x00014dff, 0x000d05ff, 0x000d08ff, 0x00014eff, 0x000d0eff,
+	0x000d11ff, 0x000d14ff, 0x00014fff, 0x000d1aff, 0x000d1dff, 0x000150ff, 0x000d23ff, 0x000d26ff,
+	0x000151ff, 0x000d2cff, 0x000d2fff, 0x000d32ff, 0x000152ff, 0x000d38ff, 0x000d3bff, 0x000153ff,
+	0x000d42ff, 0x000d45ff, 0x000022ff, 0x000d4bff, 0x000d4eff, 0x000155ff, 0x000d54ff, 0x000d57ff,
+	0x000d5aff, 0x000156ff, 0x000d60ff, 0x000d63ff, 0x000157ff, 0x000d69ff, 0x000d6cff, 0x000158ff,
+	0x000d72ff, 0x000d75ff, 0x000159ff, 0x000d7cff, 0x000d7fff, 0x000d82ff, 0x00015aff, 0x000d88ff,
+	0x000d8bff, 0x00015bff, 0x000d91ff, 0x000d94ff, 0x00015cff, 0x000d9aff, 0x000d9dff, 0x000da0ff,
+	0x00015dff, 0x000da6ff, 0x000da9ff, 0x000023ff, 0x000dafff, 0x000db2ff, 0x00015fff, 0x000db9ff,
+	0x000dbcff, 0x000160ff, 0x000dc2ff, 0x000dc5ff, 0x000dc8ff, 0x000161ff, 0x000dceff, 0x000dd1ff,
+	0x000162ff, 0x000dd7ff, 0x000ddaff, 0x000163ff, 0x000de0ff, 0x000de3ff, 0x000de6ff, 0x000164ff,
+	0x000decff, 0x000df0ff, 0x000165ff, 0x000df6ff, 0x000df9ff, 0x000166ff, 0x000dffff, 0x000e02ff,
+	0x000167ff, 0x000e08ff, 0x000e0bff, 0x000e0eff, 0x000024ff, 0x000e14ff, 0x000e17ff, 0x000169ff,
+	0x000e1dff, 0x000e20ff, 0x00016aff, 0x000e26ff, 0x000e29ff, 0x00016bff, 0x000e30ff, 0x000e33ff,
+	0x000e36ff, 0x00016cff, 0x000e3cff, 0x000e3fff, 0x00016dff, 0x000e45ff, 0x000e48ff, 0x00016eff,
+	0x000e4eff, 0x000e51ff, 0x000e54ff, 0x00016fff, 0x000e5aff, 0x000e5dff, 0x000170ff, 0x000e63ff,
+	0x000e67ff, 0x000171ff, 0x000e6dff, 0x000e70ff, 0x000025ff, 0x000e76ff, 0x000e79ff, 0x000e7cff,
+	0x000173ff, 0x000e82ff, 0x000e85ff, 0x000174ff, 0x000e8bff, 0x000e8eff, 0x000175ff, 0x000e94ff,
+	0x000e97ff, 0x000e9aff, 0x000176ff, 0x000ea1ff, 0x000ea4ff, 0x000177ff, 0x000eaaff, 0x000eadff,
+	0x000178ff, 0x000eb3ff, 0x000eb6ff, 0x000179ff, 0x000ebcff, 0x000ebfff, 0x000ec2ff, 0x00017aff,
+	0x000ec8ff, 0x000ecbff, 0x00017bff, 0x000ed1ff, 0x000ed4ff, 0x000026ff, 0x000edaff, 0x000edeff,
+	0x00017dff, 0x000ee4ff, 0x000ee7ff, 0x000eeaff, 0x00017eff, 0x000ef0ff, 0x000ef3ff, 0x00017fff,
+	0x000ef9ff, 0x000efcff, 0x000180ff, 0x000f02ff, 0x000f05ff, 0x000f08ff, 0x000181ff, 0x000f0eff,
+	0x000f11ff, 0x000182ff, 0x000f18ff, 0x000f1bff, 0x000183ff, 0x000f21ff, 0x000f24ff, 0x000184ff,
+	0x000f2aff, 0x000f2dff, 0x000f30ff, 0x000185ff, 0x000f36ff, 0x000f39ff, 0x000027ff, 0x000f3fff,
+	0x000f42ff, 0x000187ff, 0x000f48ff, 0x000f4bff, 0x000f4eff, 0x000188ff, 0x000f55ff, 0x000f58ff,
+	0x000189ff, 0x000f5eff, 0x000f61ff, 0x00018aff, 0x000f67ff, 0x000f6aff, 0x00018bff, 0x000f70ff,
+	0x000f73ff, 0x000f76ff, 0x00018cff, 0x000f7cff, 0x000f7fff, 0x00018dff, 0x000f85ff, 0x000f88ff,
+	0x00018eff, 0x000f8fff, 0x000f92ff, 0x00018fff, 0x000f98ff, 0x000f9bff, 0x000f9eff, 0x000004ff,
+	0x000fa4ff, 0x000fa7ff, 0x000191ff, 0x000fadff, 0x000fb0ff, 0x000192ff, 0x000fb6ff, 0x000fb9ff,
+	0x000fbcff, 0x000193ff, 0x000fc2ff, 0x000fc5ff, 0x000194ff, 0x000fccff, 0x000fcfff, 0x000195ff,
+	0x000fd5ff, 0x000fd8ff, 0x000196ff, 0x000fdeff, 0x000fe1ff, 0x000fe4ff, 0x000197ff, 0x000feaff,
+	0x000fedff, 0x000198ff, 0x000ff3ff, 0x000ff6ff, 0x000199ff, 0x000ffcff, 0x000fffff, 0x000029ff,
+	0x001006ff, 0x001009ff, 0x00100cff, 0x00019bff, 0x001012ff, 0x001015ff, 0x00019cff, 0x00101bff,
+	0x00101eff, 0x00019dff, 0x001024ff, 0x001027ff, 0x00102aff, 0x00019eff, 0x001030ff, 0x001033ff,
+	0x00019fff, 0x001039ff, 0x00103cff, 0x0001a0ff, 0x001043ff, 0x001046ff, 0x0001a1ff, 0x00104cff,
+	0x00104fff, 0x001052ff, 0x0001a2ff, 0x001058ff, 0x00105bff, 0x0001a3ff, 0x001061ff, 0x001064ff,
+	0x00002aff, 0x00106aff, 0x00106dff, 0x001070ff, 0x0001a5ff, 0x001076ff, 0x00107aff, 0x0001a6ff,
+	0x001080ff, 0x001083ff, 0x0001a7ff, 0x001089ff, 0x00108cff, 0x0001a8ff, 0x001092ff, 0x001095ff,
+	0x001098ff, 0x0001a9ff, 0x00109eff, 0x0010a1ff, 0x0001aaff, 0x0010a7ff, 0x0010aaff, 0x0001abff,
+	0x0010b0ff, 0x0010b4ff, 0x0001acff, 0x0010baff, 0x0010bdff, 0x0010c0ff, 0x0001adff, 0x0010c6ff,
+	0x0010c9ff, 0x00002bff, 0x0010cfff, 0x0010d2ff, 0x0001afff, 0x0010d8ff, 0x0010dbff, 0x0010deff,
+	0x0001b0ff, 0x0010e4ff, 0x0010e7ff, 0x0001b1ff, 0x0010edff, 0x0010f1ff, 0x0001b2ff, 0x0010f7ff,
+	0x0010faff, 0x0001b3ff, 0x001100ff, 0x001103ff, 0x001106ff, 0x0001b4ff, 0x00110cff, 0x00110fff,
+	0x0001b5ff, 0x001115ff, 0x001118ff, 0x0001b6ff, 0x00111eff, 0x001121ff, 0x001124ff, 0x0001b7ff,
+	0x00112bff, 0x00112eff, 0x00002cff, 0x001134ff, 0x001137ff, 0x0001b9ff, 0x00113dff, 0x001140ff,
+	0x0001baff, 0x001146ff, 0x001149ff, 0x00114cff, 0x0001bbff, 0x001152ff, 0x001155ff, 0x0001bcff,
+	0x00115bff, 0x00115eff, 0x0001bdff, 0x001165ff, 0x001168ff, 0x0001beff, 0x00116eff, 0x001171ff,
+	0x001174ff, 0x0001bfff, 0x00117aff, 0x00117dff, 0x0001c0ff, 0x001183ff, 0x001186ff, 0x0001c1ff,
+	0x00118cff, 0x00118fff, 0x001192ff, 0x00002dff, 0x001198ff, 0x00119bff, 0x0001c3ff, 0x0011a2ff,
+	0x0011a5ff, 0x0001c4ff, 0x0011abff, 0x0011aeff, 0x0001c5ff, 0x0011b4ff, 0x0011b7ff, 0x0011baff,
+	0x0001c6ff, 0x0011c0ff, 0x0011c3ff, 0x0001c7ff, 0x0011c9ff, 0x0011ccff, 0x0001c8ff, 0x0011d2ff,
+	0x0011d5ff, 0x0001c9ff, 0x0011dcff, 0x0011dfff, 0x0011e2ff, 0x0001caff, 0x0011e8ff, 0x0011ebff,
+	0x0001cbff, 0x0011f1ff, 0x0011f4ff, 0x00002eff, 0x0011faff, 0x0011fdff, 0x001200ff, 0x0001cdff,
+	0x001206ff, 0x001209ff, 0x0001ceff, 0x00120fff, 0x001212ff, 0x0001cfff, 0x001219ff, 0x00121cff,
+	0x0001d0ff, 0x001222ff, 0x001225ff, 0x001228ff, 0x0001d1ff, 0x00122eff, 0x001231ff, 0x0001d2ff,
+	0x001237ff, 0x00123aff, 0x0001d3ff, 0x001240ff, 0x001243ff, 0x001246ff, 0x0001d4ff, 0x00124cff,
+	0x001250ff, 0x0001d5ff, 0x001256ff, 0x001259ff, 0x00002fff, 0x00125fff, 0x001262ff, 0x0001d7ff,
+	0x001268ff, 0x00126bff, 0x00126eff, 0x0001d8ff, 0x001274ff, 0x001277ff, 0x0001d9ff, 0x00127dff,
+	0x001280ff, 0x0001daff, 0x001286ff, 0x001289ff, 0x0001dbff, 0x001290ff, 0x001293ff, 0x001296ff,
+	0x0001dcff, 0x00129cff, 0x00129fff, 0x0001ddff, 0x0012a5ff, 0x0012a8ff, 0x0001deff, 0x0012aeff,
+	0x0012b1ff, 0x0012b4ff, 0x0001dfff, 0x0012baff, 0x0012bdff, 0x000030ff, 0x0012c3ff, 0x0012c7ff,
+	0x0001e1ff, 0x0012cdff, 0x0012d0ff, 0x0001e2ff, 0x0012d6ff, 0x0012d9ff, 0x0012dcff, 0x0001e3ff,
+	0x0012e2ff, 0x0012e5ff, 0x0001e4ff, 0x0012ebff, 0x0012eeff, 0x0001e5ff, 0x0012f4ff, 0x0012f7ff,
+	0x0012faff, 0x0001e6ff, 0x001301ff, 0x001304ff, 0x0001e7ff, 0x00130aff, 0x00130dff, 0x0001e8ff,
+	0x001313ff, 0x001316ff, 0x0001e9ff, 0x00131cff, 0x00131fff, 0x001322ff, 0x000031ff, 0x001328ff,
+	0x00132bff, 0x0001ebff, 0x001331ff, 0x001334ff, 0x0001ecff, 0x00133aff, 0x00133eff, 0x0001edff,
+	0x001344ff, 0x001347ff, 0x00134aff, 0x0001eeff, 0x001350ff, 0x001353ff, 0x0001efff, 0x001359ff,
+	0x00135cff, 0x0001f0ff, 0x001362ff, 0x001365ff, 0x001368ff, 0x0001f1ff, 0x00136eff, 0x001371ff,
+	0x0001f2ff, 0x001378ff, 0x00137bff, 0x0001f3ff, 0x001381ff, 0x001384ff, 0x000005ff, 0x00138aff,
+	0x00138dff, 0x001390ff, 0x0001f5ff, 0x001396ff, 0x001399ff, 0x0001f6ff, 0x00139fff, 0x0013a2ff,
+	0x0001f7ff, 0x0013a8ff, 0x0013abff, 0x0013aeff, 0x0001f8ff, 0x0013b5ff, 0x0013b8ff, 0x0001f9ff,
+	0x0013beff, 0x0013c1ff, 0x0001faff, 0x0013c7ff, 0x0013caff, 0x0001fbff, 0x0013d0ff, 0x0013d3ff,
+	0x0013d6ff, 0x0001fcff, 0x0013dcff, 0x0013dfff, 0x0001fdff, 0x0013e5ff, 0x0013e8ff, 0x000033ff,
+	0x0013efff, 0x0013f2ff, 0x0001ffff, 0x0013f8ff, 0x0013fbff, 0x0013feff, 0x000200ff, 0x001404ff,
+	0x001407ff, 0x000201ff, 0x00140dff, 0x001410ff, 0x000202ff, 0x001416ff, 0x001419ff, 0x00141cff,
+	0x000203ff, 0x001422ff, 0x001425ff, 0x000204ff, 0x00142cff, 0x00142fff, 0x000205ff, 0x001435ff,
+	0x001438ff, 0x000206ff, 0x00143eff, 0x001441ff, 0x001444ff, 0x000207ff, 0x00144aff, 0x00144dff,
+	0x000034ff, 0x001453ff, 0x001456ff, 0x000209ff, 0x00145cff, 0x00145fff, 0x00020aff, 0x001466ff,
+	0x001469ff, 0x00146cff, 0x00020bff, 0x001472ff, 0x001475ff, 0x00020cff, 0x00147bff, 0x00147eff,
+	0x00020dff, 0x001484ff, 0x001487ff, 0x00148aff, 0x00020eff, 0x001490ff, 0x001493ff, 0x00020fff,
+	0x001499ff, 0x00149cff, 0x000210ff, 0x0014a3ff, 0x0014a6ff, 0x000211ff, 0x0014acff, 0x0014afff,
+	0x0014b2ff, 0x000035ff, 0x0014b8ff, 0x0014bbff, 0x000213ff, 0x0014c1ff, 0x0014c4ff, 0x000214ff,
+	0x0014caff, 0x0014cdff, 0x0014d0ff, 0x000215ff, 0x0014d6ff, 0x0014daff, 0x000216ff, 0x0014e0ff,
+	0x0014e3ff, 0x000217ff, 0x0014e9ff, 0x0014ecff, 0x000218ff, 0x0014f2ff, 0x0014f5ff, 0x0014f8ff,
+	0x000219ff, 0x0014feff, 0x001501ff, 0x00021aff, 0x001507ff, 0x00150aff, 0x00021bff, 0x001510ff,
+	0x001514ff, 0x000036ff, 0x00151aff, 0x00151dff, 0x001520ff, 0x00021dff, 0x001526ff, 0x001529ff,
+	0x00021eff, 0x00152fff, 0x001532ff, 0x00021fff, 0x001538ff, 0x00153bff, 0x00153eff, 0x000220ff,
+	0x001544ff, 0x001547ff, 0x000221ff, 0x00154dff, 0x001551ff, 0x000222ff, 0x001557ff, 0x00155aff,
+	0x000223ff, 0x001560ff, 0x001563ff, 0x001566ff, 0x000224ff, 0x00156cff, 0x00156fff, 0x000225ff,
+	0x001575ff, 0x001578ff, 0x000037ff, 0x00157eff, 0x001581ff, 0x001584ff, 0x000227ff, 0x00158bff,
+	0x00158eff, 0x000228ff, 0x001594ff, 0x001597ff, 0x000229ff, 0x00159dff, 0x0015a0ff, 0x00022aff,
+	0x0015a6ff, 0x0015a9ff, 0x0015acff, 0x00022bff, 0x0015b2ff, 0x0015b5ff, 0x00022cff, 0x0015bbff,
+	0x0015beff, 0x00022dff, 0x0015c5ff, 0x0015c8ff, 0x00022eff, 0x0015ceff, 0x0015d1ff, 0x0015d4ff,
+	0x00022fff, 0x0015daff, 0x0015ddff, 0x000038ff, 0x0015e3ff, 0x0015e6ff, 0x000231ff, 0x0015ecff,
+	0x0015efff, 0x0015f2ff, 0x000232ff, 0x0015f8ff, 0x0015fbff, 0x000233ff, 0x001602ff, 0x001605ff,
+	0x000234ff, 0x00160bff, 0x00160eff, 0x000235ff, 0x001614ff, 0x001617ff, 0x00161aff, 0x000236ff,
+	0x001620ff, 0x001623ff, 0x000237ff, 0x001629ff, 0x00162cff, 0x000238ff, 0x001632ff, 0x001635ff,
+	0x000239ff, 0x00163cff, 0x00163fff, 0x001642ff, 0x000039ff, 0x001648ff, 0x00164bff, 0x00023bff,
+	0x001651ff, 0x001654ff, 0x00023cff, 0x00165aff, 0x00165dff, 0x001660ff, 0x00023dff, 0x001666ff,
+	0x001669ff, 0x00023eff, 0x00166fff, 0x001672ff, 0x00023fff, 0x001679ff, 0x00167cff, 0x000240ff,
+	0x001682ff, 0x001685ff, 0x001688ff, 0x000241ff, 0x00168eff, 0x001691ff, 0x000242ff, 0x001697ff,
+	0x00169aff, 0x000243ff, 0x0016a0ff, 0x0016a3ff, 0x0016a6ff, 0x00003aff, 0x0016acff, 0x0016afff,
+	0x000245ff, 0x0016b6ff, 0x0016b9ff, 0x000246ff, 0x0016bfff, 0x0016c2ff, 0x000247ff, 0x0016c8ff,
+	0x0016cbff, 0x0016ceff, 0x000248ff, 0x0016d4ff, 0x0016d7ff, 0x000249ff, 0x0016ddff, 0x0016e0ff,
+	0x00024aff, 0x0016e6ff, 0x0016e9ff, 0x00024bff, 0x0016f0ff, 0x0016f3ff, 0x0016f6ff, 0x00024cff,
+	0x0016fcff, 0x0016ffff, 0x00024dff, 0x001705ff, 0x001708ff, 0x00003bff, 0x00170eff, 0x001711ff,
+	0x001714ff, 0x00024fff, 0x00171aff, 0x00171dff, 0x000250ff, 0x001723ff, 0x001727ff, 0x000251ff,
+	0x00172dff, 0x001730ff, 0x000252ff, 0x001736ff, 0x001739ff, 0x00173cff, 0x000253ff, 0x001742ff,
+	0x001745ff, 0x000254ff, 0x00174bff, 0x00174eff, 0x000255ff, 0x001754ff, 0x001757ff, 0x00175aff,
+	0x000256ff, 0x001760ff, 0x001764ff, 0x000257ff, 0x00176aff, 0x00176dff, 0x000006ff, 0x001773ff,
+	0x001776ff, 0x000259ff, 0x00177cff, 0x00177fff, 0x001782ff, 0x00025aff, 0x001788ff, 0x00178bff,
+	0x00025bff, 0x001791ff, 0x001794ff, 0x00025cff, 0x00179aff, 0x00179eff, 0x00025dff, 0x0017a4ff,
+	0x0017a7ff, 0x0017aaff, 0x00025eff, 0x0017b0ff, 0x0017b3ff, 0x00025fff, 0x0017b9ff, 0x0017bcff,
+	0x000260ff, 0x0017c2ff, 0x0017c5ff, 0x0017c8ff, 0x000261ff, 0x0017ceff, 0x0017d1ff, 0x00003dff,
+	0x0017d8ff, 0x0017dbff, 0x000263ff, 0x0017e1ff, 0x0017e4ff, 0x000264ff, 0x0017eaff, 0x0017edff,
+	0x0017f0ff, 0x000265ff, 0x0017f6ff, 0x0017f9ff, 0x000266ff, 0x0017ffff, 0x001802ff, 0x000267ff,
+	0x001808ff, 0x00180bff, 0x00180eff, 0x000268ff, 0x001815ff, 0x001818ff, 0x000269ff, 0x00181eff,
+	0x001821ff, 0x00026aff, 0x001827ff, 0x00182aff, 0x00026bff, 0x001830ff, 0x001833ff, 0x001836ff,
+	0x00003eff, 0x00183cff, 0x00183fff, 0x00026dff, 0x001845ff, 0x001848ff, 0x00026eff, 0x00184fff,
+	0x001852ff, 0x00026fff, 0x001858ff, 0x00185bff, 0x00185eff, 0x000270ff, 0x001864ff, 0x001867ff,
+	0x000271ff, 0x001870ff, 0x000272ff, 0x000273ff, 0x001882ff, 0x000274ff, 0x00188fff, 0x000275ff,
+	0x00003fff, 0x0018a1ff, 0x000277ff, 0x000278ff, 0x0018b3ff, 0x000279ff, 0x0018bfff, 0x00027aff,
+	0x00027bff, 0x0018d2ff, 0x00027cff, 0x0018deff, 0x00027dff, 0x00027eff, 0x0018f0ff, 0x00027fff,
+	0x0018fcff, 0x000040ff, 0x000281ff, 0x00190fff, 0x000282ff, 0x000283ff, 0x001921ff, 0x000284ff,
+	0x00192dff, 0x000285ff, 0x000286ff, 0x001940ff, 0x000287ff, 0x00194cff, 0x000288ff, 0x000289ff,
+	0x00195eff, 0x000041ff, 0x00196aff, 0x00028bff, 0x00028cff, 0x00197dff, 0x00028dff, 0x001989ff,
+	0x00028eff, 0x00028fff, 0x00199bff, 0x000290ff, 0x000291ff, 0x0019adff, 0x000292ff, 0x0019baff,
+	0x000293ff, 0x000042ff, 0x0019ccff, 0x000295ff, 0x0019d8ff, 0x000296ff, 0x000297ff, 0x0019ebff,
+	0x000298ff, 0x0019f7ff, 0x000299ff, 0x00029aff, 0x001a09ff, 0x00029bff, 0x00029cff, 0x001a1bff,
+	0x00029dff, 0x001a28ff, 0x000043ff, 0x00029fff, 0x001a3aff, 0x0002a0ff, 0x001a46ff, 0x0002a1ff,
+	0x0002a2ff, 0x001a58ff, 0x0002a3ff, 0x001a65ff, 0x0002a4ff, 0x0002a5ff, 0x001a77ff, 0x0002a6ff,
+	0x0002a7ff, 0x001a89ff, 0x000044ff, 0x001a95ff, 0x0002a9ff, 0x0002aaff, 0x001aa8ff, 0x0002abff,
+	0x001ab4ff, 0x0002acff, 0x0002adff, 0x001ac6ff, 0x0002aeff, 0x001ad2ff, 0x0002afff, 0x0002b0ff,
+	0x001ae5ff, 0x0002b1ff, 0x000045ff, 0x001af7ff, 0x0002b3ff, 0x001b03ff, 0x0002b4ff, 0x0002b5ff,
+	0x001b16ff, 0x0002b6ff, 0x001b22ff, 0x0002b7ff, 0x0002b8ff, 0x001b34ff, 0x0002b9ff, 0x001b40ff,
+	0x0002baff, 0x0002bbff, 0x001b53ff, 0x000007ff, 0x001b5fff, 0x0002bdff, 0x0002beff, 0x001b71ff,
+	0x0002bfff, 0x0002c0ff, 0x001b83ff, 0x0002c1ff, 0x001b90ff, 0x0002c2ff, 0x0002c3ff, 0x001ba2ff,
+	0x0002c4ff, 0x001baeff, 0x0002c5ff, 0x000047ff, 0x001bc0ff, 0x0002c7ff, 0x001bcdff, 0x0002c8ff,
+	0x0002c9ff, 0x001bdfff, 0x0002caff, 0x0002cbff, 0x001bf1ff, 0x0002ccff, 0x001bfeff, 0x0002cdff,
+	0x0002ceff, 0x001c10ff, 0x0002cfff, 0x001c1cff, 0x000048ff, 0x0002d1ff, 0x001c2eff, 0x0002d2ff,
+	0x001c3bff, 0x0002d3ff, 0x0002d4ff, 0x001c4dff, 0x0002d5ff, 0x0002d6ff, 0x001c5fff, 0x0002d7ff,
+	0x001c6bff, 0x0002d8ff, 0x0002d9ff, 0x001c7eff, 0x000049ff, 0x001c8aff, 0x0002dbff, 0x0002dcff,
+	0x001c9cff, 0x0002ddff, 0x001ca8ff, 0x0002deff, 0x0002dfff, 0x001cbbff, 0x0002e0ff, 0x001cc7ff,
+	0x0002e1ff, 0x0002e2ff, 0x001cd9ff, 0x0002e3ff, 0x00004aff, 0x001cecff, 0x0002e5ff, 0x001cf8ff,
+	0x0002e6ff, 0x0002e7ff, 0x001d0aff, 0x0002e8ff, 0x001d16ff, 0x0002e9ff, 0x0002eaff, 0x001d29ff,
+	0x0002ebff, 0x001d35ff, 0x0002ecff, 0x0002edff, 0x001d47ff, 0x00004bff, 0x0002efff, 0x001d59ff,
+	0x0002f0ff, 0x001d66ff, 0x0002f1ff, 0x0002f2ff, 0x001d78ff, 0x0002f3ff, 0x001d84ff, 0x0002f4ff,
+	0x0002f5ff, 0x001d96ff, 0x0002f6ff, 0x001da3ff, 0x0002f7ff, 0x00004cff, 0x001db5ff, 0x0002f9ff,
+	0x0002faff, 0x001dc7ff, 0x0002fbff, 0x001dd3ff, 0x0002fcff, 0x0002fdff, 0x001de6ff, 0x0002feff,
+	0x001df2ff, 0x0002ffff, 0x000300ff, 0x001e04ff, 0x000301ff, 0x001e11ff, 0x00004dff, 0x000303ff,
+	0x001e23ff, 0x000304ff, 0x000305ff, 0x001e35ff, 0x000306ff, 0x001e41ff, 0x000307ff, 0x000308ff,
+	0x001e54ff, 0x000309ff, 0x001e60ff, 0x00030aff, 0x00030bff, 0x001e72ff, 0x00004eff, 0x001e7eff,
+	0x00030dff, 0x00030eff, 0x001e91ff, 0x00030fff, 0x001e9dff, 0x000310ff, 0x000311ff, 0x001eafff,
+	0x000312ff, 0x000313ff, 0x001ec2ff, 0x000314ff, 0x001eceff, 0x000315ff, 0x00004fff, 0x001ee0ff,
+	0x000317ff, 0x001eecff, 0x000318ff, 0x000319ff, 0x001effff, 0x00031aff, 0x001f0bff, 0x00031bff,
+	0x00031cff, 0x001f1dff, 0x00031dff, 0x00031eff, 0x001f2fff, 0x00031fff, 0x001f3cff, 0x000008ff,
+	0x000321ff, 0x001f4eff, 0x000322ff, 0x001f5aff, 0x000323ff, 0x000324ff, 0x001f6cff, 0x000325ff,
+	0x001f79ff, 0x000326ff, 0x000327ff, 0x001f8bff, 0x000328ff, 0x000329ff, 0x001f9dff, 0x000051ff,
+	0x001fa9ff, 0x00032bff, 0x00032cff, 0x001fbcff, 0x00032dff, 0x001fc8ff, 0x00032eff, 0x00032fff,
+	0x001fdaff, 0x000330ff, 0x001fe7ff, 0x000331ff, 0x000332ff, 0x001ff9ff, 0x000333ff, 0x000052ff,
+	0x00200bff, 0x000335ff, 0x002017ff, 0x000336ff, 0x000337ff, 0x00202aff, 0x000338ff, 0x002036ff,
+	0x000339ff, 0x00033aff, 0x002048ff, 0x00033bff, 0x002054ff, 0x00033cff, 0x00033dff, 0x002067ff,
+	0x000053ff, 0x002073ff, 0x00033fff, 0x000340ff, 0x002085ff, 0x000341ff, 0x000342ff, 0x002098ff,
+	0x000343ff, 0x0020a4ff, 0x000344ff, 0x000345ff, 0x0020b6ff, 0x000346ff, 0x0020c2ff, 0x000347ff,
+	0x000054ff, 0x0020d5ff, 0x000349ff, 0x0020e1ff, 0x00034aff, 0x00034bff, 0x0020f3ff, 0x00034cff,
+	0x00034dff, 0x002105ff, 0x00034eff, 0x002112ff, 0x00034fff, 0x000350ff, 0x002124ff, 0x000351ff,
+	0x002130ff, 0x000055ff, 0x000353ff, 0x002142ff, 0x000354ff, 0x00214fff, 0x000355ff, 0x000356ff,
+	0x002161ff, 0x000357ff, 0x000358ff, 0x002173ff, 0x000359ff, 0x00217fff, 0x00035aff, 0x00035bff,
+	0x002192ff, 0x000056ff, 0x00219eff, 0x00035dff, 0x00035eff, 0x0021b0ff, 0x00035fff, 0x0021bcff,
+	0x000360ff, 0x000361ff, 0x0021cfff, 0x000362ff, 0x000363ff, 0x0021e1ff, 0x000364ff, 0x0021edff,
+	0x000365ff, 0x000057ff, 0x002200ff, 0x000367ff, 0x00220cff, 0x000368ff, 0x000369ff, 0x00221eff,
+	0x00036aff, 0x00222aff, 0x00036bff, 0x00036cff, 0x00223dff, 0x00036dff, 0x002249ff, 0x00036eff,
+	0x00036fff, 0x00225bff, 0x000058ff, 0x000371ff, 0x00226dff, 0x000372ff, 0x00227aff, 0x000373ff,
+	0x000374ff, 0x00228cff, 0x000375ff, 0x002298ff, 0x000376ff, 0x000377ff, 0x0022abff, 0x000378ff,
+	0x0022b7ff, 0x000379ff, 0x000059ff, 0x0022c9ff, 0x00037bff, 0x00037cff, 0x0022dbff, 0x00037dff,
+	0x0022e8ff, 0x00037eff, 0x00037fff, 0x0022faff, 0x000380ff, 0x002306ff, 0x000381ff, 0x000382ff,
+	0x002318ff, 0x000383ff, 0x002325ff, 0x000009ff, 0x000385ff, 0x002337ff, 0x000386ff, 0x000387ff,
+	0x002349ff, 0x000388ff, 0x002355ff, 0x000389ff, 0x00038aff, 0x002368ff, 0x00038bff, 0x002374ff,
+	0x00038cff, 0x00038dff, 0x002386ff, 0x00005bff, 0x002392ff, 0x00038fff, 0x000390ff, 0x0023a5ff,
+	0x000391ff, 0x000392ff, 0x0023b7ff, 0x000393ff, 0x0023c3ff, 0x000394ff, 0x000395ff, 0x0023d6ff,
+	0x000396ff, 0x0023e2ff, 0x000397ff, 0x00005cff, 0x0023f4ff, 0x000399ff, 0x002400ff, 0x00039aff,
+	0x00039bff, 0x002413ff, 0x00039cff, 0x00241fff, 0x00039dff, 0x00039eff, 0x002431ff, 0x00039fff,
+	0x0003a0ff, 0x002443ff, 0x0003a1ff, 0x002450ff, 0x00005dff, 0x0003a3ff, 0x002462ff, 0x0003a4ff,
+	0x00246eff, 0x0003a5ff, 0x0003a6ff, 0x002480ff, 0x0003a7ff, 0x00248dff, 0x0003a8ff, 0x0003a9ff,
+	0x00249fff, 0x0003aaff, 0x0003abff, 0x0024b1ff, 0x00005eff, 0x0024beff, 0x0003adff, 0x0003aeff,
+	0x0024d0ff, 0x0003afff, 0x0024dcff, 0x0003b0ff, 0x0003b1ff, 0x0024eeff, 0x0003b2ff, 0x0024fbff,
+	0x0003b3ff, 0x0003b4ff, 0x00250dff, 0x0003b5ff, 0x00005fff, 0x00251fff, 0x0003b7ff, 0x00252bff,
+	0x0003b8ff, 0x0003b9ff, 0x00253eff, 0x0003baff, 0x00254aff, 0x0003bbff, 0x0003bcff, 0x00255cff,
+	0x0003bdff, 0x002568ff, 0x0003beff, 0x0003bfff, 0x00257bff, 0x000060ff, 0x002587ff, 0x0003c1ff,
+	0x0003c2ff, 0x002599ff, 0x0003c3ff, 0x0003c4ff, 0x0025acff, 0x0003c5ff, 0x0025b8ff, 0x0003c6ff,
+	0x0003c7ff, 0x0025caff, 0x0003c8ff, 0x0025d6ff, 0x0003c9ff, 0x000061ff, 0x0025e9ff, 0x0003cbff,
+	0x0025f5ff, 0x0003ccff, 0x0003cdff, 0x002607ff, 0x0003ceff, 0x0003cfff, 0x002619ff, 0x0003d0ff,
+	0x002626ff, 0x0003d1ff, 0x0003d2ff, 0x002638ff, 0x0003d3ff, 0x002644ff, 0x000062ff, 0x0003d5ff,
+	0x002656ff, 0x0003d6ff, 0x002663ff, 0x0003d7ff, 0x0003d8ff, 0x002675ff, 0x0003d9ff, 0x0003daff,
+	0x002687ff, 0x0003dbff, 0x002693ff, 0x0003dcff, 0x0003ddff, 0x0026a6ff, 0x000063ff, 0x0026b2ff,
+	0x0003dfff, 0x0003e0ff, 0x0026c4ff, 0x0003e1ff, 0x0026d1ff, 0x0003e2ff, 0x0003e3ff, 0x0026e3ff,
+	0x0003e4ff, 0x0003e5ff, 0x0026f5ff, 0x0003e6ff, 0x002701ff, 0x0003e7ff, 0x00000100, 0x00271400,
+	0x0003e900, 0x00272000, 0x0003ea00, 0x0003eb00, 0x00273200, 0x0003ec00, 0x00273e00, 0x0003ed00,
+	0x0003ee00, 0x00275100, 0x0003ef00, 0x00275d00, 0x0003f000, 0x0003f100, 0x00276f00, 0x00006500,
+	0x0003f300, 0x00278200, 0x0003f400, 0x00278e00, 0x0003f500, 0x0003f600, 0x0027a000, 0x0003f700,
+	0x0027ac00, 0x0003f800, 0x0003f900, 0x0027bf00, 0x0003fa00, 0x0027cb00, 0x0003fb00, 0x00006600,
+	0x0027dd00, 0x0003fd00, 0x0003fe00, 0x0027ef00, 0x0003ff00, 0x0027fc00, 0x00040000, 0x00040100,
+	0x00280e00, 0x00040200, 0x00281a00, 0x00040300, 0x00040400, 0x00282c00, 0x00040500, 0x00283900,
+	0x00006700, 0x00040700, 0x00284b00, 0x00040800, 0x00040900, 0x00285d00, 0x00040a00, 0x00286900,
+	0x00040b00, 0x00040c00, 0x00287c00, 0x00040d00, 0x00288800, 0x00040e00, 0x00040f00, 0x00289a00,
+	0x00006800, 0x0028a600, 0x00041100, 0x00041200, 0x0028b900, 0x00041300, 0x00041400, 0x0028cb00,
+	0x00041500, 0x0028d700, 0x00041600, 0x00041700, 0x0028ea00, 0x00041800, 0x0028f600, 0x00041900,
+	0x00006900, 0x00290800, 0x00041b00, 0x00291400, 0x00041c00, 0x00041d00, 0x00292700, 0x00041e00,
+	0x00293300, 0x00041f00, 0x00042000, 0x00294500, 0x00042100, 0x00042200, 0x00295700, 0x00042300,
+	0x00296400, 0x00006a00, 0x00042500, 0x00297600, 0x00042600, 0x00298200, 0x00042700, 0x00042800,
+	0x00299500, 0x00042900, 0x0029a100, 0x00042a00, 0x00042b00, 0x0029b300, 0x00042c00, 0x00042d00,
+	0x0029c500, 0x00006b00, 0x0029d200, 0x00042f00, 0x00043000, 0x0029e400, 0x00043100, 0x0029f000,
+	0x00043200, 0x00043300, 0x002a0200, 0x00043400, 0x002a0f00, 0x00043500, 0x00043600, 0x002a2100,
+	0x00043700, 0x00006c00, 0x002a3300, 0x00043900, 0x002a3f00, 0x00043a00, 0x00043b00, 0x002a5200,
+	0x00043c00, 0x002a5e00, 0x00043d00, 0x00043e00, 0x002a7000, 0x00043f00, 0x002a7c00, 0x00044000,
+	0x00044100, 0x002a8f00, 0x00006d00, 0x00044300, 0x002aa100, 0x00044400, 0x002aad00, 0x00044500,
+	0x00044600, 0x002ac000, 0x00044700, 0x002acc00, 0x00044800, 0x00044900, 0x002ade00, 0x00044a00,
+	0x002aea00, 0x00044b00, 0x00000b00, 0x002afd00, 0x00044d00, 0x002b0900, 0x00044e00, 0x00044f00,
+	0x002b1b00, 0x00045000, 0x00045100, 0x002b2d00, 0x00045200, 0x002b3a00, 0x00045300, 0x00045400,
+	0x002b4c00, 0x00045500, 0x002b5800, 0x00006f00, 0x00045700, 0x002b6b00, 0x00045800, 0x002b7700,
+	0x00045900, 0x00045a00, 0x002b8900, 0x00045b00, 0x00045c00, 0x002b9b00, 0x00045d00, 0x002ba800,
+	0x00045e00, 0x00045f00, 0x002bba00, 0x00007000, 0x002bc600, 0x00046100, 0x00046200, 0x002bd800,
+	0x00046300, 0x002be500, 0x00046400, 0x00046500, 0x002bf700, 0x00046600, 0x00046700, 0x002c0900,
+	0x00046800, 0x002c1500, 0x00046900, 0x00007100, 0x002c2800, 0x00046b00, 0x002c3400, 0x00046c00,
+	0x00046d00, 0x002c4600, 0x00046e00, 0x002c5200, 0x00046f00, 0x00047000, 0x002c6500, 0x00047100,
+	0x00047200, 0x002c7700, 0x00047300, 0x002c8300, 0x00007200, 0x00047500, 0x002c9600, 0x00047600,
+	0x002ca200, 0x00047700, 0x00047800, 0x002cb400, 0x00047900, 0x002cc000, 0x00047a00, 0x00047b00,
+	0x002cd300, 0x00047c00, 0x002cdf00, 0x00047d00, 0x00007300, 0x002cf100, 0x00047f00, 0x00048000,
+	0x002d0300, 0x00048100, 0x002d1000, 0x00048200, 0x00048300, 0x002d2200, 0x00048400, 0x002d2e00,
+	0x00048500, 0x00048600, 0x002d4000, 0x00048700, 0x002d4d00, 0x00007400, 0x00048900, 0x002d5f00,
+	0x00048a00, 0x00048b00, 0x002d7100, 0x00048c00, 0x002d7e00, 0x00048d00, 0x00048e00, 0x002d9000,
+	0x00048f00, 0x002d9c00, 0x00049000, 0x00049100, 0x002dae00, 0x00007500, 0x002dbb00, 0x00049300,
+	0x00049400, 0x002dcd00, 0x00049500, 0x00049600, 0x002ddf00, 0x00049700, 0x002deb00, 0x00049800,
+	0x00049900, 0x002dfe00, 0x00049a00, 0x002e0a00, 0x00049b00, 0x00007600, 0x002e1c00, 0x00049d00,
+	0x002e2800, 0x00049e00, 0x00049f00, 0x002e3b00, 0x0004a000, 0x002e4700, 0x0004a100, 0x0004a200,
+	0x002e5900, 0x0004a300, 0x0004a400, 0x002e6c00, 0x0004a500, 0x002e7800, 0x00007700, 0x0004a700,
+	0x002e8a00, 0x0004a800, 0x002e9600, 0x0004a900, 0x0004aa00, 0x002ea900, 0x0004ab00, 0x002eb500,
+	0x0004ac00, 0x0004ad00, 0x002ec700, 0x0004ae00, 0x0004af00, 0x002ed900, 0x00000c00, 0x002ee600,
+	0x0004b100, 0x0004b200, 0x002ef800, 0x0004b300, 0x002f0400, 0x0004b400, 0x0004b500, 0x002f1600,
+	0x0004b600, 0x002f2300, 0x0004b700, 0x0004b800, 0x002f3500, 0x0004b900, 0x00007900, 0x002f4700,
+	0x0004bb00, 0x002f5300, 0x0004bc00, 0x0004bd00, 0x002f6600, 0x0004be00, 0x002f7200, 0x0004bf00,
+	0x0004c000, 0x002f8400, 0x0004c100, 0x002f9100, 0x0004c200, 0x0004c300, 0x002fa300, 0x00007a00,
+	0x0004c500, 0x002fb500, 0x0004c600, 0x002fc100, 0x0004c700, 0x0004c800, 0x002fd400, 0x0004c900,
+	0x002fe000, 0x0004ca00, 0x0004cb00, 0x002ff200, 0x0004cc00, 0x002ffe00, 0x0004cd00, 0x00007b00,
+	0x00301100, 0x0004cf00, 0x00301d00, 0x0004d000, 0x0004d100, 0x00302f00, 0x0004d200, 0x0004d300,
+	0x00304200, 0x0004d400, 0x00304e00, 0x0004d500, 0x0004d600, 0x00306000, 0x0004d700, 0x00306c00,
+	0x00007c00, 0x0004d900, 0x00307f00, 0x0004da00, 0x00308b00, 0x0004db00, 0x0004dc00, 0x00309d00,
+	0x0004dd00, 0x0004de00, 0x0030af00, 0x0004df00, 0x0030bc00, 0x0004e000, 0x0004e100, 0x0030ce00,
+	0x00007d00, 0x0004e300, 0x0004e400, 0x0004e600, 0x0004e700, 0x0004e800, 0x0004e900, 0x0004eb00,
+	0x00007e00, 0x0004ed00, 0x0004ee00, 0x0004ef00, 0x0004f100, 0x0004f200, 0x0004f300, 0x0004f400,
+	0x00007f00, 0x0004f700, 0x0004f800, 0x0004f900, 0x0004fa00, 0x0004fc00, 0x0004fd00, 0x0004fe00,
+	0x0004ff00, 0x00008000, 0x00050200, 0x00050300, 0x00050400, 0x00050500, 0x00050700, 0x00050800,
+	0x00050900, 0x00008100, 0x00050c00, 0x00050d00, 0x00050e00, 0x00050f00, 0x00051000, 0x00051200,
+	0x00051300, 0x00000d00, 0x00051500, 0x00051600, 0x00051800, 0x00051900, 0x00051a00, 0x00051b00,
+	0x00051d00, 0x00008300, 0x00051f00, 0x00052000, 0x00052100, 0x00052300, 0x00052400, 0x00052500,
+	0x00052600, 0x00008400, 0x00052900, 0x00052a00, 0x00052b00, 0x00052c00, 0x00052e00, 0x00052f00,
+	0x00053000, 0x00053100, 0x00008500, 0x00053400, 0x00053500, 0x00053600, 0x00053700, 0x00053900,
+	0x00053a00, 0x00053b00, 0x00008600, 0x00053e00, 0x00053f00, 0x00054000, 0x00054100, 0x00054200,
+	0x00054400, 0x00054500, 0x00008700, 0x00054700, 0x00054900, 0x00054a00, 0x00054b00, 0x00054c00,
+	0x00054d00, 0x00054f00, 0x00008800, 0x00055100, 0x00055200, 0x00055400, 0x00055500, 0x00055600,
+	0x00055700, 0x00055800, 0x00008900, 0x00055b00, 0x00055c00, 0x00055d00, 0x00055f00, 0x00056000,
+	0x00056100, 0x00056200, 0x00008a00, 0x00056500, 0x00056600, 0x00056700, 0x00056800, 0x00056900,
+	0x00056b00, 0x00056c00, 0x00056d00, 0x00008b00, 0x00057000, 0x00057100, 0x00057200, 0x00057300,
+	0x00057400, 0x00057600, 0x00057700, 0x00000e00, 0x00057900, 0x00057b00, 0x00057c00, 0x00057d00,
+	0x00057e00, 0x00057f00, 0x00058100, 0x00008d00, 0x00058300, 0x00058400, 0x00058600, 0x00058700,
+	0x00058800, 0x00058900, 0x00058a00, 0x00008e00, 0x00058d00, 0x00058e00, 0x00058f00, 0x00059100,
+	0x00059200, 0x00059300, 0x00059400, 0x00008f00, 0x00059700, 0x00059800, 0x00059900, 0x00059a00,
+	0x00059c00, 0x00059d00, 0x00059e00, 0x00059f00, 0x00009000, 0x0005a200, 0x0005a300, 0x0005a400,
+	0x0005a500, 0x0005a700, 0x0005a800, 0x0005a900, 0x00009100, 0x0005ab00, 0x0005ad00, 0x0005ae00,
+	0x0005af00, 0x0005b000, 0x0005b200, 0x0005b300, 0x00009200, 0x0005b500, 0x0005b600, 0x0005b800,
+	0x0005b900, 0x0005ba00, 0x0005bb00, 0x0005bd00, 0x00009300, 0x0005bf00, 0x0005c000, 0x0005c100,
+	0x0005c300, 0x0005c400, 0x0005c500, 0x0005c600, 0x00009400, 0x0005c900, 0x0005ca00, 0x0005cb00,
+	0x0005cc00, 0x0005ce00, 0x0005cf00, 0x0005d000, 0x0005d100, 0x00009500, 0x0005d400, 0x0005d500,
+	0x0005d600, 0x0005d700, 0x0005d900, 0x0005da00, 0x0005db00, 0x00000f00, 0x0005dd00, 0x0005df00,
+	0x0005e000, 0x0005e100, 0x0005e200, 0x0005e400, 0x0005e500, 0x00009700, 0x0005e700, 0x0005e800,
+	0x0005ea00, 0x0005eb00, 0x0005ec00, 0x0005ed00, 0x0005ef00, 0x00009800, 0x0005f100, 0x0005f200,
+	0x0005f300, 0x0005f500, 0x0005f600, 0x0005f700, 0x0005f800, 0x00009900, 0x0005fb00, 0x0005fc00,
+	0x0005fd00, 0x0005fe00, 0x00060000, 0x00060100, 0x00060200, 0x00060300, 0x00009a00, 0x00060600,
+	0x00060700, 0x00060800, 0x00060900, 0x00060b00, 0x00060c00, 0x00060d00, 0x00009b00, 0x00061000,
+	0x00061100, 0x00061200, 0x00061300, 0x00061400, 0x00061600, 0x00061700, 0x00009c00, 0x00061900,
+	0x00061a00, 0x00061c00, 0x00061d00, 0x00061e00, 0x00061f00, 0x00062100, 0x00009d00, 0x00062300,
+	0x00062400, 0x00062500, 0x00062700, 0x00062800, 0x00062900, 0x00062a00, 0x00009e00, 0x00062d00,
+	0x00062e00, 0x00062f00, 0x00063000, 0x00063200, 0x00063300, 0x00063400, 0x00063500, 0x00009f00,
+	0x00063800, 0x00063900, 0x00063a00, 0x00063b00, 0x00063d00, 0x00063e00, 0x00063f00, 0x00001000,
+	0x00064200, 0x00064300, 0x00064400, 0x00064500, 0x00064600, 0x00064800, 0x00064900, 0x0000a100,
+	0x00064b00, 0x00064d00, 0x00064e00, 0x00064f00, 0x00065000, 0x00065100, 0x00065300, 0x0000a200,
+	0x00065500, 0x00065600, 0x00065800, 0x00065900, 0x00065a00, 0x00065b00, 0x00065c00, 0x0000a300,
+	0x00065f00, 0x00066000, 0x00066100, 0x00066300, 0x00066400, 0x00066500, 0x00066600, 0x0000a400,
+	0x00066900, 0x00066a00, 0x00066b00, 0x00066c00, 0x00066e00, 0x00066f00, 0x00067000, 0x00067100,
+	0x0000a500, 0x00067400, 0x00067500, 0x00067600, 0x00067700, 0x00067800, 0x00067a00, 0x00067b00,
+	0x0000a600, 0x00067d00, 0x00067f00, 0x00068000, 0x00068100, 0x00068200, 0x00068300, 0x00068500,
+	0x0000a700, 0x00068700, 0x00068800, 0x00068a00, 0x00068b00, 0x00068c00, 0x00068d00, 0x00068e00,
+	0x0000a800, 0x00069100, 0x00069200, 0x00069300, 0x00069500, 0x00069600, 0x00069700, 0x00069800,
+	0x0000a900, 0x00069b00, 0x00069c00, 0x00069d00, 0x00069e00, 0x0006a000, 0x0006a100, 0x0006a200,
+	0x0006a300, 0x00001100, 0x0006a600, 0x0006a700, 0x0006a800, 0x0006a900, 0x0006ab00, 0x0006ac00,
+	0x0006ad00, 0x0000ab00, 0x0006af00, 0x0006b100, 0x0006b200, 0x0006b300, 0x0006b400, 0x0006b600,
+	0x0006b700, 0x0000ac00, 0x0006b900, 0x0006ba00, 0x0006bc00, 0x0006bd00, 0x0006be00, 0x0006bf00,
+	0x0006c100, 0x0000ad00, 0x0006c300, 0x0006c400, 0x0006c500, 0x0006c700, 0x0006c800, 0x0006c900,
+	0x0006ca00, 0x0000ae00, 0x0006cd00, 0x0006ce00, 0x0006cf00, 0x0006d000, 0x0006d200, 0x0006d300,
+	0x0006d400, 0x0006d500, 0x0000af00, 0x0006d800, 0x0006d900, 0x0006da00, 0x0006db00, 0x0006dd00,
+	0x0006de00, 0x0006df00, 0x0000b000, 0x0006e100, 0x0006e300, 0x0006e400, 0x0006e500, 0x0006e600,
+	0x0006e800, 0x0006e900, 0x0000b100, 0x0006eb00, 0x0006ec00, 0x0006ee00, 0x0006ef00, 0x0006f000,
+	0x0006f100, 0x0006f300, 0x0000b200, 0x0006f500, 0x0006f600, 0x0006f700, 0x0006f900, 0x0006fa00,
+	0x0006fb00, 0x0006fc00, 0x0000b300, 0x0006ff00, 0x00070000, 0x00070100, 0x00070200, 0x00070400,
+	0x00070500, 0x00070600, 0x00070700, 0x00001200, 0x00070a00, 0x00070b00, 0x00070c00, 0x00070d00,
+	0x00070f00, 0x00071000, 0x00071100, 0x0000b500, 0x00071400, 0x00071500, 0x00071600, 0x00071700,
+	0x00071800, 0x00071a00, 0x00071b00, 0x0000b600, 0x00071d00, 0x00071f00, 0x00072000, 0x00072100,
+	0x00072200, 0x00072300, 0x00072500, 0x0000b700, 0x00072700, 0x00072800, 0x00072900, 0x00072b00,
+	0x00072c00, 0x00072d00, 0x00072e00, 0x0000b800, 0x00073100, 0x00073200, 0x00073300, 0x00073400,
+	0x00073600, 0x00073700, 0x00073800, 0x00073900, 0x0000b900, 0x00073c00, 0x00073d00, 0x00073e00,
+	0x00073f00, 0x00074100, 0x00074200, 0x00074300, 0x0000ba00, 0x00074600, 0x00074700, 0x00074800,
+	0x00074900, 0x00074a00, 0x00074c00, 0x00074d00, 0x0000bb00, 0x00074f00, 0x00075100, 0x00075200,
+	0x00075300, 0x00075400, 0x00075500, 0x00075700, 0x0000bc00, 0x00075900, 0x00075a00, 0x00075c00,
+	0x00075d00, 0x00075e00, 0x00075f00, 0x00076000, 0x0000bd00, 0x00076300, 0x00076400, 0x00076500,
+	0x00076700, 0x00076800, 0x00076900, 0x00076a00, 0x00001300, 0x00076d00, 0x00076e00, 0x00076f00,
+	0x00077000, 0x00077200, 0x00077300, 0x00077400, 0x00077500, 0x0000bf00, 0x00077800, 0x00077900,
+	0x00077a00, 0x00077b00, 0x00077d00, 0x00077e00, 0x00077f00, 0x0000c000, 0x00078100, 0x00078300,
+	0x00078400, 0x00078500, 0x00078600, 0x00078700, 0x00078900, 0x0000c100, 0x00078b00, 0x00078c00,
+	0x00078e00, 0x00078f00, 0x00079000, 0x00079100, 0x00079200, 0x0000c200, 0x00079500, 0x00079600,
+	0x00079700, 0x00079900, 0x00079a00, 0x00079b00, 0x00079c00, 0x0000c300, 0x00079f00, 0x0007a000,
+	0x0007a100, 0x0007a200, 0x0007a400, 0x0007a500, 0x0007a600, 0x0007a700, 0x0000c400, 0x0007aa00,
+	0x0007ab00, 0x0007ac00, 0x0007ad00, 0x0007af00, 0x0007b000, 0x0007b100, 0x0000c500, 0x0007b300,
+	0x0007b500, 0x0007b600, 0x0007b700, 0x0007b800, 0x0007ba00, 0x0007bb00, 0x0000c600, 0x0007bd00,
+	0x0007be00, 0x0007c000, 0x0007c100, 0x0007c200, 0x0007c300, 0x0007c500, 0x0000c700, 0x0007c700,
+	0x0007c800, 0x0007c900, 0x0007cb00, 0x0007cc00, 0x0007cd00, 0x0007ce00, 0x00000200, 0x0007d100,
+	0x0007d200, 0x0007d300, 0x0007d400, 0x0007d600, 0x0007d700, 0x0007d800, 0x0007d900, 0x0000c900,
+	0x0007dc00, 0x0007dd00, 0x0007de00, 0x0007df00, 0x0007e100, 0x0007e200, 0x0007e300, 0x0000ca00,
+	0x0007e500, 0x0007e700, 0x0007e800, 0x0007e900, 0x0007ea00, 0x0007ec00, 0x0007ed00, 0x0000cb00,
+	0x0007ef00, 0x0007f000, 0x0007f200, 0x0007f300, 0x0007f400, 0x0007f500, 0x0007f700, 0x0000cc00,
+	0x0007f900, 0x0007fa00, 0x0007fb00, 0x0007fd00, 0x0007fe00, 0x0007ff00, 0x00080000, 0x0000cd00,
+	0x00080300, 0x00080400, 0x00080500, 0x00080600, 0x00080800, 0x00080900, 0x00080a00, 0x00080b00,
+	0x0000ce00, 0x00080e00, 0x00080f00, 0x00081000, 0x00081100, 0x00081300, 0x00081400, 0x00081500,
+	0x0000cf00, 0x00081800, 0x00081900, 0x00081a00, 0x00081b00, 0x00081c00, 0x00081e00, 0x00081f00,
+	0x0000d000, 0x00082100, 0x00082300, 0x00082400, 0x00082500, 0x00082600, 0x00082700, 0x00082900,
+	0x0000d100, 0x00082b00, 0x00082c00, 0x00082e00, 0x00082f00, 0x00083000, 0x00083100, 0x00083200,
+	0x00001500, 0x00083500, 0x00083600, 0x00083700, 0x00083800, 0x00083a00, 0x00083b00, 0x00083c00,
+	0x00083d00, 0x0000d300, 0x00084000, 0x00084100, 0x00084200, 0x00084300, 0x00084500, 0x00084600,
+	0x00084700, 0x0000d400, 0x00084a00, 0x00084b00, 0x00084c00, 0x00084d00, 0x00084e00, 0x00085000,
+	0x00085100, 0x0000d500, 0x00085300, 0x00085500, 0x00085600, 0x00085700, 0x00085800, 0x00085900,
+	0x00085b00, 0x0000d600, 0x00085d00, 0x00085e00, 0x00086000, 0x00086100, 0x00086200, 0x00086300,
+	0x00086400, 0x0000d700, 0x00086700, 0x00086800, 0x00086900, 0x00086b00, 0x00086c00, 0x00086d00,
+	0x00086e00, 0x0000d800, 0x00087100, 0x00087200, 0x00087300, 0x00087400, 0x00087600, 0x00087700,
+	0x00087800, 0x00087900, 0x0000d900, 0x00087c00, 0x00087d00, 0x00087e00, 0x00087f00, 0x00088100,
+	0x00088200, 0x00088300, 0x0000da00, 0x00088500, 0x00088700, 0x00088800, 0x00088900, 0x00088a00,
+	0x00088c00, 0x00088d00, 0x0000db00, 0x00088f00, 0x00089000, 0x00089200, 0x00089300, 0x00089400,
+	0x00089500, 0x00089600, 0x00001600, 0x00089900, 0x00089a00, 0x00089b00, 0x00089d00, 0x00089e00,
+	0x00089f00, 0x0008a000, 0x0000dd00, 0x0008a300, 0x0008a400, 0x0008a500, 0x0008a600, 0x0008a800,
+	0x0008a900, 0x0008aa00, 0x0008ab00, 0x0000de00, 0x0008ae00, 0x0008af00, 0x0008b000, 0x0008b100,
+	0x0008b300, 0x0008b400, 0x0008b500, 0x0000df00, 0x0008b700, 0x0008b900, 0x0008ba00, 0x0008bb00,
+	0x0008bc00, 0x0008be00, 0x0008bf00, 0x0000e000, 0x0008c100, 0x0008c200, 0x0008c400, 0x0008c500,
+	0x0008c600, 0x0008c700, 0x0008c900, 0x0000e100, 0x0008cb00, 0x0008cc00, 0x0008cd00, 0x0008cf00,
+	0x0008d000, 0x0008d100, 0x0008d200, 0x0000e200, 0x0008d500, 0x0008d600, 0x0008d700, 0x0008d800,
+	0x0008da00, 0x0008db00, 0x0008dc00, 0x0008dd00, 0x0000e300, 0x0008e000, 0x0008e100, 0x0008e200,
+	0x0008e300, 0x0008e500, 0x0008e600, 0x0008e700, 0x0000e400, 0x0008e900, 0x0008eb00, 0x0008ec00,
+	0x0008ed00, 0x0008ee00, 0x0008f000, 0x0008f100, 0x0000e500, 0x0008f300, 0x0008f400, 0x0008f600,
+	0x0008f700, 0x0008f800, 0x0008f900, 0x0008fb00, 0x00001700, 0x0008fd00, 0x0008fe00, 0x0008ff00,
+	0x00090100, 0x00090200, 0x00090300, 0x00090400, 0x0000e700, 0x00090700, 0x00090800, 0x00090900,
+	0x00090a00, 0x00090c00, 0x00090d00, 0x00090e00, 0x00090f00, 0x0000e800, 0x00091200, 0x00091300,
+	0x00091400, 0x00091500, 0x00091700, 0x00091800, 0x00091900, 0x0000e900, 0x00091c00, 0x00091d00,
+	0x00091e00, 0x00091f00, 0x00092000, 0x00092200, 0x00092300, 0x0000ea00, 0x00092500, 0x00092700,
+	0x00092800, 0x00092900, 0x00092a00, 0x00092b00, 0x00092d00, 0x0000eb00, 0x00092f00, 0x00093000,
+	0x00093200, 0x00093300, 0x00093400, 0x00093500, 0x00093600, 0x0000ec00, 0x00093900, 0x00093a00,
+	0x00093b00, 0x00093d00, 0x00093e00, 0x00093f00, 0x00094000, 0x00094100, 0x0000ed00, 0x00094400,
+	0x00094500, 0x00094600, 0x00094700, 0x00094900, 0x00094a00, 0x00094b00, 0x0000ee00, 0x00094e00,
+	0x00094f00, 0x00095000, 0x00095100, 0x00095200, 0x00095400, 0x00095500, 0x0000ef00, 0x00095700,
+	0x00095900, 0x00095a00, 0x00095b00, 0x00095c00, 0x00095d00, 0x00095f00, 0x00001800, 0x00096100,
+	0x00096200, 0x00096400, 0x00096500, 0x00096600, 0x00096700, 0x00096800, 0x0000f100, 0x00096b00,
+	0x00096c00, 0x00096d00, 0x00096f00, 0x00097000, 0x00097100, 0x00097200, 0x0000f200, 0x00097500,
+	0x00097600, 0x00097700, 0x00097800, 0x00097a00, 0x00097b00, 0x00097c00, 0x00097d00, 0x0000f300,
+	0x00098000, 0x00098100, 0x00098200, 0x00098300, 0x00098500, 0x00098600, 0x00098700, 0x0000f400,
+	0x00098900, 0x00098b00, 0x00098c00, 0x00098d00, 0x00098e00, 0x00099000, 0x00099100, 0x0000f500,
+	0x00099300, 0x00099400, 0x00099600, 0x00099700, 0x00099800, 0x00099900, 0x00099a00, 0x0000f600,
+	0x00099d00, 0x00099e00, 0x00099f00, 0x0009a100, 0x0009a200, 0x0009a300, 0x0009a400, 0x0000f700,
+	0x0009a700, 0x0009a800, 0x0009a900, 0x0009aa00, 0x0009ac00, 0x0009ad00, 0x0009ae00, 0x0009af00,
+	0x0000f800, 0x0009b200, 0x0009b300, 0x0009b400, 0x0009b500, 0x0009b700, 0x0009b800, 0x0009b900,
+	0x0000f900, 0x0009bb00, 0x0009bd00, 0x0009be00, 0x0009bf00, 0x0009c000, 0x0009c200, 0x0009c300,
+	0x00001900, 0x0009c600, 0x0009c900, 0x0009cb00, 0x0000fb00, 0x0009d000, 0x0009d300, 0x0009d500,
+	0x0000fc00, 0x0009da00, 0x0009dc00, 0x0009df00, 0x0000fd00, 0x0009e400, 0x0009e600, 0x0009e900,
+	0x0000fe00, 0x0009ee00, 0x0009f000, 0x0009f200, 0x0000ff00, 0x0009f700, 0x0009fa00, 0x0009fc00,
+	0x0009ff00, 0x00010000, 0x000a0300, 0x000a0600, 0x000a0800, 0x00010100, 0x000a0d00, 0x000a1000,
+	0x000a1200, 0x00010200, 0x000a1700, 0x000a1900, 0x000a1c00, 0x00010300, 0x000a2100, 0x000a2300,
+	0x000a2600, 0x00001a00, 0x000a2b00, 0x000a2d00, 0x000a2f00, 0x00010500, 0x000a3400, 0x000a3700,
+	0x000a3900, 0x00010600, 0x000a3e00, 0x000a4100, 0x000a4300, 0x00010700, 0x000a4800, 0x000a4a00,
+	0x000a4d00, 0x00010800, 0x000a5200, 0x000a5400, 0x000a5600, 0x00010900, 0x000a5b00, 0x000a5e00,
+	0x000a6000, 0x000a6300, 0x00010a00, 0x000a6800, 0x000a6a00, 0x000a6c00, 0x00010b00, 0x000a7100,
+	0x000a7400, 0x000a7600, 0x00010c00, 0x000a7b00, 0x000a7e00, 0x000a8000, 0x00010d00, 0x000a8500,
+	0x000a8700, 0x000a8a00, 0x00001b00, 0x000a8f00, 0x000a9100, 0x000a9400, 0x00010f00, 0x000a9800,
+	0x000a9b00, 0x000a9d00, 0x00011000, 0x000aa200, 0x000aa500, 0x000aa700, 0x00011100, 0x000aac00,
+	0x000aae00, 0x000ab100, 0x00011200, 0x000ab600, 0x000ab800, 0x000abb00, 0x00011300, 0x000abf00,
+	0x000ac200, 0x000ac400, 0x00011400, 0x000ac900, 0x000acc00, 0x000ace00, 0x000ad100, 0x00011500,
+	0x000ad500, 0x000ad800, 0x000ada00, 0x00011600, 0x000adf00, 0x000ae200, 0x000ae400, 0x00011700,
+	0x000ae900, 0x000aeb00, 0x000aee00, 0x00001c00, 0x000af300, 0x000af500, 0x000af800, 0x00011900,
+	0x000afc00, 0x000aff00, 0x000b0100, 0x00011a00, 0x000b0600, 0x000b0900, 0x000b0b00, 0x00011b00,
+	0x000b1000, 0x000b1200, 0x000b1500, 0x00011c00, 0x000b1a00, 0x000b1c00, 0x000b1f00, 0x00011d00,
+	0x000b2400, 0x000b2600, 0x000b2800, 0x00011e00, 0x000b2d00, 0x000b3000, 0x000b3200, 0x000b3500,
+	0x00011f00, 0x000b3a00, 0x000b3c00, 0x000b3e00, 0x00012000, 0x000b4300, 0x000b4600, 0x000b4800,
+	0x00012100, 0x000b4d00, 0x000b5000, 0x000b5200, 0x00001d00, 0x000b5700, 0x000b5900, 0x000b5c00,
+	0x00012300, 0x000b6100, 0x000b6300, 0x000b6500, 0x00012400, 0x000b6a00, 0x000b6d00, 0x000b6f00,
+	0x00012500, 0x000b7400, 0x000b7700, 0x000b7900, 0x00012600, 0x000b7e00, 0x000b8000, 0x000b8300,
+	0x00012700, 0x000b8800, 0x000b8a00, 0x000b8d00, 0x00012800, 0x000b9100, 0x000b9400, 0x000b9600,
+	0x000b9900, 0x00012900, 0x000b9e00, 0x000ba000, 0x000ba300, 0x00012a00, 0x000ba700, 0x000baa00,
+	0x000bac00, 0x00012b00, 0x000bb100, 0x000bb400, 0x000bb600, 0x00000300, 0x000bbb00, 0x000bbd00,
+	0x000bc000, 0x00012d00, 0x000bc500, 0x000bc700, 0x000bca00, 0x00012e00, 0x000bce00, 0x000bd100,
+	0x000bd300, 0x00012f00, 0x000bd800, 0x000bdb00, 0x000bdd00, 0x00013000, 0x000be200, 0x000be400,
+	0x000be700, 0x00013100, 0x000bec00, 0x000bee00, 0x000bf100, 0x00013200, 0x000bf600, 0x000bf800,
+	0x000bfa00, 0x00013300, 0x000bff00, 0x000c0200, 0x000c0400, 0x000c0700, 0x00013400, 0x000c0b00,
+	0x000c0e00, 0x000c1000, 0x00013500, 0x000c1500, 0x000c1800, 0x000c1a00, 0x00001f00, 0x000c1f00,
+	0x000c2100, 0x000c2400, 0x00013700, 0x000c2900, 0x000c2b00, 0x000c2e00, 0x00013800, 0x000c3300,
+	0x000c3500, 0x000c3700, 0x00013900, 0x000c3c00, 0x000c3f00, 0x000c4100, 0x00013a00, 0x000c4600,
+	0x000c4900, 0x000c4b00, 0x00013b00, 0x000c5000, 0x000c5200, 0x000c5500, 0x00013c00, 0x000c5a00,
+	0x000c5c00, 0x000c5f00, 0x00013d00, 0x000c6300, 0x000c6600, 0x000c6800, 0x000c6b00, 0x00013e00,
+	0x000c7000, 0x000c7200, 0x000c7400, 0x00013f00, 0x000c7900, 0x000c7c00, 0x000c7e00, 0x00002000,
+	0x000c8300, 0x000c8600, 0x000c8800, 0x00014100, 0x000c8d00, 0x000c8f00, 0x000c9200, 0x00014200,
+	0x000c9700, 0x000c9900, 0x000c9c00, 0x00014300, 0x000ca000, 0x000ca300, 0x000ca500, 0x00014400,
+	0x000caa00, 0x000cad00, 0x000caf00, 0x00014500, 0x000cb400, 0x000cb600, 0x000cb900, 0x00014600,
+	0x000cbe00, 0x000cc000, 0x000cc300, 0x00014700, 0x000cc700, 0x000cca00, 0x000ccc00, 0x00014800,
+	0x000cd100, 0x000cd400, 0x000cd600, 0x000cd900, 0x00014900, 0x000cdd00, 0x000ce000, 0x000ce200,
+	0x00002100, 0x000ce700, 0x000cea00, 0x000cec00, 0x00014b00, 0x000cf100, 0x000cf300, 0x000cf600,
+	0x00014c00, 0x000cfb00, 0x000cfd00, 0x000d0000, 0x00014d00, 0x000d0500, 0x000d0700, 0x000d0900,
+	0x00014e00, 0x000d0e00, 0x000d1100, 0x000d1300, 0x00014f00, 0x000d1800, 0x000d1a00, 0x000d1d00,
+	0x00015000, 0x000d2200, 0x000d2400, 0x000d2700, 0x00015100, 0x000d2c00, 0x000d2e00, 0x000d3000,
+	0x00015200, 0x000d3500, 0x000d3800, 0x000d3a00, 0x000d3d00, 0x00015300, 0x000d4200, 0x000d4400,
+	0x000d4600, 0x00002200, 0x000d4b00, 0x000d4e00, 0x000d5000, 0x00015500, 0x000d5500, 0x000d5800,
+	0x000d5a00, 0x00015600, 0x000d5f00, 0x000d6100, 0x000d6400, 0x00015700, 0x000d6900, 0x000d6b00,
+	0x000d6e00, 0x00015800, 0x000d7200, 0x000d7500, 0x000d7700, 0x00015900, 0x000d7c00, 0x000d7f00,
+	0x000d8100, 0x00015a00, 0x000d8600, 0x000d8800, 0x000d8b00, 0x00015b00, 0x000d9000, 0x000d9200,
+	0x000d9500, 0x00015c00, 0x000d9900, 0x000d9c00, 0x000d9e00, 0x000da100, 0x00015d00, 0x000da600,
+	0x000da800, 0x000dab00, 0x00002300, 0x000daf00, 0x000db200, 0x000db400, 0x00015f00, 0x000db900,
+	0x000dbc00, 0x000dbe00, 0x00016000, 0x000dc300, 0x000dc500, 0x000dc800, 0x00016100, 0x000dcd00,
+	0x000dcf00, 0x000dd200, 0x00016200, 0x000dd600, 0x000dd900, 0x000ddb00, 0x00016300, 0x000de000,
+	0x000de300, 0x000de500, 0x00016400, 0x000dea00, 0x000dec00, 0x000def00, 0x00016500, 0x000df400,
+	0x000df600, 0x000df900, 0x00016600, 0x000dfe00, 0x000e0000, 0x000e0200, 0x00016700, 0x000e0700,
+	0x000e0a00, 0x000e0c00, 0x000e0f00, 0x00002400, 0x000e1400, 0x000e1600, 0x000e1800, 0x00016900,
+	0x000e1d00, 0x000e2000, 0x000e2200, 0x00016a00, 0x000e2700, 0x000e2900, 0x000e2c00, 0x00016b00,
+	0x000e3100, 0x000e3300, 0x000e3600, 0x00016c00, 0x000e3b00, 0x000e3d00, 0x000e3f00, 0x00016d00,
+	0x000e4400, 0x000e4700, 0x000e4900, 0x00016e00, 0x000e4e00, 0x000e5100, 0x000e5300, 0x00016f00,
+	0x000e5800, 0x000e5a00, 0x000e5d00, 0x00017000, 0x000e6200, 0x000e6400, 0x000e6700, 0x00017100,
+	0x000e6b00, 0x000e6e00, 0x000e7000, 0x000e7300, 0x00002500, 0x000e7800, 0x000e7a00, 0x000e7c00,
+	0x00017300, 0x000e8100, 0x000e8400, 0x000e8600, 0x00017400, 0x000e8b00, 0x000e8e00, 0x000e9000,
+	0x00017500, 0x000e9500, 0x000e9700, 0x000e9a00, 0x00017600, 0x000e9f00, 0x000ea100, 0x000ea400,
+	0x00017700, 0x000ea800, 0x000eab00, 0x000ead00, 0x00017800, 0x000eb200, 0x000eb500, 0x000eb700,
+	0x00017900, 0x000ebc00, 0x000ebe00, 0x000ec100, 0x00017a00, 0x000ec600, 0x000ec800, 0x000ecb00,
+	0x00017b00, 0x000ed000, 0x000ed200, 0x000ed400, 0x00002600, 0x000ed900, 0x000edc00, 0x000ede00,
+	0x000ee100, 0x00017d00, 0x000ee500, 0x000ee800, 0x000eea00, 0x00017e00, 0x000eef00, 0x000ef200,
+	0x000ef400, 0x00017f00, 0x000ef900, 0x000efb00, 0x000efe00, 0x00018000, 0x000f0300, 0x000f0500,
+	0x000f0800, 0x00018100, 0x000f0d00, 0x000f0f00, 0x000f1100, 0x00018200, 0x000f1600, 0x000f1900,
+	0x000f1b00, 0x00018300, 0x000f2000, 0x000f2300, 0x000f2500, 0x00018400, 0x000f2a00, 0x000f2c00,
+	0x000f2f00, 0x00018500, 0x000f3400, 0x000f3600, 0x000f3800, 0x00002700, 0x000f3d00, 0x000f4000,
+	0x000f4200, 0x000f4500, 0x00018700, 0x000f4a00, 0x000f4c00, 0x000f4e00, 0x00018800, 0x000f5300,
+	0x000f5600, 0x000f5800, 0x00018900, 0x000f5d00, 0x000f6000, 0x000f6200, 0x00018a00, 0x000f6700,
+	0x000f6900, 0x000f6c00, 0x00018b00, 0x000f7100, 0x000f7300, 0x000f7600, 0x00018c00, 0x000f7a00,
+	0x000f7d00, 0x000f7f00, 0x00018d00, 0x000f8400, 0x000f8700, 0x000f8900, 0x00018e00, 0x000f8e00,
+	0x000f9000, 0x000f9300, 0x00018f00, 0x000f9800, 0x000f9a00, 0x000f9d00, 0x00000400, 0x000fa100,
+	0x000fa400, 0x000fa600, 0x00019100, 0x000fab00, 0x000fae00, 0x000fb000, 0x000fb300, 0x00019200,
+	0x000fb700, 0x000fba00, 0x000fbc00, 0x00019300, 0x000fc100, 0x000fc400, 0x000fc600, 0x00019400,
+	0x000fcb00, 0x000fcd00, 0x000fd000, 0x00019500, 0x000fd500, 0x000fd700, 0x000fda00, 0x00019600,
+	0x000fde00, 0x000fe100, 0x000fe300, 0x00019700, 0x000fe800, 0x000feb00, 0x000fed00, 0x00019800,
+	0x000ff200, 0x000ff400, 0x000ff700, 0x00019900, 0x000ffc00, 0x000ffe00, 0x00100100, 0x00002900,
+	0x00100600, 0x00100800, 0x00100a00, 0x00019b00, 0x00100f00, 0x00101200, 0x00101400, 0x00101700,
+	0x00019c00, 0x00101c00, 0x00101e00, 0x00102000, 0x00019d00, 0x00102500, 0x00102800, 0x00102a00,
+	0x00019e00, 0x00102f00, 0x00103200, 0x00103400, 0x00019f00, 0x00103900, 0x00103b00, 0x00103e00,
+	0x0001a000, 0x00104300, 0x00104500, 0x00104700, 0x0001a100, 0x00104c00, 0x00104f00, 0x00105100,
+	0x0001a200, 0x00105600, 0x00105900, 0x00105b00, 0x0001a300, 0x00106000, 0x00106200, 0x00106500,
+	0x00002a00, 0x00106a00, 0x00106c00, 0x00106f00, 0x0001a500, 0x00107300, 0x00107600, 0x00107800,
+	0x00107b00, 0x0001a600, 0x00108000, 0x00108200, 0x00108500, 0x0001a700, 0x00108900, 0x00108c00,
+	0x00108e00, 0x0001a800, 0x00109300, 0x00109600, 0x00109800, 0x0001a900, 0x00109d00, 0x00109f00,
+	0x0010a200, 0x0001aa00, 0x0010a700, 0x0010a900, 0x0010ac00, 0x0001ab00, 0x0010b000, 0x0010b300,
+	0x0010b500, 0x0001ac00, 0x0010ba00, 0x0010bd00, 0x0010bf00, 0x0001ad00, 0x0010c400, 0x0010c600,
+	0x0010c900, 0x00002b00, 0x0010ce00, 0x0010d000, 0x0010d300, 0x0001af00, 0x0010d800, 0x0010da00,
+	0x0010dc00, 0x0001b000, 0x0010e100, 0x0010e400, 0x0010e600, 0x0010e900, 0x0001b100, 0x0010ed00,
+	0x0010f000, 0x0010f200, 0x0001b200, 0x0010f700, 0x0010fa00, 0x0010fc00, 0x0001b300, 0x00110100,
+	0x00110300, 0x00110600, 0x0001b400, 0x00110b00, 0x00110d00, 0x00111000, 0x0001b500, 0x00111500,
+	0x00111700, 0x00111900, 0x0001b600, 0x00111e00, 0x00112100, 0x00112300, 0x0001b700, 0x00112800,
+	0x00112b00, 0x00112d00, 0x00002c00, 0x00113200, 0x00113400, 0x00113700, 0x0001b900, 0x00113c00,
+	0x00113e00, 0x00114100, 0x0001ba00, 0x00114500, 0x00114800, 0x00114a00, 0x00114d00, 0x0001bb00,
+	0x00115200, 0x00115400, 0x00115600, 0x0001bc00, 0x00115b00, 0x00115e00, 0x00116000, 0x0001bd00,
+	0x00116500, 0x00116800, 0x00116a00, 0x0001be00, 0x00116f00, 0x00117100, 0x00117400, 0x0001bf00,
+	0x00117900, 0x00117b00, 0x00117e00, 0x0001c000, 0x00118200, 0x00118500, 0x00118700, 0x0001c100,
+	0x00118c00, 0x00118f00, 0x00119100, 0x00002d00, 0x00119600, 0x00119800, 0x00119b00, 0x0001c300,
+	0x0011a000, 0x0011a200, 0x0011a500, 0x0001c400, 0x0011a900, 0x0011ac00, 0x0011ae00, 0x0001c500,
+	0x0011b300, 0x0011b600, 0x0011b800, 0x0011bb00, 0x0001c600, 0x0011bf00, 0x0011c200, 0x0011c400,
+	0x0001c700, 0x0011c900, 0x0011cc00, 0x0011ce00, 0x0001c800, 0x0011d300, 0x0011d500, 0x0011d800,
+	0x0001c900, 0x0011dd00, 0x0011df00, 0x0011e200, 0x0001ca00, 0x0011e700, 0x0011e900, 0x0011eb00,
+	0x0001cb00, 0x0011f000, 0x0011f300, 0x0011f500, 0x00002e00, 0x0011fa00, 0x0011fc00, 0x0011ff00,
+	0x0001cd00, 0x00120400, 0x00120600, 0x00120900, 0x0001ce00, 0x00120e00, 0x00121000, 0x00121200,
+	0x0001cf00, 0x00121700, 0x00121a00, 0x00121c00, 0x00121f00, 0x0001d000, 0x00122400, 0x00122600,
+	0x00122800, 0x0001d100, 0x00122d00, 0x00123000, 0x00123200, 0x0001d200, 0x00123700, 0x00123a00,
+	0x00123c00, 0x0001d300, 0x00124100, 0x00124300, 0x00124600, 0x0001d400, 0x00124b00, 0x00124d00,
+	0x00125000, 0x0001d500, 0x00125400, 0x00125700, 0x00125900, 0x00002f00, 0x00125e00, 0x00126100,
+	0x00126300, 0x0001d700, 0x00126800, 0x00126a00, 0x00126d00, 0x0001d800, 0x00127200, 0x00127400,
+	0x00127700, 0x0001d900, 0x00127b00, 0x00127e00, 0x00128000, 0x00128300, 0x0001da00, 0x00128800,
+	0x00128a00, 0x00128d00, 0x0001db00, 0x00129100, 0x00129400, 0x00129600, 0x0001dc00, 0x00129b00,
+	0x00129e00, 0x0012a000, 0x0001dd00, 0x0012a500, 0x0012a700, 0x0012aa00, 0x0001de00, 0x0012af00,
+	0x0012b100, 0x0012b400, 0x0001df00, 0x0012b800, 0x0012bb00, 0x0012bd00, 0x00003000, 0x0012c200,
+	0x0012c500, 0x0012c700, 0x0001e100, 0x0012cc00, 0x0012ce00, 0x0012d100, 0x0001e200, 0x0012d600,
+	0x0012d800, 0x0012db00, 0x0001e300, 0x0012e000, 0x0012e200, 0x0012e400, 0x0001e400, 0x0012e900,
+	0x0012ec00, 0x0012ee00, 0x0012f100, 0x0001e500, 0x0012f600, 0x0012f800, 0x0012fa00, 0x0001e600,
+	0x0012ff00, 0x00130200, 0x00130400, 0x0001e700, 0x00130900, 0x00130b00, 0x00130e00, 0x0001e800,
+	0x00131300, 0x00131500, 0x00131800, 0x0001e900, 0x00131d00, 0x00131f00, 0x00132100, 0x00003100,
+	0x00132600, 0x00132900, 0x00132b00, 0x0001eb00, 0x00133000, 0x00133300, 0x00133500, 0x0001ec00,
+	0x00133a00, 0x00133c00, 0x00133f00, 0x0001ed00, 0x00134400, 0x00134600, 0x00134900, 0x0001ee00,
+	0x00134d00, 0x00135000, 0x00135200, 0x00135500, 0x0001ef00, 0x00135a00, 0x00135c00, 0x00135e00,
+	0x0001f000, 0x00136300, 0x00136600, 0x00136800, 0x0001f100, 0x00136d00, 0x00137000, 0x00137200,
+	0x0001f200, 0x00137700, 0x00137900, 0x00137c00, 0x0001f300, 0x00138100, 0x00138300, 0x00138600,
+	0x00000500, 0x00138d00, 0x0001f500, 0x00139700, 0x0001f600, 0x0013a000, 0x0001f700, 0x0013aa00,
+	0x0001f800, 0x0013b400, 0x0001f900, 0x0013be00, 0x0001fa00, 0x0013c700, 0x0001fb00, 0x0013d100,
+	0x0001fc00, 0x0013db00, 0x0001fd00, 0x0013e500, 0x00003300, 0x0013ef00, 0x0013f300, 0x0001ff00,
+	0x0013fd00, 0x00020000, 0x00140700, 0x00020100, 0x00141100, 0x00020200, 0x00141a00, 0x00020300,
+	0x00142400, 0x00020400, 0x00142e00, 0x00020500, 0x00143800, 0x00020600, 0x00144200, 0x00020700,
+	0x00144b00, 0x00003400, 0x00145500, 0x00020900, 0x00145f00, 0x00020a00, 0x00146900, 0x00020b00,
+	0x00147200, 0x00020c00, 0x00147c00, 0x00020d00, 0x00148600, 0x00020e00, 0x00149000, 0x00020f00,
+	0x00149900, 0x00021000, 0x0014a300, 0x00021100, 0x0014ad00, 0x00003500, 0x0014b700, 0x00021300,
+	0x0014c000, 0x0014c500, 0x00021400, 0x0014cf00, 0x00021500, 0x0014d900, 0x00021600, 0x0014e300,
+	0x00021700, 0x0014ec00, 0x00021800, 0x0014f600, 0x00021900, 0x00150000, 0x00021a00, 0x00150a00,
+	0x00021b00, 0x00151400, 0x00003600, 0x00151d00, 0x00021d00, 0x00152700, 0x00021e00, 0x00153100,
+	0x00021f00, 0x00153b00, 0x00022000, 0x00154400, 0x00022100, 0x00154e00, 0x00022200, 0x00155800,
+	0x00022300, 0x00156200, 0x00022400, 0x00156b00, 0x00022500, 0x00157500, 0x00003700, 0x00157f00,
+	0x00022700, 0x00158900, 0x00022800, 0x00159200, 0x00159700, 0x00022900, 0x0015a100, 0x00022a00,
+	0x0015ab00, 0x00022b00, 0x0015b500, 0x00022c00, 0x0015be00, 0x00022d00, 0x0015c800, 0x00022e00,
+	0x0015d200, 0x00022f00, 0x0015dc00, 0x00003800, 0x0015e500, 0x00023100, 0x0015ef00, 0x00023200,
+	0x0015f900, 0x00023300, 0x00160300, 0x00023400, 0x00160d00, 0x00023500, 0x00161600, 0x00023600,
+	0x00162000, 0x00023700, 0x00162a00, 0x00023800, 0x00163400, 0x00023900, 0x00163d00, 0x00003900,
+	0x00164700, 0x00023b00, 0x00165100, 0x00023c00, 0x00165b00, 0x00166000, 0x00023d00, 0x00166900,
+	0x00023e00, 0x00167300, 0x00023f00, 0x00167d00, 0x00024000, 0x00168700, 0x00024100, 0x00169000,
+	0x00024200, 0x00169a00, 0x00024300, 0x0016a400, 0x00003a00, 0x0016ae00, 0x00024500, 0x0016b700,
+	0x00024600, 0x0016c100, 0x00024700, 0x0016cb00, 0x00024800, 0x0016d500, 0x00024900, 0x0016de00,
+	0x00024a00, 0x0016e800, 0x00024b00, 0x0016f200, 0x00024c00, 0x0016fc00, 0x00024d00, 0x00170600,
+	0x00003b00, 0x00170f00, 0x00024f00, 0x00171900, 0x00025000, 0x00172300, 0x00025100, 0x00172d00,
+	0x00173200, 0x00025200, 0x00173b00, 0x00025300, 0x00174500, 0x00025400, 0x00174f00, 0x00025500,
+	0x00175900, 0x00025600, 0x00176200, 0x00025700, 0x00176c00, 0x00000600, 0x00177600, 0x00025900,
+	0x00178000, 0x00025a00, 0x00178900, 0x00025b00, 0x00179300, 0x00025c00, 0x00179d00, 0x00025d00,
+	0x0017a700, 0x00025e00, 0x0017b000, 0x00025f00, 0x0017ba00, 0x00026000, 0x0017c400, 0x00026100,
+	0x0017ce00, 0x00003d00, 0x0017d800, 0x00026300, 0x0017e100, 0x00026400, 0x0017eb00, 0x00026500,
+	0x0017f500, 0x00026600, 0x0017ff00, 0x00180300, 0x00026700, 0x00180d00, 0x00026800, 0x00181700,
+	0x00026900, 0x00182100, 0x00026a00, 0x00182b00, 0x00026b00, 0x00183400, 0x00003e00, 0x00183e00,
+	0x00026d00, 0x00184800, 0x00026e00, 0x00185200, 0x00026f00, 0x00185b00, 0x00027000, 0x00186500,
+	0x00027100, 0x00186f00, 0x00027200, 0x00187900, 0x00027300, 0x00188200, 0x00027400, 0x00188c00,
+	0x00027500, 0x00189600, 0x00003f00, 0x0018a000, 0x00027700, 0x0018a900, 0x00027800, 0x0018b300,
+	0x00027900, 0x0018bd00, 0x00027a00, 0x0018c700, 0x00027b00, 0x0018d100, 0x0018d500, 0x00027c00,
+	0x0018df00, 0x00027d00, 0x0018e900, 0x00027e00, 0x0018f300, 0x00027f00, 0x0018fc00, 0x00004000,
+	0x00190600, 0x00028100, 0x00191000, 0x00028200, 0x00191a00, 0x00028300, 0x00192400, 0x00028400,
+	0x00192d00, 0x00028500, 0x00193700, 0x00028600, 0x00194100, 0x00028700, 0x00194b00, 0x00028800,
+	0x00195400, 0x00028900, 0x00195e00, 0x00004100, 0x00196800, 0x00028b00, 0x00197200, 0x00028c00,
+	0x00197b00, 0x00028d00, 0x00198500, 0x00028e00, 0x00198f00, 0x00028f00, 0x00199900, 0x00029000,
+	0x0019a200, 0x0019a700, 0x00029100, 0x0019b100, 0x00029200, 0x0019bb00, 0x00029300, 0x0019c500,
+	0x00004200, 0x0019ce00, 0x00029500, 0x0019d800, 0x00029600, 0x0019e200, 0x00029700, 0x0019ec00,
+	0x00029800, 0x0019f600, 0x00029900, 0x0019ff00, 0x00029a00, 0x001a0900, 0x00029b00, 0x001a1300,
+	0x00029c00, 0x001a1d00, 0x00029d00, 0x001a2600, 0x00004300, 0x001a3000, 0x00029f00, 0x001a3a00,
+	0x0002a000, 0x001a4400, 0x0002a100, 0x001a4d00, 0x0002a200, 0x001a5700, 0x0002a300, 0x001a6100,
+	0x0002a400, 0x001a6b00, 0x0002a500, 0x001a7400, 0x001a7900, 0x0002a600, 0x001a8300, 0x0002a700,
+	0x001a8d00, 0x00004400, 0x001a9700, 0x0002a900, 0x001aa000, 0x0002aa00, 0x001aaa00, 0x0002ab00,
+	0x001ab400, 0x0002ac00, 0x001abe00, 0x0002ad00, 0x001ac700, 0x0002ae00, 0x001ad100, 0x0002af00,
+	0x001adb00, 0x0002b000, 0x001ae500, 0x0002b100, 0x001aef00, 0x00004500, 0x001af800, 0x0002b300,
+	0x001b0200, 0x0002b400, 0x001b0c00, 0x0002b500, 0x001b1600, 0x0002b600, 0x001b1f00, 0x0002b700,
+	0x001b2900, 0x0002b800, 0x001b3300, 0x0002b900, 0x001b3d00, 0x001b4200, 0x0002ba00, 0x001b4b00,
+	0x0002bb00, 0x001b5500, 0x00000700, 0x001b5f00, 0x0002bd00, 0x001b6900, 0x0002be00, 0x001b7200,
+	0x0002bf00, 0x001b7c00, 0x0002c000, 0x001b8600, 0x0002c100, 0x001b9000, 0x0002c200, 0x001b9900,
+	0x0002c300, 0x001ba300, 0x0002c400, 0x001bad00, 0x0002c500, 0x001bb700, 0x00004700, 0x001bc000,
+	0x0002c700, 0x001bca00, 0x0002c800, 0x001bd400, 0x0002c900, 0x001bde00, 0x0002ca00, 0x001be800,
+	0x0002cb00, 0x001bf100, 0x0002cc00, 0x001bfb00, 0x0002cd00, 0x001c0500, 0x0002ce00, 0x001c0f00,
+	0x001c1400, 0x0002cf00, 0x001c1d00, 0x00004800, 0x001c2700, 0x0002d100, 0x001c3100, 0x0002d200,
+	0x001c3b00, 0x0002d300, 0x001c4400, 0x0002d400, 0x001c4e00, 0x0002d500, 0x001c5800, 0x0002d600,
+	0x001c6200, 0x0002d700, 0x001c6b00, 0x0002d800, 0x001c7500, 0x0002d900, 0x001c7f00, 0x00004900,
+	0x001c8900, 0x0002db00, 0x001c9200, 0x0002dc00, 0x001c9c00, 0x0002dd00, 0x001ca600, 0x0002de00,
+	0x001cb000, 0x0002df00, 0x001cba00, 0x0002e000, 0x001cc300, 0x0002e100, 0x001ccd00, 0x0002e200,
+	0x001cd700, 0x0002e300, 0x001ce100, 0x001ce500, 0x00004a00, 0x001cef00, 0x0002e500, 0x001cf900,
+	0x0002e600, 0x001d0300, 0x0002e700, 0x001d0d00, 0x0002e800, 0x001d1600, 0x0002e900, 0x001d2000,
+	0x0002ea00, 0x001d2a00, 0x0002eb00, 0x001d3400, 0x0002ec00, 0x001d3d00, 0x0002ed00, 0x001d4700,
+	0x00004b00, 0x001d5100, 0x0002ef00, 0x001d5b00, 0x0002f000, 0x001d6400, 0x0002f100, 0x001d6e00,
+	0x0002f200, 0x001d7800, 0x0002f300, 0x001d8200, 0x0002f400, 0x001d8b00, 0x0002f500, 0x001d9500,
+	0x0002f600, 0x001d9f00, 0x0002f700, 0x001da900, 0x00004c00, 0x001db300, 0x001db700, 0x0002f900,
+	0x001dc100, 0x0002fa00, 0x001dcb00, 0x0002fb00, 0x001dd500, 0x0002fc00, 0x001dde00, 0x0002fd00,
+	0x001de800, 0x0002fe00, 0x001df200, 0x0002ff00, 0x001dfc00, 0x00030000, 0x001e0600, 0x00030100,
+	0x001e0f00, 0x00004d00, 0x001e1900, 0x00030300, 0x001e2300, 0x00030400, 0x001e2d00, 0x00030500,
+	0x001e3600, 0x00030600, 0x001e4000, 0x00030700, 0x001e4a00, 0x00030800, 0x001e5400, 0x00030900,
+	0x001e5d00, 0x00030a00, 0x001e6700, 0x00030b00, 0x001e7100, 0x00004e00, 0x001e7b00, 0x00030d00,
+	0x001e8400, 0x001e8900, 0x00030e00, 0x001e9300, 0x00030f00, 0x001e9d00, 0x00031000, 0x001ea700,
+	0x00031100, 0x001eb000, 0x00031200, 0x001eba00, 0x00031300, 0x001ec400, 0x00031400, 0x001ece00,
+	0x00031500, 0x001ed800, 0x00004f00, 0x001ee100, 0x00031700, 0x001eeb00, 0x00031800, 0x001ef500,
+	0x00031900, 0x001eff00, 0x00031a00, 0x001f0800, 0x00031b00, 0x001f1200, 0x00031c00, 0x001f1c00,
+	0x00031d00, 0x001f2600, 0x00031e00, 0x001f2f00, 0x00031f00, 0x001f3900, 0x00000800, 0x001f4300,
+	0x00032100, 0x001f4d00, 0x00032200, 0x001f5600, 0x001f5b00, 0x00032300, 0x001f6500, 0x00032400,
+	0x001f6f00, 0x00032500, 0x001f7900, 0x00032600, 0x001f8200, 0x00032700, 0x001f8c00, 0x00032800,
+	0x001f9600, 0x00032900, 0x001fa000, 0x00005100, 0x001fa900, 0x00032b00, 0x001fb300, 0x00032c00,
+	0x001fbd00, 0x00032d00, 0x001fc700, 0x00032e00, 0x001fd100, 0x00032f00, 0x001fda00, 0x00033000,
+	0x001fe400, 0x00033100, 0x001fee00, 0x00033200, 0x001ff800, 0x00033300, 0x00200100, 0x00005200,
+	0x00200b00, 0x00033500, 0x00201500, 0x00033600, 0x00201f00, 0x00202400, 0x00033700, 0x00202d00,
+	0x00033800, 0x00203700, 0x00033900, 0x00204100, 0x00033a00, 0x00204b00, 0x00033b00, 0x00205400,
+	0x00033c00, 0x00205e00, 0x00033d00, 0x00206800, 0x00005300, 0x00207200, 0x00033f00, 0x00207b00,
+	0x00034000, 0x00208500, 0x00034100, 0x00208f00, 0x00034200, 0x00209900, 0x00034300, 0x0020a200,
+	0x00034400, 0x0020ac00, 0x00034500, 0x0020b600, 0x00034600, 0x0020c000, 0x00034700, 0x0020ca00,
+	0x00005400, 0x0020d300, 0x00034900, 0x0020dd00, 0x00034a00, 0x0020e700, 0x00034b00, 0x0020f100,
+	0x0020f600, 0x00034c00, 0x0020ff00, 0x00034d00, 0x00210900, 0x00034e00, 0x00211300, 0x00034f00,
+	0x00211d00, 0x00035000, 0x00212600, 0x00035100, 0x00213000, 0x00005500, 0x00213a00, 0x00035300,
+	0x00214400, 0x00035400, 0x00214d00, 0x00035500, 0x00215700, 0x00035600, 0x00216100, 0x00035700,
+	0x00216b00, 0x00035800, 0x00217400, 0x00035900, 0x00217e00, 0x00035a00, 0x00218800, 0x00035b00,
+	0x00219200, 0x00005600, 0x00219c00, 0x00035d00, 0x0021a500, 0x00035e00, 0x0021af00, 0x00035f00,
+	0x0021b900, 0x00036000, 0x0021c300, 0x0021c700, 0x00036100, 0x0021d100, 0x00036200, 0x0021db00,
+	0x00036300, 0x0021e500, 0x00036400, 0x0021ef00, 0x00036500, 0x0021f800, 0x00005700, 0x00220200,
+	0x00036700, 0x00220c00, 0x00036800, 0x00221600, 0x00036900, 0x00221f00, 0x00036a00, 0x00222900,
+	0x00036b00, 0x00223300, 0x00036c00, 0x00223d00, 0x00036d00, 0x00224600, 0x00036e00, 0x00225000,
+	0x00036f00, 0x00225a00, 0x00005800, 0x00226400, 0x00037100, 0x00226d00, 0x00037200, 0x00227700,
+	0x00037300, 0x00228100, 0x00037400, 0x00228b00, 0x00037500, 0x00229500, 0x00229900, 0x00037600,
+	0x0022a300, 0x00037700, 0x0022ad00, 0x00037800, 0x0022b700, 0x00037900, 0x0022c000, 0x00005900,
+	0x0022ca00, 0x00037b00, 0x0022d400, 0x00037c00, 0x0022de00, 0x00037d00, 0x0022e800, 0x00037e00,
+	0x0022f100, 0x00037f00, 0x0022fb00, 0x00038000, 0x00230500, 0x00038100, 0x00230f00, 0x00038200,
+	0x00231800, 0x00038300, 0x00232200, 0x00000900, 0x00232c00, 0x00038500, 0x00233600, 0x00038600,
+	0x00233f00, 0x00038700, 0x00234900, 0x00038800, 0x00235300, 0x00038900, 0x00235d00, 0x00038a00,
+	0x00236600, 0x00236b00, 0x00038b00, 0x00237500, 0x00038c00, 0x00237f00, 0x00038d00, 0x00238900,
+	0x00005b00, 0x00239200, 0x00038f00, 0x00239c00, 0x00039000, 0x0023a600, 0x00039100, 0x0023b000,
+	0x00039200, 0x0023ba00, 0x00039300, 0x0023c300, 0x00039400, 0x0023cd00, 0x00039500, 0x0023d700,
+	0x00039600, 0x0023e100, 0x00039700, 0x0023ea00, 0x00005c00, 0x0023f400, 0x00039900, 0x0023fe00,
+	0x00039a00, 0x00240800, 0x00039b00, 0x00241100, 0x00039c00, 0x00241b00, 0x00039d00, 0x00242500,
+	0x00039e00, 0x00242f00, 0x00039f00, 0x00243800, 0x00243d00, 0x0003a000, 0x00244700, 0x0003a100,
+	0x00245100, 0x00005d00, 0x00245b00, 0x0003a300, 0x00246400, 0x0003a400, 0x00246e00, 0x0003a500,
+	0x00247800, 0x0003a600, 0x00248200, 0x0003a700, 0x00248b00, 0x0003a800, 0x00249500, 0x0003a900,
+	0x00249f00, 0x0003aa00, 0x0024a900, 0x0003ab00, 0x0024b300, 0x00005e00, 0x0024bc00, 0x0003ad00,
+	0x0024c600, 0x0003ae00, 0x0024d000, 0x0003af00, 0x0024da00, 0x0003b000, 0x0024e300, 0x0003b100,
+	0x0024ed00, 0x0003b200, 0x0024f700, 0x0003b300, 0x00250100, 0x00250600, 0x0003b400, 0x00250f00,
+	0x0003b500, 0x00251900, 0x00005f00, 0x00252300, 0x0003b700, 0x00252d00, 0x0003b800, 0x00253600,
+	0x0003b900, 0x00254000, 0x0003ba00, 0x00254a00, 0x0003bb00, 0x00255400, 0x0003bc00, 0x00255d00,
+	0x0003bd00, 0x00256700, 0x0003be00, 0x00257100, 0x0003bf00, 0x00257b00, 0x00006000, 0x00258400,
+	0x0003c100, 0x00258e00, 0x0003c200, 0x00259800, 0x0003c300, 0x0025a200, 0x0003c400, 0x0025ac00,
+	0x0003c500, 0x0025b500, 0x0003c600, 0x0025bf00, 0x0003c700, 0x0025c900, 0x0003c800, 0x0025d300,
+	0x0025d800, 0x0003c900, 0x0025e100, 0x00006100, 0x0025eb00, 0x0003cb00, 0x0025f500, 0x0003cc00,
+	0x0025ff00, 0x0003cd00, 0x00260800, 0x0003ce00, 0x00261200, 0x0003cf00, 0x00261c00, 0x0003d000,
+	0x00262600, 0x0003d100, 0x00262f00, 0x0003d200, 0x00263900, 0x0003d300, 0x00264300, 0x00006200,
+	0x00264d00, 0x0003d500, 0x00265600, 0x0003d600, 0x00266000, 0x0003d700, 0x00266a00, 0x0003d800,
+	0x00267400, 0x0003d900, 0x00267e00, 0x0003da00, 0x00268700, 0x0003db00, 0x00269100, 0x0003dc00,
+	0x00269b00, 0x0003dd00, 0x0026a500, 0x0026a900, 0x00006300, 0x0026b300, 0x0003df00, 0x0026bd00,
+	0x0003e000, 0x0026c700, 0x0003e100, 0x0026d100, 0x0003e200, 0x0026da00, 0x0003e300, 0x0026e400,
+	0x0003e400, 0x0026ee00, 0x0003e500, 0x0026f800, 0x0003e600, 0x00270100, 0x0003e700, 0x00270b00,
+	0x00000101, 0x0003e901, 0x0003ea01, 0x0003eb01, 0x0003ec01, 0x0003ed01, 0x0003ee01, 0x0003ef01,
+	0x0003f001, 0x0003f101, 0x00006501, 0x0003f301, 0x0003f401, 0x0003f501, 0x0003f601, 0x0003f701,
+	0x0003f801, 0x0003f901, 0x0003fa01, 0x0003fb01, 0x00006601, 0x0027dd01, 0x0003fd01, 0x0003fe01,
+	0x0003ff01, 0x00040001, 0x00040101, 0x00040201, 0x00040301, 0x00040401, 0x00040501, 0x00006701,
+	0x00040701, 0x00040801, 0x00040901, 0x00040a01, 0x00040b01, 0x00040c01, 0x00040d01, 0x00040e01,
+	0x00040f01, 0x00006801, 0x00041101, 0x00041201, 0x00041301, 0x00041401, 0x00041501, 0x00041601,
+	0x00041701, 0x00041801, 0x00041901, 0x00006901, 0x00041b01, 0x00041c01, 0x00041d01, 0x00041e01,
+	0x00041f01, 0x00042001, 0x00042101, 0x00042201, 0x00042301, 0x00006a01, 0x00042501, 0x00042601,
+	0x00298101, 0x00042701, 0x00042801, 0x00042901, 0x00042a01, 0x00042b01, 0x00042c01, 0x00042d01,
+	0x00006b01, 0x00042f01, 0x00043001, 0x00043101, 0x00043201, 0x00043301, 0x00043401, 0x00043501,
+	0x00043601, 0x00043701, 0x00006c01, 0x00043901, 0x00043a01, 0x00043b01, 0x00043c01, 0x00043d01,
+	0x00043e01, 0x00043f01, 0x00044001, 0x00044101, 0x00006d01, 0x00044301, 0x00044401, 0x00044501,
+	0x00044601, 0x00044701, 0x00044801, 0x00044901, 0x00044a01, 0x00044b01, 0x00000b01, 0x00044d01,
+	0x00044e01, 0x00044f01, 0x00045001, 0x002b2501, 0x00045101, 0x00045201, 0x00045301, 0x00045401,
+	0x00045501, 0x00006f01, 0x00045701, 0x00045801, 0x00045901, 0x00045a01, 0x00045b01, 0x00045c01,
+	0x00045d01, 0x00045e01, 0x00045f01, 0x00007001, 0x00046101, 0x00046201, 0x00046301, 0x00046401,
+	0x00046501, 0x00046601, 0x00046701, 0x00046801, 0x00046901, 0x00007101, 0x00046b01, 0x00046c01,
+	0x00046d01, 0x00046e01, 0x00046f01, 0x00047001, 0x00047101, 0x00047201, 0x00047301, 0x00007201,
+	0x00047501, 0x00047601, 0x00047701, 0x00047801, 0x00047901, 0x002cbf01, 0x00047a01, 0x00047b01,
+	0x00047c01, 0x00047d01, 0x00007301, 0x00047f01, 0x00048001, 0x00048101, 0x00048201, 0x00048301,
+	0x00048401, 0x00048501, 0x00048601, 0x00048701, 0x00007401, 0x00048901, 0x00048a01, 0x00048b01,
+	0x00048c01, 0x00048d01, 0x00048e01, 0x00048f01, 0x00049001, 0x00049101, 0x00007501, 0x00049301,
+	0x00049401, 0x00049501, 0x00049601, 0x00049701, 0x00049801, 0x00049901, 0x00049a01, 0x00049b01,
+	0x00007601, 0x00049d01, 0x00049e01, 0x00049f01, 0x0004a001, 0x0004a101, 0x0004a201, 0x0004a301,
+	0x002e6301, 0x0004a401, 0x0004a501, 0x00007701, 0x0004a701, 0x0004a801, 0x0004a901, 0x0004aa01,
+	0x0004ab01, 0x0004ac01, 0x0004ad01, 0x0004ae01, 0x0004af01, 0x00000c01, 0x0004b101, 0x0004b201,
+	0x0004b301, 0x0004b401, 0x0004b501, 0x0004b601, 0x0004b701, 0x0004b801, 0x0004b901, 0x00007901,
+	0x0004bb01, 0x0004bc01, 0x0004bd01, 0x0004be01, 0x0004bf01, 0x0004c001, 0x0004c101, 0x0004c201,
+	0x0004c301, 0x00007a01, 0x0004c501, 0x0004c601, 0x0004c701, 0x0004c801, 0x0004c901, 0x0004ca01,
+	0x0004cb01, 0x0004cc01, 0x0004cd01, 0x00300701, 0x00007b01, 0x0004cf01, 0x0004d001, 0x0004d101,
+	0x0004d201, 0x0004d301, 0x0004d401, 0x0004d501, 0x0004d601, 0x0004d701, 0x00007c01, 0x0004d901,
+	0x0004da01, 0x0004db01, 0x0004dc01, 0x0004dd01, 0x0004de01, 0x0004df01, 0x0004e001, 0x0004e101,
+	0x00007d01, 0x0004e301, 0x0004e401, 0x0004e501, 0x0004e601, 0x0004e701, 0x0004e801, 0x0004e901,
+	0x0004ea01, 0x0004eb01, 0x00007e01, 0x0004ed01, 0x0004ee01, 0x0004ef01, 0x0004f001, 0x0004f101,
+	0x0004f201, 0x0004f301, 0x0004f401, 0x0004f501, 0x00007f01, 0x0031a101, 0x0004f701, 0x0004f801,
+	0x0004f901, 0x0004fa01, 0x0004fb01, 0x0004fc01, 0x0004fd01, 0x0004fe01, 0x0004ff01, 0x00008001,
+	0x00050101, 0x00050201, 0x00050301, 0x00050401, 0x00050501, 0x00050601, 0x00050701, 0x00050801,
+	0x00050901, 0x00008101, 0x00050b01, 0x00050c01, 0x00050d01, 0x00050e01, 0x00050f01, 0x00051001,
+	0x00051101, 0x00051201, 0x00051301, 0x00000d01, 0x00051501, 0x00051601, 0x00051701, 0x00051801,
+	0x00051901, 0x00051a01, 0x00051b01, 0x00051c01, 0x00051d01, 0x00008301, 0x00051f01, 0x00052001,
+	0x00334501, 0x00052101, 0x00052201, 0x00052301, 0x00052401, 0x00052501, 0x00052601, 0x00052701,
+	0x00008401, 0x00052901, 0x00052a01, 0x00052b01, 0x00052c01, 0x00052d01, 0x00052e01, 0x00052f01,
+	0x00053001, 0x00053101, 0x00008501, 0x00053301, 0x00053401, 0x00053501, 0x00053601, 0x00053701,
+	0x00053801, 0x00053901, 0x00053a01, 0x00053b01, 0x00008601, 0x00053d01, 0x00053e01, 0x00053f01,
+	0x00054001, 0x00054101, 0x00054201, 0x00054301, 0x00054401, 0x00054501, 0x00008701, 0x00054701,
+	0x00054801, 0x00054901, 0x00054a01, 0x0034e901, 0x00054b01, 0x00054c01, 0x00054d01, 0x00054e01,
+	0x00054f01, 0x00008801, 0x00055101, 0x00055201, 0x00055301, 0x00055401, 0x00055501, 0x00055601,
+	0x00055701, 0x00055801, 0x00055901, 0x00008901, 0x00055b01, 0x00055c01, 0x00055d01, 0x00055e01,
+	0x00055f01, 0x00056001, 0x00056101, 0x00056201, 0x00056301, 0x00008a01, 0x00056501, 0x00056601,
+	0x00056701, 0x00056801, 0x00056901, 0x00056a01, 0x00056b01, 0x00056c01, 0x00056d01, 0x00008b01,
+	0x00056f01, 0x00057001, 0x00057101, 0x00057201, 0x00057301, 0x00368301, 0x00057401, 0x00057501,
+	0x00057601, 0x00057701, 0x00000e01, 0x00057901, 0x00057a01, 0x00057b01, 0x00057c01, 0x00057d01,
+	0x00057e01, 0x00057f01, 0x00058001, 0x00058101, 0x00008d01, 0x00058301, 0x00058401, 0x00058501,
+	0x00058601, 0x00058701, 0x00058801, 0x00058901, 0x00058a01, 0x00058b01, 0x00008e01, 0x00058d01,
+	0x00058e01, 0x00058f01, 0x00059001, 0x00059101, 0x00059201, 0x00059301, 0x00059401, 0x00059501,
+	0x00008f01, 0x00059701, 0x00059801, 0x00059901, 0x00059a01, 0x00059b01, 0x00059c01, 0x00059d01,
+	0x00382701, 0x00059e01, 0x00059f01, 0x00009001, 0x0005a101, 0x0005a201, 0x0005a301, 0x0005a401,
+	0x0005a501, 0x0005a601, 0x0005a701, 0x0005a801, 0x0005a901, 0x00009101, 0x0005ab01, 0x0005ac01,
+	0x0005ad01, 0x0005ae01, 0x0005af01, 0x0005b001, 0x0005b101, 0x0005b201, 0x0005b301, 0x00009201,
+	0x0005b501, 0x0005b601, 0x0005b701, 0x0005b801, 0x0005b901, 0x0005ba01, 0x0005bb01, 0x0005bc01,
+	0x0005bd01, 0x00009301, 0x0005bf01, 0x0005c001, 0x0005c101, 0x0005c201, 0x0005c301, 0x0005c401,
+	0x0005c501, 0x0005c601, 0x0005c701, 0x0039cb01, 0x00009401, 0x0005c901, 0x0005ca01, 0x0005cb01,
+	0x0005cc01, 0x0005cd01, 0x0005ce01, 0x0005cf01, 0x0005d001, 0x0005d101, 0x00009501, 0x0005d301,
+	0x0005d401, 0x0005d501, 0x0005d601, 0x0005d701, 0x0005d801, 0x0005d901, 0x0005da01, 0x0005db01,
+	0x00000f01, 0x0005dd01, 0x0005de01, 0x0005df01, 0x0005e001, 0x0005e101, 0x0005e201, 0x0005e301,
+	0x0005e401, 0x0005e501, 0x00009701, 0x0005e701, 0x0005e801, 0x0005e901, 0x0005ea01, 0x0005eb01,
+	0x0005ec01, 0x0005ed01, 0x0005ee01, 0x0005ef01, 0x00009801, 0x003b6501, 0x0005f101, 0x0005f201,
+	0x0005f301, 0x0005f401, 0x0005f501, 0x0005f601, 0x0005f701, 0x0005f801, 0x0005f901, 0x00009901,
+	0x0005fb01, 0x0005fc01, 0x0005fd01, 0x0005fe01, 0x0005ff01, 0x00060001, 0x00060101, 0x00060201,
+	0x00060301, 0x00009a01, 0x00060501, 0x00060601, 0x00060701, 0x00060801, 0x00060901, 0x00060a01,
+	0x00060b01, 0x00060c01, 0x00060d01, 0x00009b01, 0x00060f01, 0x00061001, 0x00061101, 0x00061201,
+	0x00061301, 0x00061401, 0x00061501, 0x00061601, 0x00061701, 0x00009c01, 0x00061901, 0x00061a01,
+	0x003d0901, 0x00061b01, 0x00061c01, 0x00061d01, 0x00061e01, 0x00061f01, 0x00062001, 0x00062101,
+	0x00009d01, 0x00062301, 0x00062401, 0x00062501, 0x00062601, 0x00062701, 0x00062801, 0x00062901,
+	0x00062a01, 0x00062b01, 0x00009e01, 0x00062d01, 0x00062e01, 0x00062f01, 0x00063001, 0x00063101,
+	0x00063201, 0x00063301, 0x00063401, 0x00063501, 0x00009f01, 0x00063701, 0x00063801, 0x00063901,
+	0x00063a01, 0x00063b01, 0x00063c01, 0x00063d01, 0x00063e01, 0x00063f01, 0x00001001, 0x00064101,
+	0x00064201, 0x00064301, 0x00064401, 0x003ead01, 0x00064501, 0x00064601, 0x00064701, 0x00064801,
+	0x00064901, 0x0000a101, 0x00064b01, 0x00064c01, 0x00064d01, 0x00064e01, 0x00064f01, 0x00065001,
+	0x00065101, 0x00065201, 0x00065301, 0x0000a201, 0x00065501, 0x00065601, 0x00065701, 0x00065801,
+	0x00065901, 0x00065a01, 0x00065b01, 0x00065c01, 0x00065d01, 0x0000a301, 0x00065f01, 0x00066001,
+	0x00066101, 0x00066201, 0x00066301, 0x00066401, 0x00066501, 0x00066601, 0x00066701, 0x0000a401,
+	0x00066901, 0x00066a01, 0x00066b01, 0x00066c01, 0x00066d01, 0x00404701, 0x00066e01, 0x00066f01,
+	0x00067001, 0x00067101, 0x0000a501, 0x00067301, 0x00067401, 0x00067501, 0x00067601, 0x00067701,
+	0x00067801, 0x00067901, 0x00067a01, 0x00067b01, 0x0000a601, 0x00067d01, 0x00067e01, 0x00067f01,
+	0x00068001, 0x00068101, 0x00068201, 0x00068301, 0x00068401, 0x00068501, 0x0000a701, 0x00068701,
+	0x00068801, 0x00068901, 0x00068a01, 0x00068b01, 0x00068c01, 0x00068d01, 0x00068e01, 0x00068f01,
+	0x0000a801, 0x00069101, 0x00069201, 0x00069301, 0x00069401, 0x00069501, 0x00069601, 0x00069701,
+	0x0041eb01, 0x00069801, 0x00069901, 0x0000a901, 0x00069b01, 0x00069c01, 0x00069d01, 0x00069e01,
+	0x00069f01, 0x0006a001, 0x0006a101, 0x0006a201, 0x0006a301, 0x00001101, 0x0006a501, 0x0006a601,
+	0x0006a701, 0x0006a801, 0x0006a901, 0x0006aa01, 0x0006ab01, 0x0006ac01, 0x0006ad01, 0x0000ab01,
+	0x0006af01, 0x0006b001, 0x0006b101, 0x0006b201, 0x0006b301, 0x0006b401, 0x0006b501, 0x0006b601,
+	0x0006b701, 0x0000ac01, 0x0006b901, 0x0006ba01, 0x0006bb01, 0x0006bc01, 0x0006bd01, 0x0006be01,
+	0x0006bf01, 0x0006c001, 0x0006c101, 0x00438f01, 0x0000ad01, 0x0006c301, 0x0006c401, 0x0006c501,
+	0x0006c601, 0x0006c701, 0x0006c801, 0x0006c901, 0x0006ca01, 0x0006cb01, 0x0000ae01, 0x0006cd01,
+	0x0006ce01, 0x0006cf01, 0x0006d001, 0x0006d101, 0x0006d201, 0x0006d301, 0x0006d401, 0x0006d501,
+	0x0000af01, 0x0006d701, 0x0006d801, 0x0006d901, 0x0006da01, 0x0006db01, 0x0006dc01, 0x0006dd01,
+	0x0006de01, 0x0006df01, 0x0000b001, 0x0006e101, 0x0006e201, 0x0006e301, 0x0006e401, 0x0006e501,
+	0x0006e601, 0x0006e701, 0x0006e801, 0x0006e901, 0x0000b101, 0x00452901, 0x0006eb01, 0x0006ec01,
+	0x0006ed01, 0x0006ee01, 0x0006ef01, 0x0006f001, 0x0006f101, 0x0006f201, 0x0006f301, 0x0000b201,
+	0x0006f501, 0x0006f601, 0x0006f701, 0x0006f801, 0x0006f901, 0x0006fa01, 0x0006fb01, 0x0006fc01,
+	0x0006fd01, 0x0000b301, 0x0006ff01, 0x00070001, 0x00070101, 0x00070201, 0x00070301, 0x00070401,
+	0x00070501, 0x00070601, 0x00070701, 0x00001201, 0x00070901, 0x00070a01, 0x00070b01, 0x00070c01,
+	0x00070d01, 0x00070e01, 0x00070f01, 0x00071001, 0x00071101, 0x0000b501, 0x00071301, 0x00071401,
+	0x0046cd01, 0x00071501, 0x00071601, 0x00071701, 0x00071801, 0x00071901, 0x00071a01, 0x00071b01,
+	0x0000b601, 0x00071d01, 0x00071e01, 0x00071f01, 0x00072001, 0x00072101, 0x00072201, 0x00072301,
+	0x00072401, 0x00072501, 0x0000b701, 0x00072701, 0x00072801, 0x00072901, 0x00072a01, 0x00072b01,
+	0x00072c01, 0x00072d01, 0x00072e01, 0x00072f01, 0x0000b801, 0x00073101, 0x00073201, 0x00073301,
+	0x00073401, 0x00073501, 0x00073601, 0x00073701, 0x00073801, 0x00073901, 0x0000b901, 0x00073b01,
+	0x00073c01, 0x00073d01, 0x00073e01, 0x00487101, 0x00073f01, 0x00074001, 0x00074101, 0x00074201,
+	0x00074301, 0x0000ba01, 0x00074501, 0x00074601, 0x00074701, 0x00074801, 0x00074901, 0x00074a01,
+	0x00074b01, 0x00074c01, 0x00074d01, 0x0000bb01, 0x00074f01, 0x00075001, 0x00075101, 0x00075201,
+	0x00075301, 0x00075401, 0x00075501, 0x00075601, 0x00075701, 0x0000bc01, 0x00075901, 0x00075a01,
+	0x00075b01, 0x00075c01, 0x00075d01, 0x00075e01, 0x00075f01, 0x00076001, 0x00076101, 0x0000bd01,
+	0x00076301, 0x00076401, 0x00076501, 0x00076601, 0x00076701, 0x004a0b01, 0x00076801, 0x00076901,
+	0x00076a01, 0x00076b01, 0x00001301, 0x00076d01, 0x00076e01, 0x00076f01, 0x00077001, 0x00077101,
+	0x00077201, 0x00077301, 0x00077401, 0x00077501, 0x0000bf01, 0x00077701, 0x00077801, 0x00077901,
+	0x00077a01, 0x00077b01, 0x00077c01, 0x00077d01, 0x00077e01, 0x00077f01, 0x0000c001, 0x00078101,
+	0x00078201, 0x00078301, 0x00078401, 0x00078501, 0x00078601, 0x00078701, 0x00078801, 0x00078901,
+	0x0000c101, 0x00078b01, 0x00078c01, 0x00078d01, 0x00078e01, 0x00078f01, 0x00079001, 0x00079101,
+	0x004baf01, 0x00079201, 0x00079301, 0x0000c201, 0x00079501, 0x00079601, 0x00079701, 0x00079801,
+	0x00079901, 0x00079a01, 0x00079b01, 0x00079c01, 0x00079d01, 0x0000c301, 0x00079f01, 0x0007a001,
+	0x0007a101, 0x0007a201, 0x0007a301, 0x0007a401, 0x0007a501, 0x0007a601, 0x0007a701, 0x0000c401,
+	0x0007a901, 0x0007aa01, 0x0007ab01, 0x0007ac01, 0x0007ad01, 0x0007ae01, 0x0007af01, 0x0007b001,
+	0x0007b101, 0x0000c501, 0x0007b301, 0x0007b401, 0x0007b501, 0x0007b601, 0x0007b701, 0x0007b801,
+	0x0007b901, 0x0007ba01, 0x0007bb01, 0x004d5301, 0x0000c601, 0x0007bd01, 0x0007be01, 0x0007bf01,
+	0x0007c001, 0x0007c101, 0x0007c201, 0x0007c301, 0x0007c401, 0x0007c501, 0x0000c701, 0x0007c701,
+	0x0007c801, 0x0007c901, 0x0007ca01, 0x0007cb01, 0x0007cc01, 0x0007cd01, 0x0007ce01, 0x0007cf01,
+	0x00000201, 0x0007d201, 0x0007d401, 0x0007d601, 0x0007d801, 0x0000c901, 0x0007dc01, 0x0007de01,
+	0x0007e001, 0x0007e201, 0x0000ca01, 0x0007e501, 0x0007e701, 0x0007e901, 0x0007eb01, 0x0000cb01,
+	0x0007ef01, 0x0007f101, 0x0007f301, 0x0007f501, 0x0000cc01, 0x0007f901, 0x0007fb01, 0x0007fd01,
+	0x0007ff01, 0x00080101, 0x0000cd01, 0x00080501, 0x00080701, 0x00080901, 0x00080b01, 0x0000ce01,
+	0x00080e01, 0x00081001, 0x00081201, 0x00081401, 0x0000cf01, 0x00081801, 0x00081a01, 0x00081c01,
+	0x00081e01, 0x0000d001, 0x00082201, 0x00082401, 0x00082601, 0x00082801, 0x0000d101, 0x00082c01,
+	0x00082e01, 0x00083001, 0x00083201, 0x00001501, 0x00083601, 0x00083801, 0x00083901, 0x00083b01,
+	0x0000d301, 0x00083f01, 0x00084101, 0x00084301, 0x00084501, 0x0000d401, 0x00084901, 0x00084b01,
+	0x00084d01, 0x00084f01, 0x00085101, 0x0000d501, 0x00085501, 0x00085701, 0x00085901, 0x00085b01,
+	0x0000d601, 0x00085f01, 0x00086101, 0x00086201, 0x00086401, 0x0000d701, 0x00086801, 0x00086a01,
+	0x00086c01, 0x00086e01, 0x0000d801, 0x00087201, 0x00087401, 0x00087601, 0x00087801, 0x0000d901,
+	0x00087c01, 0x00087e01, 0x00088001, 0x00088201, 0x0000da01, 0x00088601, 0x00088801, 0x00088a01,
+	0x00088c01, 0x0000db01, 0x00088f01, 0x00089101, 0x00089301, 0x00089501, 0x00001601, 0x00089901,
+	0x00089b01, 0x00089d01, 0x00089f01, 0x0008a101, 0x0000dd01, 0x0008a501, 0x0008a701, 0x0008a901,
+	0x0008ab01, 0x0000de01, 0x0008af01, 0x0008b101, 0x0008b301, 0x0008b501, 0x0000df01, 0x0008b801,
+	0x0008ba01, 0x0008bc01, 0x0008be01, 0x0000e001, 0x0008c201, 0x0008c401, 0x0008c601, 0x0008c801,
+	0x0000e101, 0x0008cc01, 0x0008ce01, 0x0008d001, 0x0008d201, 0x0000e201, 0x0008d601, 0x0008d801,
+	0x0008da01, 0x0008dc01, 0x0000e301, 0x0008df01, 0x0008e101, 0x0008e301, 0x0008e501, 0x0000e401,
+	0x0008e901, 0x0008eb01, 0x0008ed01, 0x0008ef01, 0x0000e501, 0x0008f301, 0x0008f501, 0x0008f701,
+	0x0008f901, 0x0008fb01, 0x00001701, 0x0008ff01, 0x00090101, 0x00090301, 0x00090501, 0x0000e701,
+	0x00090801, 0x00090a01, 0x00090c01, 0x00090e01, 0x0000e801, 0x00091201, 0x00091401, 0x00091601,
+	0x00091801, 0x0000e901, 0x00091c01, 0x00091e01, 0x00092001, 0x00092201, 0x0000ea01, 0x00092601,
+	0x00092801, 0x00092a01, 0x00092c01, 0x0000eb01, 0x00093001, 0x00093201, 0x00093301, 0x00093501,
+	0x0000ec01, 0x00093901, 0x00093b01, 0x00093d01, 0x00093f01, 0x0000ed01, 0x00094301, 0x00094501,
+	0x00094701, 0x00094901, 0x00094b01, 0x0000ee01, 0x00094f01, 0x00095101, 0x00095301, 0x00095501,
+	0x0000ef01, 0x00095901, 0x00095b01, 0x00095c01, 0x00095e01, 0x00001801, 0x00096201, 0x00096401,
+	0x00096601, 0x00096801, 0x0000f101, 0x00096c01, 0x00096e01, 0x00097001, 0x00097201, 0x0000f201,
+	0x00097601, 0x00097801, 0x00097a01, 0x00097c01, 0x0000f301, 0x00098001, 0x00098201, 0x00098401,
+	0x00098601, 0x0000f401, 0x00098901, 0x00098b01, 0x00098d01, 0x00098f01, 0x0000f501, 0x00099301,
+	0x00099501, 0x00099701, 0x00099901, 0x00099b01, 0x0000f601, 0x00099f01, 0x0009a101, 0x0009a301,
+	0x0009a501, 0x0000f701, 0x0009a901, 0x0009ab01, 0x0009ad01, 0x0009af01, 0x0000f801, 0x0009b201,
+	0x0009b401, 0x0009b601, 0x0009b801, 0x0000f901, 0x0009bc01, 0x0009be01, 0x0009c001, 0x0009c201,
+	0x00001901, 0x0009c601, 0x0009c801, 0x0009ca01, 0x0009cc01, 0x0000fb01, 0x0009d001, 0x0009d201,
+	0x0009d401, 0x0009d601, 0x0000fc01, 0x0009d901, 0x0009db01, 0x0009dd01, 0x0009df01, 0x0000fd01,
+	0x0009e301, 0x0009e501, 0x0009e701, 0x0009e901, 0x0000fe01, 0x0009ed01, 0x0009ef01, 0x0009f101,
+	0x0009f301, 0x0009f501, 0x0000ff01, 0x0009f901, 0x0009fb01, 0x0009fd01, 0x0009ff01, 0x00010001,
+	0x000a0201, 0x000a0401, 0x000a0601, 0x000a0801, 0x00010101, 0x000a0c01, 0x000a0e01, 0x000a1001,
+	0x000a1201, 0x00010201, 0x000a1601, 0x000a1801, 0x000a1a01, 0x000a1c01, 0x00010301, 0x000a2001,
+	0x000a2201, 0x000a2401, 0x000a2601, 0x00001a01, 0x000a2a01, 0x000a2c01, 0x000a2d01, 0x000a2f01,
+	0x00010501, 0x000a3301, 0x000a3501, 0x000a3701, 0x000a3901, 0x00010601, 0x000a3d01, 0x000a3f01,
+	0x000a4101, 0x000a4301, 0x000a4501, 0x00010701, 0x000a4901, 0x000a4b01, 0x000a4d01, 0x000a4f01,
+	0x00010801, 0x000a5301, 0x000a5501, 0x000a5601, 0x000a5801, 0x00010901, 0x000a5c01, 0x000a5e01,
+	0x000a6001, 0x000a6201, 0x00010a01, 0x000a6601, 0x000a6801, 0x000a6a01, 0x000a6c01, 0x00010b01,
+	0x000a7001, 0x000a7201, 0x000a7401, 0x000a7601, 0x00010c01, 0x000a7a01, 0x000a7c01, 0x000a7e01,
+	0x000a8001, 0x00010d01, 0x000a8301, 0x000a8501, 0x000a8701, 0x000a8901, 0x00001b01, 0x000a8d01,
+	0x000a8f01, 0x000a9101, 0x000a9301, 0x000a9501, 0x00010f01, 0x000a9901, 0x000a9b01, 0x000a9d01,
+	0x000a9f01, 0x00011001, 0x000aa301, 0x000aa501, 0x000aa701, 0x000aa901, 0x00011101, 0x000aac01,
+	0x000aae01, 0x000ab001, 0x000ab201, 0x00011201, 0x000ab601, 0x000ab801, 0x000aba01, 0x000abc01,
+	0x00011301, 0x000ac001, 0x000ac201, 0x000ac401, 0x000ac601, 0x00011401, 0x000aca01, 0x000acc01,
+	0x000ace01, 0x000ad001, 0x00011501, 0x000ad301, 0x000ad501, 0x000ad701, 0x000ad901, 0x00011601,
+	0x000add01, 0x000adf01, 0x000ae101, 0x000ae301, 0x00011701, 0x000ae701, 0x000ae901, 0x000aeb01,
+	0x000aed01, 0x000aef01, 0x00001c01, 0x000af301, 0x000af501, 0x000af701, 0x000af901, 0x00011901,
+	0x000afc01, 0x000afe01, 0x000b0001, 0x000b0201, 0x00011a01, 0x000b0601, 0x000b0801, 0x000b0a01,
+	0x000b0c01, 0x00011b01, 0x000b1001, 0x000b1201, 0x000b1401, 0x000b1601, 0x00011c01, 0x000b1a01,
+	0x000b1c01, 0x000b1e01, 0x000b2001, 0x00011d01, 0x000b2401, 0x000b2601, 0x000b2701, 0x000b2901,
+	0x00011e01, 0x000b2d01, 0x000b2f01, 0x000b3101, 0x000b3301, 0x00011f01, 0x000b3701, 0x000b3901,
+	0x000b3b01, 0x000b3d01, 0x000b3f01, 0x00012001, 0x000b4301, 0x000b4501, 0x000b4701, 0x000b4901,
+	0x00012101, 0x000b4d01, 0x000b4f01, 0x000b5001, 0x000b5201, 0x00001d01, 0x000b5601, 0x000b5801,
+	0x000b5a01, 0x000b5c01, 0x00012301, 0x000b6001, 0x000b6201, 0x000b6401, 0x000b6601, 0x00012401,
+	0x000b6a01, 0x000b6c01, 0x000b6e01, 0x000b7001, 0x00012501, 0x000b7401, 0x000b7601, 0x000b7801,
+	0x000b7a01, 0x00012601, 0x000b7d01, 0x000b7f01, 0x000b8101, 0x000b8301, 0x00012701, 0x000b8701,
+	0x000b8901, 0x000b8b01, 0x000b8d01, 0x000b8f01, 0x00012801, 0x000b9301, 0x000b9501, 0x000b9701,
+	0x000b9901, 0x00012901, 0x000b9d01, 0x000b9f01, 0x000ba101, 0x000ba301, 0x00012a01, 0x000ba601,
+	0x000ba801, 0x000baa01, 0x000bac01, 0x00012b01, 0x000bb001, 0x000bb201, 0x000bb401, 0x000bb601,
+	0x00000301, 0x000bba01, 0x000bbc01, 0x000bbe01, 0x000bc001, 0x00012d01, 0x000bc401, 0x000bc601,
+	0x000bc801, 0x000bca01, 0x00012e01, 0x000bcd01, 0x000bcf01, 0x000bd101, 0x000bd301, 0x00012f01,
+	0x000bd701, 0x000bd901, 0x000bdb01, 0x000bdd01, 0x00013001, 0x000be101, 0x000be301, 0x000be501,
+	0x000be701, 0x000be901, 0x00013101, 0x000bed01, 0x000bef01, 0x000bf101, 0x000bf301, 0x00013201,
+	0x000bf601, 0x000bf801, 0x000bfa01, 0x000bfc01, 0x00013301, 0x000c0001, 0x000c0201, 0x000c0401,
+	0x000c0601, 0x00013401, 0x000c0a01, 0x000c0c01, 0x000c0e01, 0x000c1001, 0x00013501, 0x000c1401,
+	0x000c1601, 0x000c1801, 0x000c1a01, 0x00001f01, 0x000c1e01, 0x000c2001, 0x000c2101, 0x000c2301,
+	0x00013701, 0x000c2701, 0x000c2901, 0x000c2b01, 0x000c2d01, 0x00013801, 0x000c3101, 0x000c3301,
+	0x000c3501, 0x000c3701, 0x000c3901, 0x00013901, 0x000c3d01, 0x000c3f01, 0x000c4101, 0x000c4301,
+	0x00013a01, 0x000c4701, 0x000c4901, 0x000c4a01, 0x000c4c01, 0x00013b01, 0x000c5001, 0x000c5201,
+	0x000c5401, 0x000c5601, 0x00013c01, 0x000c5a01, 0x000c5c01, 0x000c5e01, 0x000c6001, 0x00013d01,
+	0x000c6401, 0x000c6601, 0x000c6801, 0x000c6a01, 0x00013e01, 0x000c6e01, 0x000c7001, 0x000c7201,
+	0x000c7401, 0x00013f01, 0x000c7701, 0x000c7901, 0x000c7b01, 0x000c7d01, 0x00002001, 0x000c8101,
+	0x000c8301, 0x000c8501, 0x000c8701, 0x000c8901, 0x00014101, 0x000c8d01, 0x000c8f01, 0x000c9101,
+	0x000c9301, 0x00014201, 0x000c9701, 0x000c9901, 0x000c9b01, 0x000c9d01, 0x00014301, 0x000ca001,
+	0x000ca201, 0x000ca401, 0x000ca601, 0x00014401, 0x000caa01, 0x000cac01, 0x000cae01, 0x000cb001,
+	0x00014501, 0x000cb401, 0x000cb601, 0x000cb801, 0x000cba01, 0x00014601, 0x000cbe01, 0x000cc001,
+	0x000cc201, 0x000cc401, 0x00014701, 0x000cc701, 0x000cc901, 0x000ccb01, 0x000ccd01, 0x00014801,
+	0x000cd101, 0x000cd301, 0x000cd501, 0x000cd701, 0x00014901, 0x000cdb01, 0x000cdd01, 0x000cdf01,
+	0x000ce101, 0x000ce301, 0x00002101, 0x000ce701, 0x000ce901, 0x000ceb01, 0x000ced01, 0x00014b01,
+	0x000cf001, 0x000cf201, 0x000cf401, 0x000cf601, 0x00014c01, 0x000cfa01, 0x000cfc01, 0x000cfe01,
+	0x000d0001, 0x00014d01, 0x000d0401, 0x000d0601, 0x000d0801, 0x000d0a01, 0x00014e01, 0x000d0e01,
+	0x000d1001, 0x000d1201, 0x000d1401, 0x00014f01, 0x000d1801, 0x000d1a01, 0x000d1b01, 0x000d1d01,
+	0x00015001, 0x000d2101, 0x000d2301, 0x000d2501, 0x000d2701, 0x00015101, 0x000d2b01, 0x000d2d01,
+	0x000d2f01, 0x000d3101, 0x000d3301, 0x00015201, 0x000d3701, 0x000d3901, 0x000d3b01, 0x000d3d01,
+	0x00015301, 0x000d4101, 0x000d4301, 0x000d4401, 0x000d4601, 0x00002201, 0x000d4a01, 0x000d4c01,
+	0x000d4e01, 0x000d5001, 0x00015501, 0x000d5401, 0x000d5601, 0x000d5801, 0x000d5a01, 0x00015601,
+	0x000d5e01, 0x000d6001, 0x000d6201, 0x000d6401, 0x00015701, 0x000d6801, 0x000d6a01, 0x000d6c01,
+	0x000d6e01, 0x00015801, 0x000d7101, 0x000d7301, 0x000d7501, 0x000d7701, 0x00015901, 0x000d7b01,
+	0x000d7d01, 0x000d7f01, 0x000d8101, 0x000d8301, 0x00015a01, 0x000d8701, 0x000d8901, 0x000d8b01,
+	0x000d8d01, 0x00015b01, 0x000d9101, 0x000d9301, 0x000d9501, 0x000d9701, 0x00015c01, 0x000d9a01,
+	0x000d9c01, 0x000d9e01, 0x000da001, 0x00015d01, 0x000da401, 0x000da601, 0x000da801, 0x000daa01,
+	0x00002301, 0x000dae01, 0x000db001, 0x000db201, 0x000db401, 0x00015f01, 0x000db801, 0x000dba01,
+	0x000dbc01, 0x000dbe01, 0x00016001, 0x000dc101, 0x000dc301, 0x000dc501, 0x000dc701, 0x00016101,
+	0x000dcb01, 0x000dcd01, 0x000dcf01, 0x000dd101, 0x00016201, 0x000dd501, 0x000dd701, 0x000dd901,
+	0x000ddb01, 0x000ddd01, 0x00016301, 0x000de101, 0x000de301, 0x000de501, 0x000de701, 0x00016401,
+	0x000dea01, 0x000dec01, 0x000dee01, 0x000df001, 0x00016501, 0x000df401, 0x000df601, 0x000df801,
+	0x000dfa01, 0x00016601, 0x000dfe01, 0x000e0001, 0x000e0201, 0x000e0401, 0x00016701, 0x000e0801,
+	0x000e0a01, 0x000e0c01, 0x000e0e01, 0x00002401, 0x000e1201, 0x000e1401, 0x000e1501, 0x000e1701,
+	0x00016901, 0x000e1b01, 0x000e1d01, 0x000e1f01, 0x000e2101, 0x00016a01, 0x000e2501, 0x000e2701,
+	0x000e2901, 0x000e2b01, 0x000e2d01, 0x00016b01, 0x000e3101, 0x000e3301, 0x000e3501, 0x000e3701,
+	0x00016c01, 0x000e3b01, 0x000e3d01, 0x000e3e01, 0x000e4001, 0x00016d01, 0x000e4401, 0x000e4601,
+	0x000e4801, 0x000e4a01, 0x00016e01, 0x000e4e01, 0x000e5001, 0x000e5201, 0x000e5401, 0x00016f01,
+	0x000e5801, 0x000e5a01, 0x000e5c01, 0x000e5e01, 0x00017001, 0x000e6201, 0x000e6401, 0x000e6601,
+	0x000e6801, 0x00017101, 0x000e6b01, 0x000e6d01, 0x000e6f01, 0x000e7101, 0x00002501, 0x000e7501,
+	0x000e7701, 0x000e7901, 0x000e7b01, 0x000e7d01, 0x00017301, 0x000e8101, 0x000e8301, 0x000e8501,
+	0x000e8701, 0x00017401, 0x000e8b01, 0x000e8d01, 0x000e8f01, 0x000e9101, 0x00017501, 0x000e9401,
+	0x000e9601, 0x000e9801, 0x000e9a01, 0x00017601, 0x000e9e01, 0x000ea001, 0x000ea201, 0x000ea401,
+	0x00017701, 0x000ea801, 0x000eaa01, 0x000eac01, 0x000eae01, 0x00017801, 0x000eb201, 0x000eb401,
+	0x000eb601, 0x000eb801, 0x00017901, 0x000ebb01, 0x000ebd01, 0x000ebf01, 0x000ec101, 0x00017a01,
+	0x000ec501, 0x000ec701, 0x000ec901, 0x000ecb01, 0x00017b01, 0x000ecf01, 0x000ed101, 0x000ed301,
+	0x000ed501, 0x000ed701, 0x00002601, 0x000edb01, 0x000edd01, 0x000edf01, 0x000ee101, 0x00017d01,
+	0x000ee401, 0x000ee601, 0x000ee801, 0x000eea01, 0x00017e01, 0x000eee01, 0x000ef001, 0x000ef201,
+	0x000ef401, 0x00017f01, 0x000ef801, 0x000efa01, 0x000efc01, 0x000efe01, 0x00018001, 0x000f0201,
+	0x000f0401, 0x000f0601, 0x000f0801, 0x00018101, 0x000f0c01, 0x000f0e01, 0x000f0f01, 0x000f1101,
+	0x00018201, 0x000f1501, 0x000f1701, 0x000f1901, 0x000f1b01, 0x00018301, 0x000f1f01, 0x000f2101,
+	0x000f2301, 0x000f2501, 0x000f2701, 0x00018401, 0x000f2b01, 0x000f2d01, 0x000f2f01, 0x000f3101,
+	0x00018501, 0x000f3501, 0x000f3701, 0x000f3801, 0x000f3a01, 0x00002701, 0x000f3e01, 0x000f4001,
+	0x000f4201, 0x000f4401, 0x00018701, 0x000f4801, 0x000f4a01, 0x000f4c01, 0x000f4e01, 0x00018801,
+	0x000f5201, 0x000f5401, 0x000f5601, 0x000f5801, 0x00018901, 0x000f5c01, 0x000f5e01, 0x000f6001,
+	0x000f6201, 0x00018a01, 0x000f6501, 0x000f6701, 0x000f6901, 0x000f6b01, 0x00018b01, 0x000f6f01,
+	0x000f7101, 0x000f7301, 0x000f7501, 0x000f7701, 0x00018c01, 0x000f7b01, 0x000f7d01, 0x000f7f01,
+	0x000f8101, 0x00018d01, 0x000f8501, 0x000f8701, 0x000f8901, 0x000f8b01, 0x00018e01, 0x000f8e01,
+	0x000f9001, 0x000f9201, 0x000f9401, 0x00018f01, 0x000f9801, 0x000f9a01, 0x000f9c01, 0x000f9e01,
+	0x00000401, 0x000fa401, 0x000fa801, 0x00019101, 0x000fb001, 0x00019201, 0x000fb701, 0x000fbb01,
+	0x00019301, 0x000fc301, 0x00019401, 0x000fcb01, 0x000fcf01, 0x00019501, 0x000fd701, 0x00019601,
+	0x000fde01, 0x000fe201, 0x00019701, 0x000fea01, 0x00019801, 0x000ff201, 0x000ff601, 0x00019901,
+	0x000ffe01, 0x00100201, 0x00002901, 0x00100901, 0x00019b01, 0x00101101, 0x00101501, 0x00019c01,
+	0x00101d01, 0x00019d01, 0x00102501, 0x00102901, 0x00019e01, 0x00103101, 0x00019f01, 0x00103801,
+	0x00103c01, 0x0001a001, 0x00104401, 0x00104801, 0x0001a101, 0x00105001, 0x0001a201, 0x00105801,
+	0x00105c01, 0x0001a301, 0x00106301, 0x00002a01, 0x00106b01, 0x00106f01, 0x0001a501, 0x00107701,
+	0x0001a601, 0x00107f01, 0x00108301, 0x0001a701, 0x00108a01, 0x0001a801, 0x00109201, 0x00109601,
+	0x0001a901, 0x00109e01, 0x0010a201, 0x0001aa01, 0x0010aa01, 0x0001ab01, 0x0010b101, 0x0010b501,
+	0x0001ac01, 0x0010bd01, 0x0001ad01, 0x0010c501, 0x0010c901, 0x00002b01, 0x0010d101, 0x0001af01,
+	0x0010d801, 0x0010dc01, 0x0001b001, 0x0010e401, 0x0001b101, 0x0010ec01, 0x0010f001, 0x0001b201,
+	0x0010f801, 0x0010fc01, 0x0001b301, 0x00110301, 0x0001b401, 0x00110b01, 0x00110f01, 0x0001b501,
+	0x00111701, 0x0001b601, 0x00111f01, 0x00112301, 0x0001b701, 0x00112b01, 0x00002c01, 0x00113201,
+	0x00113601, 0x0001b901, 0x00113e01, 0x00114201, 0x0001ba01, 0x00114a01, 0x0001bb01, 0x00115201,
+	0x00115601, 0x0001bc01, 0x00115d01, 0x0001bd01, 0x00116501, 0x00116901, 0x0001be01, 0x00117101,
+	0x0001bf01, 0x00117901, 0x00117d01, 0x0001c001, 0x00118401, 0x0001c101, 0x00118c01, 0x00119001,
+	0x00002d01, 0x00119801, 0x00119c01, 0x0001c301, 0x0011a401, 0x0001c401, 0x0011ab01, 0x0011af01,
+	0x0001c501, 0x0011b701, 0x0001c601, 0x0011bf01, 0x0011c301, 0x0001c701, 0x0011cb01, 0x0001c801,
+	0x0011d201, 0x0011d601, 0x0001c901, 0x0011de01, 0x0001ca01, 0x0011e601, 0x0011ea01, 0x0001cb01,
+	0x0011f201, 0x0011f601, 0x00002e01, 0x0011fd01, 0x0001cd01, 0x00120501, 0x00120901, 0x0001ce01,
+	0x00121101, 0x0001cf01, 0x00121901, 0x00121d01, 0x0001d001, 0x00122501, 0x0001d101, 0x00122c01,
+	0x00123001, 0x0001d201, 0x00123801, 0x00123c01, 0x0001d301, 0x00124401, 0x0001d401, 0x00124c01,
+	0x00125001, 0x0001d501, 0x00125701, 0x00002f01, 0x00125f01, 0x00126301, 0x0001d701, 0x00126b01,
+	0x0001d801, 0x00127301, 0x00127701, 0x0001d901, 0x00127e01, 0x0001da01, 0x00128601, 0x00128a01,
+	0x0001db01, 0x00129201, 0x00129601, 0x0001dc01, 0x00129e01, 0x0001dd01, 0x0012a501, 0x0012a901,
+	0x0001de01, 0x0012b101, 0x0001df01, 0x0012b901, 0x0012bd01, 0x00003001, 0x0012c501, 0x0001e101,
+	0x0012cc01, 0x0012d001, 0x0001e201, 0x0012d801, 0x0001e301, 0x0012e001, 0x0012e401, 0x0001e401,
+	0x0012ec01, 0x0012f001, 0x0001e501, 0x0012f701, 0x0001e601, 0x0012ff01, 0x00130301, 0x0001e701,
+	0x00130b01, 0x0001e801, 0x00131301, 0x00131701, 0x0001e901, 0x00131f01, 0x00003101, 0x00132601,
+	0x00132a01, 0x0001eb01, 0x00133201, 0x00133601, 0x0001ec01, 0x00133e01, 0x0001ed01, 0x00134601,
+	0x00134a01, 0x0001ee01, 0x00135101, 0x0001ef01, 0x00135901, 0x00135d01, 0x0001f001, 0x00136501,
+	0x0001f101, 0x00136d01, 0x00137101, 0x0001f201, 0x00137801, 0x0001f301, 0x00138001, 0x00138401,
+	0x00000501, 0x00138c01, 0x00139001, 0x0001f501, 0x00139801, 0x0001f601, 0x00139f01, 0x0013a301,
+	0x0001f701, 0x0013ab01, 0x0001f801, 0x0013b301, 0x0013b701, 0x0001f901, 0x0013bf01, 0x0001fa01,
+	0x0013c601, 0x0013ca01, 0x0001fb01, 0x0013d201, 0x0001fc01, 0x0013da01, 0x0013de01, 0x0001fd01,
+	0x0013e601, 0x0013ea01, 0x00003301, 0x0013f101, 0x0001ff01, 0x0013f901, 0x0013fd01, 0x00020001,
+	0x00140501, 0x00020101, 0x00140d01, 0x00141101, 0x00020201, 0x00141901, 0x00020301, 0x00142001,
+	0x00142401, 0x00020401, 0x00142c01, 0x00143001, 0x00020501, 0x00143801, 0x00020601, 0x00144001,
+	0x00144401, 0x00020701, 0x00144b01, 0x00003401, 0x00145301, 0x00145701, 0x00020901, 0x00145f01,
+	0x00020a01, 0x00146701, 0x00146b01, 0x00020b01, 0x00147201, 0x00020c01, 0x00147a01, 0x00147e01,
+	0x00020d01, 0x00148601, 0x00148a01, 0x00020e01, 0x00149201, 0x00020f01, 0x00149901, 0x00149d01,
+	0x00021001, 0x0014a501, 0x00021101, 0x0014ad01, 0x0014b101, 0x00003501, 0x0014b901, 0x00021301,
+	0x0014c001, 0x0014c401, 0x00021401, 0x0014cc01, 0x00021501, 0x0014d401, 0x0014d801, 0x00021601,
+	0x0014e001, 0x0014e401, 0x00021701, 0x0014eb01, 0x00021801, 0x0014f301, 0x0014f701, 0x00021901,
+	0x0014ff01, 0x00021a01, 0x00150701, 0x00150b01, 0x00021b01, 0x00151301, 0x00003601, 0x00151a01,
+	0x00151e01, 0x00021d01, 0x00152601, 0x00152a01, 0x00021e01, 0x00153201, 0x00021f01, 0x00153a01,
+	0x00153e01, 0x00022001, 0x00154501, 0x00022101, 0x00154d01, 0x00155101, 0x00022201, 0x00155901,
+	0x00022301, 0x00156101, 0x00156501, 0x00022401, 0x00156c01, 0x00022501, 0x00157401, 0x00157801,
+	0x00003701, 0x00158001, 0x00158401, 0x00022701, 0x00158c01, 0x00022801, 0x00159301, 0x00159701,
+	0x00022901, 0x00159f01, 0x00022a01, 0x0015a701, 0x0015ab01, 0x00022b01, 0x0015b301, 0x00022c01,
+	0x0015ba01, 0x0015be01, 0x00022d01, 0x0015c601, 0x00022e01, 0x0015ce01, 0x0015d201, 0x00022f01,
+	0x0015da01, 0x0015de01, 0x00003801, 0x0015e501, 0x00023101, 0x0015ed01, 0x0015f101, 0x00023201,
+	0x0015f901, 0x00023301, 0x00160101, 0x00160501, 0x00023401, 0x00160d01, 0x00023501, 0x00161401,
+	0x00161801, 0x00023601, 0x00162001, 0x00162401, 0x00023701, 0x00162c01, 0x00023801, 0x00163401,
+	0x00163801, 0x00023901, 0x00163f01, 0x00003901, 0x00164701, 0x00164b01, 0x00023b01, 0x00165301,
+	0x00023c01, 0x00165b01, 0x00165f01, 0x00023d01, 0x00166601, 0x00023e01, 0x00166e01, 0x00167201,
+	0x00023f01, 0x00167a01, 0x00167e01, 0x00024001, 0x00168601, 0x00024101, 0x00168d01, 0x00169101,
+	0x00024201, 0x00169901, 0x00024301, 0x0016a101, 0x0016a501, 0x00003a01, 0x0016ad01, 0x00024501,
+	0x0016b401, 0x0016b801, 0x00024601, 0x0016c001, 0x00024701, 0x0016c801, 0x0016cc01, 0x00024801,
+	0x0016d401, 0x0016d801, 0x00024901, 0x0016df01, 0x00024a01, 0x0016e701, 0x0016eb01, 0x00024b01,
+	0x0016f301, 0x00024c01, 0x0016fb01, 0x0016ff01, 0x00024d01, 0x00170701, 0x00003b01, 0x00170e01,
+	0x00171201, 0x00024f01, 0x00171a01, 0x00171e01, 0x00025001, 0x00172601, 0x00025101, 0x00172e01,
+	0x00173201, 0x00025201, 0x00173901, 0x00025301, 0x00174101, 0x00174501, 0x00025401, 0x00174d01,
+	0x00025501, 0x00175501, 0x00175901, 0x00025601, 0x00176001, 0x00025701, 0x00176801, 0x00176c01,
+	0x00000601, 0x00177401, 0x00177801, 0x00025901, 0x00178001, 0x00025a01, 0x00178701, 0x00178b01,
+	0x00025b01, 0x00179301, 0x00025c01, 0x00179b01, 0x00179f01, 0x00025d01, 0x0017a701, 0x00025e01,
+	0x0017ae01, 0x0017b201, 0x00025f01, 0x0017ba01, 0x00026001, 0x0017c201, 0x0017c601, 0x00026101,
+	0x0017ce01, 0x0017d201, 0x00003d01, 0x0017d901, 0x00026301, 0x0017e101, 0x0017e501, 0x00026401,
+	0x0017ed01, 0x00026501, 0x0017f501, 0x0017f901, 0x00026601, 0x00180101, 0x00026701, 0x00180801,
+	0x00180c01, 0x00026801, 0x00181401, 0x00181801, 0x00026901, 0x00182001, 0x00026a01, 0x00182801,
+	0x00182c01, 0x00026b01, 0x00183301, 0x00003e01, 0x00183b01, 0x00183f01, 0x00026d01, 0x00184701,
+	0x00026e01, 0x00184f01, 0x00185301, 0x00026f01, 0x00185a01, 0x00027001, 0x00186201, 0x00186601,
+	0x00027101, 0x00186e01, 0x00187201, 0x00027201, 0x00187a01, 0x00027301, 0x00188101, 0x00188501,
+	0x00027401, 0x00188d01, 0x00027501, 0x00189501, 0x00189901, 0x00003f01, 0x0018a101, 0x00027701,
+	0x0018a801, 0x0018ac01, 0x00027801, 0x0018b401, 0x00027901, 0x0018bc01, 0x0018c001, 0x00027a01,
+	0x0018c801, 0x0018cc01, 0x00027b01, 0x0018d301, 0x00027c01, 0x0018db01, 0x0018df01, 0x00027d01,
+	0x0018e701, 0x00027e01, 0x0018ef01, 0x0018f301, 0x00027f01, 0x0018fb01, 0x00004001, 0x00190201,
+	0x00190601, 0x00028101, 0x00190e01, 0x00191201, 0x00028201, 0x00191a01, 0x00028301, 0x00192201,
+	0x00192601, 0x00028401, 0x00192d01, 0x00028501, 0x00193501, 0x00193901, 0x00028601, 0x00194101,
+	0x00028701, 0x00194901, 0x00194d01, 0x00028801, 0x00195401, 0x00028901, 0x00195c01, 0x00196001,
+	0x00004101, 0x00196801, 0x00196c01, 0x00028b01, 0x00197401, 0x00028c01, 0x00197b01, 0x00197f01,
+	0x00028d01, 0x00198701, 0x00028e01, 0x00198f01, 0x00199301, 0x00028f01, 0x00199b01, 0x00029001,
+	0x0019a201, 0x0019a601, 0x00029101, 0x0019ae01, 0x00029201, 0x0019b601, 0x0019ba01, 0x00029301,
+	0x0019c201, 0x0019c601, 0x00004201, 0x0019cd01, 0x00029501, 0x0019d501, 0x0019d901, 0x00029601,
+	0x0019e101, 0x00029701, 0x0019e901, 0x0019ed01, 0x00029801, 0x0019f501, 0x00029901, 0x0019fc01,
+	0x001a0001, 0x00029a01, 0x001a0801, 0x001a0c01, 0x00029b01, 0x001a1401, 0x00029c01, 0x001a1c01,
+	0x001a2001, 0x00029d01, 0x001a2701, 0x00004301, 0x001a2f01, 0x001a3301, 0x00029f01, 0x001a3b01,
+	0x0002a001, 0x001a4301, 0x001a4701, 0x0002a101, 0x001a4e01, 0x0002a201, 0x001a5601, 0x001a5a01,
+	0x0002a301, 0x001a6201, 0x001a6601, 0x0002a401, 0x001a6e01, 0x0002a501, 0x001a7501, 0x001a7901,
+	0x0002a601, 0x001a8101, 0x0002a701, 0x001a8901, 0x001a8d01, 0x00004401, 0x001a9501, 0x0002a901,
+	0x001a9c01, 0x001aa001, 0x0002aa01, 0x001aa801, 0x0002ab01, 0x001ab001, 0x001ab401, 0x0002ac01,
+	0x001abc01, 0x001ac001, 0x0002ad01, 0x001ac701, 0x0002ae01, 0x001acf01, 0x001ad301, 0x0002af01,
+	0x001adb01, 0x0002b001, 0x001ae301, 0x001ae701, 0x0002b101, 0x001aef01, 0x00004501, 0x001af601,
+	0x001afa01, 0x0002b301, 0x001b0201, 0x001b0601, 0x0002b401, 0x001b0e01, 0x0002b501, 0x001b1601,
+	0x001b1a01, 0x0002b601, 0x001b2101, 0x0002b701, 0x001b2901, 0x001b2d01, 0x0002b801, 0x001b3501,
+	0x0002b901, 0x001b3d01, 0x001b4101, 0x0002ba01, 0x001b4801, 0x0002bb01, 0x001b5001, 0x001b5401,
+	0x00000701, 0x001b5c01, 0x001b6001, 0x0002bd01, 0x001b6801, 0x0002be01, 0x001b6f01, 0x001b7301,
+	0x0002bf01, 0x001b7b01, 0x0002c001, 0x001b8301, 0x001b8701, 0x0002c101, 0x001b8f01, 0x0002c201,
+	0x001b9601, 0x001b9a01, 0x0002c301, 0x001ba201, 0x0002c401, 0x001baa01, 0x001bae01, 0x0002c501,
+	0x001bb601, 0x001bba01, 0x00004701, 0x001bc101, 0x0002c701, 0x001bc901, 0x001bcd01, 0x0002c801,
+	0x001bd501, 0x0002c901, 0x001bdd01, 0x001be101, 0x0002ca01, 0x001be901, 0x0002cb01, 0x001bf001,
+	0x001bf401, 0x0002cc01, 0x001bfc01, 0x001c0001, 0x0002cd01, 0x001c0801, 0x0002ce01, 0x001c1001,
+	0x001c1401, 0x0002cf01, 0x001c1b01, 0x00004801, 0x001c2301, 0x001c2701, 0x0002d101, 0x001c2f01,
+	0x0002d201, 0x001c3701, 0x001c3b01, 0x0002d301, 0x001c4201, 0x0002d401, 0x001c4a01, 0x001c4e01,
+	0x0002d501, 0x001c5601, 0x001c5a01, 0x0002d601, 0x001c6201, 0x0002d701, 0x001c6901, 0x001c6d01,
+	0x0002d801, 0x001c7501, 0x0002d901, 0x001c7d01, 0x001c8101, 0x00004901, 0x001c8901, 0x0002db01,
+	0x001c9001, 0x001c9401, 0x0002dc01, 0x001c9c01, 0x0002dd01, 0x001ca401, 0x001ca801, 0x0002de01,
+	0x001cb001, 0x001cb401, 0x0002df01, 0x001cbb01, 0x0002e001, 0x001cc301, 0x001cc701, 0x0002e101,
+	0x001ccf01, 0x0002e201, 0x001cd701, 0x001cdb01, 0x0002e301, 0x001ce301, 0x00004a01, 0x001cea01,
+	0x001cee01, 0x0002e501, 0x001cf601, 0x001cfa01, 0x0002e601, 0x001d0201, 0x0002e701, 0x001d0a01,
+	0x001d0e01, 0x0002e801, 0x001d1501, 0x0002e901, 0x001d1d01, 0x001d2101, 0x0002ea01, 0x001d2901,
+	0x0002eb01, 0x001d3101, 0x001d3501, 0x0002ec01, 0x001d3c01, 0x0002ed01, 0x001d4401, 0x001d4801,
+	0x00004b01, 0x001d5001, 0x001d5401, 0x0002ef01, 0x001d5c01, 0x0002f001, 0x001d6301, 0x001d6701,
+	0x0002f101, 0x001d6f01, 0x0002f201, 0x001d7701, 0x001d7b01, 0x0002f301, 0x001d8301, 0x0002f401,
+	0x001d8a01, 0x001d8e01, 0x0002f501, 0x001d9601, 0x0002f601, 0x001d9e01, 0x001da201, 0x0002f701,
+	0x001daa01, 0x001dae01, 0x00004c01, 0x001db501, 0x0002f901, 0x001dbd01, 0x001dc101, 0x0002fa01,
+	0x001dc901, 0x0002fb01, 0x001dd101, 0x001dd501, 0x0002fc01, 0x001ddd01, 0x0002fd01, 0x001de401,
+	0x001de801, 0x0002fe01, 0x001df001, 0x001df401, 0x0002ff01, 0x001dfc01, 0x00030001, 0x001e0401,
+	0x001e0801, 0x00030101, 0x001e0f01, 0x00004d01, 0x001e1701, 0x001e1b01, 0x00030301, 0x001e2301,
+	0x00030401, 0x001e2b01, 0x001e2f01, 0x00030501, 0x001e3601, 0x00030601, 0x001e3e01, 0x001e4201,
+	0x00030701, 0x001e4a01, 0x001e4e01, 0x00030801, 0x001e5601, 0x00030901, 0x001e5d01, 0x001e6101,
+	0x00030a01, 0x001e6901, 0x00030b01, 0x001e7101, 0x001e7501, 0x00004e01, 0x001e7d01, 0x00030d01,
+	0x001e8401, 0x001e8801, 0x00030e01, 0x001e9001, 0x00030f01, 0x001e9801, 0x001e9c01, 0x00031001,
+	0x001ea401, 0x001ea801, 0x00031101, 0x001eaf01, 0x00031201, 0x001eb701, 0x001ebb01, 0x00031301,
+	0x001ec301, 0x00031401, 0x001ecb01, 0x001ecf01, 0x00031501, 0x001ed701, 0x00004f01, 0x001ede01,
+	0x001ee201, 0x00031701, 0x001eea01, 0x001eee01, 0x00031801, 0x001ef601, 0x00031901, 0x001efe01,
+	0x001f0201, 0x00031a01, 0x001f0901, 0x00031b01, 0x001f1101, 0x001f1501, 0x00031c01, 0x001f1d01,
+	0x00031d01, 0x001f2501, 0x001f2901, 0x00031e01, 0x001f3001, 0x00031f01, 0x001f3801, 0x001f3c01,
+	0x00000801, 0x00032101, 0x001f5001, 0x00032201, 0x00032301, 0x00032401, 0x00032501, 0x001f7701,
+	0x00032601, 0x00032701, 0x00032801, 0x001f9601, 0x00032901, 0x00005101, 0x00032b01, 0x00032c01,
+	0x001fbd01, 0x00032d01, 0x00032e01, 0x00032f01, 0x00033001, 0x001fe401, 0x00033101, 0x00033201,
+	0x00033301, 0x00200301, 0x00005201, 0x00033501, 0x00033601, 0x00033701, 0x00202a01, 0x00033801,
+	0x00033901, 0x00033a01, 0x00204a01, 0x00033b01, 0x00033c01, 0x00033d01, 0x00005301, 0x00207101,
+	0x00033f01, 0x00034001, 0x00034101, 0x00209001, 0x00034201, 0x00034301, 0x00034401, 0x00034501,
+	0x0020b701, 0x00034601, 0x00034701, 0x00005401, 0x00034901, 0x0020de01, 0x00034a01, 0x00034b01,
+	0x00034c01, 0x0020fd01, 0x00034d01, 0x00034e01, 0x00034f01, 0x00035001, 0x00212401, 0x00035101,
+	0x00005501, 0x00035301, 0x00214401, 0x00035401, 0x00035501, 0x00035601, 0x00035701, 0x00216b01,
+	0x00035801, 0x00035901, 0x00035a01, 0x00218a01, 0x00035b01, 0x00005601, 0x00035d01, 0x00035e01,
+	0x0021b101, 0x00035f01, 0x00036001, 0x00036101, 0x00036201, 0x0021d801, 0x00036301, 0x00036401,
+	0x00036501, 0x0021f701, 0x00005701, 0x00036701, 0x00036801, 0x00036901, 0x00221e01, 0x00036a01,
+	0x00036b01, 0x00036c01, 0x00223e01, 0x00036d01, 0x00036e01, 0x00036f01, 0x00005801, 0x00226501,
+	0x00037101, 0x00037201, 0x00037301, 0x00228401, 0x00037401, 0x00037501, 0x00037601, 0x00037701,
+	0x0022ab01, 0x00037801, 0x00037901, 0x00005901, 0x00037b01, 0x0022d201, 0x00037c01, 0x00037d01,
+	0x00037e01, 0x0022f101, 0x00037f01, 0x00038001, 0x00038101, 0x00038201, 0x00231801, 0x00038301,
+	0x00000901, 0x00038501, 0x00233801, 0x00038601, 0x00038701, 0x00038801, 0x00038901, 0x00235f01,
+	0x00038a01, 0x00038b01, 0x00038c01, 0x00237e01, 0x00038d01, 0x00005b01, 0x00038f01, 0x00039001,
+	0x0023a501, 0x00039101, 0x00039201, 0x00039301, 0x00039401, 0x0023cc01, 0x00039501, 0x00039601,
+	0x00039701, 0x0023eb01, 0x00005c01, 0x00039901, 0x00039a01, 0x00039b01, 0x00241201, 0x00039c01,
+	0x00039d01, 0x00039e01, 0x00243201, 0x00039f01, 0x0003a001, 0x0003a101, 0x00005d01, 0x00245901,
+	0x0003a301, 0x0003a401, 0x0003a501, 0x00247801, 0x0003a601, 0x0003a701, 0x0003a801, 0x0003a901,
+	0x00249f01, 0x0003aa01, 0x0003ab01, 0x00005e01, 0x0003ad01, 0x0024c601, 0x0003ae01, 0x0003af01,
+	0x0003b001, 0x0024e501, 0x0003b101, 0x0003b201, 0x0003b301, 0x0003b401, 0x00250c01, 0x0003b501,
+	0x00005f01, 0x0003b701, 0x00252c01, 0x0003b801, 0x0003b901, 0x0003ba01, 0x0003bb01, 0x00255301,
+	0x0003bc01, 0x0003bd01, 0x0003be01, 0x00257201, 0x0003bf01, 0x00006001, 0x0003c101, 0x0003c201,
+	0x00259901, 0x0003c301, 0x0003c401, 0x0003c501, 0x0003c601, 0x0025c001, 0x0003c701, 0x0003c801,
+	0x0003c901, 0x0025df01, 0x00006101, 0x0003cb01, 0x0003cc01, 0x0003cd01, 0x00260601, 0x0003ce01,
+	0x0003cf01, 0x0003d001, 0x00262601, 0x0003d101, 0x0003d201, 0x0003d301, 0x00006201, 0x00264d01,
+	0x0003d501, 0x0003d601, 0x0003d701, 0x00266c01, 0x0003d801, 0x0003d901, 0x0003da01, 0x0003db01,
+	0x00269301, 0x0003dc01, 0x0003dd01, 0x00006301, 0x0003df01, 0x0026ba01, 0x0003e001, 0x0003e101,
+	0x0003e201, 0x0026d901, 0x0003e301, 0x0003e401, 0x0003e501, 0x0003e601, 0x00270001, 0x0003e701,
+	0x00000102, 0x0003e902, 0x00272002, 0x0003ea02, 0x0003eb02, 0x0003ec02, 0x0003ed02, 0x00274702,
+	0x0003ee02, 0x0003ef02, 0x0003f002, 0x00276602, 0x0003f102, 0x00006502, 0x0003f302, 0x0003f402,
+	0x00278d02, 0x0003f502, 0x0003f602, 0x0003f702, 0x0003f802, 0x0027b402, 0x0003f902, 0x0003fa02,
+	0x0003fb02, 0x0027d302, 0x00006602, 0x0003fd02, 0x0003fe02, 0x0003ff02, 0x0027fa02, 0x00040002,
+	0x00040102, 0x00040202, 0x00281a02, 0x00040302, 0x00040402, 0x00040502, 0x00006702, 0x00284102,
+	0x00040702, 0x00040802, 0x00040902, 0x00286002, 0x00040a02, 0x00040b02, 0x00040c02, 0x00040d02,
+	0x00288702, 0x00040e02, 0x00040f02, 0x00006802, 0x00041102, 0x0028ae02, 0x00041202, 0x00041302,
+	0x00041402, 0x0028cd02, 0x00041502, 0x00041602, 0x00041702, 0x00041802, 0x0028f402, 0x00041902,
+	0x00006902, 0x00041b02, 0x00291402, 0x00041c02, 0x00041d02, 0x00041e02, 0x00041f02, 0x00293b02,
+	0x00042002, 0x00042102, 0x00042202, 0x00295a02, 0x00042302, 0x00006a02, 0x00042502, 0x00042602,
+	0x00298102, 0x00042702, 0x00042802, 0x00042902, 0x00042a02, 0x0029a802, 0x00042b02, 0x00042c02,
+	0x00042d02, 0x0029c702, 0x00006b02, 0x00042f02, 0x00043002, 0x00043102, 0x0029ee02, 0x00043202,
+	0x00043302, 0x00043402, 0x002a0e02, 0x00043502, 0x00043602, 0x00043702, 0x00006c02, 0x002a3502,
+	0x00043902, 0x00043a02, 0x00043b02, 0x002a5402, 0x00043c02, 0x00043d02, 0x00043e02, 0x00043f02,
+	0x002a7b02, 0x00044002, 0x00044102, 0x00006d02, 0x00044302, 0x002aa202, 0x00044402, 0x00044502,
+	0x00044602, 0x002ac102, 0x00044702, 0x00044802, 0x00044902, 0x00044a02, 0x002ae802, 0x00044b02,
+	0x00000b02, 0x00044d02, 0x002b0802, 0x00044e02, 0x00044f02, 0x00045002, 0x00045102, 0x002b2f02,
+	0x00045202, 0x00045302, 0x00045402, 0x002b4e02, 0x00045502, 0x00006f02, 0x00045702, 0x00045802,
+	0x002b7502, 0x00045902, 0x00045a02, 0x00045b02, 0x00045c02, 0x002b9c02, 0x00045d02, 0x00045e02,
+	0x00045f02, 0x002bbb02, 0x00007002, 0x00046102, 0x00046202, 0x00046302, 0x002be202, 0x00046402,
+	0x00046502, 0x00046602, 0x002c0202, 0x00046702, 0x00046802, 0x00046902, 0x00007102, 0x002c2902,
+	0x00046b02, 0x00046c02, 0x00046d02, 0x002c4802, 0x00046e02, 0x00046f02, 0x00047002, 0x00047102,
+	0x002c6f02, 0x00047202, 0x00047302, 0x00007202, 0x00047502, 0x002c9602, 0x00047602, 0x00047702,
+	0x00047802, 0x002cb502, 0x00047902, 0x00047a02, 0x00047b02, 0x00047c02, 0x002cdc02, 0x00047d02,
+	0x00007302, 0x00047f02, 0x002cfc02, 0x00048002, 0x00048102, 0x00048202, 0x00048302, 0x002d2302,
+	0x00048402, 0x00048502, 0x00048602, 0x002d4202, 0x00048702, 0x00007402, 0x00048902, 0x00048a02,
+	0x002d6902, 0x00048b02, 0x00048c02, 0x00048d02, 0x00048e02, 0x002d9002, 0x00048f02, 0x00049002,
+	0x00049102, 0x002daf02, 0x00007502, 0x00049302, 0x00049402, 0x00049502, 0x002dd602, 0x00049602,
+	0x00049702, 0x00049802, 0x002df602, 0x00049902, 0x00049a02, 0x00049b02, 0x00007602, 0x002e1d02,
+	0x00049d02, 0x00049e02, 0x00049f02, 0x002e3c02, 0x0004a002, 0x0004a102, 0x0004a202, 0x0004a302,
+	0x002e6302, 0x0004a402, 0x0004a502, 0x00007702, 0x0004a702, 0x002e8a02, 0x0004a802, 0x0004a902,
+	0x0004aa02, 0x002ea902, 0x0004ab02, 0x0004ac02, 0x0004ad02, 0x0004ae02, 0x002ed002, 0x0004af02,
+	0x00000c02, 0x0004b102, 0x002ef002, 0x0004b202, 0x0004b302, 0x0004b402, 0x0004b502, 0x002f1702,
+	0x0004b602, 0x0004b702, 0x0004b802, 0x002f3602, 0x0004b902, 0x00007902, 0x0004bb02, 0x0004bc02,
+	0x002f5d02, 0x0004bd02, 0x0004be02, 0x0004bf02, 0x0004c002, 0x002f8402, 0x0004c102, 0x0004c202,
+	0x0004c302, 0x002fa302, 0x00007a02, 0x0004c502, 0x0004c602, 0x0004c702, 0x002fca02, 0x0004c802,
+	0x0004c902, 0x0004ca02, 0x002fea02, 0x0004cb02, 0x0004cc02, 0x0004cd02, 0x00007b02, 0x00301102,
+	0x0004cf02, 0x0004d002, 0x0004d102, 0x00303002, 0x0004d202, 0x0004d302, 0x0004d402, 0x0004d502,
+	0x00305702, 0x0004d602, 0x0004d702, 0x00007c02, 0x0004d902, 0x00307e02, 0x0004da02, 0x0004db02,
+	0x0004dc02, 0x00309d02, 0x0004dd02, 0x0004de02, 0x0004df02, 0x0004e002, 0x0030c402, 0x0004e102,
+	0x00007d02, 0x0004e302, 0x0030e402, 0x0004e402, 0x0004e502, 0x0004e602, 0x0004e702, 0x00310b02,
+	0x0004e802, 0x0004e902, 0x0004ea02, 0x00312a02, 0x0004eb02, 0x00007e02, 0x0004ed02, 0x0004ee02,
+	0x00315102, 0x0004ef02, 0x0004f002, 0x0004f102, 0x0004f202, 0x00317802, 0x0004f302, 0x0004f402,
+	0x0004f502, 0x00319702, 0x00007f02, 0x0004f702, 0x0004f802, 0x0004f902, 0x0031be02, 0x0004fa02,
+	0x0004fb02, 0x0004fc02, 0x0031de02, 0x0004fd02, 0x0004fe02, 0x0004ff02, 0x00008002, 0x00320502,
+	0x00050102, 0x00050202, 0x00050302, 0x00322402, 0x00050402, 0x00050502, 0x00050602, 0x00050702,
+	0x00324b02, 0x00050802, 0x00050902, 0x00008102, 0x00050b02, 0x00327202, 0x00050c02, 0x00050d02,
+	0x00050e02, 0x00329102, 0x00050f02, 0x00051002, 0x00051102, 0x00051202, 0x0032b802, 0x00051302,
+	0x00000d02, 0x00051502, 0x0032d802, 0x00051602, 0x00051702, 0x00051802, 0x00051902, 0x0032ff02,
+	0x00051a02, 0x00051b02, 0x00051c02, 0x00331e02, 0x00051d02, 0x00008302, 0x00051f02, 0x00052002,
+	0x00334502, 0x00052102, 0x00052202, 0x00052302, 0x00052402, 0x00336c02, 0x00052502, 0x00052602,
+	0x00052702, 0x00338b02, 0x00008402, 0x00052902, 0x00052a02, 0x00052b02, 0x0033b202, 0x00052c02,
+	0x00052d02, 0x00052e02, 0x0033d202, 0x00052f02, 0x00053002, 0x00053102, 0x00008502, 0x0033f902,
+	0x00053302, 0x00053402, 0x00053502, 0x00341802, 0x00053602, 0x00053702, 0x00053802, 0x00053902,
+	0x00343f02, 0x00053a02, 0x00053b02, 0x00008602, 0x00053d02, 0x00346602, 0x00053e02, 0x00053f02,
+	0x00054002, 0x00348502, 0x00054102, 0x00054202, 0x00054302, 0x00054402, 0x0034ac02, 0x00054502,
+	0x00008702, 0x00054702, 0x0034cc02, 0x00054802, 0x00054902, 0x00054a02, 0x00054b02, 0x0034f302,
+	0x00054c02, 0x00054d02, 0x00054e02, 0x00351202, 0x00054f02, 0x00008802, 0x00055102, 0x00055202,
+	0x00353902, 0x00055302, 0x00055402, 0x00055502, 0x00055602, 0x00356002, 0x00055702, 0x00055802,
+	0x00055902, 0x00357f02, 0x00008902, 0x00055b02, 0x00055c02, 0x00055d02, 0x0035a602, 0x00055e02,
+	0x00055f02, 0x00056002, 0x0035c602, 0x00056102, 0x00056202, 0x00056302, 0x00008a02, 0x0035ed02,
+	0x00056502, 0x00056602, 0x00056702, 0x00360c02, 0x00056802, 0x00056902, 0x00056a02, 0x00056b02,
+	0x00363302, 0x00056c02, 0x00056d02, 0x00008b02, 0x00056f02, 0x00365a02, 0x00057002, 0x00057102,
+	0x00057202, 0x00367902, 0x00057302, 0x00057402, 0x00057502, 0x00057602, 0x0036a002, 0x00057702,
+	0x00000e02, 0x00057902, 0x0036c002, 0x00057a02, 0x00057b02, 0x00057c02, 0x00057d02, 0x0036e702,
+	0x00057e02, 0x00057f02, 0x00058002, 0x00370602, 0x00058102, 0x00008d02, 0x00058302, 0x00058402,
+	0x00372d02, 0x00058502, 0x00058602, 0x00058702, 0x00058802, 0x00375402, 0x00058902, 0x00058a02,
+	0x00058b02, 0x00377302, 0x00008e02, 0x00058d02, 0x00058e02, 0x00058f02, 0x00379a02, 0x00059002,
+	0x00059102, 0x00059202, 0x0037ba02, 0x00059302, 0x00059402, 0x00059502, 0x00008f02, 0x0037e102,
+	0x00059702, 0x00059802, 0x00059902, 0x00380002, 0x00059a02, 0x00059b02, 0x00059c02, 0x00059d02,
+	0x00382702, 0x00059e02, 0x00059f02, 0x00009002, 0x0005a102, 0x00384e02, 0x0005a202, 0x0005a302,
+	0x0005a402, 0x00386d02, 0x0005a502, 0x0005a602, 0x0005a702, 0x0005a802, 0x00389402, 0x0005a902,
+	0x00009102, 0x0005ab02, 0x0038b402, 0x0005ac02, 0x0005ad02, 0x0005ae02, 0x0005af02, 0x0038db02,
+	0x0005b002, 0x0005b102, 0x0005b202, 0x0038fa02, 0x0005b302, 0x00009202, 0x0005b502, 0x0005b602,
+	0x00392102, 0x0005b702, 0x0005b802, 0x0005b902, 0x0005ba02, 0x00394802, 0x0005bb02, 0x0005bc02,
+	0x0005bd02, 0x00396702, 0x00009302, 0x0005bf02, 0x0005c002, 0x0005c102, 0x00398e02, 0x0005c202,
+	0x0005c302, 0x0005c402, 0x0039ae02, 0x0005c502, 0x0005c602, 0x0005c702, 0x00009402, 0x0039d502,
+	0x0005c902, 0x0005ca02, 0x0005cb02, 0x0039f402, 0x0005cc02, 0x0005cd02, 0x0005ce02, 0x0005cf02,
+	0x003a1b02, 0x0005d002, 0x0005d102, 0x00009502, 0x0005d302, 0x003a4202, 0x0005d402, 0x0005d502,
+	0x0005d602, 0x003a6102, 0x0005d702, 0x0005d802, 0x0005d902, 0x0005da02, 0x003a8802, 0x0005db02,
+	0x00000f02, 0x0005dd02, 0x003aa802, 0x0005de02, 0x0005df02, 0x0005e002, 0x0005e102, 0x003acf02,
+	0x0005e202, 0x0005e302, 0x0005e402, 0x003aee02, 0x0005e502, 0x00009702, 0x0005e702, 0x0005e802,
+	0x003b1502, 0x0005e902, 0x0005ea02, 0x0005eb02, 0x0005ec02, 0x003b3c02, 0x0005ed02, 0x0005ee02,
+	0x0005ef02, 0x003b5b02, 0x00009802, 0x0005f102, 0x0005f202, 0x0005f302, 0x003b8202, 0x0005f402,
+	0x0005f502, 0x0005f602, 0x003ba202, 0x0005f702, 0x0005f802, 0x0005f902, 0x00009902, 0x003bc902,
+	0x0005fb02, 0x0005fc02, 0x0005fd02, 0x003be802, 0x0005fe02, 0x0005ff02, 0x00060002, 0x00060102,
+	0x003c0f02, 0x00060202, 0x00060302, 0x00009a02, 0x00060502, 0x003c3602, 0x00060602, 0x00060702,
+	0x00060802, 0x003c5502, 0x00060902, 0x00060a02, 0x00060b02, 0x00060c02, 0x003c7c02, 0x00060d02,
+	0x00009b02, 0x00060f02, 0x003c9c02, 0x00061002, 0x00061102, 0x00061202, 0x00061302, 0x003cc302,
+	0x00061402, 0x00061502, 0x00061602, 0x003ce202, 0x00061702, 0x00009c02, 0x00061902, 0x00061a02,
+	0x003d0902, 0x00061b02, 0x00061c02, 0x00061d02, 0x00061e02, 0x003d3002, 0x00061f02, 0x00062002,
+	0x00062102, 0x003d4f02, 0x00009d02, 0x00062302, 0x00062402, 0x00062502, 0x003d7602, 0x00062602,
+	0x00062702, 0x00062802, 0x003d9602, 0x00062902, 0x00062a02, 0x00062b02, 0x00009e02, 0x003dbd02,
+	0x00062d02, 0x00062e02, 0x00062f02, 0x003ddc02, 0x00063002, 0x00063102, 0x00063202, 0x00063302,
+	0x003e0302, 0x00063402, 0x00063502, 0x00009f02, 0x00063702, 0x003e2a02, 0x00063802, 0x00063902,
+	0x00063a02, 0x003e4902, 0x00063b02, 0x00063c02, 0x00063d02, 0x00063e02, 0x003e7002, 0x00063f02,
+	0x00001002, 0x00064202, 0x00064302, 0x00064502, 0x00064602, 0x00064802, 0x0000a102, 0x00064b02,
+	0x00064c02, 0x00064e02, 0x00065002, 0x00065102, 0x00065302, 0x0000a202, 0x00065602, 0x00065702,
+	0x00065902, 0x00065b02, 0x00065c02, 0x0000a302, 0x00065f02, 0x00066102, 0x00066202, 0x00066402,
+	0x00066602, 0x00066702, 0x0000a402, 0x00066a02, 0x00066c02, 0x00066d02, 0x00066f02, 0x00067002,
+	0x0000a502, 0x00067402, 0x00067502, 0x00067702, 0x00067802, 0x00067a02, 0x0000a602, 0x00067d02,
+	0x00067e02, 0x00068002, 0x00068202, 0x00068302, 0x00068502, 0x0000a702, 0x00068802, 0x00068902,
+	0x00068b02, 0x00068d02, 0x00068e02, 0x0000a802, 0x00069102, 0x00069302, 0x00069402, 0x00069602,
+	0x00069802, 0x00069902, 0x0000a902, 0x00069c02, 0x00069e02, 0x00069f02, 0x0006a102, 0x0006a202,
+	0x00001102, 0x0006a602, 0x0006a702, 0x0006a902, 0x0006aa02, 0x0006ac02, 0x0000ab02, 0x0006af02,
+	0x0006b002, 0x0006b202, 0x0006b402, 0x0006b502, 0x0006b702, 0x0000ac02, 0x0006ba02, 0x0006bb02,
+	0x0006bd02, 0x0006bf02, 0x0006c002, 0x0000ad02, 0x0006c302, 0x0006c502, 0x0006c602, 0x0006c802,
+	0x0006ca02, 0x0006cb02, 0x0000ae02, 0x0006ce02, 0x0006d002, 0x0006d102, 0x0006d302, 0x0006d402,
+	0x0000af02, 0x0006d802, 0x0006d902, 0x0006db02, 0x0006dc02, 0x0006de02, 0x0000b002, 0x0006e102,
+	0x0006e202, 0x0006e402, 0x0006e602, 0x0006e702, 0x0006e902, 0x0000b102, 0x0006ec02, 0x0006ed02,
+	0x0006ef02, 0x0006f102, 0x0006f202, 0x0000b202, 0x0006f502, 0x0006f702, 0x0006f802, 0x0006fa02,
+	0x0006fc02, 0x0006fd02, 0x0000b302, 0x00070002, 0x00070202, 0x00070302, 0x00070502, 0x00070602,
+	0x00001202, 0x00070a02, 0x00070b02, 0x00070d02, 0x00070e02, 0x00071002, 0x0000b502, 0x00071302,
+	0x00071402, 0x00071602, 0x00071802, 0x00071902, 0x00071b02, 0x0000b602, 0x00071e02, 0x00071f02,
+	0x00072102, 0x00072302, 0x00072402, 0x0000b702, 0x00072702, 0x00072902, 0x00072a02, 0x00072c02,
+	0x00072e02, 0x00072f02, 0x0000b802, 0x00073202, 0x00073402, 0x00073502, 0x00073702, 0x00073802,
+	0x0000b902, 0x00073c02, 0x00073d02, 0x00073f02, 0x00074002, 0x00074202, 0x0000ba02, 0x00074502,
+	0x00074602, 0x00074802, 0x00074a02, 0x00074b02, 0x00074d02, 0x0000bb02, 0x00075002, 0x00075102,
+	0x00075302, 0x00075502, 0x00075602, 0x0000bc02, 0x00075902, 0x00075b02, 0x00075c02, 0x00075e02,
+	0x00076002, 0x00076102, 0x0000bd02, 0x00076402, 0x00076602, 0x00076702, 0x00076902, 0x00076a02,
+	0x00001302, 0x00076e02, 0x00076f02, 0x00077102, 0x00077202, 0x00077402, 0x0000bf02, 0x00077702,
+	0x00077802, 0x00077a02, 0x00077c02, 0x00077d02, 0x00077f02, 0x0000c002, 0x00078202, 0x00078302,
+	0x00078502, 0x00078702, 0x00078802, 0x0000c102, 0x00078b02, 0x00078d02, 0x00078e02, 0x00079002,
+	0x00079202, 0x00079302, 0x0000c202, 0x00079602, 0x00079802, 0x00079902, 0x00079b02, 0x00079c02,
+	0x0000c302, 0x0007a002, 0x0007a102, 0x0007a302, 0x0007a402, 0x0007a602, 0x0000c402, 0x0007a902,
+	0x0007aa02, 0x0007ac02, 0x0007ae02, 0x0007af02, 0x0007b102, 0x0000c502, 0x0007b402, 0x0007b502,
+	0x0007b702, 0x0007b902, 0x0007ba02, 0x0000c602, 0x0007bd02, 0x0007bf02, 0x0007c002, 0x0007c202,
+	0x0007c402, 0x0007c502, 0x0000c702, 0x0007c802, 0x0007ca02, 0x0007cb02, 0x0007cd02, 0x0007ce02,
+	0x00000202, 0x0007d202, 0x0007d302, 0x0007d502, 0x0007d602, 0x0007d802, 0x0000c902, 0x0007db02,
+	0x0007dc02, 0x0007de02, 0x0007e002, 0x0007e102, 0x0007e302, 0x0000ca02, 0x0007e602, 0x0007e702,
+	0x0007e902, 0x0007eb02, 0x0007ec02, 0x0000cb02, 0x0007ef02, 0x0007f102, 0x0007f202, 0x0007f402,
+	0x0007f602, 0x0007f702, 0x0000cc02, 0x0007fa02, 0x0007fc02, 0x0007fd02, 0x0007ff02, 0x00080002,
+	0x0000cd02, 0x00080402, 0x00080502, 0x00080702, 0x00080802, 0x00080a02, 0x0000ce02, 0x00080d02,
+	0x00080e02, 0x00081002, 0x00081202, 0x00081302, 0x00081502, 0x0000cf02, 0x00081802, 0x00081902,
+	0x00081b02, 0x00081d02, 0x00081e02, 0x0000d002, 0x00082102, 0x00082302, 0x00082402, 0x00082602,
+	0x00082802, 0x00082902, 0x0000d102, 0x00082c02, 0x00082e02, 0x00082f02, 0x00083102, 0x00083202,
+	0x00001502, 0x00083602, 0x00083702, 0x00083902, 0x00083a02, 0x00083c02, 0x0000d302, 0x00083f02,
+	0x00084002, 0x00084202, 0x00084402, 0x00084502, 0x00084702, 0x0000d402, 0x00084a02, 0x00084b02,
+	0x00084d02, 0x00084f02, 0x00085002, 0x0000d502, 0x00085302, 0x00085502, 0x00085602, 0x00085802,
+	0x00085a02, 0x00085b02, 0x0000d602, 0x00085e02, 0x00086002, 0x00086102, 0x00086302, 0x00086402,
+	0x0000d702, 0x00086802, 0x00086902, 0x00086b02, 0x00086c02, 0x00086e02, 0x0000d802, 0x00087102,
+	0x00087202, 0x00087402, 0x00087602, 0x00087702, 0x00087902, 0x0000d902, 0x00087c02, 0x00087d02,
+	0x00087f02, 0x00088102, 0x00088202, 0x0000da02, 0x00088502, 0x00088702, 0x00088802, 0x00088a02,
+	0x00088c02, 0x00088d02, 0x0000db02, 0x00089002, 0x00089202, 0x00089302, 0x00089502, 0x00089602,
+	0x00001602, 0x00089a02, 0x00089b02, 0x00089d02, 0x00089e02, 0x0008a002, 0x0000dd02, 0x0008a302,
+	0x0008a402, 0x0008a602, 0x0008a802, 0x0008a902, 0x0008ab02, 0x0000de02, 0x0008ae02, 0x0008af02,
+	0x0008b102, 0x0008b302, 0x0008b402, 0x0000df02, 0x0008b702, 0x0008b902, 0x0008ba02, 0x0008bc02,
+	0x0008be02, 0x0008bf02, 0x0000e002, 0x0008c202, 0x0008c402, 0x0008c502, 0x0008c702, 0x0008c802,
+	0x0000e102, 0x0008cc02, 0x0008cd02, 0x0008cf02, 0x0008d002, 0x0008d202, 0x0000e202, 0x0008d502,
+	0x0008d602, 0x0008d802, 0x0008da02, 0x0008db02, 0x0008dd02, 0x0000e302, 0x0008e002, 0x0008e102,
+	0x0008e302, 0x0008e502, 0x0008e602, 0x0000e402, 0x0008e902, 0x0008eb02, 0x0008ec02, 0x0008ee02,
+	0x0008f002, 0x0008f102, 0x0000e502, 0x0008f402, 0x0008f602, 0x0008f702, 0x0008f902, 0x0008fa02,
+	0x00001702, 0x0008fe02, 0x0008ff02, 0x00090102, 0x00090202, 0x00090402, 0x0000e702, 0x00090702,
+	0x00090802, 0x00090a02, 0x00090c02, 0x00090d02, 0x00090f02, 0x0000e802, 0x00091202, 0x00091302,
+	0x00091502, 0x00091702, 0x00091802, 0x0000e902, 0x00091b02, 0x00091d02, 0x00091e02, 0x00092002,
+	0x00092202, 0x00092302, 0x0000ea02, 0x00092602, 0x00092802, 0x00092902, 0x00092b02, 0x00092c02,
+	0x0000eb02, 0x00093002, 0x00093102, 0x00093302, 0x00093402, 0x00093602, 0x0000ec02, 0x00093902,
+	0x00093a02, 0x00093c02, 0x00093e02, 0x00093f02, 0x00094102, 0x0000ed02, 0x00094402, 0x00094502,
+	0x00094702, 0x00094902, 0x00094a02, 0x0000ee02, 0x00094d02, 0x00094f02, 0x00095002, 0x00095202,
+	0x00095402, 0x00095502, 0x0000ef02, 0x00095802, 0x00095a02, 0x00095b02, 0x00095d02, 0x00095e02,
+	0x00001802, 0x00096202, 0x00096302, 0x00096502, 0x00096602, 0x00096802, 0x0000f102, 0x00096b02,
+	0x00096c02, 0x00096e02, 0x00097002, 0x00097102, 0x00097302, 0x0000f202, 0x00097602, 0x00097702,
+	0x00097902, 0x00097b02, 0x00097c02, 0x0000f302, 0x00097f02, 0x00098102, 0x00098202, 0x00098402,
+	0x00098602, 0x00098702, 0x0000f402, 0x00098a02, 0x00098c02, 0x00098d02, 0x00098f02, 0x00099002,
+	0x0000f502, 0x00099402, 0x00099502, 0x00099702, 0x00099802, 0x00099a02, 0x0000f602, 0x00099d02,
+	0x00099e02, 0x0009a002, 0x0009a202, 0x0009a302, 0x0009a502, 0x0000f702, 0x0009a802, 0x0009a902,
+	0x0009ab02, 0x0009ad02, 0x0009ae02, 0x0000f802, 0x0009b102, 0x0009b302, 0x0009b402, 0x0009b602,
+	0x0009b802, 0x0009b902, 0x0000f902, 0x0009bc02, 0x0009be02, 0x0009bf02, 0x0009c102, 0x0009c202,
+	0x00001902, 0x0009c602, 0x0009c702, 0x0009c902, 0x0009ca02, 0x0009cc02, 0x0000fb02, 0x0009cf02,
+	0x0009d002, 0x0009d202, 0x0009d402, 0x0009d502, 0x0009d702, 0x0000fc02, 0x0009da02, 0x0009db02,
+	0x0009dd02, 0x0009df02, 0x0009e002, 0x0000fd02, 0x0009e302, 0x0009e502, 0x0009e602, 0x0009e802,
+	0x0009ea02, 0x0009eb02, 0x0000fe02, 0x0009ee02, 0x0009f002, 0x0009f102, 0x0009f302, 0x0009f402,
+	0x0000ff02, 0x0009f802, 0x0009f902, 0x0009fb02, 0x0009fc02, 0x0009fe02, 0x00010002, 0x000a0102,
+	0x000a0202, 0x000a0402, 0x000a0602, 0x000a0702, 0x000a0902, 0x00010102, 0x000a0c02, 0x000a0d02,
+	0x000a0f02, 0x000a1102, 0x000a1202, 0x00010202, 0x000a1502, 0x000a1702, 0x000a1802, 0x000a1a02,
+	0x000a1c02, 0x000a1d02, 0x00010302, 0x000a2002, 0x000a2202, 0x000a2302, 0x000a2502, 0x000a2602,
+	0x00001a02, 0x000a2a02, 0x000a2b02, 0x000a2d02, 0x000a2e02, 0x000a3002, 0x00010502, 0x000a3302,
+	0x000a3402, 0x000a3602, 0x000a3802, 0x000a3902, 0x000a3b02, 0x00010602, 0x000a3e02, 0x000a3f02,
+	0x000a4102, 0x000a4302, 0x000a4402, 0x00010702, 0x000a4702, 0x000a4902, 0x000a4a02, 0x000a4c02,
+	0x000a4e02, 0x000a4f02, 0x00010802, 0x000a5202, 0x000a5402, 0x000a5502, 0x000a5702, 0x000a5802,
+	0x00010902, 0x000a5c02, 0x000a5d02, 0x000a5f02, 0x000a6002, 0x000a6202, 0x00010a02, 0x000a6502,
+	0x000a6602, 0x000a6802, 0x000a6a02, 0x000a6b02, 0x000a6d02, 0x00010b02, 0x000a7002, 0x000a7102,
+	0x000a7302, 0x000a7502, 0x000a7602, 0x00010c02, 0x000a7902, 0x000a7b02, 0x000a7c02, 0x000a7e02,
+	0x000a8002, 0x000a8102, 0x00010d02, 0x000a8402, 0x000a8602, 0x000a8702, 0x000a8902, 0x000a8a02,
+	0x00001b02, 0x000a8e02, 0x000a8f02, 0x000a9102, 0x000a9202, 0x000a9402, 0x00010f02, 0x000a9702,
+	0x000a9802, 0x000a9a02, 0x000a9c02, 0x000a9d02, 0x000a9f02, 0x00011002, 0x000aa202, 0x000aa302,
+	0x000aa502, 0x000aa702, 0x000aa802, 0x00011102, 0x000aab02, 0x000aad02, 0x000aae02, 0x000ab002,
+	0x000ab202, 0x000ab302, 0x00011202, 0x000ab602, 0x000ab802, 0x000ab902, 0x000abb02, 0x000abc02,
+	0x00011302, 0x000ac002, 0x000ac102, 0x000ac302, 0x000ac402, 0x000ac602, 0x00011402, 0x000ac902,
+	0x000aca02, 0x000acc02, 0x000ace02, 0x000acf02, 0x000ad102, 0x00011502, 0x000ad402, 0x000ad502,
+	0x000ad702, 0x000ad902, 0x000ada02, 0x00011602, 0x000add02, 0x000adf02, 0x000ae002, 0x000ae202,
+	0x000ae402, 0x000ae502, 0x00011702, 0x000ae802, 0x000aea02, 0x000aeb02, 0x000aed02, 0x000aee02,
+	0x00001c02, 0x000af202, 0x000af302, 0x000af502, 0x000af602, 0x000af802, 0x00011902, 0x000afb02,
+	0x000afc02, 0x000afe02, 0x000b0002, 0x000b0102, 0x000b0302, 0x00011a02, 0x000b0602, 0x000b0702,
+	0x000b0902, 0x000b0b02, 0x000b0c02, 0x00011b02, 0x000b0f02, 0x000b1102, 0x000b1202, 0x000b1402,
+	0x000b1602, 0x000b1702, 0x00011c02, 0x000b1a02, 0x000b1c02, 0x000b1d02, 0x000b1f02, 0x000b2002,
+	0x00011d02, 0x000b2402, 0x000b2502, 0x000b2702, 0x000b2802, 0x000b2a02, 0x00011e02, 0x000b2d02,
+	0x000b2e02, 0x000b3002, 0x000b3202, 0x000b3302, 0x000b3502, 0x00011f02, 0x000b3802, 0x000b3902,
+	0x000b3b02, 0x000b3d02, 0x000b3e02, 0x00012002, 0x000b4102, 0x000b4302, 0x000b4402, 0x000b4602,
+	0x000b4802, 0x000b4902, 0x00012102, 0x000b4c02, 0x000b4e02, 0x000b4f02, 0x000b5102, 0x000b5202,
+	0x00001d02, 0x000b5602, 0x000b5702, 0x000b5902, 0x000b5a02, 0x000b5c02, 0x00012302, 0x000b5f02,
+	0x000b6002, 0x000b6202, 0x000b6402, 0x000b6502, 0x000b6702, 0x00012402, 0x000b6a02, 0x000b6b02,
+	0x000b6d02, 0x000b6f02, 0x000b7002, 0x00012502, 0x000b7302, 0x000b7502, 0x000b7602, 0x000b7802,
+	0x000b7a02, 0x000b7b02, 0x00012602, 0x000b7e02, 0x000b8002, 0x000b8102, 0x000b8302, 0x000b8402,
+	0x00012702, 0x000b8802, 0x000b8902, 0x000b8b02, 0x000b8c02, 0x000b8e02, 0x00012802, 0x000b9102,
+	0x000b9202, 0x000b9402, 0x000b9602, 0x000b9702, 0x000b9902, 0x00012902, 0x000b9c02, 0x000b9d02,
+	0x000b9f02, 0x000ba102, 0x000ba202, 0x00012a02, 0x000ba502, 0x000ba702, 0x000ba802, 0x000baa02,
+	0x000bac02, 0x000bad02, 0x00012b02, 0x000bb002, 0x000bb202, 0x000bb302, 0x000bb502, 0x000bb602,
+	0x00000302, 0x000bba02, 0x000bbb02, 0x000bbd02, 0x000bbe02, 0x000bc002, 0x00012d02, 0x000bc302,
+	0x000bc402, 0x000bc602, 0x000bc802, 0x000bc902, 0x000bcb02, 0x00012e02, 0x000bce02, 0x000bcf02,
+	0x000bd102, 0x000bd302, 0x000bd402, 0x00012f02, 0x000bd702, 0x000bd902, 0x000bda02, 0x000bdc02,
+	0x000bde02, 0x000bdf02, 0x00013002, 0x000be202, 0x000be402, 0x000be502, 0x000be702, 0x000be802,
+	0x00013102, 0x000bec02, 0x000bed02, 0x000bef02, 0x000bf002, 0x000bf202, 0x00013202, 0x000bf502,
+	0x000bf602, 0x000bf802, 0x000bfa02, 0x000bfb02, 0x000bfd02, 0x00013302, 0x000c0002, 0x000c0102,
+	0x000c0302, 0x000c0502, 0x000c0602, 0x00013402, 0x000c0902, 0x000c0b02, 0x000c0c02, 0x000c0e02,
+	0x000c1002, 0x000c1102, 0x00013502, 0x000c1402, 0x000c1602, 0x000c1702, 0x000c1902, 0x000c1a02,
+	0x00001f02, 0x000c1e02, 0x000c1f02, 0x000c2102, 0x000c2202, 0x000c2402, 0x00013702, 0x000c2702,
+	0x000c2802, 0x000c2a02, 0x000c2c02, 0x000c2d02, 0x000c2f02, 0x00013802, 0x000c3202, 0x000c3302,
+	0x000c3502, 0x000c3702, 0x000c3802, 0x00013902, 0x000c3b02, 0x000c3d02, 0x000c3e02, 0x000c4002,
+	0x000c4202, 0x000c4302, 0x00013a02, 0x000c4602, 0x000c4802, 0x000c4902, 0x000c4b02, 0x000c4c02,
+	0x00013b02, 0x000c5002, 0x000c5102, 0x000c5302, 0x000c5402, 0x000c5602, 0x00013c02, 0x000c5902,
+	0x000c5a02, 0x000c5c02, 0x000c5e02, 0x000c5f02, 0x000c6102, 0x00013d02, 0x000c6402, 0x000c6502,
+	0x000c6702, 0x000c6902, 0x000c6a02, 0x00013e02, 0x000c6d02, 0x000c6f02, 0x000c7002, 0x000c7202,
+	0x000c7402, 0x000c7502, 0x00013f02, 0x000c7802, 0x000c7a02, 0x000c7b02, 0x000c7d02, 0x000c7e02,
+	0x00002002, 0x000c8302, 0x000c8602, 0x00014102, 0x000c8c02, 0x000c9002, 0x00014202, 0x000c9602,
+	0x000c9902, 0x000c9c02, 0x00014302, 0x000ca202, 0x000ca602, 0x00014402, 0x000cac02, 0x000caf02,
+	0x00014502, 0x000cb502, 0x000cb802, 0x00014602, 0x000cbe02, 0x000cc202, 0x00014702, 0x000cc802,
+	0x000ccb02, 0x000cce02, 0x00014802, 0x000cd402, 0x000cd802, 0x00014902, 0x000cde02, 0x000ce102,
+	0x00002102, 0x000ce702, 0x000cea02, 0x00014b02, 0x000cf002, 0x000cf402, 0x00014c02, 0x000cfa02,
+	0x000cfd02, 0x000d0002, 0x00014d02, 0x000d0602, 0x000d0a02, 0x00014e02, 0x000d1002, 0x000d1302,
+	0x00014f02, 0x000d1902, 0x000d1c02, 0x00015002, 0x000d2202, 0x000d2602, 0x00015102, 0x000d2c02,
+	0x000d2f02, 0x000d3202, 0x00015202, 0x000d3802, 0x000d3c02, 0x00015302, 0x000d4202, 0x000d4502,
+	0x00002202, 0x000d4b02, 0x000d4e02, 0x00015502, 0x000d5402, 0x000d5802, 0x00015602, 0x000d5e02,
+	0x000d6102, 0x000d6402, 0x00015702, 0x000d6a02, 0x000d6e02, 0x00015802, 0x000d7402, 0x000d7702,
+	0x00015902, 0x000d7d02, 0x000d8002, 0x00015a02, 0x000d8602, 0x000d8a02, 0x00015b02, 0x000d9002,
+	0x000d9302, 0x000d9602, 0x00015c02, 0x000d9c02, 0x000da002, 0x00015d02, 0x000da602, 0x000da902,
+	0x00002302, 0x000daf02, 0x000db202, 0x00015f02, 0x000db802, 0x000dbc02, 0x00016002, 0x000dc202,
+	0x000dc502, 0x000dc802, 0x00016102, 0x000dce02, 0x000dd202, 0x00016202, 0x000dd802, 0x000ddb02,
+	0x00016302, 0x000de102, 0x000de402, 0x00016402, 0x000dea02, 0x000dee02, 0x00016502, 0x000df402,
+	0x000df702, 0x000dfa02, 0x00016602, 0x000e0002, 0x000e0402, 0x00016702, 0x000e0a02, 0x000e0d02,
+	0x00002402, 0x000e1302, 0x000e1602, 0x00016902, 0x000e1c02, 0x000e2002, 0x00016a02, 0x000e2602,
+	0x000e2902, 0x000e2c02, 0x00016b02, 0x000e3202, 0x000e3602, 0x00016c02, 0x000e3c02, 0x000e3f02,
+	0x00016d02, 0x000e4502, 0x000e4802, 0x00016e02, 0x000e4e02, 0x000e5202, 0x00016f02, 0x000e5802,
+	0x000e5b02, 0x000e5e02, 0x00017002, 0x000e6402, 0x000e6802, 0x00017102, 0x000e6e02, 0x000e7102,
+	0x00002502, 0x000e7702, 0x000e7a02, 0x00017302, 0x000e8002, 0x000e8402, 0x00017402, 0x000e8a02,
+	0x000e8d02, 0x000e9002, 0x00017502, 0x000e9602, 0x000e9a02, 0x00017602, 0x000ea002, 0x000ea302,
+	0x00017702, 0x000ea902, 0x000eac02, 0x00017802, 0x000eb202, 0x000eb602, 0x00017902, 0x000ebc02,
+	0x000ebf02, 0x000ec202, 0x00017a02, 0x000ec802, 0x000ecc02, 0x00017b02, 0x000ed202, 0x000ed502,
+	0x00002602, 0x000edb02, 0x000ede02, 0x00017d02, 0x000ee402, 0x000ee802, 0x00017e02, 0x000eee02,
+	0x000ef102, 0x000ef402, 0x00017f02, 0x000efa02, 0x000efe02, 0x00018002, 0x000f0402, 0x000f0702,
+	0x00018102, 0x000f0d02, 0x000f1002, 0x00018202, 0x000f1602, 0x000f1a02, 0x00018302, 0x000f2002,
+	0x000f2302, 0x000f2602, 0x00018402, 0x000f2c02, 0x000f3002, 0x00018502, 0x000f3602, 0x000f3902,
+	0x00002702, 0x000f3f02, 0x000f4202, 0x00018702, 0x000f4802, 0x000f4c02, 0x00018802, 0x000f5202,
+	0x000f5502, 0x000f5802, 0x00018902, 0x000f5e02, 0x000f6202, 0x00018a02, 0x000f6802, 0x000f6b02,
+	0x00018b02, 0x000f7102, 0x000f7402, 0x00018c02, 0x000f7a02, 0x000f7e02, 0x00018d02, 0x000f8402,
+	0x000f8702, 0x000f8a02, 0x00018e02, 0x000f9002, 0x000f9402, 0x00018f02, 0x000f9a02, 0x000f9d02,
+	0x00000402, 0x000fa302, 0x000fa602, 0x00019102, 0x000fac02, 0x000fb002, 0x00019202, 0x000fb602,
+	0x000fb902, 0x000fbc02, 0x00019302, 0x000fc202, 0x000fc602, 0x00019402, 0x000fcc02, 0x000fcf02,
+	0x00019502, 0x000fd502, 0x000fd802, 0x00019602, 0x000fde02, 0x000fe202, 0x00019702, 0x000fe802,
+	0x000feb02, 0x000fee02, 0x00019802, 0x000ff402, 0x000ff802, 0x00019902, 0x000ffe02, 0x00100102,
+	0x00002902, 0x00100702, 0x00100a02, 0x00019b02, 0x00101002, 0x00101402, 0x00019c02, 0x00101a02,
+	0x00101d02, 0x00102002, 0x00019d02, 0x00102602, 0x00102a02, 0x00019e02, 0x00103002, 0x00103302,
+	0x00019f02, 0x00103902, 0x00103c02, 0x0001a002, 0x00104202, 0x00104602, 0x0001a102, 0x00104c02,
+	0x00104f02, 0x00105202, 0x0001a202, 0x00105802, 0x00105c02, 0x0001a302, 0x00106202, 0x00106502,
+	0x00002a02, 0x00106b02, 0x00106e02, 0x0001a502, 0x00107402, 0x00107802, 0x0001a602, 0x00107e02,
+	0x00108102, 0x00108402, 0x0001a702, 0x00108a02, 0x00108e02, 0x0001a802, 0x00109402, 0x00109702,
+	0x0001a902, 0x00109d02, 0x0010a002, 0x0001aa02, 0x0010a602, 0x0010aa02, 0x0001ab02, 0x0010b002,
+	0x0010b302, 0x0010b602, 0x0001ac02, 0x0010bc02, 0x0010c002, 0x0001ad02, 0x0010c602, 0x0010c902,
+	0x00002b02, 0x0010cf02, 0x0010d202, 0x0001af02, 0x0010d802, 0x0010dc02, 0x0001b002, 0x0010e202,
+	0x0010e502, 0x0010e802, 0x0001b102, 0x0010ee02, 0x0010f202, 0x0001b202, 0x0010f802, 0x0010fb02,
+	0x0001b302, 0x00110102, 0x00110402, 0x0001b402, 0x00110a02, 0x00110e02, 0x0001b502, 0x00111402,
+	0x00111702, 0x00111a02, 0x0001b602, 0x00112002, 0x00112402, 0x0001b702, 0x00112a02, 0x00112d02,
+	0x00002c02, 0x00113302, 0x00113602, 0x0001b902, 0x00113c02, 0x00114002, 0x0001ba02, 0x00114602,
+	0x00114902, 0x00114c02, 0x0001bb02, 0x00115202, 0x00115602, 0x0001bc02, 0x00115c02, 0x00115f02,
+	0x0001bd02, 0x00116502, 0x00116802, 0x0001be02, 0x00116e02, 0x00117202, 0x0001bf02, 0x00117802,
+	0x00117b02, 0x00117e02, 0x0001c002, 0x00118402, 0x00118802, 0x0001c102, 0x00118e02, 0x00119102,
+	0x00002d02, 0x00119702, 0x00119a02, 0x0001c302, 0x0011a002, 0x0011a402, 0x0001c402, 0x0011aa02,
+	0x0011ad02, 0x0011b002, 0x0001c502, 0x0011b602, 0x0011ba02, 0x0001c602, 0x0011c002, 0x0011c302,
+	0x0001c702, 0x0011c902, 0x0011cc02, 0x0001c802, 0x0011d202, 0x0011d602, 0x0001c902, 0x0011dc02,
+	0x0011df02, 0x0011e202, 0x0001ca02, 0x0011e802, 0x0011ec02, 0x0001cb02, 0x0011f202, 0x0011f502,
+	0x00002e02, 0x0011fb02, 0x0011fe02, 0x0001cd02, 0x00120402, 0x00120802, 0x0001ce02, 0x00120e02,
+	0x00121102, 0x00121402, 0x0001cf02, 0x00121a02, 0x00121e02, 0x0001d002, 0x00122402, 0x00122702,
+	0x0001d102, 0x00122d02, 0x00123002, 0x0001d202, 0x00123602, 0x00123a02, 0x0001d302, 0x00124002,
+	0x00124302, 0x00124602, 0x0001d402, 0x00124c02, 0x00125002, 0x0001d502, 0x00125602, 0x00125902,
+	0x00002f02, 0x00125f02, 0x00126202, 0x0001d702, 0x00126802, 0x00126c02, 0x0001d802, 0x00127202,
+	0x00127502, 0x00127802, 0x0001d902, 0x00127e02, 0x00128202, 0x0001da02, 0x00128802, 0x00128b02,
+	0x0001db02, 0x00129102, 0x00129402, 0x0001dc02, 0x00129a02, 0x00129e02, 0x0001dd02, 0x0012a402,
+	0x0012a702, 0x0012aa02, 0x0001de02, 0x0012b002, 0x0012b402, 0x0001df02, 0x0012ba02, 0x0012bd02,
+	0x00003002, 0x0012c302, 0x0012c602, 0x0001e102, 0x0012cc02, 0x0012d002, 0x0001e202, 0x0012d602,
+	0x0012d902, 0x0012dc02, 0x0001e302, 0x0012e202, 0x0012e602, 0x0001e402, 0x0012ec02, 0x0012ef02,
+	0x0001e502, 0x0012f502, 0x0012f802, 0x0001e602, 0x0012fe02, 0x00130202, 0x0001e702, 0x00130802,
+	0x00130b02, 0x00130e02, 0x0001e802, 0x00131402, 0x00131802, 0x0001e902, 0x00131e02, 0x00132102,
+	0x00003102, 0x00132702, 0x00132a02, 0x0001eb02, 0x00133002, 0x00133402, 0x0001ec02, 0x00133a02,
+	0x00133d02, 0x00134002, 0x0001ed02, 0x00134602, 0x00134a02, 0x0001ee02, 0x00135002, 0x00135302,
+	0x0001ef02, 0x00135902, 0x00135c02, 0x0001f002, 0x00136202, 0x00136602, 0x0001f102, 0x00136c02,
+	0x00136f02, 0x00137202, 0x0001f202, 0x00137802, 0x00137c02, 0x0001f302, 0x00138202, 0x00138502,
+	0x00000502, 0x00138b02, 0x00138e02, 0x0001f502, 0x00139402, 0x00139802, 0x0001f602, 0x00139e02,
+	0x0013a102, 0x0013a402, 0x0001f702, 0x0013aa02, 0x0013ae02, 0x0001f802, 0x0013b402, 0x0013b702,
+	0x0001f902, 0x0013bd02, 0x0013c002, 0x0001fa02, 0x0013c602, 0x0013ca02, 0x0001fb02, 0x0013d002,
+	0x0013d302, 0x0013d602, 0x0001fc02, 0x0013dc02, 0x0013e002, 0x0001fd02, 0x0013e602, 0x0013e902,
+	0x00003302, 0x0013ef02, 0x0013f202, 0x0001ff02, 0x0013f802, 0x0013fc02, 0x00020002, 0x00140202,
+	0x00140502, 0x00140802, 0x00020102, 0x00140e02, 0x00141202, 0x00020202, 0x00141802, 0x00141b02,
+	0x00020302, 0x00142102, 0x00142402, 0x00020402, 0x00142a02, 0x00142e02, 0x00020502, 0x00143402,
+	0x00143702, 0x00143a02, 0x00020602, 0x00144002, 0x00144402, 0x00020702, 0x00144a02, 0x00144d02,
+	0x00003402, 0x00145302, 0x00145602, 0x00020902, 0x00145c02, 0x00146002, 0x00020a02, 0x00146602,
+	0x00146902, 0x00146c02, 0x00020b02, 0x00147202, 0x00147602, 0x00020c02, 0x00147c02, 0x00147f02,
+	0x00020d02, 0x00148502, 0x00148802, 0x00020e02, 0x00148e02, 0x00149202, 0x00020f02, 0x00149802,
+	0x00149b02, 0x00149e02, 0x00021002, 0x0014a402, 0x0014a802, 0x00021102, 0x0014ae02, 0x0014b102,
+	0x00003502, 0x0014b702, 0x0014ba02, 0x00021302, 0x0014c002, 0x0014c402, 0x00021402, 0x0014ca02,
+	0x0014cd02, 0x0014d002, 0x00021502, 0x0014d602, 0x0014da02, 0x00021602, 0x0014e002, 0x0014e302,
+	0x00021702, 0x0014e902, 0x0014ec02, 0x00021802, 0x0014f202, 0x0014f602, 0x00021902, 0x0014fc02,
+	0x0014ff02, 0x00150202, 0x00021a02, 0x00150802, 0x00150c02, 0x00021b02, 0x00151202, 0x00151502,
+	0x00003602, 0x00151b02, 0x00151e02, 0x00021d02, 0x00152402, 0x00152802, 0x00021e02, 0x00152e02,
+	0x00153102, 0x00153402, 0x00021f02, 0x00153a02, 0x00153e02, 0x00022002, 0x00154402, 0x00154702,
+	0x00022102, 0x00154d02, 0x00155002, 0x00022202, 0x00155602, 0x00155a02, 0x00022302, 0x00156002,
+	0x00156302, 0x00156602, 0x00022402, 0x00156c02, 0x00157002, 0x00022502, 0x00157602, 0x00157902,
+	0x00003702, 0x00157f02, 0x00158202, 0x00022702, 0x00158802, 0x00158c02, 0x00022802, 0x00159202,
+	0x00159502, 0x00159802, 0x00022902, 0x00159e02, 0x0015a202, 0x00022a02, 0x0015a802, 0x0015ab02,
+	0x00022b02, 0x0015b102, 0x0015b402, 0x00022c02, 0x0015ba02, 0x0015be02, 0x00022d02, 0x0015c402,
+	0x0015c702, 0x0015ca02, 0x00022e02, 0x0015d002, 0x0015d402, 0x00022f02, 0x0015da02, 0x0015dd02,
+	0x00003802, 0x0015e302, 0x0015e602, 0x00023102, 0x0015ec02, 0x0015f002, 0x00023202, 0x0015f602,
+	0x0015f902, 0x0015fc02, 0x00023302, 0x00160202, 0x00160602, 0x00023402, 0x00160c02, 0x00160f02,
+	0x00023502, 0x00161502, 0x00161802, 0x00023602, 0x00161e02, 0x00162202, 0x00023702, 0x00162802,
+	0x00162b02, 0x00162e02, 0x00023802, 0x00163402, 0x00163802, 0x00023902, 0x00163e02, 0x00164102,
+	0x00003902, 0x00164702, 0x00164a02, 0x00023b02, 0x00165002, 0x00165402, 0x00023c02, 0x00165a02,
+	0x00165d02, 0x00166002, 0x00023d02, 0x00166602, 0x00166a02, 0x00023e02, 0x00167002, 0x00167302,
+	0x00023f02, 0x00167902, 0x00167c02, 0x00024002, 0x00168202, 0x00168602, 0x00024102, 0x00168c02,
+	0x00168f02, 0x00169202, 0x00024202, 0x00169802, 0x00169c02, 0x00024302, 0x0016a202, 0x0016a502,
+	0x00003a02, 0x0016ab02, 0x0016ae02, 0x00024502, 0x0016b402, 0x0016b802, 0x00024602, 0x0016be02,
+	0x0016c102, 0x0016c402, 0x00024702, 0x0016ca02, 0x0016ce02, 0x00024802, 0x0016d402, 0x0016d702,
+	0x00024902, 0x0016dd02, 0x0016e002, 0x00024a02, 0x0016e602, 0x0016ea02, 0x00024b02, 0x0016f002,
+	0x0016f302, 0x0016f602, 0x00024c02, 0x0016fc02, 0x00170002, 0x00024d02, 0x00170602, 0x00170902,
+	0x00003b02, 0x00170f02, 0x00171202, 0x00024f02, 0x00171802, 0x00171c02, 0x00025002, 0x00172202,
+	0x00172502, 0x00172802, 0x00025102, 0x00172e02, 0x00173202, 0x00025202, 0x00173802, 0x00173b02,
+	0x00025302, 0x00174102, 0x00174402, 0x00025402, 0x00174a02, 0x00174e02, 0x00025502, 0x00175402,
+	0x00175702, 0x00175a02, 0x00025602, 0x00176002, 0x00176402, 0x00025702, 0x00176a02, 0x00176d02,
+	0x00000602, 0x00177302, 0x00177602, 0x00025902, 0x00177c02, 0x00178002, 0x00025a02, 0x00178602,
+	0x00178902, 0x00178c02, 0x00025b02, 0x00179202, 0x00179602, 0x00025c02, 0x00179c02, 0x00179f02,
+	0x00025d02, 0x0017a502, 0x0017a802, 0x00025e02, 0x0017ae02, 0x0017b202, 0x00025f02, 0x0017b802,
+	0x0017bb02, 0x0017be02, 0x00026002, 0x0017c402, 0x0017c802, 0x00026102, 0x0017ce02, 0x0017d102,
+	0x00003d02, 0x0017d702, 0x0017da02, 0x00026302, 0x0017e002, 0x0017e402, 0x00026402, 0x0017ea02,
+	0x0017ed02, 0x0017f002, 0x00026502, 0x0017f602, 0x0017fa02, 0x00026602, 0x00180002, 0x00180302,
+	0x00026702, 0x00180902, 0x00180c02, 0x00026802, 0x00181202, 0x00181602, 0x00026902, 0x00181c02,
+	0x00181f02, 0x00182202, 0x00026a02, 0x00182802, 0x00182c02, 0x00026b02, 0x00183202, 0x00183502,
+	0x00003e02, 0x00183b02, 0x00183e02, 0x00026d02, 0x00184402, 0x00184802, 0x00026e02, 0x00184e02,
+	0x00185102, 0x00185402, 0x00026f02, 0x00185a02, 0x00185e02, 0x00027002, 0x00186402, 0x00186702,
+	0x00027102, 0x00186d02, 0x00187002, 0x00027202, 0x00187602, 0x00187a02, 0x00027302, 0x00188002,
+	0x00188302, 0x00188602, 0x00027402, 0x00188c02, 0x00189002, 0x00027502, 0x00189602, 0x00189902,
+	0x00003f02, 0x00189f02, 0x0018a202, 0x00027702, 0x0018a802, 0x0018ac02, 0x00027802, 0x0018b202,
+	0x0018b502, 0x0018b802, 0x00027902, 0x0018be02, 0x0018c202, 0x00027a02, 0x0018c802, 0x0018cb02,
+	0x00027b02, 0x0018d102, 0x0018d402, 0x00027c02, 0x0018da02, 0x0018de02, 0x00027d02, 0x0018e402,
+	0x0018e702, 0x0018ea02, 0x00027e02, 0x0018f002, 0x0018f402, 0x00027f02, 0x0018fa02, 0x0018fd02,
+	0x00004002, 0x00190602, 0x00028102, 0x00028202, 0x00191902, 0x00028302, 0x00028402, 0x00192c02,
+	0x00028502, 0x00193802, 0x00028602, 0x00028702, 0x00194b02, 0x00028802, 0x00028902, 0x00195e02,
+	0x00004102, 0x00196a02, 0x00028b02, 0x00028c02, 0x00197d02, 0x00028d02, 0x00028e02, 0x00199002,
+	0x00028f02, 0x00199c02, 0x00029002, 0x00029102, 0x0019af02, 0x00029202, 0x00029302, 0x0019c202,
+	0x00004202, 0x0019ce02, 0x00029502, 0x00029602, 0x0019e102, 0x00029702, 0x00029802, 0x0019f402,
+	0x00029902, 0x001a0002, 0x00029a02, 0x00029b02, 0x001a1302, 0x00029c02, 0x00029d02, 0x001a2602,
+	0x00004302, 0x001a3202, 0x00029f02, 0x0002a002, 0x001a4502, 0x0002a102, 0x0002a202, 0x001a5802,
+	0x0002a302, 0x001a6402, 0x0002a402, 0x0002a502, 0x001a7702, 0x0002a602, 0x0002a702, 0x001a8a02,
+	0x00004402, 0x001a9602, 0x0002a902, 0x0002aa02, 0x001aa902, 0x0002ab02, 0x0002ac02, 0x001abc02,
+	0x0002ad02, 0x001ac802, 0x0002ae02, 0x0002af02, 0x001adb02, 0x0002b002, 0x0002b102, 0x001aee02,
+	0x00004502, 0x001afa02, 0x0002b302, 0x0002b402, 0x001b0d02, 0x0002b502, 0x0002b602, 0x001b2002,
+	0x0002b702, 0x001b2c02, 0x0002b802, 0x0002b902, 0x001b3f02, 0x0002ba02, 0x0002bb02, 0x001b5202,
+	0x00000702, 0x001b5e02, 0x0002bd02, 0x0002be02, 0x001b7102, 0x0002bf02, 0x0002c002, 0x001b8402,
+	0x0002c102, 0x001b9002, 0x0002c202, 0x0002c302, 0x001ba302, 0x0002c402, 0x0002c502, 0x001bb602,
+	0x00004702, 0x001bc202, 0x0002c702, 0x0002c802, 0x001bd502, 0x0002c902, 0x0002ca02, 0x001be802,
+	0x0002cb02, 0x001bf402, 0x0002cc02, 0x0002cd02, 0x001c0702, 0x0002ce02, 0x0002cf02, 0x001c1a02,
+	0x00004802, 0x001c2602, 0x0002d102, 0x0002d202, 0x001c3902, 0x0002d302, 0x0002d402, 0x001c4c02,
+	0x0002d502, 0x001c5802, 0x0002d602, 0x0002d702, 0x001c6b02, 0x0002d802, 0x0002d902, 0x001c7e02,
+	0x00004902, 0x001c8a02, 0x0002db02, 0x0002dc02, 0x001c9d02, 0x0002dd02, 0x0002de02, 0x001cb002,
+	0x0002df02, 0x001cbc02, 0x0002e002, 0x0002e102, 0x001ccf02, 0x0002e202, 0x0002e302, 0x001ce202,
+	0x00004a02, 0x001cee02, 0x0002e502, 0x0002e602, 0x001d0102, 0x0002e702, 0x0002e802, 0x001d1402,
+	0x0002e902, 0x001d2002, 0x0002ea02, 0x0002eb02, 0x001d3302, 0x0002ec02, 0x0002ed02, 0x001d4602,
+	0x00004b02, 0x001d5202, 0x0002ef02, 0x0002f002, 0x001d6502, 0x0002f102, 0x0002f202, 0x001d7802,
+	0x0002f302, 0x001d8402, 0x0002f402, 0x0002f502, 0x001d9702, 0x0002f602, 0x0002f702, 0x001daa02,
+	0x00004c02, 0x001db602, 0x0002f902, 0x0002fa02, 0x001dc902, 0x0002fb02, 0x0002fc02, 0x001ddc02,
+	0x0002fd02, 0x001de802, 0x0002fe02, 0x0002ff02, 0x001dfb02, 0x00030002, 0x00030102, 0x001e0e02,
+	0x00004d02, 0x001e1a02, 0x00030302, 0x00030402, 0x001e2d02, 0x00030502, 0x00030602, 0x001e4002,
+	0x00030702, 0x001e4c02, 0x00030802, 0x00030902, 0x001e5f02, 0x00030a02, 0x00030b02, 0x001e7202,
+	0x00004e02, 0x001e7e02, 0x00030d02, 0x00030e02, 0x001e9102, 0x00030f02, 0x00031002, 0x001ea402,
+	0x00031102, 0x001eb002, 0x00031202, 0x00031302, 0x001ec302, 0x00031402, 0x00031502, 0x001ed602,
+	0x00004f02, 0x001ee202, 0x00031702, 0x00031802, 0x001ef502, 0x00031902, 0x00031a02, 0x001f0802,
+	0x00031b02, 0x001f1402, 0x00031c02, 0x00031d02, 0x001f2702, 0x00031e02, 0x00031f02, 0x001f3a02,
+	0x00000802, 0x001f4602, 0x00032102, 0x00032202, 0x001f5902, 0x00032302, 0x00032402, 0x001f6c02,
+	0x00032502, 0x001f7802, 0x00032602, 0x00032702, 0x001f8b02, 0x00032802, 0x00032902, 0x001f9e02,
+	0x00005102, 0x001faa02, 0x00032b02, 0x00032c02, 0x001fbd02, 0x00032d02, 0x00032e02, 0x001fd002,
+	0x00032f02, 0x001fdc02, 0x00033002, 0x00033102, 0x001fef02, 0x00033202, 0x00033302, 0x00200202,
+	0x00005202, 0x00200e02, 0x00033502, 0x00033602, 0x00202102, 0x00033702, 0x00033802, 0x00203402,
+	0x00033902, 0x00204002, 0x00033a02, 0x00033b02, 0x00205302, 0x00033c02, 0x00033d02, 0x00206602,
+	0x00005302, 0x00207202, 0x00033f02, 0x00034002, 0x00208502, 0x00034102, 0x00034202, 0x00209802,
+	0x00034302, 0x0020a402, 0x00034402, 0x00034502, 0x0020b702, 0x00034602, 0x00034702, 0x0020ca02,
+	0x00005402, 0x0020d602, 0x00034902, 0x00034a02, 0x0020e902, 0x00034b02, 0x00034c02, 0x0020fc02,
+	0x00034d02, 0x00210802, 0x00034e02, 0x00034f02, 0x00211b02, 0x00035002, 0x00035102, 0x00212e02,
+	0x00005502, 0x00213a02, 0x00035302, 0x00035402, 0x00214d02, 0x00035502, 0x00035602, 0x00216002,
+	0x00035702, 0x00216c02, 0x00035802, 0x00035902, 0x00217f02, 0x00035a02, 0x00035b02, 0x00219202,
+	0x00005602, 0x00219e02, 0x00035d02, 0x00035e02, 0x0021b102, 0x00035f02, 0x00036002, 0x0021c402,
+	0x00036102, 0x0021d002, 0x00036202, 0x00036302, 0x0021e302, 0x00036402, 0x00036502, 0x0021f602,
+	0x00005702, 0x00220202, 0x00036702, 0x00036802, 0x00221502, 0x00036902, 0x00036a02, 0x00222802,
+	0x00036b02, 0x00223402, 0x00036c02, 0x00036d02, 0x00224702, 0x00036e02, 0x00036f02, 0x00225a02,
+	0x00005802, 0x00226602, 0x00037102, 0x00037202, 0x00227902, 0x00037302, 0x00037402, 0x00228c02,
+	0x00037502, 0x00229802, 0x00037602, 0x00037702, 0x0022ab02, 0x00037802, 0x00037902, 0x0022be02,
+	0x00005902, 0x0022ca02, 0x00037b02, 0x00037c02, 0x0022dd02, 0x00037d02, 0x00037e02, 0x0022f002,
+	0x00037f02, 0x0022fc02, 0x00038002, 0x00038102, 0x00230f02, 0x00038202, 0x00038302, 0x00232202,
+	0x00000902, 0x00232e02, 0x00038502, 0x00038602, 0x00234102, 0x00038702, 0x00038802, 0x00235402,
+	0x00038902, 0x00236002, 0x00038a02, 0x00038b02, 0x00237302, 0x00038c02, 0x00038d02, 0x00238602,
+	0x00005b02, 0x00239202, 0x00038f02, 0x00039002, 0x0023a502, 0x00039102, 0x00039202, 0x0023b802,
+	0x00039302, 0x0023c402, 0x00039402, 0x00039502, 0x0023d702, 0x00039602, 0x00039702, 0x0023ea02,
+	0x00005c02, 0x0023f602, 0x00039902, 0x00039a02, 0x00240902, 0x00039b02, 0x00039c02, 0x00241c02,
+	0x00039d02, 0x00242802, 0x00039e02, 0x00039f02, 0x00243b02, 0x0003a002, 0x0003a102, 0x00244e02,
+	0x00005d02, 0x00245a02, 0x0003a302, 0x0003a402, 0x00246d02, 0x0003a502, 0x0003a602, 0x00248002,
+	0x0003a702, 0x00248c02, 0x0003a802, 0x0003a902, 0x00249f02, 0x0003aa02, 0x0003ab02, 0x0024b202,
+	0x00005e02, 0x0024be02, 0x0003ad02, 0x0003ae02, 0x0024d102, 0x0003af02, 0x0003b002, 0x0024e402,
+	0x0003b102, 0x0024f002, 0x0003b202, 0x0003b302, 0x00250302, 0x0003b402, 0x0003b502, 0x00251602,
+	0x00005f02, 0x00252202, 0x0003b702, 0x0003b802, 0x00253502, 0x0003b902, 0x0003ba02, 0x00254802,
+	0x0003bb02, 0x00255402, 0x0003bc02, 0x0003bd02, 0x00256702, 0x0003be02, 0x0003bf02, 0x00257a02,
+	0x00006002, 0x00258602, 0x0003c102, 0x0003c202, 0x00259902, 0x0003c302, 0x0003c402, 0x0025ac02,
+	0x0003c502, 0x0025b802, 0x0003c602, 0x0003c702, 0x0025cb02, 0x0003c802, 0x0003c902, 0x0025de02,
+	0x00006102, 0x0025ea02, 0x0003cb02, 0x0003cc02, 0x0025fd02, 0x0003cd02, 0x0003ce02, 0x00261002,
+	0x0003cf02, 0x00261c02, 0x0003d002, 0x0003d102, 0x00262f02, 0x0003d202, 0x0003d302, 0x00264202,
+	0x00006202, 0x00264e02, 0x0003d502, 0x0003d602, 0x00266102, 0x0003d702, 0x0003d802, 0x00267402,
+	0x0003d902, 0x00268002, 0x0003da02, 0x0003db02, 0x00269302, 0x0003dc02, 0x0003dd02, 0x0026a602,
+	0x00006302, 0x0026b202, 0x0003df02, 0x0003e002, 0x0026c502, 0x0003e102, 0x0003e202, 0x0026d802,
+	0x0003e302, 0x0026e402, 0x0003e402, 0x0003e502, 0x0026f702, 0x0003e602, 0x0003e702, 0x00270a02,
+	0x00000103, 0x00271603, 0x0003e903, 0x0003ea03, 0x00272903, 0x0003eb03, 0x0003ec03, 0x00273c03,
+	0x0003ed03, 0x00274803, 0x0003ee03, 0x0003ef03, 0x00275b03, 0x0003f003, 0x0003f103, 0x00276e03,
+	0x00006503, 0x00277a03, 0x0003f303, 0x0003f403, 0x00278d03, 0x0003f503, 0x0003f603, 0x0027a003,
+	0x0003f703, 0x0027ac03, 0x0003f803, 0x0003f903, 0x0027bf03, 0x0003fa03, 0x0003fb03, 0x0027d203,
+	0x00006603, 0x0027de03, 0x0003fd03, 0x0003fe03, 0x0027f103, 0x0003ff03, 0x00040003, 0x00280403,
+	0x00040103, 0x00281003, 0x00040203, 0x00040303, 0x00282303, 0x00040403, 0x00040503, 0x00283603,
+	0x00006703, 0x00284203, 0x00040703, 0x00040803, 0x00285503, 0x00040903, 0x00040a03, 0x00286803,
+	0x00040b03, 0x00287403, 0x00040c03, 0x00040d03, 0x00288703, 0x00040e03, 0x00040f03, 0x00289a03,
+	0x00006803, 0x0028a603, 0x00041103, 0x00041203, 0x0028b903, 0x00041303, 0x00041403, 0x0028cc03,
+	0x00041503, 0x0028d803, 0x00041603, 0x00041703, 0x0028eb03, 0x00041803, 0x00041903, 0x0028fe03,
+	0x00006903, 0x00290a03, 0x00041b03, 0x00041c03, 0x00291d03, 0x00041d03, 0x00041e03, 0x00293003,
+	0x00041f03, 0x00293c03, 0x00042003, 0x00042103, 0x00294f03, 0x00042203, 0x00042303, 0x00296203,
+	0x00006a03, 0x00296e03, 0x00042503, 0x00042603, 0x00298103, 0x00042703, 0x00042803, 0x00299403,
+	0x00042903, 0x0029a003, 0x00042a03, 0x00042b03, 0x0029b303, 0x00042c03, 0x00042d03, 0x0029c603,
+	0x00006b03, 0x0029d203, 0x00042f03, 0x00043003, 0x0029e503, 0x00043103, 0x00043203, 0x0029f803,
+	0x00043303, 0x002a0403, 0x00043403, 0x00043503, 0x002a1703, 0x00043603, 0x00043703, 0x002a2a03,
+	0x00006c03, 0x002a3603, 0x00043903, 0x00043a03, 0x002a4903, 0x00043b03, 0x00043c03, 0x002a5c03,
+	0x00043d03, 0x002a6803, 0x00043e03, 0x00043f03, 0x002a7b03, 0x00044003, 0x00044103, 0x002a8e03,
+	0x00006d03, 0x002a9a03, 0x00044303, 0x00044403, 0x002aad03, 0x00044503, 0x00044603, 0x002ac003,
+	0x00044703, 0x002acc03, 0x00044803, 0x00044903, 0x002adf03, 0x00044a03, 0x00044b03, 0x002af203,
+	0x00000b03, 0x002afe03, 0x00044d03, 0x00044e03, 0x002b1103, 0x00044f03, 0x00045003, 0x002b2403,
+	0x00045103, 0x002b3003, 0x00045203, 0x00045303, 0x002b4303, 0x00045403, 0x00045503, 0x002b5603,
+	0x00006f03, 0x002b6203, 0x00045703, 0x00045803, 0x002b7503, 0x00045903, 0x00045a03, 0x002b8803,
+	0x00045b03, 0x002b9403, 0x00045c03, 0x00045d03, 0x002ba703, 0x00045e03, 0x00045f03, 0x002bba03,
+	0x00007003, 0x002bc603, 0x00046103, 0x00046203, 0x002bd903, 0x00046303, 0x00046403, 0x002bec03,
+	0x00046503, 0x002bf803, 0x00046603, 0x00046703, 0x002c0b03, 0x00046803, 0x00046903, 0x002c1e03,
+	0x00007103, 0x002c2a03, 0x00046b03, 0x00046c03, 0x002c3d03, 0x00046d03, 0x00046e03, 0x002c5003,
+	0x00046f03, 0x002c5c03, 0x00047003, 0x00047103, 0x002c6f03, 0x00047203, 0x00047303, 0x002c8203,
+	0x00007203, 0x002c8e03, 0x00047503, 0x00047603, 0x002ca103, 0x00047703, 0x00047803, 0x002cb403,
+	0x00047903, 0x002cc003, 0x00047a03, 0x00047b03, 0x002cd303, 0x00047c03, 0x00047d03, 0x002ce603,
+	0x00007303, 0x002cf203, 0x00047f03, 0x00048003, 0x002d0503, 0x00048103, 0x00048203, 0x002d1803,
+	0x00048303, 0x002d2403, 0x00048403, 0x00048503, 0x002d3703, 0x00048603, 0x00048703, 0x002d4a03,
+	0x00007403, 0x002d5603, 0x00048903, 0x00048a03, 0x002d6903, 0x00048b03, 0x00048c03, 0x002d7c03,
+	0x00048d03, 0x002d8803, 0x00048e03, 0x00048f03, 0x002d9b03, 0x00049003, 0x00049103, 0x002dae03,
+	0x00007503, 0x002dba03, 0x00049303, 0x00049403, 0x002dcd03, 0x00049503, 0x00049603, 0x002de003,
+	0x00049703, 0x002dec03, 0x00049803, 0x00049903, 0x002dff03, 0x00049a03, 0x00049b03, 0x002e1203,
+	0x00007603, 0x002e1e03, 0x00049d03, 0x00049e03, 0x002e3103, 0x00049f03, 0x0004a003, 0x002e4403,
+	0x0004a103, 0x002e5003, 0x0004a203, 0x0004a303, 0x002e6303, 0x0004a403, 0x0004a503, 0x002e7603,
+	0x00007703, 0x002e8203, 0x0004a703, 0x0004a803, 0x002e9503, 0x0004a903, 0x0004aa03, 0x002ea803,
+	0x0004ab03, 0x002eb403, 0x0004ac03, 0x0004ad03, 0x002ec703, 0x0004ae03, 0x0004af03, 0x002eda03,
+	0x00000c03, 0x002ee603, 0x0004b103, 0x0004b203, 0x002ef903, 0x0004b303, 0x0004b403, 0x002f0c03,
+	0x0004b503, 0x002f1803, 0x0004b603, 0x0004b703, 0x002f2b03, 0x0004b803, 0x0004b903, 0x002f3e03,
+	0x00007903, 0x002f4a03, 0x0004bb03, 0x0004bc03, 0x002f5d03, 0x0004bd03, 0x0004be03, 0x002f7003,
+	0x0004bf03, 0x002f7c03, 0x0004c003, 0x0004c103, 0x002f8f03, 0x0004c203, 0x0004c303, 0x002fa203,
+	0x00007a03, 0x002fae03, 0x0004c503, 0x0004c603, 0x002fc103, 0x0004c703, 0x0004c803, 0x002fd403,
+	0x0004c903, 0x002fe003, 0x0004ca03, 0x0004cb03, 0x002ff303, 0x0004cc03, 0x0004cd03, 0x00300603,
+	0x00007b03, 0x00301203, 0x0004cf03, 0x0004d003, 0x00302503, 0x0004d103, 0x0004d203, 0x00303803,
+	0x0004d303, 0x00304403, 0x0004d403, 0x0004d503, 0x00305703, 0x0004d603, 0x0004d703, 0x00306a03,
+	0x00007c03, 0x00307603, 0x0004d903, 0x0004da03, 0x00308903, 0x0004db03, 0x0004dc03, 0x00309c03,
+	0x0004dd03, 0x0030a803, 0x0004de03, 0x0004df03, 0x0030bb03, 0x0004e003, 0x0004e103, 0x0030ce03,
+	0x00007d03, 0x0030da03, 0x0004e303, 0x0004e403, 0x0030ed03, 0x0004e503, 0x0004e603, 0x00310003,
+	0x0004e703, 0x00310c03, 0x0004e803, 0x0004e903, 0x00311f03, 0x0004ea03, 0x0004eb03, 0x00313203,
+	0x00007e03, 0x00313e03, 0x0004ed03, 0x0004ee03, 0x00315103, 0x0004ef03, 0x0004f003, 0x00316403,
+	0x0004f103, 0x00317003, 0x0004f203, 0x0004f303, 0x00318303, 0x0004f403, 0x0004f503, 0x00319603,
+	0x00007f03, 0x0031a203, 0x0004f703, 0x0004f803, 0x0031b503, 0x0004f903, 0x0004fa03, 0x0031c803,
+	0x0004fb03, 0x0031d403, 0x0004fc03, 0x0004fd03, 0x0031e703, 0x0004fe03, 0x0004ff03, 0x0031fa03,
+	0x00008003, 0x00050103, 0x00050203, 0x00050403, 0x00050503, 0x00050603, 0x00050803, 0x00050903,
+	0x00008103, 0x00050b03, 0x00050c03, 0x00050e03, 0x00050f03, 0x00051003, 0x00051203, 0x00051303,
+	0x00000d03, 0x00051503, 0x00051603, 0x00051803, 0x00051903, 0x00051a03, 0x00051c03, 0x00051d03,
+	0x00008303, 0x00051f03, 0x00052003, 0x00052203, 0x00052303, 0x00052403, 0x00052603, 0x00052703,
+	0x00008403, 0x00052903, 0x00052a03, 0x00052c03, 0x00052d03, 0x00052e03, 0x00053003, 0x00053103,
+	0x00008503, 0x00053303, 0x00053403, 0x00053603, 0x00053703, 0x00053803, 0x00053a03, 0x00053b03,
+	0x00008603, 0x00053d03, 0x00053e03, 0x00054003, 0x00054103, 0x00054203, 0x00054403, 0x00054503,
+	0x00008703, 0x00054703, 0x00054803, 0x00054a03, 0x00054b03, 0x00054c03, 0x00054e03, 0x00054f03,
+	0x00008803, 0x00055103, 0x00055203, 0x00055403, 0x00055503, 0x00055603, 0x00055803, 0x00055903,
+	0x00008903, 0x00055b03, 0x00055c03, 0x00055e03, 0x00055f03, 0x00056003, 0x00056203, 0x00056303,
+	0x00008a03, 0x00056503, 0x00056603, 0x00056803, 0x00056903, 0x00056a03, 0x00056c03, 0x00056d03,
+	0x00008b03, 0x00056f03, 0x00057003, 0x00057203, 0x00057303, 0x00057403, 0x00057603, 0x00057703,
+	0x00000e03, 0x00057903, 0x00057a03, 0x00057c03, 0x00057d03, 0x00057e03, 0x00058003, 0x00058103,
+	0x00008d03, 0x00058303, 0x00058403, 0x00058603, 0x00058703, 0x00058803, 0x00058a03, 0x00058b03,
+	0x00008e03, 0x00058d03, 0x00058e03, 0x00059003, 0x00059103, 0x00059203, 0x00059403, 0x00059503,
+	0x00008f03, 0x00059703, 0x00059803, 0x00059a03, 0x00059b03, 0x00059c03, 0x00059e03, 0x00059f03,
+	0x00009003, 0x0005a103, 0x0005a203, 0x0005a403, 0x0005a503, 0x0005a603, 0x0005a803, 0x0005a903,
+	0x00009103, 0x0005ab03, 0x0005ac03, 0x0005ae03, 0x0005af03, 0x0005b003, 0x0005b203, 0x0005b303,
+	0x00009203, 0x0005b503, 0x0005b603, 0x0005b803, 0x0005b903, 0x0005ba03, 0x0005bc03, 0x0005bd03,
+	0x00009303, 0x0005bf03, 0x0005c003, 0x0005c203, 0x0005c303, 0x0005c403, 0x0005c603, 0x0005c703,
+	0x00009403, 0x0005c903, 0x0005ca03, 0x0005cc03, 0x0005cd03, 0x0005ce03, 0x0005d003, 0x0005d103,
+	0x00009503, 0x0005d303, 0x0005d403, 0x0005d603, 0x0005d703, 0x0005d803, 0x0005da03, 0x0005db03,
+	0x00000f03, 0x0005dd03, 0x0005de03, 0x0005e003, 0x0005e103, 0x0005e203, 0x0005e403, 0x0005e503,
+	0x00009703, 0x0005e703, 0x0005e803, 0x0005ea03, 0x0005eb03, 0x0005ec03, 0x0005ee03, 0x0005ef03,
+	0x00009803, 0x0005f103, 0x0005f203, 0x0005f403, 0x0005f503, 0x0005f603, 0x0005f803, 0x0005f903,
+	0x00009903, 0x0005fb03, 0x0005fc03, 0x0005fe03, 0x0005ff03, 0x00060003, 0x00060203, 0x00060303,
+	0x00009a03, 0x00060503, 0x00060603, 0x00060803, 0x00060903, 0x00060a03, 0x00060c03, 0x00060d03,
+	0x00009b03, 0x00060f03, 0x00061003, 0x00061203, 0x00061303, 0x00061403, 0x00061603, 0x00061703,
+	0x00009c03, 0x00061903, 0x00061a03, 0x00061c03, 0x00061d03, 0x00061e03, 0x00062003, 0x00062103,
+	0x00009d03, 0x00062303, 0x00062403, 0x00062603, 0x00062703, 0x00062803, 0x00062a03, 0x00062b03,
+	0x00009e03, 0x00062d03, 0x00062e03, 0x00063003, 0x00063103, 0x00063203, 0x00063403, 0x00063503,
+	0x00009f03, 0x00063703, 0x00063803, 0x00063a03, 0x00063b03, 0x00063c03, 0x00063e03, 0x00063f03,
+	0x00001003, 0x00064103, 0x00064203, 0x00064403, 0x00064503, 0x00064603, 0x00064803, 0x00064903,
+	0x0000a103, 0x00064b03, 0x00064c03, 0x00064e03, 0x00064f03, 0x00065003, 0x00065203, 0x00065303,
+	0x0000a203, 0x00065503, 0x00065603, 0x00065803, 0x00065903, 0x00065a03, 0x00065c03, 0x00065d03,
+	0x0000a303, 0x00065f03, 0x00066003, 0x00066203, 0x00066303, 0x00066403, 0x00066603, 0x00066703,
+	0x0000a403, 0x00066903, 0x00066a03, 0x00066c03, 0x00066d03, 0x00066e03, 0x00067003, 0x00067103,
+	0x0000a503, 0x00067303, 0x00067403, 0x00067603, 0x00067703, 0x00067803, 0x00067a03, 0x00067b03,
+	0x0000a603, 0x00067d03, 0x00067e03, 0x00068003, 0x00068103, 0x00068203, 0x00068403, 0x00068503,
+	0x0000a703, 0x00068703, 0x00068803, 0x00068a03, 0x00068b03, 0x00068c03, 0x00068e03, 0x00068f03,
+	0x0000a803, 0x00069103, 0x00069203, 0x00069403, 0x00069503, 0x00069603, 0x00069803, 0x00069903,
+	0x0000a903, 0x00069b03, 0x00069c03, 0x00069e03, 0x00069f03, 0x0006a003, 0x0006a203, 0x0006a303,
+	0x00001103, 0x0006a503, 0x0006a603, 0x0006a803, 0x0006a903, 0x0006aa03, 0x0006ac03, 0x0006ad03,
+	0x0000ab03, 0x0006af03, 0x0006b003, 0x0006b203, 0x0006b303, 0x0006b403, 0x0006b603, 0x0006b703,
+	0x0000ac03, 0x0006b903, 0x0006ba03, 0x0006bc03, 0x0006bd03, 0x0006be03, 0x0006c003, 0x0006c103,
+	0x0000ad03, 0x0006c303, 0x0006c403, 0x0006c603, 0x0006c703, 0x0006c803, 0x0006ca03, 0x0006cb03,
+	0x0000ae03, 0x0006cd03, 0x0006ce03, 0x0006d003, 0x0006d103, 0x0006d203, 0x0006d403, 0x0006d503,
+	0x0000af03, 0x0006d703, 0x0006d803, 0x0006da03, 0x0006db03, 0x0006dc03, 0x0006de03, 0x0006df03,
+	0x0000b003, 0x0006e103, 0x0006e203, 0x0006e403, 0x0006e503, 0x0006e603, 0x0006e803, 0x0006e903,
+	0x0000b103, 0x0006eb03, 0x0006ec03, 0x0006ee03, 0x0006ef03, 0x0006f003, 0x0006f203, 0x0006f303,
+	0x0000b203, 0x0006f503, 0x0006f603, 0x0006f803, 0x0006f903, 0x0006fa03, 0x0006fc03, 0x0006fd03,
+	0x0000b303, 0x0006ff03, 0x00070003, 0x00070203, 0x00070303, 0x00070403, 0x00070603, 0x00070703,
+	0x00001203, 0x00070903, 0x00070a03, 0x00070c03, 0x00070d03, 0x00070e03, 0x00071003, 0x00071103,
+	0x0000b503, 0x00071303, 0x00071403, 0x00071603, 0x00071703, 0x00071803, 0x00071a03, 0x00071b03,
+	0x0000b603, 0x00071d03, 0x00071e03, 0x00072003, 0x00072103, 0x00072203, 0x00072403, 0x00072503,
+	0x0000b703, 0x00072703, 0x00072803, 0x00072a03, 0x00072b03, 0x00072c03, 0x00072e03, 0x00072f03,
+	0x0000b803, 0x00073103, 0x00073203, 0x00073403, 0x00073503, 0x00073603, 0x00073803, 0x00073903,
+	0x0000b903, 0x00073b03, 0x00073c03, 0x00073e03, 0x00073f03, 0x00074003, 0x00074203, 0x00074303,
+	0x0000ba03, 0x00074503, 0x00074603, 0x00074803, 0x00074903, 0x00074a03, 0x00074c03, 0x00074d03,
+	0x0000bb03, 0x00074f03, 0x00075003, 0x00075203, 0x00075303, 0x00075403, 0x00075603, 0x00075703,
+	0x0000bc03, 0x00075903, 0x00075a03, 0x00075c03, 0x00075d03, 0x00075e03, 0x00076003, 0x00076103,
+	0x0000bd03, 0x00076303, 0x00076403, 0x00076603, 0x00076703, 0x00076803, 0x00076a03, 0x00076b03,
+	0x00001303, 0x00076d03, 0x00076e03, 0x00077003, 0x00077103, 0x00077203, 0x00077403, 0x00077503,
+	0x0000bf03, 0x00077703, 0x00077803, 0x00077a03, 0x00077b03, 0x00077c03, 0x00077e03, 0x00077f03,
+	0x0000c003, 0x00078103, 0x00078203, 0x00078403, 0x00078503, 0x00078603, 0x00078803, 0x00078903,
+	0x0000c103, 0x00078b03, 0x00078c03, 0x00078e03, 0x00078f03, 0x00079003, 0x00079203, 0x00079303,
+	0x0000c203, 0x00079503, 0x00079603, 0x00079803, 0x00079903, 0x00079a03, 0x00079c03, 0x00079d03,
+	0x0000c303, 0x00079f03, 0x0007a003, 0x0007a203, 0x0007a303, 0x0007a403, 0x0007a603, 0x0007a703,
+	0x0000c403, 0x0007a903, 0x0007aa03, 0x0007ac03, 0x0007ad03, 0x0007ae03, 0x0007b003, 0x0007b103,
+	0x0000c503, 0x0007b303, 0x0007b403, 0x0007b603, 0x0007b703, 0x0007b803, 0x0007ba03, 0x0007bb03,
+	0x0000c603, 0x0007bd03, 0x0007be03, 0x0007c003, 0x0007c103, 0x0007c203, 0x0007c403, 0x0007c503,
+	0x0000c703, 0x0007c703, 0x0007c803, 0x0007ca03, 0x0007cb03, 0x0007cc03, 0x0007ce03, 0x0007cf03,
+	0x00000203, 0x0007d103, 0x0007d203, 0x0007d403, 0x0007d503, 0x0007d603, 0x0007d803, 0x0007d903,
+	0x0000c903, 0x0007db03, 0x0007dc03, 0x0007de03, 0x0007df03, 0x0007e003, 0x0007e203, 0x0007e303,
+	0x0000ca03, 0x0007e503, 0x0007e603, 0x0007e803, 0x0007e903, 0x0007ea03, 0x0007ec03, 0x0007ed03,
+	0x0000cb03, 0x0007ef03, 0x0007f003, 0x0007f203, 0x0007f303, 0x0007f403, 0x0007f603, 0x0007f703,
+	0x0000cc03, 0x0007f903, 0x0007fa03, 0x0007fc03, 0x0007fd03, 0x0007fe03, 0x00080003, 0x00080103,
+	0x0000cd03, 0x00080303, 0x00080403, 0x00080603, 0x00080703, 0x00080803, 0x00080a03, 0x00080b03,
+	0x0000ce03, 0x00080d03, 0x00080e03, 0x00081003, 0x00081103, 0x00081203, 0x00081403, 0x00081503,
+	0x0000cf03, 0x00081703, 0x00081803, 0x00081a03, 0x00081b03, 0x00081c03, 0x00081e03, 0x00081f03,
+	0x0000d003, 0x00082103, 0x00082203, 0x00082403, 0x00082503, 0x00082603, 0x00082803, 0x00082903,
+	0x0000d103, 0x00082b03, 0x00082c03, 0x00082e03, 0x00082f03, 0x00083003, 0x00083203, 0x00083303,
+	0x00001503, 0x00083503, 0x00083603, 0x00083803, 0x00083903, 0x00083a03, 0x00083c03, 0x00083d03,
+	0x0000d303, 0x00083f03, 0x00084003, 0x00084203, 0x00084303, 0x00084403, 0x00084603, 0x00084703,
+	0x0000d403, 0x00084903, 0x00084a03, 0x00084c03, 0x00084d03, 0x00084e03, 0x00085003, 0x00085103,
+	0x0000d503, 0x00085303, 0x00085403, 0x00085603, 0x00085703, 0x00085803, 0x00085a03, 0x00085b03,
+	0x0000d603, 0x00085d03, 0x00085e03, 0x00086003, 0x00086103, 0x00086203, 0x00086403, 0x00086503,
+	0x0000d703, 0x00086703, 0x00086803, 0x00086a03, 0x00086b03, 0x00086c03, 0x00086e03, 0x00086f03,
+	0x0000d803, 0x00087103, 0x00087203, 0x00087403, 0x00087503, 0x00087603, 0x00087803, 0x00087903,
+	0x0000d903, 0x00087b03, 0x00087c03, 0x00087e03, 0x00087f03, 0x00088003, 0x00088203, 0x00088303,
+	0x0000da03, 0x00088503, 0x00088603, 0x00088803, 0x00088903, 0x00088a03, 0x00088c03, 0x00088d03,
+	0x0000db03, 0x00088f03, 0x00089003, 0x00089203, 0x00089303, 0x00089403, 0x00089603, 0x00089703,
+	0x00001603, 0x00089903, 0x00089a03, 0x00089c03, 0x00089d03, 0x00089e03, 0x0008a003, 0x0008a103,
+	0x0000dd03, 0x0008a303, 0x0008a403, 0x0008a603, 0x0008a703, 0x0008a803, 0x0008aa03, 0x0008ab03,
+	0x0000de03, 0x0008ad03, 0x0008ae03, 0x0008b003, 0x0008b103, 0x0008b203, 0x0008b403, 0x0008b503,
+	0x0000df03, 0x0008b703, 0x0008b803, 0x0008ba03, 0x0008bb03, 0x0008bc03, 0x0008be03, 0x0008bf03,
+	0x0000e003, 0x0008c103, 0x0008c203, 0x0008c403, 0x0008c503, 0x0008c603, 0x0008c803, 0x0008c903,
+	0x0000e103, 0x0008cb03, 0x0008cc03, 0x0008ce03, 0x0008cf03, 0x0008d003, 0x0008d203, 0x0008d303,
+	0x0000e203, 0x0008d503, 0x0008d603, 0x0008d803, 0x0008d903, 0x0008da03, 0x0008dc03, 0x0008dd03,
+	0x0000e303, 0x0008df03, 0x0008e003, 0x0008e203, 0x0008e303, 0x0008e403, 0x0008e603, 0x0008e703,
+	0x0000e403, 0x0008e903, 0x0008ea03, 0x0008ec03, 0x0008ed03, 0x0008ee03, 0x0008f003, 0x0008f103,
+	0x0000e503, 0x0008f303, 0x0008f403, 0x0008f603, 0x0008f703, 0x0008f803, 0x0008fa03, 0x0008fb03,
+	0x00001703, 0x0008fd03, 0x0008fe03, 0x00090003, 0x00090103, 0x00090203, 0x00090403, 0x00090503,
+	0x0000e703, 0x00090703, 0x00090803, 0x00090a03, 0x00090b03, 0x00090c03, 0x00090e03, 0x00090f03,
+	0x0000e803, 0x00091103, 0x00091203, 0x00091403, 0x00091503, 0x00091603, 0x00091803, 0x00091903,
+	0x0000e903, 0x00091b03, 0x00091c03, 0x00091e03, 0x00091f03, 0x00092003, 0x00092203, 0x00092303,
+	0x0000ea03, 0x00092503, 0x00092603, 0x00092803, 0x00092903, 0x00092a03, 0x00092c03, 0x00092d03,
+	0x0000eb03, 0x00092f03, 0x00093003, 0x00093203, 0x00093303, 0x00093403, 0x00093603, 0x00093703,
+	0x0000ec03, 0x00093903, 0x00093a03, 0x00093c03, 0x00093d03, 0x00093e03, 0x00094003, 0x00094103,
+	0x0000ed03, 0x00094303, 0x00094403, 0x00094603, 0x00094703, 0x00094803, 0x00094a03, 0x00094b03,
+	0x0000ee03, 0x00094d03, 0x00094e03, 0x00095003, 0x00095103, 0x00095203, 0x00095403, 0x00095503,
+	0x0000ef03, 0x00095703, 0x00095803, 0x00095a03, 0x00095b03, 0x00095c03, 0x00095e03, 0x00095f03,
+	0x00001803, 0x00096103, 0x00096203, 0x00096403, 0x00096503, 0x00096603, 0x00096803, 0x00096903,
+	0x0000f103, 0x00096b03, 0x00096c03, 0x00096e03, 0x00096f03, 0x00097003, 0x00097203, 0x00097303,
+	0x0000f203, 0x00097503, 0x00097603, 0x00097803, 0x00097903, 0x00097a03, 0x00097c03, 0x00097d03,
+	0x0000f303, 0x00097f03, 0x00098003, 0x00098203, 0x00098303, 0x00098403, 0x00098603, 0x00098703,
+	0x0000f403, 0x00098903, 0x00098a03, 0x00098c03, 0x00098d03, 0x00098e03, 0x00099003, 0x00099103,
+	0x0000f503, 0x00099303, 0x00099403, 0x00099603, 0x00099703, 0x00099803, 0x00099a03, 0x00099b03,
+	0x0000f603, 0x00099d03, 0x00099e03, 0x0009a003, 0x0009a103, 0x0009a203, 0x0009a403, 0x0009a503,
+	0x0000f703, 0x0009a703, 0x0009a803, 0x0009aa03, 0x0009ab03, 0x0009ac03, 0x0009ae03, 0x0009af03,
+	0x0000f803, 0x0009b103, 0x0009b203, 0x0009b403, 0x0009b503, 0x0009b603, 0x0009b803, 0x0009b903,
+	0x0000f903, 0x0009bb03, 0x0009bc03, 0x0009be03, 0x0009bf03, 0x0009c003, 0x0009c203, 0x0009c303,
+	0x00001903, 0x0009c503, 0x0009c603, 0x0009c803, 0x0009c903, 0x0009ca03, 0x0009cc03, 0x0009cd03,
+	0x0000fb03, 0x0009cf03, 0x0009d003, 0x0009d203, 0x0009d303, 0x0009d403, 0x0009d603, 0x0009d703,
+	0x0000fc03, 0x0009d903, 0x0009da03, 0x0009dc03, 0x0009dd03, 0x0009de03, 0x0009e003, 0x0009e103,
+	0x0000fd03, 0x0009e303, 0x0009e403, 0x0009e603, 0x0009e703, 0x0009e803, 0x0009ea03, 0x0009eb03,
+	0x0000fe03, 0x0009ed03, 0x0009ee03, 0x0009f003, 0x0009f103, 0x0009f203, 0x0009f403, 0x0009f503,
+	0x0000ff03, 0x0009f703, 0x0009f803, 0x0009fa03, 0x0009fb03, 0x0009fc03, 0x0009fe03, 0x0009ff03,
+	0x00010003, 0x000a0203, 0x000a0503, 0x000a0803, 0x00010103, 0x000a0c03, 0x000a0f03, 0x000a1203,
+	0x00010203, 0x000a1603, 0x000a1903, 0x000a1c03, 0x00010303, 0x000a2003, 0x000a2303, 0x000a2603,
+	0x00001a03, 0x000a2a03, 0x000a2d03, 0x000a3003, 0x00010503, 0x000a3403, 0x000a3703, 0x000a3a03,
+	0x00010603, 0x000a3e03, 0x000a4103, 0x000a4403, 0x00010703, 0x000a4803, 0x000a4b03, 0x000a4e03,
+	0x00010803, 0x000a5203, 0x000a5503, 0x000a5803, 0x00010903, 0x000a5c03, 0x000a5f03, 0x000a6203,
+	0x00010a03, 0x000a6603, 0x000a6903, 0x000a6c03, 0x00010b03, 0x000a7003, 0x000a7303, 0x000a7603,
+	0x00010c03, 0x000a7a03, 0x000a7d03, 0x000a8003, 0x00010d03, 0x000a8403, 0x000a8703, 0x000a8a03,
+	0x00001b03, 0x000a8e03, 0x000a9103, 0x000a9403, 0x00010f03, 0x000a9803, 0x000a9b03, 0x000a9e03,
+	0x00011003, 0x000aa203, 0x000aa503, 0x000aa803, 0x00011103, 0x000aac03, 0x000aaf03, 0x000ab203,
+	0x00011203, 0x000ab603, 0x000ab903, 0x000abc03, 0x00011303, 0x000ac003, 0x000ac303, 0x000ac603,
+	0x00011403, 0x000aca03, 0x000acd03, 0x000ad003, 0x00011503, 0x000ad403, 0x000ad703, 0x000ada03,
+	0x00011603, 0x000ade03, 0x000ae103, 0x000ae403, 0x00011703, 0x000ae803, 0x000aeb03, 0x000aee03,
+	0x00001c03, 0x000af203, 0x000af503, 0x000af803, 0x00011903, 0x000afc03, 0x000aff03, 0x000b0203,
+	0x00011a03, 0x000b0603, 0x000b0903, 0x000b0c03, 0x00011b03, 0x000b1003, 0x000b1303, 0x000b1603,
+	0x00011c03, 0x000b1a03, 0x000b1d03, 0x000b2003, 0x00011d03, 0x000b2403, 0x000b2703, 0x000b2a03,
+	0x00011e03, 0x000b2e03, 0x000b3103, 0x000b3403, 0x00011f03, 0x000b3803, 0x000b3b03, 0x000b3e03,
+	0x00012003, 0x000b4203, 0x000b4503, 0x000b4803, 0x00012103, 0x000b4c03, 0x000b4f03, 0x000b5203,
+	0x00001d03, 0x000b5603, 0x000b5903, 0x000b5c03, 0x00012303, 0x000b6003, 0x000b6303, 0x000b6603,
+	0x00012403, 0x000b6a03, 0x000b6d03, 0x000b7003, 0x00012503, 0x000b7403, 0x000b7703, 0x000b7a03,
+	0x00012603, 0x000b7e03, 0x000b8103, 0x000b8403, 0x00012703, 0x000b8803, 0x000b8b03, 0x000b8e03,
+	0x00012803, 0x000b9203, 0x000b9503, 0x000b9803, 0x00012903, 0x000b9c03, 0x000b9f03, 0x000ba203,
+	0x00012a03, 0x000ba603, 0x000ba903, 0x000bac03, 0x00012b03, 0x000bb003, 0x000bb303, 0x000bb603,
+	0x00000303, 0x000bba03, 0x000bbd03, 0x000bc003, 0x00012d03, 0x000bc403, 0x000bc703, 0x000bca03,
+	0x00012e03, 0x000bce03, 0x000bd103, 0x000bd403, 0x00012f03, 0x000bd803, 0x000bdb03, 0x000bde03,
+	0x00013003, 0x000be203, 0x000be503, 0x000be803, 0x00013103, 0x000bec03, 0x000bef03, 0x000bf203,
+	0x00013203, 0x000bf603, 0x000bf903, 0x000bfc03, 0x00013303, 0x000c0003, 0x000c0303, 0x000c0603,
+	0x00013403, 0x000c0a03, 0x000c0d03, 0x000c1003, 0x00013503, 0x000c1403, 0x000c1703, 0x000c1a03,
+	0x00001f03, 0x000c1e03, 0x000c2103, 0x000c2403, 0x00013703, 0x000c2803, 0x000c2b03, 0x000c2e03,
+	0x00013803, 0x000c3203, 0x000c3503, 0x000c3803, 0x00013903, 0x000c3c03, 0x000c3f03, 0x000c4203,
+	0x00013a03, 0x000c4603, 0x000c4903, 0x000c4c03, 0x00013b03, 0x000c5003, 0x000c5303, 0x000c5603,
+	0x00013c03, 0x000c5a03, 0x000c5d03, 0x000c6003, 0x00013d03, 0x000c6403, 0x000c6703, 0x000c6a03,
+	0x00013e03, 0x000c6e03, 0x000c7103, 0x000c7403, 0x00013f03, 0x000c7803, 0x000c7b03, 0x000c7e03,
+	0x00002003, 0x000c8203, 0x000c8503, 0x000c8803, 0x00014103, 0x000c8c03, 0x000c8f03, 0x000c9203,
+	0x00014203, 0x000c9603, 0x000c9903, 0x000c9c03, 0x00014303, 0x000ca003, 0x000ca303, 0x000ca603,
+	0x00014403, 0x000caa03, 0x000cad03, 0x000cb003, 0x00014503, 0x000cb403, 0x000cb703, 0x000cba03,
+	0x00014603, 0x000cbe03, 0x000cc103, 0x000cc403, 0x00014703, 0x000cc803, 0x000ccb03, 0x000cce03,
+	0x00014803, 0x000cd203, 0x000cd503, 0x000cd803, 0x00014903, 0x000cdc03, 0x000cdf03, 0x000ce203,
+	0x00002103, 0x000ce603, 0x000ce903, 0x000cec03, 0x00014b03, 0x000cf003, 0x000cf303, 0x000cf603,
+	0x00014c03, 0x000cfa03, 0x000cfd03, 0x000d0003, 0x00014d03, 0x000d0403, 0x000d0703, 0x000d0a03,
+	0x00014e03, 0x000d0e03, 0x000d1103, 0x000d1403, 0x00014f03, 0x000d1803, 0x000d1b03, 0x000d1e03,
+	0x00015003, 0x000d2203, 0x000d2503, 0x000d2803, 0x00015103, 0x000d2c03, 0x000d2f03, 0x000d3203,
+	0x00015203, 0x000d3603, 0x000d3903, 0x000d3c03, 0x00015303, 0x000d4003, 0x000d4303, 0x000d4603,
+	0x00002203, 0x000d4a03, 0x000d4d03, 0x000d5003, 0x00015503, 0x000d5403, 0x000d5703, 0x000d5a03,
+	0x00015603, 0x000d5e03, 0x000d6103, 0x000d6403, 0x00015703, 0x000d6803, 0x000d6b03, 0x000d6e03,
+	0x00015803, 0x000d7203, 0x000d7503, 0x000d7803, 0x00015903, 0x000d7c03, 0x000d7f03, 0x000d8203,
+	0x00015a03, 0x000d8603, 0x000d8903, 0x000d8c03, 0x00015b03, 0x000d9003, 0x000d9303, 0x000d9603,
+	0x00015c03, 0x000d9a03, 0x000d9d03, 0x000da003, 0x00015d03, 0x000da403, 0x000da703, 0x000daa03,
+	0x00002303, 0x000dae03, 0x000db103, 0x000db403, 0x00015f03, 0x000db803, 0x000dbb03, 0x000dbe03,
+	0x00016003, 0x000dc203, 0x000dc503, 0x000dc803, 0x00016103, 0x000dcc03, 0x000dcf03, 0x000dd203,
+	0x00016203, 0x000dd603, 0x000dd903, 0x000ddc03, 0x00016303, 0x000de003, 0x000de303, 0x000de603,
+	0x00016403, 0x000dea03, 0x000ded03, 0x000df003, 0x00016503, 0x000df403, 0x000df703, 0x000dfa03,
+	0x00016603, 0x000dfe03, 0x000e0103, 0x000e0403, 0x00016703, 0x000e0803, 0x000e0b03, 0x000e0e03,
+	0x00002403, 0x000e1203, 0x000e1503, 0x000e1803, 0x00016903, 0x000e1c03, 0x000e1f03, 0x000e2203,
+	0x00016a03, 0x000e2603, 0x000e2903, 0x000e2c03, 0x00016b03, 0x000e3003, 0x000e3303, 0x000e3603,
+	0x00016c03, 0x000e3a03, 0x000e3d03, 0x000e4003, 0x00016d03, 0x000e4403, 0x000e4703, 0x000e4a03,
+	0x00016e03, 0x000e4e03, 0x000e5103, 0x000e5403, 0x00016f03, 0x000e5803, 0x000e5b03, 0x000e5e03,
+	0x00017003, 0x000e6203, 0x000e6503, 0x000e6803, 0x00017103, 0x000e6c03, 0x000e6f03, 0x000e7203,
+	0x00002503, 0x000e7603, 0x000e7903, 0x000e7c03, 0x00017303, 0x000e8003, 0x000e8303, 0x000e8603,
+	0x00017403, 0x000e8a03, 0x000e8d03, 0x000e9003, 0x00017503, 0x000e9403, 0x000e9703, 0x000e9a03,
+	0x00017603, 0x000e9e03, 0x000ea103, 0x000ea403, 0x00017703, 0x000ea803, 0x000eab03, 0x000eae03,
+	0x00017803, 0x000eb203, 0x000eb503, 0x000eb803, 0x00017903, 0x000ebc03, 0x000ebf03, 0x000ec203,
+	0x00017a03, 0x000ec603, 0x000ec903, 0x000ecc03, 0x00017b03, 0x000ed003, 0x000ed303, 0x000ed603,
+	0x00002603, 0x000eda03, 0x000edd03, 0x000ee003, 0x00017d03, 0x000ee403, 0x000ee703, 0x000eea03,
+	0x00017e03, 0x000eee03, 0x000ef103, 0x000ef403, 0x00017f03, 0x000ef803, 0x000efb03, 0x000efe03,
+	0x00018003, 0x000f0203, 0x000f0503, 0x000f0803, 0x00018103, 0x000f0c03, 0x000f0f03, 0x000f1203,
+	0x00018203, 0x000f1603, 0x000f1903, 0x000f1c03, 0x00018303, 0x000f2003, 0x000f2303, 0x000f2603,
+	0x00018403, 0x000f2a03, 0x000f2d03, 0x000f3003, 0x00018503, 0x000f3403, 0x000f3703, 0x000f3a03,
+	0x00002703, 0x000f3e03, 0x000f4103, 0x000f4403, 0x00018703, 0x000f4803, 0x000f4b03, 0x000f4e03,
+	0x00018803, 0x000f5203, 0x000f5503, 0x000f5803, 0x00018903, 0x000f5c03, 0x000f5f03, 0x000f6203,
+	0x00018a03, 0x000f6603, 0x000f6903, 0x000f6c03, 0x00018b03, 0x000f7003, 0x000f7303, 0x000f7603,
+	0x00018c03, 0x000f7a03, 0x000f7d03, 0x000f8003, 0x00018d03, 0x000f8403, 0x000f8703, 0x000f8a03,
+	0x00018e03, 0x000f8e03, 0x000f9103, 0x000f9403, 0x00018f03, 0x000f9803, 0x000f9b03, 0x000f9e03,
+	0x00000403, 0x000fa203, 0x000fa503, 0x000fa803, 0x00019103, 0x000fac03, 0x000faf03, 0x000fb203,
+	0x00019203, 0x000fb603, 0x000fb903, 0x000fbc03, 0x00019303, 0x000fc003, 0x000fc303, 0x000fc603,
+	0x00019403, 0x000fca03, 0x000fcd03, 0x000fd003, 0x00019503, 0x000fd403, 0x000fd703, 0x000fda03,
+	0x00019603, 0x000fde03, 0x000fe103, 0x000fe403, 0x00019703, 0x000fe803, 0x000feb03, 0x000fee03,
+	0x00019803, 0x000ff203, 0x000ff503, 0x000ff803, 0x00019903, 0x000ffc03, 0x000fff03, 0x00100203,
+	0x00002903, 0x00100603, 0x00100903, 0x00100c03, 0x00019b03, 0x00101003, 0x00101303, 0x00101603,
+	0x00019c03, 0x00101a03, 0x00101d03, 0x00102003, 0x00019d03, 0x00102403, 0x00102703, 0x00102a03,
+	0x00019e03, 0x00102e03, 0x00103103, 0x00103403, 0x00019f03, 0x00103803, 0x00103b03, 0x00103e03,
+	0x0001a003, 0x00104203, 0x00104503, 0x00104803, 0x0001a103, 0x00104c03, 0x00104f03, 0x00105203,
+	0x0001a203, 0x00105603, 0x00105903, 0x00105c03, 0x0001a303, 0x00106003, 0x00106303, 0x00106603,
+	0x00002a03, 0x00106a03, 0x00106d03, 0x00107003, 0x0001a503, 0x00107403, 0x00107703, 0x00107a03,
+	0x0001a603, 0x00107e03, 0x00108103, 0x00108403, 0x0001a703, 0x00108803, 0x00108b03, 0x00108e03,
+	0x0001a803, 0x00109203, 0x00109503, 0x00109803, 0x0001a903, 0x00109c03, 0x00109f03, 0x0010a203,
+	0x0001aa03, 0x0010a603, 0x0010a903, 0x0010ac03, 0x0001ab03, 0x0010b003, 0x0010b303, 0x0010b603,
+	0x0001ac03, 0x0010ba03, 0x0010bd03, 0x0010c003, 0x0001ad03, 0x0010c403, 0x0010c703, 0x0010ca03,
+	0x00002b03, 0x0010ce03, 0x0010d103, 0x0010d403, 0x0001af03, 0x0010d803, 0x0010db03, 0x0010de03,
+	0x0001b003, 0x0010e203, 0x0010e503, 0x0010e803, 0x0001b103, 0x0010ec03, 0x0010ef03, 0x0010f203,
+	0x0001b203, 0x0010f603, 0x0010f903, 0x0010fc03, 0x0001b303, 0x00110003, 0x00110303, 0x00110603,
+	0x0001b403, 0x00110a03, 0x00110d03, 0x00111003, 0x0001b503, 0x00111403, 0x00111703, 0x00111a03,
+	0x0001b603, 0x00111e03, 0x00112103, 0x00112403, 0x0001b703, 0x00112803, 0x00112b03, 0x00112e03,
+	0x00002c03, 0x00113203, 0x00113503, 0x00113803, 0x0001b903, 0x00113c03, 0x00113f03, 0x00114203,
+	0x0001ba03, 0x00114603, 0x00114903, 0x00114c03, 0x0001bb03, 0x00115003, 0x00115303, 0x00115603,
+	0x0001bc03, 0x00115a03, 0x00115d03, 0x00116003, 0x0001bd03, 0x00116403, 0x00116703, 0x00116a03,
+	0x0001be03, 0x00116e03, 0x00117103, 0x00117403, 0x0001bf03, 0x00117803, 0x00117b03, 0x00117e03,
+	0x0001c003, 0x00118203, 0x00118503, 0x00118803, 0x0001c103, 0x00118c03, 0x00118f03, 0x00119203,
+	0x00002d03, 0x00119603, 0x00119903, 0x00119c03, 0x0001c303, 0x0011a003, 0x0011a303, 0x0011a603,
+	0x0001c403, 0x0011aa03, 0x0011ad03, 0x0011b003, 0x0001c503, 0x0011b403, 0x0011b703, 0x0011ba03,
+	0x0001c603, 0x0011be03, 0x0011c103, 0x0011c403, 0x0001c703, 0x0011c803, 0x0011cb03, 0x0011ce03,
+	0x0001c803, 0x0011d203, 0x0011d503, 0x0011d803, 0x0001c903, 0x0011dc03, 0x0011df03, 0x0011e203,
+	0x0001ca03, 0x0011e603, 0x0011e903, 0x0011ec03, 0x0001cb03, 0x0011f003, 0x0011f303, 0x0011f603,
+	0x00002e03, 0x0011fa03, 0x0011fd03, 0x00120003, 0x0001cd03, 0x00120403, 0x00120703, 0x00120a03,
+	0x0001ce03, 0x00120e03, 0x00121103, 0x00121403, 0x0001cf03, 0x00121803, 0x00121b03, 0x00121e03,
+	0x0001d003, 0x00122203, 0x00122503, 0x00122803, 0x0001d103, 0x00122c03, 0x00122f03, 0x00123203,
+	0x0001d203, 0x00123603, 0x00123903, 0x00123c03, 0x0001d303, 0x00124003, 0x00124303, 0x00124603,
+	0x0001d403, 0x00124a03, 0x00124d03, 0x00125003, 0x0001d503, 0x00125403, 0x00125703, 0x00125a03,
+	0x00002f03, 0x00125e03, 0x00126103, 0x00126403, 0x0001d703, 0x00126803, 0x00126b03, 0x00126e03,
+	0x0001d803, 0x00127203, 0x00127503, 0x00127803, 0x0001d903, 0x00127c03, 0x00127f03, 0x00128203,
+	0x0001da03, 0x00128603, 0x00128903, 0x00128c03, 0x0001db03, 0x00129003, 0x00129303, 0x00129603,
+	0x0001dc03, 0x00129a03, 0x00129d03, 0x0012a003, 0x0001dd03, 0x0012a403, 0x0012a703, 0x0012aa03,
+	0x0001de03, 0x0012ae03, 0x0012b103, 0x0012b403, 0x0001df03, 0x0012b803, 0x0012bb03, 0x0012be03,
+	0x00003003, 0x0012c203, 0x0012c503, 0x0012c803, 0x0001e103, 0x0012cc03, 0x0012cf03, 0x0012d203,
+	0x0001e203, 0x0012d603, 0x0012d903, 0x0012dc03, 0x0001e303, 0x0012e003, 0x0012e303, 0x0012e603,
+	0x0001e403, 0x0012ea03, 0x0012ed03, 0x0012f003, 0x0001e503, 0x0012f403, 0x0012f703, 0x0012fa03,
+	0x0001e603, 0x0012fe03, 0x00130103, 0x00130403, 0x0001e703, 0x00130803, 0x00130b03, 0x00130e03,
+	0x0001e803, 0x00131203, 0x00131503, 0x00131803, 0x0001e903, 0x00131c03, 0x00131f03, 0x00132203,
+	0x00003103, 0x00132603, 0x00132903, 0x00132c03, 0x0001eb03, 0x00133003, 0x00133303, 0x00133603,
+	0x0001ec03, 0x00133a03, 0x00133d03, 0x00134003, 0x0001ed03, 0x00134403, 0x00134703, 0x00134a03,
+	0x0001ee03, 0x00134e03, 0x00135103, 0x00135403, 0x0001ef03, 0x00135803, 0x00135b03, 0x00135e03,
+	0x0001f003, 0x00136203, 0x00136503, 0x00136803, 0x0001f103, 0x00136c03, 0x00136f03, 0x00137203,
+	0x0001f203, 0x00137603, 0x00137903, 0x00137c03, 0x0001f303, 0x00138003, 0x00138303, 0x00138603,
+	0x00000503, 0x00138a03, 0x00138d03, 0x00139003, 0x0001f503, 0x00139403, 0x00139703, 0x00139a03,
+	0x0001f603, 0x00139e03, 0x0013a103, 0x0013a403, 0x0001f703, 0x0013a803, 0x0013ab03, 0x0013ae03,
+	0x0001f803, 0x0013b203, 0x0013b503, 0x0013b803, 0x0001f903, 0x0013bc03, 0x0013bf03, 0x0013c203,
+	0x0001fa03, 0x0013c603, 0x0013c903, 0x0013cc03, 0x0001fb03, 0x0013d003, 0x0013d303, 0x0013d603,
+	0x0001fc03, 0x0013da03, 0x0013dd03, 0x0013e003, 0x0001fd03, 0x0013e403, 0x0013e703, 0x0013ea03,
+	0x00003303, 0x0013ee03, 0x0013f103, 0x0013f403, 0x0001ff03, 0x0013f803, 0x0013fb03, 0x0013fe03,
+	0x00020003, 0x00140503, 0x00020103, 0x00140f03, 0x00020203, 0x00141903, 0x00020303, 0x00142303,
+	0x00020403, 0x00142d03, 0x00020503, 0x00143703, 0x00020603, 0x00144103, 0x00020703, 0x00144b03,
+	0x00003403, 0x00145503, 0x00020903, 0x00145f03, 0x00020a03, 0x00146903, 0x00020b03, 0x00147303,
+	0x00020c03, 0x00147d03, 0x00020d03, 0x00148703, 0x00020e03, 0x00149103, 0x00020f03, 0x00149b03,
+	0x00021003, 0x0014a503, 0x00021103, 0x0014af03, 0x00003503, 0x0014b903, 0x00021303, 0x0014c303,
+	0x00021403, 0x0014cd03, 0x00021503, 0x0014d703, 0x00021603, 0x0014e103, 0x00021703, 0x0014eb03,
+	0x00021803, 0x0014f503, 0x00021903, 0x0014ff03, 0x00021a03, 0x00150903, 0x00021b03, 0x00151303,
+	0x00003603, 0x00151d03, 0x00021d03, 0x00152703, 0x00021e03, 0x00153103, 0x00021f03, 0x00153b03,
+	0x00022003, 0x00154503, 0x00022103, 0x00154f03, 0x00022203, 0x00155903, 0x00022303, 0x00156303,
+	0x00022403, 0x00156d03, 0x00022503, 0x00157703, 0x00003703, 0x00158103, 0x00022703, 0x00158b03,
+	0x00022803, 0x00159503, 0x00022903, 0x00159f03, 0x00022a03, 0x0015a903, 0x00022b03, 0x0015b303,
+	0x00022c03, 0x0015bd03, 0x00022d03, 0x0015c703, 0x00022e03, 0x0015d103, 0x00022f03, 0x0015db03,
+	0x00003803, 0x0015e503, 0x00023103, 0x0015ef03, 0x00023203, 0x0015f903, 0x00023303, 0x00160303,
+	0x00023403, 0x00160d03, 0x00023503, 0x00161703, 0x00023603, 0x00162103, 0x00023703, 0x00162b03,
+	0x00023803, 0x00163503, 0x00023903, 0x00163f03, 0x00003903, 0x00164903, 0x00023b03, 0x00165303,
+	0x00023c03, 0x00165d03, 0x00023d03, 0x00166703, 0x00023e03, 0x00167103, 0x00023f03, 0x00167b03,
+	0x00024003, 0x00168503, 0x00024103, 0x00168f03, 0x00024203, 0x00169903, 0x00024303, 0x0016a303,
+	0x00003a03, 0x0016ad03, 0x00024503, 0x0016b703, 0x00024603, 0x0016c103, 0x00024703, 0x0016cb03,
+	0x00024803, 0x0016d503, 0x00024903, 0x0016df03, 0x00024a03, 0x0016e903, 0x00024b03, 0x0016f303,
+	0x00024c03, 0x0016fd03, 0x00024d03, 0x00170703, 0x00003b03, 0x00171103, 0x00024f03, 0x00171b03,
+	0x00025003, 0x00172503, 0x00025103, 0x00172f03, 0x00025203, 0x00173903, 0x00025303, 0x00174303,
+	0x00025403, 0x00174d03, 0x00025503, 0x00175703, 0x00025603, 0x00176103, 0x00025703, 0x00176b03,
+	0x00000603, 0x00177503, 0x00025903, 0x00177f03, 0x00025a03, 0x00178903, 0x00025b03, 0x00179303,
+	0x00025c03, 0x00179d03, 0x00025d03, 0x0017a703, 0x00025e03, 0x0017b103, 0x00025f03, 0x0017bb03,
+	0x00026003, 0x0017c503, 0x00026103, 0x0017cf03, 0x00003d03, 0x0017d903, 0x00026303, 0x0017e303,
+	0x00026403, 0x0017ed03, 0x00026503, 0x0017f703, 0x00026603, 0x00180103, 0x00026703, 0x00180b03,
+	0x00026803, 0x00181503, 0x00026903, 0x00181f03, 0x00026a03, 0x00182903, 0x00026b03, 0x00183303,
+	0x00003e03, 0x00183d03, 0x00026d03, 0x00184703, 0x00026e03, 0x00185103, 0x00026f03, 0x00185b03,
+	0x00027003, 0x00186503, 0x00027103, 0x00186f03, 0x00027203, 0x00187903, 0x00027303, 0x00188303,
+	0x00027403, 0x00188d03, 0x00027503, 0x00189703, 0x00003f03, 0x0018a103, 0x00027703, 0x0018ab03,
+	0x00027803, 0x0018b503, 0x00027903, 0x0018bf03, 0x00027a03, 0x0018c903, 0x00027b03, 0x0018d303,
+	0x00027c03, 0x0018dd03, 0x00027d03, 0x0018e703, 0x00027e03, 0x0018f103, 0x00027f03, 0x0018fb03,
+	0x00004003, 0x00190503, 0x00028103, 0x00190f03, 0x00028203, 0x00191903, 0x00028303, 0x00192303,
+	0x00028403, 0x00192d03, 0x00028503, 0x00193703, 0x00028603, 0x00194103, 0x00028703, 0x00194b03,
+	0x00028803, 0x00195503, 0x00028903, 0x00195f03, 0x00004103, 0x00196903, 0x00028b03, 0x00197303,
+	0x00028c03, 0x00197d03, 0x00028d03, 0x00198703, 0x00028e03, 0x00199103, 0x00028f03, 0x00199b03,
+	0x00029003, 0x0019a503, 0x00029103, 0x0019af03, 0x00029203, 0x0019b903, 0x00029303, 0x0019c303,
+	0x00004203, 0x0019cd03, 0x00029503, 0x0019d703, 0x00029603, 0x0019e103, 0x00029703, 0x0019eb03,
+	0x00029803, 0x0019f503, 0x00029903, 0x0019ff03, 0x00029a03, 0x001a0903, 0x00029b03, 0x001a1303,
+	0x00029c03, 0x001a1d03, 0x00029d03, 0x001a2703, 0x00004303, 0x001a3103, 0x00029f03, 0x001a3b03,
+	0x0002a003, 0x001a4503, 0x0002a103, 0x001a4f03, 0x0002a203, 0x001a5903, 0x0002a303, 0x001a6303,
+	0x0002a403, 0x001a6d03, 0x0002a503, 0x001a7703, 0x0002a603, 0x001a8103, 0x0002a703, 0x001a8b03,
+	0x00004403, 0x001a9503, 0x0002a903, 0x001a9f03, 0x0002aa03, 0x001aa903, 0x0002ab03, 0x001ab303,
+	0x0002ac03, 0x001abd03, 0x0002ad03, 0x001ac703, 0x0002ae03, 0x001ad103, 0x0002af03, 0x001adb03,
+	0x0002b003, 0x001ae503, 0x0002b103, 0x001aef03, 0x00004503, 0x001af903, 0x0002b303, 0x001b0303,
+	0x0002b403, 0x001b0d03, 0x0002b503, 0x001b1703, 0x0002b603, 0x001b2103, 0x0002b703, 0x001b2b03,
+	0x0002b803, 0x001b3503, 0x0002b903, 0x001b3f03, 0x0002ba03, 0x001b4903, 0x0002bb03, 0x001b5303,
+	0x00000703, 0x001b5d03, 0x0002bd03, 0x001b6703, 0x0002be03, 0x001b7103, 0x0002bf03, 0x001b7b03,
+	0x0002c003, 0x001b8503, 0x0002c103, 0x001b8f03, 0x0002c203, 0x001b9903, 0x0002c303, 0x001ba303,
+	0x0002c403, 0x001bad03, 0x0002c503, 0x001bb703, 0x00004703, 0x001bc103, 0x0002c703, 0x001bcb03,
+	0x0002c803, 0x001bd503, 0x0002c903, 0x001bdf03, 0x0002ca03, 0x001be903, 0x0002cb03, 0x001bf303,
+	0x0002cc03, 0x001bfd03, 0x0002cd03, 0x001c0703, 0x0002ce03, 0x001c1103, 0x0002cf03, 0x001c1b03,
+	0x00004803, 0x001c2503, 0x0002d103, 0x001c2f03, 0x0002d203, 0x001c3903, 0x0002d303, 0x001c4303,
+	0x0002d403, 0x001c4d03, 0x0002d503, 0x001c5703, 0x0002d603, 0x001c6103, 0x0002d703, 0x001c6b03,
+	0x0002d803, 0x001c7503, 0x0002d903, 0x001c7f03, 0x00004903, 0x001c8903, 0x0002db03, 0x001c9303,
+	0x0002dc03, 0x001c9d03, 0x0002dd03, 0x001ca703, 0x0002de03, 0x001cb103, 0x0002df03, 0x001cbb03,
+	0x0002e003, 0x001cc503, 0x0002e103, 0x001ccf03, 0x0002e203, 0x001cd903, 0x0002e303, 0x001ce303,
+	0x00004a03, 0x001ced03, 0x0002e503, 0x001cf703, 0x0002e603, 0x001d0103, 0x0002e703, 0x001d0b03,
+	0x0002e803, 0x001d1503, 0x0002e903, 0x001d1f03, 0x0002ea03, 0x001d2903, 0x0002eb03, 0x001d3303,
+	0x0002ec03, 0x001d3d03, 0x0002ed03, 0x001d4703, 0x00004b03, 0x001d5103, 0x0002ef03, 0x001d5b03,
+	0x0002f003, 0x001d6503, 0x0002f103, 0x001d6f03, 0x0002f203, 0x001d7903, 0x0002f303, 0x001d8303,
+	0x0002f403, 0x001d8d03, 0x0002f503, 0x001d9703, 0x0002f603, 0x001da103, 0x0002f703, 0x001dab03,
+	0x00004c03, 0x001db503, 0x0002f903, 0x001dbf03, 0x0002fa03, 0x001dc903, 0x0002fb03, 0x001dd303,
+	0x0002fc03, 0x001ddd03, 0x0002fd03, 0x001de703, 0x0002fe03, 0x001df103, 0x0002ff03, 0x001dfb03,
+	0x00030003, 0x001e0503, 0x00030103, 0x001e0f03, 0x00004d03, 0x001e1903, 0x00030303, 0x001e2303,
+	0x00030403, 0x001e2d03, 0x00030503, 0x001e3703, 0x00030603, 0x001e4103, 0x00030703, 0x001e4b03,
+	0x00030803, 0x001e5503, 0x00030903, 0x001e5f03, 0x00030a03, 0x001e6903, 0x00030b03, 0x001e7303,
+	0x00004e03, 0x001e7d03, 0x00030d03, 0x001e8703, 0x00030e03, 0x001e9103, 0x00030f03, 0x001e9b03,
+	0x00031003, 0x001ea503, 0x00031103, 0x001eaf03, 0x00031203, 0x001eb903, 0x00031303, 0x001ec303,
+	0x00031403, 0x001ecd03, 0x00031503, 0x001ed703, 0x00004f03, 0x001ee103, 0x00031703, 0x001eeb03,
+	0x00031803, 0x001ef503, 0x00031903, 0x001eff03, 0x00031a03, 0x001f0903, 0x00031b03, 0x001f1303,
+	0x00031c03, 0x001f1d03, 0x00031d03, 0x001f2703, 0x00031e03, 0x001f3103, 0x00031f03, 0x001f3b03,
+	0x00000803, 0x001f4503, 0x00032103, 0x001f4f03, 0x00032203, 0x001f5903, 0x00032303, 0x001f6303,
+	0x00032403, 0x001f6d03, 0x00032503, 0x001f7703, 0x00032603, 0x001f8103, 0x00032703, 0x001f8b03,
+	0x00032803, 0x001f9503, 0x00032903, 0x001f9f03, 0x00005103, 0x001fa903, 0x00032b03, 0x001fb303,
+	0x00032c03, 0x001fbd03, 0x00032d03, 0x001fc703, 0x00032e03, 0x001fd103, 0x00032f03, 0x001fdb03,
+	0x00033003, 0x001fe503, 0x00033103, 0x001fef03, 0x00033203, 0x001ff903, 0x00033303, 0x00200303,
+	0x00005203, 0x00200d03, 0x00033503, 0x00201703, 0x00033603, 0x00202103, 0x00033703, 0x00202b03,
+	0x00033803, 0x00203503, 0x00033903, 0x00203f03, 0x00033a03, 0x00204903, 0x00033b03, 0x00205303,
+	0x00033c03, 0x00205d03, 0x00033d03, 0x00206703, 0x00005303, 0x00207103, 0x00033f03, 0x00207b03,
+	0x00034003, 0x00208503, 0x00034103, 0x00208f03, 0x00034203, 0x00209903, 0x00034303, 0x0020a303,
+	0x00034403, 0x0020ad03, 0x00034503, 0x0020b703, 0x00034603, 0x0020c103, 0x00034703, 0x0020cb03,
+	0x00005403, 0x0020d503, 0x00034903, 0x0020df03, 0x00034a03, 0x0020e903, 0x00034b03, 0x0020f303,
+	0x00034c03, 0x0020fd03, 0x00034d03, 0x00210703, 0x00034e03, 0x00211103, 0x00034f03, 0x00211b03,
+	0x00035003, 0x00212503, 0x00035103, 0x00212f03, 0x00005503, 0x00213903, 0x00035303, 0x00214303,
+	0x00035403, 0x00214d03, 0x00035503, 0x00215703, 0x00035603, 0x00216103, 0x00035703, 0x00216b03,
+	0x00035803, 0x00217503, 0x00035903, 0x00217f03, 0x00035a03, 0x00218903, 0x00035b03, 0x00219303,
+	0x00005603, 0x00219d03, 0x00035d03, 0x0021a703, 0x00035e03, 0x0021b103, 0x00035f03, 0x0021bb03,
+	0x00036003, 0x0021c503, 0x00036103, 0x0021cf03, 0x00036203, 0x0021d903, 0x00036303, 0x0021e303,
+	0x00036403, 0x0021ed03, 0x00036503, 0x0021f703, 0x00005703, 0x00220103, 0x00036703, 0x00220b03,
+	0x00036803, 0x00221503, 0x00036903, 0x00221f03, 0x00036a03, 0x00222903, 0x00036b03, 0x00223303,
+	0x00036c03, 0x00223d03, 0x00036d03, 0x00224703, 0x00036e03, 0x00225103, 0x00036f03, 0x00225b03,
+	0x00005803, 0x00226503, 0x00037103, 0x00226f03, 0x00037203, 0x00227903, 0x00037303, 0x00228303,
+	0x00037403, 0x00228d03, 0x00037503, 0x00229703, 0x00037603, 0x0022a103, 0x00037703, 0x0022ab03,
+	0x00037803, 0x0022b503, 0x00037903, 0x0022bf03, 0x00005903, 0x0022c903, 0x00037b03, 0x0022d303,
+	0x00037c03, 0x0022dd03, 0x00037d03, 0x0022e703, 0x00037e03, 0x0022f103, 0x00037f03, 0x0022fb03,
+	0x00038003, 0x00230503, 0x00038103, 0x00230f03, 0x00038203, 0x00231903, 0x00038303, 0x00232303,
+	0x00000903, 0x00232d03, 0x00038503, 0x00233703, 0x00038603, 0x00234103, 0x00038703, 0x00234b03,
+	0x00038803, 0x00235503, 0x00038903, 0x00235f03, 0x00038a03, 0x00236903, 0x00038b03, 0x00237303,
+	0x00038c03, 0x00237d03, 0x00038d03, 0x00238703, 0x00005b03, 0x00239103, 0x00038f03, 0x00239b03,
+	0x00039003, 0x0023a503, 0x00039103, 0x0023af03, 0x00039203, 0x0023b903, 0x00039303, 0x0023c303,
+	0x00039403, 0x0023cd03, 0x00039503, 0x0023d703, 0x00039603, 0x0023e103, 0x00039703, 0x0023eb03,
+	0x00005c03, 0x0023f503, 0x00039903, 0x0023ff03, 0x00039a03, 0x00240903, 0x00039b03, 0x00241303,
+	0x00039c03, 0x00241d03, 0x00039d03, 0x00242703, 0x00039e03, 0x00243103, 0x00039f03, 0x00243b03,
+	0x0003a003, 0x00244503, 0x0003a103, 0x00244f03, 0x00005d03, 0x00245903, 0x0003a303, 0x00246303,
+	0x0003a403, 0x00246d03, 0x0003a503, 0x00247703, 0x0003a603, 0x00248103, 0x0003a703, 0x00248b03,
+	0x0003a803, 0x00249503, 0x0003a903, 0x00249f03, 0x0003aa03, 0x0024a903, 0x0003ab03, 0x0024b303,
+	0x00005e03, 0x0024bd03, 0x0003ad03, 0x0024c703, 0x0003ae03, 0x0024d103, 0x0003af03, 0x0024db03,
+	0x0003b003, 0x0024e503, 0x0003b103, 0x0024ef03, 0x0003b203, 0x0024f903, 0x0003b303, 0x00250303,
+	0x0003b403, 0x00250d03, 0x0003b503, 0x00251703, 0x00005f03, 0x00252103, 0x0003b703, 0x00252b03,
+	0x0003b803, 0x00253503, 0x0003b903, 0x00253f03, 0x0003ba03, 0x00254903, 0x0003bb03, 0x00255303,
+	0x0003bc03, 0x00255d03, 0x0003bd03, 0x00256703, 0x0003be03, 0x00257103, 0x0003bf03, 0x00257b03,
+	0x00006003, 0x00258503, 0x0003c103, 0x00258f03, 0x0003c203, 0x00259903, 0x0003c303, 0x0025a303,
+	0x0003c403, 0x0025ad03, 0x0003c503, 0x0025b703, 0x0003c603, 0x0025c103, 0x0003c703, 0x0025cb03,
+	0x0003c803, 0x0025d503, 0x0003c903, 0x0025df03, 0x00006103, 0x0025e903, 0x0003cb03, 0x0025f303,
+	0x0003cc03, 0x0025fd03, 0x0003cd03, 0x00260703, 0x0003ce03, 0x00261103, 0x0003cf03, 0x00261b03,
+	0x0003d003, 0x00262503, 0x0003d103, 0x00262f03, 0x0003d203, 0x00263903, 0x0003d303, 0x00264303,
+	0x00006203, 0x00264d03, 0x0003d503, 0x00265703, 0x0003d603, 0x00266103, 0x0003d703, 0x00266b03,
+	0x0003d803, 0x00267503, 0x0003d903, 0x00267f03, 0x0003da03, 0x00268903, 0x0003db03, 0x00269303,
+	0x0003dc03, 0x00269d03, 0x0003dd03, 0x0026a703, 0x00006303, 0x0026b103, 0x0003df03, 0x0026bb03,
+	0x0003e003, 0x0026c503, 0x0003e103, 0x0026cf03, 0x0003e203, 0x0026d903, 0x0003e303, 0x0026e303,
+	0x0003e403, 0x0026ed03, 0x0003e503, 0x0026f703, 0x0003e603, 0x00270103, 0x0003e703, 0x00270b03,
+	0x00000104, 0x00271504, 0x0003e904, 0x00271f04, 0x0003ea04, 0x00272904, 0x0003eb04, 0x00273304,
+	0x0003ec04, 0x00273d04, 0x0003ed04, 0x00274704, 0x0003ee04, 0x00275104, 0x0003ef04, 0x00275b04,
+	0x0003f004, 0x00276504, 0x0003f104, 0x00276f04, 0x00006504, 0x00277904, 0x0003f304, 0x00278304,
+	0x0003f404, 0x00278d04, 0x0003f504, 0x00279704, 0x0003f604, 0x0027a104, 0x0003f704, 0x0027ab04,
+	0x0003f804, 0x0027b504, 0x0003f904, 0x0027bf04, 0x0003fa04, 0x0027c904, 0x0003fb04, 0x0027d304,
+	0x00006604, 0x0027dd04, 0x0003fd04, 0x0027e704, 0x0003fe04, 0x0027f104, 0x0003ff04, 0x0027fb04,
+	0x00040004, 0x00040104, 0x00040204, 0x00040304, 0x00040404, 0x00040504, 0x00006704, 0x00040704,
+	0x00040804, 0x00040904, 0x00040a04, 0x00040b04, 0x00040c04, 0x00040d04, 0x00040e04, 0x00040f04,
+	0x00006804, 0x00041104, 0x00041204, 0x00041304, 0x00041404, 0x00041504, 0x00041604, 0x00041704,
+	0x00041804, 0x00041904, 0x00006904, 0x00041b04, 0x00041c04, 0x00041d04, 0x00041e04, 0x00041f04,
+	0x00042004, 0x00042104, 0x00042204, 0x00042304, 0x00006a04, 0x00042504, 0x00042604, 0x00042704,
+	0x00042804, 0x00042904, 0x00042a04, 0x00042b04, 0x00042c04, 0x00042d04, 0x00006b04, 0x00042f04,
+	0x00043004, 0x00043104, 0x00043204, 0x00043304, 0x00043404, 0x00043504, 0x00043604, 0x00043704,
+	0x00006c04, 0x00043904, 0x00043a04, 0x00043b04, 0x00043c04, 0x00043d04, 0x00043e04, 0x00043f04,
+	0x00044004, 0x00044104, 0x00006d04, 0x00044304, 0x00044404, 0x00044504, 0x00044604, 0x00044704,
+	0x00044804, 0x00044904, 0x00044a04, 0x00044b04, 0x00000b04, 0x00044d04, 0x00044e04, 0x00044f04,
+	0x00045004, 0x00045104, 0x00045204, 0x00045304, 0x00045404, 0x00045504, 0x00006f04, 0x00045704,
+	0x00045804, 0x00045904, 0x00045a04, 0x00045b04, 0x00045c04, 0x00045d04, 0x00045e04, 0x00045f04,
+	0x00007004, 0x00046104, 0x00046204, 0x00046304, 0x00046404, 0x00046504, 0x00046604, 0x00046704,
+	0x00046804, 0x00046904, 0x00007104, 0x00046b04, 0x00046c04, 0x00046d04, 0x00046e04, 0x00046f04,
+	0x00047004, 0x00047104, 0x00047204, 0x00047304, 0x00007204, 0x00047504, 0x00047604, 0x00047704,
+	0x00047804, 0x00047904, 0x00047a04, 0x00047b04, 0x00047c04, 0x00047d04, 0x00007304, 0x00047f04,
+	0x00048004, 0x00048104, 0x00048204, 0x00048304, 0x00048404, 0x00048504, 0x00048604, 0x00048704,
+	0x00007404, 0x00048904, 0x00048a04, 0x00048b04, 0x00048c04, 0x00048d04, 0x00048e04, 0x00048f04,
+	0x00049004, 0x00049104, 0x00007504, 0x00049304, 0x00049404, 0x00049504, 0x00049604, 0x00049704,
+	0x00049804, 0x00049904, 0x00049a04, 0x00049b04, 0x00007604, 0x00049d04, 0x00049e04, 0x00049f04,
+	0x0004a004, 0x0004a104, 0x0004a204, 0x0004a304, 0x0004a404, 0x0004a504, 0x00007704, 0x0004a704,
+	0x0004a804, 0x0004a904, 0x0004aa04, 0x0004ab04, 0x0004ac04, 0x0004ad04, 0x0004ae04, 0x0004af04,
+	0x00000c04, 0x0004b104, 0x0004b204, 0x0004b304, 0x0004b404, 0x0004b504, 0x0004b604, 0x0004b704,
+	0x0004b804, 0x0004b904, 0x00007904, 0x0004bb04, 0x0004bc04, 0x0004bd04, 0x0004be04, 0x0004bf04,
+	0x0004c004, 0x0004c104, 0x0004c204, 0x0004c304, 0x00007a04, 0x0004c504, 0x0004c604, 0x0004c704,
+	0x0004c804, 0x0004c904, 0x0004ca04, 0x0004cb04, 0x0004cc04, 0x0004cd04, 0x00007b04, 0x0004cf04,
+	0x0004d004, 0x0004d104, 0x0004d204, 0x0004d304, 0x0004d404, 0x0004d504, 0x0004d604, 0x0004d704,
+	0x00007c04, 0x0004d904, 0x0004da04, 0x0004db04, 0x0004dc04, 0x0004dd04, 0x0004de04, 0x0004df04,
+	0x0004e004, 0x0004e104, 0x00007d04, 0x0004e304, 0x0004e404, 0x0004e504, 0x0004e604, 0x0004e704,
+	0x0004e804, 0x0004e904, 0x0004ea04, 0x0004eb04, 0x00007e04, 0x0004ed04, 0x0004ee04, 0x0004ef04,
+	0x0004f004, 0x0004f104, 0x0004f204, 0x0004f304, 0x0004f404, 0x0004f504, 0x00007f04, 0x0004f704,
+	0x0004f804, 0x0004f904, 0x0004fa04, 0x0004fb04, 0x0004fc04, 0x0004fd04, 0x0004fe04, 0x0004ff04,
+	0x00008004, 0x00050104, 0x00050204, 0x00050304, 0x00050404, 0x00050504, 0x00050604, 0x00050704,
+	0x00050804, 0x00050904, 0x00008104, 0x00050b04, 0x00050c04, 0x00050d04, 0x00050e04, 0x00050f04,
+	0x00051004, 0x00051104, 0x00051204, 0x00051304, 0x00000d04, 0x00051504, 0x00051604, 0x00051704,
+	0x00051804, 0x00051904, 0x00051a04, 0x00051b04, 0x00051c04, 0x00051d04, 0x00008304, 0x00051f04,
+	0x00052004, 0x00052104, 0x00052204, 0x00052304, 0x00052404, 0x00052504, 0x00052604, 0x00052704,
+	0x00008404, 0x00052904, 0x00052a04, 0x00052b04, 0x00052c04, 0x00052d04, 0x00052e04, 0x00052f04,
+	0x00053004, 0x00053104, 0x00008504, 0x00053304, 0x00053404, 0x00053504, 0x00053604, 0x00053704,
+	0x00053804, 0x00053904, 0x00053a04, 0x00053b04, 0x00008604, 0x00053d04, 0x00053e04, 0x00053f04,
+	0x00054004, 0x00054104, 0x00054204, 0x00054304, 0x00054404, 0x00054504, 0x00008704, 0x00054704,
+	0x00054804, 0x00054904, 0x00054a04, 0x00054b04, 0x00054c04, 0x00054d04, 0x00054e04, 0x00054f04,
+	0x00008804, 0x00055104, 0x00055204, 0x00055304, 0x00055404, 0x00055504, 0x00055604, 0x00055704,
+	0x00055804, 0x00055904, 0x00008904, 0x00055b04, 0x00055c04, 0x00055d04, 0x00055e04, 0x00055f04,
+	0x00056004, 0x00056104, 0x00056204, 0x00056304, 0x00008a04, 0x00056504, 0x00056604, 0x00056704,
+	0x00056804, 0x00056904, 0x00056a04, 0x00056b04, 0x00056c04, 0x00056d04, 0x00008b04, 0x00056f04,
+	0x00057004, 0x00057104, 0x00057204, 0x00057304, 0x00057404, 0x00057504, 0x00057604, 0x00057704,
+	0x00000e04, 0x00057904, 0x00057a04, 0x00057b04, 0x00057c04, 0x00057d04, 0x00057e04, 0x00057f04,
+	0x00058004, 0x00058104, 0x00008d04, 0x00058304, 0x00058404, 0x00058504, 0x00058604, 0x00058704,
+	0x00058804, 0x00058904, 0x00058a04, 0x00058b04, 0x00008e04, 0x00058d04, 0x00058e04, 0x00058f04,
+	0x00059004, 0x00059104, 0x00059204, 0x00059304, 0x00059404, 0x00059504, 0x00008f04, 0x00059704,
+	0x00059804, 0x00059904, 0x00059a04, 0x00059b04, 0x00059c04, 0x00059d04, 0x00059e04, 0x00059f04,
+	0x00009004, 0x0005a104, 0x0005a204, 0x0005a304, 0x0005a404, 0x0005a504, 0x0005a604, 0x0005a704,
+	0x0005a804, 0x0005a904, 0x00009104, 0x0005ab04, 0x0005ac04, 0x0005ad04, 0x0005ae04, 0x0005af04,
+	0x0005b004, 0x0005b104, 0x0005b204, 0x0005b304, 0x00009204, 0x0005b504, 0x0005b604, 0x0005b704,
+	0x0005b804, 0x0005b904, 0x0005ba04, 0x0005bb04, 0x0005bc04, 0x0005bd04, 0x00009304, 0x0005bf04,
+	0x0005c004, 0x0005c104, 0x0005c204, 0x0005c304, 0x0005c404, 0x0005c504, 0x0005c604, 0x0005c704,
+	0x00009404, 0x0005c904, 0x0005ca04, 0x0005cb04, 0x0005cc04, 0x0005cd04, 0x0005ce04, 0x0005cf04,
+	0x0005d004, 0x0005d104, 0x00009504, 0x0005d304, 0x0005d404, 0x0005d504, 0x0005d604, 0x0005d704,
+	0x0005d804, 0x0005d904, 0x0005da04, 0x0005db04, 0x00000f04, 0x0005dd04, 0x0005de04, 0x0005df04,
+	0x0005e004, 0x0005e104, 0x0005e204, 0x0005e304, 0x0005e404, 0x0005e504, 0x00009704, 0x0005e704,
+	0x0005e804, 0x0005e904, 0x0005ea04, 0x0005eb04, 0x0005ec04, 0x0005ed04, 0x0005ee04, 0x0005ef04,
+	0x00009804, 0x0005f104, 0x0005f204, 0x0005f304, 0x0005f404, 0x0005f504, 0x0005f604, 0x0005f704,
+	0x0005f804, 0x0005f904, 0x00009904, 0x0005fb04, 0x0005fc04, 0x0005fd04, 0x0005fe04, 0x0005ff04,
+	0x00060004, 0x00060104, 0x00060204, 0x00060304, 0x00009a04, 0x00060504, 0x00060604, 0x00060704,
+	0x00060804, 0x00060904, 0x00060a04, 0x00060b04, 0x00060c04, 0x00060d04, 0x00009b04, 0x00060f04,
+	0x00061004, 0x00061104, 0x00061204, 0x00061304, 0x00061404, 0x00061504, 0x00061604, 0x00061704,
+	0x00009c04, 0x00061904, 0x00061a04, 0x00061b04, 0x00061c04, 0x00061d04, 0x00061e04, 0x00061f04,
+	0x00062004, 0x00062104, 0x00009d04, 0x00062304, 0x00062404, 0x00062504, 0x00062604, 0x00062704,
+	0x00062804, 0x00062904, 0x00062a04, 0x00062b04, 0x00009e04, 0x00062d04, 0x00062e04, 0x00062f04,
+	0x00063004, 0x00063104, 0x00063204, 0x00063304, 0x00063404, 0x00063504, 0x00009f04, 0x00063704,
+	0x00063804, 0x00063904, 0x00063a04, 0x00063b04, 0x00063c04, 0x00063d04, 0x00063e04, 0x00063f04,
+	0x00001004, 0x00064104, 0x00064204, 0x00064304, 0x00064404, 0x00064504, 0x00064604, 0x00064704,
+	0x00064804, 0x00064904, 0x0000a104, 0x00064b04, 0x00064c04, 0x00064d04, 0x00064e04, 0x00064f04,
+	0x00065004, 0x00065104, 0x00065204, 0x00065304, 0x0000a204, 0x00065504, 0x00065604, 0x00065704,
+	0x00065804, 0x00065904, 0x00065a04, 0x00065b04, 0x00065c04, 0x00065d04, 0x0000a304, 0x00065f04,
+	0x00066004, 0x00066104, 0x00066204, 0x00066304, 0x00066404, 0x00066504, 0x00066604, 0x00066704,
+	0x0000a404, 0x00066904, 0x00066a04, 0x00066b04, 0x00066c04, 0x00066d04, 0x00066e04, 0x00066f04,
+	0x00067004, 0x00067104, 0x0000a504, 0x00067304, 0x00067404, 0x00067504, 0x00067604, 0x00067704,
+	0x00067804, 0x00067904, 0x00067a04, 0x00067b04, 0x0000a604, 0x00067d04, 0x00067e04, 0x00067f04,
+	0x00068004, 0x00068104, 0x00068204, 0x00068304, 0x00068404, 0x00068504, 0x0000a704, 0x00068704,
+	0x00068804, 0x00068904, 0x00068a04, 0x00068b04, 0x00068c04, 0x00068d04, 0x00068e04, 0x00068f04,
+	0x0000a804, 0x00069104, 0x00069204, 0x00069304, 0x00069404, 0x00069504, 0x00069604, 0x00069704,
+	0x00069804, 0x00069904, 0x0000a904, 0x00069b04, 0x00069c04, 0x00069d04, 0x00069e04, 0x00069f04,
+	0x0006a004, 0x0006a104, 0x0006a204, 0x0006a304, 0x00001104, 0x0006a504, 0x0006a604, 0x0006a704,
+	0x0006a804, 0x0006a904, 0x0006aa04, 0x0006ab04, 0x0006ac04, 0x0006ad04, 0x0000ab04, 0x0006af04,
+	0x0006b004, 0x0006b104, 0x0006b204, 0x0006b304, 0x0006b404, 0x0006b504, 0x0006b604, 0x0006b704,
+	0x0000ac04, 0x0006b904, 0x0006ba04, 0x0006bb04, 0x0006bc04, 0x0006bd04, 0x0006be04, 0x0006bf04,
+	0x0006c004, 0x0006c104, 0x0000ad04, 0x0006c304, 0x0006c404, 0x0006c504, 0x0006c604, 0x0006c704,
+	0x0006c804, 0x0006c904, 0x0006ca04, 0x0006cb04, 0x0000ae04, 0x0006cd04, 0x0006ce04, 0x0006cf04,
+	0x0006d004, 0x0006d104, 0x0006d204, 0x0006d304, 0x0006d404, 0x0006d504, 0x0000af04, 0x0006d704,
+	0x0006d804, 0x0006d904, 0x0006da04, 0x0006db04, 0x0006dc04, 0x0006dd04, 0x0006de04, 0x0006df04,
+	0x0000b004, 0x0006e104, 0x0006e204, 0x0006e304, 0x0006e404, 0x0006e504, 0x0006e604, 0x0006e704,
+	0x0006e804, 0x0006e904, 0x0000b104, 0x0006eb04, 0x0006ec04, 0x0006ed04, 0x0006ee04, 0x0006ef04,
+	0x0006f004, 0x0006f104, 0x0006f204, 0x0006f304, 0x0000b204, 0x0006f504, 0x0006f604, 0x0006f704,
+	0x0006f804, 0x0006f904, 0x0006fa04, 0x0006fb04, 0x0006fc04, 0x0006fd04, 0x0000b304, 0x0006ff04,
+	0x00070004, 0x00070104, 0x00070204, 0x00070304, 0x00070404, 0x00070504, 0x00070604, 0x00070704,
+	0x00001204, 0x00070904, 0x00070a04, 0x00070b04, 0x00070c04, 0x00070d04, 0x00070e04, 0x00070f04,
+	0x00071004, 0x00071104, 0x0000b504, 0x00071304, 0x00071404, 0x00071504, 0x00071604, 0x00071704,
+	0x00071804, 0x00071904, 0x00071a04, 0x00071b04, 0x0000b604, 0x00071d04, 0x00071e04, 0x00071f04,
+	0x00072004, 0x00072104, 0x00072204, 0x00072304, 0x00072404, 0x00072504, 0x0000b704, 0x00072704,
+	0x00072804, 0x00072904, 0x00072a04, 0x00072b04, 0x00072c04, 0x00072d04, 0x00072e04, 0x00072f04,
+	0x0000b804, 0x00073104, 0x00073204, 0x00073304, 0x00073404, 0x00073504, 0x00073604, 0x00073704,
+	0x00073804, 0x00073904, 0x0000b904, 0x00073b04, 0x00073c04, 0x00073d04, 0x00073e04, 0x00073f04,
+	0x00074004, 0x00074104, 0x00074204, 0x00074304, 0x0000ba04, 0x00074504, 0x00074604, 0x00074704,
+	0x00074804, 0x00074904, 0x00074a04, 0x00074b04, 0x00074c04, 0x00074d04, 0x0000bb04, 0x00074f04,
+	0x00075004, 0x00075104, 0x00075204, 0x00075304, 0x00075404, 0x00075504, 0x00075604, 0x00075704,
+	0x0000bc04, 0x00075904, 0x00075a04, 0x00075b04, 0x00075c04, 0x00075d04, 0x00075e04, 0x00075f04,
+	0x00076004, 0x00076104, 0x0000bd04, 0x00076304, 0x00076404, 0x00076504, 0x00076604, 0x00076704,
+	0x00076804, 0x00076904, 0x00076a04, 0x00076b04, 0x00001304, 0x00076d04, 0x00076e04, 0x00076f04,
+	0x00077004, 0x00077104, 0x00077204, 0x00077304, 0x00077404, 0x00077504, 0x0000bf04, 0x00077704,
+	0x00077804, 0x00077904, 0x00077a04, 0x00077b04, 0x00077c04, 0x00077d04, 0x00077e04, 0x00077f04,
+	0x0000c004, 0x00078104, 0x00078204, 0x00078304, 0x00078404, 0x00078504, 0x00078604, 0x00078704,
+	0x00078804, 0x00078904, 0x0000c104, 0x00078b04, 0x00078c04, 0x00078d04, 0x00078e04, 0x00078f04,
+	0x00079004, 0x00079104, 0x00079204, 0x00079304, 0x0000c204, 0x00079504, 0x00079604, 0x00079704,
+	0x00079804, 0x00079904, 0x00079a04, 0x00079b04, 0x00079c04, 0x00079d04, 0x0000c304, 0x00079f04,
+	0x0007a004, 0x0007a104, 0x0007a204, 0x0007a304, 0x0007a404, 0x0007a504, 0x0007a604, 0x0007a704,
+	0x0000c404, 0x0007a904, 0x0007aa04, 0x0007ab04, 0x0007ac04, 0x0007ad04, 0x0007ae04, 0x0007af04,
+	0x0007b004, 0x0007b104, 0x0000c504, 0x0007b304, 0x0007b404, 0x0007b504, 0x0007b604, 0x0007b704,
+	0x0007b804, 0x0007b904, 0x0007ba04, 0x0007bb04, 0x0000c604, 0x0007bd04, 0x0007be04, 0x0007bf04,
+	0x0007c004, 0x0007c104, 0x0007c204, 0x0007c304, 0x0007c404, 0x0007c504, 0x0000c704, 0x0007c704,
+	0x0007c804, 0x0007c904, 0x0007ca04, 0x0007cb04, 0x0007cc04, 0x0007cd04, 0x0007ce04, 0x0007cf04,
+	0x00000204, 0x0007d104, 0x0007d204, 0x0007d304, 0x0007d404, 0x0007d504, 0x0007d604, 0x0007d704,
+	0x0007d804, 0x0007d904, 0x0000c904, 0x0007db04, 0x0007dc04, 0x0007dd04, 0x0007de04, 0x0007df04,
+	0x0007e004, 0x0007e104, 0x0007e204, 0x0007e304, 0x0000ca04, 0x0007e504, 0x0007e604, 0x0007e704,
+	0x0007e804, 0x0007e904, 0x0007ea04, 0x0007eb04, 0x0007ec04, 0x0007ed04, 0x0000cb04, 0x0007ef04,
+	0x0007f004, 0x0007f104, 0x0007f204, 0x0007f304, 0x0007f404, 0x0007f504, 0x0007f604, 0x0007f704,
+	0x0000cc04, 0x0007f904, 0x0007fa04, 0x0007fb04, 0x0007fc04, 0x0007fd04, 0x0007fe04, 0x0007ff04,
+	0x00080004, 0x0000cd04, 0x00080404, 0x00080604, 0x00080804, 0x00080a04, 0x0000ce04, 0x00080e04,
+	0x00081004, 0x00081204, 0x00081404, 0x0000cf04, 0x00081804, 0x00081a04, 0x00081c04, 0x00081e04,
+	0x0000d004, 0x00082204, 0x00082404, 0x00082604, 0x00082804, 0x0000d104, 0x00082c04, 0x00082e04,
+	0x00083004, 0x00083204, 0x00001504, 0x00083604, 0x00083804, 0x00083a04, 0x00083c04, 0x0000d304,
+	0x00084004, 0x00084204, 0x00084404, 0x00084604, 0x0000d404, 0x00084a04, 0x00084c04, 0x00084e04,
+	0x00085004, 0x0000d504, 0x00085404, 0x00085604, 0x00085804, 0x00085a04, 0x0000d604, 0x00085e04,
+	0x00086004, 0x00086204, 0x00086404, 0x0000d704, 0x00086804, 0x00086a04, 0x00086c04, 0x00086e04,
+	0x0000d804, 0x00087204, 0x00087404, 0x00087604, 0x00087804, 0x0000d904, 0x00087c04, 0x00087e04,
+	0x00088004, 0x00088204, 0x0000da04, 0x00088604, 0x00088804, 0x00088a04, 0x00088c04, 0x0000db04,
+	0x00089004, 0x00089204, 0x00089404, 0x00089604, 0x00001604, 0x00089a04, 0x00089c04, 0x00089e04,
+	0x0008a004, 0x0000dd04, 0x0008a404, 0x0008a604, 0x0008a804, 0x0008aa04, 0x0000de04, 0x0008ae04,
+	0x0008b004, 0x0008b204, 0x0008b404, 0x0000df04, 0x0008b804, 0x0008ba04, 0x0008bc04, 0x0008be04,
+	0x0000e004, 0x0008c204, 0x0008c404, 0x0008c604, 0x0008c804, 0x0000e104, 0x0008cc04, 0x0008ce04,
+	0x0008d004, 0x0008d204, 0x0000e204, 0x0008d604, 0x0008d804, 0x0008da04, 0x0008dc04, 0x0000e304,
+	0x0008e004, 0x0008e204, 0x0008e404, 0x0008e604, 0x0000e404, 0x0008ea04, 0x0008ec04, 0x0008ee04,
+	0x0008f004, 0x0000e504, 0x0008f404, 0x0008f604, 0x0008f804, 0x0008fa04, 0x00001704, 0x0008fe04,
+	0x00090004, 0x00090204, 0x00090404, 0x0000e704, 0x00090804, 0x00090a04, 0x00090c04, 0x00090e04,
+	0x0000e804, 0x00091204, 0x00091404, 0x00091604, 0x00091804, 0x0000e904, 0x00091c04, 0x00091e04,
+	0x00092004, 0x00092204, 0x0000ea04, 0x00092604, 0x00092804, 0x00092a04, 0x00092c04, 0x0000eb04,
+	0x00093004, 0x00093204, 0x00093404, 0x00093604, 0x0000ec04, 0x00093a04, 0x00093c04, 0x00093e04,
+	0x00094004, 0x0000ed04, 0x00094404, 0x00094604, 0x00094804, 0x00094a04, 0x0000ee04, 0x00094e04,
+	0x00095004, 0x00095204, 0x00095404, 0x0000ef04, 0x00095804, 0x00095a04, 0x00095c04, 0x00095e04,
+	0x00001804, 0x00096204, 0x00096404, 0x00096604, 0x00096804, 0x0000f104, 0x00096c04, 0x00096e04,
+	0x00097004, 0x00097204, 0x0000f204, 0x00097604, 0x00097804, 0x00097a04, 0x00097c04, 0x0000f304,
+	0x00098004, 0x00098204, 0x00098404, 0x00098604, 0x0000f404, 0x00098a04, 0x00098c04, 0x00098e04,
+	0x00099004, 0x0000f504, 0x00099404, 0x00099604, 0x00099804, 0x00099a04, 0x0000f604, 0x00099e04,
+	0x0009a004, 0x0009a204, 0x0009a404, 0x0000f704, 0x0009a804, 0x0009aa04, 0x0009ac04, 0x0009ae04,
+	0x0000f804, 0x0009b204, 0x0009b404, 0x0009b604, 0x0009b804, 0x0000f904, 0x0009bc04, 0x0009be04,
+	0x0009c004, 0x0009c204, 0x00001904, 0x0009c604, 0x0009c804, 0x0009ca04, 0x0009cc04, 0x0000fb04,
+	0x0009d004, 0x0009d204, 0x0009d404, 0x0009d604, 0x0000fc04, 0x0009da04, 0x0009dc04, 0x0009de04,
+	0x0009e004, 0x0000fd04, 0x0009e404, 0x0009e604, 0x0009e804, 0x0009ea04, 0x0000fe04, 0x0009ee04,
+	0x0009f004, 0x0009f204, 0x0009f404, 0x0000ff04, 0x0009f804, 0x0009fa04, 0x0009fc04, 0x0009fe04,
+	0x00010004, 0x000a0204, 0x000a0404, 0x000a0604, 0x000a0804, 0x00010104, 0x000a0c04, 0x000a0e04,
+	0x000a1004, 0x000a1204, 0x00010204, 0x000a1604, 0x000a1804, 0x000a1a04, 0x000a1c04, 0x00010304,
+	0x000a2004, 0x000a2204, 0x000a2404, 0x000a2604, 0x00001a04, 0x000a2a04, 0x000a2c04, 0x000a2e04,
+	0x000a3004, 0x00010504, 0x000a3404, 0x000a3604, 0x000a3804, 0x000a3a04, 0x00010604, 0x000a3e04,
+	0x000a4004, 0x000a4204, 0x000a4404, 0x00010704, 0x000a4804, 0x000a4a04, 0x000a4c04, 0x000a4e04,
+	0x00010804, 0x000a5204, 0x000a5404, 0x000a5604, 0x000a5804, 0x00010904, 0x000a5c04, 0x000a5e04,
+	0x000a6004, 0x000a6204, 0x00010a04, 0x000a6604, 0x000a6804, 0x000a6a04, 0x000a6c04, 0x00010b04,
+	0x000a7004, 0x000a7204, 0x000a7404, 0x000a7604, 0x00010c04, 0x000a7a04, 0x000a7c04, 0x000a7e04,
+	0x000a8004, 0x00010d04, 0x000a8404, 0x000a8604, 0x000a8804, 0x000a8a04, 0x00001b04, 0x000a8e04,
+	0x000a9004, 0x000a9204, 0x000a9404, 0x00010f04, 0x000a9804, 0x000a9a04, 0x000a9c04, 0x000a9e04,
+	0x00011004, 0x000aa204, 0x000aa404, 0x000aa604, 0x000aa804, 0x00011104, 0x000aac04, 0x000aae04,
+	0x000ab004, 0x000ab204, 0x00011204, 0x000ab604, 0x000ab804, 0x000aba04, 0x000abc04, 0x00011304,
+	0x000ac004, 0x000ac204, 0x000ac404, 0x000ac604, 0x00011404, 0x000aca04, 0x000acc04, 0x000ace04,
+	0x000ad004, 0x00011504, 0x000ad404, 0x000ad604, 0x000ad804, 0x000ada04, 0x00011604, 0x000ade04,
+	0x000ae004, 0x000ae204, 0x000ae404, 0x00011704, 0x000ae804, 0x000aea04, 0x000aec04, 0x000aee04,
+	0x00001c04, 0x000af204, 0x000af404, 0x000af604, 0x000af804, 0x00011904, 0x000afc04, 0x000afe04,
+	0x000b0004, 0x000b0204, 0x00011a04, 0x000b0604, 0x000b0804, 0x000b0a04, 0x000b0c04, 0x00011b04,
+	0x000b1004, 0x000b1204, 0x000b1404, 0x000b1604, 0x00011c04, 0x000b1a04, 0x000b1c04, 0x000b1e04,
+	0x000b2004, 0x00011d04, 0x000b2404, 0x000b2604, 0x000b2804, 0x000b2a04, 0x00011e04, 0x000b2e04,
+	0x000b3004, 0x000b3204, 0x000b3404, 0x00011f04, 0x000b3804, 0x000b3a04, 0x000b3c04, 0x000b3e04,
+	0x00012004, 0x000b4204, 0x000b4404, 0x000b4604, 0x000b4804, 0x00012104, 0x000b4c04, 0x000b4e04,
+	0x000b5004, 0x000b5204, 0x00001d04, 0x000b5604, 0x000b5804, 0x000b5a04, 0x000b5c04, 0x00012304,
+	0x000b6004, 0x000b6204, 0x000b6404, 0x000b6604, 0x00012404, 0x000b6a04, 0x000b6c04, 0x000b6e04,
+	0x000b7004, 0x00012504, 0x000b7404, 0x000b7604, 0x000b7804, 0x000b7a04, 0x00012604, 0x000b7e04,
+	0x000b8004, 0x000b8204, 0x000b8404, 0x00012704, 0x000b8804, 0x000b8a04, 0x000b8c04, 0x000b8e04,
+	0x00012804, 0x000b9204, 0x000b9404, 0x000b9604, 0x000b9804, 0x00012904, 0x000b9c04, 0x000b9e04,
+	0x000ba004, 0x000ba204, 0x00012a04, 0x000ba604, 0x000ba804, 0x000baa04, 0x000bac04, 0x00012b04,
+	0x000bb004, 0x000bb204, 0x000bb404, 0x000bb604, 0x00000304, 0x000bba04, 0x000bbc04, 0x000bbe04,
+	0x000bc004, 0x00012d04, 0x000bc404, 0x000bc604, 0x000bc804, 0x000bca04, 0x00012e04, 0x000bce04,
+	0x000bd004, 0x000bd204, 0x000bd404, 0x00012f04, 0x000bd804, 0x000bda04, 0x000bdc04, 0x000bde04,
+	0x00013004, 0x000be204, 0x000be404, 0x000be604, 0x000be804, 0x00013104, 0x000bec04, 0x000bee04,
+	0x000bf004, 0x000bf204, 0x00013204, 0x000bf604, 0x000bf804, 0x000bfa04, 0x000bfc04, 0x00013304,
+	0x000c0004, 0x000c0204, 0x000c0404, 0x000c0604, 0x00013404, 0x000c0a04, 0x000c0c04, 0x000c0e04,
+	0x000c1004, 0x00013504, 0x000c1404, 0x000c1604, 0x000c1804, 0x000c1a04, 0x00001f04, 0x000c1e04,
+	0x000c2004, 0x000c2204, 0x000c2404, 0x00013704, 0x000c2804, 0x000c2a04, 0x000c2c04, 0x000c2e04,
+	0x00013804, 0x000c3204, 0x000c3404, 0x000c3604, 0x000c3804, 0x00013904, 0x000c3c04, 0x000c3e04,
+	0x000c4004, 0x000c4204, 0x00013a04, 0x000c4604, 0x000c4804, 0x000c4a04, 0x000c4c04, 0x00013b04,
+	0x000c5004, 0x000c5204, 0x000c5404, 0x000c5604, 0x00013c04, 0x000c5a04, 0x000c5c04, 0x000c5e04,
+	0x000c6004, 0x00013d04, 0x000c6404, 0x000c6604, 0x000c6804, 0x000c6a04, 0x00013e04, 0x000c6e04,
+	0x000c7004, 0x000c7204, 0x000c7404, 0x00013f04, 0x000c7804, 0x000c7a04, 0x000c7c04, 0x000c7e04,
+	0x00002004, 0x000c8204, 0x000c8404, 0x000c8604, 0x000c8804, 0x00014104, 0x000c8c04, 0x000c8e04,
+	0x000c9004, 0x000c9204, 0x00014204, 0x000c9604, 0x000c9804, 0x000c9a04, 0x000c9c04, 0x00014304,
+	0x000ca004, 0x000ca204, 0x000ca404, 0x000ca604, 0x00014404, 0x000caa04, 0x000cac04, 0x000cae04,
+	0x000cb004, 0x00014504, 0x000cb404, 0x000cb604, 0x000cb804, 0x000cba04, 0x00014604, 0x000cbe04,
+	0x000cc004, 0x000cc204, 0x000cc404, 0x00014704, 0x000cc804, 0x000cca04, 0x000ccc04, 0x000cce04,
+	0x00014804, 0x000cd204, 0x000cd404, 0x000cd604, 0x000cd804, 0x00014904, 0x000cdc04, 0x000cde04,
+	0x000ce004, 0x000ce204, 0x00002104, 0x000ce604, 0x000ce804, 0x000cea04, 0x000cec04, 0x00014b04,
+	0x000cf004, 0x000cf204, 0x000cf404, 0x000cf604, 0x00014c04, 0x000cfa04, 0x000cfc04, 0x000cfe04,
+	0x000d0004, 0x00014d04, 0x000d0404, 0x000d0604, 0x000d0804, 0x000d0a04, 0x00014e04, 0x000d0e04,
+	0x000d1004, 0x000d1204, 0x000d1404, 0x00014f04, 0x000d1804, 0x000d1a04, 0x000d1c04, 0x000d1e04,
+	0x00015004, 0x000d2204, 0x000d2404, 0x000d2604, 0x000d2804, 0x00015104, 0x000d2c04, 0x000d2e04,
+	0x000d3004, 0x000d3204, 0x00015204, 0x000d3604, 0x000d3804, 0x000d3a04, 0x000d3c04, 0x00015304,
+	0x000d4004, 0x000d4204, 0x000d4404, 0x000d4604, 0x00002204, 0x000d4a04, 0x000d4c04, 0x000d4e04,
+	0x000d5004, 0x00015504, 0x000d5404, 0x000d5604, 0x000d5804, 0x000d5a04, 0x00015604, 0x000d5e04,
+	0x000d6004, 0x000d6204, 0x000d6404, 0x00015704, 0x000d6804, 0x000d6a04, 0x000d6c04, 0x000d6e04,
+	0x00015804, 0x000d7204, 0x000d7404, 0x000d7604, 0x000d7804, 0x00015904, 0x000d7c04, 0x000d7e04,
+	0x000d8004, 0x000d8204, 0x00015a04, 0x000d8604, 0x000d8804, 0x000d8a04, 0x000d8c04, 0x00015b04,
+	0x000d9004, 0x000d9204, 0x000d9404, 0x000d9604, 0x00015c04, 0x000d9a04, 0x000d9c04, 0x000d9e04,
+	0x000da004, 0x00015d04, 0x000da404, 0x000da604, 0x000da804, 0x000daa04, 0x00002304, 0x000dae04,
+	0x000db004, 0x000db204, 0x000db404, 0x00015f04, 0x000db804, 0x000dba04, 0x000dbc04, 0x000dbe04,
+	0x00016004, 0x000dc204, 0x000dc404, 0x000dc604, 0x000dc804, 0x00016104, 0x000dcc04, 0x000dce04,
+	0x000dd004, 0x000dd204, 0x00016204, 0x000dd604, 0x000dd804, 0x000dda04, 0x000ddc04, 0x00016304,
+	0x000de004, 0x000de204, 0x000de404, 0x000de604, 0x00016404, 0x000dea04, 0x000dec04, 0x000dee04,
+	0x000df004, 0x00016504, 0x000df404, 0x000df604, 0x000df804, 0x000dfa04, 0x00016604, 0x000dfe04,
+	0x000e0004, 0x000e0204, 0x000e0404, 0x00016704, 0x000e0804, 0x000e0a04, 0x000e0c04, 0x000e0e04,
+	0x00002404, 0x000e1204, 0x000e1404, 0x000e1604, 0x000e1804, 0x00016904, 0x000e1c04, 0x000e1e04,
+	0x000e2004, 0x000e2204, 0x00016a04, 0x000e2604, 0x000e2804, 0x000e2a04, 0x000e2c04, 0x00016b04,
+	0x000e3004, 0x000e3204, 0x000e3404, 0x000e3604, 0x00016c04, 0x000e3a04, 0x000e3c04, 0x000e3e04,
+	0x000e4004, 0x00016d04, 0x000e4404, 0x000e4604, 0x000e4804, 0x000e4a04, 0x00016e04, 0x000e4e04,
+	0x000e5004, 0x000e5204, 0x000e5404, 0x00016f04, 0x000e5804, 0x000e5a04, 0x000e5c04, 0x000e5e04,
+	0x00017004, 0x000e6204, 0x000e6404, 0x000e6604, 0x000e6804, 0x00017104, 0x000e6c04, 0x000e6e04,
+	0x000e7004, 0x000e7204, 0x00002504, 0x000e7604, 0x000e7804, 0x000e7a04, 0x000e7c04, 0x00017304,
+	0x000e8004, 0x000e8204, 0x000e8404, 0x000e8604, 0x00017404, 0x000e8a04, 0x000e8c04, 0x000e8e04,
+	0x000e9004, 0x00017504, 0x000e9404, 0x000e9604, 0x000e9804, 0x000e9a04, 0x00017604, 0x000e9e04,
+	0x000ea004, 0x000ea204, 0x000ea404, 0x00017704, 0x000ea804, 0x000eaa04, 0x000eac04, 0x000eae04,
+	0x00017804, 0x000eb204, 0x000eb404, 0x000eb604, 0x000eb804, 0x00017904, 0x000ebc04, 0x000ebe04,
+	0x000ec004, 0x000ec204, 0x00017a04, 0x000ec604, 0x000ec804, 0x000eca04, 0x000ecc04, 0x00017b04,
+	0x000ed004, 0x000ed204, 0x000ed404, 0x000ed604, 0x00002604, 0x000eda04, 0x000edc04, 0x000ede04,
+	0x000ee004, 0x00017d04, 0x000ee404, 0x000ee604, 0x000ee804, 0x000eea04, 0x00017e04, 0x000eee04,
+	0x000ef004, 0x000ef204, 0x000ef404, 0x00017f04, 0x000ef804, 0x000efa04, 0x000efc04, 0x000efe04,
+	0x00018004, 0x000f0204, 0x000f0404, 0x000f0604, 0x000f0804, 0x00018104, 0x000f0c04, 0x000f0e04,
+	0x000f1004, 0x000f1204, 0x00018204, 0x000f1604, 0x000f1804, 0x000f1a04, 0x000f1c04, 0x00018304,
+	0x000f2004, 0x000f2204, 0x000f2404, 0x000f2604, 0x00018404, 0x000f2a04, 0x000f2c04, 0x000f2e04,
+	0x000f3004, 0x00018504, 0x000f3404, 0x000f3604, 0x000f3804, 0x000f3a04, 0x00002704, 0x000f3e04,
+	0x000f4004, 0x000f4204, 0x000f4404, 0x00018704, 0x000f4804, 0x000f4a04, 0x000f4c04, 0x000f4e04,
+	0x00018804, 0x000f5204, 0x000f5404, 0x000f5604, 0x000f5804, 0x00018904, 0x000f5c04, 0x000f5e04,
+	0x000f6004, 0x000f6204, 0x00018a04, 0x000f6604, 0x000f6804, 0x000f6a04, 0x000f6c04, 0x00018b04,
+	0x000f7004, 0x000f7204, 0x000f7404, 0x000f7604, 0x00018c04, 0x000f7a04, 0x000f7c04, 0x000f7e04,
+	0x000f8004, 0x00018d04, 0x000f8404, 0x000f8604, 0x000f8804, 0x000f8a04, 0x00018e04, 0x000f8e04,
+	0x000f9004, 0x000f9204, 0x000f9404, 0x00018f04, 0x000f9804, 0x000f9a04, 0x000f9c04, 0x000f9e04,
+	0x00000404, 0x000fa204, 0x000fa404, 0x000fa604, 0x000fa804, 0x00019104, 0x000fac04, 0x000fae04,
+	0x000fb004, 0x000fb204, 0x00019204, 0x000fb604, 0x000fb804, 0x000fba04, 0x000fbc04, 0x00019304,
+	0x000fc004, 0x000fc204, 0x000fc404, 0x000fc604, 0x00019404, 0x000fca04, 0x000fcc04, 0x000fce04,
+	0x000fd004, 0x00019504, 0x000fd404, 0x000fd604, 0x000fd804, 0x000fda04, 0x00019604, 0x000fde04,
+	0x000fe004, 0x000fe204, 0x000fe404, 0x00019704, 0x000fe804, 0x000fea04, 0x000fec04, 0x000fee04,
+	0x00019804, 0x000ff204, 0x000ff404, 0x000ff604, 0x000ff804, 0x00019904, 0x000ffc04, 0x000ffe04,
+	0x00100004, 0x00002904, 0x00100804, 0x00100c04, 0x00019b04, 0x00101404, 0x00019c04, 0x00101c04,
+	0x00019d04, 0x00102404, 0x00102804, 0x00019e04, 0x00103004, 0x00103404, 0x00019f04, 0x00103c04,
+	0x0001a004, 0x00104404, 0x0001a104, 0x00104c04, 0x00105004, 0x0001a204, 0x00105804, 0x00105c04,
+	0x0001a304, 0x00106404, 0x00002a04, 0x00106c04, 0x0001a504, 0x00107404, 0x00107804, 0x0001a604,
+	0x00108004, 0x00108404, 0x0001a704, 0x00108c04, 0x0001a804, 0x00109404, 0x0001a904, 0x00109c04,
+	0x0010a004, 0x0001aa04, 0x0010a804, 0x0010ac04, 0x0001ab04, 0x0010b404, 0x0001ac04, 0x0010bc04,
+	0x0001ad04, 0x0010c404, 0x0010c804, 0x00002b04, 0x0010d004, 0x0010d404, 0x0001af04, 0x0010dc04,
+	0x0001b004, 0x0010e404, 0x0001b104, 0x0010ec04, 0x0010f004, 0x0001b204, 0x0010f804, 0x0010fc04,
+	0x0001b304, 0x00110404, 0x0001b404, 0x00110c04, 0x0001b504, 0x00111404, 0x00111804, 0x0001b604,
+	0x00112004, 0x00112404, 0x0001b704, 0x00112c04, 0x00002c04, 0x00113404, 0x0001b904, 0x00113c04,
+	0x00114004, 0x0001ba04, 0x00114804, 0x00114c04, 0x0001bb04, 0x00115404, 0x0001bc04, 0x00115c04,
+	0x0001bd04, 0x00116404, 0x00116804, 0x0001be04, 0x00117004, 0x00117404, 0x0001bf04, 0x00117c04,
+	0x0001c004, 0x00118404, 0x0001c104, 0x00118c04, 0x00119004, 0x00002d04, 0x00119804, 0x00119c04,
+	0x0001c304, 0x0011a404, 0x0001c404, 0x0011ac04, 0x0001c504, 0x0011b404, 0x0011b804, 0x0001c604,
+	0x0011c004, 0x0011c404, 0x0001c704, 0x0011cc04, 0x0001c804, 0x0011d404, 0x0001c904, 0x0011dc04,
+	0x0011e004, 0x0001ca04, 0x0011e804, 0x0011ec04, 0x0001cb04, 0x0011f404, 0x00002e04, 0x0011fc04,
+	0x0001cd04, 0x00120404, 0x00120804, 0x0001ce04, 0x00121004, 0x00121404, 0x0001cf04, 0x00121c04,
+	0x0001d004, 0x00122404, 0x0001d104, 0x00122c04, 0x00123004, 0x0001d204, 0x00123804, 0x00123c04,
+	0x0001d304, 0x00124404, 0x0001d404, 0x00124c04, 0x0001d504, 0x00125404, 0x00125804, 0x00002f04,
+	0x00126004, 0x00126404, 0x0001d704, 0x00126c04, 0x0001d804, 0x00127404, 0x0001d904, 0x00127c04,
+	0x00128004, 0x0001da04, 0x00128804, 0x00128c04, 0x0001db04, 0x00129404, 0x0001dc04, 0x00129c04,
+	0x0001dd04, 0x0012a404, 0x0012a804, 0x0001de04, 0x0012b004, 0x0012b404, 0x0001df04, 0x0012bc04,
+	0x00003004, 0x0012c404, 0x0001e104, 0x0012cc04, 0x0012d004, 0x0001e204, 0x0012d804, 0x0012dc04,
+	0x0001e304, 0x0012e404, 0x0001e404, 0x0012ec04, 0x0001e504, 0x0012f404, 0x0012f804, 0x0001e604,
+	0x00130004, 0x00130404, 0x0001e704, 0x00130c04, 0x0001e804, 0x00131404, 0x0001e904, 0x00131c04,
+	0x00132004, 0x00003104, 0x00132804, 0x00132c04, 0x0001eb04, 0x00133404, 0x0001ec04, 0x00133c04,
+	0x0001ed04, 0x00134404, 0x00134804, 0x0001ee04, 0x00135004, 0x00135404, 0x0001ef04, 0x00135c04,
+	0x0001f004, 0x00136404, 0x0001f104, 0x00136c04, 0x00137004, 0x0001f204, 0x00137804, 0x00137c04,
+	0x0001f304, 0x00138404, 0x00000504, 0x00138c04, 0x0001f504, 0x00139404, 0x00139804, 0x0001f604,
+	0x0013a004, 0x0013a404, 0x0001f704, 0x0013ac04, 0x0001f804, 0x0013b404, 0x0001f904, 0x0013bc04,
+	0x0013c004, 0x0001fa04, 0x0013c804, 0x0013cc04, 0x0001fb04, 0x0013d404, 0x0001fc04, 0x0013dc04,
+	0x0001fd04, 0x0013e404, 0x0013e804, 0x00003304, 0x0013f004, 0x0013f404, 0x0001ff04, 0x0013fc04,
+	0x00020004, 0x00140404, 0x00020104, 0x00140c04, 0x00141004, 0x00020204, 0x00141804, 0x00141c04,
+	0x00020304, 0x00142404, 0x00020404, 0x00142c04, 0x00020504, 0x00143404, 0x00143804, 0x00020604,
+	0x00144004, 0x00144404, 0x00020704, 0x00144c04, 0x00003404, 0x00145404, 0x00020904, 0x00145c04,
+	0x00146004, 0x00020a04, 0x00146804, 0x00146c04, 0x00020b04, 0x00147404, 0x00020c04, 0x00147c04,
+	0x00020d04, 0x00148404, 0x00148804, 0x00020e04, 0x00149004, 0x00149404, 0x00020f04, 0x00149c04,
+	0x00021004, 0x0014a404, 0x00021104, 0x0014ac04, 0x0014b004, 0x00003504, 0x0014b804, 0x0014bc04,
+	0x00021304, 0x0014c404, 0x00021404, 0x0014cc04, 0x00021504, 0x0014d404, 0x0014d804, 0x00021604,
+	0x0014e004, 0x0014e404, 0x00021704, 0x0014ec04, 0x00021804, 0x0014f404, 0x00021904, 0x0014fc04,
+	0x00150004, 0x00021a04, 0x00150804, 0x00150c04, 0x00021b04, 0x00151404, 0x00003604, 0x00151c04,
+	0x00021d04, 0x00152404, 0x00152804, 0x00021e04, 0x00153004, 0x00153404, 0x00021f04, 0x00153c04,
+	0x00022004, 0x00154404, 0x00022104, 0x00154c04, 0x00155004, 0x00022204, 0x00155804, 0x00155c04,
+	0x00022304, 0x00156404, 0x00022404, 0x00156c04, 0x00022504, 0x00157404, 0x00157804, 0x00003704,
+	0x00158004, 0x00158404, 0x00022704, 0x00158c04, 0x00022804, 0x00159404, 0x00022904, 0x00159c04,
+	0x0015a004, 0x00022a04, 0x0015a804, 0x0015ac04, 0x00022b04, 0x0015b404, 0x00022c04, 0x0015bc04,
+	0x00022d04, 0x0015c404, 0x0015c804, 0x00022e04, 0x0015d004, 0x0015d404, 0x00022f04, 0x0015dc04,
+	0x00003804, 0x0015e404, 0x00023104, 0x0015ec04, 0x0015f004, 0x00023204, 0x0015f804, 0x0015fc04,
+	0x00023304, 0x00160404, 0x00023404, 0x00160c04, 0x00023504, 0x00161404, 0x00161804, 0x00023604,
+	0x00162004, 0x00162404, 0x00023704, 0x00162c04, 0x00023804, 0x00163404, 0x00023904, 0x00163c04,
+	0x00164004, 0x00003904, 0x00164804, 0x00164c04, 0x00023b04, 0x00165404, 0x00023c04, 0x00165c04,
+	0x00023d04, 0x00166404, 0x00166804, 0x00023e04, 0x00167004, 0x00167404, 0x00023f04, 0x00167c04,
+	0x00024004, 0x00168404, 0x00024104, 0x00168c04, 0x00169004, 0x00024204, 0x00169804, 0x00169c04,
+	0x00024304, 0x0016a404, 0x00003a04, 0x0016ac04, 0x00024504, 0x0016b404, 0x0016b804, 0x00024604,
+	0x0016c004, 0x0016c404, 0x00024704, 0x0016cc04, 0x00024804, 0x0016d404, 0x00024904, 0x0016dc04,
+	0x0016e004, 0x00024a04, 0x0016e804, 0x0016ec04, 0x00024b04, 0x0016f404, 0x00024c04, 0x0016fc04,
+	0x00024d04, 0x00170404, 0x00170804, 0x00003b04, 0x00171004, 0x00171404, 0x00024f04, 0x00171c04,
+	0x00025004, 0x00172404, 0x00025104, 0x00172c04, 0x00173004, 0x00025204, 0x00173804, 0x00173c04,
+	0x00025304, 0x00174404, 0x00025404, 0x00174c04, 0x00025504, 0x00175404, 0x00175804, 0x00025604,
+	0x00176004, 0x00176404, 0x00025704, 0x00176c04, 0x00000604, 0x00177404, 0x00025904, 0x00177c04,
+	0x00178004, 0x00025a04, 0x00178804, 0x00178c04, 0x00025b04, 0x00179404, 0x00025c04, 0x00179c04,
+	0x00025d04, 0x0017a404, 0x0017a804, 0x00025e04, 0x0017b004, 0x0017b404, 0x00025f04, 0x0017bc04,
+	0x00026004, 0x0017c404, 0x00026104, 0x0017cc04, 0x0017d004, 0x00003d04, 0x0017d804, 0x0017dc04,
+	0x00026304, 0x0017e404, 0x00026404, 0x0017ec04, 0x00026504, 0x0017f404, 0x0017f804, 0x00026604,
+	0x00180004, 0x00180404, 0x00026704, 0x00180c04, 0x00026804, 0x00181404, 0x00026904, 0x00181c04,
+	0x00182004, 0x00026a04, 0x00182804, 0x00182c04, 0x00026b04, 0x00183404, 0x00003e04, 0x00183c04,
+	0x00026d04, 0x00184404, 0x00184804, 0x00026e04, 0x00185004, 0x00185404, 0x00026f04, 0x00185c04,
+	0x00027004, 0x00186404, 0x00027104, 0x00186c04, 0x00187004, 0x00027204, 0x00187804, 0x00187c04,
+	0x00027304, 0x00188404, 0x00027404, 0x00188c04, 0x00027504, 0x00189404, 0x00189804, 0x00003f04,
+	0x0018a004, 0x0018a404, 0x00027704, 0x0018ac04, 0x00027804, 0x0018b404, 0x00027904, 0x0018bc04,
+	0x0018c004, 0x00027a04, 0x0018c804, 0x0018cc04, 0x00027b04, 0x0018d404, 0x00027c04, 0x0018dc04,
+	0x00027d04, 0x0018e404, 0x0018e804, 0x00027e04, 0x0018f004, 0x0018f404, 0x00027f04, 0x0018fc04,
+	0x00004004, 0x00190404, 0x00028104, 0x00190c04, 0x00191004, 0x00028204, 0x00191804, 0x00191c04,
+	0x00028304, 0x00192404, 0x00028404, 0x00192c04, 0x00028504, 0x00193404, 0x00193804, 0x00028604,
+	0x00194004, 0x00194404, 0x00028704, 0x00194c04, 0x00028804, 0x00195404, 0x00028904, 0x00195c04,
+	0x00196004, 0x00004104, 0x00196804, 0x00196c04, 0x00028b04, 0x00197404, 0x00028c04, 0x00197c04,
+	0x00028d04, 0x00198404, 0x00198804, 0x00028e04, 0x00199004, 0x00199404, 0x00028f04, 0x00199c04,
+	0x00029004, 0x0019a404, 0x00029104, 0x0019ac04, 0x0019b004, 0x00029204, 0x0019b804, 0x0019bc04,
+	0x00029304, 0x0019c404, 0x00004204, 0x0019cc04, 0x00029504, 0x0019d404, 0x0019d804, 0x00029604,
+	0x0019e004, 0x0019e404, 0x00029704, 0x0019ec04, 0x00029804, 0x0019f404, 0x00029904, 0x0019fc04,
+	0x001a0004, 0x00029a04, 0x001a0804, 0x001a0c04, 0x00029b04, 0x001a1404, 0x00029c04, 0x001a1c04,
+	0x00029d04, 0x001a2404, 0x001a2804, 0x00004304, 0x001a3004, 0x001a3404, 0x00029f04, 0x001a3c04,
+	0x0002a004, 0x001a4404, 0x0002a104, 0x001a4c04, 0x001a5004, 0x0002a204, 0x001a5804, 0x001a5c04,
+	0x0002a304, 0x001a6404, 0x0002a404, 0x001a6c04, 0x0002a504, 0x001a7404, 0x001a7804, 0x0002a604,
+	0x001a8004, 0x001a8404, 0x0002a704, 0x001a8c04, 0x00004404, 0x001a9404, 0x0002a904, 0x001a9c04,
+	0x001aa004, 0x0002aa04, 0x001aa804, 0x001aac04, 0x0002ab04, 0x001ab404, 0x0002ac04, 0x001abc04,
+	0x0002ad04, 0x001ac404, 0x001ac804, 0x0002ae04, 0x001ad004, 0x001ad404, 0x0002af04, 0x001adc04,
+	0x0002b004, 0x001ae404, 0x0002b104, 0x001aec04, 0x001af004, 0x00004504, 0x001af804, 0x001afc04,
+	0x0002b304, 0x001b0404, 0x0002b404, 0x001b0c04, 0x0002b504, 0x001b1404, 0x001b1804, 0x0002b604,
+	0x001b2004, 0x001b2404, 0x0002b704, 0x001b2c04, 0x0002b804, 0x001b3404, 0x0002b904, 0x001b3c04,
+	0x001b4004, 0x0002ba04, 0x001b4804, 0x001b4c04, 0x0002bb04, 0x001b5404, 0x00000704, 0x001b5c04,
+	0x0002bd04, 0x001b6404, 0x001b6804, 0x0002be04, 0x001b7004, 0x001b7404, 0x0002bf04, 0x001b7c04,
+	0x0002c004, 0x001b8404, 0x0002c104, 0x001b8c04, 0x001b9004, 0x0002c204, 0x001b9804, 0x001b9c04,
+	0x0002c304, 0x001ba404, 0x0002c404, 0x001bac04, 0x0002c504, 0x001bb404, 0x001bb804, 0x00004704,
+	0x001bc004, 0x001bc404, 0x0002c704, 0x001bcc04, 0x0002c804, 0x001bd404, 0x0002c904, 0x001bdc04,
+	0x001be004, 0x0002ca04, 0x001be804, 0x001bec04, 0x0002cb04, 0x001bf404, 0x0002cc04, 0x001bfc04,
+	0x0002cd04, 0x001c0404, 0x001c0804, 0x0002ce04, 0x001c1004, 0x001c1404, 0x0002cf04, 0x001c1c04,
+	0x00004804, 0x001c2404, 0x0002d104, 0x001c2c04, 0x001c3004, 0x0002d204, 0x001c3804, 0x001c3c04,
+	0x0002d304, 0x001c4404, 0x0002d404, 0x001c4c04, 0x0002d504, 0x001c5404, 0x001c5804, 0x0002d604,
+	0x001c6004, 0x001c6404, 0x0002d704, 0x001c6c04, 0x0002d804, 0x001c7404, 0x0002d904, 0x001c7c04,
+	0x001c8004, 0x00004904, 0x001c8804, 0x001c8c04, 0x0002db04, 0x001c9404, 0x0002dc04, 0x001c9c04,
+	0x0002dd04, 0x001ca404, 0x001ca804, 0x0002de04, 0x001cb004, 0x001cb404, 0x0002df04, 0x001cbc04,
+	0x0002e004, 0x001cc404, 0x0002e104, 0x001ccc04, 0x001cd004, 0x0002e204, 0x001cd804, 0x001cdc04,
+	0x0002e304, 0x001ce404, 0x00004a04, 0x001cec04, 0x0002e504, 0x001cf404, 0x001cf804, 0x0002e604,
+	0x001d0004, 0x001d0404, 0x0002e704, 0x001d0c04, 0x0002e804, 0x001d1404, 0x0002e904, 0x001d1c04,
+	0x001d2004, 0x0002ea04, 0x001d2804, 0x001d2c04, 0x0002eb04, 0x001d3404, 0x0002ec04, 0x001d3c04,
+	0x0002ed04, 0x001d4404, 0x001d4804, 0x00004b04, 0x001d5004, 0x001d5404, 0x0002ef04, 0x001d5c04,
+	0x0002f004, 0x001d6404, 0x0002f104, 0x001d6c04, 0x001d7004, 0x0002f204, 0x001d7804, 0x001d7c04,
+	0x0002f304, 0x001d8404, 0x0002f404, 0x001d8c04, 0x0002f504, 0x001d9404, 0x001d9804, 0x0002f604,
+	0x001da004, 0x001da404, 0x0002f704, 0x001dac04, 0x00004c04, 0x001db404, 0x0002f904, 0x001dbc04,
+	0x001dc004, 0x0002fa04, 0x001dc804, 0x001dcc04, 0x0002fb04, 0x001dd404, 0x0002fc04, 0x001ddc04,
+	0x0002fd04, 0x001de404, 0x001de804, 0x0002fe04, 0x001df004, 0x001df404, 0x0002ff04, 0x001dfc04,
+	0x00030004, 0x001e0404, 0x00030104, 0x001e0c04, 0x001e1004, 0x00004d04, 0x001e1804, 0x001e1c04,
+	0x00030304, 0x001e2404, 0x00030404, 0x001e2c04, 0x00030504, 0x001e3404, 0x001e3804, 0x00030604,
+	0x001e4004, 0x001e4404, 0x00030704, 0x001e4c04, 0x00030804, 0x001e5404, 0x00030904, 0x001e5c04,
+	0x001e6004, 0x00030a04, 0x001e6804, 0x001e6c04, 0x00030b04, 0x001e7404, 0x00004e04, 0x001e7c04,
+	0x00030d04, 0x001e8404, 0x001e8804, 0x00030e04, 0x001e9004, 0x001e9404, 0x00030f04, 0x001e9c04,
+	0x00031004, 0x001ea404, 0x00031104, 0x001eac04, 0x001eb004, 0x00031204, 0x001eb804, 0x001ebc04,
+	0x00031304, 0x001ec404, 0x00031404, 0x001ecc04, 0x00031504, 0x001ed404, 0x001ed804, 0x00004f04,
+	0x001ee004, 0x001ee404, 0x00031704, 0x001eec04, 0x00031804, 0x001ef404, 0x00031904, 0x001efc04,
+	0x001f0004, 0x00031a04, 0x001f0804, 0x001f0c04, 0x00031b04, 0x001f1404, 0x00031c04, 0x001f1c04,
+	0x00031d04, 0x001f2404, 0x001f2804, 0x00031e04, 0x001f3004, 0x001f3404, 0x00031f04, 0x001f3c04,
+	0x00000804, 0x001f4404, 0x00032104, 0x001f4c04, 0x001f5004, 0x00032204, 0x001f5804, 0x001f5c04,
+	0x00032304, 0x001f6404, 0x00032404, 0x001f6c04, 0x00032504, 0x001f7404, 0x001f7804, 0x00032604,
+	0x001f8004, 0x001f8404, 0x00032704, 0x001f8c04, 0x00032804, 0x001f9404, 0x00032904, 0x001f9c04,
+	0x001fa004, 0x00005104, 0x001fa804, 0x001fac04, 0x00032b04, 0x001fb404, 0x00032c04, 0x001fbc04,
+	0x00032d04, 0x001fc404, 0x001fc804, 0x00032e04, 0x001fd004, 0x001fd404, 0x00032f04, 0x001fdc04,
+	0x00033004, 0x001fe404, 0x00033104, 0x001fec04, 0x001ff004, 0x00033204, 0x001ff804, 0x001ffc04,
+	0x00033304, 0x00005204, 0x00033504, 0x00201804, 0x00033604, 0x00033704, 0x00033804, 0x00033904,
+	0x00033a04, 0x00204804, 0x00033b04, 0x00033c04, 0x00033d04, 0x00206804, 0x00005304, 0x00033f04,
+	0x00034004, 0x00034104, 0x00034204, 0x00209804, 0x00034304, 0x00034404, 0x00034504, 0x0020b804,
+	0x00034604, 0x00034704, 0x00005404, 0x00034904, 0x00034a04, 0x0020e804, 0x00034b04, 0x00034c04,
+	0x00034d04, 0x00210804, 0x00034e04, 0x00034f04, 0x00035004, 0x00035104, 0x00005504, 0x00213804,
+	0x00035304, 0x00035404, 0x00035504, 0x00215804, 0x00035604, 0x00035704, 0x00035804, 0x00035904,
+	0x00035a04, 0x00218804, 0x00035b04, 0x00005604, 0x00035d04, 0x0021a804, 0x00035e04, 0x00035f04,
+	0x00036004, 0x00036104, 0x00036204, 0x0021d804, 0x00036304, 0x00036404, 0x00036504, 0x0021f804,
+	0x00005704, 0x00036704, 0x00036804, 0x00036904, 0x00036a04, 0x00222804, 0x00036b04, 0x00036c04,
+	0x00036d04, 0x00224804, 0x00036e04, 0x00036f04, 0x00005804, 0x00037104, 0x00037204, 0x00227804,
+	0x00037304, 0x00037404, 0x00037504, 0x00229804, 0x00037604, 0x00037704, 0x00037804, 0x00037904,
+	0x00005904, 0x0022c804, 0x00037b04, 0x00037c04, 0x00037d04, 0x0022e804, 0x00037e04, 0x00037f04,
+	0x00038004, 0x00038104, 0x00038204, 0x00231804, 0x00038304, 0x00000904, 0x00038504, 0x00233804,
+	0x00038604, 0x00038704, 0x00038804, 0x00038904, 0x00038a04, 0x00236804, 0x00038b04, 0x00038c04,
+	0x00038d04, 0x00238804, 0x00005b04, 0x00038f04, 0x00039004, 0x00039104, 0x00039204, 0x0023b804,
+	0x00039304, 0x00039404, 0x00039504, 0x0023d804, 0x00039604, 0x00039704, 0x00005c04, 0x00039904,
+	0x00039a04, 0x00240804, 0x00039b04, 0x00039c04, 0x00039d04, 0x00242804, 0x00039e04, 0x00039f04,
+	0x0003a004, 0x0003a104, 0x00005d04, 0x00245804, 0x0003a304, 0x0003a404, 0x0003a504, 0x00247804,
+	0x0003a604, 0x0003a704, 0x0003a804, 0x0003a904, 0x0003aa04, 0x0024a804, 0x0003ab04, 0x00005e04,
+	0x0003ad04, 0x0024c804, 0x0003ae04, 0x0003af04, 0x0003b004, 0x0003b104, 0x0003b204, 0x0024f804,
+	0x0003b304, 0x0003b404, 0x0003b504, 0x00251804, 0x00005f04, 0x0003b704, 0x0003b804, 0x0003b904,
+	0x0003ba04, 0x00254804, 0x0003bb04, 0x0003bc04, 0x0003bd04, 0x00256804, 0x0003be04, 0x0003bf04,
+	0x00006004, 0x0003c104, 0x0003c204, 0x00259804, 0x0003c304, 0x0003c404, 0x0003c504, 0x0025b804,
+	0x0003c604, 0x0003c704, 0x0003c804, 0x0003c904, 0x00006104, 0x0025e804, 0x0003cb04, 0x0003cc04,
+	0x0003cd04, 0x00260804, 0x0003ce04, 0x0003cf04, 0x0003d004, 0x0003d104, 0x0003d204, 0x00263804,
+	0x0003d304, 0x00006204, 0x0003d504, 0x00265804, 0x0003d604, 0x0003d704, 0x0003d804, 0x0003d904,
+	0x0003da04, 0x00268804, 0x0003db04, 0x0003dc04, 0x0003dd04, 0x0026a804, 0x00006304, 0x0003df04,
+	0x0003e004, 0x0003e104, 0x0003e204, 0x0026d804, 0x0003e304, 0x0003e404, 0x0003e504, 0x0026f804,
+	0x0003e604, 0x0003e704, 0x00000105, 0x0003e905, 0x0003ea05, 0x00272805, 0x0003eb05, 0x0003ec05,
+	0x0003ed05, 0x00274805, 0x0003ee05, 0x0003ef05, 0x0003f005, 0x0003f105, 0x00006505, 0x00277805,
+	0x0003f305, 0x0003f405, 0x0003f505, 0x00279805, 0x0003f605, 0x0003f705, 0x0003f805, 0x0003f905,
+	0x0003fa05, 0x0027c805, 0x0003fb05, 0x00006605, 0x0003fd05, 0x0027e805, 0x0003fe05, 0x0003ff05,
+	0x00040005, 0x00040105, 0x00040205, 0x00281805, 0x00040305, 0x00040405, 0x00040505, 0x00283805,
+	0x00006705, 0x00040705, 0x00040805, 0x00040905, 0x00040a05, 0x00286805, 0x00040b05, 0x00040c05,
+	0x00040d05, 0x00288805, 0x00040e05, 0x00040f05, 0x00006805, 0x00041105, 0x00041205, 0x0028b805,
+	0x00041305, 0x00041405, 0x00041505, 0x0028d805, 0x00041605, 0x00041705, 0x00041805, 0x00041905,
+	0x00006905, 0x00290805, 0x00041b05, 0x00041c05, 0x00041d05, 0x00292805, 0x00041e05, 0x00041f05,
+	0x00042005, 0x00042105, 0x00042205, 0x00295805, 0x00042305, 0x00006a05, 0x00042505, 0x00297805,
+	0x00042605, 0x00042705, 0x00042805, 0x00042905, 0x00042a05, 0x0029a805, 0x00042b05, 0x00042c05,
+	0x00042d05, 0x0029c805, 0x00006b05, 0x00042f05, 0x00043005, 0x00043105, 0x00043205, 0x0029f805,
+	0x00043305, 0x00043405, 0x00043505, 0x002a1805, 0x00043605, 0x00043705, 0x00006c05, 0x00043905,
+	0x00043a05, 0x002a4805, 0x00043b05, 0x00043c05, 0x00043d05, 0x002a6805, 0x00043e05, 0x00043f05,
+	0x00044005, 0x00044105, 0x00006d05, 0x002a9805, 0x00044305, 0x00044405, 0x00044505, 0x002ab805,
+	0x00044605, 0x00044705, 0x00044805, 0x00044905, 0x00044a05, 0x002ae805, 0x00044b05, 0x00000b05,
+	0x00044d05, 0x002b0805, 0x00044e05, 0x00044f05, 0x00045005, 0x00045105, 0x00045205, 0x002b3805,
+	0x00045305, 0x00045405, 0x00045505, 0x002b5805, 0x00006f05, 0x00045705, 0x00045805, 0x00045905,
+	0x00045a05, 0x002b8805, 0x00045b05, 0x00045c05, 0x00045d05, 0x002ba805, 0x00045e05, 0x00045f05,
+	0x00007005, 0x00046105, 0x00046205, 0x002bd805, 0x00046305, 0x00046405, 0x00046505, 0x002bf805,
+	0x00046605, 0x00046705, 0x00046805, 0x00046905, 0x00007105, 0x002c2805, 0x00046b05, 0x00046c05,
+	0x00046d05, 0x002c4805, 0x00046e05, 0x00046f05, 0x00047005, 0x00047105, 0x00047205, 0x002c7805,
+	0x00047305, 0x00007205, 0x00047505, 0x002c9805, 0x00047605, 0x00047705, 0x00047805, 0x00047905,
+	0x00047a05, 0x002cc805, 0x00047b05, 0x00047c05, 0x00047d05, 0x002ce805, 0x00007305, 0x00047f05,
+	0x00048005, 0x00048105, 0x00048205, 0x002d1805, 0x00048305, 0x00048405, 0x00048505, 0x002d3805,
+	0x00048605, 0x00048705, 0x00007405, 0x00048905, 0x00048a05, 0x002d6805, 0x00048b05, 0x00048c05,
+	0x00048d05, 0x002d8805, 0x00048e05, 0x00048f05, 0x00049005, 0x00049105, 0x00007505, 0x002db805,
+	0x00049305, 0x00049405, 0x00049505, 0x002dd805, 0x00049605, 0x00049705, 0x00049805, 0x00049905,
+	0x00049a05, 0x002e0805, 0x00049b05, 0x00007605, 0x00049d05, 0x002e2805, 0x00049e05, 0x00049f05,
+	0x0004a005, 0x0004a105, 0x0004a205, 0x002e5805, 0x0004a305, 0x0004a405, 0x0004a505, 0x002e7805,
+	0x00007705, 0x0004a705, 0x0004a805, 0x0004a905, 0x0004aa05, 0x002ea805, 0x0004ab05, 0x0004ac05,
+	0x0004ad05, 0x002ec805, 0x0004ae05, 0x0004af05, 0x00000c05, 0x0004b105, 0x0004b205, 0x002ef805,
+	0x0004b305, 0x0004b405, 0x0004b505, 0x002f1805, 0x0004b605, 0x0004b705, 0x0004b805, 0x0004b905,
+	0x00007905, 0x002f4805, 0x0004bb05, 0x0004bc05, 0x0004bd05, 0x002f6805, 0x0004be05, 0x0004bf05,
+	0x0004c005, 0x0004c105, 0x0004c205, 0x002f9805, 0x0004c305, 0x00007a05, 0x0004c505, 0x002fb805,
+	0x0004c605, 0x0004c705, 0x0004c805, 0x0004c905, 0x0004ca05, 0x002fe805, 0x0004cb05, 0x0004cc05,
+	0x0004cd05, 0x00300805, 0x00007b05, 0x0004cf05, 0x0004d005, 0x0004d105, 0x0004d205, 0x00303805,
+	0x0004d305, 0x0004d405, 0x0004d505, 0x00305805, 0x0004d605, 0x0004d705, 0x00007c05, 0x0004d905,
+	0x0004da05, 0x00308805, 0x0004db05, 0x0004dc05, 0x0004dd05, 0x0030a805, 0x0004de05, 0x0004df05,
+	0x0004e005, 0x0004e105, 0x00007d05, 0x0030d805, 0x0004e305, 0x0004e405, 0x0004e505, 0x0030f805,
+	0x0004e605, 0x0004e705, 0x0004e805, 0x0004e905, 0x0004ea05, 0x00312805, 0x0004eb05, 0x00007e05,
+	0x0004ed05, 0x00314805, 0x0004ee05, 0x0004ef05, 0x0004f005, 0x0004f105, 0x0004f205, 0x00317805,
+	0x0004f305, 0x0004f405, 0x0004f505, 0x00319805, 0x00007f05, 0x0004f705, 0x0004f805, 0x0004f905,
+	0x0004fa05, 0x0031c805, 0x0004fb05, 0x0004fc05, 0x0004fd05, 0x0031e805, 0x0004fe05, 0x0004ff05,
+	0x00008005, 0x00050105, 0x00050205, 0x00321805, 0x00050305, 0x00050405, 0x00050505, 0x00323805,
+	0x00050605, 0x00050705, 0x00050805, 0x00050905, 0x00008105, 0x00326805, 0x00050b05, 0x00050c05,
+	0x00050d05, 0x00328805, 0x00050e05, 0x00050f05, 0x00051005, 0x00051105, 0x00051205, 0x0032b805,
+	0x00051305, 0x00000d05, 0x00051505, 0x0032d805, 0x00051605, 0x00051705, 0x00051805, 0x00051905,
+	0x00051a05, 0x00330805, 0x00051b05, 0x00051c05, 0x00051d05, 0x00332805, 0x00008305, 0x00051f05,
+	0x00052005, 0x00052105, 0x00052205, 0x00335805, 0x00052305, 0x00052405, 0x00052505, 0x00337805,
+	0x00052605, 0x00052705, 0x00008405, 0x00052905, 0x00052a05, 0x0033a805, 0x00052b05, 0x00052c05,
+	0x00052d05, 0x0033c805, 0x00052e05, 0x00052f05, 0x00053005, 0x00053105, 0x00008505, 0x0033f805,
+	0x00053305, 0x00053405, 0x00053505, 0x00341805, 0x00053605, 0x00053705, 0x00053805, 0x00053905,
+	0x00053a05, 0x00344805, 0x00053b05, 0x00008605, 0x00053d05, 0x00346805, 0x00053e05, 0x00053f05,
+	0x00054005, 0x00054105, 0x00054205, 0x00349805, 0x00054305, 0x00054405, 0x00054505, 0x0034b805,
+	0x00008705, 0x00054705, 0x00054805, 0x00054905, 0x00054a05, 0x0034e805, 0x00054b05, 0x00054c05,
+	0x00054d05, 0x00350805, 0x00054e05, 0x00054f05, 0x00008805, 0x00055105, 0x00055205, 0x00353805,
+	0x00055305, 0x00055405, 0x00055505, 0x00355805, 0x00055605, 0x00055705, 0x00055805, 0x00055905,
+	0x00008905, 0x00358805, 0x00055b05, 0x00055c05, 0x00055d05, 0x0035a805, 0x00055e05, 0x00055f05,
+	0x00056005, 0x00056105, 0x00056205, 0x0035d805, 0x00056305, 0x00008a05, 0x00056505, 0x0035f805,
+	0x00056605, 0x00056705, 0x00056805, 0x00056905, 0x00056a05, 0x00362805, 0x00056b05, 0x00056c05,
+	0x00056d05, 0x00364805, 0x00008b05, 0x00056f05, 0x00057005, 0x00057105, 0x00057205, 0x00367805,
+	0x00057305, 0x00057405, 0x00057505, 0x00369805, 0x00057605, 0x00057705, 0x00000e05, 0x00057905,
+	0x00057a05, 0x0036c805, 0x00057b05, 0x00057c05, 0x00057d05, 0x0036e805, 0x00057e05, 0x00057f05,
+	0x00058005, 0x00058105, 0x00008d05, 0x00371805, 0x00058305, 0x00058405, 0x00058505, 0x00373805,
+	0x00058605, 0x00058705, 0x00058805, 0x00058905, 0x00058a05, 0x00376805, 0x00058b05, 0x00008e05,
+	0x00058d05, 0x00378805, 0x00058e05, 0x00058f05, 0x00059005, 0x00059105, 0x00059205, 0x0037b805,
+	0x00059305, 0x00059405, 0x00059505, 0x0037d805, 0x00008f05, 0x00059705, 0x00059805, 0x00059905,
+	0x00059a05, 0x00380805, 0x00059b05, 0x00059c05, 0x00059d05, 0x00382805, 0x00059e05, 0x00059f05,
+	0x00009005, 0x0005a105, 0x0005a205, 0x00385805, 0x0005a305, 0x0005a405, 0x0005a505, 0x00387805,
+	0x0005a605, 0x0005a705, 0x0005a805, 0x0005a905, 0x00009105, 0x0038a805, 0x0005ab05, 0x0005ac05,
+	0x0005ad05, 0x0038c805, 0x0005ae05, 0x0005af05, 0x0005b005, 0x0005b105, 0x0005b205, 0x0038f805,
+	0x0005b305, 0x00009205, 0x0005b505, 0x00391805, 0x0005b605, 0x0005b705, 0x0005b805, 0x0005b905,
+	0x0005ba05, 0x00394805, 0x0005bb05, 0x0005bc05, 0x0005bd05, 0x00396805, 0x00009305, 0x0005bf05,
+	0x0005c005, 0x0005c105, 0x0005c205, 0x00399805, 0x0005c305, 0x0005c405, 0x0005c505, 0x0039b805,
+	0x0005c605, 0x0005c705, 0x00009405, 0x0005c905, 0x0005ca05, 0x0039e805, 0x0005cb05, 0x0005cc05,
+	0x0005cd05, 0x003a0805, 0x0005ce05, 0x0005cf05, 0x0005d005, 0x0005d105, 0x00009505, 0x003a3805,
+	0x0005d305, 0x0005d405, 0x0005d505, 0x003a5805, 0x0005d605, 0x0005d705, 0x0005d805, 0x0005d905,
+	0x0005da05, 0x003a8805, 0x0005db05, 0x00000f05, 0x0005dd05, 0x003aa805, 0x0005de05, 0x0005df05,
+	0x0005e005, 0x0005e105, 0x0005e205, 0x003ad805, 0x0005e305, 0x0005e405, 0x0005e505, 0x003af805,
+	0x00009705, 0x0005e705, 0x0005e805, 0x0005e905, 0x0005ea05, 0x003b2805, 0x0005eb05, 0x0005ec05,
+	0x0005ed05, 0x003b4805, 0x0005ee05, 0x0005ef05, 0x00009805, 0x0005f105, 0x0005f205, 0x003b7805,
+	0x0005f305, 0x0005f405, 0x0005f505, 0x003b9805, 0x0005f605, 0x0005f705, 0x0005f805, 0x0005f905,
+	0x00009905, 0x003bc805, 0x0005fb05, 0x0005fc05, 0x0005fd05, 0x003be805, 0x0005fe05, 0x0005ff05,
+	0x00060005, 0x00060105, 0x00060205, 0x003c1805, 0x00060305, 0x00009a05, 0x00060505, 0x003c3805,
+	0x00060605, 0x00060705, 0x00060805, 0x00060905, 0x00060a05, 0x003c6805, 0x00060b05, 0x00060c05,
+	0x00060d05, 0x003c8805, 0x00009b05, 0x00060f05, 0x00061005, 0x00061105, 0x00061205, 0x003cb805,
+	0x00061305, 0x00061405, 0x00061505, 0x003cd805, 0x00061605, 0x00061705, 0x00009c05, 0x00061905,
+	0x00061a05, 0x003d0805, 0x00061b05, 0x00061c05, 0x00061d05, 0x003d2805, 0x00061e05, 0x00061f05,
+	0x00062005, 0x00062105, 0x00009d05, 0x003d5805, 0x00062305, 0x00062405, 0x00062505, 0x003d7805,
+	0x00062605, 0x00062705, 0x00062805, 0x00062905, 0x00062a05, 0x003da805, 0x00062b05, 0x00009e05,
+	0x00062d05, 0x003dc805, 0x00062e05, 0x00062f05, 0x00063005, 0x00063105, 0x00063205, 0x003df805,
+	0x00063305, 0x00063405, 0x00063505, 0x003e1805, 0x00009f05, 0x00063705, 0x00063805, 0x00063905,
+	0x00063a05, 0x003e4805, 0x00063b05, 0x00063c05, 0x00063d05, 0x003e6805, 0x00063e05, 0x00063f05,
+	0x00001005, 0x00064105, 0x00064205, 0x003e9805, 0x00064305, 0x00064405, 0x00064505, 0x003eb805,
+	0x00064605, 0x00064705, 0x00064805, 0x00064905, 0x0000a105, 0x003ee805, 0x00064b05, 0x00064c05,
+	0x00064d05, 0x003f0805, 0x00064e05, 0x00064f05, 0x00065005, 0x00065105, 0x00065205, 0x003f3805,
+	0x00065305, 0x0000a205, 0x00065505, 0x003f5805, 0x00065605, 0x00065705, 0x00065805, 0x00065905,
+	0x00065a05, 0x003f8805, 0x00065b05, 0x00065c05, 0x00065d05, 0x003fa805, 0x0000a305, 0x00065f05,
+	0x00066005, 0x00066105, 0x00066205, 0x003fd805, 0x00066305, 0x00066405, 0x00066505, 0x003ff805,
+	0x00066605, 0x0000a405, 0x00066a05, 0x00066b05, 0x00066d05, 0x00066e05, 0x00067005, 0x0000a505,
+	0x00067305, 0x00067505, 0x00067605, 0x00067805, 0x00067a05, 0x00067b05, 0x0000a605, 0x00067e05,
+	0x00068005, 0x00068205, 0x00068305, 0x00068505, 0x0000a705, 0x00068805, 0x00068a05, 0x00068b05,
+	0x00068d05, 0x00068e05, 0x0000a805, 0x00069205, 0x00069305, 0x00069505, 0x00069605, 0x00069805,
+	0x0000a905, 0x00069b05, 0x00069d05, 0x00069e05, 0x0006a005, 0x0006a205, 0x00001105, 0x0006a505,
+	0x0006a605, 0x0006a805, 0x0006aa05, 0x0006ab05, 0x0006ad05, 0x0000ab05, 0x0006b005, 0x0006b205,
+	0x0006b305, 0x0006b505, 0x0006b605, 0x0000ac05, 0x0006ba05, 0x0006bb05, 0x0006bd05, 0x0006be05,
+	0x0006c005, 0x0000ad05, 0x0006c305, 0x0006c505, 0x0006c605, 0x0006c805, 0x0006ca05, 0x0006cb05,
+	0x0000ae05, 0x0006ce05, 0x0006d005, 0x0006d205, 0x0006d305, 0x0006d505, 0x0000af05, 0x0006d805,
+	0x0006da05, 0x0006db05, 0x0006dd05, 0x0006de05, 0x0000b005, 0x0006e205, 0x0006e305, 0x0006e505,
+	0x0006e605, 0x0006e805, 0x0000b105, 0x0006eb05, 0x0006ed05, 0x0006ee05, 0x0006f005, 0x0006f205,
+	0x0000b205, 0x0006f505, 0x0006f605, 0x0006f805, 0x0006fa05, 0x0006fb05, 0x0006fd05, 0x0000b305,
+	0x00070005, 0x00070205, 0x00070305, 0x00070505, 0x00070605, 0x00001205, 0x00070a05, 0x00070b05,
+	0x00070d05, 0x00070e05, 0x00071005, 0x0000b505, 0x00071305, 0x00071505, 0x00071605, 0x00071805,
+	0x00071a05, 0x00071b05, 0x0000b605, 0x00071e05, 0x00072005, 0x00072205, 0x00072305, 0x00072505,
+	0x0000b705, 0x00072805, 0x00072a05, 0x00072b05, 0x00072d05, 0x00072e05, 0x0000b805, 0x00073205,
+	0x00073305, 0x00073505, 0x00073605, 0x00073805, 0x0000b905, 0x00073b05, 0x00073d05, 0x00073e05,
+	0x00074005, 0x00074205, 0x0000ba05, 0x00074505, 0x00074605, 0x00074805, 0x00074a05, 0x00074b05,
+	0x00074d05, 0x0000bb05, 0x00075005, 0x00075205, 0x00075305, 0x00075505, 0x00075605, 0x0000bc05,
+	0x00075a05, 0x00075b05, 0x00075d05, 0x00075e05, 0x00076005, 0x0000bd05, 0x00076305, 0x00076505,
+	0x00076605, 0x00076805, 0x00076a05, 0x00076b05, 0x00001305, 0x00076e05, 0x00077005, 0x00077205,
+	0x00077305, 0x00077505, 0x0000bf05, 0x00077805, 0x00077a05, 0x00077b05, 0x00077d05, 0x00077e05,
+	0x0000c005, 0x00078205, 0x00078305, 0x00078505, 0x00078605, 0x00078805, 0x0000c105, 0x00078b05,
+	0x00078d05, 0x00078e05, 0x00079005, 0x00079205, 0x0000c205, 0x00079505, 0x00079605, 0x00079805,
+	0x00079a05, 0x00079b05, 0x00079d05, 0x0000c305, 0x0007a005, 0x0007a205, 0x0007a305, 0x0007a505,
+	0x0007a605, 0x0000c405, 0x0007aa05, 0x0007ab05, 0x0007ad05, 0x0007ae05, 0x0007b005, 0x0000c505,
+	0x0007b305, 0x0007b505, 0x0007b605, 0x0007b805, 0x0007ba05, 0x0007bb05, 0x0000c605, 0x0007be05,
+	0x0007c005, 0x0007c205, 0x0007c305, 0x0007c505, 0x0000c705, 0x0007c805, 0x0007ca05, 0x0007cb05,
+	0x0007cd05, 0x0007ce05, 0x00000205, 0x0007d205, 0x0007d305, 0x0007d505, 0x0007d605, 0x0007d805,
+	0x0000c905, 0x0007db05, 0x0007dd05, 0x0007de05, 0x0007e005, 0x0007e205, 0x0000ca05, 0x0007e505,
+	0x0007e605, 0x0007e805, 0x0007ea05, 0x0007eb05, 0x0007ed05, 0x0000cb05, 0x0007f005, 0x0007f205,
+	0x0007f305, 0x0007f505, 0x0007f605, 0x0000cc05, 0x0007fa05, 0x0007fb05, 0x0007fd05, 0x0007fe05,
+	0x00080005, 0x0000cd05, 0x00080305, 0x00080505, 0x00080605, 0x00080805, 0x00080a05, 0x00080b05,
+	0x0000ce05, 0x00080e05, 0x00081005, 0x00081205, 0x00081305, 0x00081505, 0x0000cf05, 0x00081805,
+	0x00081a05, 0x00081b05, 0x00081d05, 0x00081e05, 0x0000d005, 0x00082205, 0x00082305, 0x00082505,
+	0x00082605, 0x00082805, 0x0000d105, 0x00082b05, 0x00082d05, 0x00082e05, 0x00083005, 0x00083205,
+	0x00001505, 0x00083505, 0x00083605, 0x00083805, 0x00083a05, 0x00083b05, 0x00083d05, 0x0000d305,
+	0x00084005, 0x00084205, 0x00084305, 0x00084505, 0x00084605, 0x0000d405, 0x00084a05, 0x00084b05,
+	0x00084d05, 0x00084e05, 0x00085005, 0x0000d505, 0x00085305, 0x00085505, 0x00085605, 0x00085805,
+	0x00085a05, 0x00085b05, 0x0000d605, 0x00085e05, 0x00086005, 0x00086205, 0x00086305, 0x00086505,
+	0x0000d705, 0x00086805, 0x00086a05, 0x00086b05, 0x00086d05, 0x00086e05, 0x0000d805, 0x00087205,
+	0x00087305, 0x00087505, 0x00087605, 0x00087805, 0x0000d905, 0x00087b05, 0x00087d05, 0x00087e05,
+	0x00088005, 0x00088205, 0x0000da05, 0x00088505, 0x00088605, 0x00088805, 0x00088a05, 0x00088b05,
+	0x00088d05, 0x0000db05, 0x00089005, 0x00089205, 0x00089305, 0x00089505, 0x00089605, 0x00001605,
+	0x00089a05, 0x00089b05, 0x00089d05, 0x00089e05, 0x0008a005, 0x0000dd05, 0x0008a305, 0x0008a505,
+	0x0008a605, 0x0008a805, 0x0008aa05, 0x0008ab05, 0x0000de05, 0x0008ae05, 0x0008b005, 0x0008b205,
+	0x0008b305, 0x0008b505, 0x0000df05, 0x0008b805, 0x0008ba05, 0x0008bb05, 0x0008bd05, 0x0008be05,
+	0x0000e005, 0x0008c205, 0x0008c305, 0x0008c505, 0x0008c605, 0x0008c805, 0x0000e105, 0x0008cb05,
+	0x0008cd05, 0x0008ce05, 0x0008d005, 0x0008d205, 0x0000e205, 0x0008d505, 0x0008d605, 0x0008d805,
+	0x0008da05, 0x0008db05, 0x0008dd05, 0x0000e305, 0x0008e005, 0x0008e205, 0x0008e305, 0x0008e505,
+	0x0008e605, 0x0000e405, 0x0008ea05, 0x0008eb05, 0x0008ed05, 0x0008ee05, 0x0008f005, 0x0000e505,
+	0x0008f305, 0x0008f505, 0x0008f605, 0x0008f805, 0x0008fa05, 0x0008fb05, 0x00001705, 0x0008fe05,
+	0x00090005, 0x00090205, 0x00090305, 0x00090505, 0x0000e705, 0x00090805, 0x00090a05, 0x00090b05,
+	0x00090d05, 0x00090e05, 0x0000e805, 0x00091205, 0x00091305, 0x00091505, 0x00091605, 0x00091805,
+	0x0000e905, 0x00091b05, 0x00091d05, 0x00091e05, 0x00092005, 0x00092205, 0x0000ea05, 0x00092505,
+	0x00092605, 0x00092805, 0x00092a05, 0x00092b05, 0x00092d05, 0x0000eb05, 0x00093005, 0x00093205,
+	0x00093305, 0x00093505, 0x00093605, 0x0000ec05, 0x00093a05, 0x00093b05, 0x00093d05, 0x00093e05,
+	0x00094005, 0x0000ed05, 0x00094305, 0x00094505, 0x00094605, 0x00094805, 0x00094a05, 0x00094b05,
+	0x0000ee05, 0x00094e05, 0x00095005, 0x00095205, 0x00095305, 0x00095505, 0x0000ef05, 0x00095805,
+	0x00095a05, 0x00095b05, 0x00095d05, 0x00095e05, 0x00001805, 0x00096205, 0x00096305, 0x00096505,
+	0x00096605, 0x00096805, 0x0000f105, 0x00096b05, 0x00096d05, 0x00096e05, 0x00097005, 0x00097205,
+	0x0000f205, 0x00097505, 0x00097605, 0x00097805, 0x00097a05, 0x00097b05, 0x00097d05, 0x0000f305,
+	0x00098005, 0x00098205, 0x00098305, 0x00098505, 0x00098605, 0x0000f405, 0x00098a05, 0x00098b05,
+	0x00098d05, 0x00098e05, 0x00099005, 0x0000f505, 0x00099305, 0x00099505, 0x00099605, 0x00099805,
+	0x00099a05, 0x00099b05, 0x0000f605, 0x00099e05, 0x0009a005, 0x0009a205, 0x0009a305, 0x0009a505,
+	0x0000f705, 0x0009a805, 0x0009aa05, 0x0009ab05, 0x0009ad05, 0x0009ae05, 0x0000f805, 0x0009b205,
+	0x0009b305, 0x0009b505, 0x0009b605, 0x0009b805, 0x0000f905, 0x0009bb05, 0x0009bd05, 0x0009be05,
+	0x0009c005, 0x0009c205, 0x00001905, 0x0009c505, 0x0009c605, 0x0009c805, 0x0009ca05, 0x0009cb05,
+	0x0009cd05, 0x0000fb05, 0x0009d005, 0x0009d205, 0x0009d305, 0x0009d505, 0x0009d605, 0x0000fc05,
+	0x0009da05, 0x0009db05, 0x0009dd05, 0x0009de05, 0x0009e005, 0x0000fd05, 0x0009e305, 0x0009e505,
+	0x0009e605, 0x0009e805, 0x0009ea05, 0x0009eb05, 0x0000fe05, 0x0009ee05, 0x0009f005, 0x0009f205,
+	0x0009f305, 0x0009f505, 0x0000ff05, 0x0009f805, 0x0009fa05, 0x0009fb05, 0x0009fd05, 0x0009fe05,
+	0x00010005, 0x000a0205, 0x000a0305, 0x000a0505, 0x000a0605, 0x000a0805, 0x00010105, 0x000a0b05,
+	0x000a0d05, 0x000a0e05, 0x000a1005, 0x000a1205, 0x00010205, 0x000a1505, 0x000a1605, 0x000a1805,
+	0x000a1a05, 0x000a1b05, 0x000a1d05, 0x00010305, 0x000a2005, 0x000a2205, 0x000a2305, 0x000a2505,
+	0x000a2605, 0x00001a05, 0x000a2a05, 0x000a2b05, 0x000a2d05, 0x000a2e05, 0x000a3005, 0x00010505,
+	0x000a3305, 0x000a3505, 0x000a3605, 0x000a3805, 0x000a3a05, 0x000a3b05, 0x00010605, 0x000a3e05,
+	0x000a4005, 0x000a4205, 0x000a4305, 0x000a4505, 0x00010705, 0x000a4805, 0x000a4a05, 0x000a4b05,
+	0x000a4d05, 0x000a4e05, 0x00010805, 0x000a5205, 0x000a5305, 0x000a5505, 0x000a5605, 0x000a5805,
+	0x00010905, 0x000a5b05, 0x000a5d05, 0x000a5e05, 0x000a6005, 0x000a6205, 0x00010a05, 0x000a6505,
+	0x000a6605, 0x000a6805, 0x000a6a05, 0x000a6b05, 0x000a6d05, 0x00010b05, 0x000a7005, 0x000a7205,
+	0x000a7305, 0x000a7505, 0x000a7605, 0x00010c05, 0x000a7a05, 0x000a7b05, 0x000a7d05, 0x000a7e05,
+	0x000a8005, 0x00010d05, 0x000a8305, 0x000a8505, 0x000a8605, 0x000a8805, 0x000a8a05, 0x000a8b05,
+	0x00001b05, 0x000a8e05, 0x000a9005, 0x000a9205, 0x000a9305, 0x000a9505, 0x00010f05, 0x000a9805,
+	0x000a9a05, 0x000a9b05, 0x000a9d05, 0x000a9e05, 0x00011005, 0x000aa205, 0x000aa305, 0x000aa505,
+	0x000aa605, 0x000aa805, 0x00011105, 0x000aab05, 0x000aad05, 0x000aae05, 0x000ab005, 0x000ab205,
+	0x00011205, 0x000ab505, 0x000ab605, 0x000ab805, 0x000aba05, 0x000abb05, 0x000abd05, 0x00011305,
+	0x000ac005, 0x000ac205, 0x000ac305, 0x000ac505, 0x000ac605, 0x00011405, 0x000aca05, 0x000acb05,
+	0x000acd05, 0x000ace05, 0x000ad005, 0x00011505, 0x000ad305, 0x000ad505, 0x000ad605, 0x000ad805,
+	0x000ada05, 0x000adb05, 0x00011605, 0x000ade05, 0x000ae005, 0x000ae205, 0x000ae305, 0x000ae505,
+	0x00011705, 0x000ae805, 0x000aea05, 0x000aeb05, 0x000aed05, 0x000aee05, 0x00001c05, 0x000af205,
+	0x000af305, 0x000af505, 0x000af605, 0x000af805, 0x00011905, 0x000afb05, 0x000afd05, 0x000afe05,
+	0x000b0005, 0x000b0205, 0x00011a05, 0x000b0505, 0x000b0605, 0x000b0805, 0x000b0a05, 0x000b0b05,
+	0x000b0d05, 0x00011b05, 0x000b1005, 0x000b1205, 0x000b1305, 0x000b1505, 0x000b1605, 0x00011c05,
+	0x000b1a05, 0x000b1b05, 0x000b1d05, 0x000b1e05, 0x000b2005, 0x00011d05, 0x000b2305, 0x000b2505,
+	0x000b2605, 0x000b2805, 0x000b2a05, 0x000b2b05, 0x00011e05, 0x000b2e05, 0x000b3005, 0x000b3205,
+	0x000b3305, 0x000b3505, 0x00011f05, 0x000b3805, 0x000b3a05, 0x000b3b05, 0x000b3d05, 0x000b3e05,
+	0x00012005, 0x000b4205, 0x000b4305, 0x000b4505, 0x000b4605, 0x000b4805, 0x00012105, 0x000b4b05,
+	0x000b4d05, 0x000b4e05, 0x000b5005, 0x000b5205, 0x00001d05, 0x000b5505, 0x000b5605, 0x000b5805,
+	0x000b5a05, 0x000b5b05, 0x000b5d05, 0x00012305, 0x000b6005, 0x000b6205, 0x000b6305, 0x000b6505,
+	0x000b6605, 0x00012405, 0x000b6a05, 0x000b6b05, 0x000b6d05, 0x000b6e05, 0x000b7005, 0x00012505,
+	0x000b7305, 0x000b7505, 0x000b7605, 0x000b7805, 0x000b7a05, 0x000b7b05, 0x00012605, 0x000b7e05,
+	0x000b8005, 0x000b8205, 0x000b8305, 0x000b8505, 0x00012705, 0x000b8805, 0x000b8a05, 0x000b8b05,
+	0x000b8d05, 0x000b8e05, 0x00012805, 0x000b9205, 0x000b9305, 0x000b9505, 0x000b9605, 0x000b9805,
+	0x00012905, 0x000b9b05, 0x000b9d05, 0x000b9e05, 0x000ba005, 0x000ba205, 0x00012a05, 0x000ba505,
+	0x000ba605, 0x000ba805, 0x000baa05, 0x000bab05, 0x000bad05, 0x00012b05, 0x000bb005, 0x000bb205,
+	0x000bb305, 0x000bb505, 0x000bb605, 0x00000305, 0x000bba05, 0x000bbb05, 0x000bbd05, 0x000bbe05,
+	0x000bc005, 0x00012d05, 0x000bc305, 0x000bc505, 0x000bc605, 0x000bc805, 0x000bca05, 0x000bcb05,
+	0x00012e05, 0x000bce05, 0x000bd005, 0x000bd205, 0x000bd305, 0x000bd505, 0x00012f05, 0x000bd805,
+	0x000bda05, 0x000bdb05, 0x000bdd05, 0x000bde05, 0x00013005, 0x000be205, 0x000be305, 0x000be505,
+	0x000be605, 0x000be805, 0x00013105, 0x000beb05, 0x000bed05, 0x000bee05, 0x000bf005, 0x000bf205,
+	0x00013205, 0x000bf505, 0x000bf605, 0x000bf805, 0x000bfa05, 0x000bfb05, 0x000bfd05, 0x00013305,
+	0x000c0005, 0x000c0205, 0x000c0305, 0x000c0505, 0x000c0605, 0x00013405, 0x000c0a05, 0x000c0b05,
+	0x000c0d05, 0x000c0e05, 0x000c1005, 0x00013505, 0x000c1305, 0x000c1505, 0x000c1605, 0x000c1805,
+	0x000c1a05, 0x000c1b05, 0x00001f05, 0x000c1e05, 0x000c2005, 0x000c2205, 0x000c2305, 0x000c2505,
+	0x00013705, 0x000c2805, 0x000c2a05, 0x000c2b05, 0x000c2d05, 0x000c2e05, 0x00013805, 0x000c3205,
+	0x000c3305, 0x000c3505, 0x000c3605, 0x000c3805, 0x00013905, 0x000c3b05, 0x000c3d05, 0x000c3e05,
+	0x000c4005, 0x000c4205, 0x00013a05, 0x000c4505, 0x000c4605, 0x000c4805, 0x000c4a05, 0x000c4b05,
+	0x000c4d05, 0x00013b05, 0x000c5005, 0x000c5205, 0x000c5305, 0x000c5505, 0x000c5605, 0x00013c05,
+	0x000c5a05, 0x000c5b05, 0x000c5d05, 0x000c5e05, 0x000c6005, 0x00013d05, 0x000c6305, 0x000c6505,
+	0x000c6605, 0x000c6805, 0x000c6a05, 0x000c6b05, 0x00013e05, 0x000c6e05, 0x000c7005, 0x000c7205,
+	0x000c7305, 0x000c7505, 0x00013f05, 0x000c7805, 0x000c7a05, 0x000c7b05, 0x000c7d05, 0x000c7e05,
+	0x00002005, 0x000c8205, 0x000c8305, 0x000c8505, 0x000c8605, 0x000c8805, 0x00014105, 0x000c8b05,
+	0x000c8d05, 0x000c8e05, 0x000c9005, 0x000c9205, 0x00014205, 0x000c9505, 0x000c9605, 0x000c9805,
+	0x000c9a05, 0x000c9b05, 0x000c9d05, 0x00014305, 0x000ca005, 0x000ca205, 0x000ca305, 0x000ca505,
+	0x000ca605, 0x00014405, 0x000caa05, 0x000cab05, 0x000cad05, 0x000cae05, 0x000cb005, 0x00014505,
+	0x000cb305, 0x000cb505, 0x000cb605, 0x000cb805, 0x000cba05, 0x000cbb05, 0x00014605, 0x000cbe05,
+	0x000cc005, 0x000cc205, 0x000cc305, 0x000cc505, 0x00014705, 0x000cc805, 0x000cca05, 0x000ccb05,
+	0x000ccd05, 0x00014805, 0x000cd305, 0x000cd605, 0x00014905, 0x000cdd05, 0x000ce005, 0x00002105,
+	0x000ce605, 0x000cea05, 0x00014b05, 0x000cf005, 0x000cf305, 0x000cf605, 0x00014c05, 0x000cfd05,
+	0x000d0005, 0x00014d05, 0x000d0605, 0x000d0a05, 0x00014e05, 0x000d1005, 0x000d1305, 0x00014f05,
+	0x000d1a05, 0x000d1d05, 0x00015005, 0x000d2305, 0x000d2605, 0x00015105, 0x000d2d05, 0x000d3005,
+	0x00015205, 0x000d3605, 0x000d3a05, 0x00015305, 0x000d4005, 0x000d4305, 0x00002205, 0x000d4a05,
+	0x000d4d05, 0x000d5005, 0x00015505, 0x000d5605, 0x000d5a05, 0x00015605, 0x000d6005, 0x000d6305,
+	0x00015705, 0x000d6a05, 0x000d6d05, 0x00015805, 0x000d7305, 0x000d7605, 0x00015905, 0x000d7d05,
+	0x000d8005, 0x00015a05, 0x000d8605, 0x000d8a05, 0x00015b05, 0x000d9005, 0x000d9305, 0x000d9605,
+	0x00015c05, 0x000d9d05, 0x000da005, 0x00015d05, 0x000da605, 0x000daa05, 0x00002305, 0x000db005,
+	0x000db305, 0x00015f05, 0x000dba05, 0x000dbd05, 0x00016005, 0x000dc305, 0x000dc605, 0x00016105,
+	0x000dcd05, 0x000dd005, 0x00016205, 0x000dd605, 0x000dda05, 0x00016305, 0x000de005, 0x000de305,
+	0x00016405, 0x000dea05, 0x000ded05, 0x000df005, 0x00016505, 0x000df605, 0x000dfa05, 0x00016605,
+	0x000e0005, 0x000e0305, 0x00016705, 0x000e0a05, 0x000e0d05, 0x00002405, 0x000e1305, 0x000e1605,
+	0x00016905, 0x000e1d05, 0x000e2005, 0x00016a05, 0x000e2605, 0x000e2a05, 0x00016b05, 0x000e3005,
+	0x000e3305, 0x000e3605, 0x00016c05, 0x000e3d05, 0x000e4005, 0x00016d05, 0x000e4605, 0x000e4a05,
+	0x00016e05, 0x000e5005, 0x000e5305, 0x00016f05, 0x000e5a05, 0x000e5d05, 0x00017005, 0x000e6305,
+	0x000e6605, 0x00017105, 0x000e6d05, 0x000e7005, 0x00002505, 0x000e7605, 0x000e7a05, 0x00017305,
+	0x000e8005, 0x000e8305, 0x00017405, 0x000e8a05, 0x000e8d05, 0x000e9005, 0x00017505, 0x000e9605,
+	0x000e9a05, 0x00017605, 0x000ea005, 0x000ea305, 0x00017705, 0x000eaa05, 0x000ead05, 0x00017805,
+	0x000eb305, 0x000eb605, 0x00017905, 0x000ebd05, 0x000ec005, 0x00017a05, 0x000ec605, 0x000eca05,
+	0x00017b05, 0x000ed005, 0x000ed305, 0x000ed605, 0x00002605, 0x000edd05, 0x000ee005, 0x00017d05,
+	0x000ee605, 0x000eea05, 0x00017e05, 0x000ef005, 0x000ef305, 0x00017f05, 0x000efa05, 0x000efd05,
+	0x00018005, 0x000f0305, 0x000f0605, 0x00018105, 0x000f0d05, 0x000f1005, 0x00018205, 0x000f1605,
+	0x000f1a05, 0x00018305, 0x000f2005, 0x000f2305, 0x00018405, 0x000f2a05, 0x000f2d05, 0x000f3005,
+	0x00018505, 0x000f3605, 0x000f3a05, 0x00002705, 0x000f4005, 0x000f4305, 0x00018705, 0x000f4a05,
+	0x000f4d05, 0x00018805, 0x000f5305, 0x000f5605, 0x00018905, 0x000f5d05, 0x000f6005, 0x00018a05,
+	0x000f6605, 0x000f6a05, 0x00018b05, 0x000f7005, 0x000f7305, 0x000f7605, 0x00018c05, 0x000f7d05,
+	0x000f8005, 0x00018d05, 0x000f8605, 0x000f8a05, 0x00018e05, 0x000f9005, 0x000f9305, 0x00018f05,
+	0x000f9a05, 0x000f9d05, 0x00000405, 0x000fa305, 0x000fa605, 0x00019105, 0x000fad05, 0x000fb005,
+	0x00019205, 0x000fb605, 0x000fba05, 0x00019305, 0x000fc005, 0x000fc305, 0x00019405, 0x000fca05,
+	0x000fcd05, 0x000fd005, 0x00019505, 0x000fd605, 0x000fda05, 0x00019605, 0x000fe005, 0x000fe305,
+	0x00019705, 0x000fea05, 0x000fed05, 0x00019805, 0x000ff305, 0x000ff605, 0x00019905, 0x000ffd05,
+	0x00100005, 0x00002905, 0x00100605, 0x00100a05, 0x00019b05, 0x00101005, 0x00101305, 0x00101605,
+	0x00019c05, 0x00101d05, 0x00102005, 0x00019d05, 0x00102605, 0x00102a05, 0x00019e05, 0x00103005,
+	0x00103305, 0x00019f05, 0x00103a05, 0x00103d05, 0x0001a005, 0x00104305, 0x00104605, 0x0001a105,
+	0x00104d05, 0x00105005, 0x0001a205, 0x00105605, 0x00105a05, 0x0001a305, 0x00106005, 0x00106305,
+	0x00002a05, 0x00106a05, 0x00106d05, 0x00107005, 0x0001a505, 0x00107605, 0x00107a05, 0x0001a605,
+	0x00108005, 0x00108305, 0x0001a705, 0x00108a05, 0x00108d05, 0x0001a805, 0x00109305, 0x00109605,
+	0x0001a905, 0x00109d05, 0x0010a005, 0x0001aa05, 0x0010a605, 0x0010aa05, 0x0001ab05, 0x0010b005,
+	0x0010b305, 0x0010b605, 0x0001ac05, 0x0010bd05, 0x0010c005, 0x0001ad05, 0x0010c605, 0x0010ca05,
+	0x00002b05, 0x0010d005, 0x0010d305, 0x0001af05, 0x0010da05, 0x0010dd05, 0x0001b005, 0x0010e305,
+	0x0010e605, 0x0001b105, 0x0010ed05, 0x0010f005, 0x0001b205, 0x0010f605, 0x0010fa05, 0x0001b305,
+	0x00110005, 0x00110305, 0x0001b405, 0x00110a05, 0x00110d05, 0x00111005, 0x0001b505, 0x00111605,
+	0x00111a05, 0x0001b605, 0x00112005, 0x00112305, 0x0001b705, 0x00112a05, 0x00112d05, 0x00002c05,
+	0x00113305, 0x00113605, 0x0001b905, 0x00113d05, 0x00114005, 0x0001ba05, 0x00114605, 0x00114a05,
+	0x0001bb05, 0x00115005, 0x00115305, 0x00115605, 0x0001bc05, 0x00115d05, 0x00116005, 0x0001bd05,
+	0x00116605, 0x00116a05, 0x0001be05, 0x00117005, 0x00117305, 0x0001bf05, 0x00117a05, 0x00117d05,
+	0x0001c005, 0x00118305, 0x00118605, 0x0001c105, 0x00118d05, 0x00119005, 0x00002d05, 0x00119605,
+	0x00119a05, 0x0001c305, 0x0011a005, 0x0011a305, 0x0001c405, 0x0011aa05, 0x0011ad05, 0x0011b005,
+	0x0001c505, 0x0011b605, 0x0011ba05, 0x0001c605, 0x0011c005, 0x0011c305, 0x0001c705, 0x0011ca05,
+	0x0011cd05, 0x0001c805, 0x0011d305, 0x0011d605, 0x0001c905, 0x0011dd05, 0x0011e005, 0x0001ca05,
+	0x0011e605, 0x0011ea05, 0x0001cb05, 0x0011f005, 0x0011f305, 0x0011f605, 0x00002e05, 0x0011fd05,
+	0x00120005, 0x0001cd05, 0x00120605, 0x00120a05, 0x0001ce05, 0x00121005, 0x00121305, 0x0001cf05,
+	0x00121a05, 0x00121d05, 0x0001d005, 0x00122305, 0x00122605, 0x0001d105, 0x00122d05, 0x00123005,
+	0x0001d205, 0x00123605, 0x00123a05, 0x0001d305, 0x00124005, 0x00124305, 0x0001d405, 0x00124a05,
+	0x00124d05, 0x00125005, 0x0001d505, 0x00125605, 0x00125a05, 0x00002f05, 0x00126005, 0x00126305,
+	0x0001d705, 0x00126a05, 0x00126d05, 0x0001d805, 0x00127305, 0x00127605, 0x0001d905, 0x00127d05,
+	0x00128005, 0x0001da05, 0x00128605, 0x00128a05, 0x0001db05, 0x00129005, 0x00129305, 0x00129605,
+	0x0001dc05, 0x00129d05, 0x0012a005, 0x0001dd05, 0x0012a605, 0x0012aa05, 0x0001de05, 0x0012b005,
+	0x0012b305, 0x0001df05, 0x0012ba05, 0x0012bd05, 0x00003005, 0x0012c305, 0x0012c605, 0x0001e105,
+	0x0012cd05, 0x0012d005, 0x0001e205, 0x0012d605, 0x0012da05, 0x0001e305, 0x0012e005, 0x0012e305,
+	0x0001e405, 0x0012ea05, 0x0012ed05, 0x0012f005, 0x0001e505, 0x0012f605, 0x0012fa05, 0x0001e605,
+	0x00130005, 0x00130305, 0x0001e705, 0x00130a05, 0x00130d05, 0x0001e805, 0x00131305, 0x00131605,
+	0x0001e905, 0x00131d05, 0x00132005, 0x00003105, 0x00132605, 0x00132a05, 0x0001eb05, 0x00133005,
+	0x00133305, 0x00133605, 0x0001ec05, 0x00133d05, 0x00134005, 0x0001ed05, 0x00134605, 0x00134a05,
+	0x0001ee05, 0x00135005, 0x00135305, 0x0001ef05, 0x00135a05, 0x00135d05, 0x0001f005, 0x00136305,
+	0x00136605, 0x0001f105, 0x00136d05, 0x00137005, 0x0001f205, 0x00137605, 0x00137a05, 0x0001f305,
+	0x00138005, 0x00138305, 0x00000505, 0x00138a05, 0x00138d05, 0x00139005, 0x0001f505, 0x00139605,
+	0x00139a05, 0x0001f605, 0x0013a005, 0x0013a305, 0x0001f705, 0x0013aa05, 0x0013ad05, 0x0001f805,
+	0x0013b305, 0x0013b605, 0x0001f905, 0x0013bd05, 0x0013c005, 0x0001fa05, 0x0013c605, 0x0013ca05,
+	0x0001fb05, 0x0013d005, 0x0013d305, 0x0013d605, 0x0001fc05, 0x0013dd05, 0x0013e005, 0x0001fd05,
+	0x0013e605, 0x0013ea05, 0x00003305, 0x0013f005, 0x0013f305, 0x0001ff05, 0x0013fa05, 0x0013fd05,
+	0x00020005, 0x00140305, 0x00140605, 0x00020105, 0x00140d05, 0x00141005, 0x00020205, 0x00141605,
+	0x00141a05, 0x00020305, 0x00142005, 0x00142305, 0x00020405, 0x00142a05, 0x00142d05, 0x00143005,
+	0x00020505, 0x00143605, 0x00143a05, 0x00020605, 0x00144005, 0x00144305, 0x00020705, 0x00144a05,
+	0x00144d05, 0x00003405, 0x00145305, 0x00145605, 0x00020905, 0x00145d05, 0x00146005, 0x00020a05,
+	0x00146605, 0x00146a05, 0x00020b05, 0x00147005, 0x00147305, 0x00147605, 0x00020c05, 0x00147d05,
+	0x00148005, 0x00020d05, 0x00148605, 0x00148a05, 0x00020e05, 0x00149005, 0x00149305, 0x00020f05,
+	0x00149a05, 0x00149d05, 0x00021005, 0x0014a305, 0x0014a605, 0x00021105, 0x0014ad05, 0x0014b005,
+	0x00003505, 0x0014b605, 0x0014ba05, 0x00021305, 0x0014c005, 0x0014c305, 0x00021405, 0x0014ca05,
+	0x0014cd05, 0x0014d005, 0x00021505, 0x0014d605, 0x0014da05, 0x00021605, 0x0014e005, 0x0014e305,
+	0x00021705, 0x0014ea05, 0x0014ed05, 0x00021805, 0x0014f305, 0x0014f605, 0x00021905, 0x0014fd05,
+	0x00150005, 0x00021a05, 0x00150605, 0x00150a05, 0x00021b05, 0x00151005, 0x00151305, 0x00151605,
+	0x00003605, 0x00151d05, 0x00152005, 0x00021d05, 0x00152605, 0x00152a05, 0x00021e05, 0x00153005,
+	0x00153305, 0x00021f05, 0x00153a05, 0x00153d05, 0x00022005, 0x00154305, 0x00154605, 0x00022105,
+	0x00154d05, 0x00155005, 0x00022205, 0x00155605, 0x00155a05, 0x00022305, 0x00156005, 0x00156305,
+	0x00022405, 0x00156a05, 0x00156d05, 0x00157005, 0x00022505, 0x00157605, 0x00157a05, 0x00003705,
+	0x00158005, 0x00158305, 0x00022705, 0x00158a05, 0x00158d05, 0x00022805, 0x00159305, 0x00159605,
+	0x00022905, 0x00159d05, 0x0015a005, 0x00022a05, 0x0015a605, 0x0015aa05, 0x00022b05, 0x0015b005,
+	0x0015b305, 0x0015b605, 0x00022c05, 0x0015bd05, 0x0015c005, 0x00022d05, 0x0015c605, 0x0015ca05,
+	0x00022e05, 0x0015d005, 0x0015d305, 0x00022f05, 0x0015da05, 0x0015dd05, 0x00003805, 0x0015e305,
+	0x0015e605, 0x00023105, 0x0015ed05, 0x0015f005, 0x00023205, 0x0015f605, 0x0015fa05, 0x00023305,
+	0x00160005, 0x00160305, 0x00023405, 0x00160a05, 0x00160d05, 0x00161005, 0x00023505, 0x00161605,
+	0x00161a05, 0x00023605, 0x00162005, 0x00162305, 0x00023705, 0x00162a05, 0x00162d05, 0x00023805,
+	0x00163305, 0x00163605, 0x00023905, 0x00163d05, 0x00164005, 0x00003905, 0x00164605, 0x00164a05,
+	0x00023b05, 0x00165005, 0x00165305, 0x00165605, 0x00023c05, 0x00165d05, 0x00166005, 0x00023d05,
+	0x00166605, 0x00166a05, 0x00023e05, 0x00167005, 0x00167305, 0x00023f05, 0x00167a05, 0x00167d05,
+	0x00024005, 0x00168305, 0x00168605, 0x00024105, 0x00168d05, 0x00169005, 0x00024205, 0x00169605,
+	0x00169a05, 0x00024305, 0x0016a005, 0x0016a305, 0x00003a05, 0x0016aa05, 0x0016ad05, 0x0016b005,
+	0x00024505, 0x0016b605, 0x0016ba05, 0x00024605, 0x0016c005, 0x0016c305, 0x00024705, 0x0016ca05,
+	0x0016cd05, 0x00024805, 0x0016d305, 0x0016d605, 0x00024905, 0x0016dd05, 0x0016e005, 0x00024a05,
+	0x0016e605, 0x0016ea05, 0x00024b05, 0x0016f005, 0x0016f305, 0x0016f605, 0x00024c05, 0x0016fd05,
+	0x00170005, 0x00024d05, 0x00170605, 0x00170a05, 0x00003b05, 0x00171005, 0x00171305, 0x00024f05,
+	0x00171a05, 0x00171d05, 0x00025005, 0x00172305, 0x00172605, 0x00025105, 0x00172d05, 0x00173005,
+	0x00025205, 0x00173605, 0x00173a05, 0x00025305, 0x00174005, 0x00174305, 0x00025405, 0x00174a05,
+	0x00174d05, 0x00175005, 0x00025505, 0x00175605, 0x00175a05, 0x00025605, 0x00176005, 0x00176305,
+	0x00025705, 0x00176a05, 0x00176d05, 0x00000605, 0x00177305, 0x00177605, 0x00025905, 0x00177d05,
+	0x00178005, 0x00025a05, 0x00178605, 0x00178a05, 0x00025b05, 0x00179005, 0x00179305, 0x00179605,
+	0x00025c05, 0x00179d05, 0x0017a005, 0x00025d05, 0x0017a605, 0x0017aa05, 0x00025e05, 0x0017b005,
+	0x0017b305, 0x00025f05, 0x0017ba05, 0x0017bd05, 0x00026005, 0x0017c305, 0x0017c605, 0x00026105,
+	0x0017cd05, 0x0017d005, 0x00003d05, 0x0017d605, 0x0017da05, 0x00026305, 0x0017e005, 0x0017e305,
+	0x00026405, 0x0017ea05, 0x0017ed05, 0x0017f005, 0x00026505, 0x0017f605, 0x0017fa05, 0x00026605,
+	0x00180005, 0x00180305, 0x00026705, 0x00180a05, 0x00180d05, 0x00026805, 0x00181305, 0x00181605,
+	0x00026905, 0x00181d05, 0x00182005, 0x00026a05, 0x00182605, 0x00182a05, 0x00026b05, 0x00183005,
+	0x00183305, 0x00183605, 0x00003e05, 0x00183d05, 0x00184005, 0x00026d05, 0x00184605, 0x00184a05,
+	0x00026e05, 0x00185005, 0x00185305, 0x00026f05, 0x00185a05, 0x00185d05, 0x00027005, 0x00186305,
+	0x00186605, 0x00027105, 0x00186d05, 0x00187005, 0x00027205, 0x00187605, 0x00187a05, 0x00027305,
+	0x00188005, 0x00188305, 0x00027405, 0x00188a05, 0x00188d05, 0x00189005, 0x00027505, 0x00189605,
+	0x00189a05, 0x00003f05, 0x0018a005, 0x0018a305, 0x00027705, 0x0018aa05, 0x0018ad05, 0x00027805,
+	0x0018b305, 0x0018b605, 0x00027905, 0x0018bd05, 0x0018c005, 0x00027a05, 0x0018c605, 0x0018ca05,
+	0x00027b05, 0x0018d005, 0x0018d305, 0x0018d605, 0x00027c05, 0x0018dd05, 0x0018e005, 0x00027d05,
+	0x0018e605, 0x0018ea05, 0x00027e05, 0x0018f005, 0x0018f305, 0x00027f05, 0x0018fa05, 0x0018fd05,
+	0x00004005, 0x00190305, 0x00190605, 0x00028105, 0x00190d05, 0x00191005, 0x00028205, 0x00191605,
+	0x00191a05, 0x00028305, 0x00192005, 0x00192305, 0x00028405, 0x00192a05, 0x00192d05, 0x00193005,
+	0x00028505, 0x00193605, 0x00193a05, 0x00028605, 0x00194005, 0x00194305, 0x00028705, 0x00194a05,
+	0x00194d05, 0x00028805, 0x00195305, 0x00195605, 0x00028905, 0x00195d05, 0x00196005, 0x00004105,
+	0x00196605, 0x00196a05, 0x00028b05, 0x00197005, 0x00197305, 0x00197605, 0x00028c05, 0x00197d05,
+	0x00198005, 0x00028d05, 0x00198605, 0x00198a05, 0x00028e05, 0x00199005, 0x00199305, 0x00028f05,
+};
+static const uint32_t lookupbf_table[0x7F80] = {
+	0x00000000, 0x000001d9, 0x000002d9, 0x000003d9, 0x000004d9, 0x000005d9, 0x000037d9, 0x000006d9,
+	0x000007d9, 0x000008d9, 0x000009d9, 0x000001da, 0x00000bda, 0x00000cda, 0x00000dda, 0x00000eda,
+	0x00000fda, 0x000010da, 0x0000a5da, 0x000011da, 0x000012da, 0x000013da, 0x000002da, 0x000015da,
+	0x000016da, 0x000017da, 0x000018da, 0x000019da, 0x00001ada, 0x00001bda, 0x00001cda, 0x00011dda,
+	0x00001dda, 0x000003da, 0x00001fda, 0x000020da, 0x000021da, 0x000022da, 0x000023da, 0x000024da,
+	0x000025da, 0x000026da, 0x000027da, 0x00018bda, 0x000004da, 0x000029da, 0x00002ada, 0x00002bda,
+	0x00002cda, 0x00002dda, 0x00002eda, 0x00002fda, 0x000030da, 0x000031da, 0x000005da, 0x0001f9da,
+	0x000033da, 0x000034da, 0x000035da, 0x000036da, 0x000037da, 0x000038da, 0x000039da, 0x00003ada,
+	0x00003bda, 0x000006da, 0x00003dda, 0x000267da, 0x00003eda, 0x00003fda, 0x000040da, 0x000041da,
+	0x000042da, 0x000043da, 0x000044da, 0x000045da, 0x000007da, 0x000047da, 0x000048da, 0x000049da,
+	0x0002dfda, 0x00004ada, 0x00004bda, 0x00004cda, 0x00004dda, 0x00004eda, 0x00004fda, 0x000008da,
+	0x000051da, 0x000052da, 0x000053da, 0x000054da, 0x00034dda, 0x000055da, 0x000056da, 0x000057da,
+	0x000058da, 0x000059da, 0x000009da, 0x00005bda, 0x00005cda, 0x00005dda, 0x00005eda, 0x00005fda,
+	0x0003bbda, 0x000060da, 0x000061da, 0x000062da, 0x000063da, 0x000001db, 0x000065db, 0x000066db,
+	0x000067db, 0x000068db, 0x000069db, 0x00006adb, 0x000429db, 0x00006bdb, 0x00006cdb, 0x00006ddb,
+	0x00000bdb, 0x00006fdb, 0x000070db, 0x000071db, 0x000072db, 0x000073db, 0x000074db, 0x000075db,
+	0x000076db, 0x0004a1db, 0x000077db, 0x00000cdb, 0x000079db, 0x00007adb, 0x00007bdb, 0x00007cdb,
+	0x00007ddb, 0x00007edb, 0x00007fdb, 0x000080db, 0x000081db, 0x00050fdb, 0x00000ddb, 0x000083db,
+	0x000084db, 0x000085db, 0x000086db, 0x000087db, 0x000088db, 0x000089db, 0x00008adb, 0x00008bdb,
+	0x00000edb, 0x00057ddb, 0x00008ddb, 0x00008edb, 0x00008fdb, 0x000090db, 0x000091db, 0x000092db,
+	0x000093db, 0x000094db, 0x000095db, 0x00000fdb, 0x000097db, 0x0005ebdb, 0x000098db, 0x000099db,
+	0x00009adb, 0x00009bdb, 0x00009cdb, 0x00009ddb, 0x00009edb, 0x00009fdb, 0x000010db, 0x0000a1db,
+	0x0000a2db, 0x0000a3db, 0x000663db, 0x0000a4db, 0x0000a5db, 0x0000a6db, 0x0000a7db, 0x0000a8db,
+	0x0000a9db, 0x000011db, 0x0000abdb, 0x0000acdb, 0x0000addb, 0x0000aedb, 0x0006d1db, 0x0000afdb,
+	0x0000b0db, 0x0000b1db, 0x0000b2db, 0x0000b3db, 0x000012db, 0x0000b5db, 0x0000b6db, 0x0000b7db,
+	0x0000b8db, 0x0000b9db, 0x00073fdb, 0x0000badb, 0x0000bbdb, 0x0000bcdb, 0x0000bddb, 0x000013db,
+	0x0000bfdb, 0x0000c0db, 0x0000c1db, 0x0000c2db, 0x0000c3db, 0x0000c4db, 0x0007addb, 0x0000c5db,
+	0x0000c6db, 0x0000c7db, 0x000002db, 0x0000c9db, 0x0000cadb, 0x0000cbdb, 0x0000ccdb, 0x0000cddb,
+	0x0000cedb, 0x0000cfdb, 0x0000d0db, 0x000825db, 0x0000d1db, 0x000015db, 0x0000d3db, 0x0000d4db,
+	0x0000d5db, 0x0000d6db, 0x0000d7db, 0x0000d8db, 0x0000d9db, 0x0000dadb, 0x0000dbdb, 0x000893db,
+	0x000016db, 0x0000dddb, 0x0000dedb, 0x0000dfdb, 0x0000e0db, 0x0000e1db, 0x0000e2db, 0x0000e3db,
+	0x0000e4db, 0x0000e5db, 0x000017db, 0x000901db, 0x0000e7db, 0x0000e8db, 0x0000e9db, 0x0000eadb,
+	0x0000ebdb, 0x0000eddb, 0x0000efdb, 0x000018db, 0x0000f2db, 0x0000f4db, 0x0000f6db, 0x0000f8db,
+	0x000019db, 0x0000fcdb, 0x0000fddb, 0x0000ffdb, 0x000101db, 0x000103db, 0x00001adb, 0x000107db,
+	0x000108db, 0x00010adb, 0x00010cdb, 0x00001bdb, 0x000110db, 0x000112db, 0x000114db, 0x000115db,
+	0x00001cdb, 0x000119db, 0x00011bdb, 0x00011ddb, 0x00011fdb, 0x000120db, 0x00001ddb, 0x000124db,
+	0x000126db, 0x000128db, 0x00012adb, 0x000003db, 0x00012ddb, 0x00012fdb, 0x000131db, 0x000133db,
+	0x000135db, 0x00001fdb, 0x000138db, 0x00013adb, 0x00013cdb, 0x00013edb, 0x000020db, 0x000141db,
+	0x000143db, 0x000145db, 0x000147db, 0x000149db, 0x000021db, 0x00014cdb, 0x00014edb, 0x000150db,
+	0x000152db, 0x000022db, 0x000156db, 0x000157db, 0x000159db, 0x00015bdb, 0x00015ddb, 0x000023db,
+	0x000161db, 0x000162db, 0x000164db, 0x000166db, 0x000024db, 0x00016adb, 0x00016cdb, 0x00016edb,
+	0x00016fdb, 0x000025db, 0x000173db, 0x000175db, 0x000177db, 0x000179db, 0x00017adb, 0x000026db,
+	0x00017edb, 0x000180db, 0x000182db, 0x000184db, 0x000027db, 0x000187db, 0x000189db, 0x00018bdb,
+	0x00018ddb, 0x00018fdb, 0x000004db, 0x000192db, 0x000194db, 0x000196db, 0x000198db, 0x000029db,
+	0x00019bdb, 0x00019ddb, 0x00019fdb, 0x0001a1db, 0x0001a3db, 0x00002adb, 0x0001a6db, 0x0001a8db,
+	0x0001aadb, 0x0001acdb, 0x00002bdb, 0x0001b0db, 0x0001b1db, 0x0001b3db, 0x0001b5db, 0x0001b7db,
+	0x00002cdb, 0x0001bbdb, 0x0001bcdb, 0x0001bedb, 0x0001c0db, 0x00002ddb, 0x0001c4db, 0x0001c6db,
+	0x0001c8db, 0x0001c9db, 0x00002edb, 0x0001cddb, 0x0001cfdb, 0x0001d1db, 0x0001d3db, 0x0001d4db,
+	0x00002fdb, 0x0001dadb, 0x0001dedb, 0x000030db, 0x0001e5db, 0x000031db, 0x0001ecdb, 0x0001f0db,
+	0x000005db, 0x0001f7db, 0x0001fbdb, 0x000033db, 0x000202db, 0x000206db, 0x000034db, 0x00020ddb,
+	0x000035db, 0x000215db, 0x000218db, 0x000036db, 0x000220db, 0x000223db, 0x000037db, 0x00022bdb,
+	0x000038db, 0x000232db, 0x000236db, 0x000039db, 0x00023ddb, 0x000241db, 0x00003adb, 0x000248db,
+	0x00024cdb, 0x00003bdb, 0x000253db, 0x000006db, 0x00025adb, 0x00025edb, 0x00003ddb, 0x000265db,
+	0x000269db, 0x00003edb, 0x000270db, 0x000274db, 0x00003fdb, 0x00027cdb, 0x000040db, 0x000283db,
+	0x000287db, 0x000041db, 0x00028edb, 0x000292db, 0x000042db, 0x000299db, 0x000043db, 0x0002a0db,
+	0x0002a4db, 0x000044db, 0x0002abdb, 0x0002afdb, 0x000045db, 0x0002b6db, 0x0002badb, 0x000007db,
+	0x0002c1db, 0x000047db, 0x0002c9db, 0x0002ccdb, 0x000048db, 0x0002d4db, 0x0002d7db, 0x000049db,
+	0x0002dfdb, 0x00004adb, 0x0002e6db, 0x0002eadb, 0x00004bdb, 0x0002f1db, 0x0002f5db, 0x00004cdb,
+	0x0002fcdb, 0x000300db, 0x00004ddb, 0x000307db, 0x00004edb, 0x00030edb, 0x000312db, 0x00004fdb,
+	0x000319db, 0x00031ddb, 0x000008db, 0x000324db, 0x000328db, 0x000051db, 0x00032fdb, 0x000052db,
+	0x000337db, 0x00033bdb, 0x000053db, 0x000342db, 0x000346db, 0x000054db, 0x00034ddb, 0x000055db,
+	0x000354db, 0x000358db, 0x000056db, 0x00035fdb, 0x000363db, 0x000057db, 0x00036adb, 0x00036edb,
+	0x000058db, 0x000375db, 0x000059db, 0x00037ddb, 0x000380db, 0x000009db, 0x000388db, 0x00038bdb,
+	0x00005bdb, 0x000393db, 0x00005cdb, 0x00039adb, 0x00039edb, 0x00005ddb, 0x0003a5db, 0x0003a9db,
+	0x00005edb, 0x00005fdb, 0x0003bbdb, 0x000060db, 0x000061db, 0x000062db, 0x0003d8db, 0x000063db,
+	0x000001dc, 0x000065dc, 0x0003f6dc, 0x000066dc, 0x000067dc, 0x00040cdc, 0x000068dc, 0x000069dc,
+	0x00006adc, 0x000429dc, 0x00006bdc, 0x00006cdc, 0x00006ddc, 0x000447dc, 0x00000bdc, 0x00006fdc,
+	0x000070dc, 0x000464dc, 0x000071dc, 0x000072dc, 0x00047adc, 0x000073dc, 0x000074dc, 0x000075dc,
+	0x000497dc, 0x000076dc, 0x000077dc, 0x00000cdc, 0x0004b5dc, 0x000079dc, 0x00007adc, 0x00007bdc,
+	0x0004d2dc, 0x00007cdc, 0x00007ddc, 0x0004e8dc, 0x00007edc, 0x00007fdc, 0x000080dc, 0x000506dc,
+	0x000081dc, 0x00000ddc, 0x000083dc, 0x000523dc, 0x000084dc, 0x000085dc, 0x000086dc, 0x000540dc,
+	0x000087dc, 0x000088dc, 0x000089dc, 0x00055edc, 0x00008adc, 0x00008bdc, 0x000574dc, 0x00000edc,
+	0x00008ddc, 0x00008edc, 0x000591dc, 0x00008fdc, 0x000090dc, 0x000091dc, 0x0005afdc, 0x000092dc,
+	0x000093dc, 0x000094dc, 0x0005ccdc, 0x000095dc, 0x00000fdc, 0x0005e2dc, 0x000097dc, 0x000098dc,
+	0x000099dc, 0x0005ffdc, 0x00009adc, 0x00009bdc, 0x00009cdc, 0x00061ddc, 0x00009ddc, 0x00009edc,
+	0x00009fdc, 0x00063adc, 0x000010dc, 0x0000a1dc, 0x000650dc, 0x0000a2dc, 0x0000a3dc, 0x0000a4dc,
+	0x00066edc, 0x0000a5dc, 0x0000a6dc, 0x0000a7dc, 0x00068bdc, 0x0000a8dc, 0x0000a9dc, 0x000011dc,
+	0x0006a8dc, 0x0000abdc, 0x0000acdc, 0x0000addc, 0x0006c6dc, 0x0000aedc, 0x0000afdc, 0x0006dcdc,
+	0x0000b0dc, 0x0000b1dc, 0x0000b2dc, 0x0006f9dc, 0x0000b3dc, 0x000012dc, 0x0000b5dc, 0x000717dc,
+	0x0000b6dc, 0x0000b7dc, 0x0000b8dc, 0x000734dc, 0x0000b9dc, 0x0000badc, 0x00074adc, 0x0000bbdc,
+	0x0000bcdc, 0x000013dc, 0x0000bfdc, 0x0000c0dc, 0x0000c2dc, 0x0000c3dc, 0x0000c5dc, 0x0000c6dc,
+	0x000002dc, 0x0000c9dc, 0x0000cbdc, 0x0000ccdc, 0x0000cedc, 0x0000cfdc, 0x0000d1dc, 0x000015dc,
+	0x0000d4dc, 0x0000d5dc, 0x0000d7dc, 0x0000d8dc, 0x0000d9dc, 0x0000dbdc, 0x000016dc, 0x0000dedc,
+	0x0000dfdc, 0x0000e1dc, 0x0000e2dc, 0x0000e4dc, 0x0000e5dc, 0x000017dc, 0x0000e8dc, 0x0000eadc,
+	0x0000ebdc, 0x0000eddc, 0x0000eedc, 0x000018dc, 0x0000f1dc, 0x0000f2dc, 0x0000f4dc, 0x0000f5dc,
+	0x0000f7dc, 0x0000f8dc, 0x000019dc, 0x0000fbdc, 0x0000fddc, 0x0000fedc, 0x000100dc, 0x000101dc,
+	0x000103dc, 0x00001adc, 0x000106dc, 0x000107dc, 0x000108dc, 0x00010adc, 0x00010bdc, 0x00010ddc,
+	0x00001bdc, 0x000110dc, 0x000111dc, 0x000113dc, 0x000114dc, 0x000116dc, 0x000117dc, 0x00001cdc,
+	0x00011adc, 0x00011cdc, 0x00011ddc, 0x00011fdc, 0x000120dc, 0x00001ddc, 0x000123dc, 0x000124dc,
+	0x000126dc, 0x000127dc, 0x000129dc, 0x00012adc, 0x000003dc, 0x00012ddc, 0x00012fdc, 0x000130dc,
+	0x000132dc, 0x000133dc, 0x000135dc, 0x00001fdc, 0x000138dc, 0x000139dc, 0x00013adc, 0x00013cdc,
+	0x00013ddc, 0x00013fdc, 0x000020dc, 0x000142dc, 0x000143dc, 0x000145dc, 0x000146dc, 0x000148dc,
+	0x000149dc, 0x000021dc, 0x00014cdc, 0x00014edc, 0x00014fdc, 0x000150dc, 0x000152dc, 0x000022dc,
+	0x000155dc, 0x000156dc, 0x000158dc, 0x000159dc, 0x00015bdc, 0x00015cdc, 0x000023dc, 0x00015fdc,
+	0x000161dc, 0x000162dc, 0x000164dc, 0x000165dc, 0x000167dc, 0x000024dc, 0x000169dc, 0x00016bdc,
+	0x00016cdc, 0x00016edc, 0x00016fdc, 0x000171dc, 0x000025dc, 0x000174dc, 0x000175dc, 0x000177dc,
+	0x000178dc, 0x000026dc, 0x00017edc, 0x000181dc, 0x000184dc, 0x000027dc, 0x00018adc, 0x00018ddc,
+	0x000004dc, 0x000193dc, 0x000196dc, 0x000198dc, 0x000029dc, 0x00019edc, 0x0001a1dc, 0x00002adc,
+	0x0001a7dc, 0x0001aadc, 0x00002bdc, 0x0001b0dc, 0x0001b3dc, 0x0001b6dc, 0x00002cdc, 0x0001bcdc,
+	0x0001bfdc, 0x00002ddc, 0x0001c5dc, 0x0001c8dc, 0x0001cadc, 0x00002edc, 0x0001d0dc, 0x0001d3dc,
+	0x00002fdc, 0x0001d9dc, 0x0001dcdc, 0x000030dc, 0x0001e2dc, 0x0001e5dc, 0x0001e8dc, 0x000031dc,
+	0x0001eedc, 0x0001f1dc, 0x000005dc, 0x0001f7dc, 0x0001f9dc, 0x0001fcdc, 0x000033dc, 0x000202dc,
+	0x000205dc, 0x000034dc, 0x00020bdc, 0x00020edc, 0x000035dc, 0x000214dc, 0x000217dc, 0x00021adc,
+	0x000036dc, 0x000220dc, 0x000223dc, 0x000037dc, 0x000228dc, 0x00022bdc, 0x00022edc, 0x000038dc,
+	0x000234dc, 0x000237dc, 0x000039dc, 0x00023ddc, 0x000240dc, 0x00003adc, 0x000246dc, 0x000249dc,
+	0x00024cdc, 0x00003bdc, 0x000252dc, 0x000255dc, 0x000006dc, 0x00025adc, 0x00025ddc, 0x000260dc,
+	0x00003ddc, 0x000266dc, 0x000269dc, 0x00003edc, 0x00026fdc, 0x000272dc, 0x00003fdc, 0x000278dc,
+	0x00027bdc, 0x00027edc, 0x000040dc, 0x000284dc, 0x000287dc, 0x000041dc, 0x00028cdc, 0x00028fdc,
+	0x000292dc, 0x000042dc, 0x000298dc, 0x00029bdc, 0x000043dc, 0x0002a1dc, 0x0002a4dc, 0x000044dc,
+	0x0002aadc, 0x0002addc, 0x0002b0dc, 0x000045dc, 0x0002b6dc, 0x0002b8dc, 0x000007dc, 0x0002bedc,
+	0x0002c1dc, 0x0002c4dc, 0x000047dc, 0x0002cadc, 0x0002cddc, 0x000048dc, 0x0002d3dc, 0x0002d6dc,
+	0x000049dc, 0x0002dcdc, 0x0002dfdc, 0x0002e2dc, 0x00004adc, 0x0002e8dc, 0x0002eadc, 0x00004bdc,
+	0x0002f0dc, 0x00004cdc, 0x0002fcdc, 0x00004ddc, 0x000308dc, 0x00004edc, 0x00004fdc, 0x000319dc,
+	0x000008dc, 0x000325dc, 0x000051dc, 0x000331dc, 0x000052dc, 0x000053dc, 0x000343dc, 0x000054dc,
+	0x00034edc, 0x000055dc, 0x000056dc, 0x000360dc, 0x000057dc, 0x00036cdc, 0x000058dc, 0x000059dc,
+	0x00037ddc, 0x000009dc, 0x000389dc, 0x00005bdc, 0x000395dc, 0x00005cdc, 0x00005ddc, 0x0003a7dc,
+	0x00005edc, 0x0003b2dc, 0x00005fdc, 0x000060dc, 0x0003c4dc, 0x000061dc, 0x0003d0dc, 0x000062dc,
+	0x000063dc, 0x0003e1dc, 0x000001dd, 0x0003eddd, 0x000065dd, 0x0003f9dd, 0x000066dd, 0x000067dd,
+	0x00040add, 0x000068dd, 0x000416dd, 0x000069dd, 0x00006add, 0x000428dd, 0x00006bdd, 0x000434dd,
+	0x00006cdd, 0x00006ddd, 0x000445dd, 0x00000bdd, 0x000451dd, 0x00006fdd, 0x00045ddd, 0x000070dd,
+	0x000071dd, 0x00046edd, 0x000072dd, 0x00047add, 0x000073dd, 0x000074dd, 0x00048cdd, 0x000075dd,
+	0x000497dd, 0x000076dd, 0x000077dd, 0x0004a9dd, 0x00000cdd, 0x0004b5dd, 0x000079dd, 0x0004c1dd,
+	0x00007add, 0x00007bdd, 0x0004d2dd, 0x00007cdd, 0x0004dedd, 0x00007ddd, 0x00007edd, 0x0004f0dd,
+	0x00007fdd, 0x0004fbdd, 0x000080dd, 0x000081dd, 0x00050ddd, 0x00000ddd, 0x000519dd, 0x000083dd,
+	0x000525dd, 0x000084dd, 0x000085dd, 0x000536dd, 0x000086dd, 0x000542dd, 0x000087dd, 0x000088dd,
+	0x000554dd, 0x000089dd, 0x00055fdd, 0x00008add, 0x00008bdd, 0x000571dd, 0x00000edd, 0x00057ddd,
+	0x00008ddd, 0x000588dd, 0x00008edd, 0x00008fdd, 0x00059add, 0x000090dd, 0x0005a6dd, 0x000091dd,
+	0x000092dd, 0x0005b7dd, 0x000093dd, 0x0005c3dd, 0x000094dd, 0x0005cfdd, 0x000095dd, 0x00000fdd,
+	0x000097dd, 0x000098dd, 0x000099dd, 0x00009add, 0x00009bdd, 0x00009cdd, 0x00009edd, 0x00009fdd,
+	0x000010dd, 0x0000a1dd, 0x0000a2dd, 0x0000a3dd, 0x0000a5dd, 0x0000a6dd, 0x0000a7dd, 0x0000a8dd,
+	0x0000a9dd, 0x000011dd, 0x0000acdd, 0x0000addd, 0x0000aedd, 0x0000afdd, 0x0000b0dd, 0x0000b1dd,
+	0x0000b3dd, 0x000012dd, 0x0000b5dd, 0x0000b6dd, 0x0000b7dd, 0x0000b9dd, 0x0000badd, 0x0000bbdd,
+	0x0000bcdd, 0x0000bddd, 0x000013dd, 0x0000c0dd, 0x0000c1dd, 0x0000c2dd, 0x0000c3dd, 0x0000c4dd,
+	0x0000c5dd, 0x0000c7dd, 0x000002dd, 0x0000c9dd, 0x0000cadd, 0x0000cbdd, 0x0000cddd, 0x0000cedd,
+	0x0000cfdd, 0x0000d0dd, 0x0000d1dd, 0x000015dd, 0x0000d4dd, 0x0000d5dd, 0x0000d6dd, 0x0000d7dd,
+	0x0000d8dd, 0x0000d9dd, 0x0000dbdd, 0x000016dd, 0x0000dddd, 0x0000dedd, 0x0000dfdd, 0x0000e1dd,
+	0x0000e2dd, 0x0000e3dd, 0x0000e4dd, 0x0000e5dd, 0x000017dd, 0x0000e8dd, 0x0000e9dd, 0x0000eadd,
+	0x0000ebdd, 0x0000ecdd, 0x0000eddd, 0x0000efdd, 0x000018dd, 0x0000f1dd, 0x0000f2dd, 0x0000f3dd,
+	0x0000f5dd, 0x0000f6dd, 0x0000f7dd, 0x0000f8dd, 0x0000f9dd, 0x000019dd, 0x0000fcdd, 0x0000fddd,
+	0x0000fedd, 0x0000ffdd, 0x000100dd, 0x000101dd, 0x000103dd, 0x00001add, 0x000105dd, 0x000106dd,
+	0x000107dd, 0x000108dd, 0x00010add, 0x00010bdd, 0x00010cdd, 0x00010ddd, 0x00001bdd, 0x000110dd,
+	0x000111dd, 0x000112dd, 0x000113dd, 0x000114dd, 0x000115dd, 0x000117dd, 0x00001cdd, 0x000119dd,
+	0x00011add, 0x00011bdd, 0x00011cdd, 0x00011edd, 0x00011fdd, 0x000120dd, 0x000121dd, 0x00001ddd,
+	0x000124dd, 0x000125dd, 0x000126dd, 0x000127dd, 0x000128dd, 0x000129dd, 0x00012bdd, 0x000003dd,
+	0x00012ddd, 0x00012fdd, 0x000132dd, 0x000134dd, 0x00001fdd, 0x000139dd, 0x00013bdd, 0x00013ddd,
+	0x000020dd, 0x000142dd, 0x000144dd, 0x000147dd, 0x000021dd, 0x00014bdd, 0x00014edd, 0x000150dd,
+	0x000153dd, 0x000022dd, 0x000157dd, 0x00015add, 0x00015cdd, 0x000023dd, 0x000161dd, 0x000163dd,
+	0x000165dd, 0x000024dd, 0x00016add, 0x00016cdd, 0x00016fdd, 0x000025dd, 0x000173dd, 0x000176dd,
+	0x000178dd, 0x00017bdd, 0x000026dd, 0x00017fdd, 0x000182dd, 0x000184dd, 0x000027dd, 0x000189dd,
+	0x00018bdd, 0x00018ddd, 0x000004dd, 0x000192dd, 0x000194dd, 0x000197dd, 0x000029dd, 0x00019bdd,
+	0x00019edd, 0x0001a0dd, 0x0001a2dd, 0x00002add, 0x0001a7dd, 0x0001aadd, 0x0001acdd, 0x00002bdd,
+	0x0001b1dd, 0x0001b3dd, 0x0001b5dd, 0x00002cdd, 0x0001badd, 0x0001bcdd, 0x0001bfdd, 0x00002ddd,
+	0x0001c3dd, 0x0001c6dd, 0x0001c8dd, 0x0001cadd, 0x00002edd, 0x0001cfdd, 0x0001d1dd, 0x0001d4dd,
+	0x00002fdd, 0x0001d9dd, 0x0001dbdd, 0x0001dddd, 0x000030dd, 0x0001e2dd, 0x0001e4dd, 0x0001e7dd,
+	0x000031dd, 0x0001ebdd, 0x0001eedd, 0x0001f0dd, 0x0001f2dd, 0x000005dd, 0x0001f7dd, 0x0001f9dd,
+	0x0001fcdd, 0x000033dd, 0x000201dd, 0x000203dd, 0x000205dd, 0x000034dd, 0x00020add, 0x00020cdd,
+	0x00020fdd, 0x000035dd, 0x000213dd, 0x000216dd, 0x000218dd, 0x00021add, 0x000036dd, 0x00021fdd,
+	0x000221dd, 0x000224dd, 0x000037dd, 0x000228dd, 0x00022bdd, 0x00022ddd, 0x000038dd, 0x000232dd,
+	0x000234dd, 0x000237dd, 0x000039dd, 0x00023bdd, 0x00023edd, 0x000240dd, 0x000242dd, 0x00003add,
+	0x000247dd, 0x000249dd, 0x00024cdd, 0x00003bdd, 0x000250dd, 0x000253dd, 0x000255dd, 0x000006dd,
+	0x00025add, 0x00025fdd, 0x00003ddd, 0x000268dd, 0x00003edd, 0x000271dd, 0x00003fdd, 0x00027bdd,
+	0x000040dd, 0x000284dd, 0x000041dd, 0x00028edd, 0x000042dd, 0x000297dd, 0x000043dd, 0x0002a0dd,
+	0x0002a5dd, 0x000044dd, 0x0002aedd, 0x000045dd, 0x0002b8dd, 0x000007dd, 0x0002c1dd, 0x000047dd,
+	0x0002cbdd, 0x000048dd, 0x0002d4dd, 0x000049dd, 0x0002dedd, 0x00004add, 0x0002e7dd, 0x0002ecdd,
+	0x00004bdd, 0x0002f5dd, 0x00004cdd, 0x0002fedd, 0x00004ddd, 0x000308dd, 0x00004edd, 0x000311dd,
+	0x00004fdd, 0x00031bdd, 0x000008dd, 0x000324dd, 0x000051dd, 0x00032ddd, 0x000052dd, 0x000337dd,
+	0x00033cdd, 0x000053dd, 0x000345dd, 0x000054dd, 0x00034edd, 0x000055dd, 0x000358dd, 0x000056dd,
+	0x000361dd, 0x000057dd, 0x00036bdd, 0x000058dd, 0x000374dd, 0x000059dd, 0x00037ddd, 0x000009dd,
+	0x000387dd, 0x00038bdd, 0x00005bdd, 0x000395dd, 0x00005cdd, 0x00039edd, 0x00005ddd, 0x0003a8dd,
+	0x00005edd, 0x0003b1dd, 0x00005fdd, 0x0003bbdd, 0x000060dd, 0x0003c4dd, 0x000061dd, 0x0003cddd,
+	0x000062dd, 0x0003d7dd, 0x0003dbdd, 0x000063dd, 0x0003e5dd, 0x000001de, 0x0003eede, 0x000065de,
+	0x0003f8de, 0x000066de, 0x000401de, 0x000067de, 0x00040ade, 0x000068de, 0x000414de, 0x000069de,
+	0x00041dde, 0x00006ade, 0x000427de, 0x00042bde, 0x00006bde, 0x000435de, 0x00006cde, 0x00043ede,
+	0x00006dde, 0x000448de, 0x00000bde, 0x000451de, 0x00006fde, 0x00045ade, 0x000070de, 0x000464de,
+	0x000071de, 0x00046dde, 0x000072de, 0x000477de, 0x00047bde, 0x000073de, 0x000485de, 0x000074de,
+	0x00048ede, 0x000075de, 0x000497de, 0x000076de, 0x0004a1de, 0x000077de, 0x0004aade, 0x00000cde,
+	0x0004b4de, 0x000079de, 0x00007ade, 0x00007bde, 0x00007cde, 0x00007dde, 0x00007ede, 0x00007fde,
+	0x000080de, 0x000081de, 0x00000dde, 0x000083de, 0x000084de, 0x000085de, 0x000086de, 0x000541de,
+	0x000087de, 0x000088de, 0x000089de, 0x00008ade, 0x00008bde, 0x00000ede, 0x00008dde, 0x00008ede,
+	0x00008fde, 0x000090de, 0x000091de, 0x000092de, 0x000093de, 0x000094de, 0x000095de, 0x0005d7de,
+	0x00000fde, 0x000097de, 0x000098de, 0x000099de, 0x00009ade, 0x00009bde, 0x00009cde, 0x00009dde,
+	0x00009ede, 0x00009fde, 0x000010de, 0x0000a1de, 0x0000a2de, 0x0000a3de, 0x0000a4de, 0x0000a5de,
+	0x000677de, 0x0000a6de, 0x0000a7de, 0x0000a8de, 0x0000a9de, 0x000011de, 0x0000abde, 0x0000acde,
+	0x0000adde, 0x0000aede, 0x0000afde, 0x0000b0de, 0x0000b1de, 0x0000b2de, 0x0000b3de, 0x000012de,
+	0x0000b5de, 0x000717de, 0x0000b6de, 0x0000b7de, 0x0000b8de, 0x0000b9de, 0x0000bade, 0x0000bbde,
+	0x0000bcde, 0x0000bdde, 0x000013de, 0x0000bfde, 0x0000c0de, 0x0000c1de, 0x0000c2de, 0x0000c3de,
+	0x0000c4de, 0x0000c5de, 0x0007b7de, 0x0000c6de, 0x0000c7de, 0x000002de, 0x0000c9de, 0x0000cade,
+	0x0000cbde, 0x0000ccde, 0x0000cdde, 0x0000cede, 0x0000cfde, 0x0000d0de, 0x0000d1de, 0x000015de,
+	0x0000d3de, 0x0000d4de, 0x00084dde, 0x0000d5de, 0x0000d6de, 0x0000d7de, 0x0000d8de, 0x0000d9de,
+	0x0000dade, 0x0000dbde, 0x000016de, 0x0000ddde, 0x0000dede, 0x0000dfde, 0x0000e0de, 0x0000e1de,
+	0x0000e2de, 0x0000e3de, 0x0000e4de, 0x0008edde, 0x0000e5de, 0x000017de, 0x0000e7de, 0x0000e8de,
+	0x0000e9de, 0x0000eade, 0x0000ebde, 0x0000ecde, 0x0000edde, 0x0000eede, 0x0000efde, 0x000018de,
+	0x0000f1de, 0x0000f3de, 0x0000f5de, 0x0000f6de, 0x0000f8de, 0x000019de, 0x0000fcde, 0x0000fede,
+	0x000100de, 0x000102de, 0x00001ade, 0x000105de, 0x000107de, 0x000109de, 0x00010bde, 0x00010dde,
+	0x00001bde, 0x000111de, 0x000113de, 0x000114de, 0x000116de, 0x00001cde, 0x00011ade, 0x00011cde,
+	0x00011ede, 0x000120de, 0x00001dde, 0x000124de, 0x000125de, 0x000127de, 0x000129de, 0x00012bde,
+	0x000003de, 0x00012fde, 0x000131de, 0x000133de, 0x000134de, 0x00001fde, 0x000138de, 0x00013ade,
+	0x00013cde, 0x00013ede, 0x000020de, 0x000142de, 0x000143de, 0x000145de, 0x000147de, 0x000021de,
+	0x00014bde, 0x00014dde, 0x00014fde, 0x000151de, 0x000153de, 0x000022de, 0x000156de, 0x000158de,
+	0x00015ade, 0x00015cde, 0x000023de, 0x000160de, 0x000162de, 0x000163de, 0x000165de, 0x000024de,
+	0x000169de, 0x00016bde, 0x00016dde, 0x00016fde, 0x000171de, 0x000025de, 0x000174de, 0x000176de,
+	0x000178de, 0x00017ade, 0x000026de, 0x00017ede, 0x000180de, 0x000182de, 0x000183de, 0x000027de,
+	0x000187de, 0x000189de, 0x00018bde, 0x00018dde, 0x00018fde, 0x000004de, 0x000192de, 0x000194de,
+	0x000196de, 0x000198de, 0x000029de, 0x00019cde, 0x00019ede, 0x0001a0de, 0x0001a2de, 0x00002ade,
+	0x0001a5de, 0x0001a7de, 0x0001a9de, 0x0001abde, 0x0001adde, 0x00002bde, 0x0001b1de, 0x0001b2de,
+	0x0001b4de, 0x0001b6de, 0x00002cde, 0x0001bade, 0x0001bcde, 0x0001bede, 0x0001c0de, 0x00002dde,
+	0x0001c3de, 0x0001c5de, 0x0001c7de, 0x0001c9de, 0x0001cbde, 0x00002ede, 0x0001cfde, 0x0001d1de,
+	0x0001d2de, 0x0001d4de, 0x00002fde, 0x0001d8de, 0x0001dade, 0x0001dcde, 0x0001dede, 0x000030de,
+	0x0001e1de, 0x0001e5de, 0x000031de, 0x0001edde, 0x0001f1de, 0x000005de, 0x0001f8de, 0x0001fcde,
+	0x000033de, 0x000203de, 0x000034de, 0x00020bde, 0x00020fde, 0x000035de, 0x000216de, 0x00021ade,
+	0x000036de, 0x000221de, 0x000037de, 0x000229de, 0x00022dde, 0x000038de, 0x000234de, 0x000238de,
+	0x000039de, 0x000240de, 0x00003ade, 0x000247de, 0x00024bde, 0x00003bde, 0x000252de, 0x000256de,
+	0x000006de, 0x00025ede, 0x00003dde, 0x000265de, 0x000269de, 0x00003ede, 0x000270de, 0x00003fde,
+	0x000278de, 0x00027cde, 0x000040de, 0x000283de, 0x000287de, 0x000041de, 0x00028fde, 0x000042de,
+	0x000296de, 0x00029ade, 0x000043de, 0x0002a1de, 0x0002a5de, 0x000044de, 0x0002adde, 0x000045de,
+	0x0002b4de, 0x0002b8de, 0x000007de, 0x0002bfde, 0x0002c3de, 0x000047de, 0x0002cbde, 0x000048de,
+	0x0002d2de, 0x0002d6de, 0x000049de, 0x0002dede, 0x0002e1de, 0x00004ade, 0x0002e9de, 0x00004bde,
+	0x0002f0de, 0x0002f4de, 0x00004cde, 0x0002fcde, 0x0002ffde, 0x00004dde, 0x000307de, 0x00004ede,
+	0x00030ede, 0x000312de, 0x00004fde, 0x00031ade, 0x00031dde, 0x000008de, 0x000325de, 0x000051de,
+	0x00032dde, 0x000330de, 0x000052de, 0x000338de, 0x00033cde, 0x000053de, 0x000343de, 0x000054de,
+	0x00034bde, 0x00034ede, 0x000055de, 0x000356de, 0x00035ade, 0x000056de, 0x000361de, 0x000057de,
+	0x000369de, 0x00036cde, 0x000058de, 0x000374de, 0x000378de, 0x000059de, 0x00037fde, 0x000009de,
+	0x000387de, 0x00038bde, 0x00005bde, 0x000392de, 0x000396de, 0x00005cde, 0x00039dde, 0x00005dde,
+	0x0003a5de, 0x0003a9de, 0x00005ede, 0x0003b0de, 0x0003b4de, 0x00005fde, 0x0003bbde, 0x000060de,
+	0x0003c3de, 0x000061de, 0x000062de, 0x0003dade, 0x000063de, 0x000001df, 0x000065df, 0x0003f8df,
+	0x000066df, 0x000067df, 0x000068df, 0x000416df, 0x000069df, 0x00006adf, 0x00006bdf, 0x000434df,
+	0x00006cdf, 0x00006ddf, 0x00000bdf, 0x000452df, 0x00006fdf, 0x000070df, 0x000071df, 0x000470df,
+	0x000072df, 0x000073df, 0x000074df, 0x00048edf, 0x000075df, 0x000076df, 0x000077df, 0x0004acdf,
+	0x00000cdf, 0x000079df, 0x00007adf, 0x00007bdf, 0x0004d2df, 0x00007cdf, 0x00007ddf, 0x00007edf,
+	0x0004f0df, 0x00007fdf, 0x000080df, 0x000081df, 0x00050edf, 0x00000ddf, 0x000083df, 0x000084df,
+	0x00052cdf, 0x000085df, 0x000086df, 0x000087df, 0x00054adf, 0x000088df, 0x000089df, 0x00008adf,
+	0x000568df, 0x00008bdf, 0x00000edf, 0x00008ddf, 0x000586df, 0x00008edf, 0x00008fdf, 0x000090df,
+	0x0005a4df, 0x000091df, 0x000092df, 0x000093df, 0x0005c3df, 0x000094df, 0x000095df, 0x00000fdf,
+	0x0005e1df, 0x000097df, 0x000098df, 0x000099df, 0x0005ffdf, 0x00009adf, 0x00009bdf, 0x00009cdf,
+	0x00061ddf, 0x00009ddf, 0x00009edf, 0x00009fdf, 0x00063bdf, 0x000010df, 0x0000a1df, 0x0000a2df,
+	0x000659df, 0x0000a3df, 0x0000a4df, 0x0000a5df, 0x000677df, 0x0000a6df, 0x0000a7df, 0x0000a8df,
+	0x000695df, 0x0000a9df, 0x000011df, 0x0000abdf, 0x0006b3df, 0x0000acdf, 0x0000addf, 0x0000aedf,
+	0x0006d1df, 0x0000afdf, 0x0000b0df, 0x0000b1df, 0x0006efdf, 0x0000b2df, 0x0000b3df, 0x000012df,
+	0x00070edf, 0x0000b5df, 0x0000b6df, 0x0000b7df, 0x00072cdf, 0x0000b8df, 0x0000b9df, 0x0000badf,
+	0x00074adf, 0x0000bbdf, 0x0000bcdf, 0x0000bddf, 0x000768df, 0x000013df, 0x0000bfdf, 0x0000c0df,
+	0x0000c1df, 0x0000c2df, 0x0000c4df, 0x0000c5df, 0x0000c7df, 0x000002df, 0x0000cadf, 0x0000cbdf,
+	0x0000cddf, 0x0000cedf, 0x0000d0df, 0x0000d1df, 0x000015df, 0x0000d4df, 0x0000d6df, 0x0000d7df,
+	0x0000d9df, 0x0000dadf, 0x000016df, 0x0000dddf, 0x0000dfdf, 0x0000e0df, 0x0000e2df, 0x0000e3df,
+	0x0000e5df, 0x000017df, 0x0000e8df, 0x0000e9df, 0x0000ebdf, 0x0000ecdf, 0x0000eedf, 0x0000efdf,
+	0x000018df, 0x0000f2df, 0x0000f4df, 0x0000f5df, 0x0000f7df, 0x0000f8df, 0x000019df, 0x0000fbdf,
+	0x0000fddf, 0x0000fedf, 0x000100df, 0x000101df, 0x000103df, 0x00001adf, 0x000106df, 0x000107df,
+	0x000109df, 0x00010adf, 0x00010cdf, 0x00001bdf, 0x00010fdf, 0x000110df, 0x000112df, 0x000113df,
+	0x000115df, 0x000116df, 0x00001cdf, 0x000119df, 0x00011bdf, 0x00011cdf, 0x00011edf, 0x00011fdf,
+	0x000121df, 0x00001ddf, 0x000124df, 0x000125df, 0x000127df, 0x000128df, 0x00012adf, 0x000003df,
+	0x00012ddf, 0x00012edf, 0x000130df, 0x000131df, 0x000133df, 0x000134df, 0x00001fdf, 0x000137df,
+	0x000139df, 0x00013adf, 0x00013cdf, 0x00013ddf, 0x00013fdf, 0x000020df, 0x000142df, 0x000143df,
+	0x000145df, 0x000147df, 0x000148df, 0x000021df, 0x00014bdf, 0x00014ddf, 0x00014edf, 0x000150df,
+	0x000151df, 0x000153df, 0x000022df, 0x000156df, 0x000157df, 0x000159df, 0x00015adf, 0x00015cdf,
+	0x00015ddf, 0x000023df, 0x000160df, 0x000162df, 0x000163df, 0x000165df, 0x000166df, 0x000024df,
+	0x000169df, 0x00016bdf, 0x00016cdf, 0x00016edf, 0x00016fdf, 0x000171df, 0x000025df, 0x000174df,
+	0x000175df, 0x000177df, 0x000178df, 0x00017adf, 0x00017bdf, 0x000026df, 0x00017edf, 0x000180df,
+	0x000181df, 0x000184df, 0x000027df, 0x00018adf, 0x00018ddf, 0x000004df, 0x000193df, 0x000196df,
+	0x000029df, 0x00019cdf, 0x00019fdf, 0x0001a2df, 0x00002adf, 0x0001a8df, 0x0001abdf, 0x00002bdf,
+	0x0001b1df, 0x0001b4df, 0x00002cdf, 0x0001badf, 0x0001bddf, 0x0001c0df, 0x00002ddf, 0x0001c6df,
+	0x0001c9df, 0x00002edf, 0x0001cfdf, 0x0001d2df, 0x00002fdf, 0x0001d8df, 0x0001dbdf, 0x0001dedf,
+	0x000030df, 0x0001e4df, 0x0001e8df, 0x000031df, 0x0001eedf, 0x0001f1df, 0x000005df, 0x0001f7df,
+	0x0001fadf, 0x000033df, 0x000200df, 0x000203df, 0x000206df, 0x000034df, 0x00020cdf, 0x00020fdf,
+	0x000035df, 0x000215df, 0x000218df, 0x000036df, 0x00021edf, 0x000221df, 0x000224df, 0x000037df,
+	0x00022adf, 0x00022ddf, 0x000038df, 0x000233df, 0x000236df, 0x000039df, 0x00023cdf, 0x00023fdf,
+	0x000242df, 0x00003adf, 0x000248df, 0x00024bdf, 0x00003bdf, 0x000251df, 0x000254df, 0x000006df,
+	0x00025adf, 0x00025ddf, 0x000260df, 0x00003ddf, 0x000266df, 0x000269df, 0x00003edf, 0x00026fdf,
+	0x000272df, 0x00003fdf, 0x000278df, 0x00027bdf, 0x00027edf, 0x000040df, 0x000284df, 0x000287df,
+	0x000041df, 0x00028ddf, 0x000290df, 0x000042df, 0x000296df, 0x000299df, 0x00029cdf, 0x000043df,
+	0x0002a2df, 0x0002a5df, 0x000044df, 0x0002abdf, 0x0002aedf, 0x000045df, 0x0002b4df, 0x0002b7df,
+	0x0002badf, 0x000007df, 0x0002c0df, 0x0002c3df, 0x000047df, 0x0002c9df, 0x0002ccdf, 0x000048df,
+	0x0002d2df, 0x0002d5df, 0x0002d8df, 0x000049df, 0x0002dedf, 0x0002e1df, 0x00004adf, 0x0002e7df,
+	0x0002eadf, 0x00004bdf, 0x0002f0df, 0x0002f3df, 0x0002f6df, 0x00004cdf, 0x0002fcdf, 0x0002ffdf,
+	0x00004ddf, 0x000308df, 0x00004edf, 0x00004fdf, 0x00031adf, 0x000008df, 0x000326df, 0x000051df,
+	0x000052df, 0x000339df, 0x000053df, 0x000345df, 0x000054df, 0x000055df, 0x000357df, 0x000056df,
+	0x000363df, 0x000057df, 0x000058df, 0x000375df, 0x000059df, 0x000381df, 0x000009df, 0x00005bdf,
+	0x000393df, 0x00005cdf, 0x00039fdf, 0x00005ddf, 0x00005edf, 0x0003b1df, 0x00005fdf, 0x0003bddf,
+	0x000060df, 0x000061df, 0x0003cfdf, 0x000062df, 0x000063df, 0x0003e1df, 0x000001e0, 0x0003ede0,
+	0x000065e0, 0x000066e0, 0x0003ffe0, 0x000067e0, 0x00040be0, 0x000068e0, 0x000069e0, 0x00041de0,
+	0x00006ae0, 0x000429e0, 0x00006be0, 0x00006ce0, 0x00043be0, 0x00006de0, 0x000447e0, 0x00000be0,
+	0x00006fe0, 0x000459e0, 0x000070e0, 0x000465e0, 0x000071e0, 0x000072e0, 0x000478e0, 0x000073e0,
+	0x000484e0, 0x000074e0, 0x000075e0, 0x000496e0, 0x000076e0, 0x0004a2e0, 0x000077e0, 0x00000ce0,
+	0x0004b4e0, 0x000079e0, 0x0004c0e0, 0x00007ae0, 0x00007be0, 0x0004d2e0, 0x00007ce0, 0x0004dee0,
+	0x00007de0, 0x00007ee0, 0x0004f0e0, 0x00007fe0, 0x0004fce0, 0x000080e0, 0x000081e0, 0x00050ee0,
+	0x00000de0, 0x00051ae0, 0x000083e0, 0x000084e0, 0x00052ce0, 0x000085e0, 0x000538e0, 0x000086e0,
+	0x000087e0, 0x00054ae0, 0x000088e0, 0x000556e0, 0x000089e0, 0x00008ae0, 0x000568e0, 0x00008be0,
+	0x000574e0, 0x00000ee0, 0x00008de0, 0x000586e0, 0x00008ee0, 0x000592e0, 0x00008fe0, 0x000090e0,
+	0x0005a4e0, 0x000091e0, 0x0005b0e0, 0x000092e0, 0x000093e0, 0x0005c3e0, 0x000094e0, 0x0005cfe0,
+	0x000095e0, 0x00000fe0, 0x0005e1e0, 0x000097e0, 0x0005ede0, 0x000098e0, 0x000099e0, 0x0005ffe0,
+	0x00009ae0, 0x00009be0, 0x00009ce0, 0x00009ee0, 0x00009fe0, 0x000010e0, 0x0000a1e0, 0x0000a3e0,
+	0x0000a4e0, 0x0000a5e0, 0x0000a6e0, 0x0000a7e0, 0x0000a9e0, 0x000011e0, 0x0000abe0, 0x0000ace0,
+	0x0000ade0, 0x0000afe0, 0x0000b0e0, 0x0000b1e0, 0x0000b2e0, 0x0000b3e0, 0x000012e0, 0x0000b6e0,
+	0x0000b7e0, 0x0000b8e0, 0x0000b9e0, 0x0000bbe0, 0x0000bce0, 0x0000bde0, 0x000013e0, 0x0000bfe0,
+	0x0000c1e0, 0x0000c2e0, 0x0000c3e0, 0x0000c4e0, 0x0000c5e0, 0x0000c7e0, 0x000002e0, 0x0000c9e0,
+	0x0000cae0, 0x0000cbe0, 0x0000cde0, 0x0000cee0, 0x0000cfe0, 0x0000d0e0, 0x000015e0, 0x0000d3e0,
+	0x0000d4e0, 0x0000d5e0, 0x0000d6e0, 0x0000d7e0, 0x0000d9e0, 0x0000dae0, 0x0000dbe0, 0x000016e0,
+	0x0000dde0, 0x0000dfe0, 0x0000e0e0, 0x0000e1e0, 0x0000e2e0, 0x0000e4e0, 0x0000e5e0, 0x000017e0,
+	0x0000e7e0, 0x0000e8e0, 0x0000eae0, 0x0000ebe0, 0x0000ece0, 0x0000ede0, 0x0000eee0, 0x000018e0,
+	0x0000f1e0, 0x0000f2e0, 0x0000f3e0, 0x0000f4e0, 0x0000f6e0, 0x0000f7e0, 0x0000f8e0, 0x0000f9e0,
+	0x000019e0, 0x0000fce0, 0x0000fde0, 0x0000fee0, 0x0000ffe0, 0x000100e0, 0x000102e0, 0x000103e0,
+	0x00001ae0, 0x000105e0, 0x000106e0, 0x000108e0, 0x000109e0, 0x00010ae0, 0x00010be0, 0x00010ce0,
+	0x00001be0, 0x00010fe0, 0x000110e0, 0x000111e0, 0x000112e0, 0x000114e0, 0x000115e0, 0x000116e0,
+	0x000117e0, 0x00001ce0, 0x00011ae0, 0x00011be0, 0x00011ce0, 0x00011de0, 0x00011ee0, 0x000120e0,
+	0x000121e0, 0x00001de0, 0x000123e0, 0x000125e0, 0x000126e0, 0x000127e0, 0x000128e0, 0x000129e0,
+	0x00012be0, 0x000003e0, 0x00012de0, 0x00012ee0, 0x00012fe0, 0x000131e0, 0x000132e0, 0x000133e0,
+	0x000134e0, 0x00001fe0, 0x000139e0, 0x00013be0, 0x00013ee0, 0x000020e0, 0x000143e0, 0x000145e0,
+	0x000147e0, 0x000021e0, 0x00014ce0, 0x00014fe0, 0x000151e0, 0x000022e0, 0x000156e0, 0x000158e0,
+	0x00015be0, 0x000023e0, 0x00015fe0, 0x000162e0, 0x000164e0, 0x000167e0, 0x000024e0, 0x00016ce0,
+	0x00016ee0, 0x000170e0, 0x000025e0, 0x000175e0, 0x000178e0, 0x00017ae0, 0x000026e0, 0x00017fe0,
+	0x000181e0, 0x000184e0, 0x000027e0, 0x000188e0, 0x00018be0, 0x00018de0, 0x000004e0, 0x000192e0,
+	0x000194e0, 0x000197e0, 0x000029e0, 0x00019ce0, 0x00019ee0, 0x0001a0e0, 0x00002ae0, 0x0001a5e0,
+	0x0001a8e0, 0x0001aae0, 0x0001ade0, 0x00002be0, 0x0001b1e0, 0x0001b4e0, 0x0001b6e0, 0x00002ce0,
+	0x0001bbe0, 0x0001bde0, 0x0001c0e0, 0x00002de0, 0x0001c5e0, 0x0001c7e0, 0x0001c9e0, 0x00002ee0,
+	0x0001cee0, 0x0001d1e0, 0x0001d3e0, 0x00002fe0, 0x0001d8e0, 0x0001dae0, 0x0001dde0, 0x000030e0,
+	0x0001e1e0, 0x0001e4e0, 0x0001e6e0, 0x0001e9e0, 0x000031e0, 0x0001eee0, 0x0001f0e0, 0x0001f2e0,
+	0x000005e0, 0x0001f7e0, 0x0001fae0, 0x0001fce0, 0x000033e0, 0x000201e0, 0x000203e0, 0x000206e0,
+	0x000034e0, 0x00020ae0, 0x00020de0, 0x00020fe0, 0x000035e0, 0x000214e0, 0x000216e0, 0x000219e0,
+	0x000036e0, 0x00021ee0, 0x000220e0, 0x000222e0, 0x000037e0, 0x000227e0, 0x00022ae0, 0x00022ce0,
+	0x00022fe0, 0x000038e0, 0x000233e0, 0x000236e0, 0x000238e0, 0x000039e0, 0x00023de0, 0x00023fe0,
+	0x000242e0, 0x00003ae0, 0x000247e0, 0x000249e0, 0x00024be0, 0x00003be0, 0x000250e0, 0x000253e0,
+	0x000255e0, 0x000006e0, 0x00025ae0, 0x00025ce0, 0x00025fe0, 0x00003de0, 0x000263e0, 0x000266e0,
+	0x000268e0, 0x00003ee0, 0x000272e0, 0x00003fe0, 0x00027ce0, 0x000040e0, 0x000285e0, 0x000041e0,
+	0x00028fe0, 0x000042e0, 0x000298e0, 0x000043e0, 0x0002a2e0, 0x000044e0, 0x0002ace0, 0x000045e0,
+	0x0002b5e0, 0x000007e0, 0x0002bfe0, 0x000047e0, 0x0002c9e0, 0x0002cde0, 0x000048e0, 0x0002d7e0,
+	0x000049e0, 0x0002e1e0, 0x00004ae0, 0x0002eae0, 0x00004be0, 0x0002f4e0, 0x00004ce0, 0x0002fee0,
+	0x00004de0, 0x000307e0, 0x00004ee0, 0x000311e0, 0x00004fe0, 0x00031ae0, 0x000008e0, 0x000324e0,
+	0x000051e0, 0x00032ee0, 0x000052e0, 0x000337e0, 0x000053e0, 0x000341e0, 0x000054e0, 0x00034be0,
+	0x00034fe0, 0x000055e0, 0x000359e0, 0x000056e0, 0x000363e0, 0x000057e0, 0x00036ce0, 0x000058e0,
+	0x000376e0, 0x000059e0, 0x000380e0, 0x000009e0, 0x000389e0, 0x00005be0, 0x000393e0, 0x00005ce0,
+	0x00039ce0, 0x00005de0, 0x0003a6e0, 0x00005ee0, 0x0003b0e0, 0x00005fe0, 0x0003b9e0, 0x000060e0,
+	0x0003c3e0, 0x000061e0, 0x0003cde0, 0x0003d1e0, 0x000062e0, 0x0003dbe0, 0x000063e0, 0x0003e5e0,
+	0x000001e1, 0x0003eee1, 0x000065e1, 0x0003f8e1, 0x000066e1, 0x000402e1, 0x000067e1, 0x00040be1,
+	0x000068e1, 0x000415e1, 0x000069e1, 0x00041ee1, 0x00006ae1, 0x000428e1, 0x00006be1, 0x000432e1,
+	0x00006ce1, 0x00043be1, 0x00006de1, 0x000445e1, 0x00000be1, 0x00044fe1, 0x000453e1, 0x00006fe1,
+	0x00045de1, 0x000070e1, 0x000467e1, 0x000071e1, 0x000470e1, 0x000072e1, 0x00047ae1, 0x000073e1,
+	0x000484e1, 0x000074e1, 0x00048de1, 0x000075e1, 0x000497e1, 0x000076e1, 0x0004a0e1, 0x000077e1,
+	0x0004aae1, 0x00000ce1, 0x0004b4e1, 0x000079e1, 0x0004bde1, 0x00007ae1, 0x0004c7e1, 0x00007be1,
+	0x0004d1e1, 0x00007ce1, 0x00007de1, 0x00007ee1, 0x00007fe1, 0x000080e1, 0x000081e1, 0x00000de1,
+	0x000083e1, 0x000084e1, 0x000085e1, 0x000086e1, 0x000087e1, 0x000088e1, 0x000089e1, 0x00008ae1,
+	0x00008be1, 0x00000ee1, 0x00008de1, 0x00008ee1, 0x00008fe1, 0x00059be1, 0x000090e1, 0x000091e1,
+	0x000092e1, 0x000093e1, 0x000094e1, 0x000095e1, 0x00000fe1, 0x000097e1, 0x000098e1, 0x000099e1,
+	0x00009ae1, 0x00009be1, 0x00009ce1, 0x00009de1, 0x00009ee1, 0x00009fe1, 0x000010e1, 0x0000a1e1,
+	0x0000a2e1, 0x0000a3e1, 0x0000a4e1, 0x0000a5e1, 0x0000a6e1, 0x0000a7e1, 0x0000a8e1, 0x0000a9e1,
+	0x00069fe1, 0x000011e1, 0x0000abe1, 0x0000ace1, 0x0000ade1, 0x0000aee1, 0x0000afe1, 0x0000b0e1,
+	0x0000b1e1, 0x0000b2e1, 0x0000b3e1, 0x000012e1, 0x0000b5e1, 0x0000b6e1, 0x0000b7e1, 0x0000b8e1,
+	0x0000b9e1, 0x0000bae1, 0x0000bbe1, 0x0000bce1, 0x0000bde1, 0x000013e1, 0x0000bfe1, 0x0000c0e1,
+	0x0000c1e1, 0x0000c2e1, 0x0000c3e1, 0x0007a3e1, 0x0000c4e1, 0x0000c5e1, 0x0000c6e1, 0x0000c7e1,
+	0x000002e1, 0x0000c9e1, 0x0000cae1, 0x0000cbe1, 0x0000cce1, 0x0000cde1, 0x0000cee1, 0x0000cfe1,
+	0x0000d0e1, 0x0000d1e1, 0x000015e1, 0x0000d3e1, 0x0000d4e1, 0x0000d5e1, 0x0000d6e1, 0x0000d7e1,
+	0x0000d8e1, 0x0000d9e1, 0x0000dae1, 0x0000dbe1, 0x000016e1, 0x0000dde1, 0x0008a7e1, 0x0000dee1,
+	0x0000dfe1, 0x0000e0e1, 0x0000e1e1, 0x0000e2e1, 0x0000e3e1, 0x0000e4e1, 0x0000e5e1, 0x000017e1,
+	0x0000e7e1, 0x0000e8e1, 0x0000e9e1, 0x0000eae1, 0x0000ebe1, 0x0000ece1, 0x0000ede1, 0x0000eee1,
+	0x0000efe1, 0x000018e1, 0x0000f1e1, 0x0000f2e1, 0x0000f3e1, 0x0000f4e1, 0x0000f5e1, 0x0000f6e1,
+	0x0000f7e1, 0x0000f8e1, 0x000019e1, 0x0000fce1, 0x0000fee1, 0x000100e1, 0x000102e1, 0x00001ae1,
+	0x000106e1, 0x000108e1, 0x00010ae1, 0x00010ce1, 0x00001be1, 0x000110e1, 0x000111e1, 0x000113e1,
+	0x000115e1, 0x00001ce1, 0x000119e1, 0x00011be1, 0x00011de1, 0x00011fe1, 0x000121e1, 0x00001de1,
+	0x000125e1, 0x000127e1, 0x000129e1, 0x00012be1, 0x000003e1, 0x00012ee1, 0x000130e1, 0x000132e1,
+	0x000134e1, 0x00001fe1, 0x000138e1, 0x00013ae1, 0x00013ce1, 0x00013ee1, 0x000020e1, 0x000142e1,
+	0x000144e1, 0x000145e1, 0x000147e1, 0x000021e1, 0x00014be1, 0x00014de1, 0x00014fe1, 0x000151e1,
+	0x000153e1, 0x000022e1, 0x000157e1, 0x000159e1, 0x00015be1, 0x00015de1, 0x000023e1, 0x000160e1,
+	0x000162e1, 0x000164e1, 0x000166e1, 0x000024e1, 0x00016ae1, 0x00016ce1, 0x00016ee1, 0x000170e1,
+	0x000025e1, 0x000174e1, 0x000176e1, 0x000178e1, 0x000179e1, 0x000026e1, 0x00017de1, 0x00017fe1,
+	0x000181e1, 0x000183e1, 0x000027e1, 0x000187e1, 0x000189e1, 0x00018be1, 0x00018de1, 0x00018fe1,
+	0x000004e1, 0x000193e1, 0x000194e1, 0x000196e1, 0x000198e1, 0x000029e1, 0x00019ce1, 0x00019ee1,
+	0x0001a0e1, 0x0001a2e1, 0x00002ae1, 0x0001a6e1, 0x0001a8e1, 0x0001aae1, 0x0001ace1, 0x00002be1,
+	0x0001afe1, 0x0001b1e1, 0x0001b3e1, 0x0001b5e1, 0x00002ce1, 0x0001b9e1, 0x0001bbe1, 0x0001bde1,
+	0x0001bfe1, 0x0001c1e1, 0x00002de1, 0x0001c5e1, 0x0001c7e1, 0x0001c8e1, 0x0001cae1, 0x00002ee1,
+	0x0001cee1, 0x0001d0e1, 0x0001d2e1, 0x0001d4e1, 0x00002fe1, 0x0001d8e1, 0x0001dae1, 0x0001dce1,
+	0x0001dee1, 0x000030e1, 0x0001e1e1, 0x0001e3e1, 0x0001e5e1, 0x0001e7e1, 0x000031e1, 0x0001ebe1,
+	0x0001ede1, 0x0001f1e1, 0x000005e1, 0x0001f9e1, 0x000033e1, 0x000200e1, 0x000204e1, 0x000034e1,
+	0x00020ce1, 0x000210e1, 0x000035e1, 0x000217e1, 0x000036e1, 0x00021fe1, 0x000223e1, 0x000037e1,
+	0x00022be1, 0x000038e1, 0x000232e1, 0x000236e1, 0x000039e1, 0x00023ee1, 0x000242e1, 0x00003ae1,
+	0x000249e1, 0x00003be1, 0x000251e1, 0x000255e1, 0x000006e1, 0x00025de1, 0x00003de1, 0x000264e1,
+	0x000268e1, 0x00003ee1, 0x000270e1, 0x000274e1, 0x00003fe1, 0x00027ce1, 0x000040e1, 0x000283e1,
+	0x000287e1, 0x000041e1, 0x00028fe1, 0x000042e1, 0x000297e1, 0x00029ae1, 0x000043e1, 0x0002a2e1,
+	0x0002a6e1, 0x000044e1, 0x0002aee1, 0x000045e1, 0x0002b5e1, 0x0002b9e1, 0x000007e1, 0x0002c1e1,
+	0x000047e1, 0x0002c9e1, 0x0002cce1, 0x000048e1, 0x0002d4e1, 0x0002d8e1, 0x000049e1, 0x0002e0e1,
+	0x00004ae1, 0x0002e7e1, 0x0002ebe1, 0x00004be1, 0x0002f3e1, 0x00004ce1, 0x0002fbe1, 0x0002ffe1,
+	0x00004de1, 0x000306e1, 0x00004ee1, 0x00030ee1, 0x000312e1, 0x00004fe1, 0x000319e1, 0x00031de1,
+	0x000008e1, 0x000325e1, 0x000051e1, 0x00032de1, 0x000331e1, 0x000052e1, 0x000338e1, 0x000053e1,
+	0x000340e1, 0x000344e1, 0x000054e1, 0x00034ce1, 0x00034fe1, 0x000055e1, 0x000357e1, 0x000056e1,
+	0x00035fe1, 0x000363e1, 0x000057e1, 0x00036ae1, 0x000058e1, 0x000372e1, 0x000376e1, 0x000059e1,
+	0x00037ee1, 0x000381e1, 0x000009e1, 0x000389e1, 0x00005be1, 0x000391e1, 0x000395e1, 0x00005ce1,
+	0x00039ce1, 0x00005de1, 0x0003a4e1, 0x0003a8e1, 0x00005ee1, 0x0003b0e1, 0x0003b4e1, 0x00005fe1,
+	0x0003bbe1, 0x000060e1, 0x0003c3e1, 0x0003c7e1, 0x000061e1, 0x0003cfe1, 0x000062e1, 0x0003d6e1,
+	0x0003dae1, 0x000063e1, 0x000001e2, 0x000065e2, 0x000066e2, 0x000401e2, 0x000067e2, 0x000068e2,
+	0x000069e2, 0x00041fe2, 0x00006ae2, 0x00006be2, 0x00006ce2, 0x00006de2, 0x000446e2, 0x00000be2,
+	0x00006fe2, 0x000070e2, 0x000465e2, 0x000071e2, 0x000072e2, 0x000073e2, 0x000484e2, 0x000074e2,
+	0x000075e2, 0x000076e2, 0x000077e2, 0x0004aae2, 0x00000ce2, 0x000079e2, 0x00007ae2, 0x0004c9e2,
+	0x00007be2, 0x00007ce2, 0x00007de2, 0x0004e8e2, 0x00007ee2, 0x00007fe2, 0x000080e2, 0x000081e2,
+	0x00050ee2, 0x00000de2, 0x000083e2, 0x000084e2, 0x00052de2, 0x000085e2, 0x000086e2, 0x000087e2,
+	0x00054ce2, 0x000088e2, 0x000089e2, 0x00008ae2, 0x00008be2, 0x000572e2, 0x00000ee2, 0x00008de2,
+	0x00008ee2, 0x000591e2, 0x00008fe2, 0x000090e2, 0x000091e2, 0x0005b0e2, 0x000092e2, 0x000093e2,
+	0x000094e2, 0x000095e2, 0x0005d7e2, 0x00000fe2, 0x000097e2, 0x000098e2, 0x0005f5e2, 0x000099e2,
+	0x00009ae2, 0x00009be2, 0x00009ce2, 0x00061ce2, 0x00009de2, 0x00009ee2, 0x00009fe2, 0x00063be2,
+	0x000010e2, 0x0000a1e2, 0x0000a2e2, 0x000659e2, 0x0000a3e2, 0x0000a4e2, 0x0000a5e2, 0x0000a6e2,
+	0x000680e2, 0x0000a7e2, 0x0000a8e2, 0x0000a9e2, 0x00069fe2, 0x000011e2, 0x0000abe2, 0x0000ace2,
+	0x0006bee2, 0x0000ade2, 0x0000aee2, 0x0000afe2, 0x0000b0e2, 0x0006e4e2, 0x0000b1e2, 0x0000b2e2,
+	0x0000b3e2, 0x000703e2, 0x000012e2, 0x0000b5e2, 0x0000b6e2, 0x000722e2, 0x0000b7e2, 0x0000b8e2,
+	0x0000b9e2, 0x0000bae2, 0x000748e2, 0x0000bbe2, 0x0000bce2, 0x0000bde2, 0x000767e2, 0x000013e2,
+	0x0000bfe2, 0x0000c0e2, 0x000786e2, 0x0000c1e2, 0x0000c2e2, 0x0000c3e2, 0x0000c4e2, 0x0007ace2,
+	0x0000c5e2, 0x0000c7e2, 0x000002e2, 0x0000cae2, 0x0000cbe2, 0x0000cde2, 0x0000cee2, 0x0000d0e2,
+	0x000015e2, 0x0000d3e2, 0x0000d5e2, 0x0000d6e2, 0x0000d8e2, 0x0000d9e2, 0x0000dbe2, 0x000016e2,
+	0x0000dee2, 0x0000dfe2, 0x0000e1e2, 0x0000e2e2, 0x0000e4e2, 0x000017e2, 0x0000e7e2, 0x0000e9e2,
+	0x0000eae2, 0x0000ece2, 0x0000ede2, 0x0000efe2, 0x000018e2, 0x0000f2e2, 0x0000f3e2, 0x0000f5e2,
+	0x0000f7e2, 0x0000f8e2, 0x000019e2, 0x0000fbe2, 0x0000fde2, 0x0000fee2, 0x000100e2, 0x000101e2,
+	0x000103e2, 0x00001ae2, 0x000106e2, 0x000107e2, 0x000109e2, 0x00010be2, 0x00010ce2, 0x00001be2,
+	0x00010fe2, 0x000111e2, 0x000112e2, 0x000114e2, 0x000115e2, 0x000117e2, 0x00001ce2, 0x00011ae2,
+	0x00011be2, 0x00011de2, 0x00011fe2, 0x000120e2, 0x00001de2, 0x000123e2, 0x000125e2, 0x000126e2,
+	0x000128e2, 0x000129e2, 0x00012be2, 0x000003e2, 0x00012ee2, 0x000130e2, 0x000131e2, 0x000133e2,
+	0x000134e2, 0x00001fe2, 0x000137e2, 0x000139e2, 0x00013ae2, 0x00013ce2, 0x00013de2, 0x00013fe2,
+	0x000020e2, 0x000142e2, 0x000144e2, 0x000145e2, 0x000147e2, 0x000148e2, 0x000021e2, 0x00014be2,
+	0x00014de2, 0x00014ee2, 0x000150e2, 0x000151e2, 0x000153e2, 0x000022e2, 0x000156e2, 0x000158e2,
+	0x000159e2, 0x00015be2, 0x00015ce2, 0x000023e2, 0x00015fe2, 0x000161e2, 0x000162e2, 0x000164e2,
+	0x000165e2, 0x000167e2, 0x000024e2, 0x00016ae2, 0x00016ce2, 0x00016de2, 0x00016fe2, 0x000170e2,
+	0x000025e2, 0x000173e2, 0x000175e2, 0x000176e2, 0x000178e2, 0x000179e2, 0x00017be2, 0x000026e2,
+	0x00017ee2, 0x000180e2, 0x000181e2, 0x000183e2, 0x000184e2, 0x000027e2, 0x000187e2, 0x000189e2,
+	0x00018ae2, 0x00018ee2, 0x000004e2, 0x000194e2, 0x000197e2, 0x000029e2, 0x00019de2, 0x0001a0e2,
+	0x00002ae2, 0x0001a6e2, 0x0001a9e2, 0x0001ace2, 0x00002be2, 0x0001b2e2, 0x0001b6e2, 0x00002ce2,
+	0x0001bce2, 0x0001bfe2, 0x00002de2, 0x0001c5e2, 0x0001c8e2, 0x00002ee2, 0x0001cee2, 0x0001d1e2,
+	0x0001d4e2, 0x00002fe2, 0x0001dbe2, 0x0001dee2, 0x000030e2, 0x0001e4e2, 0x0001e7e2, 0x000031e2,
+	0x0001ede2, 0x0001f0e2, 0x000005e2, 0x0001f6e2, 0x0001f9e2, 0x0001fce2, 0x000033e2, 0x000203e2,
+	0x000206e2, 0x000034e2, 0x00020ce2, 0x00020fe2, 0x000035e2, 0x000215e2, 0x000218e2, 0x000036e2,
+	0x00021ee2, 0x000221e2, 0x000037e2, 0x000228e2, 0x00022be2, 0x00022ee2, 0x000038e2, 0x000234e2,
+	0x000237e2, 0x000039e2, 0x00023de2, 0x000240e2, 0x00003ae2, 0x000246e2, 0x000249e2, 0x00003be2,
+	0x000250e2, 0x000253e2, 0x000256e2, 0x000006e2, 0x00025ce2, 0x00025fe2, 0x00003de2, 0x000265e2,
+	0x000268e2, 0x00003ee2, 0x00026ee2, 0x000272e2, 0x00003fe2, 0x000278e2, 0x00027be2, 0x00027ee2,
+	0x000040e2, 0x000284e2, 0x000287e2, 0x000041e2, 0x00028de2, 0x000290e2, 0x000042e2, 0x000297e2,
+	0x00029ae2, 0x000043e2, 0x0002a0e2, 0x0002a3e2, 0x0002a6e2, 0x000044e2, 0x0002ace2, 0x0002afe2,
+	0x000045e2, 0x0002b5e2, 0x0002b8e2, 0x000007e2, 0x0002bfe2, 0x0002c2e2, 0x000047e2, 0x0002c8e2,
+	0x0002cbe2, 0x0002cee2, 0x000048e2, 0x0002d4e2, 0x0002d7e2, 0x000049e2, 0x0002dde2, 0x0002e0e2,
+	0x00004ae2, 0x0002e7e2, 0x0002eae2, 0x00004be2, 0x0002f0e2, 0x0002f3e2, 0x0002f6e2, 0x00004ce2,
+	0x0002fce2, 0x0002ffe2, 0x00004de2, 0x000305e2, 0x000309e2, 0x00004ee2, 0x00030fe2, 0x000312e2,
+	0x00004fe2, 0x00031be2, 0x000008e2, 0x000051e2, 0x00032ee2, 0x000052e2, 0x00033ae2, 0x000053e2,
+	0x000054e2, 0x00034ce2, 0x000055e2, 0x000359e2, 0x000056e2, 0x000057e2, 0x00036be2, 0x000058e2,
+	0x000059e2, 0x00037ee2, 0x000009e2, 0x00038ae2, 0x00005be2, 0x00005ce2, 0x00039ce2, 0x00005de2,
+	0x0003a9e2, 0x00005ee2, 0x00005fe2, 0x0003bbe2, 0x000060e2, 0x000061e2, 0x0003cee2, 0x000062e2,
+	0x0003dae2, 0x000063e2, 0x000001e3, 0x0003ede3, 0x000065e3, 0x0003f9e3, 0x000066e3, 0x000067e3,
+	0x00040be3, 0x000068e3, 0x000069e3, 0x00041ee3, 0x00006ae3, 0x00042ae3, 0x00006be3, 0x00006ce3,
+	0x00043de3, 0x00006de3, 0x00000be3, 0x00044fe3, 0x00006fe3, 0x00045be3, 0x000070e3, 0x000071e3,
+	0x00046ee3, 0x000072e3, 0x00047ae3, 0x000073e3, 0x000074e3, 0x00048de3, 0x000075e3, 0x000076e3,
+	0x00049fe3, 0x000077e3, 0x0004ace3, 0x00000ce3, 0x000079e3, 0x0004bee3, 0x00007ae3, 0x0004cae3,
+	0x00007be3, 0x00007ce3, 0x0004dde3, 0x00007de3, 0x00007ee3, 0x0004efe3, 0x00007fe3, 0x0004fce3,
+	0x000080e3, 0x000081e3, 0x00050ee3, 0x00000de3, 0x00051be3, 0x000083e3, 0x000084e3, 0x00052de3,
+	0x000085e3, 0x000086e3, 0x000540e3, 0x000087e3, 0x00054ce3, 0x000088e3, 0x000089e3, 0x00055ee3,
+	0x00008ae3, 0x00056be3, 0x00008be3, 0x00000ee3, 0x00057de3, 0x00008de3, 0x00008ee3, 0x000590e3,
+	0x00008fe3, 0x00059ce3, 0x000090e3, 0x000091e3, 0x0005aee3, 0x000092e3, 0x0005bbe3, 0x000093e3,
+	0x000094e3, 0x0005cde3, 0x000095e3, 0x00000fe3, 0x0005e0e3, 0x000097e3, 0x0005ece3, 0x000098e3,
+	0x000099e3, 0x0005ffe3, 0x00009ae3, 0x00060be3, 0x00009be3, 0x00009ce3, 0x00061de3, 0x00009de3,
+	0x00009ee3, 0x00009fe3, 0x000010e3, 0x0000a1e3, 0x0000a3e3, 0x0000a4e3, 0x0000a5e3, 0x0000a6e3,
+	0x0000a8e3, 0x0000a9e3, 0x000011e3, 0x0000abe3, 0x0000ade3, 0x0000aee3, 0x0000afe3, 0x0000b0e3,
+	0x0000b1e3, 0x0000b3e3, 0x000012e3, 0x0000b5e3, 0x0000b6e3, 0x0000b8e3, 0x0000b9e3, 0x0000bae3,
+	0x0000bbe3, 0x0000bde3, 0x000013e3, 0x0000bfe3, 0x0000c0e3, 0x0000c2e3, 0x0000c3e3, 0x0000c4e3,
+	0x0000c5e3, 0x0000c6e3, 0x000002e3, 0x0000c9e3, 0x0000cae3, 0x0000cbe3, 0x0000cde3, 0x0000cee3,
+	0x0000cfe3, 0x0000d0e3, 0x000015e3, 0x0000d3e3, 0x0000d4e3, 0x0000d5e3, 0x0000d6e3, 0x0000d8e3,
+	0x0000d9e3, 0x0000dae3, 0x000016e3, 0x0000dde3, 0x0000dee3, 0x0000dfe3, 0x0000e0e3, 0x0000e2e3,
+	0x0000e3e3, 0x0000e4e3, 0x0000e5e3, 0x000017e3, 0x0000e8e3, 0x0000e9e3, 0x0000eae3, 0x0000ebe3,
+	0x0000ede3, 0x0000eee3, 0x0000efe3, 0x000018e3, 0x0000f2e3, 0x0000f3e3, 0x0000f4e3, 0x0000f5e3,
+	0x0000f7e3, 0x0000f8e3, 0x0000f9e3, 0x000019e3, 0x0000fbe3, 0x0000fde3, 0x0000fee3, 0x0000ffe3,
+	0x000100e3, 0x000102e3, 0x000103e3, 0x00001ae3, 0x000105e3, 0x000107e3, 0x000108e3, 0x000109e3,
+	0x00010ae3, 0x00010be3, 0x00010de3, 0x00001be3, 0x00010fe3, 0x000110e3, 0x000112e3, 0x000113e3,
+	0x000114e3, 0x000115e3, 0x000117e3, 0x00001ce3, 0x000119e3, 0x00011ae3, 0x00011be3, 0x00011de3,
+	0x00011ee3, 0x00011fe3, 0x000120e3, 0x00001de3, 0x000123e3, 0x000124e3, 0x000125e3, 0x000127e3,
+	0x000128e3, 0x000129e3, 0x00012ae3, 0x000003e3, 0x00012de3, 0x00012ee3, 0x00012fe3, 0x000130e3,
+	0x000132e3, 0x000133e3, 0x000134e3, 0x000135e3, 0x00001fe3, 0x000138e3, 0x000139e3, 0x00013ae3,
+	0x00013ce3, 0x00013ee3, 0x000020e3, 0x000143e3, 0x000145e3, 0x000148e3, 0x000021e3, 0x00014de3,
+	0x00014fe3, 0x000152e3, 0x000022e3, 0x000157e3, 0x000159e3, 0x00015ce3, 0x000023e3, 0x000161e3,
+	0x000163e3, 0x000165e3, 0x000024e3, 0x00016ae3, 0x00016de3, 0x00016fe3, 0x000025e3, 0x000174e3,
+	0x000177e3, 0x000179e3, 0x000026e3, 0x00017ee3, 0x000181e3, 0x000183e3, 0x000027e3, 0x000188e3,
+	0x00018ae3, 0x00018de3, 0x000004e3, 0x000192e3, 0x000194e3, 0x000197e3, 0x000029e3, 0x00019ce3,
+	0x00019ee3, 0x0001a1e3, 0x00002ae3, 0x0001a6e3, 0x0001a8e3, 0x0001aae3, 0x00002be3, 0x0001afe3,
+	0x0001b2e3, 0x0001b4e3, 0x00002ce3, 0x0001b9e3, 0x0001bce3, 0x0001bee3, 0x0001c1e3, 0x00002de3,
+	0x0001c6e3, 0x0001c8e3, 0x0001cbe3, 0x00002ee3, 0x0001cfe3, 0x0001d2e3, 0x0001d4e3, 0x00002fe3,
+	0x0001d9e3, 0x0001dce3, 0x0001dee3, 0x000030e3, 0x0001e3e3, 0x0001e6e3, 0x0001e8e3, 0x000031e3,
+	0x0001ede3, 0x0001f0e3, 0x0001f2e3, 0x000005e3, 0x0001f7e3, 0x0001f9e3, 0x0001fce3, 0x000033e3,
+	0x000201e3, 0x000203e3, 0x000206e3, 0x000034e3, 0x00020be3, 0x00020de3, 0x000210e3, 0x000035e3,
+	0x000214e3, 0x000217e3, 0x000219e3, 0x000036e3, 0x00021ee3, 0x000221e3, 0x000223e3, 0x000037e3,
+	0x000228e3, 0x00022be3, 0x00022de3, 0x000038e3, 0x000232e3, 0x000235e3, 0x000237e3, 0x000039e3,
+	0x00023ce3, 0x00023ee3, 0x000241e3, 0x00003ae3, 0x000246e3, 0x000248e3, 0x00024be3, 0x00003be3,
+	0x000250e3, 0x000252e3, 0x000255e3, 0x000006e3, 0x00025ae3, 0x00025ce3, 0x00025ee3, 0x00003de3,
+	0x000263e3, 0x000266e3, 0x000268e3, 0x00026be3, 0x00003ee3, 0x000270e3, 0x000272e3, 0x000275e3,
+	0x00003fe3, 0x00027ce3, 0x000040e3, 0x000286e3, 0x000041e3, 0x000290e3, 0x000042e3, 0x00029ae3,
+	0x000043e3, 0x0002a3e3, 0x000044e3, 0x0002ade3, 0x000045e3, 0x0002b7e3, 0x000007e3, 0x0002c1e3,
+	0x000047e3, 0x0002cbe3, 0x000048e3, 0x0002d5e3, 0x000049e3, 0x0002dfe3, 0x00004ae3, 0x0002e8e3,
+	0x00004be3, 0x0002f2e3, 0x00004ce3, 0x0002fce3, 0x00004de3, 0x000306e3, 0x00004ee3, 0x000310e3,
+	0x00004fe3, 0x00031ae3, 0x000008e3, 0x000324e3, 0x000051e3, 0x00032ee3, 0x000052e3, 0x000337e3,
+	0x000053e3, 0x000341e3, 0x000054e3, 0x00034be3, 0x000055e3, 0x000355e3, 0x000056e3, 0x00035fe3,
+	0x000057e3, 0x000369e3, 0x000058e3, 0x000373e3, 0x000377e3, 0x000059e3, 0x000381e3, 0x000009e3,
+	0x00038be3, 0x00005be3, 0x000395e3, 0x00005ce3, 0x00039fe3, 0x00005de3, 0x0003a9e3, 0x00005ee3,
+	0x0003b3e3, 0x00005fe3, 0x0003bce3, 0x000060e3, 0x0003c6e3, 0x000061e3, 0x0003d0e3, 0x000062e3,
+	0x0003dae3, 0x000063e3, 0x0003e4e3, 0x000001e4, 0x0003eee4, 0x000065e4, 0x0003f8e4, 0x000066e4,
+	0x000402e4, 0x000067e4, 0x00040be4, 0x000068e4, 0x000415e4, 0x000069e4, 0x00041fe4, 0x00006ae4,
+	0x000429e4, 0x00006be4, 0x000433e4, 0x00006ce4, 0x00043de4, 0x00006de4, 0x000447e4, 0x00000be4,
+	0x000450e4, 0x00006fe4, 0x00045ae4, 0x000070e4, 0x000464e4, 0x000071e4, 0x00046ee4, 0x000072e4,
+	0x000478e4, 0x000073e4, 0x000482e4, 0x000074e4, 0x00048ce4, 0x000075e4, 0x000495e4, 0x000076e4,
+	0x00049fe4, 0x000077e4, 0x0004a9e4, 0x00000ce4, 0x0004b3e4, 0x000079e4, 0x0004bde4, 0x00007ae4,
+	0x0004c7e4, 0x00007be4, 0x0004d1e4, 0x0004d6e4, 0x00007ce4, 0x0004dfe4, 0x00007de4, 0x0004e9e4,
+	0x00007ee4, 0x00007fe4, 0x000080e4, 0x000081e4, 0x00000de4, 0x000083e4, 0x000084e4, 0x000085e4,
+	0x000086e4, 0x000087e4, 0x000088e4, 0x000089e4, 0x00008ae4, 0x00008be4, 0x00000ee4, 0x00008de4,
+	0x00008ee4, 0x00008fe4, 0x000090e4, 0x000091e4, 0x000092e4, 0x000093e4, 0x000094e4, 0x000095e4,
+	0x00000fe4, 0x000097e4, 0x000098e4, 0x000099e4, 0x00009ae4, 0x00009be4, 0x00009ce4, 0x00009de4,
+	0x00009ee4, 0x00009fe4, 0x000010e4, 0x0000a1e4, 0x0000a2e4, 0x0000a3e4, 0x0000a4e4, 0x0000a5e4,
+	0x0000a6e4, 0x0000a7e4, 0x0000a8e4, 0x0000a9e4, 0x000011e4, 0x0000abe4, 0x0000ace4, 0x0000ade4,
+	0x0000aee4, 0x0000afe4, 0x0000b0e4, 0x0000b1e4, 0x0006efe4, 0x0000b2e4, 0x0000b3e4, 0x000012e4,
+	0x0000b5e4, 0x0000b6e4, 0x0000b7e4, 0x0000b8e4, 0x0000b9e4, 0x0000bae4, 0x0000bbe4, 0x0000bce4,
+	0x0000bde4, 0x000013e4, 0x0000bfe4, 0x0000c0e4, 0x0000c1e4, 0x0000c2e4, 0x0000c3e4, 0x0000c4e4,
+	0x0000c5e4, 0x0000c6e4, 0x0000c7e4, 0x000002e4, 0x0000c9e4, 0x0000cae4, 0x0000cbe4, 0x0000cce4,
+	0x0000cde4, 0x0000cee4, 0x0000cfe4, 0x0000d0e4, 0x0000d1e4, 0x000015e4, 0x0000d3e4, 0x0000d4e4,
+	0x0000d5e4, 0x0000d6e4, 0x0000d7e4, 0x0000d8e4, 0x0000d9e4, 0x0000dae4, 0x0000dbe4, 0x000016e4,
+	0x0000dde4, 0x0000dee4, 0x0000dfe4, 0x0000e0e4, 0x0000e1e4, 0x0000e2e4, 0x0000e3e4, 0x0000e4e4,
+	0x0000e5e4, 0x000017e4, 0x0000e7e4, 0x0000e8e4, 0x0000e9e4, 0x0000eae4, 0x0000ebe4, 0x0000ece4,
+	0x0000ede4, 0x0000eee4, 0x0000efe4, 0x000018e4, 0x0000f1e4, 0x0000f2e4, 0x0000f3e4, 0x0000f4e4,
+	0x0000f5e4, 0x0000f6e4, 0x0000f7e4, 0x0009abe4, 0x0000f8e4, 0x0000f9e4, 0x000019e4, 0x0000fbe4,
+	0x0000fce4, 0x0000fee4, 0x000100e4, 0x000102e4, 0x00001ae4, 0x000106e4, 0x000108e4, 0x00010ae4,
+	0x00010ce4, 0x00001be4, 0x000110e4, 0x000112e4, 0x000114e4, 0x000116e4, 0x00001ce4, 0x00011ae4,
+	0x00011ce4, 0x00011ee4, 0x000120e4, 0x00001de4, 0x000124e4, 0x000126e4, 0x000128e4, 0x00012ae4,
+	0x000003e4, 0x00012ee4, 0x000130e4, 0x000132e4, 0x000134e4, 0x00001fe4, 0x000138e4, 0x00013ae4,
+	0x00013ce4, 0x00013ee4, 0x000020e4, 0x000141e4, 0x000143e4, 0x000145e4, 0x000147e4, 0x000021e4,
+	0x00014be4, 0x00014de4, 0x00014fe4, 0x000151e4, 0x000022e4, 0x000155e4, 0x000157e4, 0x000159e4,
+	0x00015be4, 0x000023e4, 0x00015fe4, 0x000161e4, 0x000163e4, 0x000165e4, 0x000167e4, 0x000024e4,
+	0x00016be4, 0x00016de4, 0x00016fe4, 0x000171e4, 0x000025e4, 0x000175e4, 0x000177e4, 0x000179e4,
+	0x00017be4, 0x000026e4, 0x00017fe4, 0x000181e4, 0x000183e4, 0x000185e4, 0x000027e4, 0x000188e4,
+	0x00018ae4, 0x00018ce4, 0x00018ee4, 0x000004e4, 0x000192e4, 0x000194e4, 0x000196e4, 0x000198e4,
+	0x000029e4, 0x00019ce4, 0x00019ee4, 0x0001a0e4, 0x0001a2e4, 0x00002ae4, 0x0001a6e4, 0x0001a8e4,
+	0x0001aae4, 0x0001ace4, 0x00002be4, 0x0001b0e4, 0x0001b2e4, 0x0001b4e4, 0x0001b6e4, 0x00002ce4,
+	0x0001bae4, 0x0001bce4, 0x0001bee4, 0x0001c0e4, 0x00002de4, 0x0001c4e4, 0x0001c6e4, 0x0001c8e4,
+	0x0001cae4, 0x00002ee4, 0x0001cde4, 0x0001cfe4, 0x0001d1e4, 0x0001d3e4, 0x00002fe4, 0x0001d7e4,
+	0x0001d9e4, 0x0001dbe4, 0x0001dde4, 0x000030e4, 0x0001e1e4, 0x0001e3e4, 0x0001e5e4, 0x0001e7e4,
+	0x000031e4, 0x0001ebe4, 0x0001ede4, 0x0001efe4, 0x0001f1e4, 0x0001f3e4, 0x000005e4, 0x0001f7e4,
+	0x0001f9e4, 0x000033e4, 0x000201e4, 0x000205e4, 0x000034e4, 0x00020de4, 0x000035e4, 0x000214e4,
+	0x000218e4, 0x000036e4, 0x000220e4, 0x000037e4, 0x000228e4, 0x00022ce4, 0x000038e4, 0x000234e4,
+	0x000238e4, 0x000039e4, 0x000240e4, 0x00003ae4, 0x000248e4, 0x00024ce4, 0x00003be4, 0x000254e4,
+	0x000006e4, 0x00025be4, 0x00025fe4, 0x00003de4, 0x000267e4, 0x00003ee4, 0x00026fe4, 0x000273e4,
+	0x00003fe4, 0x00027be4, 0x000040e4, 0x000283e4, 0x000287e4, 0x000041e4, 0x00028fe4, 0x000042e4,
+	0x000297e4, 0x00029be4, 0x000043e4, 0x0002a2e4, 0x000044e4, 0x0002aae4, 0x0002aee4, 0x000045e4,
+	0x0002b6e4, 0x000007e4, 0x0002bee4, 0x0002c2e4, 0x000047e4, 0x0002cae4, 0x0002cee4, 0x000048e4,
+	0x0002d6e4, 0x000049e4, 0x0002dee4, 0x0002e2e4, 0x00004ae4, 0x0002e9e4, 0x00004be4, 0x0002f1e4,
+	0x0002f5e4, 0x00004ce4, 0x0002fde4, 0x00004de4, 0x000305e4, 0x000309e4, 0x00004ee4, 0x000311e4,
+	0x00004fe4, 0x000319e4, 0x00031de4, 0x000008e4, 0x000325e4, 0x000051e4, 0x00032de4, 0x000330e4,
+	0x000052e4, 0x000338e4, 0x000053e4, 0x000340e4, 0x000344e4, 0x000054e4, 0x00034ce4, 0x000350e4,
+	0x000055e4, 0x000358e4, 0x000056e4, 0x000360e4, 0x000364e4, 0x000057e4, 0x00036ce4, 0x000058e4,
+	0x000374e4, 0x000377e4, 0x000059e4, 0x00037fe4, 0x000009e4, 0x000387e4, 0x00038be4, 0x00005be4,
+	0x000393e4, 0x00005ce4, 0x00039be4, 0x00039fe4, 0x00005de4, 0x0003a7e4, 0x00005ee4, 0x0003afe4,
+	0x0003b3e4, 0x00005fe4, 0x0003bbe4, 0x000060e4, 0x0003c2e4, 0x0003c6e4, 0x000061e4, 0x0003cee4,
+	0x000062e4, 0x0003d6e4, 0x0003dae4, 0x000063e4, 0x0003e2e4, 0x0003e6e4, 0x000001e5, 0x0003eee5,
+	0x000065e5, 0x000066e5, 0x000402e5, 0x000067e5, 0x000068e5, 0x000069e5, 0x00006ae5, 0x000429e5,
+	0x00006be5, 0x00006ce5, 0x00006de5, 0x00000be5, 0x000450e5, 0x00006fe5, 0x000070e5, 0x000071e5,
+	0x000470e5, 0x000072e5, 0x000073e5, 0x000074e5, 0x000075e5, 0x000497e5, 0x000076e5, 0x000077e5,
+	0x00000ce5, 0x000079e5, 0x0004bfe5, 0x00007ae5, 0x00007be5, 0x00007ce5, 0x00007de5, 0x0004e6e5,
+	0x00007ee5, 0x00007fe5, 0x000080e5, 0x000506e5, 0x000081e5, 0x00000de5, 0x000083e5, 0x000084e5,
+	0x00052de5, 0x000085e5, 0x000086e5, 0x000087e5, 0x000088e5, 0x000555e5, 0x000089e5, 0x00008ae5,
+	0x00008be5, 0x00000ee5, 0x00057ce5, 0x00008de5, 0x00008ee5, 0x00008fe5, 0x00059ce5, 0x000090e5,
+	0x000091e5, 0x000092e5, 0x000093e5, 0x0005c3e5, 0x000094e5, 0x000095e5, 0x00000fe5, 0x000097e5,
+	0x0005ebe5, 0x000098e5, 0x000099e5, 0x00009ae5, 0x00009be5, 0x000612e5, 0x00009ce5, 0x00009de5,
+	0x00009ee5, 0x000632e5, 0x00009fe5, 0x000010e5, 0x0000a1e5, 0x0000a2e5, 0x000659e5, 0x0000a3e5,
+	0x0000a4e5, 0x0000a5e5, 0x0000a6e5, 0x000680e5, 0x0000a7e5, 0x0000a8e5, 0x0000a9e5, 0x0006a0e5,
+	0x000011e5, 0x0000abe5, 0x0000ace5, 0x0000ade5, 0x0006c7e5, 0x0000aee5, 0x0000afe5, 0x0000b0e5,
+	0x0000b1e5, 0x0006efe5, 0x0000b2e5, 0x0000b3e5, 0x000012e5, 0x0000b5e5, 0x000716e5, 0x0000b6e5,
+	0x0000b7e5, 0x0000b8e5, 0x000736e5, 0x0000b9e5, 0x0000bae5, 0x0000bbe5, 0x0000bce5, 0x00075de5,
+	0x0000bde5, 0x000013e5, 0x0000bfe5, 0x0000c0e5, 0x000785e5, 0x0000c1e5, 0x0000c2e5, 0x0000c3e5,
+	0x0000c4e5, 0x0007ace5, 0x0000c5e5, 0x0000c6e5, 0x0000c7e5, 0x0007cce5, 0x000002e5, 0x0000c9e5,
+	0x0000cae5, 0x0000cce5, 0x0000cde5, 0x0000cfe5, 0x0000d0e5, 0x000015e5, 0x0000d3e5, 0x0000d5e5,
+	0x0000d7e5, 0x0000d8e5, 0x0000dae5, 0x000016e5, 0x0000dde5, 0x0000dee5, 0x0000e0e5, 0x0000e2e5,
+	0x0000e3e5, 0x0000e5e5, 0x000017e5, 0x0000e8e5, 0x0000eae5, 0x0000ebe5, 0x0000ede5, 0x0000eee5,
+	0x000018e5, 0x0000f1e5, 0x0000f3e5, 0x0000f5e5, 0x0000f6e5, 0x0000f8e5, 0x000019e5, 0x0000fbe5,
+	0x0000fce5, 0x0000fee5, 0x000100e5, 0x000101e5, 0x000103e5, 0x00001ae5, 0x000106e5, 0x000107e5,
+	0x000109e5, 0x00010be5, 0x00010ce5, 0x00001be5, 0x00010fe5, 0x000111e5, 0x000113e5, 0x000114e5,
+	0x000116e5, 0x00001ce5, 0x000119e5, 0x00011ae5, 0x00011ce5, 0x00011ee5, 0x00011fe5, 0x000121e5,
+	0x00001de5, 0x000124e5, 0x000125e5, 0x000127e5, 0x000129e5, 0x00012ae5, 0x000003e5, 0x00012de5,
+	0x00012fe5, 0x000131e5, 0x000132e5, 0x000134e5, 0x00001fe5, 0x000137e5, 0x000138e5, 0x00013ae5,
+	0x00013ce5, 0x00013de5, 0x00013fe5, 0x000020e5, 0x000142e5, 0x000143e5, 0x000145e5, 0x000147e5,
+	0x000148e5, 0x000021e5, 0x00014be5, 0x00014de5, 0x00014ee5, 0x000150e5, 0x000152e5, 0x000153e5,
+	0x000022e5, 0x000156e5, 0x000158e5, 0x00015ae5, 0x00015be5, 0x00015de5, 0x000023e5, 0x000160e5,
+	0x000161e5, 0x000163e5, 0x000165e5, 0x000166e5, 0x000024e5, 0x000169e5, 0x00016be5, 0x00016ce5,
+	0x00016ee5, 0x000170e5, 0x000171e5, 0x000025e5, 0x000174e5, 0x000176e5, 0x000177e5, 0x000179e5,
+	0x00017be5, 0x000026e5, 0x00017ee5, 0x00017fe5, 0x000181e5, 0x000183e5, 0x000184e5, 0x000027e5,
+	0x000187e5, 0x000189e5, 0x00018ae5, 0x00018ce5, 0x00018ee5, 0x00018fe5, 0x000004e5, 0x000192e5,
+	0x000194e5, 0x000197e5, 0x000029e5, 0x00019de5, 0x0001a1e5, 0x00002ae5, 0x0001a7e5, 0x0001aae5,
+	0x00002be5, 0x0001b0e5, 0x0001b3e5, 0x00002ce5, 0x0001bae5, 0x0001bde5, 0x0001c0e5, 0x00002de5,
+	0x0001c6e5, 0x0001cae5, 0x00002ee5, 0x0001d0e5, 0x0001d3e5, 0x00002fe5, 0x0001d9e5, 0x0001dce5,
+	0x000030e5, 0x0001e3e5, 0x0001e6e5, 0x000031e5, 0x0001ece5, 0x0001efe5, 0x000005e5, 0x0001f6e5,
+	0x0001f9e5, 0x0001fce5, 0x000033e5, 0x000202e5, 0x000205e5, 0x000034e5, 0x00020ce5, 0x00020fe5,
+	0x000035e5, 0x000215e5, 0x000218e5, 0x000036e5, 0x00021fe5, 0x000222e5, 0x000037e5, 0x000228e5,
+	0x00022be5, 0x000038e5, 0x000232e5, 0x000235e5, 0x000238e5, 0x000039e5, 0x00023ee5, 0x000241e5,
+	0x00003ae5, 0x000248e5, 0x00024be5, 0x00003be5, 0x000251e5, 0x000254e5, 0x000006e5, 0x00025be5,
+	0x00025ee5, 0x00003de5, 0x000264e5, 0x000267e5, 0x00003ee5, 0x00026ee5, 0x000271e5, 0x000274e5,
+	0x00003fe5, 0x00027ae5, 0x00027de5, 0x000040e5, 0x000284e5, 0x000287e5, 0x000041e5, 0x00028de5,
+	0x000290e5, 0x000042e5, 0x000297e5, 0x00029ae5, 0x000043e5, 0x0002a0e5, 0x0002a3e5, 0x0002a6e5,
+	0x000044e5, 0x0002ade5, 0x0002b0e5, 0x000045e5, 0x0002b6e5, 0x0002b9e5, 0x000007e5, 0x0002c0e5,
+	0x0002c3e5, 0x000047e5, 0x0002c9e5, 0x0002cce5, 0x000048e5, 0x0002d3e5, 0x0002d6e5, 0x000049e5,
+	0x0002dce5, 0x0002dfe5, 0x0002e2e5, 0x00004ae5, 0x0002e9e5, 0x0002ece5, 0x00004be5, 0x0002f2e5,
+	0x0002f5e5, 0x00004ce5, 0x0002fce5, 0x0002ffe5, 0x00004de5, 0x000305e5, 0x000308e5, 0x00004ee5,
+	0x00030fe5, 0x000312e5, 0x00004fe5, 0x000318e5, 0x00031be5, 0x00031ee5, 0x000008e5, 0x000325e5,
+	0x000051e5, 0x00032ee5, 0x000052e5, 0x00033be5, 0x000053e5, 0x000054e5, 0x00034ee5, 0x000055e5,
+	0x000056e5, 0x000361e5, 0x000057e5, 0x000058e5, 0x000374e5, 0x000059e5, 0x000380e5, 0x000009e5,
+	0x00005be5, 0x000393e5, 0x00005ce5, 0x00005de5, 0x0003a6e5, 0x00005ee5, 0x0003b3e5, 0x00005fe5,
+	0x000060e5, 0x0003c6e5, 0x000061e5, 0x000062e5, 0x0003d8e5, 0x000063e5, 0x000001e6, 0x0003ebe6,
+	0x000065e6, 0x0003f8e6, 0x000066e6, 0x000067e6, 0x00040be6, 0x000068e6, 0x000069e6, 0x00041ee6,
+	0x00006ae6, 0x00042be6, 0x00006be6, 0x00006ce6, 0x00043de6, 0x00006de6, 0x00000be6, 0x000450e6,
+	0x00006fe6, 0x000070e6, 0x000463e6, 0x000071e6, 0x000470e6, 0x000072e6, 0x000073e6, 0x000483e6,
+	0x000074e6, 0x000075e6, 0x000496e6, 0x000076e6, 0x0004a2e6, 0x000077e6, 0x00000ce6, 0x0004b5e6,
+	0x000079e6, 0x00007ae6, 0x0004c8e6, 0x00007be6, 0x00007ce6, 0x0004dbe6, 0x00007de6, 0x0004e8e6,
+	0x00007ee6, 0x00007fe6, 0x0004fbe6, 0x000080e6, 0x000081e6, 0x00050ee6, 0x00000de6, 0x00051ae6,
+	0x000083e6, 0x000084e6, 0x00052de6, 0x000085e6, 0x000086e6, 0x000540e6, 0x000087e6, 0x00054de6,
+	0x000088e6, 0x000089e6, 0x000560e6, 0x00008ae6, 0x00008be6, 0x000573e6, 0x00000ee6, 0x00008de6,
+	0x000586e6, 0x00008ee6, 0x000592e6, 0x00008fe6, 0x000090e6, 0x0005a5e6, 0x000091e6, 0x000092e6,
+	0x0005b8e6, 0x000093e6, 0x0005c5e6, 0x000094e6, 0x000095e6, 0x0005d8e6, 0x00000fe6, 0x000097e6,
+	0x0005ebe6, 0x000098e6, 0x000099e6, 0x0005fee6, 0x00009ae6, 0x00060ae6, 0x00009be6, 0x00009ce6,
+	0x00061de6, 0x00009de6, 0x00009ee6, 0x000630e6, 0x00009fe6, 0x00063de6, 0x000010e6, 0x0000a1e6,
+	0x0000a2e6, 0x0000a3e6, 0x0000a4e6, 0x0000a5e6, 0x0000a7e6, 0x0000a8e6, 0x0000a9e6, 0x000011e6,
+	0x0000ace6, 0x0000ade6, 0x0000aee6, 0x0000afe6, 0x0000b1e6, 0x0000b2e6, 0x0000b3e6, 0x000012e6,
+	0x0000b6e6, 0x0000b7e6, 0x0000b8e6, 0x0000bae6, 0x0000bbe6, 0x0000bce6, 0x0000bde6, 0x000013e6,
+	0x0000c0e6, 0x0000c1e6, 0x0000c2e6, 0x0000c4e6, 0x0000c5e6, 0x0000c6e6, 0x000002e6, 0x0000c9e6,
+	0x0000cae6, 0x0000cbe6, 0x0000cce6, 0x0000cee6, 0x0000cfe6, 0x0000d0e6, 0x000015e6, 0x0000d3e6,
+	0x0000d4e6, 0x0000d5e6, 0x0000d7e6, 0x0000d8e6, 0x0000d9e6, 0x0000dae6, 0x000016e6, 0x0000dde6,
+	0x0000dee6, 0x0000dfe6, 0x0000e1e6, 0x0000e2e6, 0x0000e3e6, 0x0000e4e6, 0x000017e6, 0x0000e7e6,
+	0x0000e8e6, 0x0000eae6, 0x0000ebe6, 0x0000ece6, 0x0000ede6, 0x0000efe6, 0x000018e6, 0x0000f1e6,
+	0x0000f2e6, 0x0000f4e6, 0x0000f5e6, 0x0000f6e6, 0x0000f7e6, 0x0000f9e6, 0x000019e6, 0x0000fbe6,
+	0x0000fce6, 0x0000fee6, 0x0000ffe6, 0x000100e6, 0x000101e6, 0x000103e6, 0x00001ae6, 0x000105e6,
+	0x000107e6, 0x000108e6, 0x000109e6, 0x00010ae6, 0x00010ce6, 0x00010de6, 0x00001be6, 0x00010fe6,
+	0x000111e6, 0x000112e6, 0x000113e6, 0x000114e6, 0x000116e6, 0x000117e6, 0x00001ce6, 0x000119e6,
+	0x00011be6, 0x00011ce6, 0x00011de6, 0x00011fe6, 0x000120e6, 0x000121e6, 0x00001de6, 0x000124e6,
+	0x000125e6, 0x000126e6, 0x000127e6, 0x000129e6, 0x00012ae6, 0x00012be6, 0x000003e6, 0x00012ee6,
+	0x00012fe6, 0x000130e6, 0x000131e6, 0x000133e6, 0x000134e6, 0x000135e6, 0x00001fe6, 0x000138e6,
+	0x000139e6, 0x00013ae6, 0x00013ce6, 0x00013de6, 0x00013ee6, 0x00013fe6, 0x000020e6, 0x000142e6,
+	0x000143e6, 0x000146e6, 0x000148e6, 0x000021e6, 0x00014de6, 0x000150e6, 0x000152e6, 0x000022e6,
+	0x000157e6, 0x00015ae6, 0x00015ce6, 0x000023e6, 0x000161e6, 0x000164e6, 0x000166e6, 0x000024e6,
+	0x00016ce6, 0x00016ee6, 0x000171e6, 0x000025e6, 0x000176e6, 0x000178e6, 0x00017be6, 0x000026e6,
+	0x000180e6, 0x000182e6, 0x000027e6, 0x000187e6, 0x00018ae6, 0x00018ce6, 0x000004e6, 0x000191e6,
+	0x000194e6, 0x000196e6, 0x000029e6, 0x00019be6, 0x00019ee6, 0x0001a1e6, 0x00002ae6, 0x0001a6e6,
+	0x0001a8e6, 0x0001abe6, 0x00002be6, 0x0001b0e6, 0x0001b2e6, 0x0001b5e6, 0x00002ce6, 0x0001bae6,
+	0x0001bce6, 0x0001bfe6, 0x00002de6, 0x0001c4e6, 0x0001c6e6, 0x0001c9e6, 0x00002ee6, 0x0001cee6,
+	0x0001d0e6, 0x0001d3e6, 0x00002fe6, 0x0001d8e6, 0x0001dbe6, 0x0001dde6, 0x000030e6, 0x0001e2e6,
+	0x0001e5e6, 0x0001e7e6, 0x000031e6, 0x0001ece6, 0x0001efe6, 0x0001f1e6, 0x000005e6, 0x0001f6e6,
+	0x0001f9e6, 0x0001fbe6, 0x000033e6, 0x000200e6, 0x000203e6, 0x000205e6, 0x000034e6, 0x00020be6,
+	0x00020de6, 0x000210e6, 0x000035e6, 0x000215e6, 0x000217e6, 0x00021ae6, 0x000036e6, 0x00021fe6,
+	0x000221e6, 0x000224e6, 0x000037e6, 0x000229e6, 0x00022be6, 0x00022ee6, 0x000038e6, 0x000233e6,
+	0x000235e6, 0x000238e6, 0x000039e6, 0x00023de6, 0x000240e6, 0x000242e6, 0x00003ae6, 0x000247e6,
+	0x00024ae6, 0x00024ce6, 0x00003be6, 0x000251e6, 0x000254e6, 0x000256e6, 0x000006e6, 0x00025be6,
+	0x00025ee6, 0x000260e6, 0x00003de6, 0x000265e6, 0x000268e6, 0x00026ae6, 0x00003ee6, 0x000270e6,
+	0x000272e6, 0x000275e6, 0x00003fe6, 0x00027ae6, 0x00027ce6, 0x00027fe6, 0x000040e6, 0x000284e6,
+	0x000286e6, 0x000041e6, 0x000290e6, 0x000042e6, 0x00029ae6, 0x000043e6, 0x0002a5e6, 0x000044e6,
+	0x0002afe6, 0x000045e6, 0x0002b9e6, 0x000007e6, 0x0002c3e6, 0x000047e6, 0x0002cde6, 0x000048e6,
+	0x0002d7e6, 0x000049e6, 0x0002e1e6, 0x00004ae6, 0x0002ebe6, 0x00004be6, 0x0002f5e6, 0x00004ce6,
+	0x0002ffe6, 0x00004de6, 0x00004ee6, 0x00030fe6, 0x00004fe6, 0x000319e6, 0x000008e6, 0x000323e6,
+	0x000051e6, 0x00032de6, 0x000052e6, 0x000337e6, 0x000053e6, 0x000341e6, 0x000054e6, 0x00034be6,
+	0x000055e6, 0x000355e6, 0x000056e6, 0x00035fe6, 0x000057e6, 0x000369e6, 0x000058e6, 0x000374e6,
+	0x000059e6, 0x00037ee6, 0x000009e6, 0x000388e6, 0x00005be6, 0x000392e6, 0x00005ce6, 0x00039ce6,
+	0x00005de6, 0x0003a6e6, 0x00005ee6, 0x0003b0e6, 0x00005fe6, 0x0003bae6, 0x000060e6, 0x0003c4e6,
+	0x000061e6, 0x0003cee6, 0x000062e6, 0x0003d8e6, 0x000063e6, 0x0003e3e6, 0x000001e7, 0x0003ede7,
+	0x000065e7, 0x0003f7e7, 0x000066e7, 0x000401e7, 0x000067e7, 0x00040be7, 0x000068e7, 0x000415e7,
+	0x000069e7, 0x00041fe7, 0x00006ae7, 0x000429e7, 0x00006be7, 0x000433e7, 0x00006ce7, 0x00043de7,
+	0x00006de7, 0x000448e7, 0x00000be7, 0x000452e7, 0x00006fe7, 0x00045ce7, 0x000070e7, 0x000466e7,
+	0x000071e7, 0x000470e7, 0x000072e7, 0x00047ae7, 0x000073e7, 0x000484e7, 0x000074e7, 0x00048ee7,
+	0x000075e7, 0x000498e7, 0x000076e7, 0x0004a2e7, 0x000077e7, 0x0004ade7, 0x00000ce7, 0x0004b7e7,
+	0x000079e7, 0x0004c1e7, 0x00007ae7, 0x0004cbe7, 0x00007be7, 0x0004d5e7, 0x00007ce7, 0x0004dfe7,
+	0x00007de7, 0x0004e9e7, 0x00007ee7, 0x0004f3e7, 0x00007fe7, 0x0004fde7, 0x000080e7, 0x000507e7,
+	0x000081e7, 0x00000de7, 0x000083e7, 0x000084e7, 0x000085e7, 0x000086e7, 0x000087e7, 0x000088e7,
+	0x000089e7, 0x00008ae7, 0x00008be7, 0x00000ee7, 0x00008de7, 0x00008ee7, 0x00008fe7, 0x000090e7,
+	0x000091e7, 0x000092e7, 0x000093e7, 0x000094e7, 0x000095e7, 0x00000fe7, 0x000097e7, 0x000098e7,
+	0x000099e7, 0x00009ae7, 0x00009ce7, 0x00009de7, 0x00009ee7, 0x00009fe7, 0x000010e7, 0x0000a1e7,
+	0x0000a2e7, 0x0000a3e7, 0x0000a4e7, 0x0000a5e7, 0x0000a6e7, 0x0000a7e7, 0x0000a8e7, 0x0000a9e7,
+	0x000011e7, 0x0000abe7, 0x0000ace7, 0x0000ade7, 0x0000aee7, 0x0000afe7, 0x0000b0e7, 0x0000b1e7,
+	0x0000b2e7, 0x0000b3e7, 0x000012e7, 0x0000b5e7, 0x0000b6e7, 0x0000b7e7, 0x0000b8e7, 0x0000b9e7,
+	0x0000bae7, 0x0000bbe7, 0x0000bce7, 0x0000bde7, 0x000013e7, 0x0000bfe7, 0x0000c0e7, 0x0000c1e7,
+	0x0000c2e7, 0x0000c3e7, 0x0000c4e7, 0x0000c5e7, 0x0000c6e7, 0x0000c7e7, 0x000002e7, 0x0000c9e7,
+	0x0000cae7, 0x0000cbe7, 0x0000cce7, 0x0000cde7, 0x0000cee7, 0x0000cfe7, 0x0000d0e7, 0x0000d1e7,
+	0x000015e7, 0x0000d3e7, 0x0000d4e7, 0x0000d5e7, 0x0000d6e7, 0x0000d7e7, 0x0000d8e7, 0x0000d9e7,
+	0x0000dae7, 0x0000dbe7, 0x000016e7, 0x0000dde7, 0x0000dee7, 0x0000dfe7, 0x0000e0e7, 0x0000e1e7,
+	0x0000e2e7, 0x0000e3e7, 0x0000e4e7, 0x0000e5e7, 0x000017e7, 0x0000e7e7, 0x0000e8e7, 0x0000e9e7,
+	0x0000eae7, 0x0000ebe7, 0x0000ece7, 0x0000ede7, 0x0000eee7, 0x0000efe7, 0x000018e7, 0x0000f1e7,
+	0x0000f2e7, 0x0000f3e7, 0x0000f4e7, 0x0000f5e7, 0x0000f6e7, 0x0000f7e7, 0x0000f8e7, 0x0000f9e7,
+	0x000019e7, 0x0000fbe7, 0x0000fce7, 0x0000fde7, 0x0000fee7, 0x0000ffe7, 0x000100e7, 0x000101e7,
+	0x000102e7, 0x00001ae7, 0x000107e7, 0x000109e7, 0x00010be7, 0x00010de7, 0x00001be7, 0x000111e7,
+	0x000113e7, 0x000115e7, 0x000117e7, 0x00001ce7, 0x00011be7, 0x00011de7, 0x00011fe7, 0x000121e7,
+	0x00001de7, 0x000125e7, 0x000127e7, 0x000129e7, 0x00012be7, 0x000003e7, 0x00012fe7, 0x000131e7,
+	0x000133e7, 0x000135e7, 0x00001fe7, 0x000139e7, 0x00013be7, 0x00013de7, 0x000020e7, 0x000141e7,
+	0x000143e7, 0x000145e7, 0x000147e7, 0x000021e7, 0x00014be7, 0x00014de7, 0x00014fe7, 0x000151e7,
+	0x000022e7, 0x000155e7, 0x000157e7, 0x000159e7, 0x00015be7, 0x000023e7, 0x00015fe7, 0x000161e7,
+	0x000163e7, 0x000165e7, 0x000024e7, 0x000169e7, 0x00016ce7, 0x00016ee7, 0x000170e7, 0x000025e7,
+	0x000174e7, 0x000176e7, 0x000178e7, 0x00017ae7, 0x000026e7, 0x00017ee7, 0x000180e7, 0x000182e7,
+	0x000184e7, 0x000027e7, 0x000188e7, 0x00018ae7, 0x00018ce7, 0x00018ee7, 0x000004e7, 0x000192e7,
+	0x000194e7, 0x000196e7, 0x000198e7, 0x000029e7, 0x00019ce7, 0x00019ee7, 0x0001a0e7, 0x0001a2e7,
+	0x00002ae7, 0x0001a6e7, 0x0001a8e7, 0x0001aae7, 0x0001ace7, 0x00002be7, 0x0001b0e7, 0x0001b2e7,
+	0x0001b4e7, 0x0001b6e7, 0x00002ce7, 0x0001bae7, 0x0001bce7, 0x0001bee7, 0x0001c0e7, 0x00002de7,
+	0x0001c4e7, 0x0001c6e7, 0x0001c8e7, 0x0001cae7, 0x00002ee7, 0x0001cee7, 0x0001d0e7, 0x0001d3e7,
+	0x0001d5e7, 0x00002fe7, 0x0001d9e7, 0x0001dbe7, 0x0001dde7, 0x0001dfe7, 0x000030e7, 0x0001e3e7,
+	0x0001e5e7, 0x0001e7e7, 0x0001e9e7, 0x000031e7, 0x0001ede7, 0x0001efe7, 0x0001f1e7, 0x0001f3e7,
+	0x000005e7, 0x0001f7e7, 0x0001f9e7, 0x0001fbe7, 0x0001fde7, 0x000033e7, 0x000201e7, 0x000203e7,
+	0x000205e7, 0x000034e7, 0x00020de7, 0x000035e7, 0x000215e7, 0x000219e7, 0x000036e7, 0x000221e7,
+	0x000037e7, 0x000229e7, 0x00022de7, 0x000038e7, 0x000235e7, 0x000039e7, 0x00023ee7, 0x000242e7,
+	0x00003ae7, 0x00024ae7, 0x00003be7, 0x000252e7, 0x000256e7, 0x000006e7, 0x00025ee7, 0x00003de7,
+	0x000266e7, 0x00026ae7, 0x00003ee7, 0x000272e7, 0x00003fe7, 0x00027ae7, 0x000040e7, 0x000282e7,
+	0x000286e7, 0x000041e7, 0x00028ee7, 0x000042e7, 0x000296e7, 0x00029ae7, 0x000043e7, 0x0002a3e7,
+	0x000044e7, 0x0002abe7, 0x0002afe7, 0x000045e7, 0x0002b7e7, 0x000007e7, 0x0002bfe7, 0x0002c3e7,
+	0x000047e7, 0x0002cbe7, 0x000048e7, 0x0002d3e7, 0x0002d7e7, 0x000049e7, 0x0002dfe7, 0x00004ae7,
+	0x0002e7e7, 0x0002ebe7, 0x00004be7, 0x0002f3e7, 0x00004ce7, 0x0002fbe7, 0x0002ffe7, 0x00004de7,
+	0x000307e7, 0x00004ee7, 0x000310e7, 0x000314e7, 0x00004fe7, 0x00031ce7, 0x000008e7, 0x000324e7,
+	0x000328e7, 0x000051e7, 0x000330e7, 0x000052e7, 0x000338e7, 0x000053e7, 0x000340e7, 0x000344e7,
+	0x000054e7, 0x00034ce7, 0x000055e7, 0x000354e7, 0x000358e7, 0x000056e7, 0x000360e7, 0x000057e7,
+	0x000368e7, 0x00036ce7, 0x000058e7, 0x000375e7, 0x000059e7, 0x00037de7, 0x000381e7, 0x000009e7,
+	0x000389e7, 0x00005be7, 0x000391e7, 0x000395e7, 0x00005ce7, 0x00039de7, 0x00005de7, 0x0003a5e7,
+	0x0003a9e7, 0x00005ee7, 0x0003b1e7, 0x00005fe7, 0x0003b9e7, 0x0003bde7, 0x000060e7, 0x0003c5e7,
+	0x000061e7, 0x0003cde7, 0x0003d1e7, 0x000062e7, 0x0003dae7, 0x000063e7, 0x0003e2e7, 0x0003e6e7,
+	0x000001e8, 0x0003eee8, 0x000065e8, 0x0003f6e8, 0x0003fae8, 0x000066e8, 0x000402e8, 0x000067e8,
+	0x00040ae8, 0x000068e8, 0x000069e8, 0x00006ae8, 0x00006be8, 0x000432e8, 0x00006ce8, 0x00006de8,
+	0x00000be8, 0x00006fe8, 0x00045be8, 0x000070e8, 0x000071e8, 0x000072e8, 0x000073e8, 0x000483e8,
+	0x000074e8, 0x000075e8, 0x000076e8, 0x000077e8, 0x0004ace8, 0x00000ce8, 0x000079e8, 0x00007ae8,
+	0x00007be8, 0x0004d4e8, 0x00007ce8, 0x00007de8, 0x00007ee8, 0x00007fe8, 0x000080e8, 0x000504e8,
+	0x000081e8, 0x00000de8, 0x000083e8, 0x000084e8, 0x00052de8, 0x000085e8, 0x000086e8, 0x000087e8,
+	0x000088e8, 0x000555e8, 0x000089e8, 0x00008ae8, 0x00008be8, 0x00000ee8, 0x00057ee8, 0x00008de8,
+	0x00008ee8, 0x00008fe8, 0x000090e8, 0x0005a6e8, 0x000091e8, 0x000092e8, 0x000093e8, 0x000094e8,
+	0x000095e8, 0x0005d6e8, 0x00000fe8, 0x000097e8, 0x000098e8, 0x000099e8, 0x0005ffe8, 0x00009ae8,
+	0x00009be8, 0x00009ce8, 0x00009de8, 0x000627e8, 0x00009ee8, 0x00009fe8, 0x000010e8, 0x0000a1e8,
+	0x000650e8, 0x0000a2e8, 0x0000a3e8, 0x0000a4e8, 0x0000a5e8, 0x0000a6e8, 0x000680e8, 0x0000a7e8,
+	0x0000a8e8, 0x0000a9e8, 0x000011e8, 0x0006a8e8, 0x0000abe8, 0x0000ace8, 0x0000ade8, 0x0000aee8,
+	0x0006d1e8, 0x0000afe8, 0x0000b0e8, 0x0000b1e8, 0x0000b2e8, 0x0006f9e8, 0x0000b3e8, 0x000012e8,
+	0x0000b5e8, 0x0000b6e8, 0x000722e8, 0x0000b7e8, 0x0000b8e8, 0x0000b9e8, 0x0000bae8, 0x0000bbe8,
+	0x000752e8, 0x0000bce8, 0x0000bde8, 0x000013e8, 0x0000bfe8, 0x00077ae8, 0x0000c0e8, 0x0000c1e8,
+	0x0000c2e8, 0x0000c3e8, 0x0007a3e8, 0x0000c4e8, 0x0000c5e8, 0x0000c6e8, 0x0000c7e8, 0x0007cbe8,
+	0x000002e8, 0x0000c9e8, 0x0000cae8, 0x0000cbe8, 0x0007f4e8, 0x0000cce8, 0x0000cde8, 0x0000cee8,
+	0x0000cfe8, 0x0000d0e8, 0x000015e8, 0x0000d4e8, 0x0000d5e8, 0x0000d7e8, 0x0000d8e8, 0x0000dae8,
+	0x000016e8, 0x0000dde8, 0x0000dfe8, 0x0000e1e8, 0x0000e2e8, 0x0000e4e8, 0x000017e8, 0x0000e7e8,
+	0x0000e9e8, 0x0000eae8, 0x0000ece8, 0x0000ede8, 0x0000efe8, 0x000018e8, 0x0000f2e8, 0x0000f4e8,
+	0x0000f6e8, 0x0000f7e8, 0x0000f9e8, 0x000019e8, 0x0000fce8, 0x0000fee8, 0x0000ffe8, 0x000101e8,
+	0x000102e8, 0x00001ae8, 0x000106e8, 0x000107e8, 0x000109e8, 0x00010be8, 0x00010ce8, 0x00001be8,
+	0x00010fe8, 0x000111e8, 0x000113e8, 0x000114e8, 0x000116e8, 0x00001ce8, 0x000119e8, 0x00011be8,
+	0x00011ce8, 0x00011ee8, 0x000120e8, 0x000121e8, 0x00001de8, 0x000124e8, 0x000126e8, 0x000128e8,
+	0x000129e8, 0x00012be8, 0x000003e8, 0x00012ee8, 0x000130e8, 0x000131e8, 0x000133e8, 0x000135e8,
+	0x00001fe8, 0x000138e8, 0x000139e8, 0x00013be8, 0x00013de8, 0x00013ee8, 0x000020e8, 0x000142e8,
+	0x000143e8, 0x000145e8, 0x000146e8, 0x000148e8, 0x000021e8, 0x00014be8, 0x00014de8, 0x00014ee8,
+	0x000150e8, 0x000152e8, 0x000022e8, 0x000155e8, 0x000157e8, 0x000158e8, 0x00015ae8, 0x00015be8,
+	0x00015de8, 0x000023e8, 0x000160e8, 0x000162e8, 0x000163e8, 0x000165e8, 0x000167e8, 0x000024e8,
+	0x00016ae8, 0x00016ce8, 0x00016de8, 0x00016fe8, 0x000170e8, 0x000025e8, 0x000174e8, 0x000175e8,
+	0x000177e8, 0x000178e8, 0x00017ae8, 0x000026e8, 0x00017de8, 0x00017fe8, 0x000181e8, 0x000182e8,
+	0x000184e8, 0x000027e8, 0x000187e8, 0x000189e8, 0x00018ae8, 0x00018ce8, 0x00018de8, 0x00018fe8,
+	0x000004e8, 0x000192e8, 0x000194e8, 0x000196e8, 0x000197e8, 0x000199e8, 0x000029e8, 0x00019ce8,
+	0x00019ee8, 0x0001a1e8, 0x00002ae8, 0x0001a7e8, 0x0001abe8, 0x00002be8, 0x0001b1e8, 0x0001b4e8,
+	0x00002ce8, 0x0001bbe8, 0x0001bee8, 0x00002de8, 0x0001c4e8, 0x0001c8e8, 0x00002ee8, 0x0001cee8,
+	0x0001d1e8, 0x00002fe8, 0x0001d8e8, 0x0001dbe8, 0x0001dee8, 0x000030e8, 0x0001e5e8, 0x0001e8e8,
+	0x000031e8, 0x0001eee8, 0x0001f2e8, 0x000005e8, 0x0001f8e8, 0x0001fbe8, 0x000033e8, 0x000202e8,
+	0x000205e8, 0x000034e8, 0x00020be8, 0x00020fe8, 0x000035e8, 0x000215e8, 0x000218e8, 0x000036e8,
+	0x00021fe8, 0x000222e8, 0x000037e8, 0x000229e8, 0x00022ce8, 0x000038e8, 0x000232e8, 0x000235e8,
+	0x000039e8, 0x00023ce8, 0x00023fe8, 0x000242e8, 0x00003ae8, 0x000249e8, 0x00024ce8, 0x00003be8,
+	0x000253e8, 0x000256e8, 0x000006e8, 0x00025ce8, 0x00025fe8, 0x00003de8, 0x000266e8, 0x000269e8,
+	0x00003ee8, 0x000270e8, 0x000273e8, 0x00003fe8, 0x000279e8, 0x00027de8, 0x000040e8, 0x000283e8,
+	0x000286e8, 0x000041e8, 0x00028de8, 0x000290e8, 0x000042e8, 0x000296e8, 0x00029ae8, 0x000043e8,
+	0x0002a0e8, 0x0002a3e8, 0x000044e8, 0x0002aae8, 0x0002ade8, 0x0002b0e8, 0x000045e8, 0x0002b7e8,
+	0x0002bae8, 0x000007e8, 0x0002c0e8, 0x0002c4e8, 0x000047e8, 0x0002cae8, 0x0002cde8, 0x000048e8,
+	0x0002d4e8, 0x0002d7e8, 0x000049e8, 0x0002dde8, 0x0002e1e8, 0x00004ae8, 0x0002e7e8, 0x0002eae8,
+	0x00004be8, 0x0002f1e8, 0x0002f4e8, 0x00004ce8, 0x0002fbe8, 0x0002fee8, 0x00004de8, 0x000304e8,
+	0x000307e8, 0x00004ee8, 0x00030ee8, 0x000311e8, 0x00004fe8, 0x000318e8, 0x00031be8, 0x00031ee8,
+	0x000008e8, 0x000325e8, 0x000328e8, 0x000051e8, 0x00032ee8, 0x000331e8, 0x000052e8, 0x000338e8,
+	0x000053e8, 0x000342e8, 0x000054e8, 0x00034fe8, 0x000055e8, 0x000056e8, 0x000362e8, 0x000057e8,
+	0x000058e8, 0x000375e8, 0x000059e8, 0x000009e8, 0x000389e8, 0x00005be8, 0x00005ce8, 0x00039ce8,
+	0x00005de8, 0x00005ee8, 0x0003b0e8, 0x00005fe8, 0x0003bce8, 0x000060e8, 0x000061e8, 0x0003d0e8,
+	0x000062e8, 0x000063e8, 0x0003e3e8, 0x000001e9, 0x000065e9, 0x0003f7e9, 0x000066e9, 0x000067e9,
+	0x00040ae9, 0x000068e9, 0x000069e9, 0x00041de9, 0x00006ae9, 0x00042ae9, 0x00006be9, 0x00006ce9,
+	0x00043ee9, 0x00006de9, 0x00000be9, 0x000451e9, 0x00006fe9, 0x000070e9, 0x000464e9, 0x000071e9,
+	0x000072e9, 0x000478e9, 0x000073e9, 0x000485e9, 0x000074e9, 0x000075e9, 0x000498e9, 0x000076e9,
+	0x000077e9, 0x0004ace9, 0x00000ce9, 0x000079e9, 0x0004bfe9, 0x00007ae9, 0x00007be9, 0x0004d2e9,
+	0x00007ce9, 0x00007de9, 0x0004e6e9, 0x00007ee9, 0x0004f3e9, 0x00007fe9, 0x000080e9, 0x000506e9,
+	0x000081e9, 0x00000de9, 0x000519e9, 0x000083e9, 0x000084e9, 0x00052de9, 0x000085e9, 0x000086e9,
+	0x000540e9, 0x000087e9, 0x000088e9, 0x000554e9, 0x000089e9, 0x000560e9, 0x00008ae9, 0x00008be9,
+	0x000574e9, 0x00000ee9, 0x00008de9, 0x000587e9, 0x00008ee9, 0x00008fe9, 0x00059be9, 0x000090e9,
+	0x000091e9, 0x0005aee9, 0x000092e9, 0x000093e9, 0x0005c1e9, 0x000094e9, 0x0005cee9, 0x000095e9,
+	0x00000fe9, 0x0005e2e9, 0x000097e9, 0x000098e9, 0x0005f5e9, 0x000099e9, 0x00009ae9, 0x000609e9,
+	0x00009be9, 0x00009ce9, 0x00061ce9, 0x00009de9, 0x00009ee9, 0x00062fe9, 0x00009fe9, 0x00063ce9,
+	0x000010e9, 0x0000a1e9, 0x000650e9, 0x0000a2e9, 0x0000a3e9, 0x000663e9, 0x0000a4e9, 0x0000a5e9,
+	0x0000a6e9, 0x0000a7e9, 0x0000a8e9, 0x0000a9e9, 0x000011e9, 0x0000ace9, 0x0000ade9, 0x0000aee9,
+	0x0000b0e9, 0x0000b1e9, 0x0000b2e9, 0x000012e9, 0x0000b5e9, 0x0000b6e9, 0x0000b8e9, 0x0000b9e9,
+	0x0000bae9, 0x0000bbe9, 0x0000bde9, 0x000013e9, 0x0000bfe9, 0x0000c1e9, 0x0000c2e9, 0x0000c3e9,
+	0x0000c4e9, 0x0000c6e9, 0x0000c7e9, 0x000002e9, 0x0000cae9, 0x0000cbe9, 0x0000cce9, 0x0000cee9,
+	0x0000cfe9, 0x0000d0e9, 0x000015e9, 0x0000d3e9, 0x0000d4e9, 0x0000d5e9, 0x0000d7e9, 0x0000d8e9,
+	0x0000d9e9, 0x0000dae9, 0x000016e9, 0x0000dde9, 0x0000dee9, 0x0000e0e9, 0x0000e1e9, 0x0000e2e9,
+	0x0000e3e9, 0x0000e5e9, 0x000017e9, 0x0000e7e9, 0x0000e9e9, 0x0000eae9, 0x0000ebe9, 0x0000ede9,
+	0x0000eee9, 0x0000efe9, 0x000018e9, 0x0000f2e9, 0x0000f3e9, 0x0000f4e9, 0x0000f6e9, 0x0000f7e9,
+	0x0000f8e9, 0x000019e9, 0x0000fbe9, 0x0000fce9, 0x0000fde9, 0x0000ffe9, 0x000100e9, 0x000101e9,
+	0x000102e9, 0x00001ae9, 0x000105e9, 0x000106e9, 0x000108e9, 0x000109e9, 0x00010ae9, 0x00010ce9,
+	0x00010de9, 0x00001be9, 0x00010fe9, 0x000111e9, 0x000112e9, 0x000113e9, 0x000115e9, 0x000116e9,
+	0x000117e9, 0x00001ce9, 0x00011ae9, 0x00011be9, 0x00011ce9, 0x00011ee9, 0x00011fe9, 0x000120e9,
+	0x00001de9, 0x000123e9, 0x000124e9, 0x000125e9, 0x000127e9, 0x000128e9, 0x000129e9, 0x00012be9,
+	0x000003e9, 0x00012de9, 0x00012ee9, 0x000130e9, 0x000131e9, 0x000132e9, 0x000134e9, 0x000135e9,
+	0x00001fe9, 0x000137e9, 0x000139e9, 0x00013ae9, 0x00013be9, 0x00013de9, 0x00013ee9, 0x00013fe9,
+	0x000020e9, 0x000142e9, 0x000143e9, 0x000144e9, 0x000146e9, 0x000147e9, 0x000148e9, 0x000021e9,
+	0x00014be9, 0x00014de9, 0x000150e9, 0x000153e9, 0x000022e9, 0x000158e9, 0x00015ae9, 0x000023e9,
+	0x000160e9, 0x000162e9, 0x000165e9, 0x000024e9, 0x00016ae9, 0x00016ce9, 0x00016fe9, 0x000025e9,
+	0x000174e9, 0x000177e9, 0x000179e9, 0x000026e9, 0x00017fe9, 0x000181e9, 0x000184e9, 0x000027e9,
+	0x000189e9, 0x00018be9, 0x00018ee9, 0x000004e9, 0x000193e9, 0x000196e9, 0x000198e9, 0x000029e9,
+	0x00019ee9, 0x0001a0e9, 0x00002ae9, 0x0001a5e9, 0x0001a8e9, 0x0001abe9, 0x00002be9, 0x0001b0e9,
+	0x0001b2e9, 0x0001b5e9, 0x00002ce9, 0x0001bae9, 0x0001bde9, 0x0001bfe9, 0x00002de9, 0x0001c4e9,
+	0x0001c7e9, 0x0001cae9, 0x00002ee9, 0x0001cfe9, 0x0001d1e9, 0x0001d4e9, 0x00002fe9, 0x0001d9e9,
+	0x0001dce9, 0x0001dee9, 0x000030e9, 0x0001e3e9, 0x0001e6e9, 0x0001e9e9, 0x000031e9, 0x0001eee9,
+	0x0001f0e9, 0x000005e9, 0x0001f5e9, 0x0001f8e9, 0x0001fbe9, 0x000033e9, 0x000200e9, 0x000202e9,
+	0x000205e9, 0x000034e9, 0x00020ae9, 0x00020de9, 0x00020fe9, 0x000035e9, 0x000214e9, 0x000217e9,
+	0x00021ae9, 0x000036e9, 0x00021fe9, 0x000221e9, 0x000224e9, 0x000037e9, 0x000229e9, 0x00022ce9,
+	0x00022ee9, 0x000038e9, 0x000234e9, 0x000236e9, 0x000239e9, 0x000039e9, 0x00023ee9, 0x000240e9,
+	0x00003ae9, 0x000246e9, 0x000248e9, 0x00024be9, 0x00003be9, 0x000250e9, 0x000253e9, 0x000255e9,
+	0x000006e9, 0x00025ae9, 0x00025de9, 0x00025fe9, 0x00003de9, 0x000265e9, 0x000267e9, 0x00026ae9,
+	0x00003ee9, 0x00026fe9, 0x000272e9, 0x000274e9, 0x00003fe9, 0x000279e9, 0x00027ce9, 0x00027ee9,
+	0x000040e9, 0x000284e9, 0x000286e9, 0x000041e9, 0x00028be9, 0x00028ee9, 0x000291e9, 0x000042e9,
+	0x000296e9, 0x00029be9, 0x000043e9, 0x0002a5e9, 0x000044e9, 0x000045e9, 0x0002b5e9, 0x000007e9,
+	0x0002bfe9, 0x000047e9, 0x0002c9e9, 0x000048e9, 0x0002d4e9, 0x000049e9, 0x0002dee9, 0x00004ae9,
+	0x0002e8e9, 0x00004be9, 0x0002f3e9, 0x00004ce9, 0x0002fde9, 0x00004de9, 0x000307e9, 0x00004ee9,
+	0x000312e9, 0x00004fe9, 0x00031ce9, 0x000008e9, 0x000327e9, 0x000051e9, 0x000331e9, 0x000052e9,
+	0x00033be9, 0x000053e9, 0x000054e9, 0x00034be9, 0x000055e9, 0x000355e9, 0x000056e9, 0x00035fe9,
+	0x000057e9, 0x00036ae9, 0x000058e9, 0x000374e9, 0x000059e9, 0x00037ee9, 0x000009e9, 0x000389e9,
+	0x00005be9, 0x000393e9, 0x00005ce9, 0x00039de9, 0x00005de9, 0x0003a8e9, 0x00005ee9, 0x0003b2e9,
+	0x00005fe9, 0x0003bce9, 0x000060e9, 0x0003c7e9, 0x000061e9, 0x0003d1e9, 0x000062e9, 0x000063e9,
+	0x0003e1e9, 0x000001ea, 0x0003ebea, 0x000065ea, 0x0003f5ea, 0x000066ea, 0x000400ea, 0x000067ea,
+	0x00040aea, 0x000068ea, 0x000414ea, 0x000069ea, 0x00041fea, 0x00006aea, 0x000429ea, 0x00006bea,
+	0x000433ea, 0x00006cea, 0x00043eea, 0x00006dea, 0x000448ea, 0x00000bea, 0x000452ea, 0x00006fea,
+	0x00045dea, 0x000070ea, 0x000467ea, 0x000071ea, 0x000471ea, 0x000072ea, 0x000073ea, 0x000481ea,
+	0x000074ea, 0x00048bea, 0x000075ea, 0x000496ea, 0x000076ea, 0x0004a0ea, 0x000077ea, 0x0004aaea,
+	0x00000cea, 0x0004b5ea, 0x000079ea, 0x0004bfea, 0x00007aea, 0x0004c9ea, 0x00007bea, 0x0004d4ea,
+	0x00007cea, 0x0004deea, 0x00007dea, 0x0004e8ea, 0x00007eea, 0x0004f3ea, 0x00007fea, 0x0004fdea,
+	0x000080ea, 0x000507ea, 0x000081ea, 0x00000dea, 0x000517ea, 0x000083ea, 0x000521ea, 0x000084ea,
+	0x00052bea, 0x000085ea, 0x000086ea, 0x000087ea, 0x000088ea, 0x00008aea, 0x00008bea, 0x00000eea,
+	0x00008dea, 0x00008eea, 0x00008fea, 0x000090ea, 0x000091ea, 0x000092ea, 0x000093ea, 0x000094ea,
+	0x000095ea, 0x00000fea, 0x000097ea, 0x000098ea, 0x000099ea, 0x00009aea, 0x00009bea, 0x00009cea,
+	0x00009dea, 0x00009eea, 0x00009fea, 0x000010ea, 0x0000a1ea, 0x0000a2ea, 0x0000a3ea, 0x0000a4ea,
+	0x0000a5ea, 0x0000a6ea, 0x0000a8ea, 0x0000a9ea, 0x000011ea, 0x0000abea, 0x0000acea, 0x0000adea,
+	0x0000aeea, 0x0000afea, 0x0000b0ea, 0x0000b1ea, 0x0000b2ea, 0x0000b3ea, 0x000012ea, 0x0000b5ea,
+	0x0000b6ea, 0x0000b7ea, 0x0000b8ea, 0x0000b9ea, 0x0000baea, 0x0000bbea, 0x0000bcea, 0x0000bdea,
+	0x000013ea, 0x0000bfea, 0x0000c0ea, 0x0000c1ea, 0x0000c2ea, 0x0000c3ea, 0x0000c4ea, 0x0000c5ea,
+	0x0000c7ea, 0x000002ea, 0x0000c9ea, 0x0000caea, 0x0000cbea, 0x0000ccea, 0x0000cdea, 0x0000ceea,
+	0x0000cfea, 0x0000d0ea, 0x0000d1ea, 0x000015ea, 0x0000d3ea, 0x0000d4ea, 0x0000d5ea, 0x0000d6ea,
+	0x0000d7ea, 0x0000d8ea, 0x0000d9ea, 0x0000daea, 0x0000dbea, 0x000016ea, 0x0000ddea, 0x0000deea,
+	0x0000dfea, 0x0000e0ea, 0x0000e1ea, 0x0000e2ea, 0x0000e3ea, 0x0000e5ea, 0x000017ea, 0x0000e7ea,
+	0x0000e8ea, 0x0000e9ea, 0x0000eaea, 0x0000ebea, 0x0000ecea, 0x0000edea, 0x0000eeea, 0x0000efea,
+	0x000018ea, 0x0000f1ea, 0x0000f2ea, 0x0000f3ea, 0x0000f4ea, 0x0000f5ea, 0x0000f6ea, 0x0000f7ea,
+	0x0000f8ea, 0x0000f9ea, 0x000019ea, 0x0000fbea, 0x0000fcea, 0x0000fdea, 0x0000feea, 0x0000ffea,
+	0x000100ea, 0x000101ea, 0x000102ea, 0x00001aea, 0x000105ea, 0x000106ea, 0x000107ea, 0x000108ea,
+	0x000109ea, 0x00010bea, 0x00010dea, 0x00001bea, 0x000111ea, 0x000113ea, 0x000115ea, 0x00001cea,
+	0x000119ea, 0x00011bea, 0x00011dea, 0x00011fea, 0x00001dea, 0x000124ea, 0x000126ea, 0x000128ea,
+	0x00012aea, 0x000003ea, 0x00012eea, 0x000130ea, 0x000132ea, 0x000134ea, 0x00001fea, 0x000138ea,
+	0x00013aea, 0x00013cea, 0x00013eea, 0x000020ea, 0x000143ea, 0x000145ea, 0x000147ea, 0x000149ea,
+	0x000021ea, 0x00014dea, 0x00014fea, 0x000151ea, 0x000022ea, 0x000155ea, 0x000157ea, 0x000159ea,
+	0x00015bea, 0x000023ea, 0x000160ea, 0x000162ea, 0x000164ea, 0x000166ea, 0x000024ea, 0x00016aea,
+	0x00016cea, 0x00016eea, 0x000170ea, 0x000025ea, 0x000174ea, 0x000176ea, 0x000178ea, 0x00017aea,
+	0x000026ea, 0x00017fea, 0x000181ea, 0x000183ea, 0x000185ea, 0x000027ea, 0x000189ea, 0x00018bea,
+	0x00018dea, 0x000004ea, 0x000191ea, 0x000193ea, 0x000195ea, 0x000197ea, 0x000029ea, 0x00019cea,
+	0x00019eea, 0x0001a0ea, 0x0001a2ea, 0x00002aea, 0x0001a6ea, 0x0001a8ea, 0x0001aaea, 0x0001acea,
+	0x00002bea, 0x0001b0ea, 0x0001b2ea, 0x0001b4ea, 0x0001b6ea, 0x00002cea, 0x0001bbea, 0x0001bdea,
+	0x0001bfea, 0x0001c1ea, 0x00002dea, 0x0001c5ea, 0x0001c7ea, 0x0001c9ea, 0x00002eea, 0x0001cdea,
+	0x0001cfea, 0x0001d1ea, 0x0001d3ea, 0x00002fea, 0x0001d7ea, 0x0001daea, 0x0001dcea, 0x0001deea,
+	0x000030ea, 0x0001e2ea, 0x0001e4ea, 0x0001e6ea, 0x0001e8ea, 0x000031ea, 0x0001ecea, 0x0001eeea,
+	0x0001f0ea, 0x0001f2ea, 0x000005ea, 0x0001f7ea, 0x0001f9ea, 0x0001fbea, 0x0001fdea, 0x000033ea,
+	0x000201ea, 0x000203ea, 0x000205ea, 0x000034ea, 0x000209ea, 0x00020bea, 0x00020dea, 0x00020fea,
+	0x000035ea, 0x000216ea, 0x00021aea, 0x000036ea, 0x000222ea, 0x000037ea, 0x00022aea, 0x000038ea,
+	0x000232ea, 0x000237ea, 0x000039ea, 0x00023fea, 0x00003aea, 0x000247ea, 0x00024bea, 0x00003bea,
+	0x000254ea, 0x000006ea, 0x00025cea, 0x00003dea, 0x000264ea, 0x000268ea, 0x00003eea, 0x000271ea,
+	0x00003fea, 0x000279ea, 0x00027dea, 0x000040ea, 0x000285ea, 0x000041ea, 0x00028dea, 0x000292ea,
+	0x000042ea, 0x00029aea, 0x000043ea, 0x0002a2ea, 0x000044ea, 0x0002aaea, 0x0002afea, 0x000045ea,
+	0x0002b7ea, 0x000007ea, 0x0002bfea, 0x0002c3ea, 0x000047ea, 0x0002ccea, 0x000048ea, 0x0002d4ea,
+	0x0002d8ea, 0x000049ea, 0x0002e0ea, 0x00004aea, 0x0002e8ea, 0x00004bea, 0x0002f1ea, 0x0002f5ea,
+	0x00004cea, 0x0002fdea, 0x00004dea, 0x000305ea, 0x00030aea, 0x00004eea, 0x000312ea, 0x00004fea,
+	0x00031aea, 0x000008ea, 0x000322ea, 0x000327ea, 0x000051ea, 0x00032fea, 0x000052ea, 0x000337ea,
+	0x00033bea, 0x000053ea, 0x000343ea, 0x000054ea, 0x00034cea, 0x000350ea, 0x000055ea, 0x000358ea,
+	0x000056ea, 0x000360ea, 0x000057ea, 0x000369ea, 0x00036dea, 0x000058ea, 0x000375ea, 0x000059ea,
+	0x00037dea, 0x000381ea, 0x000009ea, 0x00038aea, 0x00005bea, 0x000392ea, 0x00005cea, 0x00039aea,
+	0x00039eea, 0x00005dea, 0x0003a7ea, 0x00005eea, 0x0003afea, 0x0003b3ea, 0x00005fea, 0x0003bbea,
+	0x000060ea, 0x0003c4ea, 0x0003c8ea, 0x000061ea, 0x0003d0ea, 0x000062ea, 0x0003d8ea, 0x000063ea,
+	0x0003e1ea, 0x0003e5ea, 0x000001eb, 0x0003edeb, 0x000065eb, 0x0003f5eb, 0x0003f9eb, 0x000066eb,
+	0x000402eb, 0x000067eb, 0x00040aeb, 0x000068eb, 0x000412eb, 0x000416eb, 0x000069eb, 0x00041feb,
+	0x00006aeb, 0x00006beb, 0x000433eb, 0x00006ceb, 0x00006deb, 0x00000beb, 0x00006feb, 0x000070eb,
+	0x000465eb, 0x000071eb, 0x000072eb, 0x000073eb, 0x000074eb, 0x000075eb, 0x000497eb, 0x000076eb,
+	0x000077eb, 0x00000ceb, 0x000079eb, 0x00007aeb, 0x0004c8eb, 0x00007beb, 0x00007ceb, 0x00007deb,
+	0x00007eeb, 0x0004f2eb, 0x00007feb, 0x000080eb, 0x000081eb, 0x00000deb, 0x000083eb, 0x000523eb,
+	0x000084eb, 0x000085eb, 0x000086eb, 0x000087eb, 0x000088eb, 0x000555eb, 0x000089eb, 0x00008aeb,
+	0x00008beb, 0x00000eeb, 0x00008deb, 0x000586eb, 0x00008eeb, 0x00008feb, 0x000090eb, 0x000091eb,
+	0x0005b0eb, 0x000092eb, 0x000093eb, 0x000094eb, 0x000095eb, 0x00000feb, 0x0005e1eb, 0x000097eb,
+	0x000098eb, 0x000099eb, 0x00009aeb, 0x00009beb, 0x000613eb, 0x00009ceb, 0x00009deb, 0x00009eeb,
+	0x00009feb, 0x000010eb, 0x000645eb, 0x0000a1eb, 0x0000a2eb, 0x0000a3eb, 0x0000a4eb, 0x0000a5eb,
+	0x000676eb, 0x0000a6eb, 0x0000a7eb, 0x0000a8eb, 0x0000a9eb, 0x0006a0eb, 0x000011eb, 0x0000abeb,
+	0x0000aceb, 0x0000adeb, 0x0000aeeb, 0x0006d1eb, 0x0000afeb, 0x0000b0eb, 0x0000b1eb, 0x0000b2eb,
+	0x0000b3eb, 0x000703eb, 0x000012eb, 0x0000b5eb, 0x0000b6eb, 0x0000b7eb, 0x0000b8eb, 0x000735eb,
+	0x0000b9eb, 0x0000baeb, 0x0000bbeb, 0x0000bceb, 0x0000bdeb, 0x000766eb, 0x000013eb, 0x0000bfeb,
+	0x0000c0eb, 0x0000c1eb, 0x000790eb, 0x0000c2eb, 0x0000c3eb, 0x0000c4eb, 0x0000c5eb, 0x0000c6eb,
+	0x0007c1eb, 0x0000c7eb, 0x000002eb, 0x0000c9eb, 0x0000caeb, 0x0000cbeb, 0x0007f3eb, 0x0000cceb,
+	0x0000cdeb, 0x0000ceeb, 0x0000cfeb, 0x0000d0eb, 0x000824eb, 0x0000d1eb, 0x000015eb, 0x0000d3eb,
+	0x0000d4eb, 0x0000d5eb, 0x0000d7eb, 0x0000d9eb, 0x0000daeb, 0x000016eb, 0x0000deeb, 0x0000dfeb,
+	0x0000e1eb, 0x0000e3eb, 0x0000e4eb, 0x000017eb, 0x0000e8eb, 0x0000e9eb, 0x0000ebeb, 0x0000edeb,
+	0x0000eeeb, 0x000018eb, 0x0000f2eb, 0x0000f3eb, 0x0000f5eb, 0x0000f6eb, 0x0000f8eb, 0x000019eb,
+	0x0000fbeb, 0x0000fdeb, 0x0000ffeb, 0x000100eb, 0x000102eb, 0x00001aeb, 0x000105eb, 0x000107eb,
+	0x000109eb, 0x00010aeb, 0x00010ceb, 0x00001beb, 0x00010feb, 0x000111eb, 0x000113eb, 0x000114eb,
+	0x000116eb, 0x00001ceb, 0x000119eb, 0x00011beb, 0x00011deb, 0x00011eeb, 0x000120eb, 0x00001deb,
+	0x000123eb, 0x000125eb, 0x000126eb, 0x000128eb, 0x00012aeb, 0x000003eb, 0x00012deb, 0x00012feb,
+	0x000130eb, 0x000132eb, 0x000134eb, 0x00001feb, 0x000137eb, 0x000139eb, 0x00013aeb, 0x00013ceb,
+	0x00013eeb, 0x000020eb, 0x000141eb, 0x000143eb, 0x000144eb, 0x000146eb, 0x000148eb, 0x000021eb,
+	0x00014beb, 0x00014deb, 0x00014eeb, 0x000150eb, 0x000151eb, 0x000153eb, 0x000022eb, 0x000156eb,
+	0x000158eb, 0x00015aeb, 0x00015beb, 0x00015deb, 0x000023eb, 0x000160eb, 0x000162eb, 0x000164eb,
+	0x000165eb, 0x000167eb, 0x000024eb, 0x00016aeb, 0x00016ceb, 0x00016eeb, 0x00016feb, 0x000171eb,
+	0x000025eb, 0x000174eb, 0x000176eb, 0x000178eb, 0x000179eb, 0x00017beb, 0x000026eb, 0x00017eeb,
+	0x000180eb, 0x000181eb, 0x000183eb, 0x000185eb, 0x000027eb, 0x000188eb, 0x00018aeb, 0x00018beb,
+	0x00018deb, 0x00018feb, 0x000004eb, 0x000192eb, 0x000194eb, 0x000195eb, 0x000197eb, 0x000199eb,
+	0x000029eb, 0x00019ceb, 0x00019eeb, 0x00019feb, 0x0001a1eb, 0x0001a3eb, 0x00002aeb, 0x0001a6eb,
+	0x0001a8eb, 0x0001abeb, 0x00002beb, 0x0001b1eb, 0x0001b5eb, 0x00002ceb, 0x0001bbeb, 0x0001bfeb,
+	0x00002deb, 0x0001c5eb, 0x0001c9eb, 0x00002eeb, 0x0001cfeb, 0x0001d3eb, 0x00002feb, 0x0001d9eb,
+	0x0001dceb, 0x000030eb, 0x0001e3eb, 0x0001e6eb, 0x000031eb, 0x0001edeb, 0x0001f0eb, 0x000005eb,
+	0x0001f7eb, 0x0001faeb, 0x000033eb, 0x000201eb, 0x000204eb, 0x000034eb, 0x00020beb, 0x00020eeb,
+	0x000035eb, 0x000215eb, 0x000218eb, 0x000036eb, 0x00021feb, 0x000222eb, 0x000037eb, 0x000229eb,
+	0x00022ceb, 0x000038eb, 0x000232eb, 0x000236eb, 0x000039eb, 0x00023ceb, 0x000240eb, 0x00003aeb,
+	0x000246eb, 0x00024aeb, 0x00003beb, 0x000250eb, 0x000254eb, 0x000006eb, 0x00025aeb, 0x00025deb,
+	0x00003deb, 0x000264eb, 0x000267eb, 0x00003eeb, 0x00026eeb, 0x000271eb, 0x00003feb, 0x000278eb,
+	0x00027beb, 0x000040eb, 0x000282eb, 0x000285eb, 0x000041eb, 0x00028ceb, 0x00028feb, 0x000042eb,
+	0x000296eb, 0x000299eb, 0x000043eb, 0x0002a0eb, 0x0002a3eb, 0x0002a6eb, 0x000044eb, 0x0002adeb,
+	0x0002b0eb, 0x000045eb, 0x0002b7eb, 0x0002baeb, 0x000007eb, 0x0002c1eb, 0x0002c4eb, 0x000047eb,
+	0x0002cbeb, 0x0002ceeb, 0x000048eb, 0x0002d5eb, 0x0002d8eb, 0x000049eb, 0x0002dfeb, 0x0002e2eb,
+	0x00004aeb, 0x0002e8eb, 0x0002eceb, 0x00004beb, 0x0002f2eb, 0x0002f6eb, 0x00004ceb, 0x0002fceb,
+	0x000300eb, 0x00004deb, 0x000306eb, 0x00030aeb, 0x00004eeb, 0x000310eb, 0x000313eb, 0x00004feb,
+	0x00031aeb, 0x00031deb, 0x000008eb, 0x000324eb, 0x000327eb, 0x000051eb, 0x00032eeb, 0x000331eb,
+	0x000052eb, 0x000338eb, 0x00033beb, 0x000053eb, 0x000342eb, 0x000345eb, 0x000054eb, 0x00034ceb,
+	0x000055eb, 0x000356eb, 0x000056eb, 0x000057eb, 0x00036aeb, 0x000058eb, 0x000059eb, 0x00037deb,
+	0x000009eb, 0x00038beb, 0x00005beb, 0x00005ceb, 0x00039eeb, 0x00005deb, 0x00005eeb, 0x0003b2eb,
+	0x00005feb, 0x000060eb, 0x0003c6eb, 0x000061eb, 0x000062eb, 0x0003daeb, 0x000063eb, 0x000001ec,
+	0x0003eeec, 0x000065ec, 0x000066ec, 0x000402ec, 0x000067ec, 0x000068ec, 0x000416ec, 0x000069ec,
+	0x00006aec, 0x000429ec, 0x00006bec, 0x00006cec, 0x00043dec, 0x00006dec, 0x00000bec, 0x000451ec,
+	0x00006fec, 0x000070ec, 0x000465ec, 0x000071ec, 0x000072ec, 0x000479ec, 0x000073ec, 0x000074ec,
+	0x00048dec, 0x000075ec, 0x000076ec, 0x0004a1ec, 0x000077ec, 0x00000cec, 0x0004b4ec, 0x000079ec,
+	0x00007aec, 0x0004c8ec, 0x00007bec, 0x00007cec, 0x0004dcec, 0x00007dec, 0x00007eec, 0x0004f0ec,
+	0x00007fec, 0x000080ec, 0x000504ec, 0x000081ec, 0x00000dec, 0x000518ec, 0x000083ec, 0x000084ec,
+	0x00052bec, 0x000085ec, 0x000086ec, 0x00053fec, 0x000087ec, 0x00054dec, 0x000088ec, 0x000089ec,
+	0x000560ec, 0x00008aec, 0x00008bec, 0x000574ec, 0x00000eec, 0x00008dec, 0x000588ec, 0x00008eec,
+	0x00008fec, 0x00059cec, 0x000090ec, 0x000091ec, 0x0005b0ec, 0x000092ec, 0x000093ec, 0x0005c4ec,
+	0x000094ec, 0x000095ec, 0x0005d8ec, 0x00000fec, 0x000097ec, 0x0005ebec, 0x000098ec, 0x000099ec,
+	0x0005ffec, 0x00009aec, 0x00009bec, 0x000613ec, 0x00009cec, 0x00009dec, 0x000627ec, 0x00009eec,
+	0x00009fec, 0x00063bec, 0x000010ec, 0x0000a1ec, 0x00064fec, 0x0000a2ec, 0x0000a3ec, 0x000663ec,
+	0x0000a4ec, 0x0000a5ec, 0x000676ec, 0x0000a6ec, 0x0000a7ec, 0x00068aec, 0x0000a8ec, 0x0000a9ec,
+	0x000011ec, 0x0000abec, 0x0000acec, 0x0000adec, 0x0000afec, 0x0000b0ec, 0x0000b1ec, 0x0000b3ec,
+	0x000012ec, 0x0000b5ec, 0x0000b7ec, 0x0000b8ec, 0x0000b9ec, 0x0000bbec, 0x0000bcec, 0x0000bdec,
+	0x000013ec, 0x0000c0ec, 0x0000c1ec, 0x0000c3ec, 0x0000c4ec, 0x0000c5ec, 0x0000c7ec, 0x000002ec,
+	0x0000c9ec, 0x0000caec, 0x0000ccec, 0x0000cdec, 0x0000ceec, 0x0000d0ec, 0x0000d1ec, 0x000015ec,
+	0x0000d4ec, 0x0000d5ec, 0x0000d6ec, 0x0000d8ec, 0x0000d9ec, 0x0000daec, 0x000016ec, 0x0000ddec,
+	0x0000deec, 0x0000e0ec, 0x0000e1ec, 0x0000e2ec, 0x0000e4ec, 0x0000e5ec, 0x000017ec, 0x0000e8ec,
+	0x0000e9ec, 0x0000eaec, 0x0000ecec, 0x0000edec, 0x0000eeec, 0x000018ec, 0x0000f1ec, 0x0000f2ec,
+	0x0000f4ec, 0x0000f5ec, 0x0000f6ec, 0x0000f7ec, 0x0000f9ec, 0x000019ec, 0x0000fbec, 0x0000fdec,
+	0x0000feec, 0x0000ffec, 0x000101ec, 0x000102ec, 0x00001aec, 0x000105ec, 0x000106ec, 0x000107ec,
+	0x000109ec, 0x00010aec, 0x00010bec, 0x00010dec, 0x00001bec, 0x00010fec, 0x000111ec, 0x000112ec,
+	0x000113ec, 0x000115ec, 0x000116ec, 0x000117ec, 0x00001cec, 0x00011aec, 0x00011bec, 0x00011dec,
+	0x00011eec, 0x00011fec, 0x000121ec, 0x00001dec, 0x000123ec, 0x000124ec, 0x000126ec, 0x000127ec,
+	0x000128ec, 0x00012aec, 0x00012bec, 0x000003ec, 0x00012eec, 0x00012fec, 0x000130ec, 0x000132ec,
+	0x000133ec, 0x000134ec, 0x00001fec, 0x000137ec, 0x000138ec, 0x00013aec, 0x00013bec, 0x00013cec,
+	0x00013eec, 0x00013fec, 0x000020ec, 0x000142ec, 0x000143ec, 0x000144ec, 0x000146ec, 0x000147ec,
+	0x000148ec, 0x000021ec, 0x00014bec, 0x00014cec, 0x00014eec, 0x00014fec, 0x000150ec, 0x000151ec,
+	0x000022ec, 0x000155ec, 0x000158ec, 0x00015bec, 0x000023ec, 0x000160ec, 0x000163ec, 0x000165ec,
+	0x000024ec, 0x00016bec, 0x00016dec, 0x000170ec, 0x000025ec, 0x000175ec, 0x000178ec, 0x00017bec,
+	0x000026ec, 0x000180ec, 0x000182ec, 0x000027ec, 0x000188ec, 0x00018aec, 0x00018dec, 0x000004ec,
+	0x000192ec, 0x000195ec, 0x000198ec, 0x000029ec, 0x00019dec, 0x0001a0ec, 0x0001a2ec, 0x00002aec,
+	0x0001a8ec, 0x0001aaec, 0x00002bec, 0x0001afec, 0x0001b2ec, 0x0001b5ec, 0x00002cec, 0x0001baec,
+	0x0001bdec, 0x0001bfec, 0x00002dec, 0x0001c5ec, 0x0001c7ec, 0x0001caec, 0x00002eec, 0x0001cfec,
+	0x0001d2ec, 0x0001d5ec, 0x00002fec, 0x0001daec, 0x0001dcec, 0x000030ec, 0x0001e2ec, 0x0001e4ec,
+	0x0001e7ec, 0x000031ec, 0x0001ecec, 0x0001efec, 0x0001f2ec, 0x000005ec, 0x0001f7ec, 0x0001faec,
+	0x0001fcec, 0x000033ec, 0x000202ec, 0x000204ec, 0x000034ec, 0x000209ec, 0x00020cec, 0x00020fec,
+	0x000035ec, 0x000214ec, 0x000217ec, 0x000219ec, 0x000036ec, 0x00021fec, 0x000221ec, 0x000224ec,
+	0x000037ec, 0x000229ec, 0x00022cec, 0x00022fec, 0x000038ec, 0x000234ec, 0x000236ec, 0x000039ec,
+	0x00023cec, 0x00023eec, 0x000241ec, 0x00003aec, 0x000246ec, 0x000249ec, 0x00024cec, 0x00003bec,
+	0x000251ec, 0x000254ec, 0x000256ec, 0x000006ec, 0x00025cec, 0x00025eec, 0x00003dec, 0x000263ec,
+	0x000266ec, 0x000269ec, 0x00003eec, 0x00026eec, 0x000271ec, 0x000273ec, 0x00003fec, 0x000279ec,
+	0x00027bec, 0x00027eec, 0x000040ec, 0x000283ec, 0x000286ec, 0x000289ec, 0x000041ec, 0x00028eec,
+	0x000290ec, 0x000042ec, 0x000296ec, 0x000298ec, 0x00029bec, 0x000043ec, 0x0002a0ec, 0x0002a3ec,
+	0x000044ec, 0x0002abec, 0x000045ec, 0x0002b6ec, 0x000007ec, 0x0002c0ec, 0x000047ec, 0x0002cbec,
+	0x000048ec, 0x0002d5ec, 0x000049ec, 0x0002e0ec, 0x00004aec, 0x0002eaec, 0x00004bec, 0x0002f5ec,
+	0x00004cec, 0x00004dec, 0x000305ec, 0x00004eec, 0x000310ec, 0x00004fec, 0x00031aec, 0x000008ec,
+	0x000325ec, 0x000051ec, 0x00032fec, 0x000052ec, 0x00033aec, 0x000053ec, 0x000344ec, 0x000054ec,
+	0x00034fec, 0x000055ec, 0x000056ec, 0x00035fec, 0x000057ec, 0x00036aec, 0x000058ec, 0x000374ec,
+	0x000059ec, 0x00037fec, 0x000009ec, 0x000389ec, 0x00005bec, 0x000394ec, 0x00005cec, 0x00039eec,
+	0x00005dec, 0x0003a9ec, 0x00005eec, 0x00005fec, 0x0003b9ec, 0x000060ec, 0x0003c3ec, 0x000061ec,
+	0x0003ceec, 0x000062ec, 0x0003d9ec, 0x000063ec, 0x0003e3ec, 0x000001ed, 0x0003eeed, 0x000065ed,
+	0x0003f8ed, 0x000066ed, 0x000403ed, 0x000067ed, 0x000068ed, 0x000413ed, 0x000069ed, 0x00041ded,
+	0x00006aed, 0x000428ed, 0x00006bed, 0x000433ed, 0x00006ced, 0x00043ded, 0x00006ded, 0x000448ed,
+	0x00000bed, 0x000452ed, 0x00006fed, 0x00045ded, 0x000070ed, 0x000071ed, 0x00046ded, 0x000072ed,
+	0x000477ed, 0x000073ed, 0x000482ed, 0x000074ed, 0x00048ded, 0x000075ed, 0x000497ed, 0x000076ed,
+	0x0004a2ed, 0x000077ed, 0x0004aced, 0x00000ced, 0x0004b7ed, 0x000079ed, 0x00007aed, 0x0004c7ed,
+	0x00007bed, 0x0004d1ed, 0x00007ced, 0x0004dced, 0x00007ded, 0x0004e7ed, 0x00007eed, 0x0004f1ed,
+	0x00007fed, 0x0004fced, 0x000080ed, 0x000506ed, 0x000081ed, 0x000511ed, 0x00000ded, 0x000083ed,
+	0x000521ed, 0x000084ed, 0x00052bed, 0x000085ed, 0x000536ed, 0x000086ed, 0x000541ed, 0x000087ed,
+	0x000088ed, 0x000089ed, 0x00008aed, 0x00008bed, 0x00000eed, 0x00008ded, 0x00008eed, 0x00008fed,
+	0x000090ed, 0x000091ed, 0x000092ed, 0x000093ed, 0x000094ed, 0x000095ed, 0x00000fed, 0x000097ed,
+	0x000098ed, 0x00009aed, 0x00009bed, 0x00009ced, 0x00009ded, 0x00009eed, 0x00009fed, 0x000010ed,
+	0x0000a1ed, 0x0000a2ed, 0x0000a3ed, 0x0000a4ed, 0x0000a5ed, 0x0000a6ed, 0x0000a7ed, 0x0000a8ed,
+	0x0000a9ed, 0x000011ed, 0x0000aced, 0x0000aded, 0x0000aeed, 0x0000afed, 0x0000b0ed, 0x0000b1ed,
+	0x0000b2ed, 0x0000b3ed, 0x000012ed, 0x0000b5ed, 0x0000b6ed, 0x0000b7ed, 0x0000b8ed, 0x0000b9ed,
+	0x0000baed, 0x0000bbed, 0x0000bced, 0x000013ed, 0x0000bfed, 0x0000c0ed, 0x0000c1ed, 0x0000c2ed,
+	0x0000c3ed, 0x0000c4ed, 0x0000c5ed, 0x0000c6ed, 0x0000c7ed, 0x000002ed, 0x0000c9ed, 0x0000caed,
+	0x0000cbed, 0x0000cced, 0x0000cded, 0x0000ceed, 0x0000d0ed, 0x0000d1ed, 0x000015ed, 0x0000d3ed,
+	0x0000d4ed, 0x0000d5ed, 0x0000d6ed, 0x0000d7ed, 0x0000d8ed, 0x0000d9ed, 0x0000daed, 0x0000dbed,
+	0x000016ed, 0x0000dded, 0x0000deed, 0x0000dfed, 0x0000e0ed, 0x0000e2ed, 0x0000e3ed, 0x0000e4ed,
+	0x0000e5ed, 0x000017ed, 0x0000e7ed, 0x0000e8ed, 0x0000e9ed, 0x0000eaed, 0x0000ebed, 0x0000eced,
+	0x0000eded, 0x0000eeed, 0x0000efed, 0x000018ed, 0x0000f1ed, 0x0000f2ed, 0x0000f4ed, 0x0000f5ed,
+	0x0000f6ed, 0x0000f7ed, 0x0000f8ed, 0x0000f9ed, 0x000019ed, 0x0000fbed, 0x0000fced, 0x0000fded,
+	0x0000feed, 0x0000ffed, 0x000100ed, 0x000101ed, 0x000102ed, 0x000103ed, 0x00001aed, 0x000106ed,
+	0x000107ed, 0x000108ed, 0x000109ed, 0x00010aed, 0x00010bed, 0x00010ced, 0x00010ded, 0x00001bed,
+	0x00010fed, 0x000111ed, 0x000113ed, 0x000115ed, 0x00001ced, 0x00011aed, 0x00011ced, 0x00011eed,
+	0x000120ed, 0x00001ded, 0x000124ed, 0x000126ed, 0x000128ed, 0x00012bed, 0x000003ed, 0x00012fed,
+	0x000131ed, 0x000133ed, 0x00001fed, 0x000137ed, 0x000139ed, 0x00013ced, 0x00013eed, 0x000020ed,
+	0x000142ed, 0x000144ed, 0x000146ed, 0x000148ed, 0x000021ed, 0x00014ced, 0x00014fed, 0x000151ed,
+	0x000153ed, 0x000022ed, 0x000157ed, 0x000159ed, 0x00015bed, 0x000023ed, 0x000160ed, 0x000162ed,
+	0x000164ed, 0x000166ed, 0x000024ed, 0x00016aed, 0x00016ced, 0x00016eed, 0x000170ed, 0x000025ed,
+	0x000175ed, 0x000177ed, 0x000179ed, 0x000026ed, 0x00017ded, 0x00017fed, 0x000181ed, 0x000184ed,
+	0x000027ed, 0x000188ed, 0x00018aed, 0x00018ced, 0x00018eed, 0x000004ed, 0x000192ed, 0x000194ed,
+	0x000197ed, 0x000199ed, 0x000029ed, 0x00019ded, 0x00019fed, 0x0001a1ed, 0x00002aed, 0x0001a5ed,
+	0x0001a8ed, 0x0001aaed, 0x0001aced, 0x00002bed, 0x0001b0ed, 0x0001b2ed, 0x0001b4ed, 0x0001b6ed,
+	0x00002ced, 0x0001bbed, 0x0001bded, 0x0001bfed, 0x0001c1ed, 0x00002ded, 0x0001c5ed, 0x0001c7ed,
+	0x0001c9ed, 0x00002eed, 0x0001ceed, 0x0001d0ed, 0x0001d2ed, 0x0001d4ed, 0x00002fed, 0x0001d8ed,
+	0x0001daed, 0x0001dced, 0x0001dfed, 0x000030ed, 0x0001e3ed, 0x0001e5ed, 0x0001e7ed, 0x000031ed,
+	0x0001ebed, 0x0001eded, 0x0001f0ed, 0x0001f2ed, 0x000005ed, 0x0001f6ed, 0x0001f8ed, 0x0001faed,
+	0x0001fced, 0x000033ed, 0x000200ed, 0x000203ed, 0x000205ed, 0x000207ed, 0x000034ed, 0x00020bed,
+	0x00020ded, 0x00020fed, 0x000035ed, 0x000214ed, 0x000216ed, 0x000218ed, 0x00021aed, 0x000036ed,
+	0x00021eed, 0x000222ed, 0x000037ed, 0x00022bed, 0x000038ed, 0x000233ed, 0x000238ed, 0x000039ed,
+	0x000240ed, 0x00003aed, 0x000248ed, 0x00003bed, 0x000251ed, 0x000255ed, 0x000006ed, 0x00025eed,
+	0x00003ded, 0x000266ed, 0x00003eed, 0x00026fed, 0x000273ed, 0x00003fed, 0x00027bed, 0x000040ed,
+	0x000284ed, 0x000041ed, 0x00028ced, 0x000290ed, 0x000042ed, 0x000299ed, 0x000043ed, 0x0002a1ed,
+	0x0002a6ed, 0x000044ed, 0x0002aeed, 0x000045ed, 0x0002b7ed, 0x000007ed, 0x0002bfed, 0x0002c3ed,
+	0x000047ed, 0x0002cced, 0x000048ed, 0x0002d4ed, 0x000049ed, 0x0002dded, 0x0002e1ed, 0x00004aed,
+	0x0002e9ed, 0x00004bed, 0x0002f2ed, 0x00004ced, 0x0002faed, 0x0002ffed, 0x00004ded, 0x000307ed,
+	0x00004eed, 0x000310ed, 0x000314ed, 0x00004fed, 0x00031ced, 0x000008ed, 0x000325ed, 0x000051ed,
+	0x00032ded, 0x000331ed, 0x000052ed, 0x00033aed, 0x000053ed, 0x000342ed, 0x000054ed, 0x00034bed,
+	0x00034fed, 0x000055ed, 0x000358ed, 0x000056ed, 0x000360ed, 0x000057ed, 0x000368ed, 0x00036ded,
+	0x000058ed, 0x000375ed, 0x000059ed, 0x00037eed, 0x000382ed, 0x000009ed, 0x00038aed, 0x00005bed,
+	0x000393ed, 0x00005ced, 0x00039bed, 0x0003a0ed, 0x00005ded, 0x0003a8ed, 0x00005eed, 0x0003b0ed,
+	0x00005fed, 0x0003b9ed, 0x0003bded, 0x000060ed, 0x0003c6ed, 0x000061ed, 0x0003ceed, 0x000062ed,
+	0x0003d7ed, 0x0003dbed, 0x000063ed, 0x0003e3ed, 0x000001ee, 0x0003ecee, 0x000065ee, 0x0003f4ee,
+	0x0003f8ee, 0x000066ee, 0x000401ee, 0x000067ee, 0x000409ee, 0x00040eee, 0x000068ee, 0x000416ee,
+	0x000069ee, 0x00041fee, 0x00006aee, 0x000427ee, 0x00042bee, 0x00006bee, 0x000434ee, 0x00006cee,
+	0x00043cee, 0x00006dee, 0x00000bee, 0x00006fee, 0x000070ee, 0x000071ee, 0x00046fee, 0x000072ee,
+	0x000073ee, 0x000074ee, 0x000075ee, 0x000076ee, 0x000077ee, 0x0004aaee, 0x00000cee, 0x000079ee,
+	0x00007aee, 0x00007bee, 0x00007cee, 0x0004ddee, 0x00007dee, 0x00007eee, 0x00007fee, 0x000080ee,
+	0x000081ee, 0x00000dee, 0x000518ee, 0x000083ee, 0x000084ee, 0x000085ee, 0x000086ee, 0x000087ee,
+	0x00054bee, 0x000088ee, 0x000089ee, 0x00008aee, 0x00008bee, 0x00000eee, 0x00008dee, 0x000587ee,
+	0x00008eee, 0x00008fee, 0x000090ee, 0x000091ee, 0x000092ee, 0x0005b9ee, 0x000093ee, 0x000094ee,
+	0x000095ee, 0x00000fee, 0x000097ee, 0x000098ee, 0x0005f5ee, 0x000099ee, 0x00009aee, 0x00009bee,
+	0x00009cee, 0x00009dee, 0x000627ee, 0x00009eee, 0x00009fee, 0x000010ee, 0x0000a1ee, 0x0000a2ee,
+	0x0000a3ee, 0x000663ee, 0x0000a4ee, 0x0000a5ee, 0x0000a6ee, 0x0000a7ee, 0x0000a8ee, 0x000696ee,
+	0x0000a9ee, 0x000011ee, 0x0000abee, 0x0000acee, 0x0000adee, 0x0000aeee, 0x0006d1ee, 0x0000afee,
+	0x0000b0ee, 0x0000b1ee, 0x0000b2ee, 0x0000b3ee, 0x000704ee, 0x000012ee, 0x0000b5ee, 0x0000b6ee,
+	0x0000b7ee, 0x0000b8ee, 0x0000b9ee, 0x00073fee, 0x0000baee, 0x0000bbee, 0x0000bcee, 0x0000bdee,
+	0x000013ee, 0x0000bfee, 0x00077aee, 0x0000c0ee, 0x0000c1ee, 0x0000c2ee, 0x0000c3ee, 0x0000c4ee,
+	0x0007adee, 0x0000c5ee, 0x0000c6ee, 0x0000c7ee, 0x000002ee, 0x0000c9ee, 0x0000caee, 0x0007e8ee,
+	0x0000cbee, 0x0000ccee, 0x0000cdee, 0x0000ceee, 0x0000cfee, 0x00081bee, 0x0000d0ee, 0x0000d1ee,
+	0x000015ee, 0x0000d3ee, 0x0000d4ee, 0x0000d5ee, 0x000857ee, 0x0000d6ee, 0x0000d7ee, 0x0000d8ee,
+	0x0000d9ee, 0x0000dbee, 0x000016ee, 0x0000deee, 0x0000e0ee, 0x0000e1ee, 0x0000e3ee, 0x0000e5ee,
+	0x000017ee, 0x0000e8ee, 0x0000eaee, 0x0000ebee, 0x0000edee, 0x0000efee, 0x000018ee, 0x0000f2ee,
+	0x0000f4ee, 0x0000f6ee, 0x0000f7ee, 0x0000f9ee, 0x000019ee, 0x0000fcee, 0x0000feee, 0x000100ee,
+	0x000101ee, 0x00001aee, 0x000105ee, 0x000107ee, 0x000108ee, 0x00010aee, 0x00010cee, 0x00001bee,
+	0x00010fee, 0x000111ee, 0x000112ee, 0x000114ee, 0x000116ee, 0x00001cee, 0x000119ee, 0x00011bee,
+	0x00011dee, 0x00011eee, 0x000120ee, 0x00001dee, 0x000123ee, 0x000125ee, 0x000127ee, 0x000128ee,
+	0x00012aee, 0x000003ee, 0x00012eee, 0x00012fee, 0x000131ee, 0x000133ee, 0x000134ee, 0x00001fee,
+	0x000138ee, 0x000139ee, 0x00013bee, 0x00013dee, 0x00013eee, 0x000020ee, 0x000142ee, 0x000144ee,
+	0x000145ee, 0x000147ee, 0x000149ee, 0x000021ee, 0x00014cee, 0x00014eee, 0x00014fee, 0x000151ee,
+	0x000153ee, 0x000022ee, 0x000156ee, 0x000158ee, 0x00015aee, 0x00015bee, 0x00015dee, 0x000023ee,
+	0x000160ee, 0x000162ee, 0x000164ee, 0x000165ee, 0x000167ee, 0x000024ee, 0x00016bee, 0x00016cee,
+	0x00016eee, 0x000170ee, 0x000025ee, 0x000173ee, 0x000175ee, 0x000176ee, 0x000178ee, 0x00017aee,
+	0x000026ee, 0x00017dee, 0x00017fee, 0x000181ee, 0x000182ee, 0x000184ee, 0x000027ee, 0x000187ee,
+	0x000189ee, 0x00018bee, 0x00018cee, 0x00018eee, 0x000004ee, 0x000191ee, 0x000193ee, 0x000195ee,
+	0x000197ee, 0x000198ee, 0x000029ee, 0x00019cee, 0x00019dee, 0x00019fee, 0x0001a1ee, 0x0001a2ee,
+	0x00002aee, 0x0001a6ee, 0x0001a8ee, 0x0001a9ee, 0x0001abee, 0x0001adee, 0x00002bee, 0x0001b0ee,
+	0x0001b2ee, 0x0001b5ee, 0x00002cee, 0x0001bcee, 0x0001bfee, 0x00002dee, 0x0001c6ee, 0x0001c9ee,
+	0x00002eee, 0x0001d0ee, 0x0001d4ee, 0x00002fee, 0x0001daee, 0x0001deee, 0x000030ee, 0x0001e5ee,
+	0x0001e8ee, 0x000031ee, 0x0001efee, 0x0001f2ee, 0x000005ee, 0x0001f9ee, 0x0001fcee, 0x000033ee,
+	0x000203ee, 0x000034ee, 0x00020aee, 0x00020dee, 0x000035ee, 0x000214ee, 0x000217ee, 0x000036ee,
+	0x00021eee, 0x000221ee, 0x000037ee, 0x000228ee, 0x00022cee, 0x000038ee, 0x000232ee, 0x000236ee,
+	0x000039ee, 0x00023dee, 0x000240ee, 0x00003aee, 0x000247ee, 0x00024aee, 0x00003bee, 0x000251ee,
+	0x000254ee, 0x000006ee, 0x00025bee, 0x00025eee, 0x00003dee, 0x000265ee, 0x000269ee, 0x00003eee,
+	0x00026fee, 0x000273ee, 0x00003fee, 0x00027aee, 0x00027dee, 0x000040ee, 0x000284ee, 0x000287ee,
+	0x000041ee, 0x00028eee, 0x000291ee, 0x000042ee, 0x000298ee, 0x00029bee, 0x000043ee, 0x0002a2ee,
+	0x0002a6ee, 0x000044ee, 0x0002acee, 0x0002b0ee, 0x000045ee, 0x0002b7ee, 0x0002baee, 0x000007ee,
+	0x0002c1ee, 0x0002c4ee, 0x000047ee, 0x0002cbee, 0x0002ceee, 0x000048ee, 0x0002d5ee, 0x000049ee,
+	0x0002dcee, 0x0002dfee, 0x00004aee, 0x0002e6ee, 0x0002e9ee, 0x00004bee, 0x0002f0ee, 0x0002f4ee,
+	0x00004cee, 0x0002faee, 0x0002feee, 0x00004dee, 0x000304ee, 0x000308ee, 0x00004eee, 0x00030fee,
+	0x000312ee, 0x00004fee, 0x000319ee, 0x00031cee, 0x000008ee, 0x000323ee, 0x000326ee, 0x000051ee,
+	0x00032dee, 0x000331ee, 0x000052ee, 0x000337ee, 0x00033bee, 0x000053ee, 0x000341ee, 0x000345ee,
+	0x000054ee, 0x00034cee, 0x00034fee, 0x000055ee, 0x000356ee, 0x000359ee, 0x000056ee, 0x000360ee,
+	0x000057ee, 0x00036aee, 0x000058ee, 0x000059ee, 0x00037eee, 0x000009ee, 0x00005bee, 0x000393ee,
+	0x00005cee, 0x00005dee, 0x0003a7ee, 0x00005eee, 0x00005fee, 0x0003bbee, 0x000060ee, 0x000061ee,
+	0x0003d0ee, 0x000062ee, 0x000063ee, 0x0003e4ee, 0x000001ef, 0x000065ef, 0x0003f8ef, 0x000066ef,
+	0x000067ef, 0x000068ef, 0x000414ef, 0x000069ef, 0x00006aef, 0x000428ef, 0x00006bef, 0x00006cef,
+	0x00043cef, 0x00006def, 0x00000bef, 0x000451ef, 0x00006fef, 0x000070ef, 0x000465ef, 0x000071ef,
+	0x000072ef, 0x000479ef, 0x000073ef, 0x000074ef, 0x00048eef, 0x000075ef, 0x000076ef, 0x0004a2ef,
+	0x000077ef, 0x00000cef, 0x0004b6ef, 0x000079ef, 0x00007aef, 0x0004cbef, 0x00007bef, 0x00007cef,
+	0x00007def, 0x0004e6ef, 0x00007eef, 0x00007fef, 0x0004faef, 0x000080ef, 0x000081ef, 0x00050eef,
+	0x00000def, 0x000083ef, 0x000523ef, 0x000084ef, 0x000085ef, 0x000537ef, 0x000086ef, 0x000087ef,
+	0x00054bef, 0x000088ef, 0x000089ef, 0x000560ef, 0x00008aef, 0x00008bef, 0x000574ef, 0x00000eef,
+	0x00008def, 0x000588ef, 0x00008eef, 0x00008fef, 0x00059def, 0x000090ef, 0x000091ef, 0x000092ef,
+	0x0005b8ef, 0x000093ef, 0x000094ef, 0x0005ccef, 0x000095ef, 0x00000fef, 0x0005e0ef, 0x000097ef,
+	0x000098ef, 0x0005f5ef, 0x000099ef, 0x00009aef, 0x000609ef, 0x00009bef, 0x00009cef, 0x00061def,
+	0x00009def, 0x00009eef, 0x000632ef, 0x00009fef, 0x000010ef, 0x000646ef, 0x0000a1ef, 0x0000a2ef,
+	0x00065aef, 0x0000a3ef, 0x0000a4ef, 0x0000a5ef, 0x000675ef, 0x0000a6ef, 0x0000a7ef, 0x00068aef,
+	0x0000a8ef, 0x0000a9ef, 0x00069eef, 0x000011ef, 0x0000abef, 0x0006b2ef, 0x0000acef, 0x0000adef,
+	0x0000aeef, 0x0000afef, 0x0000b0ef, 0x0000b2ef, 0x0000b3ef, 0x000012ef, 0x0000b6ef, 0x0000b7ef,
+	0x0000b8ef, 0x0000baef, 0x0000bbef, 0x0000bcef, 0x000013ef, 0x0000bfef, 0x0000c0ef, 0x0000c2ef,
+	0x0000c3ef, 0x0000c5ef, 0x0000c6ef, 0x0000c7ef, 0x000002ef, 0x0000caef, 0x0000cbef, 0x0000cdef,
+	0x0000ceef, 0x0000cfef, 0x0000d1ef, 0x000015ef, 0x0000d3ef, 0x0000d5ef, 0x0000d6ef, 0x0000d7ef,
+	0x0000d9ef, 0x0000daef, 0x000016ef, 0x0000ddef, 0x0000deef, 0x0000e0ef, 0x0000e1ef, 0x0000e2ef,
+	0x0000e4ef, 0x0000e5ef, 0x000017ef, 0x0000e8ef, 0x0000e9ef, 0x0000eaef, 0x0000ecef, 0x0000edef,
+	0x0000efef, 0x000018ef, 0x0000f1ef, 0x0000f3ef, 0x0000f4ef, 0x0000f5ef, 0x0000f7ef, 0x0000f8ef,
+	0x000019ef, 0x0000fbef, 0x0000fcef, 0x0000fdef, 0x0000ffef, 0x000100ef, 0x000101ef, 0x000103ef,
+	0x00001aef, 0x000106ef, 0x000107ef, 0x000108ef, 0x00010aef, 0x00010bef, 0x00010cef, 0x00001bef,
+	0x00010fef, 0x000110ef, 0x000112ef, 0x000113ef, 0x000114ef, 0x000116ef, 0x000117ef, 0x00001cef,
+	0x00011aef, 0x00011bef, 0x00011def, 0x00011eef, 0x00011fef, 0x000121ef, 0x00001def, 0x000123ef,
+	0x000125ef, 0x000126ef, 0x000127ef, 0x000129ef, 0x00012aef, 0x000003ef, 0x00012def, 0x00012eef,
+	0x000130ef, 0x000131ef, 0x000132ef, 0x000134ef, 0x000135ef, 0x00001fef, 0x000138ef, 0x000139ef,
+	0x00013aef, 0x00013cef, 0x00013def, 0x00013eef, 0x000020ef, 0x000141ef, 0x000143ef, 0x000144ef,
+	0x000145ef, 0x000147ef, 0x000148ef, 0x000021ef, 0x00014bef, 0x00014cef, 0x00014def, 0x00014fef,
+	0x000150ef, 0x000151ef, 0x000153ef, 0x000022ef, 0x000156ef, 0x000157ef, 0x000158ef, 0x00015aef,
+	0x00015bef, 0x000023ef, 0x000160ef, 0x000163ef, 0x000166ef, 0x000024ef, 0x00016bef, 0x00016eef,
+	0x000171ef, 0x000025ef, 0x000176ef, 0x000179ef, 0x000026ef, 0x00017eef, 0x000181ef, 0x000184ef,
+	0x000027ef, 0x000189ef, 0x00018cef, 0x00018eef, 0x000004ef, 0x000194ef, 0x000197ef, 0x000029ef,
+	0x00019cef, 0x00019fef, 0x0001a1ef, 0x00002aef, 0x0001a7ef, 0x0001aaef, 0x0001acef, 0x00002bef,
+	0x0001b2ef, 0x0001b4ef, 0x00002cef, 0x0001baef, 0x0001bdef, 0x0001bfef, 0x00002def, 0x0001c5ef,
+	0x0001c7ef, 0x0001caef, 0x00002eef, 0x0001cfef, 0x0001d2ef, 0x00002fef, 0x0001d8ef, 0x0001daef,
+	0x0001ddef, 0x000030ef, 0x0001e2ef, 0x0001e5ef, 0x0001e8ef, 0x000031ef, 0x0001edef, 0x0001f0ef,
+	0x000005ef, 0x0001f5ef, 0x0001f8ef, 0x0001fbef, 0x000033ef, 0x000200ef, 0x000203ef, 0x000206ef,
+	0x000034ef, 0x00020bef, 0x00020eef, 0x000211ef, 0x000035ef, 0x000216ef, 0x000219ef, 0x000036ef,
+	0x00021eef, 0x000221ef, 0x000224ef, 0x000037ef, 0x000229ef, 0x00022cef, 0x00022eef, 0x000038ef,
+	0x000234ef, 0x000236ef, 0x000039ef, 0x00023cef, 0x00023fef, 0x000241ef, 0x00003aef, 0x000247ef,
+	0x000249ef, 0x00024cef, 0x00003bef, 0x000252ef, 0x000254ef, 0x000006ef, 0x00025aef, 0x00025cef,
+	0x00025fef, 0x00003def, 0x000265ef, 0x000267ef, 0x00026aef, 0x00003eef, 0x00026fef, 0x000272ef,
+	0x00003fef, 0x000278ef, 0x00027aef, 0x00027def, 0x000040ef, 0x000282ef, 0x000285ef, 0x000288ef,
+	0x000041ef, 0x00028def, 0x000290ef, 0x000042ef, 0x000295ef, 0x000298ef, 0x00029bef, 0x000043ef,
+	0x0002a0ef, 0x0002a3ef, 0x0002a6ef, 0x000044ef, 0x0002abef, 0x0002aeef, 0x0002b0ef, 0x000045ef,
+	0x0002b6ef, 0x000007ef, 0x0002c1ef, 0x000047ef, 0x0002ccef, 0x000048ef, 0x0002d6ef, 0x000049ef,
+	0x0002e1ef, 0x00004aef, 0x00004bef, 0x0002f2ef, 0x00004cef, 0x0002fcef, 0x00004def, 0x000307ef,
+	0x00004eef, 0x000312ef, 0x00004fef, 0x00031def, 0x000008ef, 0x000051ef, 0x00032def, 0x000052ef,
+	0x000338ef, 0x000053ef, 0x000343ef, 0x000054ef, 0x00034eef, 0x000055ef, 0x000359ef, 0x000056ef,
+	0x000057ef, 0x000369ef, 0x000058ef, 0x000374ef, 0x000059ef, 0x00037eef, 0x000009ef, 0x000389ef,
+	0x00005bef, 0x000394ef, 0x00005cef, 0x00039fef, 0x00005def, 0x00005eef, 0x0003afef, 0x00005fef,
+	0x0003baef, 0x000060ef, 0x0003c5ef, 0x000061ef, 0x0003d0ef, 0x000062ef, 0x0003dbef, 0x000063ef,
+	0x000001f0, 0x0003ebf0, 0x000065f0, 0x0003f6f0, 0x000066f0, 0x000401f0, 0x000067f0, 0x00040bf0,
+	0x000068f0, 0x000416f0, 0x000069f0, 0x000421f0, 0x00006af0, 0x00006bf0, 0x000431f0, 0x00006cf0,
+	0x00043cf0, 0x00006df0, 0x000447f0, 0x00000bf0, 0x000452f0, 0x00006ff0, 0x00045df0, 0x000070f0,
+	0x000071f0, 0x00046df0, 0x000072f0, 0x000478f0, 0x000073f0, 0x000483f0, 0x000074f0, 0x00048ef0,
+	0x000075f0, 0x000498f0, 0x000076f0, 0x0004a3f0, 0x000077f0, 0x00000cf0, 0x0004b3f0, 0x000079f0,
+	0x0004bef0, 0x00007af0, 0x0004c9f0, 0x00007bf0, 0x0004d4f0, 0x00007cf0, 0x0004dff0, 0x00007df0,
+	0x00007ef0, 0x0004eff0, 0x00007ff0, 0x0004faf0, 0x000080f0, 0x000505f0, 0x000081f0, 0x000510f0,
+	0x00000df0, 0x00051af0, 0x000083f0, 0x000084f0, 0x00052bf0, 0x000085f0, 0x000536f0, 0x000086f0,
+	0x000540f0, 0x000087f0, 0x00054bf0, 0x000088f0, 0x000556f0, 0x000089f0, 0x000561f0, 0x00008af0,
+	0x00008bf0, 0x00000ef0, 0x00008df0, 0x00008ef0, 0x00008ff0, 0x000090f0, 0x000091f0, 0x000092f0,
+	0x000093f0, 0x000095f0, 0x00000ff0, 0x000097f0, 0x000098f0, 0x000099f0, 0x00009af0, 0x00009bf0,
+	0x00009cf0, 0x00009df0, 0x00009ef0, 0x00009ff0, 0x000010f0, 0x0000a2f0, 0x0000a3f0, 0x0000a4f0,
+	0x0000a5f0, 0x0000a6f0, 0x0000a7f0, 0x0000a8f0, 0x0000a9f0, 0x000011f0, 0x0000abf0, 0x0000acf0,
+	0x0000adf0, 0x0000aff0, 0x0000b0f0, 0x0000b1f0, 0x0000b2f0, 0x0000b3f0, 0x000012f0, 0x0000b5f0,
+	0x0000b6f0, 0x0000b7f0, 0x0000b8f0, 0x0000b9f0, 0x0000baf0, 0x0000bcf0, 0x0000bdf0, 0x000013f0,
+	0x0000bff0, 0x0000c0f0, 0x0000c1f0, 0x0000c2f0, 0x0000c3f0, 0x0000c4f0, 0x0000c5f0, 0x0000c6f0,
+	0x000002f0, 0x0000c9f0, 0x0000caf0, 0x0000cbf0, 0x0000ccf0, 0x0000cdf0, 0x0000cef0, 0x0000cff0,
+	0x0000d0f0, 0x0000d1f0, 0x000015f0, 0x0000d3f0, 0x0000d5f0, 0x0000d6f0, 0x0000d7f0, 0x0000d8f0,
+	0x0000d9f0, 0x0000daf0, 0x0000dbf0, 0x000016f0, 0x0000ddf0, 0x0000def0, 0x0000dff0, 0x0000e0f0,
+	0x0000e2f0, 0x0000e3f0, 0x0000e4f0, 0x0000e5f0, 0x000017f0, 0x0000e7f0, 0x0000e8f0, 0x0000e9f0,
+	0x0000eaf0, 0x0000ebf0, 0x0000ecf0, 0x0000edf0, 0x0000eff0, 0x000018f0, 0x0000f1f0, 0x0000f2f0,
+	0x0000f3f0, 0x0000f4f0, 0x0000f5f0, 0x0000f6f0, 0x0000f7f0, 0x0000f8f0, 0x0000f9f0, 0x000019f0,
+	0x0000fcf0, 0x0000fdf0, 0x0000fef0, 0x0000fff0, 0x000100f0, 0x000101f0, 0x000102f0, 0x000103f0,
+	0x00001af0, 0x000105f0, 0x000106f0, 0x000107f0, 0x000109f0, 0x00010af0, 0x00010bf0, 0x00010cf0,
+	0x00010df0, 0x00001bf0, 0x00010ff0, 0x000110f0, 0x000111f0, 0x000112f0, 0x000113f0, 0x000114f0,
+	0x000116f0, 0x00001cf0, 0x00011af0, 0x00011cf0, 0x00011ef0, 0x000120f0, 0x00001df0, 0x000125f0,
+	0x000127f0, 0x000129f0, 0x000003f0, 0x00012df0, 0x000130f0, 0x000132f0, 0x000134f0, 0x00001ff0,
+	0x000138f0, 0x00013af0, 0x00013df0, 0x00013ff0, 0x000020f0, 0x000143f0, 0x000145f0, 0x000147f0,
+	0x000021f0, 0x00014cf0, 0x00014ef0, 0x000150f0, 0x000152f0, 0x000022f0, 0x000157f0, 0x000159f0,
+	0x00015bf0, 0x000023f0, 0x00015ff0, 0x000161f0, 0x000164f0, 0x000166f0, 0x000024f0, 0x00016af0,
+	0x00016cf0, 0x00016ef0, 0x000171f0, 0x000025f0, 0x000175f0, 0x000177f0, 0x000179f0, 0x000026f0,
+	0x00017ef0, 0x000180f0, 0x000182f0, 0x000184f0, 0x000027f0, 0x000188f0, 0x00018bf0, 0x00018df0,
+	0x000004f0, 0x000191f0, 0x000193f0, 0x000195f0, 0x000198f0, 0x000029f0, 0x00019cf0, 0x00019ef0,
+	0x0001a0f0, 0x0001a3f0, 0x00002af0, 0x0001a7f0, 0x0001a9f0, 0x0001abf0, 0x00002bf0, 0x0001b0f0,
+	0x0001b2f0, 0x0001b4f0, 0x0001b6f0, 0x00002cf0, 0x0001baf0, 0x0001bdf0, 0x0001bff0, 0x0001c1f0,
+	0x00002df0, 0x0001c5f0, 0x0001c7f0, 0x0001caf0, 0x00002ef0, 0x0001cef0, 0x0001d0f0, 0x0001d2f0,
+	0x0001d4f0, 0x00002ff0, 0x0001d9f0, 0x0001dbf0, 0x0001ddf0, 0x000030f0, 0x0001e1f0, 0x0001e4f0,
+	0x0001e6f0, 0x0001e8f0, 0x000031f0, 0x0001ecf0, 0x0001eef0, 0x0001f1f0, 0x0001f3f0, 0x000005f0,
+	0x0001f7f0, 0x0001f9f0, 0x0001fbf0, 0x000033f0, 0x000200f0, 0x000202f0, 0x000204f0, 0x000206f0,
+	0x000034f0, 0x00020bf0, 0x00020df0, 0x00020ff0, 0x000035f0, 0x000213f0, 0x000215f0, 0x000218f0,
+	0x00021af0, 0x000036f0, 0x00021ef0, 0x000220f0, 0x000222f0, 0x000225f0, 0x000037f0, 0x000229f0,
+	0x00022bf0, 0x000038f0, 0x000234f0, 0x000039f0, 0x00023cf0, 0x000241f0, 0x00003af0, 0x000249f0,
+	0x00003bf0, 0x000252f0, 0x000006f0, 0x00025bf0, 0x00025ff0, 0x00003df0, 0x000268f0, 0x00003ef0,
+	0x000271f0, 0x00003ff0, 0x000279f0, 0x00027ef0, 0x000040f0, 0x000286f0, 0x000041f0, 0x00028ff0,
+	0x000042f0, 0x000298f0, 0x000043f0, 0x0002a0f0, 0x0002a5f0, 0x000044f0, 0x0002adf0, 0x000045f0,
+	0x0002b6f0, 0x000007f0, 0x0002bff0, 0x0002c3f0, 0x000047f0, 0x0002ccf0, 0x000048f0, 0x0002d4f0,
+	0x000049f0, 0x0002ddf0, 0x0002e1f0, 0x00004af0, 0x0002eaf0, 0x00004bf0, 0x0002f3f0, 0x00004cf0,
+	0x0002fbf0, 0x000300f0, 0x00004df0, 0x000308f0, 0x00004ef0, 0x000311f0, 0x00004ff0, 0x00031af0,
+	0x000008f0, 0x000322f0, 0x000327f0, 0x000051f0, 0x00032ff0, 0x000052f0, 0x000338f0, 0x000053f0,
+	0x000341f0, 0x000345f0, 0x000054f0, 0x00034ef0, 0x000055f0, 0x000356f0, 0x000056f0, 0x00035ff0,
+	0x000363f0, 0x000057f0, 0x00036cf0, 0x000058f0, 0x000375f0, 0x000059f0, 0x00037df0, 0x000382f0,
+	0x000009f0, 0x00038af0, 0x00005bf0, 0x000393f0, 0x00005cf0, 0x00039cf0, 0x00005df0, 0x0003a4f0,
+	0x0003a9f0, 0x00005ef0, 0x0003b1f0, 0x00005ff0, 0x0003baf0, 0x000060f0, 0x0003c3f0, 0x0003c7f0,
+	0x000061f0, 0x0003d0f0, 0x000062f0, 0x0003d8f0, 0x000063f0, 0x0003e1f0, 0x0003e5f0, 0x000001f1,
+	0x0003eef1, 0x000065f1, 0x0003f7f1, 0x000066f1, 0x0003fff1, 0x000404f1, 0x000067f1, 0x00040cf1,
+	0x000068f1, 0x000415f1, 0x000069f1, 0x00041ef1, 0x00006af1, 0x000427f1, 0x00042bf1, 0x00006bf1,
+	0x000434f1, 0x00006cf1, 0x00043cf1, 0x00006df1, 0x000445f1, 0x000449f1, 0x00000bf1, 0x000452f1,
+	0x00006ff1, 0x000070f1, 0x000071f1, 0x000072f1, 0x000479f1, 0x000073f1, 0x000074f1, 0x000075f1,
+	0x000076f1, 0x000077f1, 0x00000cf1, 0x0004b6f1, 0x000079f1, 0x00007af1, 0x00007bf1, 0x00007cf1,
+	0x00007df1, 0x00007ef1, 0x00007ff1, 0x0004fbf1, 0x000080f1, 0x000081f1, 0x00000df1, 0x000083f1,
+	0x000084f1, 0x000085f1, 0x000086f1, 0x000540f1, 0x000087f1, 0x000088f1, 0x000089f1, 0x00008af1,
+	0x00008bf1, 0x00000ef1, 0x00057df1, 0x00008df1, 0x00008ef1, 0x00008ff1, 0x000090f1, 0x000091f1,
+	0x000092f1, 0x000093f1, 0x0005c3f1, 0x000094f1, 0x000095f1, 0x00000ff1, 0x000097f1, 0x000098f1,
+	0x000099f1, 0x0005fff1, 0x00009af1, 0x00009bf1, 0x00009cf1, 0x00009df1, 0x00009ef1, 0x00009ff1,
+	0x000010f1, 0x000645f1, 0x0000a1f1, 0x0000a2f1, 0x0000a3f1, 0x0000a4f1, 0x0000a5f1, 0x0000a6f1,
+	0x000681f1, 0x0000a7f1, 0x0000a8f1, 0x0000a9f1, 0x000011f1, 0x0000abf1, 0x0000acf1, 0x0000adf1,
+	0x0006c7f1, 0x0000aef1, 0x0000aff1, 0x0000b0f1, 0x0000b1f1, 0x0000b2f1, 0x0000b3f1, 0x000703f1,
+	0x000012f1, 0x0000b5f1, 0x0000b6f1, 0x0000b7f1, 0x0000b8f1, 0x0000b9f1, 0x0000baf1, 0x000749f1,
+	0x0000bbf1, 0x0000bcf1, 0x0000bdf1, 0x000013f1, 0x0000bff1, 0x0000c0f1, 0x000786f1, 0x0000c1f1,
+	0x0000c2f1, 0x0000c3f1, 0x0000c4f1, 0x0000c5f1, 0x0000c6f1, 0x0000c7f1, 0x0007cbf1, 0x000002f1,
+	0x0000c9f1, 0x0000caf1, 0x0000cbf1, 0x0000ccf1, 0x0000cdf1, 0x000808f1, 0x0000cef1, 0x0000cff1,
+	0x0000d0f1, 0x0000d1f1, 0x000015f1, 0x0000d3f1, 0x0000d4f1, 0x00084df1, 0x0000d5f1, 0x0000d6f1,
+	0x0000d7f1, 0x0000d8f1, 0x0000d9f1, 0x0000daf1, 0x0000dbf1, 0x000892f1, 0x000016f1, 0x0000ddf1,
+	0x0000def1, 0x0000e0f1, 0x0000e2f1, 0x0000e3f1, 0x0000e5f1, 0x000017f1, 0x0000e8f1, 0x0000eaf1,
+	0x0000ecf1, 0x0000eef1, 0x000018f1, 0x0000f1f1, 0x0000f3f1, 0x0000f5f1, 0x0000f6f1, 0x0000f8f1,
+	0x000019f1, 0x0000fcf1, 0x0000fdf1, 0x0000fff1, 0x000101f1, 0x000102f1, 0x00001af1, 0x000106f1,
+	0x000108f1, 0x000109f1, 0x00010bf1, 0x00010df1, 0x00001bf1, 0x000110f1, 0x000112f1, 0x000114f1,
+	0x000116f1, 0x00001cf1, 0x000119f1, 0x00011bf1, 0x00011cf1, 0x00011ef1, 0x000120f1, 0x00001df1,
+	0x000123f1, 0x000125f1, 0x000127f1, 0x000129f1, 0x00012af1, 0x000003f1, 0x00012ef1, 0x000130f1,
+	0x000131f1, 0x000133f1, 0x000135f1, 0x00001ff1, 0x000138f1, 0x00013af1, 0x00013cf1, 0x00013df1,
+	0x000020f1, 0x000141f1, 0x000143f1, 0x000144f1, 0x000146f1, 0x000148f1, 0x000021f1, 0x00014bf1,
+	0x00014df1, 0x00014ff1, 0x000151f1, 0x000152f1, 0x000022f1, 0x000156f1, 0x000157f1, 0x000159f1,
+	0x00015bf1, 0x00015df1, 0x000023f1, 0x000160f1, 0x000162f1, 0x000164f1, 0x000165f1, 0x000167f1,
+	0x000024f1, 0x00016bf1, 0x00016cf1, 0x00016ef1, 0x000170f1, 0x000025f1, 0x000173f1, 0x000175f1,
+	0x000177f1, 0x000178f1, 0x00017af1, 0x000026f1, 0x00017ef1, 0x00017ff1, 0x000181f1, 0x000183f1,
+	0x000185f1, 0x000027f1, 0x000188f1, 0x00018af1, 0x00018cf1, 0x00018df1, 0x00018ff1, 0x000004f1,
+	0x000192f1, 0x000194f1, 0x000196f1, 0x000198f1, 0x000029f1, 0x00019bf1, 0x00019df1, 0x00019ff1,
+	0x0001a0f1, 0x0001a2f1, 0x00002af1, 0x0001a6f1, 0x0001a7f1, 0x0001a9f1, 0x0001abf1, 0x0001acf1,
+	0x00002bf1, 0x0001b0f1, 0x0001b2f1, 0x0001b3f1, 0x0001b5f1, 0x0001b7f1, 0x00002cf1, 0x0001baf1,
+	0x0001bcf1, 0x0001c0f1, 0x00002df1, 0x0001c6f1, 0x0001caf1, 0x00002ef1, 0x0001d1f1, 0x00002ff1,
+	0x0001d8f1, 0x0001dbf1, 0x000030f1, 0x0001e2f1, 0x0001e6f1, 0x000031f1, 0x0001edf1, 0x0001f0f1,
+	0x000005f1, 0x0001f7f1, 0x0001fbf1, 0x000033f1, 0x000201f1, 0x000205f1, 0x000034f1, 0x00020cf1,
+	0x00020ff1, 0x000035f1, 0x000216f1, 0x00021af1, 0x000036f1, 0x000221f1, 0x000224f1, 0x000037f1,
+	0x00022bf1, 0x000038f1, 0x000232f1, 0x000236f1, 0x000039f1, 0x00023cf1, 0x000240f1, 0x00003af1,
+	0x000247f1, 0x00024af1, 0x00003bf1, 0x000251f1, 0x000255f1, 0x000006f1, 0x00025cf1, 0x00025ff1,
+	0x00003df1, 0x000266f1, 0x00026af1, 0x00003ef1, 0x000271f1, 0x000274f1, 0x00003ff1, 0x00027bf1,
+	0x000040f1, 0x000282f1, 0x000285f1, 0x000041f1, 0x00028cf1, 0x000290f1, 0x000042f1, 0x000297f1,
+	0x00029af1, 0x000043f1, 0x0002a1f1, 0x0002a5f1, 0x000044f1, 0x0002abf1, 0x0002aff1, 0x000045f1,
+	0x0002b6f1, 0x0002b9f1, 0x000007f1, 0x0002c0f1, 0x0002c4f1, 0x000047f1, 0x0002cbf1, 0x0002cef1,
+	0x000048f1, 0x0002d5f1, 0x000049f1, 0x0002dcf1, 0x0002e0f1, 0x00004af1, 0x0002e6f1, 0x0002eaf1,
+	0x00004bf1, 0x0002f1f1, 0x0002f4f1, 0x00004cf1, 0x0002fbf1, 0x0002fff1, 0x00004df1, 0x000306f1,
+	0x000309f1, 0x00004ef1, 0x000310f1, 0x000314f1, 0x00004ff1, 0x00031bf1, 0x00031ef1, 0x000008f1,
+	0x000325f1, 0x000051f1, 0x00032cf1, 0x00032ff1, 0x000052f1, 0x000336f1, 0x00033af1, 0x000053f1,
+	0x000341f1, 0x000344f1, 0x000054f1, 0x00034bf1, 0x00034ff1, 0x000055f1, 0x000355f1, 0x000359f1,
+	0x000056f1, 0x000360f1, 0x000363f1, 0x000057f1, 0x00036af1, 0x00036ef1, 0x000058f1, 0x000375f1,
+	0x000059f1, 0x00037ff1, 0x000009f1, 0x00005bf1, 0x000394f1, 0x00005cf1, 0x00005df1, 0x00005ef1,
+	0x0003b0f1, 0x00005ff1, 0x000060f1, 0x0003c5f1, 0x000061f1, 0x000062f1, 0x0003d9f1, 0x000063f1,
+	0x000001f2, 0x0003eef2, 0x000065f2, 0x000066f2, 0x000067f2, 0x00040af2, 0x000068f2, 0x000069f2,
+	0x00041ff2, 0x00006af2, 0x00006bf2, 0x000434f2, 0x00006cf2, 0x00006df2, 0x000448f2, 0x00000bf2,
+	0x00006ff2, 0x000070f2, 0x000464f2, 0x000071f2, 0x000072f2, 0x000479f2, 0x000073f2, 0x000074f2,
+	0x00048ef2, 0x000075f2, 0x000076f2, 0x000077f2, 0x0004a9f2, 0x00000cf2, 0x000079f2, 0x0004bef2,
+	0x00007af2, 0x00007bf2, 0x0004d3f2, 0x00007cf2, 0x00007df2, 0x0004e8f2, 0x00007ef2, 0x00007ff2,
+	0x000080f2, 0x000504f2, 0x000081f2, 0x00000df2, 0x000519f2, 0x000083f2, 0x000084f2, 0x00052df2,
+	0x000085f2, 0x000086f2, 0x000542f2, 0x000087f2, 0x000088f2, 0x000089f2, 0x00055ef2, 0x00008af2,
+	0x00008bf2, 0x000573f2, 0x00000ef2, 0x00008df2, 0x000588f2, 0x00008ef2, 0x00008ff2, 0x00059cf2,
+	0x000090f2, 0x000091f2, 0x000092f2, 0x0005b8f2, 0x000093f2, 0x000094f2, 0x0005cdf2, 0x000095f2,
+	0x00000ff2, 0x0005e2f2, 0x000097f2, 0x000098f2, 0x000099f2, 0x0005fdf2, 0x00009af2, 0x00009bf2,
+	0x000612f2, 0x00009cf2, 0x00009df2, 0x000627f2, 0x00009ef2, 0x00009ff2, 0x00063cf2, 0x000010f2,
+	0x0000a1f2, 0x0000a2f2, 0x000658f2, 0x0000a3f2, 0x0000a4f2, 0x00066df2, 0x0000a5f2, 0x0000a6f2,
+	0x000681f2, 0x0000a7f2, 0x0000a8f2, 0x000696f2, 0x0000a9f2, 0x000011f2, 0x0000abf2, 0x0006b2f2,
+	0x0000acf2, 0x0000adf2, 0x0006c7f2, 0x0000aef2, 0x0000aff2, 0x0006dcf2, 0x0000b0f2, 0x0000b1f2,
+	0x0000b2f2, 0x0000b3f2, 0x000012f2, 0x0000b6f2, 0x0000b7f2, 0x0000b9f2, 0x0000baf2, 0x0000bbf2,
+	0x0000bdf2, 0x000013f2, 0x0000c0f2, 0x0000c1f2, 0x0000c2f2, 0x0000c4f2, 0x0000c5f2, 0x0000c6f2,
+	0x000002f2, 0x0000c9f2, 0x0000cbf2, 0x0000ccf2, 0x0000cdf2, 0x0000cff2, 0x0000d0f2, 0x000015f2,
+	0x0000d3f2, 0x0000d4f2, 0x0000d6f2, 0x0000d7f2, 0x0000d8f2, 0x0000daf2, 0x0000dbf2, 0x000016f2,
+	0x0000def2, 0x0000dff2, 0x0000e1f2, 0x0000e2f2, 0x0000e4f2, 0x0000e5f2, 0x000017f2, 0x0000e8f2,
+	0x0000e9f2, 0x0000ebf2, 0x0000ecf2, 0x0000edf2, 0x0000eff2, 0x000018f2, 0x0000f1f2, 0x0000f3f2,
+	0x0000f4f2, 0x0000f6f2, 0x0000f7f2, 0x0000f8f2, 0x000019f2, 0x0000fbf2, 0x0000fdf2, 0x0000fef2,
+	0x0000fff2, 0x000101f2, 0x000102f2, 0x00001af2, 0x000105f2, 0x000106f2, 0x000108f2, 0x000109f2,
+	0x00010af2, 0x00010cf2, 0x00010df2, 0x00001bf2, 0x000110f2, 0x000111f2, 0x000113f2, 0x000114f2,
+	0x000116f2, 0x000117f2, 0x00001cf2, 0x00011af2, 0x00011bf2, 0x00011cf2, 0x00011ef2, 0x00011ff2,
+	0x000121f2, 0x00001df2, 0x000123f2, 0x000125f2, 0x000126f2, 0x000128f2, 0x000129f2, 0x00012af2,
+	0x000003f2, 0x00012df2, 0x00012ff2, 0x000130f2, 0x000131f2, 0x000133f2, 0x000134f2, 0x00001ff2,
+	0x000137f2, 0x000138f2, 0x00013af2, 0x00013bf2, 0x00013cf2, 0x00013ef2, 0x00013ff2, 0x000020f2,
+	0x000142f2, 0x000143f2, 0x000145f2, 0x000146f2, 0x000148f2, 0x000149f2, 0x000021f2, 0x00014cf2,
+	0x00014df2, 0x00014ef2, 0x000150f2, 0x000151f2, 0x000153f2, 0x000022f2, 0x000155f2, 0x000157f2,
+	0x000158f2, 0x00015af2, 0x00015bf2, 0x00015cf2, 0x000023f2, 0x00015ff2, 0x000160f2, 0x000162f2,
+	0x000163f2, 0x000166f2, 0x000024f2, 0x00016cf2, 0x00016ef2, 0x000025f2, 0x000174f2, 0x000177f2,
+	0x000179f2, 0x000026f2, 0x00017ff2, 0x000182f2, 0x000185f2, 0x000027f2, 0x00018af2, 0x00018df2,
+	0x000004f2, 0x000192f2, 0x000195f2, 0x000198f2, 0x000029f2, 0x00019ef2, 0x0001a0f2, 0x00002af2,
+	0x0001a6f2, 0x0001a9f2, 0x0001abf2, 0x00002bf2, 0x0001b1f2, 0x0001b4f2, 0x0001b7f2, 0x00002cf2,
+	0x0001bcf2, 0x0001bff2, 0x00002df2, 0x0001c4f2, 0x0001c7f2, 0x0001caf2, 0x00002ef2, 0x0001d0f2,
+	0x0001d2f2, 0x00002ff2, 0x0001d8f2, 0x0001dbf2, 0x0001ddf2, 0x000030f2, 0x0001e3f2, 0x0001e6f2,
+	0x0001e8f2, 0x000031f2, 0x0001eef2, 0x0001f1f2, 0x000005f2, 0x0001f6f2, 0x0001f9f2, 0x0001fcf2,
+	0x000033f2, 0x000201f2, 0x000204f2, 0x000034f2, 0x00020af2, 0x00020df2, 0x00020ff2, 0x000035f2,
+	0x000215f2, 0x000218f2, 0x00021af2, 0x000036f2, 0x000220f2, 0x000223f2, 0x000037f2, 0x000228f2,
+	0x00022bf2, 0x00022ef2, 0x000038f2, 0x000233f2, 0x000236f2, 0x000039f2, 0x00023cf2, 0x00023ff2,
+	0x000241f2, 0x00003af2, 0x000247f2, 0x00024af2, 0x00024cf2, 0x00003bf2, 0x000252f2, 0x000255f2,
+	0x000006f2, 0x00025af2, 0x00025df2, 0x000260f2, 0x00003df2, 0x000265f2, 0x000268f2, 0x00003ef2,
+	0x00026ef2, 0x000271f2, 0x000273f2, 0x00003ff2, 0x000279f2, 0x00027cf2, 0x00027ef2, 0x000040f2,
+	0x000284f2, 0x000287f2, 0x000041f2, 0x00028cf2, 0x00028ff2, 0x000292f2, 0x000042f2, 0x000297f2,
+	0x00029af2, 0x000043f2, 0x0002a0f2, 0x0002a2f2, 0x0002a5f2, 0x000044f2, 0x0002abf2, 0x0002aef2,
+	0x0002b0f2, 0x000045f2, 0x0002b6f2, 0x0002b9f2, 0x000007f2, 0x0002bef2, 0x0002c1f2, 0x0002c4f2,
+	0x000047f2, 0x0002ccf2, 0x000048f2, 0x0002d7f2, 0x000049f2, 0x00004af2, 0x0002e8f2, 0x00004bf2,
+	0x0002f3f2, 0x00004cf2, 0x0002fef2, 0x00004df2, 0x000309f2, 0x00004ef2, 0x00004ff2, 0x00031af2,
+	0x000008f2, 0x000325f2, 0x000051f2, 0x000330f2, 0x000052f2, 0x00033bf2, 0x000053f2, 0x000054f2,
+	0x00034cf2, 0x000055f2, 0x000357f2, 0x000056f2, 0x000362f2, 0x000057f2, 0x00036df2, 0x000058f2,
+	0x000059f2, 0x00037ef2, 0x000009f2, 0x000389f2, 0x00005bf2, 0x000394f2, 0x00005cf2, 0x00039ff2,
+	0x00005df2, 0x00005ef2, 0x0003b0f2, 0x00005ff2, 0x0003bbf2, 0x000060f2, 0x0003c6f2, 0x000061f2,
+	0x0003d1f2, 0x000062f2, 0x000063f2, 0x0003e2f2, 0x000001f3, 0x0003edf3, 0x000065f3, 0x0003f8f3,
+	0x000066f3, 0x000403f3, 0x000067f3, 0x000068f3, 0x000414f3, 0x000069f3, 0x00041ff3, 0x00006af3,
+	0x00042af3, 0x00006bf3, 0x000435f3, 0x00006cf3, 0x00006df3, 0x000446f3, 0x00000bf3, 0x000451f3,
+	0x00006ff3, 0x00045cf3, 0x000070f3, 0x000467f3, 0x000071f3, 0x000072f3, 0x000478f3, 0x000073f3,
+	0x000483f3, 0x000074f3, 0x00048ef3, 0x000075f3, 0x000499f3, 0x000076f3, 0x000077f3, 0x0004a9f3,
+	0x00000cf3, 0x0004b5f3, 0x000079f3, 0x0004c0f3, 0x00007af3, 0x0004cbf3, 0x00007bf3, 0x00007cf3,
+	0x0004dbf3, 0x00007df3, 0x0004e7f3, 0x00007ef3, 0x0004f2f3, 0x00007ff3, 0x0004fdf3, 0x000080f3,
+	0x000081f3, 0x00050df3, 0x00000df3, 0x000519f3, 0x000083f3, 0x000524f3, 0x000084f3, 0x00052ff3,
+	0x000085f3, 0x000086f3, 0x00053ff3, 0x000087f3, 0x00054af3, 0x000088f3, 0x000556f3, 0x000089f3,
+	0x000561f3, 0x00008af3, 0x00008bf3, 0x000571f3, 0x00000ef3, 0x00057cf3, 0x00008df3, 0x000588f3,
+	0x00008ef3, 0x00008ff3, 0x000090f3, 0x000091f3, 0x000093f3, 0x000094f3, 0x000095f3, 0x00000ff3,
+	0x000097f3, 0x000098f3, 0x000099f3, 0x00009af3, 0x00009bf3, 0x00009df3, 0x00009ef3, 0x00009ff3,
+	0x000010f3, 0x0000a1f3, 0x0000a2f3, 0x0000a3f3, 0x0000a4f3, 0x0000a5f3, 0x0000a7f3, 0x0000a8f3,
+	0x0000a9f3, 0x000011f3, 0x0000abf3, 0x0000acf3, 0x0000adf3, 0x0000aef3, 0x0000aff3, 0x0000b1f3,
+	0x0000b2f3, 0x0000b3f3, 0x000012f3, 0x0000b5f3, 0x0000b6f3, 0x0000b7f3, 0x0000b8f3, 0x0000b9f3,
+	0x0000bbf3, 0x0000bcf3, 0x0000bdf3, 0x000013f3, 0x0000bff3, 0x0000c0f3, 0x0000c1f3, 0x0000c2f3,
+	0x0000c3f3, 0x0000c5f3, 0x0000c6f3, 0x0000c7f3, 0x000002f3, 0x0000c9f3, 0x0000caf3, 0x0000cbf3,
+	0x0000ccf3, 0x0000cdf3, 0x0000cff3, 0x0000d0f3, 0x0000d1f3, 0x000015f3, 0x0000d3f3, 0x0000d4f3,
+	0x0000d5f3, 0x0000d6f3, 0x0000d7f3, 0x0000d8f3, 0x0000daf3, 0x0000dbf3, 0x000016f3, 0x0000ddf3,
+	0x0000def3, 0x0000dff3, 0x0000e0f3, 0x0000e1f3, 0x0000e2f3, 0x0000e4f3, 0x0000e5f3, 0x000017f3,
+	0x0000e7f3, 0x0000e8f3, 0x0000e9f3, 0x0000eaf3, 0x0000ebf3, 0x0000ecf3, 0x0000eef3, 0x0000eff3,
+	0x000018f3, 0x0000f1f3, 0x0000f2f3, 0x0000f3f3, 0x0000f4f3, 0x0000f5f3, 0x0000f6f3, 0x0000f8f3,
+	0x0000f9f3, 0x000019f3, 0x0000fbf3, 0x0000fcf3, 0x0000fdf3, 0x0000fef3, 0x0000fff3, 0x000100f3,
+	0x000102f3, 0x000103f3, 0x00001af3, 0x000105f3, 0x000106f3, 0x000107f3, 0x000108f3, 0x000109f3,
+	0x00010af3, 0x00010cf3, 0x00010df3, 0x00001bf3, 0x00010ff3, 0x000110f3, 0x000111f3, 0x000112f3,
+	0x000113f3, 0x000114f3, 0x000116f3, 0x000117f3, 0x00001cf3, 0x000119f3, 0x00011af3, 0x00011bf3,
+	0x00011cf3, 0x00011ef3, 0x000121f3, 0x00001df3, 0x000125f3, 0x000127f3, 0x00012af3, 0x000003f3,
+	0x00012ef3, 0x000130f3, 0x000132f3, 0x000135f3, 0x00001ff3, 0x000139f3, 0x00013bf3, 0x00013ef3,
+	0x000020f3, 0x000142f3, 0x000144f3, 0x000146f3, 0x000149f3, 0x000021f3, 0x00014df3, 0x00014ff3,
+	0x000152f3, 0x000022f3, 0x000156f3, 0x000158f3, 0x00015af3, 0x00015df3, 0x000023f3, 0x000161f3,
+	0x000163f3, 0x000165f3, 0x000024f3, 0x00016af3, 0x00016cf3, 0x00016ef3, 0x000171f3, 0x000025f3,
+	0x000175f3, 0x000177f3, 0x000179f3, 0x000026f3, 0x00017ef3, 0x000180f3, 0x000182f3, 0x000185f3,
+	0x000027f3, 0x000189f3, 0x00018bf3, 0x00018df3, 0x000004f3, 0x000192f3, 0x000194f3, 0x000196f3,
+	0x000199f3, 0x000029f3, 0x00019df3, 0x00019ff3, 0x0001a1f3, 0x00002af3, 0x0001a6f3, 0x0001a8f3,
+	0x0001aaf3, 0x0001adf3, 0x00002bf3, 0x0001b1f3, 0x0001b3f3, 0x0001b5f3, 0x00002cf3, 0x0001baf3,
+	0x0001bcf3, 0x0001bef3, 0x0001c1f3, 0x00002df3, 0x0001c5f3, 0x0001c7f3, 0x0001c9f3, 0x00002ef3,
+	0x0001cef3, 0x0001d0f3, 0x0001d2f3, 0x0001d5f3, 0x00002ff3, 0x0001d9f3, 0x0001dbf3, 0x0001ddf3,
+	0x000030f3, 0x0001e2f3, 0x0001e4f3, 0x0001e6f3, 0x0001e8f3, 0x000031f3, 0x0001edf3, 0x0001eff3,
+	0x0001f1f3, 0x000005f3, 0x0001f6f3, 0x0001f8f3, 0x0001faf3, 0x0001fcf3, 0x000033f3, 0x000201f3,
+	0x000203f3, 0x000205f3, 0x000034f3, 0x00020af3, 0x00020cf3, 0x00020ef3, 0x000210f3, 0x000035f3,
+	0x000215f3, 0x000217f3, 0x000219f3, 0x000036f3, 0x00021ef3, 0x000220f3, 0x000222f3, 0x000224f3,
+	0x000037f3, 0x000229f3, 0x00022bf3, 0x00022df3, 0x000038f3, 0x000232f3, 0x000234f3, 0x000236f3,
+	0x000039f3, 0x00023df3, 0x000241f3, 0x00003af3, 0x00024af3, 0x00003bf3, 0x000253f3, 0x000006f3,
+	0x00025cf3, 0x00003df3, 0x000265f3, 0x000269f3, 0x00003ef3, 0x000272f3, 0x00003ff3, 0x00027bf3,
+	0x000040f3, 0x000284f3, 0x000041f3, 0x00028df3, 0x000291f3, 0x000042f3, 0x00029af3, 0x000043f3,
+	0x0002a3f3, 0x000044f3, 0x0002acf3, 0x000045f3, 0x0002b5f3, 0x0002b9f3, 0x000007f3, 0x0002c2f3,
+	0x000047f3, 0x0002cbf3, 0x000048f3, 0x0002d4f3, 0x000049f3, 0x0002ddf3, 0x0002e1f3, 0x00004af3,
+	0x0002eaf3, 0x00004bf3, 0x0002f3f3, 0x00004cf3, 0x0002fcf3, 0x00004df3, 0x000305f3, 0x000309f3,
+	0x00004ef3, 0x000312f3, 0x00004ff3, 0x00031bf3, 0x000008f3, 0x000324f3, 0x000051f3, 0x00032df3,
+	0x000331f3, 0x000052f3, 0x00033af3, 0x000053f3, 0x000343f3, 0x000054f3, 0x00034cf3, 0x000055f3,
+	0x000355f3, 0x000359f3, 0x000056f3, 0x000362f3, 0x000057f3, 0x00036bf3, 0x000058f3, 0x000374f3,
+	0x000059f3, 0x00037df3, 0x000381f3, 0x000009f3, 0x00038af3, 0x00005bf3, 0x000393f3, 0x00005cf3,
+	0x00039cf3, 0x00005df3, 0x0003a5f3, 0x0003a9f3, 0x00005ef3, 0x0003b2f3, 0x00005ff3, 0x0003bbf3,
+	0x000060f3, 0x0003c4f3, 0x000061f3, 0x0003cdf3, 0x0003d1f3, 0x000062f3, 0x0003daf3, 0x000063f3,
+	0x0003e3f3, 0x000001f4, 0x0003ecf4, 0x000065f4, 0x0003f5f4, 0x0003f9f4, 0x000066f4, 0x000402f4,
+	0x000067f4, 0x00040bf4, 0x000068f4, 0x000414f4, 0x000069f4, 0x00041cf4, 0x000421f4, 0x00006af4,
+	0x00042af4, 0x00006bf4, 0x000433f4, 0x00006cf4, 0x00043cf4, 0x00006df4, 0x000444f4, 0x000449f4,
+	0x00000bf4, 0x000452f4, 0x00006ff4, 0x00045bf4, 0x000070f4, 0x000464f4, 0x000071f4, 0x00046cf4,
+	0x000072f4, 0x000073f4, 0x000483f4, 0x000074f4, 0x000075f4, 0x000076f4, 0x000077f4, 0x00000cf4,
+	0x000079f4, 0x00007af4, 0x00007bf4, 0x0004d3f4, 0x00007cf4, 0x00007df4, 0x00007ef4, 0x00007ff4,
+	0x000080f4, 0x000081f4, 0x00000df4, 0x000083f4, 0x000523f4, 0x000084f4, 0x000085f4, 0x000086f4,
+	0x000087f4, 0x000088f4, 0x000089f4, 0x00008af4, 0x00056af4, 0x00008bf4, 0x00000ef4, 0x00008df4,
+	0x00008ef4, 0x00008ff4, 0x000090f4, 0x000091f4, 0x000092f4, 0x0005b9f4, 0x000093f4, 0x000094f4,
+	0x000095f4, 0x00000ff4, 0x000097f4, 0x000098f4, 0x000099f4, 0x00009af4, 0x000609f4, 0x00009bf4,
+	0x00009cf4, 0x00009df4, 0x00009ef4, 0x00009ff4, 0x000010f4, 0x0000a1f4, 0x0000a2f4, 0x000659f4,
+	0x0000a3f4, 0x0000a4f4, 0x0000a5f4, 0x0000a6f4, 0x0000a7f4, 0x0000a8f4, 0x0000a9f4, 0x000011f4,
+	0x0006a9f4, 0x0000abf4, 0x0000acf4, 0x0000adf4, 0x0000aef4, 0x0000aff4, 0x0000b0f4, 0x0000b1f4,
+	0x0000b2f4, 0x0006f9f4, 0x0000b3f4, 0x000012f4, 0x0000b5f4, 0x0000b6f4, 0x0000b7f4, 0x0000b8f4,
+	0x0000b9f4, 0x0000baf4, 0x000749f4, 0x0000bbf4, 0x0000bcf4, 0x0000bdf4, 0x000013f4, 0x0000bff4,
+	0x0000c0f4, 0x0000c1f4, 0x0000c2f4, 0x000799f4, 0x0000c3f4, 0x0000c4f4, 0x0000c5f4, 0x0000c6f4,
+	0x0000c7f4, 0x000002f4, 0x0000c9f4, 0x0000caf4, 0x0007e9f4, 0x0000cbf4, 0x0000ccf4, 0x0000cdf4,
+	0x0000cef4, 0x0000cff4, 0x0000d0f4, 0x0000d1f4, 0x000015f4, 0x000839f4, 0x0000d3f4, 0x0000d4f4,
+	0x0000d5f4, 0x0000d6f4, 0x0000d7f4, 0x0000d8f4, 0x0000d9f4, 0x0000daf4, 0x000889f4, 0x0000dbf4,
+	0x000016f4, 0x0000ddf4, 0x0000def4, 0x0000dff4, 0x0000e0f4, 0x0000e1f4, 0x0000e2f4, 0x0008d9f4,
+	0x0000e3f4, 0x000017f4, 0x0000e7f4, 0x0000e9f4, 0x0000eaf4, 0x0000ecf4, 0x0000eef4, 0x000018f4,
+	0x0000f2f4, 0x0000f3f4, 0x0000f5f4, 0x0000f7f4, 0x0000f9f4, 0x000019f4, 0x0000fcf4, 0x0000fef4,
+	0x000100f4, 0x000102f4, 0x00001af4, 0x000105f4, 0x000107f4, 0x000109f4, 0x00010af4, 0x00010cf4,
+	0x00001bf4, 0x000110f4, 0x000112f4, 0x000113f4, 0x000115f4, 0x000117f4, 0x00001cf4, 0x00011af4,
+	0x00011cf4, 0x00011ef4, 0x000120f4, 0x00001df4, 0x000123f4, 0x000125f4, 0x000127f4, 0x000129f4,
+	0x00012af4, 0x000003f4, 0x00012ef4, 0x000130f4, 0x000132f4, 0x000133f4, 0x000135f4, 0x00001ff4,
+	0x000139f4, 0x00013af4, 0x00013cf4, 0x00013ef4, 0x000020f4, 0x000142f4, 0x000143f4, 0x000145f4,
+	0x000147f4, 0x000149f4, 0x000021f4, 0x00014cf4, 0x00014ef4, 0x000150f4, 0x000152f4, 0x000022f4,
+	0x000155f4, 0x000157f4, 0x000159f4, 0x00015af4, 0x00015cf4, 0x000023f4, 0x000160f4, 0x000161f4,
+	0x000163f4, 0x000165f4, 0x000167f4, 0x000024f4, 0x00016af4, 0x00016cf4, 0x00016ef4, 0x000170f4,
+	0x000025f4, 0x000173f4, 0x000175f4, 0x000177f4, 0x000179f4, 0x00017af4, 0x000026f4, 0x00017ef4,
+	0x000180f4, 0x000181f4, 0x000183f4, 0x000185f4, 0x000027f4, 0x000189f4, 0x00018af4, 0x00018cf4,
+	0x00018ef4, 0x000004f4, 0x000191f4, 0x000193f4, 0x000195f4, 0x000197f4, 0x000199f4, 0x000029f4,
+	0x00019cf4, 0x00019ef4, 0x0001a0f4, 0x0001a1f4, 0x00002af4, 0x0001a5f4, 0x0001a7f4, 0x0001a9f4,
+	0x0001aaf4, 0x0001acf4, 0x00002bf4, 0x0001b0f4, 0x0001b1f4, 0x0001b3f4, 0x0001b5f4, 0x0001b7f4,
+	0x00002cf4, 0x0001baf4, 0x0001bcf4, 0x0001bef4, 0x0001c0f4, 0x00002df4, 0x0001c3f4, 0x0001c5f4,
+	0x0001c7f4, 0x00002ef4, 0x0001cef4, 0x0001d1f4, 0x00002ff4, 0x0001d9f4, 0x0001dcf4, 0x000030f4,
+	0x0001e3f4, 0x0001e7f4, 0x000031f4, 0x0001eef4, 0x0001f1f4, 0x000005f4, 0x0001f8f4, 0x0001fcf4,
+	0x000033f4, 0x000203f4, 0x000034f4, 0x00020af4, 0x00020ef4, 0x000035f4, 0x000215f4, 0x000218f4,
+	0x000036f4, 0x000220f4, 0x000223f4, 0x000037f4, 0x00022af4, 0x00022ef4, 0x000038f4, 0x000235f4,
+	0x000039f4, 0x00023cf4, 0x000240f4, 0x00003af4, 0x000247f4, 0x00024af4, 0x00003bf4, 0x000251f4,
+	0x000255f4, 0x000006f4, 0x00025cf4, 0x000260f4, 0x00003df4, 0x000267f4, 0x00026af4, 0x00003ef4,
+	0x000271f4, 0x00003ff4, 0x000278f4, 0x00027cf4, 0x000040f4, 0x000283f4, 0x000287f4, 0x000041f4,
+	0x00028ef4, 0x000291f4, 0x000042f4, 0x000298f4, 0x00029cf4, 0x000043f4, 0x0002a3f4, 0x000044f4,
+	0x0002aaf4, 0x0002aef4, 0x000045f4, 0x0002b5f4, 0x0002b8f4, 0x000007f4, 0x0002bff4, 0x0002c3f4,
+	0x000047f4, 0x0002caf4, 0x0002cef4, 0x000048f4, 0x0002d5f4, 0x000049f4, 0x0002dcf4, 0x0002dff4,
+	0x00004af4, 0x0002e7f4, 0x0002eaf4, 0x00004bf4, 0x0002f1f4, 0x0002f5f4, 0x00004cf4, 0x0002fcf4,
+	0x0002fff4, 0x00004df4, 0x000306f4, 0x00030af4, 0x00004ef4, 0x000311f4, 0x00004ff4, 0x000318f4,
+	0x00031cf4, 0x000008f4, 0x000323f4, 0x000326f4, 0x000051f4, 0x00032ef4, 0x000331f4, 0x000052f4,
+	0x000338f4, 0x00033cf4, 0x000053f4, 0x000343f4, 0x000054f4, 0x00034af4, 0x00034ef4, 0x000055f4,
+	0x000355f4, 0x000358f4, 0x000056f4, 0x00035ff4, 0x000363f4, 0x000057f4, 0x00036af4, 0x00036ef4,
+	0x000058f4, 0x000375f4, 0x000378f4, 0x000059f4, 0x00037ff4, 0x000009f4, 0x000386f4, 0x00038af4,
+	0x00005bf4, 0x00005cf4, 0x00039cf4, 0x00005df4, 0x00005ef4, 0x0003b1f4, 0x00005ff4, 0x000060f4,
+	0x0003c6f4, 0x000061f4, 0x000062f4, 0x000063f4, 0x0003e3f4, 0x000001f5, 0x000065f5, 0x0003f8f5,
+	0x000066f5, 0x000067f5, 0x000068f5, 0x000414f5, 0x000069f5, 0x00006af5, 0x00042af5, 0x00006bf5,
+	0x00006cf5, 0x00006df5, 0x000446f5, 0x00000bf5, 0x00006ff5, 0x00045cf5, 0x000070f5, 0x000071f5,
+	0x000072f5, 0x000478f5, 0x000073f5, 0x000074f5, 0x00048df5, 0x000075f5, 0x000076f5, 0x000077f5,
+	0x0004aaf5, 0x00000cf5, 0x000079f5, 0x0004bff5, 0x00007af5, 0x00007bf5, 0x0004d4f5, 0x00007cf5,
+	0x00007df5, 0x00007ef5, 0x0004f1f5, 0x00007ff5, 0x000080f5, 0x000506f5, 0x000081f5, 0x00000df5,
+	0x000083f5, 0x000523f5, 0x000084f5, 0x000085f5, 0x000538f5, 0x000086f5, 0x000087f5, 0x000088f5,
+	0x000554f5, 0x000089f5, 0x00008af5, 0x00056af5, 0x00008bf5, 0x00000ef5, 0x00008df5, 0x000586f5,
+	0x00008ef5, 0x00008ff5, 0x00059bf5, 0x000090f5, 0x000091f5, 0x000092f5, 0x0005b8f5, 0x000093f5,
+	0x000094f5, 0x0005cdf5, 0x000095f5, 0x00000ff5, 0x0005e2f5, 0x000097f5, 0x000098f5, 0x000099f5,
+	0x0005fff5, 0x00009af5, 0x00009bf5, 0x000614f5, 0x00009cf5, 0x00009df5, 0x00009ef5, 0x000631f5,
+	0x00009ff5, 0x000010f5, 0x000646f5, 0x0000a1f5, 0x0000a2f5, 0x0000a3f5, 0x000662f5, 0x0000a4f5,
+	0x0000a5f5, 0x000678f5, 0x0000a6f5, 0x0000a7f5, 0x0000a8f5, 0x000694f5, 0x0000a9f5, 0x000011f5,
+	0x0006a9f5, 0x0000abf5, 0x0000acf5, 0x0000adf5, 0x0006c6f5, 0x0000aef5, 0x0000aff5, 0x0006dbf5,
+	0x0000b0f5, 0x0000b1f5, 0x0006f0f5, 0x0000b2f5, 0x0000b3f5, 0x000012f5, 0x00070df5, 0x0000b5f5,
+	0x0000b6f5, 0x0000b7f5, 0x0000b9f5, 0x0000baf5, 0x0000bcf5, 0x0000bdf5, 0x000013f5, 0x0000c0f5,
+	0x0000c1f5, 0x0000c3f5, 0x0000c4f5, 0x0000c6f5, 0x0000c7f5, 0x000002f5, 0x0000caf5, 0x0000cbf5,
+	0x0000cdf5, 0x0000cef5, 0x0000cff5, 0x0000d1f5, 0x000015f5, 0x0000d4f5, 0x0000d5f5, 0x0000d7f5,
+	0x0000d8f5, 0x0000d9f5, 0x0000dbf5, 0x000016f5, 0x0000def5, 0x0000dff5, 0x0000e1f5, 0x0000e2f5,
+	0x0000e3f5, 0x0000e5f5, 0x000017f5, 0x0000e8f5, 0x0000e9f5, 0x0000eaf5, 0x0000ecf5, 0x0000edf5,
+	0x0000eff5, 0x000018f5, 0x0000f2f5, 0x0000f3f5, 0x0000f4f5, 0x0000f6f5, 0x0000f7f5, 0x0000f9f5,
+	0x000019f5, 0x0000fcf5, 0x0000fdf5, 0x0000fef5, 0x000100f5, 0x000101f5, 0x000103f5, 0x00001af5,
+	0x000105f5, 0x000107f5, 0x000108f5, 0x00010af5, 0x00010bf5, 0x00010df5, 0x00001bf5, 0x00010ff5,
+	0x000111f5, 0x000112f5, 0x000114f5, 0x000115f5, 0x000117f5, 0x00001cf5, 0x000119f5, 0x00011bf5,
+	0x00011cf5, 0x00011ef5, 0x00011ff5, 0x000120f5, 0x00001df5, 0x000123f5, 0x000125f5, 0x000126f5,
+	0x000128f5, 0x000129f5, 0x00012af5, 0x000003f5, 0x00012df5, 0x00012ff5, 0x000130f5, 0x000132f5,
+	0x000133f5, 0x000134f5, 0x00001ff5, 0x000137f5, 0x000139f5, 0x00013af5, 0x00013bf5, 0x00013df5,
+	0x00013ef5, 0x000020f5, 0x000141f5, 0x000143f5, 0x000144f5, 0x000145f5, 0x000147f5, 0x000148f5,
+	0x000021f5, 0x00014bf5, 0x00014df5, 0x00014ef5, 0x00014ff5, 0x000151f5, 0x000152f5, 0x000022f5,
+	0x000155f5, 0x000156f5, 0x000158f5, 0x000159f5, 0x00015bf5, 0x00015cf5, 0x000023f5, 0x00015ff5,
+	0x000160f5, 0x000162f5, 0x000163f5, 0x000165f5, 0x000166f5, 0x000024f5, 0x000169f5, 0x00016af5,
+	0x00016cf5, 0x00016ff5, 0x000025f5, 0x000174f5, 0x000177f5, 0x00017af5, 0x000026f5, 0x000180f5,
+	0x000183f5, 0x000027f5, 0x000188f5, 0x00018bf5, 0x00018ef5, 0x000004f5, 0x000194f5, 0x000196f5,
+	0x000029f5, 0x00019cf5, 0x00019ff5, 0x0001a2f5, 0x00002af5, 0x0001a7f5, 0x0001aaf5, 0x00002bf5,
+	0x0001b0f5, 0x0001b3f5, 0x0001b6f5, 0x00002cf5, 0x0001bbf5, 0x0001bef5, 0x00002df5, 0x0001c4f5,
+	0x0001c7f5, 0x0001caf5, 0x00002ef5, 0x0001cff5, 0x0001d2f5, 0x00002ff5, 0x0001d8f5, 0x0001dbf5,
+	0x0001ddf5, 0x000030f5, 0x0001e3f5, 0x0001e6f5, 0x000031f5, 0x0001ecf5, 0x0001eff5, 0x0001f1f5,
+	0x000005f5, 0x0001f7f5, 0x0001faf5, 0x000033f5, 0x000200f5, 0x000202f5, 0x000205f5, 0x000034f5,
+	0x00020bf5, 0x00020ef5, 0x000035f5, 0x000213f5, 0x000216f5, 0x000219f5, 0x000036f5, 0x00021ff5,
+	0x000222f5, 0x000225f5, 0x000037f5, 0x00022af5, 0x00022df5, 0x000038f5, 0x000233f5, 0x000236f5,
+	0x000238f5, 0x000039f5, 0x00023ef5, 0x000241f5, 0x00003af5, 0x000247f5, 0x000249f5, 0x00024cf5,
+	0x00003bf5, 0x000252f5, 0x000255f5, 0x000006f5, 0x00025bf5, 0x00025df5, 0x000260f5, 0x00003df5,
+	0x000266f5, 0x000269f5, 0x00003ef5, 0x00026ef5, 0x000271f5, 0x000274f5, 0x00003ff5, 0x00027af5,
+	0x00027df5, 0x000040f5, 0x000282f5, 0x000285f5, 0x000288f5, 0x000041f5, 0x00028ef5, 0x000291f5,
+	0x000042f5, 0x000296f5, 0x000299f5, 0x00029cf5, 0x000043f5, 0x0002a2f5, 0x0002a4f5, 0x000044f5,
+	0x0002aaf5, 0x0002adf5, 0x0002b0f5, 0x000045f5, 0x0002b5f5, 0x0002b8f5, 0x000007f5, 0x0002bef5,
+	0x0002c1f5, 0x0002c4f5, 0x000047f5, 0x0002c9f5, 0x0002ccf5, 0x000048f5, 0x0002d2f5, 0x0002d5f5,
+	0x000049f5, 0x0002ddf5, 0x00004af5, 0x0002e9f5, 0x00004bf5, 0x0002f4f5, 0x00004cf5, 0x00004df5,
+	0x000305f5, 0x00004ef5, 0x000310f5, 0x00004ff5, 0x00031cf5, 0x000008f5, 0x000051f5, 0x00032df5,
+	0x000052f5, 0x000338f5, 0x000053f5, 0x000344f5, 0x000054f5, 0x00034ff5, 0x000055f5, 0x000056f5,
+	0x000360f5, 0x000057f5, 0x00036bf5, 0x000058f5, 0x000377f5, 0x000059f5, 0x000009f5, 0x000388f5,
+	0x00005bf5, 0x000393f5, 0x00005cf5, 0x00039ff5, 0x00005df5, 0x00005ef5, 0x0003b0f5, 0x00005ff5,
+	0x0003bbf5, 0x000060f5, 0x0003c6f5, 0x000061f5, 0x000062f5, 0x0003d7f5, 0x000063f5, 0x0003e3f5,
+	0x000001f6, 0x0003eef6, 0x000065f6, 0x000066f6, 0x0003fff6, 0x000067f6, 0x00040bf6, 0x000068f6,
+	0x000416f6, 0x000069f6, 0x00006af6, 0x000427f6, 0x00006bf6, 0x000432f6, 0x00006cf6, 0x00043ef6,
+	0x00006df6, 0x000449f6, 0x00000bf6, 0x00006ff6, 0x00045af6, 0x000070f6, 0x000465f6, 0x000071f6,
+	0x000471f6, 0x000072f6, 0x000073f6, 0x000482f6, 0x000074f6, 0x00048df6, 0x000075f6, 0x000499f6,
+	0x000076f6, 0x000077f6, 0x0004aaf6, 0x00000cf6, 0x0004b5f6, 0x000079f6, 0x0004c0f6, 0x00007af6,
+	0x00007bf6, 0x0004d2f6, 0x00007cf6, 0x0004ddf6, 0x00007df6, 0x0004e8f6, 0x00007ef6, 0x00007ff6,
+	0x0004f9f6, 0x000080f6, 0x000505f6, 0x000081f6, 0x000510f6, 0x00000df6, 0x000083f6, 0x000521f6,
+	0x000084f6, 0x00052cf6, 0x000085f6, 0x000538f6, 0x000086f6, 0x000087f6, 0x000549f6, 0x000088f6,
+	0x000554f6, 0x000089f6, 0x000560f6, 0x00008af6, 0x00056bf6, 0x00008bf6, 0x00000ef6, 0x00057cf6,
+	0x00008df6, 0x000587f6, 0x00008ef6, 0x000593f6, 0x00008ff6, 0x000090f6, 0x0005a4f6, 0x000091f6,
+	0x000092f6, 0x000093f6, 0x000094f6, 0x000095f6, 0x00000ff6, 0x000097f6, 0x000098f6, 0x000099f6,
+	0x00009bf6, 0x00009cf6, 0x00009df6, 0x00009ef6, 0x00009ff6, 0x000010f6, 0x0000a1f6, 0x0000a3f6,
+	0x0000a4f6, 0x0000a5f6, 0x0000a6f6, 0x0000a7f6, 0x0000a8f6, 0x0000a9f6, 0x000011f6, 0x0000acf6,
+	0x0000adf6, 0x0000aef6, 0x0000aff6, 0x0000b0f6, 0x0000b1f6, 0x0000b2f6, 0x000012f6, 0x0000b5f6,
+	0x0000b6f6, 0x0000b7f6, 0x0000b8f6, 0x0000b9f6, 0x0000baf6, 0x0000bcf6, 0x0000bdf6, 0x000013f6,
+	0x0000bff6, 0x0000c0f6, 0x0000c1f6, 0x0000c2f6, 0x0000c4f6, 0x0000c5f6, 0x0000c6f6, 0x0000c7f6,
+	0x000002f6, 0x0000c9f6, 0x0000caf6, 0x0000cbf6, 0x0000cdf6, 0x0000cef6, 0x0000cff6, 0x0000d0f6,
+	0x0000d1f6, 0x000015f6, 0x0000d3f6, 0x0000d5f6, 0x0000d6f6, 0x0000d7f6, 0x0000d8f6, 0x0000d9f6,
+	0x0000daf6, 0x0000dbf6, 0x000016f6, 0x0000def6, 0x0000dff6, 0x0000e0f6, 0x0000e1f6, 0x0000e2f6,
+	0x0000e3f6, 0x0000e5f6, 0x000017f6, 0x0000e7f6, 0x0000e8f6, 0x0000e9f6, 0x0000eaf6, 0x0000ebf6,
+	0x0000ecf6, 0x0000eef6, 0x0000eff6, 0x000018f6, 0x0000f1f6, 0x0000f2f6, 0x0000f3f6, 0x0000f4f6,
+	0x0000f6f6, 0x0000f7f6, 0x0000f8f6, 0x0000f9f6, 0x000019f6, 0x0000fbf6, 0x0000fcf6, 0x0000fef6,
+	0x0000fff6, 0x000100f6, 0x000101f6, 0x000102f6, 0x000103f6, 0x00001af6, 0x000105f6, 0x000107f6,
+	0x000108f6, 0x000109f6, 0x00010af6, 0x00010bf6, 0x00010cf6, 0x00001bf6, 0x00010ff6, 0x000110f6,
+	0x000111f6, 0x000112f6, 0x000113f6, 0x000114f6, 0x000115f6, 0x000117f6, 0x00001cf6, 0x000119f6,
+	0x00011af6, 0x00011bf6, 0x00011cf6, 0x00011df6, 0x00011ef6, 0x000120f6, 0x000121f6, 0x00001df6,
+	0x000123f6, 0x000125f6, 0x000128f6, 0x00012af6, 0x000003f6, 0x00012ef6, 0x000131f6, 0x000133f6,
+	0x00001ff6, 0x000138f6, 0x00013af6, 0x00013cf6, 0x00013ef6, 0x000020f6, 0x000143f6, 0x000145f6,
+	0x000147f6, 0x000021f6, 0x00014cf6, 0x00014ef6, 0x000151f6, 0x000153f6, 0x000022f6, 0x000157f6,
+	0x00015af6, 0x00015cf6, 0x000023f6, 0x000160f6, 0x000163f6, 0x000165f6, 0x000024f6, 0x00016af6,
+	0x00016cf6, 0x00016ef6, 0x000170f6, 0x000025f6, 0x000175f6, 0x000177f6, 0x000179f6, 0x000026f6,
+	0x00017ef6, 0x000180f6, 0x000183f6, 0x000185f6, 0x000027f6, 0x000189f6, 0x00018cf6, 0x00018ef6,
+	0x000004f6, 0x000192f6, 0x000195f6, 0x000197f6, 0x000029f6, 0x00019cf6, 0x00019ef6, 0x0001a0f6,
+	0x0001a2f6, 0x00002af6, 0x0001a7f6, 0x0001a9f6, 0x0001abf6, 0x00002bf6, 0x0001b0f6, 0x0001b2f6,
+	0x0001b5f6, 0x0001b7f6, 0x00002cf6, 0x0001bbf6, 0x0001bef6, 0x0001c0f6, 0x00002df6, 0x0001c4f6,
+	0x0001c7f6, 0x0001c9f6, 0x00002ef6, 0x0001cef6, 0x0001d0f6, 0x0001d2f6, 0x0001d4f6, 0x00002ff6,
+	0x0001d9f6, 0x0001dbf6, 0x0001ddf6, 0x000030f6, 0x0001e2f6, 0x0001e4f6, 0x0001e7f6, 0x0001e9f6,
+	0x000031f6, 0x0001edf6, 0x0001f0f6, 0x0001f2f6, 0x000005f6, 0x0001f6f6, 0x0001f9f6, 0x0001fbf6,
+	0x000033f6, 0x000200f6, 0x000202f6, 0x000204f6, 0x000206f6, 0x000034f6, 0x00020bf6, 0x00020df6,
+	0x000210f6, 0x000035f6, 0x000214f6, 0x000216f6, 0x000219f6, 0x000036f6, 0x00021df6, 0x00021ff6,
+	0x000222f6, 0x000224f6, 0x000037f6, 0x000229f6, 0x00022bf6, 0x00022df6, 0x000038f6, 0x000232f6,
+	0x000234f6, 0x000236f6, 0x000238f6, 0x000039f6, 0x00023df6, 0x00023ff6, 0x000242f6, 0x00003af6,
+	0x000246f6, 0x00024bf6, 0x00003bf6, 0x000254f6, 0x000006f6, 0x00025df6, 0x00003df6, 0x000266f6,
+	0x00003ef6, 0x00026ff6, 0x000274f6, 0x00003ff6, 0x00027df6, 0x000040f6, 0x000286f6, 0x000041f6,
+	0x00028ff6, 0x000042f6, 0x000298f6, 0x000043f6, 0x0002a1f6, 0x0002a6f6, 0x000044f6, 0x0002aff6,
+	0x000045f6, 0x0002b8f6, 0x000007f6, 0x0002c1f6, 0x000047f6, 0x0002caf6, 0x000048f6, 0x0002d3f6,
+	0x0002d8f6, 0x000049f6, 0x0002e1f6, 0x00004af6, 0x0002eaf6, 0x00004bf6, 0x0002f3f6, 0x00004cf6,
+	0x0002fcf6, 0x00004df6, 0x000305f6, 0x00030af6, 0x00004ef6, 0x000313f6, 0x00004ff6, 0x00031cf6,
+	0x000008f6, 0x000325f6, 0x000051f6, 0x00032ef6, 0x000052f6, 0x000337f6, 0x00033cf6, 0x000053f6,
+	0x000345f6, 0x000054f6, 0x00034ef6, 0x000055f6, 0x000357f6, 0x000056f6, 0x000360f6, 0x000057f6,
+	0x000369f6, 0x00036ef6, 0x000058f6, 0x000377f6, 0x000059f6, 0x000380f6, 0x000009f6, 0x000389f6,
+	0x00005bf6, 0x000392f6, 0x00005cf6, 0x00039bf6, 0x0003a0f6, 0x00005df6, 0x0003a9f6, 0x00005ef6,
+	0x0003b2f6, 0x00005ff6, 0x0003bbf6, 0x000060f6, 0x0003c4f6, 0x000061f6, 0x0003cdf6, 0x0003d2f6,
+	0x000062f6, 0x0003dbf6, 0x000063f6, 0x0003e4f6, 0x000001f7, 0x0003edf7, 0x000065f7, 0x0003f6f7,
+	0x000066f7, 0x0003fff7, 0x000067f7, 0x000408f7, 0x00040df7, 0x000068f7, 0x000416f7, 0x000069f7,
+	0x00041ff7, 0x00006af7, 0x000428f7, 0x00006bf7, 0x000431f7, 0x00006cf7, 0x00043af7, 0x00043ff7,
+	0x00006df7, 0x000448f7, 0x00000bf7, 0x000451f7, 0x00006ff7, 0x00045af7, 0x000070f7, 0x000463f7,
+	0x000071f7, 0x00046cf7, 0x000471f7, 0x000072f7, 0x00047af7, 0x000073f7, 0x000483f7, 0x000074f7,
+	0x00048cf7, 0x000075f7, 0x000076f7, 0x000077f7, 0x00000cf7, 0x000079f7, 0x00007af7, 0x00007bf7,
+	0x00007cf7, 0x00007df7, 0x0004e7f7, 0x00007ef7, 0x00007ff7, 0x000080f7, 0x000081f7, 0x00000df7,
+	0x000083f7, 0x000084f7, 0x000085f7, 0x000086f7, 0x000087f7, 0x00054bf7, 0x000088f7, 0x000089f7,
+	0x00008af7, 0x00008bf7, 0x00000ef7, 0x00008df7, 0x00008ef7, 0x00008ff7, 0x000090f7, 0x000091f7,
+	0x0005aff7, 0x000092f7, 0x000093f7, 0x000094f7, 0x000095f7, 0x00000ff7, 0x000097f7, 0x000098f7,
+	0x000099f7, 0x00009af7, 0x00009bf7, 0x000613f7, 0x00009cf7, 0x00009df7, 0x00009ef7, 0x00009ff7,
+	0x000010f7, 0x0000a1f7, 0x0000a2f7, 0x0000a3f7, 0x0000a4f7, 0x0000a5f7, 0x000677f7, 0x0000a6f7,
+	0x0000a7f7, 0x0000a8f7, 0x0000a9f7, 0x000011f7, 0x0000abf7, 0x0000acf7, 0x0000adf7, 0x0000aef7,
+	0x0000aff7, 0x0006dbf7, 0x0000b0f7, 0x0000b1f7, 0x0000b2f7, 0x0000b3f7, 0x000012f7, 0x0000b5f7,
+	0x0000b6f7, 0x0000b7f7, 0x0000b8f7, 0x0000b9f7, 0x00073ff7, 0x0000baf7, 0x0000bbf7, 0x0000bcf7,
+	0x0000bdf7, 0x000013f7, 0x0000bff7, 0x0000c0f7, 0x0000c1f7, 0x0000c2f7, 0x0000c3f7, 0x0007a3f7,
+	0x0000c4f7, 0x0000c5f7, 0x0000c6f7, 0x0000c7f7, 0x000002f7, 0x0000c9f7, 0x0000caf7, 0x0000cbf7,
+	0x0000ccf7, 0x0000cdf7, 0x0000cef7, 0x000811f7, 0x0000cff7, 0x0000d0f7, 0x0000d1f7, 0x000015f7,
+	0x0000d3f7, 0x0000d4f7, 0x0000d5f7, 0x0000d6f7, 0x0000d7f7, 0x0000d8f7, 0x000875f7, 0x0000d9f7,
+	0x0000daf7, 0x0000dbf7, 0x000016f7, 0x0000ddf7, 0x0000def7, 0x0000dff7, 0x0000e0f7, 0x0000e1f7,
+	0x0000e2f7, 0x0008d9f7, 0x0000e3f7, 0x0000e4f7, 0x0000e5f7, 0x000017f7, 0x0000e7f7, 0x0000e8f7,
+	0x0000e9f7, 0x0000ebf7, 0x0000ecf7, 0x0000eef7, 0x000018f7, 0x0000f2f7, 0x0000f4f7, 0x0000f6f7,
+	0x0000f7f7, 0x000019f7, 0x0000fbf7, 0x0000fdf7, 0x0000fff7, 0x000100f7, 0x000102f7, 0x00001af7,
+	0x000106f7, 0x000108f7, 0x00010af7, 0x00010bf7, 0x00001bf7, 0x00010ff7, 0x000111f7, 0x000113f7,
+	0x000114f7, 0x000116f7, 0x00001cf7, 0x00011af7, 0x00011cf7, 0x00011ef7, 0x00011ff7, 0x00001df7,
+	0x000123f7, 0x000125f7, 0x000127f7, 0x000128f7, 0x00012af7, 0x000003f7, 0x00012ef7, 0x000130f7,
+	0x000132f7, 0x000133f7, 0x00001ff7, 0x000137f7, 0x000139f7, 0x00013bf7, 0x00013df7, 0x00013ef7,
+	0x000020f7, 0x000142f7, 0x000144f7, 0x000146f7, 0x000147f7, 0x000021f7, 0x00014bf7, 0x00014df7,
+	0x00014ff7, 0x000151f7, 0x000152f7, 0x000022f7, 0x000156f7, 0x000158f7, 0x00015af7, 0x00015bf7,
+	0x000023f7, 0x00015ff7, 0x000161f7, 0x000163f7, 0x000165f7, 0x000166f7, 0x000024f7, 0x00016af7,
+	0x00016cf7, 0x00016ef7, 0x00016ff7, 0x000025f7, 0x000173f7, 0x000175f7, 0x000177f7, 0x000179f7,
+	0x00017af7, 0x000026f7, 0x00017ef7, 0x000180f7, 0x000182f7, 0x000183f7, 0x000027f7, 0x000187f7,
+	0x000189f7, 0x00018bf7, 0x00018df7, 0x00018ef7, 0x000004f7, 0x000192f7, 0x000194f7, 0x000196f7,
+	0x000197f7, 0x000029f7, 0x00019bf7, 0x00019df7, 0x00019ff7, 0x0001a1f7, 0x0001a2f7, 0x00002af7,
+	0x0001a6f7, 0x0001a8f7, 0x0001aaf7, 0x0001abf7, 0x00002bf7, 0x0001aff7, 0x0001b1f7, 0x0001b3f7,
+	0x0001b5f7, 0x0001b6f7, 0x00002cf7, 0x0001baf7, 0x0001bcf7, 0x0001bef7, 0x0001bff7, 0x00002df7,
+	0x0001c3f7, 0x0001c5f7, 0x0001c7f7, 0x0001c9f7, 0x0001caf7, 0x00002ef7, 0x0001cef7, 0x0001d0f7,
+	0x0001d2f7, 0x00002ff7, 0x0001d9f7, 0x0001ddf7, 0x000030f7, 0x0001e4f7, 0x0001e7f7, 0x000031f7,
+	0x0001eff7, 0x000005f7, 0x0001f6f7, 0x0001faf7, 0x000033f7, 0x000201f7, 0x000205f7, 0x000034f7,
+	0x00020cf7, 0x000210f7, 0x000035f7, 0x000217f7, 0x000036f7, 0x00021ef7, 0x000222f7, 0x000037f7,
+	0x000229f7, 0x00022df7, 0x000038f7, 0x000234f7, 0x000238f7, 0x000039f7, 0x00023ff7, 0x00003af7,
+	0x000246f7, 0x00024af7, 0x00003bf7, 0x000251f7, 0x000255f7, 0x000006f7, 0x00025cf7, 0x000260f7,
+	0x00003df7, 0x000267f7, 0x00003ef7, 0x00026ef7, 0x000272f7, 0x00003ff7, 0x000279f7, 0x00027df7,
+	0x000040f7, 0x000284f7, 0x000288f7, 0x000041f7, 0x00028ff7, 0x000042f7, 0x000296f7, 0x00029af7,
+	0x000043f7, 0x0002a1f7, 0x0002a5f7, 0x000044f7, 0x0002acf7, 0x0002b0f7, 0x000045f7, 0x0002b7f7,
+	0x000007f7, 0x0002bef7, 0x0002c2f7, 0x000047f7, 0x0002c9f7, 0x0002cdf7, 0x000048f7, 0x0002d4f7,
+	0x0002d8f7, 0x000049f7, 0x0002dff7, 0x00004af7, 0x0002e6f7, 0x0002eaf7, 0x00004bf7, 0x0002f1f7,
+	0x0002f5f7, 0x00004cf7, 0x0002fcf7, 0x000300f7, 0x00004df7, 0x000307f7, 0x00004ef7, 0x00030ef7,
+	0x000312f7, 0x00004ff7, 0x000319f7, 0x00031df7, 0x000008f7, 0x000324f7, 0x000328f7, 0x000051f7,
+	0x00032ff7, 0x000052f7, 0x000336f7, 0x00033af7, 0x000053f7, 0x000341f7, 0x000345f7, 0x000054f7,
+	0x00034cf7, 0x000350f7, 0x000055f7, 0x000357f7, 0x000056f7, 0x00035ef7, 0x000362f7, 0x000057f7,
+	0x000369f7, 0x00036df7, 0x000058f7, 0x000374f7, 0x000378f7, 0x000059f7, 0x00037ff7, 0x000009f7,
+	0x000386f7, 0x00038af7, 0x00005bf7, 0x000391f7, 0x000395f7, 0x00005cf7, 0x00039cf7, 0x0003a0f7,
+	0x00005df7, 0x00005ef7, 0x0003b2f7, 0x00005ff7, 0x000060f7, 0x000061f7, 0x0003cff7, 0x000062f7,
+	0x000063f7, 0x000001f8, 0x0003ecf8, 0x000065f8, 0x000066f8, 0x000402f8, 0x000067f8, 0x000068f8,
+	0x000069f8, 0x00041ff8, 0x00006af8, 0x00006bf8, 0x00006cf8, 0x00043cf8, 0x00006df8, 0x00000bf8,
+	0x000452f8, 0x00006ff8, 0x000070f8, 0x000071f8, 0x00046ff8, 0x000072f8, 0x000073f8, 0x000074f8,
+	0x00048cf8, 0x000075f8, 0x000076f8, 0x0004a2f8, 0x000077f8, 0x00000cf8, 0x000079f8, 0x0004bff8,
+	0x00007af8, 0x00007bf8, 0x00007cf8, 0x0004dcf8, 0x00007df8, 0x00007ef8, 0x0004f2f8, 0x00007ff8,
+	0x000080f8, 0x000081f8, 0x00050ff8, 0x00000df8, 0x000083f8, 0x000084f8, 0x00052cf8, 0x000085f8,
+	0x000086f8, 0x000542f8, 0x000087f8, 0x000088f8, 0x000089f8, 0x00055ff8, 0x00008af8, 0x00008bf8,
+	0x00000ef8, 0x00057cf8, 0x00008df8, 0x00008ef8, 0x000592f8, 0x00008ff8, 0x000090f8, 0x000091f8,
+	0x0005aff8, 0x000092f8, 0x000093f8, 0x000094f8, 0x0005ccf8, 0x000095f8, 0x00000ff8, 0x0005e2f8,
+	0x000097f8, 0x000098f8, 0x000099f8, 0x0005fff8, 0x00009af8, 0x00009bf8, 0x00009cf8, 0x00061cf8,
+	0x00009df8, 0x00009ef8, 0x000632f8, 0x00009ff8, 0x000010f8, 0x0000a1f8, 0x00064ff8, 0x0000a2f8,
+	0x0000a3f8, 0x0000a4f8, 0x00066cf8, 0x0000a5f8, 0x0000a6f8, 0x000682f8, 0x0000a7f8, 0x0000a8f8,
+	0x0000a9f8, 0x00069ff8, 0x000011f8, 0x0000abf8, 0x0000acf8, 0x0006bcf8, 0x0000adf8, 0x0000aef8,
+	0x0006d2f8, 0x0000aff8, 0x0000b0f8, 0x0000b1f8, 0x0006eff8, 0x0000b2f8, 0x0000b3f8, 0x000012f8,
+	0x00070cf8, 0x0000b5f8, 0x0000b6f8, 0x000722f8, 0x0000b7f8, 0x0000b8f8, 0x0000b9f8, 0x00073ff8,
+	0x0000baf8, 0x0000bcf8, 0x0000bdf8, 0x000013f8, 0x0000c0f8, 0x0000c2f8, 0x0000c3f8, 0x0000c4f8,
+	0x0000c6f8, 0x000002f8, 0x0000c9f8, 0x0000caf8, 0x0000ccf8, 0x0000cdf8, 0x0000cff8, 0x0000d0f8,
+	0x000015f8, 0x0000d3f8, 0x0000d4f8, 0x0000d6f8, 0x0000d7f8, 0x0000d9f8, 0x0000daf8, 0x000016f8,
+	0x0000ddf8, 0x0000dff8, 0x0000e0f8, 0x0000e2f8, 0x0000e3f8, 0x0000e4f8, 0x000017f8, 0x0000e7f8,
+	0x0000e9f8, 0x0000eaf8, 0x0000ecf8, 0x0000edf8, 0x0000eff8, 0x000018f8, 0x0000f2f8, 0x0000f3f8,
+	0x0000f4f8, 0x0000f6f8, 0x0000f7f8, 0x0000f9f8, 0x000019f8, 0x0000fcf8, 0x0000fdf8, 0x0000fff8,
+	0x000100f8, 0x000102f8, 0x000103f8, 0x00001af8, 0x000106f8, 0x000107f8, 0x000109f8, 0x00010af8,
+	0x00010cf8, 0x00010df8, 0x00001bf8, 0x000110f8, 0x000112f8, 0x000113f8, 0x000114f8, 0x000116f8,
+	0x00001cf8, 0x000119f8, 0x00011af8, 0x00011cf8, 0x00011df8, 0x00011ff8, 0x000120f8, 0x00001df8,
+	0x000123f8, 0x000124f8, 0x000126f8, 0x000127f8, 0x000129f8, 0x00012af8, 0x000003f8, 0x00012df8,
+	0x00012ff8, 0x000130f8, 0x000132f8, 0x000133f8, 0x000135f8, 0x00001ff8, 0x000137f8, 0x000139f8,
+	0x00013af8, 0x00013cf8, 0x00013df8, 0x00013ff8, 0x000020f8, 0x000142f8, 0x000143f8, 0x000145f8,
+	0x000146f8, 0x000147f8, 0x000149f8, 0x000021f8, 0x00014cf8, 0x00014df8, 0x00014ff8, 0x000150f8,
+	0x000152f8, 0x000153f8, 0x000022f8, 0x000156f8, 0x000157f8, 0x000159f8, 0x00015af8, 0x00015cf8,
+	0x00015df8, 0x000023f8, 0x000160f8, 0x000162f8, 0x000163f8, 0x000165f8, 0x000166f8, 0x000024f8,
+	0x000169f8, 0x00016af8, 0x00016cf8, 0x00016df8, 0x00016ff8, 0x000170f8, 0x000025f8, 0x000173f8,
+	0x000175f8, 0x000177f8, 0x00017af8, 0x000026f8, 0x000180f8, 0x000183f8, 0x000027f8, 0x000189f8,
+	0x00018cf8, 0x000004f8, 0x000192f8, 0x000195f8, 0x000197f8, 0x000029f8, 0x00019df8, 0x0001a0f8,
+	0x00002af8, 0x0001a6f8, 0x0001a9f8, 0x0001acf8, 0x00002bf8, 0x0001b2f8, 0x0001b5f8, 0x00002cf8,
+	0x0001baf8, 0x0001bdf8, 0x0001c0f8, 0x00002df8, 0x0001c6f8, 0x0001c9f8, 0x00002ef8, 0x0001cff8,
+	0x0001d2f8, 0x00002ff8, 0x0001d7f8, 0x0001daf8, 0x0001ddf8, 0x000030f8, 0x0001e3f8, 0x0001e6f8,
+	0x000031f8, 0x0001ecf8, 0x0001eff8, 0x0001f2f8, 0x000005f8, 0x0001f7f8, 0x0001faf8, 0x000033f8,
+	0x000200f8, 0x000203f8, 0x000206f8, 0x000034f8, 0x00020cf8, 0x00020ff8, 0x000035f8, 0x000215f8,
+	0x000218f8, 0x00021af8, 0x000036f8, 0x000220f8, 0x000223f8, 0x000037f8, 0x000229f8, 0x00022cf8,
+	0x000038f8, 0x000232f8, 0x000235f8, 0x000238f8, 0x000039f8, 0x00023df8, 0x000240f8, 0x00003af8,
+	0x000246f8, 0x000249f8, 0x00024cf8, 0x00003bf8, 0x000252f8, 0x000255f8, 0x000006f8, 0x00025af8,
+	0x00025df8, 0x000260f8, 0x00003df8, 0x000266f8, 0x000269f8, 0x00003ef8, 0x00026ff8, 0x000272f8,
+	0x00003ff8, 0x000278f8, 0x00027af8, 0x00027df8, 0x000040f8, 0x000283f8, 0x000286f8, 0x000041f8,
+	0x00028cf8, 0x00028ff8, 0x000292f8, 0x000042f8, 0x000298f8, 0x00029af8, 0x000043f8, 0x0002a0f8,
+	0x0002a3f8, 0x0002a6f8, 0x000044f8, 0x0002acf8, 0x0002aff8, 0x000045f8, 0x0002b5f8, 0x0002b8f8,
+	0x0002baf8, 0x000007f8, 0x0002c0f8, 0x0002c3f8, 0x000047f8, 0x0002c9f8, 0x0002ccf8, 0x000048f8,
+	0x0002d2f8, 0x0002d5f8, 0x0002d8f8, 0x000049f8, 0x0002ddf8, 0x0002e0f8, 0x00004af8, 0x0002e6f8,
+	0x0002e9f8, 0x00004bf8, 0x0002f5f8, 0x00004cf8, 0x00004df8, 0x000306f8, 0x00004ef8, 0x000312f8,
+	0x00004ff8, 0x000008f8, 0x000323f8, 0x000051f8, 0x00032ff8, 0x000052f8, 0x00033bf8, 0x000053f8,
+	0x000054f8, 0x00034cf8, 0x000055f8, 0x000358f8, 0x000056f8, 0x000057f8, 0x000369f8, 0x000058f8,
+	0x000375f8, 0x000059f8, 0x000380f8, 0x000009f8, 0x00005bf8, 0x000392f8, 0x00005cf8, 0x00039ef8,
+	0x00005df8, 0x00005ef8, 0x0003aff8, 0x00005ff8, 0x0003bbf8, 0x000060f8, 0x0003c6f8, 0x000061f8,
+	0x000062f8, 0x0003d8f8, 0x000063f8, 0x0003e3f8, 0x000001f9, 0x0003eff9, 0x000065f9, 0x000066f9,
+	0x000400f9, 0x000067f9, 0x00040cf9, 0x000068f9, 0x000069f9, 0x00041ef9, 0x00006af9, 0x000429f9,
+	0x00006bf9, 0x000435f9, 0x00006cf9, 0x00006df9, 0x000446f9, 0x00000bf9, 0x000452f9, 0x00006ff9,
+	0x000070f9, 0x000463f9, 0x000071f9, 0x00046ff9, 0x000072f9, 0x00047bf9, 0x000073f9, 0x000074f9,
+	0x00048cf9, 0x000075f9, 0x000498f9, 0x000076f9, 0x000077f9, 0x0004a9f9, 0x00000cf9, 0x0004b5f9,
+	0x000079f9, 0x0004c1f9, 0x00007af9, 0x00007bf9, 0x0004d2f9, 0x00007cf9, 0x0004def9, 0x00007df9,
+	0x00007ef9, 0x0004eff9, 0x00007ff9, 0x0004fbf9, 0x000080f9, 0x000506f9, 0x000081f9, 0x00000df9,
+	0x000518f9, 0x000083f9, 0x000523f9, 0x000084f9, 0x000085f9, 0x000535f9, 0x000086f9, 0x000541f9,
+	0x000087f9, 0x00054cf9, 0x000088f9, 0x000089f9, 0x00055ef9, 0x00008af9, 0x000569f9, 0x00008bf9,
+	0x000575f9, 0x00000ef9, 0x00008df9, 0x000586f9, 0x00008ef9, 0x000592f9, 0x00008ff9, 0x000090f9,
+	0x0005a4f9, 0x000091f9, 0x0005aff9, 0x000092f9, 0x0005bbf9, 0x000093f9, 0x000094f9, 0x0005ccf9,
+	0x000095f9, 0x00000ff9, 0x000097f9, 0x000099f9, 0x00009af9, 0x00009bf9, 0x00009cf9, 0x00009df9,
+	0x00009ef9, 0x000010f9, 0x0000a1f9, 0x0000a2f9, 0x0000a3f9, 0x0000a4f9, 0x0000a5f9, 0x0000a6f9,
+	0x0000a8f9, 0x0000a9f9, 0x000011f9, 0x0000abf9, 0x0000acf9, 0x0000adf9, 0x0000aff9, 0x0000b0f9,
+	0x0000b1f9, 0x0000b2f9, 0x0000b3f9, 0x000012f9, 0x0000b6f9, 0x0000b7f9, 0x0000b8f9, 0x0000b9f9,
+	0x0000baf9, 0x0000bbf9, 0x0000bdf9, 0x000013f9, 0x0000bff9, 0x0000c0f9, 0x0000c1f9, 0x0000c2f9,
+	0x0000c4f9, 0x0000c5f9, 0x0000c6f9, 0x0000c7f9, 0x000002f9, 0x0000c9f9, 0x0000cbf9, 0x0000ccf9,
+	0x0000cdf9, 0x0000cef9, 0x0000cff9, 0x0000d0f9, 0x000015f9, 0x0000d3f9, 0x0000d4f9, 0x0000d5f9,
+	0x0000d6f9, 0x0000d7f9, 0x0000d9f9, 0x0000daf9, 0x0000dbf9, 0x000016f9, 0x0000ddf9, 0x0000def9,
+	0x0000e0f9, 0x0000e1f9, 0x0000e2f9, 0x0000e3f9, 0x0000e4f9, 0x0000e5f9, 0x000017f9, 0x0000e8f9,
+	0x0000e9f9, 0x0000eaf9, 0x0000ebf9, 0x0000ecf9, 0x0000edf9, 0x0000eff9, 0x000018f9, 0x0000f1f9,
+	0x0000f2f9, 0x0000f3f9, 0x0000f4f9, 0x0000f6f9, 0x0000f7f9, 0x0000f8f9, 0x0000f9f9, 0x000019f9,
+	0x0000fbf9, 0x0000fdf9, 0x0000fef9, 0x0000fff9, 0x000100f9, 0x000101f9, 0x000102f9, 0x00001af9,
+	0x000105f9, 0x000106f9, 0x000107f9, 0x000108f9, 0x000109f9, 0x00010bf9, 0x00010cf9, 0x00010df9,
+	0x00001bf9, 0x00010ff9, 0x000110f9, 0x000112f9, 0x000113f9, 0x000114f9, 0x000115f9, 0x000116f9,
+	0x000117f9, 0x00001cf9, 0x00011af9, 0x00011bf9, 0x00011cf9, 0x00011df9, 0x00011ef9, 0x000120f9,
+	0x000121f9, 0x00001df9, 0x000123f9, 0x000124f9, 0x000125f9, 0x000127f9, 0x000128f9, 0x000129f9,
+	0x00012af9, 0x000003f9, 0x00012ff9, 0x000131f9, 0x000133f9, 0x00001ff9, 0x000138f9, 0x00013af9,
+	0x00013df9, 0x000020f9, 0x000141f9, 0x000144f9, 0x000146f9, 0x000148f9, 0x000021f9, 0x00014df9,
+	0x00014ff9, 0x000152f9, 0x000022f9, 0x000156f9, 0x000159f9, 0x00015bf9, 0x000023f9, 0x000160f9,
+	0x000162f9, 0x000164f9, 0x000167f9, 0x000024f9, 0x00016bf9, 0x00016ef9, 0x000170f9, 0x000025f9,
+	0x000175f9, 0x000177f9, 0x000179f9, 0x000026f9, 0x00017ef9, 0x000180f9, 0x000182f9, 0x000185f9,
+	0x000027f9, 0x000189f9, 0x00018cf9, 0x00018ef9, 0x000004f9, 0x000193f9, 0x000195f9, 0x000197f9,
+	0x000029f9, 0x00019cf9, 0x00019ef9, 0x0001a1f9, 0x00002af9, 0x0001a5f9, 0x0001a8f9, 0x0001aaf9,
+	0x0001acf9, 0x00002bf9, 0x0001b1f9, 0x0001b3f9, 0x0001b6f9, 0x00002cf9, 0x0001baf9, 0x0001bdf9,
+	0x0001bff9, 0x00002df9, 0x0001c4f9, 0x0001c6f9, 0x0001c8f9, 0x0001cbf9, 0x00002ef9, 0x0001cff9,
+	0x0001d2f9, 0x0001d4f9, 0x00002ff9, 0x0001d9f9, 0x0001dbf9, 0x0001ddf9, 0x000030f9, 0x0001e2f9,
+	0x0001e4f9, 0x0001e7f9, 0x000031f9, 0x0001ebf9, 0x0001eef9, 0x0001f0f9, 0x0001f2f9, 0x000005f9,
+	0x0001f7f9, 0x0001f9f9, 0x0001fcf9, 0x000033f9, 0x000200f9, 0x000203f9, 0x000205f9, 0x000034f9,
+	0x00020af9, 0x00020cf9, 0x00020ef9, 0x000211f9, 0x000035f9, 0x000215f9, 0x000218f9, 0x00021af9,
+	0x000036f9, 0x00021ef9, 0x000221f9, 0x000223f9, 0x000037f9, 0x000228f9, 0x00022af9, 0x00022cf9,
+	0x00022ff9, 0x000038f9, 0x000233f9, 0x000236f9, 0x000238f9, 0x000039f9, 0x00023df9, 0x00023ff9,
+	0x000241f9, 0x00003af9, 0x000246f9, 0x000248f9, 0x00024bf9, 0x00003bf9, 0x00024ff9, 0x000252f9,
+	0x000254f9, 0x000006f9, 0x00025df9, 0x00003df9, 0x000267f9, 0x00003ef9, 0x000270f9, 0x00003ff9,
+	0x000279f9, 0x000040f9, 0x000283f9, 0x000287f9, 0x000041f9, 0x000291f9, 0x000042f9, 0x00029af9,
+	0x000043f9, 0x0002a3f9, 0x000044f9, 0x0002adf9, 0x000045f9, 0x0002b6f9, 0x000007f9, 0x0002bff9,
+	0x000047f9, 0x0002c8f9, 0x0002cdf9, 0x000048f9, 0x0002d6f9, 0x000049f9, 0x0002e0f9, 0x00004af9,
+	0x0002e9f9, 0x00004bf9, 0x0002f2f9, 0x00004cf9, 0x0002fcf9, 0x00004df9, 0x000305f9, 0x00030af9,
+	0x00004ef9, 0x000313f9, 0x00004ff9, 0x00031cf9, 0x000008f9, 0x000326f9, 0x000051f9, 0x00032ff9,
+	0x000052f9, 0x000338f9, 0x000053f9, 0x000342f9, 0x000054f9, 0x00034bf9, 0x000350f9, 0x000055f9,
+	0x000359f9, 0x000056f9, 0x000362f9, 0x000057f9, 0x00036bf9, 0x000058f9, 0x000375f9, 0x000059f9,
+	0x00037ef9, 0x000009f9, 0x000387f9, 0x00005bf9, 0x000391f9, 0x000395f9, 0x00005cf9, 0x00039ff9,
+	0x00005df9, 0x0003a8f9, 0x00005ef9, 0x0003b1f9, 0x00005ff9, 0x0003bbf9, 0x000060f9, 0x0003c4f9,
+	0x000061f9, 0x0003cdf9, 0x000062f9, 0x0003d7f9, 0x0003dbf9, 0x000063f9, 0x0003e5f9, 0x000001fa,
+	0x0003eefa, 0x000065fa, 0x0003f7fa, 0x000066fa, 0x000400fa, 0x000067fa, 0x00040afa, 0x000068fa,
+	0x000413fa, 0x000069fa, 0x00041cfa, 0x000421fa, 0x00006afa, 0x00042afa, 0x00006bfa, 0x000434fa,
+	0x00006cfa, 0x00043dfa, 0x00006dfa, 0x000446fa, 0x00000bfa, 0x000450fa, 0x00006ffa, 0x000459fa,
+	0x00045efa, 0x000070fa, 0x000467fa, 0x000071fa, 0x000470fa, 0x000072fa, 0x00047afa, 0x000073fa,
+	0x000483fa, 0x000074fa, 0x00048cfa, 0x000075fa, 0x000495fa, 0x000076fa, 0x00049ffa, 0x0004a3fa,
+	0x000077fa, 0x00000cfa, 0x000079fa, 0x00007afa, 0x00007bfa, 0x00007cfa, 0x00007dfa, 0x00007efa,
+	0x00007ffa, 0x000080fa, 0x000505fa, 0x000081fa, 0x00000dfa, 0x000083fa, 0x000084fa, 0x000085fa,
+	0x000086fa, 0x000087fa, 0x000088fa, 0x000089fa, 0x00008afa, 0x00008bfa, 0x00000efa, 0x00008dfa,
+	0x00008efa, 0x000591fa, 0x00008ffa, 0x000090fa, 0x000091fa, 0x000092fa, 0x000093fa, 0x000094fa,
+	0x000095fa, 0x00000ffa, 0x000097fa, 0x000098fa, 0x000099fa, 0x00009afa, 0x00009bfa, 0x000613fa,
+	0x00009cfa, 0x00009dfa, 0x00009efa, 0x00009ffa, 0x000010fa, 0x0000a1fa, 0x0000a2fa, 0x0000a3fa,
+	0x0000a4fa, 0x0000a5fa, 0x0000a6fa, 0x0000a7fa, 0x0000a8fa, 0x0000a9fa, 0x00069ffa, 0x000011fa,
+	0x0000abfa, 0x0000acfa, 0x0000adfa, 0x0000aefa, 0x0000affa, 0x0000b0fa, 0x0000b1fa, 0x0000b2fa,
+	0x0000b3fa, 0x000012fa, 0x0000b5fa, 0x0000b6fa, 0x0000b7fa, 0x00072bfa, 0x0000b8fa, 0x0000b9fa,
+	0x0000bafa, 0x0000bbfa, 0x0000bcfa, 0x0000bdfa, 0x000013fa, 0x0000bffa, 0x0000c0fa, 0x0000c1fa,
+	0x0000c2fa, 0x0000c3fa, 0x0000c4fa, 0x0007adfa, 0x0000c5fa, 0x0000c6fa, 0x0000c7fa, 0x000002fa,
+	0x0000c9fa, 0x0000cafa, 0x0000cbfa, 0x0000ccfa, 0x0000cdfa, 0x0000cefa, 0x0000cffa, 0x0000d0fa,
+	0x0000d1fa, 0x000015fa, 0x000839fa, 0x0000d3fa, 0x0000d4fa, 0x0000d5fa, 0x0000d6fa, 0x0000d7fa,
+	0x0000d8fa, 0x0000d9fa, 0x0000dafa, 0x0000dbfa, 0x000016fa, 0x0000ddfa, 0x0000defa, 0x0000dffa,
+	0x0008bbfa, 0x0000e0fa, 0x0000e1fa, 0x0000e2fa, 0x0000e3fa, 0x0000e4fa, 0x0000e5fa, 0x000017fa,
+	0x0000e7fa, 0x0000e8fa, 0x0000e9fa, 0x0000eafa, 0x0000ebfa, 0x0000ecfa, 0x0000edfa, 0x000947fa,
+	0x0000eefa, 0x000018fa, 0x0000f2fa, 0x0000f4fa, 0x0000f6fa, 0x0000f8fa, 0x000019fa, 0x0000fbfa,
+	0x0000fdfa, 0x0000fffa, 0x000101fa, 0x000103fa, 0x00001afa, 0x000107fa, 0x000108fa, 0x00010afa,
+	0x00010cfa, 0x00001bfa, 0x000110fa, 0x000112fa, 0x000114fa, 0x000116fa, 0x00001cfa, 0x000119fa,
+	0x00011bfa, 0x00011dfa, 0x00011ffa, 0x000121fa, 0x00001dfa, 0x000124fa, 0x000126fa, 0x000128fa,
+	0x00012afa, 0x000003fa, 0x00012efa, 0x000130fa, 0x000131fa, 0x000133fa, 0x00001ffa, 0x000137fa,
+	0x000139fa, 0x00013bfa, 0x00013dfa, 0x00013ffa, 0x000020fa, 0x000142fa, 0x000144fa, 0x000146fa,
+	0x000148fa, 0x000021fa, 0x00014cfa, 0x00014dfa, 0x00014ffa, 0x000151fa, 0x000153fa, 0x000022fa,
+	0x000157fa, 0x000159fa, 0x00015afa, 0x00015cfa, 0x000023fa, 0x000160fa, 0x000162fa, 0x000164fa,
+	0x000166fa, 0x000024fa, 0x000169fa, 0x00016bfa, 0x00016dfa, 0x00016ffa, 0x000171fa, 0x000025fa,
+	0x000175fa, 0x000176fa, 0x000178fa, 0x00017afa, 0x000026fa, 0x00017efa, 0x000180fa, 0x000182fa,
+	0x000183fa, 0x000027fa, 0x000187fa, 0x000189fa, 0x00018bfa, 0x00018dfa, 0x00018ffa, 0x000004fa,
+	0x000192fa, 0x000194fa, 0x000196fa, 0x000198fa, 0x000029fa, 0x00019cfa, 0x00019efa, 0x00019ffa,
+	0x0001a1fa, 0x00002afa, 0x0001a5fa, 0x0001a7fa, 0x0001a9fa, 0x0001abfa, 0x0001acfa, 0x00002bfa,
+	0x0001b0fa, 0x0001b2fa, 0x0001b4fa, 0x0001b6fa, 0x00002cfa, 0x0001b9fa, 0x0001bbfa, 0x0001bdfa,
+	0x0001bffa, 0x0001c1fa, 0x00002dfa, 0x0001c5fa, 0x0001c6fa, 0x0001c8fa, 0x0001cafa, 0x00002efa,
+	0x0001cefa, 0x0001d0fa, 0x0001d2fa, 0x0001d4fa, 0x00002ffa, 0x0001d7fa, 0x0001d9fa, 0x0001dbfa,
+	0x0001ddfa, 0x000030fa, 0x0001e4fa, 0x0001e8fa, 0x000031fa, 0x0001effa, 0x000005fa, 0x0001f7fa,
+	0x0001fbfa, 0x000033fa, 0x000202fa, 0x000206fa, 0x000034fa, 0x00020dfa, 0x000035fa, 0x000215fa,
+	0x000218fa, 0x000036fa, 0x000220fa, 0x000224fa, 0x000037fa, 0x00022bfa, 0x000038fa, 0x000233fa,
+	0x000236fa, 0x000039fa, 0x00023efa, 0x000241fa, 0x00003afa, 0x000249fa, 0x00003bfa, 0x000250fa,
+	0x000254fa, 0x000006fa, 0x00025bfa, 0x00025ffa, 0x00003dfa, 0x000267fa, 0x00003efa, 0x00026efa,
+	0x000272fa, 0x00003ffa, 0x000279fa, 0x00027dfa, 0x000040fa, 0x000284fa, 0x000041fa, 0x00028cfa,
+	0x000290fa, 0x000042fa, 0x000297fa, 0x00029bfa, 0x000043fa, 0x0002a2fa, 0x0002a6fa, 0x000044fa,
+	0x0002adfa, 0x000045fa, 0x0002b5fa, 0x0002b9fa, 0x000007fa, 0x0002c0fa, 0x0002c4fa, 0x000047fa,
+	0x0002cbfa, 0x000048fa, 0x0002d3fa, 0x0002d6fa, 0x000049fa, 0x0002defa, 0x0002e2fa, 0x00004afa,
+	0x0002e9fa, 0x00004bfa, 0x0002f1fa, 0x0002f4fa, 0x00004cfa, 0x0002fcfa, 0x0002fffa, 0x00004dfa,
+	0x000307fa, 0x00004efa, 0x00030efa, 0x000312fa, 0x00004ffa, 0x000319fa, 0x00031dfa, 0x000008fa,
+	0x000325fa, 0x000051fa, 0x00032cfa, 0x000330fa, 0x000052fa, 0x000337fa, 0x00033bfa, 0x000053fa,
+	0x000342fa, 0x000054fa, 0x00034afa, 0x00034efa, 0x000055fa, 0x000355fa, 0x000359fa, 0x000056fa,
+	0x000360fa, 0x000364fa, 0x000057fa, 0x00036bfa, 0x000058fa, 0x000373fa, 0x000377fa, 0x000059fa,
+	0x00037efa, 0x000382fa, 0x000009fa, 0x000389fa, 0x00005bfa, 0x000391fa, 0x000394fa, 0x00005cfa,
+	0x00039cfa, 0x0003a0fa, 0x00005dfa, 0x0003a7fa, 0x00005efa, 0x0003aefa, 0x0003b2fa, 0x00005ffa,
+	0x0003bafa, 0x000060fa, 0x000061fa, 0x0003d0fa, 0x000062fa, 0x000063fa, 0x000001fb, 0x0003eefb,
+	0x000065fb, 0x000066fb, 0x000067fb, 0x00040cfb, 0x000068fb, 0x000069fb, 0x00006afb, 0x000429fb,
+	0x00006bfb, 0x00006cfb, 0x00006dfb, 0x000447fb, 0x00000bfb, 0x00006ffb, 0x000070fb, 0x000465fb,
+	0x000071fb, 0x000072fb, 0x000073fb, 0x000483fb, 0x000074fb, 0x000075fb, 0x000076fb, 0x0004a1fb,
+	0x000077fb, 0x00000cfb, 0x000079fb, 0x0004befb, 0x00007afb, 0x00007bfb, 0x00007cfb, 0x0004dcfb,
+	0x00007dfb, 0x00007efb, 0x00007ffb, 0x0004fafb, 0x000080fb, 0x000081fb, 0x00000dfb, 0x000518fb,
+	0x000083fb, 0x000084fb, 0x00052efb, 0x000085fb, 0x000086fb, 0x000087fb, 0x00054cfb, 0x000088fb,
+	0x000089fb, 0x00008afb, 0x00056afb, 0x00008bfb, 0x00000efb, 0x00008dfb, 0x000588fb, 0x00008efb,
+	0x00008ffb, 0x000090fb, 0x0005a5fb, 0x000091fb, 0x000092fb, 0x000093fb, 0x0005c3fb, 0x000094fb,
+	0x000095fb, 0x00000ffb, 0x0005e1fb, 0x000097fb, 0x000098fb, 0x000099fb, 0x0005fffb, 0x00009afb,
+	0x00009bfb, 0x00009cfb, 0x00061dfb, 0x00009dfb, 0x00009efb, 0x00009ffb, 0x00063afb, 0x000010fb,
+	0x0000a1fb, 0x0000a2fb, 0x000658fb, 0x0000a3fb, 0x0000a4fb, 0x0000a5fb, 0x000676fb, 0x0000a6fb,
+	0x0000a7fb, 0x0000a8fb, 0x000694fb, 0x0000a9fb, 0x000011fb, 0x0006aafb, 0x0000abfb, 0x0000acfb,
+	0x0000adfb, 0x0006c8fb, 0x0000aefb, 0x0000affb, 0x0000b0fb, 0x0006e6fb, 0x0000b1fb, 0x0000b2fb,
+	0x0000b3fb, 0x000704fb, 0x000012fb, 0x0000b5fb, 0x0000b6fb, 0x000721fb, 0x0000b7fb, 0x0000b8fb,
+	0x0000b9fb, 0x00073ffb, 0x0000bafb, 0x0000bbfb, 0x0000bcfb, 0x00075dfb, 0x0000bdfb, 0x000013fb,
+	0x0000bffb, 0x0000c0fb, 0x0000c2fb, 0x0000c3fb, 0x0000c5fb, 0x0000c6fb, 0x000002fb, 0x0000c9fb,
+	0x0000cbfb, 0x0000ccfb, 0x0000cefb, 0x0000cffb, 0x0000d1fb, 0x000015fb, 0x0000d4fb, 0x0000d5fb,
+	0x0000d7fb, 0x0000d8fb, 0x0000dafb, 0x0000dbfb, 0x000016fb, 0x0000defb, 0x0000e0fb, 0x0000e1fb,
+	0x0000e2fb, 0x0000e4fb, 0x000017fb, 0x0000e7fb, 0x0000e8fb, 0x0000eafb, 0x0000ebfb, 0x0000edfb,
+	0x0000eefb, 0x000018fb, 0x0000f1fb, 0x0000f3fb, 0x0000f4fb, 0x0000f6fb, 0x0000f7fb, 0x0000f9fb,
+	0x000019fb, 0x0000fcfb, 0x0000fdfb, 0x0000fffb, 0x000100fb, 0x000102fb, 0x00001afb, 0x000105fb,
+	0x000106fb, 0x000108fb, 0x000109fb, 0x00010bfb, 0x00010cfb, 0x00001bfb, 0x00010ffb, 0x000111fb,
+	0x000112fb, 0x000114fb, 0x000115fb, 0x000117fb, 0x00001cfb, 0x00011afb, 0x00011bfb, 0x00011dfb,
+	0x00011efb, 0x000120fb, 0x000121fb, 0x00001dfb, 0x000124fb, 0x000126fb, 0x000127fb, 0x000129fb,
+	0x00012afb, 0x000003fb, 0x00012dfb, 0x00012efb, 0x000130fb, 0x000131fb, 0x000133fb, 0x000134fb,
+	0x00001ffb, 0x000137fb, 0x000139fb, 0x00013afb, 0x00013cfb, 0x00013dfb, 0x00013ffb, 0x000020fb,
+	0x000142fb, 0x000143fb, 0x000145fb, 0x000146fb, 0x000148fb, 0x000021fb, 0x00014bfb, 0x00014cfb,
+	0x00014efb, 0x00014ffb, 0x000151fb, 0x000152fb, 0x000022fb, 0x000155fb, 0x000157fb, 0x000158fb,
+	0x00015afb, 0x00015bfb, 0x00015dfb, 0x000023fb, 0x000160fb, 0x000161fb, 0x000163fb, 0x000164fb,
+	0x000166fb, 0x000167fb, 0x000024fb, 0x00016afb, 0x00016cfb, 0x00016dfb, 0x00016ffb, 0x000170fb,
+	0x000025fb, 0x000173fb, 0x000175fb, 0x000176fb, 0x000178fb, 0x000179fb, 0x00017afb, 0x000026fb,
+	0x00017dfb, 0x000180fb, 0x000183fb, 0x000027fb, 0x000189fb, 0x00018cfb, 0x000004fb, 0x000192fb,
+	0x000195fb, 0x000198fb, 0x000029fb, 0x00019efb, 0x0001a1fb, 0x00002afb, 0x0001a7fb, 0x0001aafb,
+	0x00002bfb, 0x0001b0fb, 0x0001b3fb, 0x0001b6fb, 0x00002cfb, 0x0001bcfb, 0x0001bffb, 0x00002dfb,
+	0x0001c5fb, 0x0001c8fb, 0x00002efb, 0x0001cefb, 0x0001d1fb, 0x0001d4fb, 0x00002ffb, 0x0001dafb,
+	0x0001ddfb, 0x000030fb, 0x0001e3fb, 0x0001e6fb, 0x000031fb, 0x0001ecfb, 0x0001effb, 0x0001f2fb,
+	0x000005fb, 0x0001f8fb, 0x0001fbfb, 0x000033fb, 0x000201fb, 0x000204fb, 0x000034fb, 0x00020afb,
+	0x00020dfb, 0x000210fb, 0x000035fb, 0x000215fb, 0x000218fb, 0x000036fb, 0x00021efb, 0x000221fb,
+	0x000224fb, 0x000037fb, 0x00022afb, 0x00022dfb, 0x000038fb, 0x000233fb, 0x000236fb, 0x000039fb,
+	0x00023cfb, 0x00023ffb, 0x000242fb, 0x00003afb, 0x000248fb, 0x00024bfb, 0x00003bfb, 0x000251fb,
+	0x000254fb, 0x000006fb, 0x00025afb, 0x00025dfb, 0x000260fb, 0x00003dfb, 0x000266fb, 0x000269fb,
+	0x00003efb, 0x00026ffb, 0x000272fb, 0x00003ffb, 0x000278fb, 0x00027bfb, 0x00027efb, 0x000040fb,
+	0x000284fb, 0x000287fb, 0x000041fb, 0x00028dfb, 0x000290fb, 0x000042fb, 0x000296fb, 0x000299fb,
+	0x00029cfb, 0x000043fb, 0x0002a2fb, 0x0002a5fb, 0x000044fb, 0x0002aafb, 0x0002adfb, 0x0002b0fb,
+	0x000045fb, 0x0002b6fb, 0x0002b9fb, 0x000007fb, 0x0002bffb, 0x0002c2fb, 0x000047fb, 0x0002c8fb,
+	0x0002cbfb, 0x0002cefb, 0x000048fb, 0x0002d4fb, 0x0002d7fb, 0x000049fb, 0x0002ddfb, 0x0002e0fb,
+	0x00004afb, 0x0002e6fb, 0x0002e9fb, 0x0002ecfb, 0x00004bfb, 0x0002f2fb, 0x0002f5fb, 0x00004cfb,
+	0x0002fbfb, 0x00004dfb, 0x000307fb, 0x00004efb, 0x000313fb, 0x00004ffb, 0x000008fb, 0x000325fb,
+	0x000051fb, 0x000331fb, 0x000052fb, 0x000053fb, 0x000342fb, 0x000054fb, 0x00034efb, 0x000055fb,
+	0x000056fb, 0x000360fb, 0x000057fb, 0x00036cfb, 0x000058fb, 0x000059fb, 0x00037efb, 0x000009fb,
+	0x00038afb, 0x00005bfb, 0x00005cfb, 0x00039cfb, 0x00005dfb, 0x0003a8fb, 0x00005efb, 0x00005ffb,
+	0x0003bafb, 0x000060fb, 0x0003c6fb, 0x000061fb, 0x000062fb, 0x0003d7fb, 0x000063fb, 0x0003e3fb,
+	0x000001fc, 0x000065fc, 0x0003f5fc, 0x000066fc, 0x000401fc, 0x000067fc, 0x000068fc, 0x000413fc,
+	0x000069fc, 0x00041ffc, 0x00006afc, 0x00042bfc, 0x00006bfc, 0x00006cfc, 0x00043dfc, 0x00006dfc,
+	0x000449fc, 0x00000bfc, 0x00006ffc, 0x00045bfc, 0x000070fc, 0x000467fc, 0x000071fc, 0x000072fc,
+	0x000478fc, 0x000073fc, 0x000484fc, 0x000074fc, 0x000075fc, 0x000496fc, 0x000076fc, 0x0004a2fc,
+	0x000077fc, 0x00000cfc, 0x0004b4fc, 0x000079fc, 0x0004c0fc, 0x00007afc, 0x00007bfc, 0x0004d2fc,
+	0x00007cfc, 0x0004defc, 0x00007dfc, 0x00007efc, 0x0004f0fc, 0x00007ffc, 0x0004fcfc, 0x000080fc,
+	0x000081fc, 0x00050dfc, 0x00000dfc, 0x000519fc, 0x000083fc, 0x000084fc, 0x00052bfc, 0x000085fc,
+	0x000537fc, 0x000086fc, 0x000087fc, 0x000549fc, 0x000088fc, 0x000555fc, 0x000089fc, 0x000561fc,
+	0x00008afc, 0x00008bfc, 0x000573fc, 0x00000efc, 0x00057ffc, 0x00008dfc, 0x00008efc, 0x000591fc,
+	0x00008ffc, 0x00059cfc, 0x000090fc, 0x000091fc, 0x0005aefc, 0x000092fc, 0x0005bafc, 0x000093fc,
+	0x000094fc, 0x0005ccfc, 0x000095fc, 0x0005d8fc, 0x00000ffc, 0x000097fc, 0x0005eafc, 0x000098fc,
+	0x000099fc, 0x00009afc, 0x00009bfc, 0x00009cfc, 0x00009dfc, 0x00009ffc, 0x000010fc, 0x0000a1fc,
+	0x0000a2fc, 0x0000a3fc, 0x0000a5fc, 0x0000a6fc, 0x0000a7fc, 0x0000a8fc, 0x0000a9fc, 0x000011fc,
+	0x0000acfc, 0x0000adfc, 0x0000aefc, 0x0000affc, 0x0000b0fc, 0x0000b2fc, 0x0000b3fc, 0x000012fc,
+	0x0000b5fc, 0x0000b6fc, 0x0000b8fc, 0x0000b9fc, 0x0000bafc, 0x0000bbfc, 0x0000bcfc, 0x000013fc,
+	0x0000bffc, 0x0000c0fc, 0x0000c1fc, 0x0000c2fc, 0x0000c4fc, 0x0000c5fc, 0x0000c6fc, 0x0000c7fc,
+	0x000002fc, 0x0000c9fc, 0x0000cbfc, 0x0000ccfc, 0x0000cdfc, 0x0000cefc, 0x0000cffc, 0x0000d1fc,
+	0x000015fc, 0x0000d3fc, 0x0000d4fc, 0x0000d5fc, 0x0000d7fc, 0x0000d8fc, 0x0000d9fc, 0x0000dafc,
+	0x0000dbfc, 0x000016fc, 0x0000defc, 0x0000dffc, 0x0000e0fc, 0x0000e1fc, 0x0000e2fc, 0x0000e4fc,
+	0x0000e5fc, 0x000017fc, 0x0000e7fc, 0x0000e8fc, 0x0000eafc, 0x0000ebfc, 0x0000ecfc, 0x0000edfc,
+	0x0000eefc, 0x000018fc, 0x0000f1fc, 0x0000f2fc, 0x0000f3fc, 0x0000f4fc, 0x0000f6fc, 0x0000f7fc,
+	0x0000f8fc, 0x0000f9fc, 0x000019fc, 0x0000fcfc, 0x0000fdfc, 0x0000fefc, 0x0000fffc, 0x000100fc,
+	0x000101fc, 0x000103fc, 0x00001afc, 0x000105fc, 0x000106fc, 0x000107fc, 0x000109fc, 0x00010afc,
+	0x00010bfc, 0x00010cfc, 0x00001bfc, 0x00010ffc, 0x000110fc, 0x000111fc, 0x000112fc, 0x000113fc,
+	0x000115fc, 0x000116fc, 0x000117fc, 0x00001cfc, 0x000119fc, 0x00011bfc, 0x00011cfc, 0x00011dfc,
+	0x00011efc, 0x00011ffc, 0x000120fc, 0x00001dfc, 0x000123fc, 0x000124fc, 0x000125fc, 0x000126fc,
+	0x000128fc, 0x000129fc, 0x00012afc, 0x00012bfc, 0x000003fc, 0x00012efc, 0x00012ffc, 0x000130fc,
+	0x000131fc, 0x000134fc, 0x00001ffc, 0x000138fc, 0x00013bfc, 0x00013dfc, 0x000020fc, 0x000142fc,
+	0x000144fc, 0x000147fc, 0x000021fc, 0x00014bfc, 0x00014efc, 0x000150fc, 0x000153fc, 0x000022fc,
+	0x000157fc, 0x00015afc, 0x00015cfc, 0x000023fc, 0x000161fc, 0x000163fc, 0x000166fc, 0x000024fc,
+	0x00016afc, 0x00016dfc, 0x00016ffc, 0x000025fc, 0x000174fc, 0x000176fc, 0x000179fc, 0x000026fc,
+	0x00017dfc, 0x000180fc, 0x000182fc, 0x000185fc, 0x000027fc, 0x000189fc, 0x00018cfc, 0x00018efc,
+	0x000004fc, 0x000193fc, 0x000195fc, 0x000198fc, 0x000029fc, 0x00019cfc, 0x00019ffc, 0x0001a1fc,
+	0x00002afc, 0x0001a6fc, 0x0001a8fc, 0x0001abfc, 0x00002bfc, 0x0001b0fc, 0x0001b2fc, 0x0001b4fc,
+	0x0001b7fc, 0x00002cfc, 0x0001bbfc, 0x0001befc, 0x0001c0fc, 0x00002dfc, 0x0001c5fc, 0x0001c7fc,
+	0x0001cafc, 0x00002efc, 0x0001cffc, 0x0001d1fc, 0x0001d3fc, 0x00002ffc, 0x0001d8fc, 0x0001dafc,
+	0x0001ddfc, 0x000030fc, 0x0001e2fc, 0x0001e4fc, 0x0001e6fc, 0x0001e9fc, 0x000031fc, 0x0001eefc,
+	0x0001f0fc, 0x0001f2fc, 0x000005fc, 0x0001f7fc, 0x0001f9fc, 0x0001fcfc, 0x000033fc, 0x000201fc,
+	0x000203fc, 0x000205fc, 0x000034fc, 0x00020afc, 0x00020dfc, 0x00020ffc, 0x000035fc, 0x000214fc,
+	0x000216fc, 0x000218fc, 0x000036fc, 0x00021dfc, 0x000220fc, 0x000222fc, 0x000224fc, 0x000037fc,
+	0x000229fc, 0x00022cfc, 0x00022efc, 0x000038fc, 0x000233fc, 0x000235fc, 0x000237fc, 0x000039fc,
+	0x00023cfc, 0x00023ffc, 0x000241fc, 0x00003afc, 0x000246fc, 0x000248fc, 0x00024bfc, 0x00003bfc,
+	0x00024ffc, 0x000252fc, 0x000254fc, 0x000256fc, 0x000006fc, 0x00025bfc, 0x00025efc, 0x000260fc,
+	0x00003dfc, 0x000267fc, 0x00003efc, 0x000271fc, 0x00003ffc, 0x00027afc, 0x000040fc, 0x000284fc,
+	0x000041fc, 0x00028dfc, 0x000042fc, 0x000297fc, 0x00029cfc, 0x000043fc, 0x0002a5fc, 0x000044fc,
+	0x0002affc, 0x000045fc, 0x0002b8fc, 0x000007fc, 0x0002c2fc, 0x000047fc, 0x0002cbfc, 0x000048fc,
+	0x0002d5fc, 0x000049fc, 0x0002defc, 0x00004afc, 0x0002e8fc, 0x00004bfc, 0x0002f1fc, 0x00004cfc,
+	0x0002fbfc, 0x00004dfc, 0x000304fc, 0x000309fc, 0x00004efc, 0x000313fc, 0x00004ffc, 0x00031cfc,
+	0x000008fc, 0x000326fc, 0x000051fc, 0x00032ffc, 0x000052fc, 0x000339fc, 0x000053fc, 0x000342fc,
+	0x000054fc, 0x00034cfc, 0x000055fc, 0x000356fc, 0x000056fc, 0x00035ffc, 0x000057fc, 0x000369fc,
+	0x00036dfc, 0x000058fc, 0x000377fc, 0x000059fc, 0x000380fc, 0x000009fc, 0x00038afc, 0x00005bfc,
+	0x000394fc, 0x00005cfc, 0x00039dfc, 0x00005dfc, 0x0003a7fc, 0x00005efc, 0x0003b0fc, 0x00005ffc,
+	0x0003bafc, 0x000060fc, 0x0003c3fc, 0x000061fc, 0x0003cdfc, 0x0003d2fc, 0x000062fc, 0x0003dbfc,
+	0x000063fc, 0x0003e5fc, 0x000001fd, 0x0003eefd, 0x000065fd, 0x0003f8fd, 0x000066fd, 0x000401fd,
+	0x000067fd, 0x00040bfd, 0x000068fd, 0x000414fd, 0x000069fd, 0x00041efd, 0x00006afd, 0x000427fd,
+	0x00006bfd, 0x000431fd, 0x00006cfd, 0x00043afd, 0x00043ffd, 0x00006dfd, 0x000449fd, 0x00000bfd,
+	0x000452fd, 0x00006ffd, 0x00045cfd, 0x000070fd, 0x000465fd, 0x000071fd, 0x00046ffd, 0x000072fd,
+	0x000478fd, 0x000073fd, 0x000482fd, 0x000074fd, 0x00048bfd, 0x000075fd, 0x000495fd, 0x000076fd,
+	0x00049ffd, 0x0004a3fd, 0x000077fd, 0x0004adfd, 0x00000cfd, 0x0004b6fd, 0x000079fd, 0x0004c0fd,
+	0x00007afd, 0x00007bfd, 0x00007cfd, 0x00007dfd, 0x00007efd, 0x00007ffd, 0x000080fd, 0x000081fd,
+	0x00000dfd, 0x000083fd, 0x000084fd, 0x000085fd, 0x000537fd, 0x000086fd, 0x000087fd, 0x000088fd,
+	0x000089fd, 0x00008afd, 0x00008bfd, 0x00000efd, 0x00008dfd, 0x00008efd, 0x00008ffd, 0x000090fd,
+	0x000091fd, 0x000092fd, 0x000093fd, 0x000094fd, 0x000095fd, 0x00000ffd, 0x000097fd, 0x000098fd,
+	0x000099fd, 0x00009afd, 0x000609fd, 0x00009bfd, 0x00009cfd, 0x00009dfd, 0x00009efd, 0x00009ffd,
+	0x000010fd, 0x0000a1fd, 0x0000a2fd, 0x0000a3fd, 0x0000a4fd, 0x0000a5fd, 0x0000a6fd, 0x0000a7fd,
+	0x0000a8fd, 0x0000a9fd, 0x000011fd, 0x0000abfd, 0x0000acfd, 0x0000adfd, 0x0000aefd, 0x0006d1fd,
+	0x0000affd, 0x0000b0fd, 0x0000b1fd, 0x0000b2fd, 0x0000b3fd, 0x000012fd, 0x0000b5fd, 0x0000b6fd,
+	0x0000b7fd, 0x0000b8fd, 0x0000b9fd, 0x0000bafd, 0x0000bbfd, 0x0000bcfd, 0x0000bdfd, 0x000013fd,
+	0x0000bffd, 0x0000c0fd, 0x0000c1fd, 0x0000c2fd, 0x0000c3fd, 0x0007a3fd, 0x0000c4fd, 0x0000c5fd,
+	0x0000c6fd, 0x0000c7fd, 0x000002fd, 0x0000c9fd, 0x0000cafd, 0x0000cbfd, 0x0000ccfd, 0x0000cdfd,
+	0x0000cefd, 0x0000cffd, 0x0000d0fd, 0x0000d1fd, 0x000015fd, 0x0000d3fd, 0x0000d4fd, 0x0000d5fd,
+	0x0000d6fd, 0x0000d7fd, 0x0000d8fd, 0x000875fd, 0x0000d9fd, 0x0000dafd, 0x0000dbfd, 0x000016fd,
+	0x0000ddfd, 0x0000defd, 0x0000dffd, 0x0000e0fd, 0x0000e1fd, 0x0000e2fd, 0x0000e3fd, 0x0000e4fd,
+	0x0000e5fd, 0x000017fd, 0x0000e7fd, 0x0000e8fd, 0x0000e9fd, 0x0000eafd, 0x0000ebfd, 0x0000ecfd,
+	0x00093dfd, 0x0000edfd, 0x0000eefd, 0x0000effd, 0x000018fd, 0x0000f1fd, 0x0000f2fd, 0x0000f3fd,
+	0x0000f4fd, 0x0000f6fd, 0x0000f8fd, 0x000019fd, 0x0000fcfd, 0x0000fefd, 0x000100fd, 0x000101fd,
+	0x00001afd, 0x000105fd, 0x000107fd, 0x000109fd, 0x00010bfd, 0x00010dfd, 0x00001bfd, 0x000111fd,
+	0x000113fd, 0x000115fd, 0x000116fd, 0x00001cfd, 0x00011afd, 0x00011cfd, 0x00011efd, 0x000120fd,
+	0x00001dfd, 0x000124fd, 0x000126fd, 0x000128fd, 0x00012afd, 0x000003fd, 0x00012dfd, 0x00012ffd,
+	0x000131fd, 0x000133fd, 0x000135fd, 0x00001ffd, 0x000139fd, 0x00013bfd, 0x00013dfd, 0x00013ffd,
+	0x000020fd, 0x000142fd, 0x000144fd, 0x000146fd, 0x000148fd, 0x000021fd, 0x00014cfd, 0x00014efd,
+	0x000150fd, 0x000152fd, 0x000022fd, 0x000155fd, 0x000157fd, 0x000159fd, 0x00015bfd, 0x00015dfd,
+	0x000023fd, 0x000161fd, 0x000163fd, 0x000165fd, 0x000167fd, 0x000024fd, 0x00016afd, 0x00016cfd,
+	0x00016efd, 0x000170fd, 0x000025fd, 0x000174fd, 0x000176fd, 0x000178fd, 0x00017afd, 0x000026fd,
+	0x00017dfd, 0x00017ffd, 0x000181fd, 0x000183fd, 0x000027fd, 0x000187fd, 0x000189fd, 0x00018bfd,
+	0x00018dfd, 0x00018ffd, 0x000004fd, 0x000192fd, 0x000194fd, 0x000196fd, 0x000198fd, 0x000029fd,
+	0x00019cfd, 0x00019efd, 0x0001a0fd, 0x0001a2fd, 0x00002afd, 0x0001a6fd, 0x0001a7fd, 0x0001a9fd,
+	0x0001abfd, 0x00002bfd, 0x0001affd, 0x0001b1fd, 0x0001b3fd, 0x0001b5fd, 0x0001b7fd, 0x00002cfd,
+	0x0001bbfd, 0x0001bcfd, 0x0001befd, 0x0001c0fd, 0x00002dfd, 0x0001c4fd, 0x0001c6fd, 0x0001c8fd,
+	0x0001cafd, 0x00002efd, 0x0001cefd, 0x0001cffd, 0x0001d1fd, 0x0001d3fd, 0x00002ffd, 0x0001d7fd,
+	0x0001d9fd, 0x0001dbfd, 0x0001ddfd, 0x0001dffd, 0x000030fd, 0x0001e3fd, 0x0001e4fd, 0x0001e6fd,
+	0x000031fd, 0x0001ecfd, 0x0001f0fd, 0x000005fd, 0x0001f8fd, 0x0001fbfd, 0x000033fd, 0x000203fd,
+	0x000034fd, 0x00020bfd, 0x00020efd, 0x000035fd, 0x000216fd, 0x00021afd, 0x000036fd, 0x000222fd,
+	0x000037fd, 0x000229fd, 0x00022dfd, 0x000038fd, 0x000235fd, 0x000039fd, 0x00023cfd, 0x000240fd,
+	0x00003afd, 0x000248fd, 0x00024bfd, 0x00003bfd, 0x000253fd, 0x000006fd, 0x00025bfd, 0x00025ffd,
+	0x00003dfd, 0x000266fd, 0x00026afd, 0x00003efd, 0x000272fd, 0x00003ffd, 0x000279fd, 0x00027dfd,
+	0x000040fd, 0x000285fd, 0x000041fd, 0x00028cfd, 0x000290fd, 0x000042fd, 0x000298fd, 0x00029cfd,
+	0x000043fd, 0x0002a3fd, 0x000044fd, 0x0002abfd, 0x0002affd, 0x000045fd, 0x0002b6fd, 0x0002bafd,
+	0x000007fd, 0x0002c2fd, 0x000047fd, 0x0002c9fd, 0x0002cdfd, 0x000048fd, 0x0002d5fd, 0x000049fd,
+	0x0002dcfd, 0x0002e0fd, 0x00004afd, 0x0002e8fd, 0x0002ecfd, 0x00004bfd, 0x0002f3fd, 0x00004cfd,
+	0x0002fbfd, 0x0002fffd, 0x00004dfd, 0x000306fd, 0x00004efd, 0x00030efd, 0x000312fd, 0x00004ffd,
+	0x000319fd, 0x00031dfd, 0x000008fd, 0x000325fd, 0x000051fd, 0x00032dfd, 0x000330fd, 0x000052fd,
+	0x000338fd, 0x00033cfd, 0x000053fd, 0x000343fd, 0x000054fd, 0x00034bfd, 0x00034ffd, 0x000055fd,
+	0x000356fd, 0x000056fd, 0x00035efd, 0x000362fd, 0x000057fd, 0x00036afd, 0x00036dfd, 0x000058fd,
+	0x000375fd, 0x000059fd, 0x00037dfd, 0x000380fd, 0x000009fd, 0x000388fd, 0x00038cfd, 0x00005bfd,
+	0x000394fd, 0x00005cfd, 0x00039bfd, 0x00039ffd, 0x00005dfd, 0x0003a7fd, 0x00005efd, 0x0003aefd,
+	0x0003b2fd, 0x00005ffd, 0x0003bafd, 0x0003bdfd, 0x000060fd, 0x0003c5fd, 0x000061fd, 0x0003cdfd,
+	0x000062fd, 0x0003d8fd, 0x000063fd, 0x000001fe, 0x000065fe, 0x0003f7fe, 0x000066fe, 0x000067fe,
+	0x000068fe, 0x000415fe, 0x000069fe, 0x00006afe, 0x00006bfe, 0x000434fe, 0x00006cfe, 0x00006dfe,
+	0x00000bfe, 0x00006ffe, 0x00045afe, 0x000070fe, 0x000071fe, 0x000072fe, 0x000478fe, 0x000073fe,
+	0x000074fe, 0x000075fe, 0x000497fe, 0x000076fe, 0x000077fe, 0x00000cfe, 0x0004b5fe, 0x000079fe,
+	0x00007afe, 0x00007bfe, 0x0004d4fe, 0x00007cfe, 0x00007dfe, 0x00007efe, 0x00007ffe, 0x0004fafe,
+	0x000080fe, 0x000081fe, 0x00000dfe, 0x000519fe, 0x000083fe, 0x000084fe, 0x000085fe, 0x000537fe,
+	0x000086fe, 0x000087fe, 0x000088fe, 0x000556fe, 0x000089fe, 0x00008afe, 0x00008bfe, 0x000574fe,
+	0x00000efe, 0x00008dfe, 0x00008efe, 0x00008ffe, 0x00059afe, 0x000090fe, 0x000091fe, 0x000092fe,
+	0x0005b9fe, 0x000093fe, 0x000094fe, 0x000095fe, 0x0005d7fe, 0x00000ffe, 0x000097fe, 0x000098fe,
+	0x0005f6fe, 0x000099fe, 0x00009afe, 0x00009bfe, 0x00009cfe, 0x00061cfe, 0x00009dfe, 0x00009efe,
+	0x00009ffe, 0x00063bfe, 0x000010fe, 0x0000a1fe, 0x0000a2fe, 0x000659fe, 0x0000a3fe, 0x0000a4fe,
+	0x0000a5fe, 0x000678fe, 0x0000a6fe, 0x0000a7fe, 0x0000a8fe, 0x000696fe, 0x0000a9fe, 0x000011fe,
+	0x0000abfe, 0x0000acfe, 0x0006bcfe, 0x0000adfe, 0x0000aefe, 0x0000affe, 0x0006dbfe, 0x0000b0fe,
+	0x0000b1fe, 0x0000b2fe, 0x0006f9fe, 0x0000b3fe, 0x000012fe, 0x0000b5fe, 0x000718fe, 0x0000b6fe,
+	0x0000b7fe, 0x0000b8fe, 0x0000b9fe, 0x00073efe, 0x0000bafe, 0x0000bbfe, 0x0000bcfe, 0x00075cfe,
+	0x0000bdfe, 0x000013fe, 0x0000bffe, 0x00077bfe, 0x0000c0fe, 0x0000c1fe, 0x0000c2fe, 0x000799fe,
+	0x0000c3fe, 0x0000c5fe, 0x0000c6fe, 0x000002fe, 0x0000c9fe, 0x0000cbfe, 0x0000ccfe, 0x0000cefe,
+	0x0000d0fe, 0x0000d1fe, 0x000015fe, 0x0000d4fe, 0x0000d6fe, 0x0000d7fe, 0x0000d9fe, 0x0000dafe,
+	0x000016fe, 0x0000ddfe, 0x0000dffe, 0x0000e0fe, 0x0000e2fe, 0x0000e3fe, 0x0000e5fe, 0x000017fe,
+	0x0000e8fe, 0x0000e9fe, 0x0000ebfe, 0x0000edfe, 0x0000eefe, 0x000018fe, 0x0000f1fe, 0x0000f3fe,
+	0x0000f4fe, 0x0000f6fe, 0x0000f7fe, 0x0000f9fe, 0x000019fe, 0x0000fcfe, 0x0000fdfe, 0x0000fffe,
+	0x000100fe, 0x000102fe, 0x00001afe, 0x000105fe, 0x000106fe, 0x000108fe, 0x00010afe, 0x00010bfe,
+	0x00010dfe, 0x00001bfe, 0x000110fe, 0x000111fe, 0x000113fe, 0x000114fe, 0x000116fe, 0x000117fe,
+	0x00001cfe, 0x00011afe, 0x00011cfe, 0x00011dfe, 0x00011ffe, 0x000120fe, 0x00001dfe, 0x000123fe,
+	0x000125fe, 0x000126fe, 0x000128fe, 0x00012afe, 0x00012bfe, 0x000003fe, 0x00012efe, 0x000130fe,
+	0x000131fe, 0x000133fe, 0x000134fe, 0x00001ffe, 0x000137fe, 0x000139fe, 0x00013afe, 0x00013cfe,
+	0x00013dfe, 0x00013ffe, 0x000020fe, 0x000142fe, 0x000143fe, 0x000145fe, 0x000147fe, 0x000148fe,
+	0x000021fe, 0x00014bfe, 0x00014dfe, 0x00014efe, 0x000150fe, 0x000151fe, 0x000153fe, 0x000022fe,
+	0x000156fe, 0x000157fe, 0x000159fe, 0x00015afe, 0x00015cfe, 0x000023fe, 0x00015ffe, 0x000160fe,
+	0x000162fe, 0x000164fe, 0x000165fe, 0x000167fe, 0x000024fe, 0x00016afe, 0x00016bfe, 0x00016dfe,
+	0x00016efe, 0x000170fe, 0x000025fe, 0x000173fe, 0x000174fe, 0x000176fe, 0x000177fe, 0x000179fe,
+	0x00017afe, 0x000026fe, 0x00017dfe, 0x00017ffe, 0x000181fe, 0x000182fe, 0x000184fe, 0x000185fe,
+	0x000027fe, 0x00018afe, 0x00018dfe, 0x000004fe, 0x000193fe, 0x000196fe, 0x000029fe, 0x00019cfe,
+	0x00019ffe, 0x0001a2fe, 0x00002afe, 0x0001a8fe, 0x0001abfe, 0x00002bfe, 0x0001b1fe, 0x0001b4fe,
+	0x00002cfe, 0x0001bbfe, 0x0001befe, 0x00002dfe, 0x0001c4fe, 0x0001c7fe, 0x0001cafe, 0x00002efe,
+	0x0001d0fe, 0x0001d3fe, 0x00002ffe, 0x0001d9fe, 0x0001dcfe, 0x000030fe, 0x0001e2fe, 0x0001e5fe,
+	0x0001e8fe, 0x000031fe, 0x0001eefe, 0x0001f1fe, 0x000005fe, 0x0001f8fe, 0x0001fbfe, 0x000033fe,
+	0x000201fe, 0x000204fe, 0x000034fe, 0x00020afe, 0x00020dfe, 0x000210fe, 0x000035fe, 0x000216fe,
+	0x000219fe, 0x000036fe, 0x00021ffe, 0x000222fe, 0x000037fe, 0x000228fe, 0x00022bfe, 0x00022efe,
+	0x000038fe, 0x000235fe, 0x000238fe, 0x000039fe, 0x00023efe, 0x000241fe, 0x00003afe, 0x000247fe,
+	0x00024afe, 0x00003bfe, 0x000250fe, 0x000253fe, 0x000256fe, 0x000006fe, 0x00025cfe, 0x00025ffe,
+	0x00003dfe, 0x000265fe, 0x000268fe, 0x00003efe, 0x00026ffe, 0x000272fe, 0x00003ffe, 0x000278fe,
+	0x00027bfe, 0x00027efe, 0x000040fe, 0x000284fe, 0x000287fe, 0x000041fe, 0x00028dfe, 0x000290fe,
+	0x000042fe, 0x000296fe, 0x000299fe, 0x00029cfe, 0x000043fe, 0x0002a2fe, 0x0002a5fe, 0x000044fe,
+	0x0002acfe, 0x0002affe, 0x000045fe, 0x0002b5fe, 0x0002b8fe, 0x000007fe, 0x0002befe, 0x0002c1fe,
+	0x0002c4fe, 0x000047fe, 0x0002cafe, 0x0002cdfe, 0x000048fe, 0x0002d3fe, 0x0002d6fe, 0x000049fe,
+	0x0002dcfe, 0x0002dffe, 0x00004afe, 0x0002e6fe, 0x0002e9fe, 0x0002ecfe, 0x00004bfe, 0x0002f2fe,
+	0x0002f5fe, 0x00004cfe, 0x0002fbfe, 0x0002fefe, 0x00004dfe, 0x000304fe, 0x000307fe, 0x00030afe,
+	0x00004efe, 0x00004ffe, 0x000319fe, 0x000008fe, 0x000326fe, 0x000051fe, 0x000052fe, 0x000338fe,
+	0x000053fe, 0x000344fe, 0x000054fe, 0x000055fe, 0x000356fe, 0x000056fe, 0x000363fe, 0x000057fe,
+	0x000058fe, 0x000375fe, 0x000059fe, 0x000009fe, 0x000387fe, 0x00005bfe, 0x000394fe, 0x00005cfe,
+	0x00005dfe, 0x0003a6fe, 0x00005efe, 0x0003b2fe, 0x00005ffe, 0x000060fe, 0x0003c4fe, 0x000061fe,
+	0x0003d1fe, 0x000062fe, 0x000063fe, 0x0003e3fe, 0x000001ff, 0x000065ff, 0x0003f5ff, 0x000066ff,
+	0x000401ff, 0x000067ff, 0x000068ff, 0x000414ff, 0x000069ff, 0x000420ff, 0x00006aff, 0x00006bff,
+	0x000432ff, 0x00006cff, 0x00043eff, 0x00006dff, 0x00000bff, 0x000451ff, 0x00006fff, 0x00045dff,
+	0x000070ff, 0x000071ff, 0x00046fff, 0x000072ff, 0x000073ff, 0x000482ff, 0x000074ff, 0x00048eff,
+	0x000075ff, 0x000076ff, 0x0004a0ff, 0x000077ff, 0x0004acff, 0x00000cff, 0x000079ff, 0x0004bfff,
+	0x00007aff, 0x0004cbff, 0x00007bff, 0x00007cff, 0x0004ddff, 0x00007dff, 0x00007eff, 0x0004efff,
+	0x00007fff, 0x0004fcff, 0x000080ff, 0x000081ff, 0x00050eff, 0x00000dff, 0x00051aff, 0x000083ff,
+	0x000084ff, 0x00052cff, 0x000085ff, 0x000539ff, 0x000086ff, 0x000087ff, 0x00054bff, 0x000088ff,
+	0x000089ff, 0x00055dff, 0x00008aff, 0x000569ff, 0x00008bff, 0x00000eff, 0x00057cff, 0x00008dff,
+	0x000588ff, 0x00008eff, 0x00008fff, 0x00059aff, 0x000090ff, 0x0005a7ff, 0x000091ff, 0x000092ff,
+	0x0005b9ff, 0x000093ff, 0x000094ff, 0x0005cbff, 0x000095ff, 0x0005d7ff, 0x00000fff, 0x000097ff,
+	0x0005eaff, 0x000098ff, 0x0005f6ff, 0x000099ff, 0x00009aff, 0x000608ff, 0x00009bff, 0x000614ff,
+	0x00009cff, 0x00009dff, 0x00009fff, 0x000010ff, 0x0000a1ff, 0x0000a2ff, 0x0000a4ff, 0x0000a5ff,
+	0x0000a6ff, 0x0000a7ff, 0x0000a8ff, 0x000011ff, 0x0000abff, 0x0000acff, 0x0000adff, 0x0000afff,
+	0x0000b0ff, 0x0000b1ff, 0x0000b2ff, 0x000012ff, 0x0000b5ff, 0x0000b6ff, 0x0000b7ff, 0x0000b8ff,
+	0x0000baff, 0x0000bbff, 0x0000bcff, 0x0000bdff, 0x000013ff, 0x0000c0ff, 0x0000c1ff, 0x0000c2ff,
+	0x0000c3ff, 0x0000c5ff, 0x0000c6ff, 0x0000c7ff, 0x000002ff, 0x0000c9ff, 0x0000cbff, 0x0000ccff,
+	0x0000cdff, 0x0000ceff, 0x0000d0ff, 0x0000d1ff, 0x000015ff, 0x0000d3ff, 0x0000d4ff, 0x0000d6ff,
+	0x0000d7ff, 0x0000d8ff, 0x0000d9ff, 0x0000dbff, 0x000016ff, 0x0000ddff, 0x0000deff, 0x0000dfff,
+	0x0000e1ff, 0x0000e2ff, 0x0000e3ff, 0x0000e4ff, 0x000017ff, 0x0000e7ff, 0x0000e8ff, 0x0000e9ff,
+	0x0000eaff, 0x0000ecff, 0x0000edff, 0x0000eeff, 0x0000efff, 0x000018ff, 0x0000f2ff, 0x0000f3ff,
+	0x0000f4ff, 0x0000f5ff, 0x0000f7ff, 0x0000f8ff, 0x0000f9ff, 0x000019ff, 0x0000fbff, 0x0000fdff,
+	0x0000feff, 0x0000ffff, 0x000100ff, 0x000102ff, 0x000103ff, 0x00001aff, 0x000105ff, 0x000106ff,
+	0x000108ff, 0x000109ff, 0x00010aff, 0x00010bff, 0x00010dff, 0x00001bff, 0x00010fff, 0x000110ff,
+	0x000111ff, 0x000113ff, 0x000114ff, 0x000115ff, 0x000116ff, 0x00001cff, 0x000119ff, 0x00011aff,
+	0x00011bff, 0x00011cff, 0x00011eff, 0x00011fff, 0x000120ff, 0x000121ff, 0x00001dff, 0x000124ff,
+	0x000125ff, 0x000126ff, 0x000127ff, 0x000129ff, 0x00012aff, 0x00012bff, 0x000003ff, 0x00012eff,
+	0x00012fff, 0x000130ff, 0x000131ff, 0x000132ff, 0x000134ff, 0x000135ff, 0x00001fff, 0x000137ff,
+	0x000138ff, 0x00013bff, 0x00013dff, 0x000020ff, 0x000142ff, 0x000145ff, 0x000147ff, 0x000021ff,
+	0x00014cff, 0x00014eff, 0x000151ff, 0x000022ff, 0x000156ff, 0x000158ff, 0x00015bff, 0x000023ff,
+	0x000160ff, 0x000162ff, 0x000164ff, 0x000024ff, 0x000169ff, 0x00016cff, 0x00016eff, 0x000171ff,
+	0x000025ff, 0x000176ff, 0x000178ff, 0x00017aff, 0x000026ff, 0x00017fff, 0x000182ff, 0x000184ff,
+	0x000027ff, 0x000189ff, 0x00018cff, 0x00018eff, 0x000004ff, 0x000193ff, 0x000195ff, 0x000198ff,
+	0x000029ff, 0x00019dff, 0x00019fff, 0x0001a1ff, 0x00002aff, 0x0001a6ff, 0x0001a9ff, 0x0001abff,
+	0x00002bff, 0x0001b0ff, 0x0001b3ff, 0x0001b5ff, 0x00002cff, 0x0001baff, 0x0001bcff, 0x0001bfff,
+	0x00002dff, 0x0001c4ff, 0x0001c6ff, 0x0001c9ff, 0x00002eff, 0x0001cdff, 0x0001d0ff, 0x0001d2ff,
+	0x0001d5ff, 0x00002fff, 0x0001daff, 0x0001dcff, 0x0001dfff, 0x000030ff, 0x0001e3ff, 0x0001e6ff,
+	0x0001e8ff, 0x000031ff, 0x0001edff, 0x0001f0ff, 0x0001f2ff, 0x000005ff, 0x0001f7ff, 0x0001f9ff,
+	0x0001fcff, 0x000033ff, 0x000201ff, 0x000203ff, 0x000206ff, 0x000034ff, 0x00020aff, 0x00020dff,
+	0x00020fff, 0x000035ff, 0x000214ff, 0x000217ff, 0x000219ff, 0x000036ff, 0x00021eff, 0x000220ff,
+	0x000223ff, 0x000037ff, 0x000228ff, 0x00022aff, 0x00022dff, 0x000038ff, 0x000232ff, 0x000234ff,
+	0x000236ff, 0x000039ff, 0x00023bff, 0x00023eff, 0x000240ff, 0x000243ff, 0x00003aff, 0x000247ff,
+	0x00024aff, 0x00024cff, 0x00003bff, 0x000251ff, 0x000254ff, 0x000256ff, 0x000006ff, 0x00025bff,
+	0x00025dff, 0x000260ff, 0x00003dff, 0x000265ff, 0x000267ff, 0x00026aff, 0x00003eff, 0x00026fff,
+	0x000271ff, 0x00003fff, 0x00027bff, 0x000040ff, 0x000285ff, 0x000041ff, 0x00028eff, 0x000042ff,
+	0x000298ff, 0x000043ff, 0x0002a2ff, 0x000044ff, 0x0002acff, 0x000045ff, 0x0002b5ff, 0x000007ff,
+	0x0002bfff, 0x000047ff, 0x0002c9ff, 0x000048ff, 0x0002d3ff, 0x0002d8ff, 0x000049ff, 0x0002e1ff,
+	0x00004aff, 0x0002ebff, 0x00004bff, 0x0002f5ff, 0x00004cff, 0x0002ffff, 0x00004dff, 0x000308ff,
+	0x00004eff, 0x000312ff, 0x00004fff, 0x00031cff, 0x000008ff, 0x000326ff, 0x000051ff, 0x00032fff,
+	0x000052ff, 0x000339ff, 0x000053ff, 0x000343ff, 0x000054ff, 0x00034dff, 0x000055ff, 0x000356ff,
+	0x000056ff, 0x000360ff, 0x000057ff, 0x00036aff, 0x000058ff, 0x000374ff, 0x000059ff, 0x00037eff,
+	0x000009ff, 0x000387ff, 0x00005bff, 0x000391ff, 0x00005cff, 0x00039bff, 0x00005dff, 0x0003a5ff,
+	0x0003aaff, 0x00005eff, 0x0003b3ff, 0x00005fff, 0x0003bdff, 0x000060ff, 0x0003c7ff, 0x000061ff,
+	0x0003d1ff, 0x000062ff, 0x0003daff, 0x000063ff, 0x0003e4ff, 0x00000100, 0x0003ee00, 0x00006500,
+	0x0003f800, 0x00006600, 0x00040100, 0x00006700, 0x00040b00, 0x00006800, 0x00041500, 0x00006900,
+	0x00041f00, 0x00006a00, 0x00042800, 0x00006b00, 0x00043200, 0x00006c00, 0x00043c00, 0x00006d00,
+	0x00044600, 0x00000b00, 0x00045000, 0x00006f00, 0x00045900, 0x00007000, 0x00046300, 0x00007100,
+	0x00046d00, 0x00007200, 0x00047700, 0x00047b00, 0x00007300, 0x00048500, 0x00007400, 0x00048f00,
+	0x00007500, 0x00049900, 0x00007600, 0x0004a300, 0x00007700, 0x0004ac00, 0x00000c00, 0x0004b600,
+	0x00007900, 0x0004c000, 0x00007a00, 0x0004ca00, 0x00007b00, 0x0004d300, 0x00007c00, 0x0004dd00,
+	0x00007d00, 0x00007e00, 0x00007f00, 0x00008000, 0x00008100, 0x00000d00, 0x00008300, 0x00008400,
+	0x00008500, 0x00008600, 0x00008700, 0x00008800, 0x00008900, 0x00008a00, 0x00008b00, 0x00000e00,
+	0x00008d00, 0x00008e00, 0x00008f00, 0x00009000, 0x00009100, 0x0005af00, 0x00009200, 0x00009300,
+	0x00009400, 0x00009500, 0x00000f00, 0x00009700, 0x00009800, 0x00009900, 0x00009a00, 0x00009b00,
+	0x00009c00, 0x00009d00, 0x00009e00, 0x00009f00, 0x00001000, 0x0000a100, 0x0000a200, 0x0000a300,
+	0x0000a400, 0x0000a500, 0x0000a600, 0x0000a700, 0x0000a800, 0x0000a900, 0x00001100, 0x0000ab00,
+	0x0000ac00, 0x0000ad00, 0x0000ae00, 0x0000af00, 0x0000b000, 0x0000b100, 0x0000b200, 0x0000b300,
+	0x00001200, 0x0000b500, 0x0000b600, 0x0000b700, 0x0000b800, 0x0000b900, 0x0000ba00, 0x0000bb00,
+	0x00075300, 0x0000bc00, 0x0000bd00, 0x00001300, 0x0000bf00, 0x0000c000, 0x0000c100, 0x0000c200,
+	0x0000c300, 0x0000c400, 0x0000c500, 0x0000c600, 0x0000c700, 0x00000200, 0x0000c900, 0x0000ca00,
+	0x0000cb00, 0x0000cc00, 0x0000cd00, 0x0000ce00, 0x0000cf00, 0x0000d000, 0x0000d100, 0x00001500,
+	0x0000d300, 0x0000d400, 0x0000d500, 0x0000d600, 0x0000d700, 0x0000d800, 0x0000d900, 0x0000da00,
+	0x0000db00, 0x00001600, 0x0000dd00, 0x0000de00, 0x0000df00, 0x0000e000, 0x0000e100, 0x0000e200,
+	0x0000e300, 0x0000e400, 0x0000e500, 0x0008f700, 0x00001700, 0x0000e700, 0x0000e800, 0x0000e900,
+	0x0000ea00, 0x0000eb00, 0x0000ec00, 0x0000ed00, 0x0000ee00, 0x0000ef00, 0x00001800, 0x0000f100,
+	0x0000f200, 0x0000f300, 0x0000f400, 0x0000f500, 0x0000f600, 0x0000f700, 0x0000f800, 0x0000f900,
+	0x00001900, 0x0000fc00, 0x0000fe00, 0x00010000, 0x00010200, 0x00001a00, 0x00010600, 0x00010800,
+	0x00010a00, 0x00010c00, 0x00001b00, 0x00010f00, 0x00011100, 0x00011300, 0x00011500, 0x00001c00,
+	0x00011900, 0x00011b00, 0x00011d00, 0x00011f00, 0x00001d00, 0x00012300, 0x00012500, 0x00012700,
+	0x00012900, 0x00012b00, 0x00000300, 0x00012f00, 0x00013100, 0x00013300, 0x00013500, 0x00001f00,
+	0x00013800, 0x00013a00, 0x00013c00, 0x00013e00, 0x00002000, 0x00014200, 0x00014400, 0x00014600,
+	0x00014800, 0x00002100, 0x00014c00, 0x00014e00, 0x00015000, 0x00015200, 0x00002200, 0x00015600,
+	0x00015800, 0x00015a00, 0x00015c00, 0x00002300, 0x00016000, 0x00016200, 0x00016300, 0x00016500,
+	0x00002400, 0x00016900, 0x00016b00, 0x00016d00, 0x00016f00, 0x00002500, 0x00017300, 0x00017500,
+	0x00017700, 0x00017900, 0x00017b00, 0x00002600, 0x00017f00, 0x00018100, 0x00018300, 0x00018500,
+	0x00002700, 0x00018900, 0x00018b00, 0x00018c00, 0x00018e00, 0x00000400, 0x00019200, 0x00019400,
+	0x00019600, 0x00019800, 0x00002900, 0x00019c00, 0x00019e00, 0x0001a000, 0x0001a200, 0x00002a00,
+	0x0001a600, 0x0001a800, 0x0001aa00, 0x0001ac00, 0x00002b00, 0x0001b000, 0x0001b200, 0x0001b400,
+	0x0001b600, 0x00002c00, 0x0001b900, 0x0001bb00, 0x0001bd00, 0x0001bf00, 0x00002d00, 0x0001c300,
+	0x0001c500, 0x0001c700, 0x0001c900, 0x0001cb00, 0x00002e00, 0x0001cf00, 0x0001d100, 0x0001d300,
+	0x0001d500, 0x00002f00, 0x0001d900, 0x0001db00, 0x0001dd00, 0x0001df00, 0x00003000, 0x0001e200,
+	0x0001e400, 0x0001e600, 0x0001e800, 0x00003100, 0x0001ec00, 0x0001ee00, 0x0001f000, 0x0001f200,
+	0x00000500, 0x0001f800, 0x0001fc00, 0x00003300, 0x00020400, 0x00003400, 0x00020b00, 0x00020f00,
+	0x00003500, 0x00021700, 0x00003600, 0x00021f00, 0x00022300, 0x00003700, 0x00022b00, 0x00003800,
+	0x00023200, 0x00023600, 0x00003900, 0x00023e00, 0x00003a00, 0x00024600, 0x00024a00, 0x00003b00,
+	0x00025200, 0x00025600, 0x00000600, 0x00025d00, 0x00003d00, 0x00026500, 0x00026900, 0x00003e00,
+	0x00027100, 0x00003f00, 0x00027900, 0x00027d00, 0x00004000, 0x00028500, 0x00004100, 0x00028c00,
+	0x00029000, 0x00004200, 0x00029800, 0x00029c00, 0x00004300, 0x0002a400, 0x00004400, 0x0002ac00,
+	0x0002b000, 0x00004500, 0x0002b700, 0x00000700, 0x0002bf00, 0x0002c300, 0x00004700, 0x0002cb00,
+	0x00004800, 0x0002d300, 0x0002d700, 0x00004900, 0x0002de00, 0x00004a00, 0x0002e600, 0x0002ea00,
+	0x00004b00, 0x0002f200, 0x0002f600, 0x00004c00, 0x0002fe00, 0x00004d00, 0x00030500, 0x00030900,
+	0x00004e00, 0x00031100, 0x00004f00, 0x00031900, 0x00031d00, 0x00000800, 0x00032500, 0x00005100,
+	0x00032c00, 0x00033000, 0x00005200, 0x00033800, 0x00005300, 0x00034000, 0x00034400, 0x00005400,
+	0x00034c00, 0x00035000, 0x00005500, 0x00035700, 0x00005600, 0x00035f00, 0x00036300, 0x00005700,
+	0x00036b00, 0x00005800, 0x00037300, 0x00037700, 0x00005900, 0x00037f00, 0x00000900, 0x00038600,
+	0x00038a00, 0x00005b00, 0x00039200, 0x00039600, 0x00005c00, 0x00039e00, 0x00005d00, 0x0003a600,
+	0x0003aa00, 0x00005e00, 0x0003b100, 0x00005f00, 0x0003b900, 0x0003bd00, 0x00006000, 0x0003c500,
+	0x00006100, 0x0003cd00, 0x0003d100, 0x00006200, 0x0003d800, 0x00006300, 0x0003e000, 0x0003e400,
+	0x00000101, 0x00006501, 0x0003f801, 0x00006601, 0x00006701, 0x00006801, 0x00006901, 0x00041f01,
+	0x00006a01, 0x00006b01, 0x00006c01, 0x00043e01, 0x00006d01, 0x00000b01, 0x00006f01, 0x00007001,
+	0x00046501, 0x00007101, 0x00007201, 0x00007301, 0x00007401, 0x00048c01, 0x00007501, 0x00007601,
+	0x00007701, 0x0004ab01, 0x00000c01, 0x00007901, 0x00007a01, 0x00007b01, 0x0004d201, 0x00007c01,
+	0x00007d01, 0x00007e01, 0x0004f201, 0x00007f01, 0x00008001, 0x00008101, 0x00000d01, 0x00051901,
+	0x00008301, 0x00008401, 0x00008501, 0x00053801, 0x00008601, 0x00008701, 0x00008801, 0x00008901,
+	0x00055f01, 0x00008a01, 0x00008b01, 0x00000e01, 0x00008d01, 0x00058601, 0x00008e01, 0x00008f01,
+	0x00009001, 0x0005a501, 0x00009101, 0x00009201, 0x00009301, 0x00009401, 0x0005cc01, 0x00009501,
+	0x00000f01, 0x00009701, 0x0005ec01, 0x00009801, 0x00009901, 0x00009a01, 0x00009b01, 0x00061301,
+	0x00009c01, 0x00009d01, 0x00009e01, 0x00063201, 0x00009f01, 0x00001001, 0x0000a101, 0x0000a201,
+	0x00065901, 0x0000a301, 0x0000a401, 0x0000a501, 0x0000a601, 0x00068001, 0x0000a701, 0x0000a801,
+	0x0000a901, 0x00069f01, 0x00001101, 0x0000ab01, 0x0000ac01, 0x0000ad01, 0x0006c601, 0x0000ae01,
+	0x0000af01, 0x0000b001, 0x0006e601, 0x0000b101, 0x0000b201, 0x0000b301, 0x00001201, 0x00070d01,
+	0x0000b501, 0x0000b601, 0x0000b701, 0x00072c01, 0x0000b801, 0x0000b901, 0x0000ba01, 0x0000bb01,
+	0x00075301, 0x0000bc01, 0x0000bd01, 0x00001301, 0x0000bf01, 0x00077a01, 0x0000c001, 0x0000c101,
+	0x0000c201, 0x00079901, 0x0000c301, 0x0000c401, 0x0000c501, 0x0000c601, 0x0007c001, 0x0000c701,
+	0x00000201, 0x0000ca01, 0x0000cb01, 0x0000cd01, 0x0000ce01, 0x0000d001, 0x00001501, 0x0000d301,
+	0x0000d401, 0x0000d601, 0x0000d801, 0x0000d901, 0x0000db01, 0x00001601, 0x0000de01, 0x0000df01,
+	0x0000e101, 0x0000e301, 0x0000e401, 0x00001701, 0x0000e701, 0x0000e901, 0x0000ea01, 0x0000ec01,
+	0x0000ee01, 0x0000ef01, 0x00001801, 0x0000f201, 0x0000f401, 0x0000f501, 0x0000f701, 0x0000f801,
+	0x00001901, 0x0000fc01, 0x0000fd01, 0x0000ff01, 0x00010001, 0x00010201, 0x00001a01, 0x00010501,
+	0x00010601, 0x00010801, 0x00010a01, 0x00010b01, 0x00010d01, 0x00001b01, 0x00011001, 0x00011101,
+	0x00011301, 0x00011501, 0x00011601, 0x00001c01, 0x00011901, 0x00011b01, 0x00011c01, 0x00011e01,
+	0x00012001, 0x00012101, 0x00001d01, 0x00012401, 0x00012601, 0x00012701, 0x00012901, 0x00012a01,
+	0x00000301, 0x00012e01, 0x00012f01, 0x00013101, 0x00013201, 0x00013401, 0x00001f01, 0x00013701,
+	0x00013801, 0x00013a01, 0x00013c01, 0x00013d01, 0x00013f01, 0x00002001, 0x00014201, 0x00014301,
+	0x00014501, 0x00014701, 0x00014801, 0x00002101, 0x00014b01, 0x00014d01, 0x00014e01, 0x00015001,
+	0x00015201, 0x00015301, 0x00002201, 0x00015601, 0x00015801, 0x00015901, 0x00015b01, 0x00015c01,
+	0x00002301, 0x00016001, 0x00016101, 0x00016301, 0x00016401, 0x00016601, 0x00002401, 0x00016901,
+	0x00016a01, 0x00016c01, 0x00016e01, 0x00016f01, 0x00017101, 0x00002501, 0x00017401, 0x00017501,
+	0x00017701, 0x00017901, 0x00017a01, 0x00002601, 0x00017d01, 0x00017f01, 0x00018001, 0x00018201,
+	0x00018401, 0x00018501, 0x00002701, 0x00018801, 0x00018a01, 0x00018b01, 0x00018d01, 0x00018e01,
+	0x00000401, 0x00019301, 0x00019601, 0x00002901, 0x00019c01, 0x0001a001, 0x00002a01, 0x0001a601,
+	0x0001a901, 0x0001ac01, 0x00002b01, 0x0001b201, 0x0001b601, 0x00002c01, 0x0001bc01, 0x0001bf01,
+	0x00002d01, 0x0001c501, 0x0001c801, 0x00002e01, 0x0001ce01, 0x0001d201, 0x00002f01, 0x0001d801,
+	0x0001db01, 0x0001de01, 0x00003001, 0x0001e401, 0x0001e801, 0x00003101, 0x0001ee01, 0x0001f101,
+	0x00000501, 0x0001f701, 0x0001fa01, 0x00003301, 0x00020001, 0x00020401, 0x00003401, 0x00020a01,
+	0x00020d01, 0x00021001, 0x00003501, 0x00021601, 0x00021a01, 0x00003601, 0x00022001, 0x00022301,
+	0x00003701, 0x00022901, 0x00022c01, 0x00003801, 0x00023201, 0x00023601, 0x00003901, 0x00023c01,
+	0x00023f01, 0x00024201, 0x00003a01, 0x00024801, 0x00024c01, 0x00003b01, 0x00025201, 0x00025501,
+	0x00000601, 0x00025b01, 0x00025e01, 0x00003d01, 0x00026401, 0x00026801, 0x00003e01, 0x00026e01,
+	0x00027101, 0x00027401, 0x00003f01, 0x00027a01, 0x00027e01, 0x00004001, 0x00028401, 0x00028701,
+	0x00004101, 0x00028d01, 0x00029001, 0x00004201, 0x00029601, 0x00029a01, 0x00004301, 0x0002a001,
+	0x0002a301, 0x0002a601, 0x00004401, 0x0002ac01, 0x0002b001, 0x00004501, 0x0002b601, 0x0002b901,
+	0x00000701, 0x0002bf01, 0x0002c201, 0x00004701, 0x0002c801, 0x0002cc01, 0x00004801, 0x0002d201,
+	0x0002d501, 0x0002d801, 0x00004901, 0x0002de01, 0x0002e201, 0x00004a01, 0x0002e801, 0x0002eb01,
+	0x00004b01, 0x0002f101, 0x0002f401, 0x00004c01, 0x0002fa01, 0x0002fe01, 0x00004d01, 0x00030401,
+	0x00030701, 0x00030a01, 0x00004e01, 0x00031001, 0x00031401, 0x00004f01, 0x00031a01, 0x00031d01,
+	0x00000801, 0x00032601, 0x00005101, 0x00005201, 0x00033901, 0x00005301, 0x00005401, 0x00034c01,
+	0x00005501, 0x00035801, 0x00005601, 0x00005701, 0x00036b01, 0x00005801, 0x00005901, 0x00037e01,
+	0x00000901, 0x00038a01, 0x00005b01, 0x00005c01, 0x00039d01, 0x00005d01, 0x00005e01, 0x0003b001,
+	0x00005f01, 0x0003bc01, 0x00006001, 0x00006101, 0x0003cf01, 0x00006201, 0x00006301, 0x0003e201,
+	0x00000102, 0x0003ee02, 0x00006502, 0x00006602, 0x00040102, 0x00006702, 0x00006802, 0x00041402,
+	0x00006902, 0x00042002, 0x00006a02, 0x00006b02, 0x00043302, 0x00006c02, 0x00006d02, 0x00044602,
+	0x00000b02, 0x00045202, 0x00006f02, 0x00007002, 0x00046502, 0x00007102, 0x00007202, 0x00047802,
+	0x00007302, 0x00048402, 0x00007402, 0x00007502, 0x00049702, 0x00007602, 0x00007702, 0x0004aa02,
+	0x00000c02, 0x0004b602, 0x00007902, 0x00007a02, 0x0004c902, 0x00007b02, 0x00007c02, 0x0004dc02,
+	0x00007d02, 0x0004e802, 0x00007e02, 0x00007f02, 0x0004fb02, 0x00008002, 0x00008102, 0x00050e02,
+	0x00000d02, 0x00051a02, 0x00008302, 0x00008402, 0x00052d02, 0x00008502, 0x00008602, 0x00054002,
+	0x00008702, 0x00054c02, 0x00008802, 0x00008902, 0x00055f02, 0x00008a02, 0x00008b02, 0x00057202,
+	0x00000e02, 0x00057e02, 0x00008d02, 0x00008e02, 0x00059102, 0x00008f02, 0x00009002, 0x0005a402,
+	0x00009102, 0x0005b002, 0x00009202, 0x00009302, 0x0005c302, 0x00009402, 0x00009502, 0x0005d602,
+	0x00000f02, 0x0005e202, 0x00009702, 0x00009802, 0x0005f502, 0x00009902, 0x00009a02, 0x00060802,
+	0x00009b02, 0x00061402, 0x00009c02, 0x00009d02, 0x00062702, 0x00009e02, 0x00009f02, 0x00063a02,
+	0x00001002, 0x0000a102, 0x0000a202, 0x0000a402, 0x0000a502, 0x0000a602, 0x0000a802, 0x0000a902,
+	0x00001102, 0x0000ab02, 0x0000ac02, 0x0000ae02, 0x0000af02, 0x0000b002, 0x0000b202, 0x0000b302,
+	0x00001202, 0x0000b502, 0x0000b602, 0x0000b802, 0x0000b902, 0x0000ba02, 0x0000bc02, 0x0000bd02,
+	0x00001302, 0x0000bf02, 0x0000c002, 0x0000c202, 0x0000c302, 0x0000c402, 0x0000c602, 0x0000c702,
+	0x00000202, 0x0000c902, 0x0000ca02, 0x0000cc02, 0x0000cd02, 0x0000ce02, 0x0000d002, 0x0000d102,
+	0x00001502, 0x0000d302, 0x0000d402, 0x0000d602, 0x0000d702, 0x0000d802, 0x0000da02, 0x0000db02,
+	0x00001602, 0x0000dd02, 0x0000de02, 0x0000e002, 0x0000e102, 0x0000e202, 0x0000e402, 0x0000e502,
+	0x00001702, 0x0000e702, 0x0000e802, 0x0000ea02, 0x0000eb02, 0x0000ec02, 0x0000ee02, 0x0000ef02,
+	0x00001802, 0x0000f102, 0x0000f202, 0x0000f402, 0x0000f502, 0x0000f602, 0x0000f802, 0x0000f902,
+	0x00001902, 0x0000fb02, 0x0000fc02, 0x0000fe02, 0x0000ff02, 0x00010002, 0x00010202, 0x00010302,
+	0x00001a02, 0x00010502, 0x00010602, 0x00010802, 0x00010902, 0x00010a02, 0x00010c02, 0x00010d02,
+	0x00001b02, 0x00010f02, 0x00011002, 0x00011202, 0x00011302, 0x00011402, 0x00011602, 0x00011702,
+	0x00001c02, 0x00011902, 0x00011a02, 0x00011c02, 0x00011d02, 0x00011e02, 0x00012002, 0x00012102,
+	0x00001d02, 0x00012302, 0x00012402, 0x00012602, 0x00012702, 0x00012802, 0x00012a02, 0x00012b02,
+	0x00000302, 0x00012d02, 0x00012e02, 0x00013002, 0x00013102, 0x00013202, 0x00013402, 0x00013502,
+	0x00001f02, 0x00013702, 0x00013802, 0x00013a02, 0x00013b02, 0x00013c02, 0x00013e02, 0x00013f02,
+	0x00002002, 0x00014202, 0x00014502, 0x00014802, 0x00002102, 0x00014c02, 0x00014f02, 0x00015202,
+	0x00002202, 0x00015602, 0x00015902, 0x00015c02, 0x00002302, 0x00016002, 0x00016302, 0x00016602,
+	0x00002402, 0x00016a02, 0x00016d02, 0x00017002, 0x00002502, 0x00017402, 0x00017702, 0x00017a02,
+	0x00002602, 0x00017e02, 0x00018102, 0x00018402, 0x00002702, 0x00018802, 0x00018b02, 0x00018e02,
+	0x00000402, 0x00019202, 0x00019502, 0x00019802, 0x00002902, 0x00019c02, 0x00019f02, 0x0001a202,
+	0x00002a02, 0x0001a602, 0x0001a902, 0x0001ac02, 0x00002b02, 0x0001b002, 0x0001b302, 0x0001b602,
+	0x00002c02, 0x0001ba02, 0x0001bd02, 0x0001c002, 0x00002d02, 0x0001c402, 0x0001c702, 0x0001ca02,
+	0x00002e02, 0x0001ce02, 0x0001d102, 0x0001d402, 0x00002f02, 0x0001d802, 0x0001db02, 0x0001de02,
+	0x00003002, 0x0001e202, 0x0001e502, 0x0001e802, 0x00003102, 0x0001ec02, 0x0001ef02, 0x0001f202,
+	0x00000502, 0x0001f602, 0x0001f902, 0x0001fc02, 0x00003302, 0x00020002, 0x00020302, 0x00020602,
+	0x00003402, 0x00020a02, 0x00020d02, 0x00021002, 0x00003502, 0x00021402, 0x00021702, 0x00021a02,
+	0x00003602, 0x00021e02, 0x00022102, 0x00022402, 0x00003702, 0x00022802, 0x00022b02, 0x00022e02,
+	0x00003802, 0x00023202, 0x00023502, 0x00023802, 0x00003902, 0x00023c02, 0x00023f02, 0x00024202,
+	0x00003a02, 0x00024602, 0x00024902, 0x00024c02, 0x00003b02, 0x00025002, 0x00025302, 0x00025602,
+	0x00000602, 0x00025a02, 0x00025d02, 0x00026002, 0x00003d02, 0x00026402, 0x00026702, 0x00026a02,
+	0x00003e02, 0x00026e02, 0x00027102, 0x00027402, 0x00003f02, 0x00027802, 0x00027b02, 0x00027e02,
+	0x00004002, 0x00028502, 0x00004102, 0x00028f02, 0x00004202, 0x00029902, 0x00004302, 0x0002a302,
+	0x00004402, 0x0002ad02, 0x00004502, 0x0002b702, 0x00000702, 0x0002c102, 0x00004702, 0x0002cb02,
+	0x00004802, 0x0002d502, 0x00004902, 0x0002df02, 0x00004a02, 0x0002e902, 0x00004b02, 0x0002f302,
+	0x00004c02, 0x0002fd02, 0x00004d02, 0x00030702, 0x00004e02, 0x00031102, 0x00004f02, 0x00031b02,
+	0x00000802, 0x00032502, 0x00005102, 0x00032f02, 0x00005202, 0x00033902, 0x00005302, 0x00034302,
+	0x00005402, 0x00034d02, 0x00005502, 0x00035702, 0x00005602, 0x00036102, 0x00005702, 0x00036b02,
+	0x00005802, 0x00037502, 0x00005902, 0x00037f02, 0x00000902, 0x00038902, 0x00005b02, 0x00039302,
+	0x00005c02, 0x00039d02, 0x00005d02, 0x0003a702, 0x00005e02, 0x0003b102, 0x00005f02, 0x0003bb02,
+	0x00006002, 0x0003c502, 0x00006102, 0x0003cf02, 0x00006202, 0x0003d902, 0x00006302, 0x0003e302,
+	0x00000103, 0x0003ed03, 0x00006503, 0x0003f703, 0x00006603, 0x00040103, 0x00006703, 0x00040b03,
+	0x00006803, 0x00041503, 0x00006903, 0x00041f03, 0x00006a03, 0x00042903, 0x00006b03, 0x00043303,
+	0x00006c03, 0x00043d03, 0x00006d03, 0x00044703, 0x00000b03, 0x00045103, 0x00006f03, 0x00045b03,
+	0x00007003, 0x00046503, 0x00007103, 0x00046f03, 0x00007203, 0x00047903, 0x00007303, 0x00048303,
+	0x00007403, 0x00048d03, 0x00007503, 0x00049703, 0x00007603, 0x0004a103, 0x00007703, 0x0004ab03,
+	0x00000c03, 0x0004b503, 0x00007903, 0x0004bf03, 0x00007a03, 0x0004c903, 0x00007b03, 0x0004d303,
+	0x00007c03, 0x0004dd03, 0x00007d03, 0x0004e703, 0x00007e03, 0x0004f103, 0x00007f03, 0x0004fb03,
+	0x00008003, 0x00008103, 0x00000d03, 0x00008303, 0x00008403, 0x00008503, 0x00008603, 0x00008703,
+	0x00008803, 0x00008903, 0x00008a03, 0x00008b03, 0x00000e03, 0x00008d03, 0x00008e03, 0x00008f03,
+	0x00009003, 0x00009103, 0x00009203, 0x00009303, 0x00009403, 0x00009503, 0x00000f03, 0x00009703,
+	0x00009803, 0x00009903, 0x00009a03, 0x00009b03, 0x00009c03, 0x00009d03, 0x00009e03, 0x00009f03,
+	0x00001003, 0x0000a103, 0x0000a203, 0x0000a303, 0x0000a403, 0x0000a503, 0x0000a603, 0x0000a703,
+	0x0000a803, 0x0000a903, 0x00001103, 0x0000ab03, 0x0000ac03, 0x0000ad03, 0x0000ae03, 0x0000af03,
+	0x0000b003, 0x0000b103, 0x0000b203, 0x0000b303, 0x00001203, 0x0000b503, 0x0000b603, 0x0000b703,
+	0x0000b803, 0x0000b903, 0x0000ba03, 0x0000bb03, 0x0000bc03, 0x0000bd03, 0x00001303, 0x0000bf03,
+	0x0000c003, 0x0000c103, 0x0000c203, 0x0000c303, 0x0000c403, 0x0000c503, 0x0000c603, 0x0000c703,
+	0x00000203, 0x0000c903, 0x0000ca03, 0x0000cb03, 0x0000cc03, 0x0000cd03, 0x0000ce03, 0x0000cf03,
+	0x0000d003, 0x0000d103, 0x00001503, 0x0000d303, 0x0000d403, 0x0000d503, 0x0000d603, 0x0000d703,
+	0x0000d803, 0x0000d903, 0x0000da03, 0x0000db03, 0x00001603, 0x0000dd03, 0x0000de03, 0x0000df03,
+	0x0000e003, 0x0000e103, 0x0000e203, 0x0000e303, 0x0000e403, 0x0000e503, 0x00001703, 0x0000e703,
+	0x0000e803, 0x0000e903, 0x0000ea03, 0x0000eb03, 0x0000ec03, 0x0000ed03, 0x0000ee03, 0x0000ef03,
+	0x00001803, 0x0000f103, 0x0000f203, 0x0000f303, 0x0000f403, 0x0000f503, 0x0000f603, 0x0000f703,
+	0x0000f803, 0x0000f903, 0x00001903, 0x0000fb03, 0x0000fc03, 0x0000fd03, 0x0000fe03, 0x0000ff03,
+	0x00010003, 0x00010203, 0x00001a03, 0x00010603, 0x00010803, 0x00010a03, 0x00010c03, 0x00001b03,
+	0x00011003, 0x00011203, 0x00011403, 0x00011603, 0x00001c03, 0x00011a03, 0x00011c03, 0x00011e03,
+	0x00012003, 0x00001d03, 0x00012403, 0x00012603, 0x00012803, 0x00012a03, 0x00000303, 0x00012e03,
+	0x00013003, 0x00013203, 0x00013403, 0x00001f03, 0x00013803, 0x00013a03, 0x00013c03, 0x00013e03,
+	0x00002003, 0x00014203, 0x00014403, 0x00014603, 0x00014803, 0x00002103, 0x00014c03, 0x00014e03,
+	0x00015003, 0x00015203, 0x00002203, 0x00015603, 0x00015803, 0x00015a03, 0x00015c03, 0x00002303,
+	0x00016003, 0x00016203, 0x00016403, 0x00016603, 0x00002403, 0x00016a03, 0x00016c03, 0x00016e03,
+	0x00017003, 0x00002503, 0x00017403, 0x00017603, 0x00017803, 0x00017a03, 0x00002603, 0x00017e03,
+	0x00018003, 0x00018203, 0x00018403, 0x00002703, 0x00018803, 0x00018a03, 0x00018c03, 0x00018e03,
+	0x00000403, 0x00019203, 0x00019403, 0x00019603, 0x00019803, 0x00002903, 0x00019c03, 0x00019e03,
+	0x0001a003, 0x0001a203, 0x00002a03, 0x0001a603, 0x0001a803, 0x0001aa03, 0x0001ac03, 0x00002b03,
+	0x0001b003, 0x0001b203, 0x0001b403, 0x0001b603, 0x00002c03, 0x0001ba03, 0x0001bc03, 0x0001be03,
+	0x0001c003, 0x00002d03, 0x0001c403, 0x0001c603, 0x0001c803, 0x0001ca03, 0x00002e03, 0x0001ce03,
+	0x0001d003, 0x0001d203, 0x0001d403, 0x00002f03, 0x0001d803, 0x0001da03, 0x0001dc03, 0x0001de03,
+	0x00003003, 0x0001e203, 0x0001e403, 0x0001e603, 0x0001e803, 0x00003103, 0x0001ec03, 0x0001ee03,
+	0x0001f003, 0x0001f203, 0x00000503, 0x0001f603, 0x0001f803, 0x0001fa03, 0x0001fc03, 0x00003303,
+	0x00020003, 0x00020403, 0x00003403, 0x00020c03, 0x00003503, 0x00021403, 0x00021803, 0x00003603,
+	0x00022003, 0x00022403, 0x00003703, 0x00022c03, 0x00003803, 0x00023403, 0x00003903, 0x00023c03,
+	0x00024003, 0x00003a03, 0x00024803, 0x00024c03, 0x00003b03, 0x00025403, 0x00000603, 0x00025c03,
+	0x00003d03, 0x00026403, 0x00026803, 0x00003e03, 0x00027003, 0x00027403, 0x00003f03, 0x00027c03,
+	0x00004003, 0x00028403, 0x00004103, 0x00028c03, 0x00029003, 0x00004203, 0x00029803, 0x00029c03,
+	0x00004303, 0x0002a403, 0x00004403, 0x0002ac03, 0x00004503, 0x0002b403, 0x0002b803, 0x00000703,
+	0x0002c003, 0x0002c403, 0x00004703, 0x0002cc03, 0x00004803, 0x0002d403, 0x00004903, 0x0002dc03,
+	0x0002e003, 0x00004a03, 0x0002e803, 0x0002ec03, 0x00004b03, 0x0002f403, 0x00004c03, 0x0002fc03,
+	0x00004d03, 0x00030403, 0x00030803, 0x00004e03, 0x00031003, 0x00031403, 0x00004f03, 0x00031c03,
+	0x00000803, 0x00032403, 0x00005103, 0x00032c03, 0x00033003, 0x00005203, 0x00033803, 0x00033c03,
+	0x00005303, 0x00034403, 0x00005403, 0x00034c03, 0x00005503, 0x00035403, 0x00035803, 0x00005603,
+	0x00036003, 0x00036403, 0x00005703, 0x00036c03, 0x00005803, 0x00037403, 0x00005903, 0x00037c03,
+	0x00038003, 0x00000903, 0x00038803, 0x00038c03, 0x00005b03, 0x00039403, 0x00005c03, 0x00039c03,
+	0x00005d03, 0x0003a403, 0x0003a803, 0x00005e03, 0x0003b003, 0x0003b403, 0x00005f03, 0x0003bc03,
+	0x00006003, 0x0003c403, 0x00006103, 0x0003cc03, 0x0003d003, 0x00006203, 0x0003d803, 0x0003dc03,
+	0x00006303, 0x0003e403, 0x00000104, 0x0003ec04, 0x00006504, 0x0003f404, 0x0003f804, 0x00006604,
+	0x00040004, 0x00006704, 0x00006804, 0x00006904, 0x00006a04, 0x00042804, 0x00006b04, 0x00006c04,
+	0x00006d04, 0x00044804, 0x00000b04, 0x00006f04, 0x00007004, 0x00007104, 0x00007204, 0x00047804,
+	0x00007304, 0x00007404, 0x00007504, 0x00049804, 0x00007604, 0x00007704, 0x00000c04, 0x00007904,
+	0x00007a04, 0x0004c804, 0x00007b04, 0x00007c04, 0x00007d04, 0x0004e804, 0x00007e04, 0x00007f04,
+	0x00008004, 0x00008104, 0x00000d04, 0x00051804, 0x00008304, 0x00008404, 0x00008504, 0x00053804,
+	0x00008604, 0x00008704, 0x00008804, 0x00008904, 0x00008a04, 0x00056804, 0x00008b04, 0x00000e04,
+	0x00008d04, 0x00058804, 0x00008e04, 0x00008f04, 0x00009004, 0x00009104, 0x00009204, 0x0005b804,
+	0x00009304, 0x00009404, 0x00009504, 0x0005d804, 0x00000f04, 0x00009704, 0x00009804, 0x00009904,
+	0x00009a04, 0x00060804, 0x00009b04, 0x00009c04, 0x00009d04, 0x00062804, 0x00009e04, 0x00009f04,
+	0x00001004, 0x0000a104, 0x0000a204, 0x00065804, 0x0000a304, 0x0000a404, 0x0000a504, 0x00067804,
+	0x0000a604, 0x0000a704, 0x0000a804, 0x0000a904, 0x00001104, 0x0006a804, 0x0000ab04, 0x0000ac04,
+	0x0000ad04, 0x0006c804, 0x0000ae04, 0x0000af04, 0x0000b004, 0x0000b104, 0x0000b204, 0x0006f804,
+	0x0000b304, 0x00001204, 0x0000b504, 0x00071804, 0x0000b604, 0x0000b704, 0x0000b804, 0x0000b904,
+	0x0000ba04, 0x00074804, 0x0000bb04, 0x0000bc04, 0x0000bd04, 0x00076804, 0x00001304, 0x0000bf04,
+	0x0000c004, 0x0000c104, 0x0000c204, 0x00079804, 0x0000c304, 0x0000c404, 0x0000c504, 0x0007b804,
+	0x0000c604, 0x0000c704, 0x00000204, 0x0000c904, 0x0000ca04, 0x0007e804, 0x0000cb04, 0x0000cc04,
+	0x0000cd04, 0x0000ce04, 0x0000d004, 0x00001504, 0x0000d304, 0x0000d504, 0x0000d604, 0x0000d804,
+	0x0000da04, 0x0000db04, 0x00001604, 0x0000de04, 0x0000e004, 0x0000e204, 0x0000e304, 0x0000e504,
+	0x00001704, 0x0000e804, 0x0000ea04, 0x0000eb04, 0x0000ed04, 0x0000ee04, 0x00001804, 0x0000f204,
+	0x0000f304, 0x0000f504, 0x0000f604, 0x0000f804, 0x00001904, 0x0000fb04, 0x0000fd04, 0x0000fe04,
+	0x00010004, 0x00010204, 0x00001a04, 0x00010504, 0x00010604, 0x00010804, 0x00010a04, 0x00010b04,
+	0x00010d04, 0x00001b04, 0x00011004, 0x00011204, 0x00011304, 0x00011504, 0x00011604, 0x00001c04,
+	0x00011a04, 0x00011b04, 0x00011d04, 0x00011e04, 0x00012004, 0x00001d04, 0x00012304, 0x00012504,
+	0x00012604, 0x00012804, 0x00012a04, 0x00012b04, 0x00000304, 0x00012e04, 0x00013004, 0x00013204,
+	0x00013304, 0x00013504, 0x00001f04, 0x00013804, 0x00013a04, 0x00013b04, 0x00013d04, 0x00013e04,
+	0x00002004, 0x00014204, 0x00014304, 0x00014504, 0x00014604, 0x00014804, 0x00002104, 0x00014b04,
+	0x00014d04, 0x00014e04, 0x00015004, 0x00015204, 0x00002204, 0x00015504, 0x00015604, 0x00015804,
+	0x00015a04, 0x00015b04, 0x00015d04, 0x00002304, 0x00016004, 0x00016204, 0x00016304, 0x00016504,
+	0x00016604, 0x00002404, 0x00016a04, 0x00016b04, 0x00016d04, 0x00016e04, 0x00017004, 0x00002504,
+	0x00017304, 0x00017504, 0x00017604, 0x00017804, 0x00017a04, 0x00017b04, 0x00002604, 0x00017e04,
+	0x00018004, 0x00018204, 0x00018304, 0x00018504, 0x00002704, 0x00018804, 0x00018a04, 0x00018b04,
+	0x00018d04, 0x00018e04, 0x00000404, 0x00019204, 0x00019304, 0x00019504, 0x00019604, 0x00019804,
+	0x00002904, 0x00019d04, 0x0001a004, 0x00002a04, 0x0001a604, 0x0001aa04, 0x00002b04, 0x0001b004,
+	0x0001b304, 0x0001b604, 0x00002c04, 0x0001bd04, 0x0001c004, 0x00002d04, 0x0001c604, 0x0001ca04,
+	0x00002e04, 0x0001d004, 0x0001d304, 0x00002f04, 0x0001da04, 0x0001dd04, 0x00003004, 0x0001e304,
+	0x0001e604, 0x00003104, 0x0001ed04, 0x0001f004, 0x00000504, 0x0001f604, 0x0001fa04, 0x00003304,
+	0x00020004, 0x00020304, 0x00003404, 0x00020a04, 0x00020d04, 0x00021004, 0x00003504, 0x00021604,
+	0x00021a04, 0x00003604, 0x00022004, 0x00022304, 0x00003704, 0x00022a04, 0x00022d04, 0x00003804,
+	0x00023304, 0x00023604, 0x00003904, 0x00023d04, 0x00024004, 0x00003a04, 0x00024604, 0x00024a04,
+	0x00003b04, 0x00025004, 0x00025304, 0x00025604, 0x00000604, 0x00025d04, 0x00026004, 0x00003d04,
+	0x00026604, 0x00026a04, 0x00003e04, 0x00027004, 0x00027304, 0x00003f04, 0x00027a04, 0x00027d04,
+	0x00004004, 0x00028304, 0x00028604, 0x00004104, 0x00028d04, 0x00029004, 0x00004204, 0x00029604,
+	0x00029a04, 0x00004304, 0x0002a004, 0x0002a304, 0x00004404, 0x0002aa04, 0x0002ad04, 0x0002b004,
+	0x00004504, 0x0002b604, 0x0002ba04, 0x00000704, 0x0002c004, 0x0002c304, 0x00004704, 0x0002ca04,
+	0x0002cd04, 0x00004804, 0x0002d304, 0x0002d604, 0x00004904, 0x0002dd04, 0x0002e004, 0x00004a04,
+	0x0002e604, 0x0002ea04, 0x00004b04, 0x0002f004, 0x0002f304, 0x0002f604, 0x00004c04, 0x0002fd04,
+	0x00030004, 0x00004d04, 0x00030604, 0x00030a04, 0x00004e04, 0x00031004, 0x00031304, 0x00004f04,
+	0x00031a04, 0x00031d04, 0x00000804, 0x00032304, 0x00032604, 0x00005104, 0x00032d04, 0x00033004,
+	0x00005204, 0x00033a04, 0x00005304, 0x00005404, 0x00034d04, 0x00005504, 0x00005604, 0x00036004,
+	0x00005704, 0x00036d04, 0x00005804, 0x00005904, 0x00038004, 0x00000904, 0x00005b04, 0x00039304,
+	0x00005c04, 0x00005d04, 0x0003a604, 0x00005e04, 0x00005f04, 0x0003ba04, 0x00006004, 0x0003c604,
+	0x00006104, 0x00006204, 0x0003da04, 0x00006304, 0x00000105, 0x0003ed05, 0x00006505, 0x00006605,
+	0x00040005, 0x00006705, 0x00006805, 0x00041305, 0x00006905, 0x00042005, 0x00006a05, 0x00006b05,
+	0x00043305, 0x00006c05, 0x00006d05, 0x00044605, 0x00000b05, 0x00006f05, 0x00045a05, 0x00007005,
+	0x00046605, 0x00007105, 0x00007205, 0x00047a05, 0x00007305, 0x00007405, 0x00048d05, 0x00007505,
+	0x00007605, 0x0004a005, 0x00007705, 0x0004ad05, 0x00000c05, 0x00007905, 0x0004c005, 0x00007a05,
+	0x00007b05, 0x0004d305, 0x00007c05, 0x00007d05, 0x0004e605, 0x00007e05, 0x00007f05, 0x0004fa05,
+	0x00008005, 0x00050605, 0x00008105, 0x00000d05, 0x00051a05, 0x00008305, 0x00008405, 0x00052d05,
+	0x00008505, 0x00008605, 0x00054005, 0x00008705, 0x00008805, 0x00055305, 0x00008905, 0x00056005,
+	0x00008a05, 0x00008b05, 0x00057305, 0x00000e05, 0x00008d05, 0x00058605, 0x00008e05, 0x00008f05,
+	0x00059a05, 0x00009005, 0x0005a605, 0x00009105, 0x00009205, 0x0005ba05, 0x00009305, 0x00009405,
+	0x0005cd05, 0x00009505, 0x00000f05, 0x0005e005, 0x00009705, 0x0005ed05, 0x00009805, 0x00009905,
+	0x00060005, 0x00009a05, 0x00009b05, 0x00061305, 0x00009c05, 0x00009d05, 0x00062605, 0x00009e05,
+	0x00009f05, 0x00063a05, 0x00001005, 0x00064605, 0x0000a105, 0x0000a205, 0x00065a05, 0x0000a305,
+	0x0000a405, 0x0000a505, 0x0000a605, 0x0000a805, 0x0000a905, 0x00001105, 0x0000ac05, 0x0000ad05,
+	0x0000ae05, 0x0000af05, 0x0000b105, 0x0000b205, 0x0000b305, 0x00001205, 0x0000b605, 0x0000b705,
+	0x0000b805, 0x0000ba05, 0x0000bb05, 0x0000bc05, 0x00001305, 0x0000bf05, 0x0000c005, 0x0000c105,
+	0x0000c305, 0x0000c405, 0x0000c505, 0x0000c605, 0x00000205, 0x0000c905, 0x0000ca05, 0x0000cc05,
+	0x0000cd05, 0x0000ce05, 0x0000cf05, 0x0000d105, 0x00001505, 0x0000d305, 0x0000d405, 0x0000d605,
+	0x0000d705, 0x0000d805, 0x0000da05, 0x0000db05, 0x00001605, 0x0000dd05, 0x0000df05, 0x0000e005,
+	0x0000e105, 0x0000e305, 0x0000e405, 0x0000e505, 0x00001705, 0x0000e805, 0x0000e905, 0x0000ea05,
+	0x0000ec05, 0x0000ed05, 0x0000ee05, 0x0000ef05, 0x00001805, 0x0000f205, 0x0000f305, 0x0000f405,
+	0x0000f605, 0x0000f705, 0x0000f805, 0x00001905, 0x0000fb05, 0x0000fc05, 0x0000fd05, 0x0000ff05,
+	0x00010005, 0x00010105, 0x00010305, 0x00001a05, 0x00010505, 0x00010605, 0x00010805, 0x00010905,
+	0x00010a05, 0x00010c05, 0x00010d05, 0x00001b05, 0x00010f05, 0x00011105, 0x00011205, 0x00011305,
+	0x00011405, 0x00011605, 0x00011705, 0x00001c05, 0x00011a05, 0x00011b05, 0x00011c05, 0x00011d05,
+	0x00011f05, 0x00012005, 0x00012105, 0x00001d05, 0x00012405, 0x00012505, 0x00012605, 0x00012805,
+	0x00012905, 0x00012a05, 0x00000305, 0x00012d05, 0x00012e05, 0x00012f05, 0x00013105, 0x00013205,
+	0x00013305, 0x00013405, 0x00001f05, 0x00013705, 0x00013805, 0x00013a05, 0x00013b05, 0x00013c05,
+	0x00013d05, 0x00013f05, 0x00002005, 0x00014105, 0x00014305, 0x00014405, 0x00014505, 0x00014605,
+	0x00014805, 0x00002105, 0x00014d05, 0x00014f05, 0x00015205, 0x00002205, 0x00015705, 0x00015a05,
+	0x00015c05, 0x00002305, 0x00016105, 0x00016405, 0x00016605, 0x00002405, 0x00016c05, 0x00016e05,
+	0x00017105, 0x00002505, 0x00017605, 0x00017805, 0x00002605, 0x00017d05, 0x00018005, 0x00018305,
+	0x00002705, 0x00018805, 0x00018a05, 0x00018d05, 0x00000405, 0x00019205, 0x00019405, 0x00019705,
+	0x00002905, 0x00019c05, 0x00019f05, 0x0001a105, 0x00002a05, 0x0001a605, 0x0001a905, 0x0001ac05,
+	0x00002b05, 0x0001b105, 0x0001b305, 0x0001b605, 0x00002c05, 0x0001bb05, 0x0001bd05, 0x0001c005,
+	0x00002d05, 0x0001c505, 0x0001c805, 0x0001ca05, 0x00002e05, 0x0001cf05, 0x0001d205, 0x0001d405,
+	0x00002f05, 0x0001da05, 0x0001dc05, 0x0001df05, 0x00003005, 0x0001e405, 0x0001e605, 0x00003105,
+	0x0001ec05, 0x0001ee05, 0x0001f105, 0x00000505, 0x0001f605, 0x0001f805, 0x0001fb05, 0x00003305,
+	0x00020005, 0x00020305, 0x00020505, 0x00003405, 0x00020a05, 0x00020d05, 0x00020f05, 0x00003505,
+	0x00021405, 0x00021705, 0x00021a05, 0x00003605, 0x00021f05, 0x00022105, 0x00022405, 0x00003705,
+	0x00022905, 0x00022c05, 0x00022e05, 0x00003805, 0x00023305, 0x00023605, 0x00023805, 0x00003905,
+	0x00023d05, 0x00024005, 0x00024305, 0x00003a05, 0x00024805, 0x00024a05, 0x00003b05, 0x00024f05,
+	0x00025205, 0x00025405, 0x00000605, 0x00025a05, 0x00025c05, 0x00025f05, 0x00003d05, 0x00026405,
+	0x00026605, 0x00026905, 0x00003e05, 0x00026e05, 0x00027105, 0x00027305, 0x00003f05, 0x00027805,
+	0x00027b05, 0x00027d05, 0x00004005, 0x00028305, 0x00028505, 0x00028805, 0x00004105, 0x00028d05,
+	0x00028f05, 0x00004205, 0x00029a05, 0x00004305, 0x0002a405, 0x00004405, 0x0002ae05, 0x00004505,
+	0x0002b805, 0x00000705, 0x0002c305, 0x00004705, 0x0002cd05, 0x00004805, 0x0002d705, 0x00004905,
+	0x0002e105, 0x00004a05, 0x00004b05, 0x0002f105, 0x00004c05, 0x0002fb05, 0x00004d05, 0x00030505,
+	0x00004e05, 0x00030f05, 0x00004f05, 0x00031a05, 0x00000805, 0x00032405, 0x00005105, 0x00032e05,
+	0x00005205, 0x00033805, 0x00005305, 0x00034305, 0x00005405, 0x00034d05, 0x00005505, 0x00035705,
+	0x00005605, 0x00036105, 0x00005705, 0x00036c05, 0x00005805, 0x00037605, 0x00005905, 0x00038005,
+	0x00000905, 0x00038a05, 0x00005b05, 0x00039405, 0x00005c05, 0x00039f05, 0x00005d05, 0x0003a905,
+	0x00005e05, 0x0003b305, 0x00005f05, 0x0003bd05, 0x00006005, 0x00006105, 0x0003cd05, 0x00006205,
+	0x0003d705, 0x00006305, 0x0003e105, 0x00000106, 0x0003ec06, 0x00006506, 0x0003f606, 0x00006606,
+	0x00040006, 0x00006706, 0x00040a06, 0x00006806, 0x00041406, 0x00006906, 0x00041f06, 0x00006a06,
+	0x00042906, 0x00006b06, 0x00043306, 0x00006c06, 0x00043d06, 0x00006d06, 0x00044806, 0x00000b06,
+	0x00045206, 0x00006f06, 0x00045c06, 0x00007006, 0x00046606, 0x00007106, 0x00047106, 0x00007206,
+	0x00047b06, 0x00007306, 0x00048506, 0x00007406, 0x00048f06, 0x00007506, 0x00007606, 0x00049f06,
+	0x00007706, 0x0004a906, 0x00000c06, 0x0004b306, 0x00007906, 0x0004bd06, 0x00007a06, 0x0004c806,
+	0x00007b06, 0x0004d206, 0x00007c06, 0x0004dc06, 0x00007d06, 0x0004e606, 0x00007e06, 0x0004f106,
+	0x00007f06, 0x0004fb06, 0x00008006, 0x00050506, 0x00008106, 0x00050f06, 0x00000d06, 0x00051a06,
+	0x00008306, 0x00008406, 0x00008506, 0x00008606, 0x00008706, 0x00008806, 0x00008906, 0x00008a06,
+	0x00008b06, 0x00000e06, 0x00008d06, 0x00008e06, 0x00008f06, 0x00009006, 0x00009106, 0x00009206,
+	0x00009306, 0x00009406, 0x00000f06, 0x00009706, 0x00009806, 0x00009906, 0x00009a06, 0x00009b06,
+	0x00009c06, 0x00009d06, 0x00009e06, 0x00009f06, 0x00001006, 0x0000a106, 0x0000a206, 0x0000a306,
+	0x0000a406, 0x0000a506, 0x0000a606, 0x0000a706, 0x0000a806, 0x0000a906, 0x00001106, 0x0000ab06,
+	0x0000ac06, 0x0000ad06, 0x0000ae06, 0x0000af06, 0x0000b006, 0x0000b106, 0x0000b206, 0x0000b306,
+	0x00001206, 0x0000b506, 0x0000b606, 0x0000b706, 0x0000b806, 0x0000b906, 0x0000ba06, 0x0000bb06,
+	0x0000bc06, 0x0000bd06, 0x00001306, 0x0000bf06, 0x0000c106, 0x0000c206, 0x0000c306, 0x0000c406,
+	0x0000c506, 0x0000c606, 0x0000c706, 0x00000206, 0x0000c906, 0x0000ca06, 0x0000cb06, 0x0000cc06,
+	0x0000cd06, 0x0000ce06, 0x0000cf06, 0x0000d006, 0x0000d106, 0x00001506, 0x0000d306, 0x0000d406,
+	0x0000d506, 0x0000d606, 0x0000d706, 0x0000d806, 0x0000d906, 0x0000da06, 0x0000db06, 0x00001606,
+	0x0000dd06, 0x0000de06, 0x0000df06, 0x0000e006, 0x0000e106, 0x0000e206, 0x0000e306, 0x0000e406,
+	0x0000e506, 0x00001706, 0x0000e706, 0x0000e806, 0x0000e906, 0x0000ea06, 0x0000ec06, 0x0000ed06,
+	0x0000ee06, 0x0000ef06, 0x00001806, 0x0000f106, 0x0000f206, 0x0000f306, 0x0000f406, 0x0000f506,
+	0x0000f606, 0x0000f706, 0x0000f806, 0x0000f906, 0x00001906, 0x0000fb06, 0x0000fc06, 0x0000fd06,
+	0x0000fe06, 0x0000ff06, 0x00010006, 0x00010106, 0x00010206, 0x00010306, 0x00001a06, 0x00010506,
+	0x00010606, 0x00010806, 0x00010a06, 0x00010c06, 0x00001b06, 0x00011006, 0x00011206, 0x00011406,
+	0x00011706, 0x00001c06, 0x00011b06, 0x00011d06, 0x00011f06, 0x00012106, 0x00001d06, 0x00012506,
+	0x00012706, 0x00012906, 0x00000306, 0x00012d06, 0x00012f06, 0x00013106, 0x00013306, 0x00001f06,
+	0x00013706, 0x00013906, 0x00013b06, 0x00013d06, 0x00002006, 0x00014206, 0x00014406, 0x00014606,
+	0x00014806, 0x00002106, 0x00014c06, 0x00014e06, 0x00015006, 0x00015206, 0x00002206, 0x00015606,
+	0x00015806, 0x00015a06, 0x00015c06, 0x00002306, 0x00016006, 0x00016206, 0x00016406, 0x00016606,
+	0x00002406, 0x00016a06, 0x00016d06, 0x00016f06, 0x00017106, 0x00002506, 0x00017506, 0x00017706,
+	0x00017906, 0x00017b06, 0x00002606, 0x00017f06, 0x00018106, 0x00018306, 0x00002706, 0x00018706,
+	0x00018906, 0x00018b06, 0x00018d06, 0x00000406, 0x00019106, 0x00019306, 0x00019606, 0x00019806,
+	0x00002906, 0x00019c06, 0x00019e06, 0x0001a006, 0x0001a206, 0x00002a06, 0x0001a606, 0x0001a806,
+	0x0001aa06, 0x0001ac06, 0x00002b06, 0x0001b006, 0x0001b206, 0x0001b406, 0x0001b606, 0x00002c06,
+	0x0001ba06, 0x0001bc06, 0x0001be06, 0x0001c106, 0x00002d06, 0x0001c506, 0x0001c706, 0x0001c906,
+	0x0001cb06, 0x00002e06, 0x0001cf06, 0x0001d106, 0x0001d306, 0x00002f06, 0x0001d706, 0x0001d906,
+	0x0001db06, 0x0001dd06, 0x00003006, 0x0001e106, 0x0001e306, 0x0001e506, 0x0001e706, 0x00003106,
+	0x0001ec06, 0x0001ee06, 0x0001f006, 0x0001f206, 0x00000506, 0x0001f606, 0x0001f806, 0x0001fa06,
+	0x0001fc06, 0x00003306, 0x00020006, 0x00020206, 0x00020406, 0x00020606, 0x00003406, 0x00020a06,
+	0x00020c06, 0x00003506, 0x00021406, 0x00021906, 0x00003606, 0x00022106, 0x00003706, 0x00022906,
+	0x00022d06, 0x00003806, 0x00023506, 0x00003906, 0x00023d06, 0x00024206, 0x00003a06, 0x00024a06,
+	0x00003b06, 0x00025206, 0x00000606, 0x00025a06, 0x00025e06, 0x00003d06, 0x00026606, 0x00003e06,
+	0x00026f06, 0x00027306, 0x00003f06, 0x00027b06, 0x00004006, 0x00028306, 0x00028706, 0x00004106,
+	0x00028f06, 0x00004206, 0x00029806, 0x00029c06, 0x00004306, 0x0002a406, 0x00004406, 0x0002ac06,
+	0x00004506, 0x0002b406, 0x0002b806, 0x00000706, 0x0002c106, 0x00004706, 0x0002c906, 0x0002cd06,
+	0x00004806, 0x0002d506, 0x00004906, 0x0002dd06, 0x0002e106, 0x00004a06, 0x0002e906, 0x00004b06,
+	0x0002f206, 0x0002f606, 0x00004c06, 0x0002fe06, 0x00004d06, 0x00030606, 0x00004e06, 0x00030e06,
+	0x00031206, 0x00004f06, 0x00031b06, 0x00000806, 0x00032306, 0x00032706, 0x00005106, 0x00032f06,
+	0x00005206, 0x00033706, 0x00033b06, 0x00005306, 0x00034406, 0x00005406, 0x00034c06, 0x00035006,
+	0x00005506, 0x00035806, 0x00005606, 0x00036006, 0x00005706, 0x00036806, 0x00036d06, 0x00005806,
+	0x00037506, 0x00005906, 0x00037d06, 0x00038106, 0x00000906, 0x00038906, 0x00005b06, 0x00039106,
+	0x00039606, 0x00005c06, 0x00039e06, 0x00005d06, 0x0003a606, 0x00005e06, 0x0003ae06, 0x0003b206,
+	0x00005f06, 0x0003ba06, 0x00006006, 0x0003c306, 0x0003c706, 0x00006106, 0x0003cf06, 0x00006206,
+	0x0003d706, 0x0003db06, 0x00006306, 0x0003e306, 0x00000107, 0x0003ec07, 0x0003f007, 0x00006507,
+	0x0003f807, 0x00006607, 0x00040007, 0x00006707, 0x00040807, 0x00040c07, 0x00006807, 0x00041407,
+	0x00006907, 0x00006a07, 0x00042907, 0x00006b07, 0x00006c07, 0x00006d07, 0x00000b07, 0x00006f07,
+	0x00045a07, 0x00007007, 0x00007107, 0x00007207, 0x00007307, 0x00048307, 0x00007407, 0x00007507,
+	0x00007607, 0x00007707, 0x00000c07, 0x0004b407, 0x00007907, 0x00007a07, 0x00007b07, 0x00007c07,
+	0x0004dd07, 0x00007d07, 0x00007e07, 0x00007f07, 0x00008007, 0x00008107, 0x00050e07, 0x00000d07,
+	0x00008307, 0x00008407, 0x00008507, 0x00053707, 0x00008607, 0x00008707, 0x00008807, 0x00008907,
+	0x00008a07, 0x00056807, 0x00008b07, 0x00000e07, 0x00008d07, 0x00008e07, 0x00059107, 0x00008f07,
+	0x00009007, 0x00009107, 0x00009207, 0x00009307, 0x0005c307, 0x00009407, 0x00009507, 0x00000f07,
+	0x00009707, 0x0005ec07, 0x00009807, 0x00009907, 0x00009a07, 0x00009b07, 0x00009c07, 0x00061d07,
+	0x00009d07, 0x00009e07, 0x00009f07, 0x00001007, 0x00064607, 0x0000a107, 0x0000a207, 0x0000a307,
+	0x0000a407, 0x0000a507, 0x00067707, 0x0000a607, 0x0000a707, 0x0000a807, 0x0000a907, 0x0006a007,
+	0x00001107, 0x0000ab07, 0x0000ac07, 0x0000ad07, 0x0000ae07, 0x0006d107, 0x0000af07, 0x0000b007,
+	0x0000b107, 0x0000b207, 0x0006fa07, 0x0000b307, 0x00001207, 0x0000b507, 0x0000b607, 0x0000b707,
+	0x00072b07, 0x0000b807, 0x0000b907, 0x0000ba07, 0x0000bb07, 0x0000bc07, 0x00075c07, 0x0000bd07,
+	0x00001307, 0x0000bf07, 0x0000c007, 0x00078507, 0x0000c107, 0x0000c207, 0x0000c307, 0x0000c407,
+	0x0000c507, 0x0007b607, 0x0000c607, 0x0000c707, 0x00000207, 0x0000c907, 0x0007df07, 0x0000ca07,
+	0x0000cb07, 0x0000cc07, 0x0000cd07, 0x0000ce07, 0x00081007, 0x0000cf07, 0x0000d007, 0x0000d107,
+	0x00001507, 0x0000d307, 0x0000d507, 0x0000d707, 0x0000d807, 0x0000da07, 0x00001607, 0x0000dd07,
+	0x0000df07, 0x0000e007, 0x0000e207, 0x0000e407, 0x00001707, 0x0000e707, 0x0000e907, 0x0000ea07,
+	0x0000ec07, 0x0000ee07, 0x00001807, 0x0000f107, 0x0000f207, 0x0000f407, 0x0000f607, 0x0000f707,
+	0x0000f907, 0x00001907, 0x0000fc07, 0x0000fe07, 0x00010007, 0x00010107, 0x00010307, 0x00001a07,
+	0x00010607, 0x00010807, 0x00010907, 0x00010b07, 0x00010d07, 0x00001b07, 0x00011007, 0x00011207,
+	0x00011307, 0x00011507, 0x00011707, 0x00001c07, 0x00011a07, 0x00011b07, 0x00011d07, 0x00011f07,
+	0x00012007, 0x00001d07, 0x00012407, 0x00012507, 0x00012707, 0x00012907, 0x00012a07, 0x00000307,
+	0x00012d07, 0x00012f07, 0x00013107, 0x00013207, 0x00013407, 0x00001f07, 0x00013707, 0x00013907,
+	0x00013b07, 0x00013c07, 0x00013e07, 0x00002007, 0x00014107, 0x00014307, 0x00014407, 0x00014607,
+	0x00014807, 0x00002107, 0x00014b07, 0x00014d07, 0x00014e07, 0x00015007, 0x00015207, 0x00015307,
+	0x00002207, 0x00015607, 0x00015807, 0x00015a07, 0x00015b07, 0x00015d07, 0x00002307, 0x00016007,
+	0x00016207, 0x00016407, 0x00016507, 0x00016707, 0x00002407, 0x00016a07, 0x00016c07, 0x00016d07,
+	0x00016f07, 0x00017107, 0x00002507, 0x00017407, 0x00017607, 0x00017707, 0x00017907, 0x00017a07,
+	0x00002607, 0x00017e07, 0x00017f07, 0x00018107, 0x00018307, 0x00018407, 0x00002707, 0x00018807,
+	0x00018907, 0x00018b07, 0x00018c07, 0x00018e07, 0x00000407, 0x00019107, 0x00019307, 0x00019507,
+	0x00019607, 0x00019807, 0x00002907, 0x00019b07, 0x00019d07, 0x00019f07, 0x0001a007, 0x0001a207,
+	0x00002a07, 0x0001a707, 0x0001aa07, 0x00002b07, 0x0001b107, 0x0001b407, 0x00002c07, 0x0001ba07,
+	0x0001be07, 0x00002d07, 0x0001c407, 0x0001c707, 0x00002e07, 0x0001ce07, 0x0001d107, 0x00002f07,
+	0x0001d807, 0x0001db07, 0x00003007, 0x0001e207, 0x0001e507, 0x0001e807, 0x00003107, 0x0001ef07,
+	0x0001f207, 0x00000507, 0x0001f907, 0x0001fc07, 0x00003307, 0x00020207, 0x00020607, 0x00003407,
+	0x00020c07, 0x00021007, 0x00003507, 0x00021607, 0x00021907, 0x00003607, 0x00022007, 0x00022307,
+	0x00003707, 0x00022a07, 0x00022d07, 0x00003807, 0x00023407, 0x00023707, 0x00003907, 0x00023d07,
+	0x00024107, 0x00003a07, 0x00024707, 0x00024b07, 0x00003b07, 0x00025107, 0x00025407, 0x00000607,
+	0x00025b07, 0x00025e07, 0x00003d07, 0x00026507, 0x00026807, 0x00003e07, 0x00026f07, 0x00027207,
+	0x00003f07, 0x00027807, 0x00027c07, 0x00004007, 0x00028207, 0x00028607, 0x00004107, 0x00028c07,
+	0x00028f07, 0x00004207, 0x00029607, 0x00029907, 0x00004307, 0x0002a007, 0x0002a307, 0x0002a607,
+	0x00004407, 0x0002ad07, 0x0002b007, 0x00004507, 0x0002b707, 0x0002ba07, 0x00000707, 0x0002c107,
+	0x0002c407, 0x00004707, 0x0002ca07, 0x0002ce07, 0x00004807, 0x0002d407, 0x0002d707, 0x00004907,
+	0x0002de07, 0x0002e107, 0x00004a07, 0x0002e807, 0x0002eb07, 0x00004b07, 0x0002f207, 0x0002f507,
+	0x00004c07, 0x0002fb07, 0x0002ff07, 0x00004d07, 0x00030507, 0x00030907, 0x00004e07, 0x00030f07,
+	0x00031207, 0x00004f07, 0x00031907, 0x00031c07, 0x00000807, 0x00032307, 0x00032607, 0x00005107,
+	0x00032d07, 0x00033007, 0x00005207, 0x00033607, 0x00033a07, 0x00005307, 0x00034007, 0x00034407,
+	0x00005407, 0x00034d07, 0x00005507, 0x00005607, 0x00036107, 0x00005707, 0x00005807, 0x00037507,
+	0x00005907, 0x00000907, 0x00038807, 0x00005b07, 0x00005c07, 0x00039c07, 0x00005d07, 0x00005e07,
+	0x0003b007, 0x00005f07, 0x00006007, 0x0003c307, 0x00006107, 0x0003d007, 0x00006207, 0x00006307,
+	0x0003e407, 0x00000108, 0x00006508, 0x0003f808, 0x00006608, 0x00006708, 0x00040b08, 0x00006808,
+	0x00006908, 0x00041f08, 0x00006a08, 0x00006b08, 0x00043308, 0x00006c08, 0x00006d08, 0x00044608,
+	0x00000b08, 0x00006f08, 0x00045a08, 0x00007008, 0x00007108, 0x00046e08, 0x00007208, 0x00007308,
+	0x00048108, 0x00007408, 0x00048f08, 0x00007508, 0x00007608, 0x0004a208, 0x00007708, 0x00000c08,
+	0x0004b608, 0x00007908, 0x00007a08, 0x0004ca08, 0x00007b08, 0x00007c08, 0x0004dd08, 0x00007d08,
+	0x00007e08, 0x0004f108, 0x00007f08, 0x00008008, 0x00050508, 0x00008108, 0x00000d08, 0x00051808,
+	0x00008308, 0x00008408, 0x00052c08, 0x00008508, 0x00008608, 0x00053f08, 0x00008708, 0x00054d08,
+	0x00008808, 0x00008908, 0x00056008, 0x00008a08, 0x00008b08, 0x00057408, 0x00000e08, 0x00008d08,
+	0x00058808, 0x00008e08, 0x00008f08, 0x00059b08, 0x00009008, 0x00009108, 0x0005af08, 0x00009208,
+	0x00009308, 0x0005c308, 0x00009408, 0x00009508, 0x0005d608, 0x00000f08, 0x00009708, 0x0005ea08,
+	0x00009808, 0x00009908, 0x0005fe08, 0x00009a08, 0x00060b08, 0x00009b08, 0x00009c08, 0x00061e08,
+	0x00009d08, 0x00009e08, 0x00063208, 0x00009f08, 0x00001008, 0x00064608, 0x0000a108, 0x0000a208,
+	0x00065908, 0x0000a308, 0x0000a408, 0x00066d08, 0x0000a508, 0x0000a608, 0x00068108, 0x0000a708,
+	0x0000a808, 0x0000a908, 0x00001108, 0x0000ac08, 0x0000ad08, 0x0000ae08, 0x0000b008, 0x0000b108,
+	0x0000b208, 0x00001208, 0x0000b508, 0x0000b608, 0x0000b808, 0x0000b908, 0x0000ba08, 0x0000bb08,
+	0x0000bd08, 0x00001308, 0x0000bf08, 0x0000c108, 0x0000c208, 0x0000c308, 0x0000c508, 0x0000c608,
+	0x0000c708, 0x00000208, 0x0000ca08, 0x0000cb08, 0x0000cc08, 0x0000ce08, 0x0000cf08, 0x0000d008,
+	0x00001508, 0x0000d308, 0x0000d408, 0x0000d608, 0x0000d708, 0x0000d808, 0x0000da08, 0x0000db08,
+	0x00001608, 0x0000de08, 0x0000df08, 0x0000e008, 0x0000e108, 0x0000e308, 0x0000e408, 0x00001708,
+	0x0000e708, 0x0000e808, 0x0000e908, 0x0000eb08, 0x0000ec08, 0x0000ed08, 0x0000ef08, 0x00001808,
+	0x0000f108, 0x0000f208, 0x0000f408, 0x0000f508, 0x0000f608, 0x0000f808, 0x0000f908, 0x00001908,
+	0x0000fc08, 0x0000fd08, 0x0000fe08, 0x00010008, 0x00010108, 0x00010208, 0x00001a08, 0x00010508,
+	0x00010608, 0x00010708, 0x00010908, 0x00010a08, 0x00010b08, 0x00010d08, 0x00001b08, 0x00010f08,
+	0x00011108, 0x00011208, 0x00011308, 0x00011508, 0x00011608, 0x00011708, 0x00001c08, 0x00011a08,
+	0x00011b08, 0x00011c08, 0x00011e08, 0x00011f08, 0x00012008, 0x00001d08, 0x00012308, 0x00012408,
+	0x00012608, 0x00012708, 0x00012808, 0x00012a08, 0x00012b08, 0x00000308, 0x00012d08, 0x00012f08,
+	0x00013008, 0x00013108, 0x00013308, 0x00013408, 0x00013508, 0x00001f08, 0x00013808, 0x00013908,
+	0x00013b08, 0x00013c08, 0x00013d08, 0x00013f08, 0x00002008, 0x00014108, 0x00014208, 0x00014408,
+	0x00014508, 0x00014608, 0x00014808, 0x00014908, 0x00002108, 0x00014c08, 0x00014d08, 0x00014e08,
+	0x00015008, 0x00015208, 0x00002208, 0x00015708, 0x00015a08, 0x00015d08, 0x00002308, 0x00016208,
+	0x00016508, 0x00002408, 0x00016a08, 0x00016c08, 0x00016f08, 0x00002508, 0x00017408, 0x00017708,
+	0x00017908, 0x00002608, 0x00017f08, 0x00018108, 0x00018408, 0x00002708, 0x00018908, 0x00018c08,
+	0x00018e08, 0x00000408, 0x00019408, 0x00019608, 0x00002908, 0x00019c08, 0x00019e08, 0x0001a108,
+	0x00002a08, 0x0001a608, 0x0001a908, 0x0001ab08, 0x00002b08, 0x0001b108, 0x0001b308, 0x0001b608,
+	0x00002c08, 0x0001bb08, 0x0001be08, 0x0001c008, 0x00002d08, 0x0001c608, 0x0001c808, 0x00002e08,
+	0x0001cd08, 0x0001d008, 0x0001d308, 0x00002f08, 0x0001d808, 0x0001da08, 0x0001dd08, 0x00003008,
+	0x0001e208, 0x0001e508, 0x0001e808, 0x00003108, 0x0001ed08, 0x0001ef08, 0x0001f208, 0x00000508,
+	0x0001f708, 0x0001fa08, 0x0001fd08, 0x00003308, 0x00020208, 0x00020408, 0x00003408, 0x00020a08,
+	0x00020c08, 0x00020f08, 0x00003508, 0x00021408, 0x00021708, 0x00021908, 0x00003608, 0x00021f08,
+	0x00022108, 0x00022408, 0x00003708, 0x00022908, 0x00022c08, 0x00022e08, 0x00003808, 0x00023408,
+	0x00023608, 0x00003908, 0x00023b08, 0x00023e08, 0x00024108, 0x00003a08, 0x00024608, 0x00024908,
+	0x00024b08, 0x00003b08, 0x00025008, 0x00025308, 0x00025608, 0x00000608, 0x00025b08, 0x00025e08,
+	0x00026008, 0x00003d08, 0x00026508, 0x00026808, 0x00026b08, 0x00003e08, 0x00027008, 0x00027308,
+	0x00003f08, 0x00027808, 0x00027a08, 0x00027d08, 0x00004008, 0x00028208, 0x00028508, 0x00028708,
+	0x00004108, 0x00028d08, 0x00028f08, 0x00029208, 0x00004208, 0x00029708, 0x00029a08, 0x00029c08,
+	0x00004308, 0x0002a408, 0x00004408, 0x0002af08, 0x00004508, 0x0002b908, 0x00000708, 0x00004708,
+	0x0002c908, 0x00004808, 0x0002d408, 0x00004908, 0x0002de08, 0x00004a08, 0x0002e808, 0x00004b08,
+	0x0002f308, 0x00004c08, 0x0002fd08, 0x00004d08, 0x00030808, 0x00004e08, 0x00031208, 0x00004f08,
+	0x00031d08, 0x00000808, 0x00005108, 0x00032d08, 0x00005208, 0x00033708, 0x00005308, 0x00034208,
+	0x00005408, 0x00034c08, 0x00005508, 0x00035708, 0x00005608, 0x00036108, 0x00005708, 0x00036c08,
+	0x00005808, 0x00037608, 0x00005908, 0x00038108, 0x00000908, 0x00038b08, 0x00005b08, 0x00005c08,
+	0x00039b08, 0x00005d08, 0x0003a508, 0x00005e08, 0x0003b008, 0x00005f08, 0x0003ba08, 0x00006008,
+	0x0003c508, 0x00006108, 0x0003cf08, 0x00006208, 0x0003da08, 0x00006308, 0x0003e408, 0x00000109,
+	0x0003ef09, 0x00006509, 0x0003f909, 0x00006609, 0x00006709, 0x00040909, 0x00006809, 0x00041309,
+	0x00006909, 0x00041e09, 0x00006a09, 0x00042809, 0x00006b09, 0x00043309, 0x00006c09, 0x00043d09,
+	0x00006d09, 0x00044809, 0x00000b09, 0x00045209, 0x00006f09, 0x00045d09, 0x00007009, 0x00046709,
+	0x00007109, 0x00007209, 0x00047709, 0x00007309, 0x00048109, 0x00007409, 0x00048c09, 0x00007509,
+	0x00049609, 0x00007609, 0x0004a109, 0x00007709, 0x0004ab09, 0x00000c09, 0x0004b609, 0x00007909,
+	0x0004c009, 0x00007a09, 0x0004cb09, 0x00007b09, 0x0004d509, 0x00007c09, 0x00007d09, 0x0004e509,
+	0x00007e09, 0x0004f009, 0x00007f09, 0x0004fa09, 0x00008009, 0x00050509, 0x00008109, 0x00050f09,
+	0x00000d09, 0x00051909, 0x00008309, 0x00052409, 0x00008409, 0x00052e09, 0x00008509, 0x00053909,
+	0x00008609, 0x00008709, 0x00008809, 0x00008909, 0x00008a09, 0x00008b09, 0x00000e09, 0x00008e09,
+	0x00008f09, 0x00009009, 0x00009109, 0x00009209, 0x00009309, 0x00009409, 0x00009509, 0x00000f09,
+	0x00009709, 0x00009809, 0x00009909, 0x00009a09, 0x00009b09, 0x00009c09, 0x00009d09, 0x00009e09,
+	0x00009f09, 0x00001009, 0x0000a109, 0x0000a309, 0x0000a409, 0x0000a509, 0x0000a609, 0x0000a709,
+	0x0000a809, 0x0000a909, 0x00001109, 0x0000ab09, 0x0000ac09, 0x0000ad09, 0x0000ae09, 0x0000af09,
+	0x0000b009, 0x0000b109, 0x0000b209, 0x0000b309, 0x00001209, 0x0000b509, 0x0000b609, 0x0000b809,
+	0x0000b909, 0x0000ba09, 0x0000bb09, 0x0000bc09, 0x0000bd09, 0x00001309, 0x0000bf09, 0x0000c009,
+	0x0000c109, 0x0000c209, 0x0000c309, 0x0000c409, 0x0000c509, 0x0000c609, 0x0000c709, 0x00000209,
+	0x0000c909, 0x0000ca09, 0x0000cb09, 0x0000cc09, 0x0000ce09, 0x0000cf09, 0x0000d009, 0x0000d109,
+	0x00001509, 0x0000d309, 0x0000d409, 0x0000d509, 0x0000d609, 0x0000d709, 0x0000d809, 0x0000d909,
+	0x0000da09, 0x0000db09, 0x00001609, 0x0000dd09, 0x0000de09, 0x0000df09, 0x0000e009, 0x0000e109,
+	0x0000e209, 0x0000e409, 0x0000e509, 0x00001709, 0x0000e709, 0x0000e809, 0x0000e909, 0x0000ea09,
+	0x0000eb09, 0x0000ec09, 0x0000ed09, 0x0000ee09, 0x0000ef09, 0x00001809, 0x0000f109, 0x0000f209,
+	0x0000f309, 0x0000f409, 0x0000f509, 0x0000f609, 0x0000f709, 0x0000f909, 0x00001909, 0x0000fb09,
+	0x0000fc09, 0x0000fd09, 0x0000fe09, 0x0000ff09, 0x00010009, 0x00010109, 0x00010209, 0x00010309,
+	0x00001a09, 0x00010509, 0x00010609, 0x00010709, 0x00010809, 0x00010909, 0x00010a09, 0x00010b09,
+	0x00010c09, 0x00001b09, 0x00011109, 0x00011309, 0x00011509, 0x00011709, 0x00001c09, 0x00011b09,
+	0x00011d09, 0x00011f09, 0x00001d09, 0x00012409, 0x00012609, 0x00012809, 0x00012a09, 0x00000309,
+	0x00012e09, 0x00013009, 0x00013209, 0x00013409, 0x00001f09, 0x00013809, 0x00013b09, 0x00013d09,
+	0x00013f09, 0x00002009, 0x00014309, 0x00014509, 0x00014709, 0x00002109, 0x00014b09, 0x00014d09,
+	0x00015009, 0x00015209, 0x00002209, 0x00015609, 0x00015809, 0x00015a09, 0x00015c09, 0x00002309,
+	0x00016009, 0x00016209, 0x00016509, 0x00016709, 0x00002409, 0x00016b09, 0x00016d09, 0x00016f09,
+	0x00002509, 0x00017309, 0x00017509, 0x00017709, 0x00017909, 0x00002609, 0x00017e09, 0x00018009,
+	0x00018209, 0x00018409, 0x00002709, 0x00018809, 0x00018a09, 0x00018c09, 0x00018e09, 0x00000409,
+	0x00019309, 0x00019509, 0x00019709, 0x00019909, 0x00002909, 0x00019d09, 0x00019f09, 0x0001a109,
+	0x00002a09, 0x0001a609, 0x0001a809, 0x0001aa09, 0x0001ac09, 0x00002b09, 0x0001b009, 0x0001b209,
+	0x0001b409, 0x0001b609, 0x00002c09, 0x0001ba09, 0x0001bd09, 0x0001bf09, 0x0001c109, 0x00002d09,
+	0x0001c509, 0x0001c709, 0x0001c909, 0x00002e09, 0x0001cd09, 0x0001cf09, 0x0001d209, 0x0001d409,
+	0x00002f09, 0x0001d809, 0x0001da09, 0x0001dc09, 0x0001de09, 0x00003009, 0x0001e209, 0x0001e409,
+	0x0001e709, 0x0001e909, 0x00003109, 0x0001ed09, 0x0001ef09, 0x0001f109, 0x00000509, 0x0001f509,
+	0x0001f709, 0x0001f909, 0x0001fc09, 0x00003309, 0x00020009, 0x00020209, 0x00020409, 0x00020609,
+	0x00003409, 0x00020a09, 0x00020c09, 0x00020e09, 0x00021009, 0x00003509, 0x00021509, 0x00021709,
+	0x00021909, 0x00003609, 0x00022109, 0x00003709, 0x00022a09, 0x00022e09, 0x00003809, 0x00023609,
+	0x00003909, 0x00023f09, 0x00003a09, 0x00024709, 0x00024b09, 0x00003b09, 0x00025409, 0x00000609,
+	0x00025c09, 0x00003d09, 0x00026409, 0x00026909, 0x00003e09, 0x00027109, 0x00003f09, 0x00027909,
+	0x00027e09, 0x00004009, 0x00028609, 0x00004109, 0x00028e09, 0x00004209, 0x00029709, 0x00029b09,
+	0x00004309, 0x0002a309, 0x00004409, 0x0002ac09, 0x0002b009, 0x00004509, 0x0002b809, 0x00000709,
+	0x0002c109, 0x00004709, 0x0002c909, 0x0002cd09, 0x00004809, 0x0002d609, 0x00004909, 0x0002de09,
+	0x00004a09, 0x0002e609, 0x0002eb09, 0x00004b09, 0x0002f309, 0x00004c09, 0x0002fb09, 0x00030009,
+	0x00004d09, 0x00030809, 0x00004e09, 0x00031009, 0x00004f09, 0x00031909, 0x00031d09, 0x00000809,
+	0x00032509, 0x00005109, 0x00032e09, 0x00033209, 0x00005209, 0x00033a09, 0x00005309, 0x00034309,
+	0x00005409, 0x00034b09, 0x00034f09, 0x00005509, 0x00035809, 0x00005609, 0x00036009, 0x00005709,
+	0x00036809, 0x00036d09, 0x00005809, 0x00037509, 0x00005909, 0x00037d09, 0x00038209, 0x00000909,
+	0x00038a09, 0x00005b09, 0x00039209, 0x00005c09, 0x00039b09, 0x00039f09, 0x00005d09, 0x0003a709,
+	0x00005e09, 0x0003b009, 0x00005f09, 0x0003b809, 0x0003bc09, 0x00006009, 0x0003c509, 0x00006109,
+	0x0003cd09, 0x0003d109, 0x00006209, 0x0003da09, 0x00006309, 0x0003e209, 0x0000010a, 0x0003ea0a,
+	0x0003ef0a, 0x0000650a, 0x0003f70a, 0x0000660a, 0x0003ff0a, 0x0004040a, 0x0000670a, 0x00040c0a,
+	0x0000680a, 0x0004140a, 0x0000690a, 0x00041d0a, 0x0004210a, 0x00006a0a, 0x0004290a, 0x00006b0a,
+	0x0004320a, 0x00006c0a, 0x00006d0a, 0x00000b0a, 0x00006f0a, 0x00045c0a, 0x0000700a, 0x0000710a,
+	0x0000720a, 0x0000730a, 0x0000740a, 0x0000750a, 0x0004960a, 0x0000760a, 0x0000770a, 0x00000c0a,
+	0x0000790a, 0x00007a0a, 0x0004c90a, 0x00007b0a, 0x00007c0a, 0x00007d0a, 0x00007e0a, 0x00007f0a,
+	0x0004fb0a, 0x0000800a, 0x0000810a, 0x00000d0a, 0x0000830a, 0x0000840a, 0x00052d0a, 0x0000850a,
+	0x0000860a, 0x0000870a, 0x0000880a, 0x0000890a, 0x0005600a, 0x00008a0a, 0x00008b0a, 0x00000e0a,
+	0x00008d0a, 0x00008e0a, 0x00008f0a, 0x00059a0a, 0x0000900a, 0x0000910a, 0x0000920a, 0x0000930a,
+	0x0000940a, 0x0005cd0a, 0x0000950a, 0x00000f0a, 0x0000970a, 0x0000980a, 0x0000990a, 0x0005ff0a,
+	0x00009a0a, 0x00009b0a, 0x00009c0a, 0x00009d0a, 0x00009e0a, 0x0006310a, 0x00009f0a, 0x0000100a,
+	0x0000a10a, 0x0000a20a, 0x0000a30a, 0x0006640a, 0x0000a40a, 0x0000a50a, 0x0000a60a, 0x0000a70a,
+	0x0000a80a, 0x0000a90a, 0x00069e0a, 0x0000110a, 0x0000ab0a, 0x0000ac0a, 0x0000ad0a, 0x0000ae0a,
+	0x0006d10a, 0x0000af0a, 0x0000b00a, 0x0000b10a, 0x0000b20a, 0x0000b30a, 0x0007030a, 0x0000120a,
+	0x0000b50a, 0x0000b60a, 0x0000b70a, 0x0000b80a, 0x0007350a, 0x0000b90a, 0x0000ba0a, 0x0000bb0a,
+	0x0000bc0a, 0x0000bd0a, 0x0000130a, 0x0007700a, 0x0000bf0a, 0x0000c00a, 0x0000c10a, 0x0000c20a,
+	0x0000c30a, 0x0007a30a, 0x0000c40a, 0x0000c50a, 0x0000c60a, 0x0000c70a, 0x0000020a, 0x0007d50a,
+	0x0000c90a, 0x0000ca0a, 0x0000cb0a, 0x0000cc0a, 0x0000cd0a, 0x0008070a, 0x0000ce0a, 0x0000cf0a,
+	0x0000d00a, 0x0000d10a, 0x0000150a, 0x00083a0a, 0x0000d30a, 0x0000d40a, 0x0000d50a, 0x0000d60a,
+	0x0000d70a, 0x0000d80a, 0x0000da0a, 0x0000160a, 0x0000dd0a, 0x0000df0a, 0x0000e10a, 0x0000e20a,
+	0x0000e40a, 0x0000170a, 0x0000e80a, 0x0000e90a, 0x0000eb0a, 0x0000ed0a, 0x0000ee0a, 0x0000180a,
+	0x0000f20a, 0x0000f30a, 0x0000f50a, 0x0000f70a, 0x0000f80a, 0x0000190a, 0x0000fc0a, 0x0000fd0a,
+	0x0000ff0a, 0x0001010a, 0x0001020a, 0x00001a0a, 0x0001060a, 0x0001070a, 0x0001090a, 0x00010b0a,
+	0x00010c0a, 0x00001b0a, 0x0001100a, 0x0001110a, 0x0001130a, 0x0001150a, 0x0001170a, 0x00001c0a,
+	0x00011a0a, 0x00011c0a, 0x00011d0a, 0x00011f0a, 0x0001210a, 0x00001d0a, 0x0001240a, 0x0001260a,
+	0x0001270a, 0x0001290a, 0x00012b0a, 0x0000030a, 0x00012e0a, 0x0001300a, 0x0001310a, 0x0001330a,
+	0x0001350a, 0x00001f0a, 0x0001380a, 0x00013a0a, 0x00013b0a, 0x00013d0a, 0x00013f0a, 0x0000200a,
+	0x0001420a, 0x0001440a, 0x0001450a, 0x0001470a, 0x0001490a, 0x0000210a, 0x00014c0a, 0x00014e0a,
+	0x0001500a, 0x0001510a, 0x0001530a, 0x0000220a, 0x0001560a, 0x0001580a, 0x00015a0a, 0x00015b0a,
+	0x00015d0a, 0x0000230a, 0x0001600a, 0x0001620a, 0x0001640a, 0x0001650a, 0x0001670a, 0x0000240a,
+	0x00016a0a, 0x00016c0a, 0x00016e0a, 0x00016f0a, 0x0001710a, 0x0000250a, 0x0001740a, 0x0001760a,
+	0x0001780a, 0x0001790a, 0x0000260a, 0x00017d0a, 0x00017f0a, 0x0001800a, 0x0001820a, 0x0001840a,
+	0x0000270a, 0x0001870a, 0x0001890a, 0x00018a0a, 0x00018c0a, 0x00018e0a, 0x0000040a, 0x0001910a,
+	0x0001930a, 0x0001940a, 0x0001960a, 0x0001980a, 0x0000290a, 0x00019b0a, 0x00019d0a, 0x00019e0a,
+	0x0001a00a, 0x0001a20a, 0x00002a0a, 0x0001a50a, 0x0001a70a, 0x0001a80a, 0x0001aa0a, 0x0001ac0a,
+	0x00002b0a, 0x0001b10a, 0x0001b40a, 0x00002c0a, 0x0001bb0a, 0x0001be0a, 0x00002d0a, 0x0001c50a,
+	0x0001c80a, 0x00002e0a, 0x0001cf0a, 0x0001d20a, 0x00002f0a, 0x0001d90a, 0x0001dc0a, 0x0000300a,
+	0x0001e30a, 0x0001e70a, 0x0000310a, 0x0001ed0a, 0x0001f10a, 0x0000050a, 0x0001f70a, 0x0001fb0a,
+	0x0000330a, 0x0002010a, 0x0002050a, 0x0000340a, 0x00020b0a, 0x00020f0a, 0x0000350a, 0x0002160a,
+	0x0002190a, 0x0000360a, 0x0002200a, 0x0002230a, 0x0000370a, 0x00022a0a, 0x00022d0a, 0x0000380a,
+	0x0002340a, 0x0002370a, 0x0000390a, 0x00023e0a, 0x0002410a, 0x00003a0a, 0x0002480a, 0x00024b0a,
+	0x00003b0a, 0x0002520a, 0x0002550a, 0x0000060a, 0x00025c0a, 0x00025f0a, 0x00003d0a, 0x0002660a,
+	0x0002690a, 0x00003e0a, 0x0002700a, 0x0002730a, 0x00003f0a, 0x00027a0a, 0x00027e0a, 0x0000400a,
+	0x0002840a, 0x0002880a, 0x0000410a, 0x00028e0a, 0x0002920a, 0x0000420a, 0x0002980a, 0x00029c0a,
+	0x0000430a, 0x0002a20a, 0x0002a60a, 0x0000440a, 0x0002ad0a, 0x0002b00a, 0x0000450a, 0x0002b70a,
+	0x0002ba0a, 0x0000070a, 0x0002c10a, 0x0002c40a, 0x0000470a, 0x0002cb0a, 0x0002ce0a, 0x0000480a,
+	0x0002d50a, 0x0002d80a, 0x0000490a, 0x0002df0a, 0x0002e20a, 0x00004a0a, 0x0002e90a, 0x0002ec0a,
+	0x00004b0a, 0x0002f30a, 0x00004c0a, 0x0002fa0a, 0x0002fd0a, 0x00004d0a, 0x0003040a, 0x0003070a,
+	0x00004e0a, 0x00030e0a, 0x0003110a, 0x00004f0a, 0x0003180a, 0x00031b0a, 0x0000080a, 0x0003220a,
+	0x0003250a, 0x0000510a, 0x00032c0a, 0x00032f0a, 0x0000520a, 0x0003360a, 0x0003390a, 0x0000530a,
+	0x0003400a, 0x0003440a, 0x0000540a, 0x00034a0a, 0x00034e0a, 0x0000550a, 0x0003540a, 0x0003580a,
+	0x0000560a, 0x0003620a, 0x0000570a, 0x0000580a, 0x0003760a, 0x0000590a, 0x0000090a, 0x00038a0a,
+	0x00005b0a, 0x00005c0a, 0x00039e0a, 0x00005d0a, 0x00005e0a, 0x0003b20a, 0x00005f0a, 0x0000600a,
+	0x0003c60a, 0x0000610a, 0x0000620a, 0x0003db0a, 0x0000630a, 0x0000010b, 0x0003ef0b, 0x0000650b,
+	0x0000660b, 0x0000670b, 0x0004090b, 0x0000680b, 0x0000690b, 0x00041e0b, 0x00006a0b, 0x00006b0b,
+	0x0004320b, 0x00006c0b, 0x00006d0b, 0x0004460b, 0x00000b0b, 0x00006f0b, 0x00045a0b, 0x0000700b,
+	0x0000710b, 0x00046e0b, 0x0000720b, 0x0000730b, 0x0004820b, 0x0000740b, 0x0000750b, 0x0004960b,
+	0x0000760b, 0x0000770b, 0x0004ab0b, 0x00000c0b, 0x0000790b, 0x0004bf0b, 0x00007a0b, 0x00007b0b,
+	0x0004d30b, 0x00007c0b, 0x00007d0b, 0x0004e70b, 0x00007e0b, 0x00007f0b, 0x0004fb0b, 0x0000800b,
+	0x0000810b, 0x00050f0b, 0x00000d0b, 0x0000830b, 0x0005230b, 0x0000840b, 0x0000850b, 0x0005370b,
+	0x0000860b, 0x0000870b, 0x00054c0b, 0x0000880b, 0x0000890b, 0x0005600b, 0x00008a0b, 0x00008b0b,
+	0x0005740b, 0x00000e0b, 0x00008d0b, 0x0005880b, 0x00008e0b, 0x00008f0b, 0x00059c0b, 0x0000900b,
+	0x0000910b, 0x0005b00b, 0x0000920b, 0x0000930b, 0x0005c40b, 0x0000940b, 0x0000950b, 0x0005d90b,
+	0x00000f0b, 0x0000970b, 0x0000980b, 0x0005f30b, 0x0000990b, 0x00009a0b, 0x0006080b, 0x00009b0b,
+	0x00009c0b, 0x00061c0b, 0x00009d0b, 0x00009e0b, 0x0006300b, 0x00009f0b, 0x0000100b, 0x0006440b,
+	0x0000a10b, 0x0000a20b, 0x0006580b, 0x0000a30b, 0x0000a40b, 0x00066c0b, 0x0000a50b, 0x0000a60b,
+	0x0006800b, 0x0000a70b, 0x0000a80b, 0x0006940b, 0x0000a90b, 0x0000110b, 0x0006a90b, 0x0000ab0b,
+	0x0000ac0b, 0x0000ad0b, 0x0000ae0b, 0x0000b00b, 0x0000b10b, 0x0000b30b, 0x0000120b, 0x0000b50b,
+	0x0000b70b, 0x0000b80b, 0x0000b90b, 0x0000bb0b, 0x0000bc0b, 0x0000bd0b, 0x0000130b, 0x0000c00b,
+	0x0000c10b, 0x0000c30b, 0x0000c40b, 0x0000c50b, 0x0000c70b, 0x0000020b, 0x0000c90b, 0x0000cb0b,
+	0x0000cc0b, 0x0000cd0b, 0x0000cf0b, 0x0000d00b, 0x0000150b, 0x0000d30b, 0x0000d40b, 0x0000d50b,
+	0x0000d70b, 0x0000d80b, 0x0000d90b, 0x0000db0b, 0x0000160b, 0x0000dd0b, 0x0000df0b, 0x0000e00b,
+	0x0000e10b, 0x0000e30b, 0x0000e40b, 0x0000170b, 0x0000e70b, 0x0000e80b, 0x0000ea0b, 0x0000eb0b,
+	0x0000ec0b, 0x0000ee0b, 0x0000ef0b, 0x0000180b, 0x0000f20b, 0x0000f30b, 0x0000f40b, 0x0000f60b,
+	0x0000f70b, 0x0000f80b, 0x0000190b, 0x0000fb0b, 0x0000fc0b, 0x0000fe0b, 0x0000ff0b, 0x0001000b,
+	0x0001020b, 0x0001030b, 0x00001a0b, 0x0001060b, 0x0001070b, 0x0001080b, 0x00010a0b, 0x00010b0b,
+	0x00010c0b, 0x00001b0b, 0x00010f0b, 0x0001100b, 0x0001120b, 0x0001130b, 0x0001140b, 0x0001160b,
+	0x0001170b, 0x00001c0b, 0x00011a0b, 0x00011b0b, 0x00011d0b, 0x00011e0b, 0x00011f0b, 0x0001210b,
+	0x00001d0b, 0x0001230b, 0x0001250b, 0x0001260b, 0x0001270b, 0x0001290b, 0x00012a0b, 0x00012b0b,
+	0x0000030b, 0x00012e0b, 0x00012f0b, 0x0001310b, 0x0001320b, 0x0001330b, 0x0001350b, 0x00001f0b,
+	0x0001370b, 0x0001390b, 0x00013a0b, 0x00013b0b, 0x00013d0b, 0x00013e0b, 0x0000200b, 0x0001410b,
+	0x0001420b, 0x0001430b, 0x0001450b, 0x0001460b, 0x0001470b, 0x0001490b, 0x0000210b, 0x00014c0b,
+	0x00014d0b, 0x00014e0b, 0x0001500b, 0x0001510b, 0x0001520b, 0x0000220b, 0x0001550b, 0x0001560b,
+	0x0001580b, 0x00015a0b, 0x0000230b, 0x0001600b, 0x0001620b, 0x0001650b, 0x0000240b, 0x00016a0b,
+	0x00016d0b, 0x0001700b, 0x0000250b, 0x0001750b, 0x0001780b, 0x00017a0b, 0x0000260b, 0x0001800b,
+	0x0001830b, 0x0000270b, 0x0001880b, 0x00018b0b, 0x00018d0b, 0x0000040b, 0x0001930b, 0x0001950b,
+	0x0001980b, 0x0000290b, 0x00019d0b, 0x0001a00b, 0x00002a0b, 0x0001a50b, 0x0001a80b, 0x0001ab0b,
+	0x00002b0b, 0x0001b00b, 0x0001b30b, 0x0001b60b, 0x00002c0b, 0x0001bb0b, 0x0001be0b, 0x0001c00b,
+	0x00002d0b, 0x0001c60b, 0x0001c80b, 0x00002e0b, 0x0001ce0b, 0x0001d00b, 0x0001d30b, 0x00002f0b,
+	0x0001d80b, 0x0001db0b, 0x0001de0b, 0x0000300b, 0x0001e30b, 0x0001e60b, 0x0001e90b, 0x0000310b,
+	0x0001ee0b, 0x0001f10b, 0x0000050b, 0x0001f60b, 0x0001f90b, 0x0001fb0b, 0x0000330b, 0x0002010b,
+	0x0002030b, 0x0002060b, 0x0000340b, 0x00020b0b, 0x00020e0b, 0x0000350b, 0x0002140b, 0x0002160b,
+	0x0002190b, 0x0000360b, 0x00021e0b, 0x0002210b, 0x0002240b, 0x0000370b, 0x0002290b, 0x00022c0b,
+	0x00022e0b, 0x0000380b, 0x0002340b, 0x0002360b, 0x0000390b, 0x00023c0b, 0x00023e0b, 0x0002410b,
+	0x00003a0b, 0x0002470b, 0x0002490b, 0x00024c0b, 0x00003b0b, 0x0002510b, 0x0002540b, 0x0002570b,
+	0x0000060b, 0x00025c0b, 0x00025f0b, 0x00003d0b, 0x0002640b, 0x0002670b, 0x0002690b, 0x00003e0b,
+	0x00026f0b, 0x0002710b, 0x0002740b, 0x00003f0b, 0x00027a0b, 0x00027c0b, 0x0000400b, 0x0002820b,
+	0x0002840b, 0x0002870b, 0x0000410b, 0x00028c0b, 0x00028f0b, 0x0002920b, 0x0000420b, 0x0002970b,
+	0x00029a0b, 0x00029c0b, 0x0000430b, 0x0002a20b, 0x0002a40b, 0x0000440b, 0x0002aa0b, 0x0002ad0b,
+	0x0002af0b, 0x0000450b, 0x0000070b, 0x0002bf0b, 0x0000470b, 0x0002ca0b, 0x0000480b, 0x0002d50b,
+	0x0000490b, 0x0002e00b, 0x00004a0b, 0x0002ea0b, 0x00004b0b, 0x0002f50b, 0x00004c0b, 0x00004d0b,
+	0x0003050b, 0x00004e0b, 0x0003100b, 0x00004f0b, 0x00031b0b, 0x0000080b, 0x0003250b, 0x0000510b,
+	0x0003300b, 0x0000520b, 0x00033b0b, 0x0000530b, 0x0000540b, 0x00034b0b, 0x0000550b, 0x0003560b,
+	0x0000560b, 0x0003600b, 0x0000570b, 0x00036b0b, 0x0000580b, 0x0003760b, 0x0000590b, 0x0003810b,
+	0x0000090b, 0x00038b0b, 0x00005b0b, 0x00005c0b, 0x00039b0b, 0x00005d0b, 0x0003a60b, 0x00005e0b,
+	0x0003b10b, 0x00005f0b, 0x0003bc0b, 0x0000600b, 0x0003c60b, 0x0000610b, 0x0003d10b, 0x0000620b,
+	0x0000630b, 0x0003e10b, 0x0000010c, 0x0003ec0c, 0x0000650c, 0x0003f70c, 0x0000660c, 0x0004010c,
+	0x0000670c, 0x00040c0c, 0x0000680c, 0x0004170c, 0x0000690c, 0x00006a0c, 0x0004270c, 0x00006b0c,
+	0x0004320c, 0x00006c0c, 0x00043c0c, 0x00006d0c, 0x0004470c, 0x00000b0c, 0x0004520c, 0x00006f0c,
+	0x00045d0c, 0x0000700c, 0x0000710c, 0x00046d0c, 0x0000720c, 0x0004780c, 0x0000730c, 0x0004820c,
+	0x0000740c, 0x00048d0c, 0x0000750c, 0x0004980c, 0x0000760c, 0x0004a20c, 0x0000770c, 0x0004ad0c,
+	0x00000c0c, 0x0000790c, 0x0004bd0c, 0x00007a0c, 0x0004c80c, 0x00007b0c, 0x0004d30c, 0x00007c0c,
+	0x0004de0c, 0x00007d0c, 0x0004e80c, 0x00007e0c, 0x0004f30c, 0x00007f0c, 0x0000800c, 0x0005030c,
+	0x0000810c, 0x00050e0c, 0x00000d0c, 0x0005190c, 0x0000830c, 0x0005230c, 0x0000840c, 0x00052e0c,
+	0x0000850c, 0x0005390c, 0x0000860c, 0x0000870c, 0x0005490c, 0x0000880c, 0x0005540c, 0x0000890c,
+	0x00055e0c, 0x00008b0c, 0x00000e0c, 0x00008d0c, 0x00008e0c, 0x00008f0c, 0x0000900c, 0x0000910c,
+	0x0000920c, 0x0000930c, 0x0000940c, 0x0000950c, 0x00000f0c, 0x0000970c, 0x0000980c, 0x00009a0c,
+	0x00009b0c, 0x00009c0c, 0x00009d0c, 0x00009e0c, 0x00009f0c, 0x0000100c, 0x0000a10c, 0x0000a20c,
+	0x0000a30c, 0x0000a40c, 0x0000a50c, 0x0000a60c, 0x0000a80c, 0x0000a90c, 0x0000110c, 0x0000ab0c,
+	0x0000ac0c, 0x0000ad0c, 0x0000ae0c, 0x0000af0c, 0x0000b00c, 0x0000b10c, 0x0000b20c, 0x0000b30c,
+	0x0000120c, 0x0000b50c, 0x0000b70c, 0x0000b80c, 0x0000b90c, 0x0000ba0c, 0x0000bb0c, 0x0000bc0c,
+	0x0000bd0c, 0x0000130c, 0x0000bf0c, 0x0000c00c, 0x0000c10c, 0x0000c20c, 0x0000c30c, 0x0000c40c,
+	0x0000c60c, 0x0000c70c, 0x0000020c, 0x0000c90c, 0x0000ca0c, 0x0000cb0c, 0x0000cc0c, 0x0000cd0c,
+	0x0000ce0c, 0x0000cf0c, 0x0000d00c, 0x0000d10c, 0x0000150c, 0x0000d40c, 0x0000d50c, 0x0000d60c,
+	0x0000d70c, 0x0000d80c, 0x0000d90c, 0x0000da0c, 0x0000db0c, 0x0000160c, 0x0000dd0c, 0x0000de0c,
+	0x0000df0c, 0x0000e00c, 0x0000e10c, 0x0000e30c, 0x0000e40c, 0x0000e50c, 0x0000170c, 0x0000e70c,
+	0x0000e80c, 0x0000e90c, 0x0000ea0c, 0x0000eb0c, 0x0000ec0c, 0x0000ed0c, 0x0000ee0c, 0x0000ef0c,
+	0x0000180c, 0x0000f20c, 0x0000f30c, 0x0000f40c, 0x0000f50c, 0x0000f60c, 0x0000f70c, 0x0000f80c,
+	0x0000f90c, 0x0000190c, 0x0000fb0c, 0x0000fc0c, 0x0000fd0c, 0x0000fe0c, 0x0001000c, 0x0001010c,
+	0x0001020c, 0x0001030c, 0x00001a0c, 0x0001050c, 0x0001060c, 0x0001070c, 0x0001080c, 0x0001090c,
+	0x00010a0c, 0x00010b0c, 0x00010c0c, 0x00001b0c, 0x00010f0c, 0x0001100c, 0x0001110c, 0x0001120c,
+	0x0001130c, 0x0001150c, 0x00001c0c, 0x0001190c, 0x00011b0c, 0x00011e0c, 0x0001200c, 0x00001d0c,
+	0x0001240c, 0x0001260c, 0x0001280c, 0x00012b0c, 0x0000030c, 0x00012f0c, 0x0001310c, 0x0001330c,
+	0x00001f0c, 0x0001370c, 0x00013a0c, 0x00013c0c, 0x00013e0c, 0x0000200c, 0x0001420c, 0x0001440c,
+	0x0001460c, 0x0001490c, 0x0000210c, 0x00014d0c, 0x00014f0c, 0x0001510c, 0x0000220c, 0x0001550c,
+	0x0001580c, 0x00015a0c, 0x00015c0c, 0x0000230c, 0x0001600c, 0x0001620c, 0x0001640c, 0x0001670c,
+	0x0000240c, 0x00016b0c, 0x00016d0c, 0x00016f0c, 0x0000250c, 0x0001740c, 0x0001760c, 0x0001780c,
+	0x00017a0c, 0x0000260c, 0x00017e0c, 0x0001800c, 0x0001830c, 0x0001850c, 0x0000270c, 0x0001890c,
+	0x00018b0c, 0x00018d0c, 0x0000040c, 0x0001920c, 0x0001940c, 0x0001960c, 0x0001980c, 0x0000290c,
+	0x00019c0c, 0x00019e0c, 0x0001a10c, 0x0001a30c, 0x00002a0c, 0x0001a70c, 0x0001a90c, 0x0001ab0c,
+	0x00002b0c, 0x0001b00c, 0x0001b20c, 0x0001b40c, 0x0001b60c, 0x00002c0c, 0x0001ba0c, 0x0001bd0c,
+	0x0001bf0c, 0x0001c10c, 0x00002d0c, 0x0001c50c, 0x0001c70c, 0x0001c90c, 0x00002e0c, 0x0001ce0c,
+	0x0001d00c, 0x0001d20c, 0x0001d40c, 0x00002f0c, 0x0001d80c, 0x0001db0c, 0x0001dd0c, 0x0001df0c,
+	0x0000300c, 0x0001e30c, 0x0001e50c, 0x0001e70c, 0x0000310c, 0x0001ec0c, 0x0001ee0c, 0x0001f00c,
+	0x0001f20c, 0x0000050c, 0x0001f70c, 0x0001f90c, 0x0001fb0c, 0x0000330c, 0x0001ff0c, 0x0002010c,
+	0x0002030c, 0x0002060c, 0x0000340c, 0x00020a0c, 0x00020c0c, 0x00020e0c, 0x0002100c, 0x0000350c,
+	0x0002150c, 0x0002170c, 0x0002190c, 0x0000360c, 0x00021d0c, 0x00021f0c, 0x0002210c, 0x0002240c,
+	0x0000370c, 0x00022a0c, 0x0000380c, 0x0002330c, 0x0002370c, 0x0000390c, 0x0002400c, 0x00003a0c,
+	0x0002480c, 0x00003b0c, 0x0002510c, 0x0002550c, 0x0000060c, 0x00025e0c, 0x00003d0c, 0x0002660c,
+	0x00003e0c, 0x00026f0c, 0x0002730c, 0x00003f0c, 0x00027c0c, 0x0000400c, 0x0002840c, 0x0000410c,
+	0x00028d0c, 0x0002910c, 0x0000420c, 0x00029a0c, 0x0000430c, 0x0002a20c, 0x0000440c, 0x0002ab0c,
+	0x0002af0c, 0x0000450c, 0x0002b80c, 0x0000070c, 0x0002c00c, 0x0000470c, 0x0002c90c, 0x0002cd0c,
+	0x0000480c, 0x0002d60c, 0x0000490c, 0x0002de0c, 0x00004a0c, 0x0002e70c, 0x0002eb0c, 0x00004b0c,
+	0x0002f40c, 0x00004c0c, 0x0002fd0c, 0x00004d0c, 0x0003050c, 0x0003090c, 0x00004e0c, 0x0003120c,
+	0x00004f0c, 0x00031b0c, 0x0000080c, 0x0003230c, 0x0003270c, 0x0000510c, 0x0003300c, 0x0000520c,
+	0x0003390c, 0x0000530c, 0x0003410c, 0x0003460c, 0x0000540c, 0x00034e0c, 0x0000550c, 0x0003570c,
+	0x0000560c, 0x00035f0c, 0x0003640c, 0x0000570c, 0x00036c0c, 0x0000580c, 0x0003750c, 0x0000590c,
+	0x00037d0c, 0x0003820c, 0x0000090c, 0x00038a0c, 0x00005b0c, 0x0003930c, 0x00005c0c, 0x00039b0c,
+	0x0003a00c, 0x00005d0c, 0x0003a80c, 0x00005e0c, 0x0003b10c, 0x00005f0c, 0x0003b90c, 0x0003be0c,
+	0x0000600c, 0x0003c60c, 0x0000610c, 0x0003cf0c, 0x0000620c, 0x0003d80c, 0x0003dc0c, 0x0000630c,
+	0x0003e40c, 0x0000010d, 0x0003ed0d, 0x0000650d, 0x0003f60d, 0x0000660d, 0x0003fe0d, 0x0004020d,
+	0x0000670d, 0x00040b0d, 0x0000680d, 0x0004140d, 0x0000690d, 0x00041c0d, 0x0004210d, 0x00006a0d,
+	0x0004290d, 0x00006b0d, 0x0004320d, 0x00006c0d, 0x00043a0d, 0x00043f0d, 0x00006d0d, 0x0004470d,
+	0x00000b0d, 0x00006f0d, 0x0000700d, 0x0004650d, 0x0000710d, 0x0000720d, 0x0000730d, 0x0000740d,
+	0x0000750d, 0x0000760d, 0x0004a10d, 0x0000770d, 0x00000c0d, 0x0000790d, 0x00007a0d, 0x00007b0d,
+	0x00007c0d, 0x0004de0d, 0x00007d0d, 0x00007e0d, 0x00007f0d, 0x0000800d, 0x0000810d, 0x00000d0d,
+	0x00051a0d, 0x0000830d, 0x0000840d, 0x0000850d, 0x0000860d, 0x0000870d, 0x0000880d, 0x0000890d,
+	0x00055e0d, 0x00008a0d, 0x00008b0d, 0x00000e0d, 0x00008d0d, 0x00008e0d, 0x00008f0d, 0x00059b0d,
+	0x0000900d, 0x0000910d, 0x0000920d, 0x0000930d, 0x0000940d, 0x0000950d, 0x0005d70d, 0x00000f0d,
+	0x0000970d, 0x0000980d, 0x0000990d, 0x00009a0d, 0x00009b0d, 0x0006130d, 0x00009c0d, 0x00009d0d,
+	0x00009e0d, 0x00009f0d, 0x0000100d, 0x0000a10d, 0x00064f0d, 0x0000a20d, 0x0000a30d, 0x0000a40d,
+	0x0000a50d, 0x0000a60d, 0x0000a70d, 0x00068b0d, 0x0000a80d, 0x0000a90d, 0x0000110d, 0x0000ab0d,
+	0x0000ac0d, 0x0000ad0d, 0x0006c70d, 0x0000ae0d, 0x0000af0d, 0x0000b00d, 0x0000b10d, 0x0000b20d,
+	0x0000b30d, 0x0007030d, 0x0000120d, 0x0000b50d, 0x0000b60d, 0x0000b70d, 0x0000b80d, 0x0000b90d,
+	0x00073f0d, 0x0000ba0d, 0x0000bb0d, 0x0000bc0d, 0x0000bd0d, 0x0000130d, 0x0000bf0d, 0x00077c0d,
+	0x0000c00d, 0x0000c10d, 0x0000c20d, 0x0000c30d, 0x0000c40d, 0x0000c50d, 0x0007b80d, 0x0000c60d,
+	0x0000c70d, 0x0000020d, 0x0000c90d, 0x0000ca0d, 0x0000cb0d, 0x0000cc0d, 0x0007fc0d, 0x0000cd0d,
+	0x0000ce0d, 0x0000cf0d, 0x0000d00d, 0x0000d10d, 0x0000150d, 0x0008390d, 0x0000d30d, 0x0000d40d,
+	0x0000d50d, 0x0000d60d, 0x0000d70d, 0x0000d80d, 0x0008750d, 0x0000d90d, 0x0000da0d, 0x0000db0d,
+	0x0000160d, 0x0000de0d, 0x0000df0d, 0x0000e10d, 0x0000e30d, 0x0000e40d, 0x0000170d, 0x0000e80d,
+	0x0000ea0d, 0x0000eb0d, 0x0000ed0d, 0x0000ef0d, 0x0000180d, 0x0000f20d, 0x0000f40d, 0x0000f60d,
+	0x0000f70d, 0x0000f90d, 0x0000190d, 0x0000fd0d, 0x0000fe0d, 0x0001000d, 0x0001020d, 0x00001a0d,
+	0x0001050d, 0x0001070d, 0x0001090d, 0x00010a0d, 0x00010c0d, 0x00001b0d, 0x00010f0d, 0x0001110d,
+	0x0001130d, 0x0001150d, 0x0001160d, 0x00001c0d, 0x00011a0d, 0x00011b0d, 0x00011d0d, 0x00011f0d,
+	0x0001210d, 0x00001d0d, 0x0001240d, 0x0001260d, 0x0001270d, 0x0001290d, 0x00012b0d, 0x0000030d,
+	0x00012e0d, 0x0001300d, 0x0001320d, 0x0001340d, 0x00001f0d, 0x0001370d, 0x0001390d, 0x00013a0d,
+	0x00013c0d, 0x00013e0d, 0x0000200d, 0x0001410d, 0x0001430d, 0x0001450d, 0x0001460d, 0x0001480d,
+	0x0000210d, 0x00014c0d, 0x00014d0d, 0x00014f0d, 0x0001510d, 0x0001520d, 0x0000220d, 0x0001560d,
+	0x0001580d, 0x0001590d, 0x00015b0d, 0x00015d0d, 0x0000230d, 0x0001600d, 0x0001620d, 0x0001640d,
+	0x0001650d, 0x0001670d, 0x0000240d, 0x00016a0d, 0x00016c0d, 0x00016e0d, 0x0001700d, 0x0000250d,
+	0x0001730d, 0x0001750d, 0x0001770d, 0x0001780d, 0x00017a0d, 0x0000260d, 0x00017d0d, 0x00017f0d,
+	0x0001810d, 0x0001830d, 0x0001840d, 0x0000270d, 0x0001880d, 0x0001890d, 0x00018b0d, 0x00018d0d,
+	0x00018f0d, 0x0000040d, 0x0001920d, 0x0001940d, 0x0001950d, 0x0001970d, 0x0001990d, 0x0000290d,
+	0x00019c0d, 0x00019e0d, 0x0001a00d, 0x0001a10d, 0x00002a0d, 0x0001a50d, 0x0001a70d, 0x0001a80d,
+	0x0001aa0d, 0x0001ac0d, 0x00002b0d, 0x0001af0d, 0x0001b10d, 0x0001b30d, 0x0001b40d, 0x0001b60d,
+	0x00002c0d, 0x0001bb0d, 0x0001bf0d, 0x00002d0d, 0x0001c60d, 0x0001c90d, 0x00002e0d, 0x0001d00d,
+	0x0001d30d, 0x00002f0d, 0x0001da0d, 0x0001de0d, 0x0000300d, 0x0001e40d, 0x0001e80d, 0x0000310d,
+	0x0001ef0d, 0x0001f20d, 0x0000050d, 0x0001f90d, 0x0000330d, 0x0002000d, 0x0002030d, 0x0000340d,
+	0x00020a0d, 0x00020e0d, 0x0000350d, 0x0002150d, 0x0002180d, 0x0000360d, 0x00021f0d, 0x0002220d,
+	0x0000370d, 0x0002290d, 0x00022d0d, 0x0000380d, 0x0002330d, 0x0002370d, 0x0000390d, 0x00023e0d,
+	0x0002410d, 0x00003a0d, 0x0002480d, 0x00024c0d, 0x00003b0d, 0x0002520d, 0x0002560d, 0x0000060d,
+	0x00025d0d, 0x0002600d, 0x00003d0d, 0x0002670d, 0x00003e0d, 0x00026e0d, 0x0002710d, 0x00003f0d,
+	0x0002780d, 0x00027c0d, 0x0000400d, 0x0002830d, 0x0002860d, 0x0000410d, 0x00028d0d, 0x0002900d,
+	0x0000420d, 0x0002970d, 0x00029b0d, 0x0000430d, 0x0002a10d, 0x0002a50d, 0x0000440d, 0x0002ac0d,
+	0x0002af0d, 0x0000450d, 0x0002b60d, 0x0002ba0d, 0x0000070d, 0x0002c00d, 0x0002c40d, 0x0000470d,
+	0x0002cb0d, 0x0002ce0d, 0x0000480d, 0x0002d50d, 0x0000490d, 0x0002dc0d, 0x0002df0d, 0x00004a0d,
+	0x0002e60d, 0x0002ea0d, 0x00004b0d, 0x0002f00d, 0x0002f40d, 0x00004c0d, 0x0002fb0d, 0x0002fe0d,
+	0x00004d0d, 0x0003050d, 0x0003090d, 0x00004e0d, 0x00030f0d, 0x0003130d, 0x00004f0d, 0x00031a0d,
+	0x00031d0d, 0x0000080d, 0x0003240d, 0x0003270d, 0x0000510d, 0x00032e0d, 0x0003320d, 0x0000520d,
+	0x0003390d, 0x00033c0d, 0x0000530d, 0x0003430d, 0x0000540d, 0x00034a0d, 0x00034d0d, 0x0000550d,
+	0x0003540d, 0x0003580d, 0x0000560d, 0x00035e0d, 0x0003620d, 0x0000570d, 0x0003690d, 0x00036c0d,
+	0x0000580d, 0x0003760d, 0x0000590d, 0x0000090d, 0x00005b0d, 0x0003920d, 0x00005c0d, 0x00005d0d,
+	0x0003a70d, 0x00005e0d, 0x00005f0d, 0x0003bb0d, 0x0000600d, 0x0000610d, 0x0003d00d, 0x0000620d,
+	0x0000630d, 0x0003e40d, 0x0000010e, 0x0000650e, 0x0000660e, 0x0004000e, 0x0000670e, 0x0000680e,
+	0x0004150e, 0x0000690e, 0x00006a0e, 0x0004290e, 0x00006b0e, 0x00006c0e, 0x00043e0e, 0x00006d0e,
+	0x00000b0e, 0x0004520e, 0x00006f0e, 0x0000700e, 0x0000710e, 0x00046e0e, 0x0000720e, 0x0000730e,
+	0x0004820e, 0x0000740e, 0x0000750e, 0x0004970e, 0x0000760e, 0x0000770e, 0x0004ac0e, 0x00000c0e,
+	0x0000790e, 0x0004c00e, 0x00007a0e, 0x00007b0e, 0x00007c0e, 0x0004dc0e, 0x00007d0e, 0x00007e0e,
+	0x0004f00e, 0x00007f0e, 0x0000800e, 0x0005050e, 0x0000810e, 0x00000d0e, 0x00051a0e, 0x0000830e,
+	0x0000840e, 0x00052e0e, 0x0000850e, 0x0000860e, 0x0000870e, 0x00054a0e, 0x0000880e, 0x0000890e,
+	0x00055e0e, 0x00008a0e, 0x00008b0e, 0x0005730e, 0x00000e0e, 0x00008d0e, 0x0005880e, 0x00008e0e,
+	0x00008f0e, 0x00059c0e, 0x0000900e, 0x0000910e, 0x0000920e, 0x0005b80e, 0x0000930e, 0x0000940e,
+	0x0005cc0e, 0x0000950e, 0x00000f0e, 0x0005e10e, 0x0000970e, 0x0000980e, 0x0005f60e, 0x0000990e,
+	0x00009a0e, 0x00060a0e, 0x00009b0e, 0x00009c0e, 0x00009d0e, 0x0006260e, 0x00009e0e, 0x00009f0e,
+	0x00063a0e, 0x0000100e, 0x0000a10e, 0x00064f0e, 0x0000a20e, 0x0000a30e, 0x0006640e, 0x0000a40e,
+	0x0000a50e, 0x0006780e, 0x0000a60e, 0x0000a70e, 0x0000a80e, 0x0006940e, 0x0000a90e, 0x0000110e,
+	0x0006a80e, 0x0000ab0e, 0x0000ac0e, 0x0006bd0e, 0x0000ad0e, 0x0000ae0e, 0x0006d10e, 0x0000af0e,
+	0x0000b00e, 0x0000b10e, 0x0000b30e, 0x0000120e, 0x0000b50e, 0x0000b70e, 0x0000b80e, 0x0000ba0e,
+	0x0000bb0e, 0x0000bc0e, 0x0000130e, 0x0000bf0e, 0x0000c00e, 0x0000c20e, 0x0000c30e, 0x0000c50e,
+	0x0000c60e, 0x0000c70e, 0x0000020e, 0x0000ca0e, 0x0000cb0e, 0x0000cd0e, 0x0000ce0e, 0x0000d00e,
+	0x0000d10e, 0x0000150e, 0x0000d40e, 0x0000d50e, 0x0000d60e, 0x0000d80e, 0x0000d90e, 0x0000db0e,
+	0x0000160e, 0x0000dd0e, 0x0000df0e, 0x0000e00e, 0x0000e10e, 0x0000e30e, 0x0000e40e, 0x0000170e,
+	0x0000e70e, 0x0000e80e, 0x0000ea0e, 0x0000eb0e, 0x0000ec0e, 0x0000ee0e, 0x0000ef0e, 0x0000180e,
+	0x0000f20e, 0x0000f30e, 0x0000f50e, 0x0000f60e, 0x0000f70e, 0x0000f90e, 0x0000190e, 0x0000fc0e,
+	0x0000fd0e, 0x0000fe0e, 0x0001000e, 0x0001010e, 0x0001020e, 0x00001a0e, 0x0001050e, 0x0001070e,
+	0x0001080e, 0x0001090e, 0x00010b0e, 0x00010c0e, 0x00001b0e, 0x00010f0e, 0x0001100e, 0x0001120e,
+	0x0001130e, 0x0001140e, 0x0001160e, 0x0001170e, 0x00001c0e, 0x00011a0e, 0x00011b0e, 0x00011c0e,
+	0x00011e0e, 0x00011f0e, 0x0001210e, 0x00001d0e, 0x0001230e, 0x0001250e, 0x0001260e, 0x0001270e,
+	0x0001290e, 0x00012a0e, 0x0000030e, 0x00012d0e, 0x00012e0e, 0x0001300e, 0x0001310e, 0x0001320e,
+	0x0001340e, 0x0001350e, 0x00001f0e, 0x0001380e, 0x0001390e, 0x00013b0e, 0x00013c0e, 0x00013d0e,
+	0x00013f0e, 0x0000200e, 0x0001420e, 0x0001430e, 0x0001440e, 0x0001460e, 0x0001470e, 0x0001480e,
+	0x0000210e, 0x00014b0e, 0x00014d0e, 0x00014e0e, 0x00014f0e, 0x0001510e, 0x0001520e, 0x0000220e,
+	0x0001550e, 0x0001560e, 0x0001580e, 0x0001590e, 0x00015a0e, 0x00015c0e, 0x00015d0e, 0x0000230e,
+	0x0001600e, 0x0001630e, 0x0001650e, 0x0000240e, 0x00016b0e, 0x00016e0e, 0x0001700e, 0x0000250e,
+	0x0001760e, 0x0001790e, 0x0000260e, 0x00017e0e, 0x0001810e, 0x0001840e, 0x0000270e, 0x0001890e,
+	0x00018c0e, 0x00018f0e, 0x0000040e, 0x0001940e, 0x0001970e, 0x0000290e, 0x00019c0e, 0x00019f0e,
+	0x0001a20e, 0x00002a0e, 0x0001a70e, 0x0001aa0e, 0x00002b0e, 0x0001b00e, 0x0001b20e, 0x0001b50e,
+	0x00002c0e, 0x0001bb0e, 0x0001bd0e, 0x0001c00e, 0x00002d0e, 0x0001c60e, 0x0001c80e, 0x00002e0e,
+	0x0001ce0e, 0x0001d10e, 0x0001d30e, 0x00002f0e, 0x0001d90e, 0x0001dc0e, 0x0001de0e, 0x0000300e,
+	0x0001e40e, 0x0001e70e, 0x0000310e, 0x0001ec0e, 0x0001ef0e, 0x0001f20e, 0x0000050e, 0x0001f70e,
+	0x0001fa0e, 0x0001fd0e, 0x0000330e, 0x0002020e, 0x0002050e, 0x0000340e, 0x00020a0e, 0x00020d0e,
+	0x0002100e, 0x0000350e, 0x0002150e, 0x0002180e, 0x0000360e, 0x00021e0e, 0x0002200e, 0x0002230e,
+	0x0000370e, 0x0002290e, 0x00022b0e, 0x00022e0e, 0x0000380e, 0x0002330e, 0x0002360e, 0x0000390e,
+	0x00023c0e, 0x00023e0e, 0x0002410e, 0x00003a0e, 0x0002470e, 0x0002490e, 0x00024c0e, 0x00003b0e,
+	0x0002520e, 0x0002540e, 0x0000060e, 0x00025a0e, 0x00025d0e, 0x00025f0e, 0x00003d0e, 0x0002650e,
+	0x0002680e, 0x00026a0e, 0x00003e0e, 0x0002700e, 0x0002730e, 0x00003f0e, 0x0002780e, 0x00027b0e,
+	0x00027e0e, 0x0000400e, 0x0002830e, 0x0002860e, 0x0000410e, 0x00028b0e, 0x00028e0e, 0x0002910e,
+	0x0000420e, 0x0002960e, 0x0002990e, 0x00029c0e, 0x0000430e, 0x0002a10e, 0x0002a40e, 0x0000440e,
+	0x0002aa0e, 0x0002ac0e, 0x0002af0e, 0x0000450e, 0x0002b50e, 0x0002b70e, 0x0002ba0e, 0x0000070e,
+	0x0002c00e, 0x0000470e, 0x0002cb0e, 0x0000480e, 0x0002d60e, 0x0000490e, 0x0002e10e, 0x00004a0e,
+	0x00004b0e, 0x0002f10e, 0x00004c0e, 0x0002fc0e, 0x00004d0e, 0x0003070e, 0x00004e0e, 0x0003120e,
+	0x00004f0e, 0x00031d0e, 0x0000080e, 0x0000510e, 0x00032e0e, 0x0000520e, 0x0003390e, 0x0000530e,
+	0x0003440e, 0x0000540e, 0x00034f0e, 0x0000550e, 0x0000560e, 0x00035f0e, 0x0000570e, 0x00036a0e,
+	0x0000580e, 0x0003750e, 0x0000590e, 0x0003800e, 0x0000090e, 0x00038b0e, 0x00005b0e, 0x00005c0e,
+	0x00039c0e, 0x00005d0e, 0x0003a70e, 0x00005e0e, 0x0003b20e, 0x00005f0e, 0x0003bd0e, 0x0000600e,
+	0x0000610e, 0x0003cd0e, 0x0000620e, 0x0003d80e, 0x0000630e, 0x0003e30e, 0x0000010f, 0x0003ee0f,
+	0x0000650f, 0x0003f90f, 0x0000660f, 0x0000670f, 0x00040a0f, 0x0000680f, 0x0004150f, 0x0000690f,
+	0x0004200f, 0x00006a0f, 0x00042b0f, 0x00006b0f, 0x00006c0f, 0x00043b0f, 0x00006d0f, 0x0004460f,
+	0x00000b0f, 0x0004510f, 0x00006f0f, 0x00045c0f, 0x0000700f, 0x0004670f, 0x0000710f, 0x0000720f,
+	0x0004770f, 0x0000730f, 0x0004820f, 0x0000740f, 0x00048d0f, 0x0000750f, 0x0004980f, 0x0000760f,
+	0x0000770f, 0x0004a90f, 0x00000c0f, 0x0004b40f, 0x0000790f, 0x0004bf0f, 0x00007a0f, 0x0004ca0f,
+	0x00007b0f, 0x0004d50f, 0x00007c0f, 0x00007d0f, 0x0004e50f, 0x00007e0f, 0x0004f00f, 0x00007f0f,
+	0x0004fb0f, 0x0000800f, 0x0005060f, 0x0000810f, 0x00000d0f, 0x0005170f, 0x0000830f, 0x0005220f,
+	0x0000840f, 0x00052d0f, 0x0000850f, 0x0005380f, 0x0000860f, 0x0005430f, 0x0000870f, 0x0000880f,
+	0x0005530f, 0x0000890f, 0x00055e0f, 0x00008a0f, 0x0005690f, 0x00008b0f, 0x0005740f, 0x00000e0f,
+	0x00008d0f, 0x00008e0f, 0x00008f0f, 0x0000900f, 0x0000910f, 0x0000920f, 0x0000930f, 0x0000940f,
+	0x00000f0f, 0x0000970f, 0x0000980f, 0x0000990f, 0x00009a0f, 0x00009b0f, 0x00009c0f, 0x00009d0f,
+	0x00009e0f, 0x00009f0f, 0x0000100f, 0x0000a20f, 0x0000a30f, 0x0000a40f, 0x0000a50f, 0x0000a60f,
+	0x0000a70f, 0x0000a80f, 0x0000a90f, 0x0000110f, 0x0000ac0f, 0x0000ad0f, 0x0000ae0f, 0x0000af0f,
+	0x0000b00f, 0x0000b10f, 0x0000b20f, 0x0000b30f, 0x0000120f, 0x0000b50f, 0x0000b70f, 0x0000b80f,
+	0x0000b90f, 0x0000ba0f, 0x0000bb0f, 0x0000bc0f, 0x0000bd0f, 0x0000130f, 0x0000bf0f, 0x0000c00f,
+	0x0000c20f, 0x0000c30f, 0x0000c40f, 0x0000c50f, 0x0000c60f, 0x0000c70f, 0x0000020f, 0x0000c90f,
+	0x0000ca0f, 0x0000cb0f, 0x0000cd0f, 0x0000ce0f, 0x0000cf0f, 0x0000d00f, 0x0000d10f, 0x0000150f,
+	0x0000d30f, 0x0000d40f, 0x0000d50f, 0x0000d60f, 0x0000d80f, 0x0000d90f, 0x0000da0f, 0x0000db0f,
+	0x0000160f, 0x0000dd0f, 0x0000de0f, 0x0000df0f, 0x0000e00f, 0x0000e10f, 0x0000e20f, 0x0000e40f,
+	0x0000e50f, 0x0000170f, 0x0000e70f, 0x0000e80f, 0x0000e90f, 0x0000ea0f, 0x0000eb0f, 0x0000ec0f,
+	0x0000ed0f, 0x0000ef0f, 0x0000180f, 0x0000f10f, 0x0000f20f, 0x0000f30f, 0x0000f40f, 0x0000f50f,
+	0x0000f60f, 0x0000f70f, 0x0000f80f, 0x0000190f, 0x0000fb0f, 0x0000fc0f, 0x0000fd0f, 0x0000fe0f,
+	0x0000ff0f, 0x0001000f, 0x0001010f, 0x0001020f, 0x00001a0f, 0x0001050f, 0x0001060f, 0x0001070f,
+	0x0001080f, 0x0001090f, 0x00010a0f, 0x00010b0f, 0x00010c0f, 0x00010d0f, 0x00001b0f, 0x0001100f,
+	0x0001110f, 0x0001120f, 0x0001130f, 0x0001140f, 0x0001150f, 0x0001160f, 0x0001170f, 0x00001c0f,
+	0x0001190f, 0x00011c0f, 0x00011e0f, 0x0001200f, 0x00001d0f, 0x0001240f, 0x0001270f, 0x0001290f,
+	0x0000030f, 0x00012d0f, 0x00012f0f, 0x0001320f, 0x0001340f, 0x00001f0f, 0x0001380f, 0x00013a0f,
+	0x00013d0f, 0x00013f0f, 0x0000200f, 0x0001430f, 0x0001450f, 0x0001480f, 0x0000210f, 0x00014c0f,
+	0x00014e0f, 0x0001500f, 0x0001530f, 0x0000220f, 0x0001570f, 0x0001590f, 0x00015b0f, 0x0000230f,
+	0x0001600f, 0x0001620f, 0x0001640f, 0x0001660f, 0x0000240f, 0x00016b0f, 0x00016d0f, 0x00016f0f,
+	0x0000250f, 0x0001740f, 0x0001760f, 0x0001780f, 0x00017a0f, 0x0000260f, 0x00017f0f, 0x0001810f,
+	0x0001830f, 0x0000270f, 0x0001870f, 0x00018a0f, 0x00018c0f, 0x00018e0f, 0x0000040f, 0x0001920f,
+	0x0001950f, 0x0001970f, 0x0000290f, 0x00019b0f, 0x00019d0f, 0x0001a00f, 0x0001a20f, 0x00002a0f,
+	0x0001a60f, 0x0001a80f, 0x0001ab0f, 0x0001ad0f, 0x00002b0f, 0x0001b10f, 0x0001b30f, 0x0001b60f,
+	0x00002c0f, 0x0001ba0f, 0x0001bc0f, 0x0001be0f, 0x0001c10f, 0x00002d0f, 0x0001c50f, 0x0001c70f,
+	0x0001c90f, 0x00002e0f, 0x0001ce0f, 0x0001d00f, 0x0001d20f, 0x0001d40f, 0x00002f0f, 0x0001d90f,
+	0x0001db0f, 0x0001dd0f, 0x0000300f, 0x0001e20f, 0x0001e40f, 0x0001e60f, 0x0001e80f, 0x0000310f,
+	0x0001ed0f, 0x0001ef0f, 0x0001f10f, 0x0000050f, 0x0001f50f, 0x0001f80f, 0x0001fa0f, 0x0001fc0f,
+	0x0000330f, 0x0002000f, 0x0002030f, 0x0002050f, 0x0000340f, 0x0002090f, 0x00020b0f, 0x00020e0f,
+	0x0002100f, 0x0000350f, 0x0002140f, 0x0002160f, 0x0002190f, 0x00021b0f, 0x0000360f, 0x00021f0f,
+	0x0002210f, 0x0002240f, 0x0000370f, 0x0002280f, 0x00022a0f, 0x00022c0f, 0x00022f0f, 0x0000380f,
+	0x0002330f, 0x0002370f, 0x0000390f, 0x0002400f, 0x00003a0f, 0x0002490f, 0x00003b0f, 0x0002520f,
+	0x0000060f, 0x00025b0f, 0x00025f0f, 0x00003d0f, 0x0002680f, 0x00003e0f, 0x0002710f, 0x00003f0f,
+	0x0002790f, 0x00027e0f, 0x0000400f, 0x0002870f, 0x0000410f, 0x00028f0f, 0x0000420f, 0x0002980f,
+	0x0000430f, 0x0002a10f, 0x0002a50f, 0x0000440f, 0x0002ae0f, 0x0000450f, 0x0002b70f, 0x0000070f,
+	0x0002c00f, 0x0000470f, 0x0002c80f, 0x0002cd0f, 0x0000480f, 0x0002d60f, 0x0000490f, 0x0002de0f,
+	0x00004a0f, 0x0002e70f, 0x0002ec0f, 0x00004b0f, 0x0002f40f, 0x00004c0f, 0x0002fd0f, 0x00004d0f,
+	0x0003060f, 0x00004e0f, 0x00030f0f, 0x0003130f, 0x00004f0f, 0x00031c0f, 0x0000080f, 0x0003250f,
+	0x0000510f, 0x00032e0f, 0x0000520f, 0x0003360f, 0x00033b0f, 0x0000530f, 0x0003440f, 0x0000540f,
+	0x00034c0f, 0x0000550f, 0x0003550f, 0x00035a0f, 0x0000560f, 0x0003620f, 0x0000570f, 0x00036b0f,
+	0x0000580f, 0x0003740f, 0x0000590f, 0x00037d0f, 0x0003810f, 0x0000090f, 0x00038a0f, 0x00005b0f,
+	0x0003930f, 0x00005c0f, 0x00039c0f, 0x00005d0f, 0x0003a40f, 0x0003a90f, 0x00005e0f, 0x0003b20f,
+	0x00005f0f, 0x0003ba0f, 0x0000600f, 0x0003c30f, 0x0003c80f, 0x0000610f, 0x0003d00f, 0x0000620f,
+	0x0003d90f, 0x0000630f, 0x0003e20f, 0x00000110, 0x0003eb10, 0x0003ef10, 0x00006510, 0x0003f810,
+	0x00006610, 0x00040110, 0x00006710, 0x00040a10, 0x00006810, 0x00041210, 0x00041710, 0x00006910,
+	0x00042010, 0x00006a10, 0x00042810, 0x00006b10, 0x00043110, 0x00043610, 0x00006c10, 0x00043e10,
+	0x00006d10, 0x00044710, 0x00000b10, 0x00045010, 0x00006f10, 0x00045910, 0x00045d10, 0x00007010,
+	0x00007110, 0x00046f10, 0x00007210, 0x00007310, 0x00007410, 0x00007510, 0x00007610, 0x00007710,
+	0x00000c10, 0x0004b510, 0x00007910, 0x00007a10, 0x00007b10, 0x00007c10, 0x00007d10, 0x00007e10,
+	0x00007f10, 0x0004fb10, 0x00008010, 0x00008110, 0x00000d10, 0x00008310, 0x00008410, 0x00008510,
+	0x00008610, 0x00008710, 0x00054b10, 0x00008810, 0x00008910, 0x00008a10, 0x00008b10, 0x00000e10,
+	0x00008d10, 0x00008e10, 0x00059110, 0x00008f10, 0x00009010, 0x00009110, 0x00009210, 0x00009310,
+	0x00009410, 0x00009510, 0x0005d710, 0x00000f10, 0x00009710, 0x00009810, 0x00009910, 0x00009a10,
+	0x00009b10, 0x00009c10, 0x00009d10, 0x00062710, 0x00009e10, 0x00009f10, 0x00001010, 0x0000a110,
+	0x0000a210, 0x0000a310, 0x0000a410, 0x00066d10, 0x0000a510, 0x0000a610, 0x0000a710, 0x0000a810,
+	0x0000a910, 0x00001110, 0x0000ab10, 0x0006b310, 0x0000ac10, 0x0000ad10, 0x0000ae10, 0x0000af10,
+	0x0000b010, 0x0000b110, 0x0000b210, 0x0000b310, 0x00070210, 0x00001210, 0x0000b510, 0x0000b610,
+	0x0000b710, 0x0000b810, 0x0000b910, 0x0000ba10, 0x00074910, 0x0000bb10, 0x0000bc10, 0x0000bd10,
+	0x00001310, 0x0000bf10, 0x0000c010, 0x0000c110, 0x00078f10, 0x0000c210, 0x0000c310, 0x0000c410,
+	0x0000c510, 0x0000c610, 0x0000c710, 0x00000210, 0x0007d610, 0x0000c910, 0x0000ca10, 0x0000cb10,
+	0x0000cc10, 0x0000cd10, 0x0000ce10, 0x0000cf10, 0x0000d010, 0x00082510, 0x0000d110, 0x00001510,
+	0x0000d310, 0x0000d410, 0x0000d510, 0x0000d610, 0x0000d710, 0x00086b10, 0x0000d810, 0x0000d910,
+	0x0000da10, 0x0000db10, 0x00001610, 0x0000dd10, 0x0000de10, 0x0008b110, 0x0000df10, 0x0000e010,
+	0x0000e110, 0x0000e310, 0x0000e510, 0x00001710, 0x0000e810, 0x0000ea10, 0x0000ec10, 0x0000ed10,
+	0x00001810, 0x0000f110, 0x0000f310, 0x0000f510, 0x0000f610, 0x0000f810, 0x00001910, 0x0000fc10,
+	0x0000fd10, 0x0000ff10, 0x00010110, 0x00010310, 0x00001a10, 0x00010610, 0x00010810, 0x00010a10,
+	0x00010b10, 0x00001b10, 0x00010f10, 0x00011110, 0x00011210, 0x00011410, 0x00011610, 0x00001c10,
+	0x00011910, 0x00011b10, 0x00011d10, 0x00011f10, 0x00012110, 0x00001d10, 0x00012410, 0x00012610,
+	0x00012810, 0x00012910, 0x00012b10, 0x00000310, 0x00012f10, 0x00013010, 0x00013210, 0x00013410,
+	0x00001f10, 0x00013710, 0x00013910, 0x00013b10, 0x00013d10, 0x00013e10, 0x00002010, 0x00014210,
+	0x00014410, 0x00014510, 0x00014710, 0x00014910, 0x00002110, 0x00014c10, 0x00014e10, 0x00015010,
+	0x00015210, 0x00002210, 0x00015510, 0x00015710, 0x00015910, 0x00015b10, 0x00015c10, 0x00002310,
+	0x00016010, 0x00016210, 0x00016310, 0x00016510, 0x00016710, 0x00002410, 0x00016a10, 0x00016c10,
+	0x00016e10, 0x00017010, 0x00002510, 0x00017310, 0x00017510, 0x00017710, 0x00017810, 0x00017a10,
+	0x00002610, 0x00017e10, 0x00018010, 0x00018110, 0x00018310, 0x00018510, 0x00002710, 0x00018810,
+	0x00018a10, 0x00018c10, 0x00018e10, 0x00000410, 0x00019110, 0x00019310, 0x00019510, 0x00019610,
+	0x00019810, 0x00002910, 0x00019c10, 0x00019d10, 0x00019f10, 0x0001a110, 0x0001a310, 0x00002a10,
+	0x0001a610, 0x0001a810, 0x0001aa10, 0x0001ab10, 0x00002b10, 0x0001af10, 0x0001b110, 0x0001b310,
+	0x0001b410, 0x0001b610, 0x00002c10, 0x0001ba10, 0x0001bb10, 0x0001bd10, 0x0001bf10, 0x0001c110,
+	0x00002d10, 0x0001c610, 0x0001c910, 0x00002e10, 0x0001d010, 0x0001d410, 0x00002f10, 0x0001db10,
+	0x00003010, 0x0001e210, 0x0001e610, 0x00003110, 0x0001ed10, 0x0001f010, 0x00000510, 0x0001f710,
+	0x0001fb10, 0x00003310, 0x00020210, 0x00020510, 0x00003410, 0x00020c10, 0x00021010, 0x00003510,
+	0x00021710, 0x00003610, 0x00021e10, 0x00022110, 0x00003710, 0x00022810, 0x00022c10, 0x00003810,
+	0x00023310, 0x00023610, 0x00003910, 0x00023e10, 0x00024110, 0x00003a10, 0x00024810, 0x00024c10,
+	0x00003b10, 0x00025310, 0x00025610, 0x00000610, 0x00025d10, 0x00003d10, 0x00026410, 0x00026810,
+	0x00003e10, 0x00026f10, 0x00027210, 0x00003f10, 0x00027910, 0x00027d10, 0x00004010, 0x00028410,
+	0x00028710, 0x00004110, 0x00028e10, 0x00029210, 0x00004210, 0x00029910, 0x00004310, 0x0002a010,
+	0x0002a410, 0x00004410, 0x0002ab10, 0x0002ae10, 0x00004510, 0x0002b510, 0x0002b910, 0x00000710,
+	0x0002c010, 0x0002c310, 0x00004710, 0x0002ca10, 0x0002ce10, 0x00004810, 0x0002d510, 0x00004910,
+	0x0002dc10, 0x0002df10, 0x00004a10, 0x0002e610, 0x0002ea10, 0x00004b10, 0x0002f110, 0x0002f410,
+	0x00004c10, 0x0002fc10, 0x0002ff10, 0x00004d10, 0x00030610, 0x00030a10, 0x00004e10, 0x00031110,
+	0x00031410, 0x00004f10, 0x00031b10, 0x00000810, 0x00032210, 0x00032610, 0x00005110, 0x00032d10,
+	0x00033010, 0x00005210, 0x00033710, 0x00033b10, 0x00005310, 0x00034210, 0x00034510, 0x00005410,
+	0x00034c10, 0x00035010, 0x00005510, 0x00035710, 0x00005610, 0x00035e10, 0x00036210, 0x00005710,
+	0x00036910, 0x00036c10, 0x00005810, 0x00037310, 0x00037710, 0x00005910, 0x00037e10, 0x00038110,
+	0x00000910, 0x00005b10, 0x00039310, 0x00005c10, 0x00005d10, 0x0003a810, 0x00005e10, 0x00005f10,
+	0x00006010, 0x0003c410, 0x00006110, 0x00006210, 0x0003d910, 0x00006310, 0x00000111, 0x0003ee11,
+	0x00006511, 0x00006611, 0x00006711, 0x00040a11, 0x00006811, 0x00006911, 0x00042011, 0x00006a11,
+	0x00006b11, 0x00006c11, 0x00043c11, 0x00006d11, 0x00000b11, 0x00045111, 0x00006f11, 0x00007011,
+	0x00046611, 0x00007111, 0x00007211, 0x00007311, 0x00048211, 0x00007411, 0x00007511, 0x00049711,
+	0x00007611, 0x00007711, 0x0004ac11, 0x00000c11, 0x00007911, 0x00007a11, 0x0004c811, 0x00007b11,
+	0x00007c11, 0x0004de11, 0x00007d11, 0x00007e11, 0x00007f11, 0x0004fa11, 0x00008011, 0x00008111,
+	0x00050f11, 0x00000d11, 0x00008311, 0x00052411, 0x00008411, 0x00008511, 0x00008611, 0x00054011,
+	0x00008711, 0x00008811, 0x00055511, 0x00008911, 0x00008a11, 0x00056a11, 0x00008b11, 0x00000e11,
+	0x00008d11, 0x00058611, 0x00008e11, 0x00008f11, 0x00059c11, 0x00009011, 0x00009111, 0x00009211,
+	0x0005b811, 0x00009311, 0x00009411, 0x0005cd11, 0x00009511, 0x00000f11, 0x0005e211, 0x00009711,
+	0x00009811, 0x00009911, 0x0005fe11, 0x00009a11, 0x00009b11, 0x00061311, 0x00009c11, 0x00009d11,
+	0x00062811, 0x00009e11, 0x00009f11, 0x00001011, 0x00064411, 0x0000a111, 0x0000a211, 0x00065a11,
+	0x0000a311, 0x0000a411, 0x0000a511, 0x00067611, 0x0000a611, 0x0000a711, 0x00068b11, 0x0000a811,
+	0x0000a911, 0x0006a011, 0x00001111, 0x0000ab11, 0x0000ac11, 0x0006bc11, 0x0000ad11, 0x0000ae11,
+	0x0006d111, 0x0000af11, 0x0000b011, 0x0006e611, 0x0000b111, 0x0000b211, 0x0000b311, 0x00070211,
+	0x00001211, 0x0000b611, 0x0000b711, 0x0000b811, 0x0000ba11, 0x0000bb11, 0x0000bd11, 0x00001311,
+	0x0000bf11, 0x0000c111, 0x0000c211, 0x0000c411, 0x0000c511, 0x0000c611, 0x00000211, 0x0000c911,
+	0x0000cb11, 0x0000cc11, 0x0000cd11, 0x0000cf11, 0x0000d011, 0x00001511, 0x0000d311, 0x0000d511,
+	0x0000d611, 0x0000d711, 0x0000d911, 0x0000da11, 0x00001611, 0x0000dd11, 0x0000de11, 0x0000e011,
+	0x0000e111, 0x0000e311, 0x0000e411, 0x00001711, 0x0000e711, 0x0000e811, 0x0000ea11, 0x0000eb11,
+	0x0000ec11, 0x0000ee11, 0x0000ef11, 0x00001811, 0x0000f211, 0x0000f311, 0x0000f511, 0x0000f611,
+	0x0000f811, 0x0000f911, 0x00001911, 0x0000fc11, 0x0000fd11, 0x0000ff11, 0x00010011, 0x00010211,
+	0x00010311, 0x00001a11, 0x00010611, 0x00010711, 0x00010911, 0x00010a11, 0x00010b11, 0x00010d11,
+	0x00001b11, 0x00011011, 0x00011111, 0x00011211, 0x00011411, 0x00011511, 0x00011711, 0x00001c11,
+	0x00011911, 0x00011b11, 0x00011c11, 0x00011e11, 0x00011f11, 0x00012111, 0x00001d11, 0x00012311,
+	0x00012511, 0x00012611, 0x00012811, 0x00012911, 0x00012a11, 0x00000311, 0x00012d11, 0x00012f11,
+	0x00013011, 0x00013111, 0x00013311, 0x00013411, 0x00001f11, 0x00013711, 0x00013811, 0x00013a11,
+	0x00013b11, 0x00013d11, 0x00013e11, 0x00002011, 0x00014111, 0x00014211, 0x00014411, 0x00014511,
+	0x00014711, 0x00014811, 0x00002111, 0x00014b11, 0x00014c11, 0x00014e11, 0x00014f11, 0x00015011,
+	0x00015211, 0x00015311, 0x00002211, 0x00015611, 0x00015711, 0x00015911, 0x00015a11, 0x00015c11,
+	0x00015d11, 0x00002311, 0x00016011, 0x00016111, 0x00016311, 0x00016411, 0x00016511, 0x00016711,
+	0x00002411, 0x00016b11, 0x00016e11, 0x00002511, 0x00017411, 0x00017611, 0x00017911, 0x00002611,
+	0x00017f11, 0x00018211, 0x00018411, 0x00002711, 0x00018a11, 0x00018d11, 0x00000411, 0x00019311,
+	0x00019511, 0x00019811, 0x00002911, 0x00019e11, 0x0001a111, 0x00002a11, 0x0001a611, 0x0001a911,
+	0x0001ac11, 0x00002b11, 0x0001b111, 0x0001b411, 0x00002c11, 0x0001ba11, 0x0001bd11, 0x0001c011,
+	0x00002d11, 0x0001c511, 0x0001c811, 0x00002e11, 0x0001ce11, 0x0001d011, 0x0001d311, 0x00002f11,
+	0x0001d911, 0x0001dc11, 0x0001df11, 0x00003011, 0x0001e411, 0x0001e711, 0x00003111, 0x0001ed11,
+	0x0001ef11, 0x0001f211, 0x00000511, 0x0001f811, 0x0001fb11, 0x00003311, 0x00020011, 0x00020311,
+	0x00020611, 0x00003411, 0x00020c11, 0x00020e11, 0x00003511, 0x00021411, 0x00021711, 0x00021a11,
+	0x00003611, 0x00021f11, 0x00022211, 0x00003711, 0x00022811, 0x00022b11, 0x00022d11, 0x00003811,
+	0x00023311, 0x00023611, 0x00023911, 0x00003911, 0x00023e11, 0x00024111, 0x00003a11, 0x00024711,
+	0x00024911, 0x00024c11, 0x00003b11, 0x00025211, 0x00025511, 0x00000611, 0x00025a11, 0x00025d11,
+	0x00026011, 0x00003d11, 0x00026611, 0x00026811, 0x00003e11, 0x00026e11, 0x00027111, 0x00027411,
+	0x00003f11, 0x00027911, 0x00027c11, 0x00004011, 0x00028211, 0x00028511, 0x00028711, 0x00004111,
+	0x00028d11, 0x00029011, 0x00004211, 0x00029511, 0x00029811, 0x00029b11, 0x00004311, 0x0002a111,
+	0x0002a411, 0x0002a611, 0x00004411, 0x0002ac11, 0x0002af11, 0x00004511, 0x0002b411, 0x0002b711,
+	0x0002ba11, 0x00000711, 0x0002c011, 0x0002c311, 0x00004711, 0x0002c811, 0x0002cb11, 0x0002ce11,
+	0x00004811, 0x0002d611, 0x00004911, 0x00004a11, 0x0002e711, 0x00004b11, 0x0002f211, 0x00004c11,
+	0x0002fe11, 0x00004d11, 0x00030911, 0x00004e11, 0x00004f11, 0x00031a11, 0x00000811, 0x00032511,
+	0x00005111, 0x00033011, 0x00005211, 0x00005311, 0x00034111, 0x00005411, 0x00034c11, 0x00005511,
+	0x00035811, 0x00005611, 0x00036311, 0x00005711, 0x00005811, 0x00037411, 0x00005911, 0x00037f11,
+	0x00000911, 0x00038a11, 0x00005b11, 0x00005c11, 0x00039b11, 0x00005d11, 0x0003a611, 0x00005e11,
+	0x0003b211, 0x00005f11, 0x0003bd11, 0x00006011, 0x00006111, 0x0003ce11, 0x00006211, 0x0003d911,
+	0x00006311, 0x0003e411, 0x00000112, 0x00006512, 0x0003f512, 0x00006612, 0x00040112, 0x00006712,
+	0x00040c12, 0x00006812, 0x00041712, 0x00006912, 0x00006a12, 0x00042812, 0x00006b12, 0x00043312,
+	0x00006c12, 0x00043e12, 0x00006d12, 0x00000b12, 0x00044f12, 0x00006f12, 0x00045b12, 0x00007012,
+	0x00046612, 0x00007112, 0x00047112, 0x00007212, 0x00007312, 0x00048212, 0x00007412, 0x00048d12,
+	0x00007512, 0x00049912, 0x00007612, 0x00007712, 0x0004a912, 0x00000c12, 0x0004b512, 0x00007912,
+	0x0004c012, 0x00007a12, 0x00007b12, 0x0004d112, 0x00007c12, 0x0004dc12, 0x00007d12, 0x0004e712,
+	0x00007e12, 0x0004f312, 0x00007f12, 0x00008012, 0x00050412, 0x00008112, 0x00050f12, 0x00000d12,
+	0x00051a12, 0x00008312, 0x00008412, 0x00052b12, 0x00008512, 0x00053612, 0x00008612, 0x00054112,
+	0x00008712, 0x00054d12, 0x00008812, 0x00008912, 0x00055e12, 0x00008a12, 0x00056912, 0x00008b12,
+	0x00057412, 0x00000e12, 0x00008d12, 0x00058512, 0x00008e12, 0x00059012, 0x00008f12, 0x00059c12,
+	0x00009012, 0x00009112, 0x00009212, 0x00009312, 0x00009512, 0x00000f12, 0x00009712, 0x00009812,
+	0x00009912, 0x00009a12, 0x00009b12, 0x00009d12, 0x00009e12, 0x00009f12, 0x00001012, 0x0000a112,
+	0x0000a212, 0x0000a312, 0x0000a412, 0x0000a612, 0x0000a712, 0x0000a812, 0x0000a912, 0x00001112,
+	0x0000ab12, 0x0000ac12, 0x0000ad12, 0x0000af12, 0x0000b012, 0x0000b112, 0x0000b212, 0x0000b312,
+	0x00001212, 0x0000b512, 0x0000b612, 0x0000b812, 0x0000b912, 0x0000ba12, 0x0000bb12, 0x0000bc12,
+	0x0000bd12, 0x00001312, 0x0000bf12, 0x0000c112, 0x0000c212, 0x0000c312, 0x0000c412, 0x0000c512,
+	0x0000c612, 0x0000c712, 0x00000212, 0x0000ca12, 0x0000cb12, 0x0000cc12, 0x0000cd12, 0x0000ce12,
+	0x0000cf12, 0x0000d012, 0x0000d112, 0x00001512, 0x0000d412, 0x0000d512, 0x0000d612, 0x0000d712,
+	0x0000d812, 0x0000d912, 0x0000da12, 0x00001612, 0x0000dd12, 0x0000de12, 0x0000df12, 0x0000e012,
+	0x0000e112, 0x0000e212, 0x0000e312, 0x0000e512, 0x00001712, 0x0000e712, 0x0000e812, 0x0000e912,
+	0x0000ea12, 0x0000eb12, 0x0000ec12, 0x0000ee12, 0x0000ef12, 0x00001812, 0x0000f112, 0x0000f212,
+	0x0000f312, 0x0000f412, 0x0000f512, 0x0000f712, 0x0000f812, 0x0000f912, 0x00001912, 0x0000fb12,
+	0x0000fc12, 0x0000fd12, 0x0000fe12, 0x00010012, 0x00010112, 0x00010212, 0x00010312, 0x00001a12,
+	0x00010512, 0x00010612, 0x00010712, 0x00010912, 0x00010a12, 0x00010b12, 0x00010c12, 0x00010d12,
+	0x00001b12, 0x00010f12, 0x00011012, 0x00011212, 0x00011312, 0x00011412, 0x00011512, 0x00011612,
+	0x00011712, 0x00001c12, 0x00011912, 0x00011b12, 0x00011c12, 0x00011d12, 0x00011e12, 0x00011f12,
+	0x00012012, 0x00001d12, 0x00012512, 0x00012712, 0x00012912, 0x00000312, 0x00012e12, 0x00013012,
+	0x00013212, 0x00013412, 0x00001f12, 0x00013912, 0x00013b12, 0x00013e12, 0x00002012, 0x00014212,
+	0x00014412, 0x00014712, 0x00014912, 0x00002112, 0x00014d12, 0x00015012, 0x00015212, 0x00002212,
+	0x00015612, 0x00015912, 0x00015b12, 0x00002312, 0x00015f12, 0x00016212, 0x00016412, 0x00016612,
+	0x00002412, 0x00016b12, 0x00016d12, 0x00016f12, 0x00002512, 0x00017412, 0x00017612, 0x00017812,
+	0x00017a12, 0x00002612, 0x00017f12, 0x00018112, 0x00018312, 0x00002712, 0x00018812, 0x00018a12,
+	0x00018c12, 0x00018f12, 0x00000412, 0x00019312, 0x00019512, 0x00019812, 0x00002912, 0x00019c12,
+	0x00019e12, 0x0001a112, 0x0001a312, 0x00002a12, 0x0001a712, 0x0001aa12, 0x0001ac12, 0x00002b12,
+	0x0001b012, 0x0001b312, 0x0001b512, 0x00002c12, 0x0001b912, 0x0001bc12, 0x0001be12, 0x0001c012,
+	0x00002d12, 0x0001c512, 0x0001c712, 0x0001c912, 0x00002e12, 0x0001ce12, 0x0001d012, 0x0001d212,
+	0x0001d412, 0x00002f12, 0x0001d912, 0x0001db12, 0x0001dd12, 0x00003012, 0x0001e212, 0x0001e412,
+	0x0001e612, 0x0001e912, 0x00003112, 0x0001ed12, 0x0001ef12, 0x0001f212, 0x00000512, 0x0001f612,
+	0x0001f812, 0x0001fb12, 0x00003312, 0x0001ff12, 0x00020112, 0x00020412, 0x00020612, 0x00003412,
+	0x00020a12, 0x00020d12, 0x00020f12, 0x00003512, 0x00021312, 0x00021612, 0x00021812, 0x00021a12,
+	0x00003612, 0x00021f12, 0x00022112, 0x00022312, 0x00003712, 0x00022812, 0x00022a12, 0x00022c12,
+	0x00022e12, 0x00003812, 0x00023312, 0x00023512, 0x00023712, 0x00003912, 0x00023c12, 0x00023e12,
+	0x00024012, 0x00003a12, 0x00024912, 0x00003b12, 0x00025212, 0x00000612, 0x00025b12, 0x00003d12,
+	0x00026412, 0x00026912, 0x00003e12, 0x00027212, 0x00003f12, 0x00027b12, 0x00004012, 0x00028412,
+	0x00004112, 0x00028d12, 0x00029212, 0x00004212, 0x00029b12, 0x00004312, 0x0002a412, 0x00004412,
+	0x0002ad12, 0x00004512, 0x0002b612, 0x00000712, 0x0002bf12, 0x0002c312, 0x00004712, 0x0002cc12,
+	0x00004812, 0x0002d512, 0x00004912, 0x0002de12, 0x00004a12, 0x0002e712, 0x0002ec12, 0x00004b12,
+	0x0002f512, 0x00004c12, 0x0002fe12, 0x00004d12, 0x00030712, 0x00004e12, 0x00031012, 0x00004f12,
+	0x00031912, 0x00031d12, 0x00000812, 0x00032612, 0x00005112, 0x00032f12, 0x00005212, 0x00033812,
+	0x00005312, 0x00034112, 0x00034612, 0x00005412, 0x00034f12, 0x00005512, 0x00035812, 0x00005612,
+	0x00036112, 0x00005712, 0x00036a12, 0x00005812, 0x00037312, 0x00037712, 0x00005912, 0x00038012,
+	0x00000912, 0x00038912, 0x00005b12, 0x00039212, 0x00005c12, 0x00039b12, 0x0003a012, 0x00005d12,
+	0x0003a912, 0x00005e12, 0x0003b212, 0x00005f12, 0x0003bb12, 0x00006012, 0x0003c412, 0x00006112,
+	0x0003cd12, 0x0003d112, 0x00006212, 0x0003da12, 0x00006312, 0x0003e312, 0x00000113, 0x0003ec13,
+	0x00006513, 0x0003f513, 0x00006613, 0x0003fe13, 0x00040313, 0x00006713, 0x00040c13, 0x00006813,
+	0x00041513, 0x00006913, 0x00041e13, 0x00006a13, 0x00042713, 0x00042b13, 0x00006b13, 0x00043413,
+	0x00006c13, 0x00043d13, 0x00006d13, 0x00044613, 0x00000b13, 0x00044f13, 0x00006f13, 0x00045813,
+	0x00045d13, 0x00007013, 0x00046613, 0x00007113, 0x00046f13, 0x00007213, 0x00047813, 0x00007313,
+	0x00048113, 0x00007413, 0x00007513, 0x00007613, 0x00007713, 0x00000c13, 0x00007913, 0x00007a13,
+	0x0004c913, 0x00007b13, 0x00007c13, 0x00007d13, 0x00007e13, 0x00007f13, 0x00008013, 0x00008113,
+	0x00000d13, 0x00008313, 0x00052313, 0x00008413, 0x00008513, 0x00008613, 0x00008713, 0x00008813,
+	0x00008913, 0x00008a13, 0x00008b13, 0x00000e13, 0x00057d13, 0x00008d13, 0x00008e13, 0x00008f13,
+	0x00009013, 0x00009113, 0x00009213, 0x00009313, 0x00009413, 0x00009513, 0x0005d713, 0x00000f13,
+	0x00009713, 0x00009813, 0x00009913, 0x00009a13, 0x00009b13, 0x00009c13, 0x00009d13, 0x00009e13,
+	0x00063113, 0x00009f13, 0x00001013, 0x0000a113, 0x0000a213, 0x0000a313, 0x0000a413, 0x0000a513,
+	0x0000a613, 0x0000a713, 0x00068b13, 0x0000a813, 0x0000a913, 0x00001113, 0x0000ab13, 0x0000ac13,
+	0x0000ad13, 0x0000ae13, 0x0000af13, 0x0000b013, 0x0006e513, 0x0000b113, 0x0000b213, 0x0000b313,
+	0x00001213, 0x0000b513, 0x0000b613, 0x0000b713, 0x0000b813, 0x0000b913, 0x00073f13, 0x0000ba13,
+	0x0000bb13, 0x0000bc13, 0x0000bd13, 0x00001313, 0x0000bf13, 0x0000c013, 0x0000c113, 0x0000c213,
+	0x0000c313, 0x0007a313, 0x0000c413, 0x0000c513, 0x0000c613, 0x0000c713, 0x00000213, 0x0000c913,
+	0x0000ca13, 0x0000cb13, 0x0000cc13, 0x0007fd13, 0x0000cd13, 0x0000ce13, 0x0000cf13, 0x0000d013,
+	0x0000d113, 0x00001513, 0x0000d313, 0x0000d413, 0x0000d513, 0x00085713, 0x0000d613, 0x0000d713,
+	0x0000d813, 0x0000d913, 0x0000da13, 0x0000db13, 0x00001613, 0x0000dd13, 0x0000de13, 0x0008b113,
+	0x0000df13, 0x0000e013, 0x0000e113, 0x0000e213, 0x0000e313, 0x0000e413, 0x0000e513, 0x00001713,
+	0x0000e713, 0x0000e813, 0x0000ea13, 0x0000ec13, 0x0000ee13, 0x00001813, 0x0000f113, 0x0000f313,
+	0x0000f513, 0x0000f713, 0x0000f913, 0x00001913, 0x0000fc13, 0x0000fe13, 0x00010013, 0x00010213,
+	0x00001a13, 0x00010513, 0x00010713, 0x00010913, 0x00010b13, 0x00010c13, 0x00001b13, 0x00011013,
+	0x00011213, 0x00011413, 0x00011513, 0x00001c13, 0x00011913, 0x00011b13, 0x00011d13, 0x00011e13,
+	0x00012013, 0x00001d13, 0x00012413, 0x00012613, 0x00012713, 0x00012913, 0x00012b13, 0x00000313,
+	0x00012f13, 0x00013013, 0x00013213, 0x00013413, 0x00001f13, 0x00013813, 0x00013913, 0x00013b13,
+	0x00013d13, 0x00013f13, 0x00002013, 0x00014213, 0x00014413, 0x00014613, 0x00014813, 0x00002113,
+	0x00014b13, 0x00014d13, 0x00014f13, 0x00015113, 0x00015313, 0x00002213, 0x00015613, 0x00015813,
+	0x00015a13, 0x00015c13, 0x00002313, 0x00015f13, 0x00016113, 0x00016313, 0x00016513, 0x00016613,
+	0x00002413, 0x00016a13, 0x00016c13, 0x00016e13, 0x00016f13, 0x00002513, 0x00017313, 0x00017513,
+	0x00017713, 0x00017913, 0x00017a13, 0x00002613, 0x00017e13, 0x00018013, 0x00018213, 0x00018313,
+	0x00002713, 0x00018713, 0x00018913, 0x00018b13, 0x00018c13, 0x00018e13, 0x00000413, 0x00019213,
+	0x00019413, 0x00019513, 0x00019713, 0x00019913, 0x00002913, 0x00019d13, 0x00019e13, 0x0001a013,
+	0x0001a213, 0x00002a13, 0x0001a613, 0x0001a713, 0x0001a913, 0x0001ab13, 0x0001ad13, 0x00002b13,
+	0x0001b013, 0x0001b213, 0x0001b413, 0x0001b613, 0x00002c13, 0x0001b913, 0x0001bb13, 0x0001bd13,
+	0x0001bf13, 0x0001c113, 0x00002d13, 0x0001c413, 0x0001c613, 0x0001c813, 0x0001ca13, 0x00002e13,
+	0x0001cd13, 0x0001d113, 0x00002f13, 0x0001d813, 0x0001dc13, 0x00003013, 0x0001e313, 0x0001e613,
+	0x00003113, 0x0001ee13, 0x0001f113, 0x00000513, 0x0001f813, 0x0001fc13, 0x00003313, 0x00020313,
+	0x00003413, 0x00020a13, 0x00020e13, 0x00003513, 0x00021513, 0x00021913, 0x00003613, 0x00022013,
+	0x00022413, 0x00003713, 0x00022b13, 0x00003813, 0x00023213, 0x00023613, 0x00003913, 0x00023d13,
+	0x00024013, 0x00003a13, 0x00024813, 0x00024b13, 0x00003b13, 0x00025213, 0x00025613, 0x00000613,
+	0x00025d13, 0x00003d13, 0x00026413, 0x00026813, 0x00003e13, 0x00026f13, 0x00027313, 0x00003f13,
+	0x00027a13, 0x00027e13, 0x00004013, 0x00028513, 0x00004113, 0x00028c13, 0x00029013, 0x00004213,
+	0x00029713, 0x00029b13, 0x00004313, 0x0002a213, 0x0002a513, 0x00004413, 0x0002ad13, 0x0002b013,
+	0x00004513, 0x0002b713, 0x00000713, 0x0002bf13, 0x0002c213, 0x00004713, 0x0002c913, 0x0002cd13,
+	0x00004813, 0x0002d413, 0x0002d813, 0x00004913, 0x0002df13, 0x00004a13, 0x0002e613, 0x0002ea13,
+	0x00004b13, 0x0002f113, 0x0002f513, 0x00004c13, 0x0002fc13, 0x0002ff13, 0x00004d13, 0x00030713,
+	0x00004e13, 0x00030e13, 0x00031113, 0x00004f13, 0x00031913, 0x00031c13, 0x00000813, 0x00032313,
+	0x00032713, 0x00005113, 0x00032e13, 0x00033213, 0x00005213, 0x00033913, 0x00005313, 0x00034013,
+	0x00034413, 0x00005413, 0x00034b13, 0x00034f13, 0x00005513, 0x00035613, 0x00035913, 0x00005613,
+	0x00036113, 0x00005713, 0x00036813, 0x00036b13, 0x00005813, 0x00037313, 0x00037613, 0x00005913,
+	0x00037e13, 0x00038113, 0x00000913, 0x00038813, 0x00038c13, 0x00005b13, 0x00039313, 0x00005c13,
+	0x00039a13, 0x00005d13, 0x00005e13, 0x0003b013, 0x00005f13, 0x00006013, 0x0003c613, 0x00006113,
+	0x00006213, 0x00006313, 0x0003e213, 0x00000114, 0x00006514, 0x0003f814, 0x00006614, 0x00006714,
+	0x00006814, 0x00041514, 0x00006914, 0x00006a14, 0x00006b14, 0x00043214, 0x00006c14, 0x00006d14,
+	0x00044714, 0x00000b14, 0x00006f14, 0x00007014, 0x00046414, 0x00007114, 0x00007214, 0x00047a14,
+	0x00007314, 0x00007414, 0x00007514, 0x00049714, 0x00007614, 0x00007714, 0x0004ac14, 0x00000c14,
+	0x00007914, 0x00007a14, 0x0004c914, 0x00007b14, 0x00007c14, 0x00007d14, 0x0004e614, 0x00007e14,
+	0x00007f14, 0x0004fb14, 0x00008014, 0x00008114, 0x00000d14, 0x00051814, 0x00008314, 0x00008414,
+	0x00052e14, 0x00008514, 0x00008614, 0x00008714, 0x00054b14, 0x00008814, 0x00008914, 0x00056014,
+	0x00008a14, 0x00008b14, 0x00000e14, 0x00057d14, 0x00008d14, 0x00008e14, 0x00008f14, 0x00059a14,
+	0x00009014, 0x00009114, 0x0005b014, 0x00009214, 0x00009314, 0x00009414, 0x0005cc14, 0x00009514,
+	0x00000f14, 0x0005e214, 0x00009714, 0x00009814, 0x00009914, 0x0005ff14, 0x00009a14, 0x00009b14,
+	0x00009c14, 0x00061c14, 0x00009d14, 0x00009e14, 0x00063114, 0x00009f14, 0x00001014, 0x0000a114,
+	0x00064e14, 0x0000a214, 0x0000a314, 0x00066414, 0x0000a414, 0x0000a514, 0x0000a614, 0x00068114,
+	0x0000a714, 0x0000a814, 0x00069614, 0x0000a914, 0x00001114, 0x0000ab14, 0x0006b314, 0x0000ac14,
+	0x0000ad14, 0x0000ae14, 0x0006d014, 0x0000af14, 0x0000b014, 0x0006e514, 0x0000b114, 0x0000b214,
+	0x0000b314, 0x00070214, 0x00001214, 0x0000b514, 0x00071814, 0x0000b614, 0x0000b714, 0x0000b814,
+	0x0000b914, 0x0000ba14, 0x0000bb14, 0x0000bd14, 0x00001314, 0x0000c014, 0x0000c114, 0x0000c314,
+	0x0000c414, 0x0000c514, 0x0000c714, 0x00000214, 0x0000ca14, 0x0000cb14, 0x0000cd14, 0x0000ce14,
+	0x0000d014, 0x0000d114, 0x00001514, 0x0000d414, 0x0000d514, 0x0000d714, 0x0000d814, 0x0000da14,
+	0x0000db14, 0x00001614, 0x0000de14, 0x0000df14, 0x0000e114, 0x0000e214, 0x0000e414, 0x0000e514,
+	0x00001714, 0x0000e814, 0x0000e914, 0x0000eb14, 0x0000ec14, 0x0000ee14, 0x0000ef14, 0x00001814,
+	0x0000f214, 0x0000f414, 0x0000f514, 0x0000f614, 0x0000f814, 0x00001914, 0x0000fb14, 0x0000fc14,
+	0x0000fe14, 0x0000ff14, 0x00010114, 0x00010214, 0x00001a14, 0x00010514, 0x00010614, 0x00010814,
+	0x00010914, 0x00010b14, 0x00010c14, 0x00001b14, 0x00010f14, 0x00011014, 0x00011214, 0x00011314,
+	0x00011514, 0x00011614, 0x00001c14, 0x00011914, 0x00011a14, 0x00011c14, 0x00011d14, 0x00011f14,
+	0x00012014, 0x00001d14, 0x00012314, 0x00012514, 0x00012614, 0x00012714, 0x00012914, 0x00012a14,
+	0x00000314, 0x00012d14, 0x00012f14, 0x00013014, 0x00013214, 0x00013314, 0x00013414, 0x00001f14,
+	0x00013714, 0x00013914, 0x00013a14, 0x00013c14, 0x00013d14, 0x00013e14, 0x00002014, 0x00014114,
+	0x00014314, 0x00014414, 0x00014614, 0x00014714, 0x00014914, 0x00002114, 0x00014b14, 0x00014d14,
+	0x00014e14, 0x00015014, 0x00015114, 0x00015314, 0x00002214, 0x00015614, 0x00015714, 0x00015814,
+	0x00015a14, 0x00015b14, 0x00015d14, 0x00002314, 0x00016014, 0x00016114, 0x00016314, 0x00016414,
+	0x00016514, 0x00016714, 0x00002414, 0x00016a14, 0x00016b14, 0x00016d14, 0x00016e14, 0x00016f14,
+	0x00002514, 0x00017414, 0x00017714, 0x00017a14, 0x00002614, 0x00017f14, 0x00018214, 0x00002714,
+	0x00018814, 0x00018b14, 0x00018e14, 0x00000414, 0x00019414, 0x00019614, 0x00002914, 0x00019c14,
+	0x00019f14, 0x0001a214, 0x00002a14, 0x0001a814, 0x0001ab14, 0x00002b14, 0x0001b014, 0x0001b314,
+	0x0001b614, 0x00002c14, 0x0001bc14, 0x0001bf14, 0x00002d14, 0x0001c514, 0x0001c714, 0x0001ca14,
+	0x00002e14, 0x0001d014, 0x0001d314, 0x00002f14, 0x0001d914, 0x0001dc14, 0x0001de14, 0x00003014,
+	0x0001e414, 0x0001e714, 0x00003114, 0x0001ed14, 0x0001f014, 0x00000514, 0x0001f614, 0x0001f814,
+	0x0001fb14, 0x00003314, 0x00020114, 0x00020414, 0x00003414, 0x00020a14, 0x00020d14, 0x00020f14,
+	0x00003514, 0x00021514, 0x00021814, 0x00003614, 0x00021e14, 0x00022114, 0x00022414, 0x00003714,
+	0x00022914, 0x00022c14, 0x00003814, 0x00023214, 0x00023514, 0x00023814, 0x00003914, 0x00023e14,
+	0x00024014, 0x00003a14, 0x00024614, 0x00024914, 0x00024c14, 0x00003b14, 0x00025214, 0x00025514,
+	0x00000614, 0x00025a14, 0x00025d14, 0x00026014, 0x00003d14, 0x00026614, 0x00026914, 0x00003e14,
+	0x00026f14, 0x00027114, 0x00027414, 0x00003f14, 0x00027a14, 0x00027d14, 0x00004014, 0x00028314,
+	0x00028614, 0x00028914, 0x00004114, 0x00028e14, 0x00029114, 0x00004214, 0x00029714, 0x00029a14,
+	0x00004314, 0x0002a014, 0x0002a214, 0x0002a514, 0x00004414, 0x0002ab14, 0x0002ae14, 0x00004514,
+	0x0002b414, 0x0002b714, 0x0002ba14, 0x00000714, 0x0002bf14, 0x0002c214, 0x00004714, 0x0002c814,
+	0x0002cb14, 0x0002ce14, 0x00004814, 0x0002d314, 0x0002d614, 0x00004914, 0x0002dc14, 0x0002df14,
+	0x00004a14, 0x0002e814, 0x00004b14, 0x0002f314, 0x00004c14, 0x0002ff14, 0x00004d14, 0x00004e14,
+	0x00031014, 0x00004f14, 0x00031c14, 0x00000814, 0x00032714, 0x00005114, 0x00005214, 0x00033814,
+	0x00005314, 0x00034414, 0x00005414, 0x00005514, 0x00035514, 0x00005614, 0x00036114, 0x00005714,
+	0x00036c14, 0x00005814, 0x00005914, 0x00037e14, 0x00000914, 0x00038914, 0x00005b14, 0x00039514,
+	0x00005c14, 0x00005d14, 0x0003a614, 0x00005e14, 0x0003b114, 0x00005f14, 0x0003bd14, 0x00006014,
+	0x00006114, 0x0003ce14, 0x00006214, 0x0003da14, 0x00006314, 0x00000115, 0x0003eb15, 0x00006515,
+	0x0003f715, 0x00006615, 0x00040215, 0x00006715, 0x00006815, 0x00041315, 0x00006915, 0x00041f15,
+	0x00006a15, 0x00042a15, 0x00006b15, 0x00006c15, 0x00043c15, 0x00006d15, 0x00044715, 0x00000b15,
+	0x00045315, 0x00006f15, 0x00007015, 0x00046415, 0x00007115, 0x00047015, 0x00007215, 0x00007315,
+	0x00048115, 0x00007415, 0x00048c15, 0x00007515, 0x00049815, 0x00007615, 0x00007715, 0x0004a915,
+	0x00000c15, 0x0004b515, 0x00007915, 0x0004c015, 0x00007a15, 0x00007b15, 0x0004d215, 0x00007c15,
+	0x0004dd15, 0x00007d15, 0x0004e915, 0x00007e15, 0x00007f15, 0x0004fa15, 0x00008015, 0x00050615,
+	0x00008115, 0x00051115, 0x00000d15, 0x00008315, 0x00052215, 0x00008415, 0x00052e15, 0x00008515,
+	0x00008615, 0x00053f15, 0x00008715, 0x00054b15, 0x00008815, 0x00055615, 0x00008915, 0x00008a15,
+	0x00056815, 0x00008b15, 0x00057315, 0x00000e15, 0x00057f15, 0x00008d15, 0x00008e15, 0x00059015,
+	0x00008f15, 0x00059b15, 0x00009015, 0x0005a715, 0x00009115, 0x00009215, 0x0005b815, 0x00009315,
+	0x00009415, 0x00009515, 0x00000f15, 0x00009715, 0x00009815, 0x00009915, 0x00009a15, 0x00009c15,
+	0x00009d15, 0x00009e15, 0x00009f15, 0x00001015, 0x0000a115, 0x0000a315, 0x0000a415, 0x0000a515,
+	0x0000a615, 0x0000a715, 0x0000a815, 0x00001115, 0x0000ab15, 0x0000ac15, 0x0000ad15, 0x0000ae15,
+	0x0000af15, 0x0000b015, 0x0000b215, 0x0000b315, 0x00001215, 0x0000b515, 0x0000b615, 0x0000b715,
+	0x0000b815, 0x0000ba15, 0x0000bb15, 0x0000bc15, 0x0000bd15, 0x00001315, 0x0000bf15, 0x0000c115,
+	0x0000c215, 0x0000c315, 0x0000c415, 0x0000c515, 0x0000c615, 0x00000215, 0x0000c915, 0x0000ca15,
+	0x0000cb15, 0x0000cc15, 0x0000cd15, 0x0000ce15, 0x0000d015, 0x0000d115, 0x00001515, 0x0000d315,
+	0x0000d415, 0x0000d515, 0x0000d615, 0x0000d815, 0x0000d915, 0x0000da15, 0x0000db15, 0x00001615,
+	0x0000dd15, 0x0000df15, 0x0000e015, 0x0000e115, 0x0000e215, 0x0000e315, 0x0000e415, 0x00001715,
+	0x0000e715, 0x0000e815, 0x0000e915, 0x0000ea15, 0x0000eb15, 0x0000ec15, 0x0000ee15, 0x0000ef15,
+	0x00001815, 0x0000f115, 0x0000f215, 0x0000f315, 0x0000f415, 0x0000f615, 0x0000f715, 0x0000f815,
+	0x0000f915, 0x00001915, 0x0000fb15, 0x0000fc15, 0x0000fe15, 0x0000ff15, 0x00010015, 0x00010115,
+	0x00010215, 0x00010315, 0x00001a15, 0x00010615, 0x00010715, 0x00010815, 0x00010915, 0x00010a15,
+	0x00010b15, 0x00010d15, 0x00001b15, 0x00010f15, 0x00011015, 0x00011115, 0x00011215, 0x00011415,
+	0x00011515, 0x00011615, 0x00011715, 0x00001c15, 0x00011915, 0x00011a15, 0x00011c15, 0x00011d15,
+	0x00011e15, 0x00011f15, 0x00012015, 0x00012115, 0x00001d15, 0x00012415, 0x00012515, 0x00012615,
+	0x00012715, 0x00012915, 0x00000315, 0x00012e15, 0x00013015, 0x00013315, 0x00001f15, 0x00013715,
+	0x00013a15, 0x00013c15, 0x00013e15, 0x00002015, 0x00014315, 0x00014515, 0x00014715, 0x00002115,
+	0x00014c15, 0x00014e15, 0x00015115, 0x00002215, 0x00015515, 0x00015815, 0x00015a15, 0x00015c15,
+	0x00002315, 0x00016115, 0x00016315, 0x00016515, 0x00002415, 0x00016a15, 0x00016c15, 0x00016f15,
+	0x00002515, 0x00017315, 0x00017615, 0x00017815, 0x00017a15, 0x00002615, 0x00017f15, 0x00018115,
+	0x00018315, 0x00002715, 0x00018815, 0x00018a15, 0x00018d15, 0x00000415, 0x00019115, 0x00019415,
+	0x00019615, 0x00019815, 0x00002915, 0x00019d15, 0x00019f15, 0x0001a115, 0x00002a15, 0x0001a615,
+	0x0001a815, 0x0001ab15, 0x00002b15, 0x0001af15, 0x0001b115, 0x0001b415, 0x0001b615, 0x00002c15,
+	0x0001bb15, 0x0001bd15, 0x0001bf15, 0x00002d15, 0x0001c415, 0x0001c615, 0x0001c915, 0x00002e15,
+	0x0001cd15, 0x0001cf15, 0x0001d215, 0x0001d415, 0x00002f15, 0x0001d915, 0x0001db15, 0x0001dd15,
+	0x00003015, 0x0001e215, 0x0001e415, 0x0001e715, 0x0001e915, 0x00003115, 0x0001ed15, 0x0001f015,
+	0x0001f215, 0x00000515, 0x0001f715, 0x0001f915, 0x0001fb15, 0x00003315, 0x00020015, 0x00020215,
+	0x00020515, 0x00020715, 0x00003415, 0x00020b15, 0x00020e15, 0x00021015, 0x00003515, 0x00021515,
+	0x00021715, 0x00021915, 0x00003615, 0x00021e15, 0x00022015, 0x00022215, 0x00022515, 0x00003715,
+	0x00022915, 0x00022c15, 0x00022e15, 0x00003815, 0x00023315, 0x00023515, 0x00023715, 0x00003915,
+	0x00023c15, 0x00023e15, 0x00024015, 0x00024315, 0x00003a15, 0x00024715, 0x00024a15, 0x00024c15,
+	0x00003b15, 0x00025315, 0x00000615, 0x00025c15, 0x00003d15, 0x00026515, 0x00003e15, 0x00026f15,
+	0x00027315, 0x00003f15, 0x00027c15, 0x00004015, 0x00028615, 0x00004115, 0x00028f15, 0x00004215,
+	0x00029815, 0x00004315, 0x0002a115, 0x00004415, 0x0002ab15, 0x0002af15, 0x00004515, 0x0002b815,
+	0x00000715, 0x0002c215, 0x00004715, 0x0002cb15, 0x00004815, 0x0002d415, 0x00004915, 0x0002dd15,
+	0x00004a15, 0x0002e615, 0x0002eb15, 0x00004b15, 0x0002f415, 0x00004c15, 0x0002fe15, 0x00004d15,
+	0x00030715, 0x00004e15, 0x00031015, 0x00004f15, 0x00031915, 0x00000815, 0x00032215, 0x00032715,
+	0x00005115, 0x00033015, 0x00005215, 0x00033915, 0x00005315, 0x00034315, 0x00005415, 0x00034c15,
+	0x00005515, 0x00035515, 0x00005615, 0x00035e15, 0x00036315, 0x00005715, 0x00036c15, 0x00005815,
+	0x00037515, 0x00005915, 0x00037f15, 0x00000915, 0x00038815, 0x00005b15, 0x00039115, 0x00005c15,
+	0x00039a15, 0x00039f15, 0x00005d15, 0x0003a815, 0x00005e15, 0x0003b115, 0x00005f15, 0x0003bb15,
+	0x00006015, 0x0003c415, 0x00006115, 0x0003cd15, 0x0003d215, 0x00006215, 0x0003db15, 0x00006315,
+	0x0003e415, 0x00000116, 0x0003ed16, 0x00006516, 0x0003f716, 0x00006616, 0x00040016, 0x00006716,
+	0x00040916, 0x00040e16, 0x00006816, 0x00041716, 0x00006916, 0x00042016, 0x00006a16, 0x00042916,
+	0x00006b16, 0x00043316, 0x00006c16, 0x00043c16, 0x00006d16, 0x00044516, 0x00044a16, 0x00000b16,
+	0x00045316, 0x00006f16, 0x00045c16, 0x00007016, 0x00046516, 0x00007116, 0x00046e16, 0x00007216,
+	0x00047816, 0x00007316, 0x00048116, 0x00048616, 0x00007416, 0x00048f16, 0x00007516, 0x00049816,
+	0x00007616, 0x00007716, 0x00000c16, 0x00007916, 0x00007a16, 0x00007b16, 0x00007c16, 0x0004dd16,
+	0x00007d16, 0x00007e16, 0x00007f16, 0x00008016, 0x00008116, 0x00000d16, 0x00008316, 0x00008416,
+	0x00008516, 0x00008616, 0x00008716, 0x00008816, 0x00055516, 0x00008916, 0x00008a16, 0x00008b16,
+	0x00000e16, 0x00008d16, 0x00008e16, 0x00008f16, 0x00009016, 0x00009116, 0x00009216, 0x00009316,
+	0x00009416, 0x0005cd16, 0x00009516, 0x00000f16, 0x00009716, 0x00009816, 0x00009916, 0x00009a16,
+	0x00009b16, 0x00009c16, 0x00009d16, 0x00009e16, 0x00009f16, 0x00001016, 0x00064516, 0x0000a116,
+	0x0000a216, 0x0000a316, 0x0000a416, 0x0000a516, 0x0000a616, 0x0000a716, 0x0000a816, 0x0000a916,
+	0x00001116, 0x0000ab16, 0x0000ac16, 0x0006bd16, 0x0000ad16, 0x0000ae16, 0x0000af16, 0x0000b016,
+	0x0000b116, 0x0000b216, 0x0000b316, 0x00001216, 0x0000b516, 0x0000b616, 0x0000b716, 0x0000b816,
+	0x00073516, 0x0000b916, 0x0000ba16, 0x0000bb16, 0x0000bc16, 0x0000bd16, 0x00001316, 0x0000bf16,
+	0x0000c016, 0x0000c116, 0x0000c216, 0x0000c316, 0x0007a316, 0x0000c416, 0x0000c516, 0x0000c616,
+	0x0000c716, 0x00000216, 0x0000c916, 0x0000ca16, 0x0000cb16, 0x0000cc16, 0x0000cd16, 0x0000ce16,
+	0x0000cf16, 0x00081b16, 0x0000d016, 0x0000d116, 0x00001516, 0x0000d316, 0x0000d416, 0x0000d516,
+	0x0000d616, 0x0000d716, 0x0000d816, 0x0000d916, 0x0000da16, 0x0000db16, 0x00089316, 0x00001616,
+	0x0000dd16, 0x0000de16, 0x0000df16, 0x0000e016, 0x0000e116, 0x0000e216, 0x0000e316, 0x0000e416,
+	0x0000e516, 0x00001716, 0x0000e716, 0x00090b16, 0x0000e816, 0x0000e916, 0x0000ea16, 0x0000eb16,
+	0x0000ec16, 0x0000ee16, 0x00001816, 0x0000f216, 0x0000f316, 0x0000f516, 0x0000f716, 0x0000f916,
+	0x00001916, 0x0000fd16, 0x0000ff16, 0x00010016, 0x00010216, 0x00001a16, 0x00010616, 0x00010816,
+	0x00010a16, 0x00010b16, 0x00001b16, 0x00010f16, 0x00011116, 0x00011316, 0x00011516, 0x00011716,
+	0x00001c16, 0x00011a16, 0x00011c16, 0x00011e16, 0x00012016, 0x00001d16, 0x00012316, 0x00012516,
+	0x00012716, 0x00012916, 0x00012b16, 0x00000316, 0x00012f16, 0x00013016, 0x00013216, 0x00013416,
+	0x00001f16, 0x00013816, 0x00013a16, 0x00013b16, 0x00013d16, 0x00002016, 0x00014116, 0x00014316,
+	0x00014516, 0x00014716, 0x00014816, 0x00002116, 0x00014c16, 0x00014e16, 0x00015016, 0x00015216,
+	0x00002216, 0x00015516, 0x00015716, 0x00015916, 0x00015b16, 0x00015d16, 0x00002316, 0x00016016,
+	0x00016216, 0x00016416, 0x00016616, 0x00002416, 0x00016a16, 0x00016b16, 0x00016d16, 0x00016f16,
+	0x00017116, 0x00002516, 0x00017516, 0x00017616, 0x00017816, 0x00017a16, 0x00002616, 0x00017e16,
+	0x00018016, 0x00018216, 0x00018316, 0x00002716, 0x00018716, 0x00018916, 0x00018b16, 0x00018d16,
+	0x00018e16, 0x00000416, 0x00019216, 0x00019416, 0x00019616, 0x00019816, 0x00002916, 0x00019b16,
+	0x00019d16, 0x00019f16, 0x0001a116, 0x0001a316, 0x00002a16, 0x0001a616, 0x0001a816, 0x0001aa16,
+	0x0001ac16, 0x00002b16, 0x0001b016, 0x0001b116, 0x0001b316, 0x0001b516, 0x0001b716, 0x00002c16,
+	0x0001bb16, 0x0001bd16, 0x0001be16, 0x0001c016, 0x00002d16, 0x0001c416, 0x0001c616, 0x0001c816,
+	0x0001c916, 0x00002e16, 0x0001cd16, 0x0001cf16, 0x0001d116, 0x0001d316, 0x0001d516, 0x00002f16,
+	0x0001d816, 0x0001dc16, 0x00003016, 0x0001e316, 0x0001e716, 0x00003116, 0x0001ee16, 0x0001f216,
+	0x00000516, 0x0001f916, 0x00003316, 0x00020116, 0x00020516, 0x00003416, 0x00020c16, 0x00021016,
+	0x00003516, 0x00021716, 0x00003616, 0x00021e16, 0x00022216, 0x00003716, 0x00022916, 0x00022d16,
+	0x00003816, 0x00023416, 0x00003916, 0x00023c16, 0x00024016, 0x00003a16, 0x00024716, 0x00024b16,
+	0x00003b16, 0x00025216, 0x00025616, 0x00000616, 0x00025d16, 0x00003d16, 0x00026416, 0x00026816,
+	0x00003e16, 0x00026f16, 0x00027316, 0x00003f16, 0x00027b16, 0x00004016, 0x00028216, 0x00028616,
+	0x00004116, 0x00028d16, 0x00029116, 0x00004216, 0x00029816, 0x00029c16, 0x00004316, 0x0002a316,
+	0x00004416, 0x0002ab16, 0x0002ae16, 0x00004516, 0x0002b616, 0x0002b916, 0x00000716, 0x0002c116,
+	0x00004716, 0x0002c816, 0x0002cc16, 0x00004816, 0x0002d316, 0x0002d716, 0x00004916, 0x0002de16,
+	0x0002e216, 0x00004a16, 0x0002e916, 0x00004b16, 0x0002f116, 0x0002f416, 0x00004c16, 0x0002fc16,
+	0x0002ff16, 0x00004d16, 0x00030716, 0x00004e16, 0x00030e16, 0x00031216, 0x00004f16, 0x00031916,
+	0x00031d16, 0x00000816, 0x00032416, 0x00032816, 0x00005116, 0x00032f16, 0x00005216, 0x00033716,
+	0x00033a16, 0x00005316, 0x00034216, 0x00034516, 0x00005416, 0x00034d16, 0x00005516, 0x00035416,
+	0x00035816, 0x00005616, 0x00035f16, 0x00036316, 0x00005716, 0x00036a16, 0x00036e16, 0x00005816,
+	0x00037516, 0x00005916, 0x00037d16, 0x00038116, 0x00000916, 0x00038816, 0x00038c16, 0x00005b16,
+	0x00039316, 0x00005c16, 0x00039a16, 0x00039e16, 0x00005d16, 0x0003a516, 0x0003a916, 0x00005e16,
+	0x0003b016, 0x00005f16, 0x00006016, 0x00006116, 0x0003ce16, 0x00006216, 0x00006316, 0x0003e416,
+	0x00000117, 0x00006517, 0x00006617, 0x00040217, 0x00006717, 0x00006817, 0x00006917, 0x00041f17,
+	0x00006a17, 0x00006b17, 0x00006c17, 0x00043d17, 0x00006d17, 0x00000b17, 0x00006f17, 0x00045a17,
+	0x00007017, 0x00007117, 0x00007217, 0x00047817, 0x00007317, 0x00007417, 0x00048e17, 0x00007517,
+	0x00007617, 0x00007717, 0x0004ab17, 0x00000c17, 0x00007917, 0x00007a17, 0x0004c917, 0x00007b17,
+	0x00007c17, 0x00007d17, 0x0004e617, 0x00007e17, 0x00007f17, 0x00008017, 0x00050417, 0x00008117,
+	0x00000d17, 0x00051a17, 0x00008317, 0x00008417, 0x00008517, 0x00053817, 0x00008617, 0x00008717,
+	0x00008817, 0x00055517, 0x00008917, 0x00008a17, 0x00008b17, 0x00057317, 0x00000e17, 0x00008d17,
+	0x00008e17, 0x00059017, 0x00008f17, 0x00009017, 0x0005a617, 0x00009117, 0x00009217, 0x00009317,
+	0x0005c417, 0x00009417, 0x00009517, 0x00000f17, 0x0005e117, 0x00009717, 0x00009817, 0x00009917,
+	0x0005ff17, 0x00009a17, 0x00009b17, 0x00009c17, 0x00061c17, 0x00009d17, 0x00009e17, 0x00009f17,
+	0x00063a17, 0x00001017, 0x0000a117, 0x00065017, 0x0000a217, 0x0000a317, 0x0000a417, 0x00066d17,
+	0x0000a517, 0x0000a617, 0x0000a717, 0x00068b17, 0x0000a817, 0x0000a917, 0x00001117, 0x0006a817,
+	0x0000ab17, 0x0000ac17, 0x0000ad17, 0x0006c617, 0x0000ae17, 0x0000af17, 0x0006dc17, 0x0000b017,
+	0x0000b117, 0x0000b217, 0x0006fa17, 0x0000b317, 0x00001217, 0x0000b517, 0x00071717, 0x0000b617,
+	0x0000b717, 0x0000b817, 0x00073517, 0x0000b917, 0x0000ba17, 0x0000bb17, 0x00075217, 0x0000bc17,
+	0x0000bd17, 0x00001317, 0x0000c017, 0x0000c117, 0x0000c317, 0x0000c417, 0x0000c617, 0x0000c717,
+	0x00000217, 0x0000ca17, 0x0000cc17, 0x0000cd17, 0x0000cf17, 0x0000d017, 0x00001517, 0x0000d317,
+	0x0000d517, 0x0000d617, 0x0000d717, 0x0000d917, 0x0000da17, 0x00001617, 0x0000dd17, 0x0000df17,
+	0x0000e017, 0x0000e217, 0x0000e317, 0x0000e517, 0x00001717, 0x0000e817, 0x0000e917, 0x0000eb17,
+	0x0000ec17, 0x0000ee17, 0x0000ef17, 0x00001817, 0x0000f217, 0x0000f317, 0x0000f517, 0x0000f617,
+	0x0000f817, 0x00001917, 0x0000fb17, 0x0000fc17, 0x0000fe17, 0x0000ff17, 0x00010117, 0x00010217,
+	0x00001a17, 0x00010517, 0x00010717, 0x00010817, 0x00010a17, 0x00010b17, 0x00010d17, 0x00001b17,
+	0x00011017, 0x00011117, 0x00011217, 0x00011417, 0x00011517, 0x00011717, 0x00001c17, 0x00011a17,
+	0x00011b17, 0x00011d17, 0x00011e17, 0x00012017, 0x00012117, 0x00001d17, 0x00012417, 0x00012617,
+	0x00012717, 0x00012917, 0x00012a17, 0x00000317, 0x00012d17, 0x00012f17, 0x00013017, 0x00013117,
+	0x00013317, 0x00013417, 0x00001f17, 0x00013717, 0x00013917, 0x00013a17, 0x00013c17, 0x00013d17,
+	0x00013f17, 0x00002017, 0x00014217, 0x00014317, 0x00014517, 0x00014617, 0x00014817, 0x00014917,
+	0x00002117, 0x00014c17, 0x00014e17, 0x00014f17, 0x00015017, 0x00015217, 0x00002217, 0x00015517,
+	0x00015617, 0x00015817, 0x00015917, 0x00015b17, 0x00015c17, 0x00002317, 0x00015f17, 0x00016117,
+	0x00016217, 0x00016417, 0x00016517, 0x00016717, 0x00002417, 0x00016a17, 0x00016b17, 0x00016d17,
+	0x00016e17, 0x00016f17, 0x00017117, 0x00002517, 0x00017417, 0x00017517, 0x00017717, 0x00017817,
+	0x00017a17, 0x00002617, 0x00018017, 0x00018317, 0x00002717, 0x00018917, 0x00018b17, 0x00018e17,
+	0x00000417, 0x00019417, 0x00019717, 0x00002917, 0x00019d17, 0x0001a017, 0x00002a17, 0x0001a617,
+	0x0001a917, 0x0001ac17, 0x00002b17, 0x0001b217, 0x0001b517, 0x00002c17, 0x0001bb17, 0x0001be17,
+	0x00002d17, 0x0001c417, 0x0001c717, 0x0001c917, 0x00002e17, 0x0001cf17, 0x0001d217, 0x00002f17,
+	0x0001d817, 0x0001db17, 0x0001de17, 0x00003017, 0x0001e417, 0x0001e717, 0x00003117, 0x0001ed17,
+	0x0001f017, 0x00000517, 0x0001f617, 0x0001f917, 0x0001fc17, 0x00003317, 0x00020217, 0x00020517,
+	0x00003417, 0x00020a17, 0x00020d17, 0x00021017, 0x00003517, 0x00021617, 0x00021917, 0x00003617,
+	0x00021f17, 0x00022217, 0x00003717, 0x00022817, 0x00022b17, 0x00022e17, 0x00003817, 0x00023417,
+	0x00023717, 0x00003917, 0x00023d17, 0x00024017, 0x00024217, 0x00003a17, 0x00024817, 0x00024b17,
+	0x00003b17, 0x00025117, 0x00025417, 0x00000617, 0x00025a17, 0x00025d17, 0x00026017, 0x00003d17,
+	0x00026617, 0x00026917, 0x00003e17, 0x00026f17, 0x00027217, 0x00003f17, 0x00027817, 0x00027b17,
+	0x00027e17, 0x00004017, 0x00028317, 0x00028617, 0x00004117, 0x00028c17, 0x00028f17, 0x00029217,
+	0x00004217, 0x00029817, 0x00029b17, 0x00004317, 0x0002a117, 0x0002a417, 0x00004417, 0x0002aa17,
+	0x0002ad17, 0x0002b017, 0x00004517, 0x0002b617, 0x0002b917, 0x00000717, 0x0002be17, 0x0002c117,
+	0x0002c417, 0x00004717, 0x0002ca17, 0x0002cd17, 0x00004817, 0x0002d317, 0x0002d617, 0x00004917,
+	0x0002dc17, 0x0002df17, 0x0002e217, 0x00004a17, 0x0002e817, 0x0002eb17, 0x00004b17, 0x0002f117,
+	0x0002f417, 0x00004c17, 0x00004d17, 0x00030517, 0x00004e17, 0x00031117, 0x00004f17, 0x00031d17,
+	0x00000817, 0x00005117, 0x00032f17, 0x00005217, 0x00033a17, 0x00005317, 0x00005417, 0x00034c17,
+	0x00005517, 0x00035817, 0x00005617, 0x00005717, 0x00036a17, 0x00005817, 0x00037517, 0x00005917,
+	0x00000917, 0x00038717, 0x00005b17, 0x00039317, 0x00005c17, 0x00039f17, 0x00005d17, 0x00005e17,
+	0x0003b017, 0x00005f17, 0x0003bc17, 0x00006017, 0x00006117, 0x0003ce17, 0x00006217, 0x0003da17,
+	0x00006317, 0x00000118, 0x0003ec18, 0x00006518, 0x0003f718, 0x00006618, 0x00006718, 0x00040918,
+	0x00006818, 0x00041518, 0x00006918, 0x00042118, 0x00006a18, 0x00006b18, 0x00043218, 0x00006c18,
+	0x00043e18, 0x00006d18, 0x00000b18, 0x00045018, 0x00006f18, 0x00045c18, 0x00007018, 0x00007118,
+	0x00046d18, 0x00007218, 0x00047918, 0x00007318, 0x00048518, 0x00007418, 0x00007518, 0x00049718,
+	0x00007618, 0x0004a218, 0x00007718, 0x00000c18, 0x0004b418, 0x00007918, 0x0004c018, 0x00007a18,
+	0x00007b18, 0x0004d218, 0x00007c18, 0x0004de18, 0x00007d18, 0x00007e18, 0x0004ef18, 0x00007f18,
+	0x0004fb18, 0x00008018, 0x00050718, 0x00008118, 0x00000d18, 0x00051918, 0x00008318, 0x00052418,
+	0x00008418, 0x00008518, 0x00053618, 0x00008618, 0x00054218, 0x00008718, 0x00008818, 0x00055418,
+	0x00008918, 0x00055f18, 0x00008a18, 0x00008b18, 0x00057118, 0x00000e18, 0x00057d18, 0x00008d18,
+	0x00058918, 0x00008e18, 0x00008f18, 0x00059a18, 0x00009018, 0x0005a618, 0x00009118, 0x00009218,
+	0x0005b818, 0x00009318, 0x0005c418, 0x00009418, 0x00009518, 0x0005d518, 0x00000f18, 0x0005e118,
+	0x00009718, 0x00009818, 0x00009918, 0x00009b18, 0x00009c18, 0x00009d18, 0x00009e18, 0x00009f18,
+	0x00001018, 0x0000a218, 0x0000a318, 0x0000a418, 0x0000a518, 0x0000a618, 0x0000a818, 0x0000a918,
+	0x00001118, 0x0000ab18, 0x0000ac18, 0x0000ae18, 0x0000af18, 0x0000b018, 0x0000b118, 0x0000b218,
+	0x00001218, 0x0000b518, 0x0000b618, 0x0000b718, 0x0000b818, 0x0000b918, 0x0000bb18, 0x0000bc18,
+	0x0000bd18, 0x00001318, 0x0000bf18, 0x0000c018, 0x0000c218, 0x0000c318, 0x0000c418, 0x0000c518,
+	0x0000c618, 0x00000218, 0x0000c918, 0x0000ca18, 0x0000cb18, 0x0000cc18, 0x0000cd18, 0x0000cf18,
+	0x0000d018, 0x0000d118, 0x00001518, 0x0000d318, 0x0000d518, 0x0000d618, 0x0000d718, 0x0000d818,
+	0x0000d918, 0x0000da18, 0x00001618, 0x0000dd18, 0x0000de18, 0x0000df18, 0x0000e018, 0x0000e118,
+	0x0000e318, 0x0000e418, 0x0000e518, 0x00001718, 0x0000e718, 0x0000e918, 0x0000ea18, 0x0000eb18,
+	0x0000ec18, 0x0000ed18, 0x0000ee18, 0x00001818, 0x0000f118, 0x0000f218, 0x0000f318, 0x0000f418,
+	0x0000f618, 0x0000f718, 0x0000f818, 0x0000f918, 0x00001918, 0x0000fb18, 0x0000fd18, 0x0000fe18,
+	0x0000ff18, 0x00010018, 0x00010118, 0x00010318, 0x00001a18, 0x00010518, 0x00010618, 0x00010718,
+	0x00010818, 0x00010a18, 0x00010b18, 0x00010c18, 0x00010d18, 0x00001b18, 0x00011018, 0x00011118,
+	0x00011218, 0x00011318, 0x00011418, 0x00011518, 0x00011718, 0x00001c18, 0x00011918, 0x00011a18,
+	0x00011b18, 0x00011d18, 0x00011e18, 0x00011f18, 0x00012018, 0x00012118, 0x00001d18, 0x00012418,
+	0x00012518, 0x00012618, 0x00012718, 0x00012818, 0x00012a18, 0x00012b18, 0x00000318, 0x00012d18,
+	0x00012e18, 0x00013118, 0x00013318, 0x00001f18, 0x00013818, 0x00013a18, 0x00013c18, 0x00013f18,
+	0x00002018, 0x00014318, 0x00014618, 0x00014818, 0x00002118, 0x00014d18, 0x00014f18, 0x00015218,
+	0x00002218, 0x00015618, 0x00015918, 0x00015b18, 0x00002318, 0x00016018, 0x00016218, 0x00016518,
+	0x00002418, 0x00016918, 0x00016c18, 0x00016e18, 0x00017018, 0x00002518, 0x00017518, 0x00017718,
+	0x00017a18, 0x00002618, 0x00017f18, 0x00018118, 0x00018318, 0x00002718, 0x00018818, 0x00018a18,
+	0x00018d18, 0x00000418, 0x00019118, 0x00019418, 0x00019618, 0x00019818, 0x00002918, 0x00019d18,
+	0x0001a018, 0x0001a218, 0x00002a18, 0x0001a718, 0x0001a918, 0x0001ab18, 0x00002b18, 0x0001b018,
+	0x0001b218, 0x0001b518, 0x00002c18, 0x0001ba18, 0x0001bc18, 0x0001be18, 0x0001c118, 0x00002d18,
+	0x0001c518, 0x0001c818, 0x0001ca18, 0x00002e18, 0x0001cf18, 0x0001d118, 0x0001d418, 0x00002f18,
+	0x0001d818, 0x0001db18, 0x0001dd18, 0x00003018, 0x0001e218, 0x0001e418, 0x0001e618, 0x0001e918,
+	0x00003118, 0x0001ed18, 0x0001f018, 0x0001f218, 0x00000518, 0x0001f718, 0x0001f918, 0x0001fc18,
+	0x00003318, 0x00020018, 0x00020318, 0x00020518, 0x00003418, 0x00020a18, 0x00020c18, 0x00020f18,
+	0x00003518, 0x00021318, 0x00021618, 0x00021818, 0x00021a18, 0x00003618, 0x00021f18, 0x00022118,
+	0x00022418, 0x00003718, 0x00022918, 0x00022b18, 0x00022d18, 0x00003818, 0x00023218, 0x00023418,
+	0x00023718, 0x00003918, 0x00023b18, 0x00023e18, 0x00024018, 0x00024218, 0x00003a18, 0x00024718,
+	0x00024a18, 0x00024c18, 0x00003b18, 0x00025118, 0x00025318, 0x00025518, 0x00000618, 0x00025a18,
+	0x00025c18, 0x00003d18, 0x00026618, 0x00003e18, 0x00026f18, 0x00003f18, 0x00027918, 0x00027e18,
+	0x00004018, 0x00028718, 0x00004118, 0x00029018, 0x00004218, 0x00029a18, 0x00004318, 0x0002a318,
+	0x00004418, 0x0002ad18, 0x00004518, 0x0002b618, 0x00000718, 0x0002c018, 0x00004718, 0x0002c918,
+	0x00004818, 0x0002d318, 0x0002d718, 0x00004918, 0x0002e118, 0x00004a18, 0x0002ea18, 0x00004b18,
+	0x0002f418, 0x00004c18, 0x0002fd18, 0x00004d18, 0x00030618, 0x00004e18, 0x00031018, 0x00004f18,
+	0x00031918, 0x00000818, 0x00032318, 0x00032818, 0x00005118, 0x00033118, 0x00005218, 0x00033a18,
+	0x00005318, 0x00034418, 0x00005418, 0x00034d18, 0x00005518, 0x00035718, 0x00005618, 0x00036018,
+	0x00005718, 0x00036a18, 0x00005818, 0x00037318, 0x00005918, 0x00037d18, 0x00038118, 0x00000918,
+	0x00038b18, 0x00005b18, 0x00039418, 0x00005c18, 0x00039e18, 0x00005d18, 0x0003a718, 0x00005e18,
+	0x0003b018, 0x00005f18, 0x0003ba18, 0x00006018, 0x0003c318, 0x00006118, 0x0003cd18, 0x0003d218,
+	0x00006218, 0x0003db18, 0x00006318, 0x0003e418, 0x00000119, 0x0003ee19, 0x00006519, 0x0003f719,
+	0x00006619, 0x00040119, 0x00006719, 0x00040a19, 0x00006819, 0x00041419, 0x00006919, 0x00041d19,
+	0x00006a19, 0x00042719, 0x00042b19, 0x00006b19, 0x00043519, 0x00006c19, 0x00043e19, 0x00006d19,
+	0x00044819, 0x00000b19, 0x00045119, 0x00006f19, 0x00045a19, 0x00007019, 0x00046419, 0x00007119,
+	0x00046d19, 0x00007219, 0x00047719, 0x00047c19, 0x00007319, 0x00048519, 0x00007419, 0x00048e19,
+	0x00007519, 0x00049819, 0x00007619, 0x0004a119, 0x00007719, 0x0004ab19, 0x00000c19, 0x0004b419,
+	0x00007919, 0x00007a19, 0x00007b19, 0x00007c19, 0x00007d19, 0x00007e19, 0x00007f19, 0x0004fb19,
+	0x00008019, 0x00008119, 0x00000d19, 0x00008319, 0x00008419, 0x00008519, 0x00008619, 0x00008719,
+	0x00008819, 0x00008919, 0x00008a19, 0x00008b19, 0x00000e19, 0x00008d19, 0x00008e19, 0x00008f19,
+	0x00009019, 0x0005a519, 0x00009119, 0x00009219, 0x00009319, 0x00009419, 0x00009519, 0x00000f19,
+	0x00009719, 0x00009819, 0x00009919, 0x00009a19, 0x00009b19, 0x00009c19, 0x00009d19, 0x00009e19,
+	0x00009f19, 0x00001019, 0x0000a119, 0x00064f19, 0x0000a219, 0x0000a319, 0x0000a419, 0x0000a519,
+	0x0000a619, 0x0000a719, 0x0000a819, 0x0000a919, 0x00001119, 0x0000ab19, 0x0000ac19, 0x0000ad19,
+	0x0000ae19, 0x0000af19, 0x0000b019, 0x0000b119, 0x0000b219, 0x0006f919, 0x0000b319, 0x00001219,
+	0x0000b519, 0x0000b619, 0x0000b719, 0x0000b819, 0x0000b919, 0x0000ba19, 0x0000bb19, 0x0000bc19,
+	0x0000bd19, 0x00001319, 0x0000bf19, 0x0000c019, 0x0000c119, 0x0000c219, 0x0000c319, 0x0007a319,
+	0x0000c419, 0x0000c519, 0x0000c619, 0x0000c719, 0x00000219, 0x0000c919, 0x0000ca19, 0x0000cb19,
+	0x0000cc19, 0x0000cd19, 0x0000ce19, 0x0000cf19, 0x0000d019, 0x0000d119, 0x00001519, 0x0000d319,
+	0x0000d419, 0x00084d19, 0x0000d519, 0x0000d619, 0x0000d719, 0x0000d819, 0x0000d919, 0x0000da19,
+	0x0000db19, 0x00001619, 0x0000dd19, 0x0000de19, 0x0000df19, 0x0000e019, 0x0000e119, 0x0000e219,
+	0x0000e319, 0x0000e419, 0x0000e519, 0x0008f719, 0x00001719, 0x0000e719, 0x0000e819, 0x0000e919,
+	0x0000ea19, 0x0000eb19, 0x0000ec19, 0x0000ed19, 0x0000ee19, 0x0000ef19, 0x00001819, 0x0000f119,
+	0x0000f219, 0x0000f419, 0x0000f619, 0x0000f719, 0x00001919, 0x0000fb19, 0x0000fd19, 0x0000ff19,
+	0x00010119, 0x00010319, 0x00001a19, 0x00010719, 0x00010819, 0x00010a19, 0x00010c19, 0x00001b19,
+	0x00011019, 0x00011219, 0x00011419, 0x00011619, 0x00001c19, 0x00011919, 0x00011b19, 0x00011d19,
+	0x00011f19, 0x00012119, 0x00001d19, 0x00012519, 0x00012719, 0x00012919, 0x00012a19, 0x00000319,
+	0x00012e19, 0x00013019, 0x00013219, 0x00013419, 0x00001f19, 0x00013819, 0x00013a19, 0x00013b19,
+	0x00013d19, 0x00002019, 0x00014119, 0x00014319, 0x00014519, 0x00014719, 0x00014919, 0x00002119,
+	0x00014c19, 0x00014e19, 0x00015019, 0x00015219, 0x00002219, 0x00015619, 0x00015819, 0x00015a19,
+	0x00015c19, 0x00002319, 0x00015f19, 0x00016119, 0x00016319, 0x00016519, 0x00016719, 0x00002419,
+	0x00016b19, 0x00016d19, 0x00016e19, 0x00017019, 0x00002519, 0x00017419, 0x00017619, 0x00017819,
+	0x00017a19, 0x00002619, 0x00017e19, 0x00017f19, 0x00018119, 0x00018319, 0x00002719, 0x00018719,
+	0x00018919, 0x00018b19, 0x00018d19, 0x00018f19, 0x00000419, 0x00019219, 0x00019419, 0x00019619,
+	0x00019819, 0x00002919, 0x00019c19, 0x00019e19, 0x0001a019, 0x0001a119, 0x00002a19, 0x0001a519,
+	0x0001a719, 0x0001a919, 0x0001ab19, 0x0001ad19, 0x00002b19, 0x0001b119, 0x0001b219, 0x0001b419,
+	0x0001b619, 0x00002c19, 0x0001ba19, 0x0001bc19, 0x0001be19, 0x0001c019, 0x00002d19, 0x0001c319,
+	0x0001c519, 0x0001c719, 0x0001c919, 0x0001cb19, 0x00002e19, 0x0001cf19, 0x0001d119, 0x0001d319,
+	0x0001d419, 0x00002f19, 0x0001d819, 0x0001da19, 0x0001dc19, 0x0001de19, 0x00003019, 0x0001e219,
+	0x0001e419, 0x0001e719, 0x00003119, 0x0001ef19, 0x00000519, 0x0001f619, 0x0001fa19, 0x00003319,
+	0x00020219, 0x00020619, 0x00003419, 0x00020d19, 0x00003519, 0x00021519, 0x00021819, 0x00003619,
+	0x00022019, 0x00022419, 0x00003719, 0x00022b19, 0x00003819, 0x00023319, 0x00023719, 0x00003919,
+	0x00023e19, 0x00024219, 0x00003a19, 0x00024a19, 0x00003b19, 0x00025119, 0x00025519, 0x00000619,
+	0x00025c19, 0x00003d19, 0x00026419, 0x00026819, 0x00003e19, 0x00026f19, 0x00027319, 0x00003f19,
+	0x00027b19, 0x00004019, 0x00028219, 0x00028619, 0x00004119, 0x00028e19, 0x00029119, 0x00004219,
+	0x00029919, 0x00004319, 0x0002a019, 0x0002a419, 0x00004419, 0x0002ac19, 0x0002b019, 0x00004519,
+	0x0002b719, 0x00000719, 0x0002bf19, 0x0002c219, 0x00004719, 0x0002ca19, 0x0002ce19, 0x00004819,
+	0x0002d519, 0x00004919, 0x0002dd19, 0x0002e119, 0x00004a19, 0x0002e819, 0x0002ec19, 0x00004b19,
+	0x0002f419, 0x00004c19, 0x0002fb19, 0x0002ff19, 0x00004d19, 0x00030619, 0x00004e19, 0x00030e19,
+	0x00031219, 0x00004f19, 0x00031919, 0x00031d19, 0x00000819, 0x00032519, 0x00005119, 0x00032c19,
+	0x00033019, 0x00005219, 0x00033819, 0x00033b19, 0x00005319, 0x00034319, 0x00005419, 0x00034a19,
+	0x00034e19, 0x00005519, 0x00035619, 0x00035a19, 0x00005619, 0x00036119, 0x00005719, 0x00036919,
+	0x00036c19, 0x00005819, 0x00037419, 0x00037819, 0x00005919, 0x00037f19, 0x00000919, 0x00038719,
+	0x00038b19, 0x00005b19, 0x00039219, 0x00039619, 0x00005c19, 0x00039e19, 0x00005d19, 0x0003a519,
+	0x0003a919, 0x00005e19, 0x0003b019, 0x00005f19, 0x0003b819, 0x0003bc19, 0x00006019, 0x0003c319,
+	0x00006119, 0x0003cf19, 0x00006219, 0x00006319, 0x0000011a, 0x0003ed1a, 0x0000651a, 0x0000661a,
+	0x0000671a, 0x00040b1a, 0x0000681a, 0x0000691a, 0x00006a1a, 0x0004291a, 0x00006b1a, 0x00006c1a,
+	0x00006d1a, 0x0004481a, 0x00000b1a, 0x00006f1a, 0x0000701a, 0x0004661a, 0x0000711a, 0x0000721a,
+	0x0000731a, 0x0004841a, 0x0000741a, 0x0000751a, 0x0000761a, 0x0000771a, 0x0004aa1a, 0x00000c1a,
+	0x0000791a, 0x00007a1a, 0x0004c81a, 0x00007b1a, 0x00007c1a, 0x00007d1a, 0x0004e61a, 0x00007e1a,
+	0x00007f1a, 0x0000801a, 0x0005041a, 0x0000811a, 0x00000d1a, 0x0000831a, 0x0005231a, 0x0000841a,
+	0x0000851a, 0x0000861a, 0x0005411a, 0x0000871a, 0x0000881a, 0x0000891a, 0x00055f1a, 0x00008a1a,
+	0x00008b1a, 0x00000e1a, 0x00057d1a, 0x00008d1a, 0x00008e1a, 0x00008f1a, 0x00059c1a, 0x0000901a,
+	0x0000911a, 0x0000921a, 0x0005ba1a, 0x0000931a, 0x0000941a, 0x0000951a, 0x0005d81a, 0x00000f1a,
+	0x0000971a, 0x0000981a, 0x0000991a, 0x0005fe1a, 0x00009a1a, 0x00009b1a, 0x00009c1a, 0x00061c1a,
+	0x00009d1a, 0x00009e1a, 0x00009f1a, 0x00063a1a, 0x0000101a, 0x0000a11a, 0x0000a21a, 0x0006581a,
+	0x0000a31a, 0x0000a41a, 0x0000a51a, 0x0006771a, 0x0000a61a, 0x0000a71a, 0x0000a81a, 0x0006951a,
+	0x0000a91a, 0x0000111a, 0x0000ab1a, 0x0006b31a, 0x0000ac1a, 0x0000ad1a, 0x0000ae1a, 0x0006d11a,
+	0x0000af1a, 0x0000b01a, 0x0000b11a, 0x0006f01a, 0x0000b21a, 0x0000b31a, 0x0000121a, 0x00070e1a,
+	0x0000b51a, 0x0000b61a, 0x0000b71a, 0x00072c1a, 0x0000b81a, 0x0000b91a, 0x0000ba1a, 0x0000bb1a,
+	0x0007521a, 0x0000bc1a, 0x0000bd1a, 0x0000131a, 0x0007701a, 0x0000bf1a, 0x0000c01a, 0x0000c11a,
+	0x0000c21a, 0x0000c31a, 0x0000c41a, 0x0000c61a, 0x0000021a, 0x0000c91a, 0x0000ca1a, 0x0000cc1a,
+	0x0000ce1a, 0x0000cf1a, 0x0000d11a, 0x0000151a, 0x0000d41a, 0x0000d51a, 0x0000d71a, 0x0000d81a,
+	0x0000da1a, 0x0000db1a, 0x0000161a, 0x0000de1a, 0x0000e01a, 0x0000e11a, 0x0000e31a, 0x0000e41a,
+	0x0000171a, 0x0000e71a, 0x0000e91a, 0x0000ea1a, 0x0000ec1a, 0x0000ed1a, 0x0000ef1a, 0x0000181a,
+	0x0000f21a, 0x0000f31a, 0x0000f51a, 0x0000f61a, 0x0000f81a, 0x0000191a, 0x0000fb1a, 0x0000fc1a,
+	0x0000fe1a, 0x0000ff1a, 0x0001011a, 0x0001021a, 0x00001a1a, 0x0001051a, 0x0001071a, 0x0001081a,
+	0x00010a1a, 0x00010b1a, 0x00010d1a, 0x00001b1a, 0x0001101a, 0x0001121a, 0x0001131a, 0x0001151a,
+	0x0001161a, 0x00001c1a, 0x0001191a, 0x00011b1a, 0x00011c1a, 0x00011e1a, 0x00011f1a, 0x0001211a,
+	0x00001d1a, 0x0001241a, 0x0001251a, 0x0001271a, 0x0001281a, 0x00012a1a, 0x00012b1a, 0x0000031a,
+	0x00012e1a, 0x0001301a, 0x0001311a, 0x0001331a, 0x0001341a, 0x00001f1a, 0x0001371a, 0x0001391a,
+	0x00013a1a, 0x00013c1a, 0x00013d1a, 0x00013f1a, 0x0000201a, 0x0001421a, 0x0001431a, 0x0001451a,
+	0x0001461a, 0x0001481a, 0x0000211a, 0x00014b1a, 0x00014c1a, 0x00014e1a, 0x00014f1a, 0x0001511a,
+	0x0001521a, 0x0000221a, 0x0001561a, 0x0001571a, 0x0001591a, 0x00015a1a, 0x00015c1a, 0x00015d1a,
+	0x0000231a, 0x0001601a, 0x0001621a, 0x0001631a, 0x0001651a, 0x0001661a, 0x0000241a, 0x0001691a,
+	0x00016b1a, 0x00016c1a, 0x00016e1a, 0x00016f1a, 0x0001711a, 0x0000251a, 0x0001741a, 0x0001751a,
+	0x0001771a, 0x0001781a, 0x00017a1a, 0x0000261a, 0x00017d1a, 0x00017e1a, 0x0001801a, 0x0001811a,
+	0x0001831a, 0x0000271a, 0x0001891a, 0x00018c1a, 0x0000041a, 0x0001921a, 0x0001951a, 0x0001981a,
+	0x0000291a, 0x00019e1a, 0x0001a11a, 0x00002a1a, 0x0001a71a, 0x0001aa1a, 0x00002b1a, 0x0001b01a,
+	0x0001b31a, 0x0001b61a, 0x00002c1a, 0x0001bc1a, 0x0001bf1a, 0x00002d1a, 0x0001c51a, 0x0001c81a,
+	0x00002e1a, 0x0001ce1a, 0x0001d11a, 0x0001d41a, 0x00002f1a, 0x0001db1a, 0x0001de1a, 0x0000301a,
+	0x0001e41a, 0x0001e71a, 0x0000311a, 0x0001ed1a, 0x0001f01a, 0x0000051a, 0x0001f61a, 0x0001f91a,
+	0x0001fc1a, 0x0000331a, 0x0002021a, 0x0002051a, 0x0000341a, 0x00020b1a, 0x00020e1a, 0x0000351a,
+	0x0002141a, 0x0002171a, 0x00021a1a, 0x0000361a, 0x0002201a, 0x0002231a, 0x0000371a, 0x0002291a,
+	0x00022c1a, 0x0000381a, 0x0002321a, 0x0002351a, 0x0002381a, 0x0000391a, 0x00023e1a, 0x0002411a,
+	0x00003a1a, 0x0002471a, 0x00024a1a, 0x00003b1a, 0x0002501a, 0x0002531a, 0x0002561a, 0x0000061a,
+	0x00025c1a, 0x00025f1a, 0x00003d1a, 0x0002661a, 0x0002691a, 0x00003e1a, 0x00026f1a, 0x0002721a,
+	0x00003f1a, 0x0002781a, 0x00027b1a, 0x00027e1a, 0x0000401a, 0x0002841a, 0x0002871a, 0x0000411a,
+	0x00028d1a, 0x0002901a, 0x0000421a, 0x0002961a, 0x0002991a, 0x00029c1a, 0x0000431a, 0x0002a21a,
+	0x0002a51a, 0x0000441a, 0x0002ab1a, 0x0002ae1a, 0x0000451a, 0x0002b41a, 0x0002b71a, 0x0002ba1a,
+	0x0000071a, 0x0002c01a, 0x0002c31a, 0x0000471a, 0x0002c91a, 0x0002cc1a, 0x0000481a, 0x0002d21a,
+	0x0002d51a, 0x0002d81a, 0x0000491a, 0x0002de1a, 0x0002e11a, 0x00004a1a, 0x0002e71a, 0x0002eb1a,
+	0x00004b1a, 0x0002f11a, 0x0002f41a, 0x00004c1a, 0x0002fa1a, 0x0002fd1a, 0x0003001a, 0x00004d1a,
+	0x0003061a, 0x00004e1a, 0x0003121a, 0x00004f1a, 0x0000081a, 0x0003241a, 0x0000511a, 0x0003301a,
+	0x0000521a, 0x0000531a, 0x0003421a, 0x0000541a, 0x00034e1a, 0x0000551a, 0x0000561a, 0x0003601a,
+	0x0000571a, 0x00036c1a, 0x0000581a, 0x0000591a, 0x00037f1a, 0x0000091a, 0x00038b1a, 0x00005b1a,
+	0x00005c1a, 0x00039d1a, 0x00005d1a, 0x0003a91a, 0x00005e1a, 0x00005f1a, 0x0003bb1a, 0x0000601a,
+	0x0000611a, 0x0003cd1a, 0x0000621a, 0x0003d91a, 0x0000631a, 0x0000011b, 0x0003eb1b, 0x0000651b,
+	0x0003f71b, 0x0000661b, 0x0000671b, 0x00040a1b, 0x0000681b, 0x0004161b, 0x0000691b, 0x00006a1b,
+	0x0004281b, 0x00006b1b, 0x0004341b, 0x00006c1b, 0x00006d1b, 0x0004461b, 0x00000b1b, 0x0004521b,
+	0x00006f1b, 0x0000701b, 0x0004641b, 0x0000711b, 0x0004701b, 0x0000721b, 0x0000731b, 0x0004831b,
+	0x0000741b, 0x00048f1b, 0x0000751b, 0x0000761b, 0x0004a11b, 0x0000771b, 0x0004ad1b, 0x00000c1b,
+	0x0000791b, 0x0004bf1b, 0x00007a1b, 0x00007b1b, 0x0004d11b, 0x00007c1b, 0x0004dd1b, 0x00007d1b,
+	0x00007e1b, 0x0004ef1b, 0x00007f1b, 0x0004fb1b, 0x0000801b, 0x0000811b, 0x00050e1b, 0x00000d1b,
+	0x00051a1b, 0x0000831b, 0x0000841b, 0x00052c1b, 0x0000851b, 0x0005381b, 0x0000861b, 0x0000871b,
+	0x00054a1b, 0x0000881b, 0x0005561b, 0x0000891b, 0x00008a1b, 0x0005681b, 0x00008b1b, 0x0005741b,
+	0x00000e1b, 0x00008d1b, 0x0005861b, 0x00008e1b, 0x0005931b, 0x00008f1b, 0x0000901b, 0x0005a51b,
+	0x0000911b, 0x0005b11b, 0x0000921b, 0x0000931b, 0x0005c31b, 0x0000941b, 0x0000951b, 0x0005d51b,
+	0x00000f1b, 0x0005e11b, 0x0000971b, 0x0000981b, 0x0005f31b, 0x0000991b, 0x0005ff1b, 0x00009a1b,
+	0x00009b1b, 0x00009c1b, 0x00009d1b, 0x00009e1b, 0x0000101b, 0x0000a11b, 0x0000a21b, 0x0000a31b,
+	0x0000a41b, 0x0000a61b, 0x0000a71b, 0x0000a81b, 0x0000a91b, 0x0000111b, 0x0000ac1b, 0x0000ad1b,
+	0x0000ae1b, 0x0000af1b, 0x0000b11b, 0x0000b21b, 0x0000b31b, 0x0000121b, 0x0000b51b, 0x0000b71b,
+	0x0000b81b, 0x0000b91b, 0x0000ba1b, 0x0000bb1b, 0x0000bd1b, 0x0000131b, 0x0000bf1b, 0x0000c01b,
+	0x0000c11b, 0x0000c31b, 0x0000c41b, 0x0000c51b, 0x0000c61b, 0x0000021b, 0x0000c91b, 0x0000ca1b,
+	0x0000cb1b, 0x0000cc1b, 0x0000ce1b, 0x0000cf1b, 0x0000d01b, 0x0000d11b, 0x0000151b, 0x0000d41b,
+	0x0000d51b, 0x0000d61b, 0x0000d71b, 0x0000d81b, 0x0000da1b, 0x0000db1b, 0x0000161b, 0x0000dd1b,
+	0x0000de1b, 0x0000e01b, 0x0000e11b, 0x0000e21b, 0x0000e31b, 0x0000e41b, 0x0000171b, 0x0000e71b,
+	0x0000e81b, 0x0000e91b, 0x0000eb1b, 0x0000ec1b, 0x0000ed1b, 0x0000ee1b, 0x0000ef1b, 0x0000181b,
+	0x0000f21b, 0x0000f31b, 0x0000f41b, 0x0000f51b, 0x0000f71b, 0x0000f81b, 0x0000f91b, 0x0000191b,
+	0x0000fb1b, 0x0000fd1b, 0x0000fe1b, 0x0000ff1b, 0x0001001b, 0x0001021b, 0x0001031b, 0x00001a1b,
+	0x0001051b, 0x0001061b, 0x0001081b, 0x0001091b, 0x00010a1b, 0x00010b1b, 0x00010c1b, 0x00001b1b,
+	0x00010f1b, 0x0001101b, 0x0001111b, 0x0001121b, 0x0001141b, 0x0001151b, 0x0001161b, 0x0001171b,
+	0x00001c1b, 0x00011a1b, 0x00011b1b, 0x00011c1b, 0x00011d1b, 0x00011f1b, 0x0001201b, 0x0001211b,
+	0x00001d1b, 0x0001231b, 0x0001251b, 0x0001261b, 0x0001271b, 0x0001281b, 0x0001291b, 0x00012b1b,
+	0x0000031b, 0x00012d1b, 0x00012e1b, 0x00012f1b, 0x0001311b, 0x0001321b, 0x0001331b, 0x0001341b,
+	0x00001f1b, 0x0001381b, 0x00013a1b, 0x00013d1b, 0x0000201b, 0x0001421b, 0x0001441b, 0x0001461b,
+	0x0000211b, 0x00014b1b, 0x00014e1b, 0x0001501b, 0x0001521b, 0x0000221b, 0x0001571b, 0x00015a1b,
+	0x00015c1b, 0x0000231b, 0x0001611b, 0x0001631b, 0x0001661b, 0x0000241b, 0x00016b1b, 0x00016d1b,
+	0x0001701b, 0x0000251b, 0x0001741b, 0x0001771b, 0x0001791b, 0x0000261b, 0x00017e1b, 0x0001801b,
+	0x0001831b, 0x0000271b, 0x0001881b, 0x00018a1b, 0x00018d1b, 0x0000041b, 0x0001911b, 0x0001941b,
+	0x0001961b, 0x0001991b, 0x0000291b, 0x00019d1b, 0x0001a01b, 0x0001a21b, 0x00002a1b, 0x0001a71b,
+	0x0001aa1b, 0x0001ac1b, 0x00002b1b, 0x0001b11b, 0x0001b31b, 0x0001b61b, 0x00002c1b, 0x0001ba1b,
+	0x0001bd1b, 0x0001bf1b, 0x00002d1b, 0x0001c41b, 0x0001c71b, 0x0001c91b, 0x00002e1b, 0x0001ce1b,
+	0x0001d01b, 0x0001d31b, 0x00002f1b, 0x0001d71b, 0x0001da1b, 0x0001dc1b, 0x0001df1b, 0x0000301b,
+	0x0001e41b, 0x0001e61b, 0x0001e81b, 0x0000311b, 0x0001ed1b, 0x0001f01b, 0x0001f21b, 0x0000051b,
+	0x0001f71b, 0x0001f91b, 0x0001fc1b, 0x0000331b, 0x0002011b, 0x0002031b, 0x0002051b, 0x0000341b,
+	0x00020a1b, 0x00020d1b, 0x00020f1b, 0x0000351b, 0x0002141b, 0x0002161b, 0x0002191b, 0x0000361b,
+	0x00021e1b, 0x0002201b, 0x0002221b, 0x0000371b, 0x0002271b, 0x00022a1b, 0x00022c1b, 0x00022f1b,
+	0x0000381b, 0x0002331b, 0x0002361b, 0x0002381b, 0x0000391b, 0x00023d1b, 0x00023f1b, 0x0002421b,
+	0x00003a1b, 0x0002471b, 0x0002491b, 0x00024c1b, 0x00003b1b, 0x0002501b, 0x0002531b, 0x0002551b,
+	0x0000061b, 0x00025a1b, 0x00025c1b, 0x00025f1b, 0x00003d1b, 0x0002641b, 0x0002661b, 0x0002691b,
+	0x00003e1b, 0x0002701b, 0x00003f1b, 0x0002791b, 0x0000401b, 0x0002831b, 0x0000411b, 0x00028d1b,
+	0x0000421b, 0x0002961b, 0x00029b1b, 0x0000431b, 0x0002a51b, 0x0000441b, 0x0002af1b, 0x0000451b,
+	0x0002b81b, 0x0000071b, 0x0002c21b, 0x0000471b, 0x0002cc1b, 0x0000481b, 0x0002d51b, 0x0000491b,
+	0x0002df1b, 0x00004a1b, 0x0002e91b, 0x00004b1b, 0x0002f21b, 0x00004c1b, 0x0002fc1b, 0x00004d1b,
+	0x0003061b, 0x00004e1b, 0x00030f1b, 0x00004f1b, 0x0003191b, 0x0000081b, 0x0003231b, 0x0003281b,
+	0x0000511b, 0x0003311b, 0x0000521b, 0x00033b1b, 0x0000531b, 0x0003451b, 0x0000541b, 0x00034e1b,
+	0x0000551b, 0x0003581b, 0x0000561b, 0x0003621b, 0x0000571b, 0x00036b1b, 0x0000581b, 0x0003751b,
+	0x0000591b, 0x00037f1b, 0x0000091b, 0x0003881b, 0x00005b1b, 0x0003921b, 0x00005c1b, 0x00039c1b,
+	0x00005d1b, 0x0003a51b, 0x00005e1b, 0x0003af1b, 0x00005f1b, 0x0003b91b, 0x0003bd1b, 0x0000601b,
+	0x0003c71b, 0x0000611b, 0x0003d11b, 0x0000621b, 0x0003da1b, 0x0000631b, 0x0003e41b, 0x0000011c,
+	0x0003ee1c, 0x0000651c, 0x0003f71c, 0x0000661c, 0x0004011c, 0x0000671c, 0x00040b1c, 0x0000681c,
+	0x0004151c, 0x0000691c, 0x00041e1c, 0x00006a1c, 0x0004281c, 0x00006b1c, 0x0004321c, 0x00006c1c,
+	0x00043b1c, 0x00006d1c, 0x0004451c, 0x00000b1c, 0x00044f1c, 0x0004531c, 0x00006f1c, 0x00045d1c,
+	0x0000701c, 0x0004671c, 0x0000711c, 0x0004701c, 0x0000721c, 0x00047a1c, 0x0000731c, 0x0004841c,
+	0x0000741c, 0x00048d1c, 0x0000751c, 0x0004971c, 0x0000761c, 0x0004a11c, 0x0000771c, 0x0004aa1c,
+	0x00000c1c, 0x0004b41c, 0x0000791c, 0x0004be1c, 0x00007a1c, 0x0004c71c, 0x00007b1c, 0x0004d11c,
+	0x00007c1c, 0x00007d1c, 0x00007e1c, 0x00007f1c, 0x0000801c, 0x0000811c, 0x00000d1c, 0x0000831c,
+	0x0000841c, 0x00052d1c, 0x0000851c, 0x0000861c, 0x0000871c, 0x0000881c, 0x0000891c, 0x00008a1c,
+	0x00008b1c, 0x00000e1c, 0x00008d1c, 0x00008e1c, 0x00008f1c, 0x0000901c, 0x0000911c, 0x0000921c,
+	0x0000931c, 0x0000941c, 0x0000951c, 0x00000f1c, 0x0000971c, 0x0000981c, 0x0000991c, 0x00009a1c,
+	0x00009b1c, 0x00009c1c, 0x00009d1c, 0x00009e1c, 0x00009f1c, 0x0000101c, 0x0000a11c, 0x00064f1c,
+	0x0000a21c, 0x0000a31c, 0x0000a41c, 0x0000a51c, 0x0000a61c, 0x0000a71c, 0x0000a81c, 0x0000a91c,
+	0x0000111c, 0x0000ab1c, 0x0000ac1c, 0x0000ad1c, 0x0000ae1c, 0x0000af1c, 0x0000b01c, 0x0000b11c,
+	0x0000b21c, 0x0000b31c, 0x0000121c, 0x0000b51c, 0x0000b61c, 0x0000b71c, 0x0000b81c, 0x0000b91c,
+	0x0000ba1c, 0x0000bb1c, 0x0000bc1c, 0x0000bd1c, 0x0000131c, 0x0000bf1c, 0x00077b1c, 0x0000c01c,
+	0x0000c11c, 0x0000c21c, 0x0000c31c, 0x0000c41c, 0x0000c51c, 0x0000c61c, 0x0000c71c, 0x0000021c,
+	0x0000c91c, 0x0000ca1c, 0x0000cb1c, 0x0000cc1c, 0x0000cd1c, 0x0000ce1c, 0x0000cf1c, 0x0000d01c,
+	0x0000d11c, 0x0000151c, 0x0000d31c, 0x0000d41c, 0x0000d51c, 0x0000d61c, 0x0000d71c, 0x0000d81c,
+	0x0000d91c, 0x0000da1c, 0x0000db1c, 0x0000161c, 0x00089d1c, 0x0000dd1c, 0x0000de1c, 0x0000df1c,
+	0x0000e01c, 0x0000e11c, 0x0000e21c, 0x0000e31c, 0x0000e41c, 0x0000e51c, 0x0000171c, 0x0000e71c,
+	0x0000e81c, 0x0000e91c, 0x0000ea1c, 0x0000eb1c, 0x0000ec1c, 0x0000ed1c, 0x0000ee1c, 0x0000ef1c,
+	0x0000181c, 0x0000f11c, 0x0000f21c, 0x0000f31c, 0x0000f41c, 0x0000f51c, 0x0000f61c, 0x0000f71c,
+	0x0000f81c, 0x0000191c, 0x0000fb1c, 0x0000fd1c, 0x0000ff1c, 0x0001011c, 0x00001a1c, 0x0001051c,
+	0x0001071c, 0x0001091c, 0x00010b1c, 0x00010d1c, 0x00001b1c, 0x0001111c, 0x0001131c, 0x0001151c,
+	0x0001171c, 0x00001c1c, 0x00011a1c, 0x00011c1c, 0x00011e1c, 0x0001201c, 0x00001d1c, 0x0001241c,
+	0x0001261c, 0x0001281c, 0x00012a1c, 0x0000031c, 0x00012e1c, 0x0001301c, 0x0001321c, 0x0001341c,
+	0x00001f1c, 0x0001371c, 0x0001391c, 0x00013b1c, 0x00013d1c, 0x0000201c, 0x0001411c, 0x0001431c,
+	0x0001451c, 0x0001471c, 0x0001491c, 0x0000211c, 0x00014d1c, 0x00014f1c, 0x0001511c, 0x0001521c,
+	0x0000221c, 0x0001561c, 0x0001581c, 0x00015a1c, 0x00015c1c, 0x0000231c, 0x0001601c, 0x0001621c,
+	0x0001641c, 0x0001661c, 0x0000241c, 0x00016a1c, 0x00016c1c, 0x00016e1c, 0x0001701c, 0x0000251c,
+	0x0001731c, 0x0001751c, 0x0001771c, 0x0001791c, 0x0000261c, 0x00017d1c, 0x00017f1c, 0x0001811c,
+	0x0001831c, 0x0001851c, 0x0000271c, 0x0001891c, 0x00018b1c, 0x00018d1c, 0x00018e1c, 0x0000041c,
+	0x0001921c, 0x0001941c, 0x0001961c, 0x0001981c, 0x0000291c, 0x00019c1c, 0x00019e1c, 0x0001a01c,
+	0x0001a21c, 0x00002a1c, 0x0001a61c, 0x0001a81c, 0x0001aa1c, 0x0001ab1c, 0x00002b1c, 0x0001af1c,
+	0x0001b11c, 0x0001b31c, 0x0001b51c, 0x00002c1c, 0x0001b91c, 0x0001bb1c, 0x0001bd1c, 0x0001bf1c,
+	0x0001c11c, 0x00002d1c, 0x0001c51c, 0x0001c71c, 0x0001c81c, 0x0001ca1c, 0x00002e1c, 0x0001ce1c,
+	0x0001d01c, 0x0001d21c, 0x0001d41c, 0x00002f1c, 0x0001d81c, 0x0001da1c, 0x0001dc1c, 0x0001de1c,
+	0x0000301c, 0x0001e21c, 0x0001e41c, 0x0001e61c, 0x0001e71c, 0x0000311c, 0x0001eb1c, 0x0001ed1c,
+	0x0001ef1c, 0x0000051c, 0x0001f71c, 0x0001fb1c, 0x0000331c, 0x0002031c, 0x0000341c, 0x00020a1c,
+	0x00020e1c, 0x0000351c, 0x0002161c, 0x00021a1c, 0x0000361c, 0x0002211c, 0x0000371c, 0x0002291c,
+	0x00022d1c, 0x0000381c, 0x0002351c, 0x0000391c, 0x00023d1c, 0x0002401c, 0x00003a1c, 0x0002481c,
+	0x00024c1c, 0x00003b1c, 0x0002541c, 0x0000061c, 0x00025b1c, 0x00025f1c, 0x00003d1c, 0x0002671c,
+	0x00003e1c, 0x00026f1c, 0x0002731c, 0x00003f1c, 0x00027a1c, 0x0000401c, 0x0002821c, 0x0002861c,
+	0x0000411c, 0x00028e1c, 0x0002921c, 0x0000421c, 0x0002991c, 0x0000431c, 0x0002a11c, 0x0002a51c,
+	0x0000441c, 0x0002ad1c, 0x0000451c, 0x0002b41c, 0x0002b81c, 0x0000071c, 0x0002c01c, 0x0002c41c,
+	0x0000471c, 0x0002cc1c, 0x0000481c, 0x0002d31c, 0x0002d71c, 0x0000491c, 0x0002df1c, 0x00004a1c,
+	0x0002e71c, 0x0002eb1c, 0x00004b1c, 0x0002f21c, 0x00004c1c, 0x0002fa1c, 0x0002fe1c, 0x00004d1c,
+	0x0003061c, 0x00030a1c, 0x00004e1c, 0x0003111c, 0x00004f1c, 0x0003191c, 0x00031d1c, 0x0000081c,
+	0x0003251c, 0x0000511c, 0x00032c1c, 0x0003301c, 0x0000521c, 0x0003381c, 0x00033c1c, 0x0000531c,
+	0x0003441c, 0x0000541c, 0x00034b1c, 0x00034f1c, 0x0000551c, 0x0003571c, 0x0000561c, 0x00035f1c,
+	0x0003631c, 0x0000571c, 0x00036a1c, 0x0000581c, 0x0003721c, 0x0003761c, 0x0000591c, 0x00037e1c,
+	0x0003821c, 0x0000091c, 0x0003891c, 0x00005b1c, 0x0003911c, 0x0003951c, 0x00005c1c, 0x00039d1c,
+	0x00005d1c, 0x0003a41c, 0x0003a81c, 0x00005e1c, 0x0003b01c, 0x0003b41c, 0x00005f1c, 0x0003bc1c,
+	0x0000601c, 0x0003c31c, 0x0003c71c, 0x0000611c, 0x0003cf1c, 0x0000621c, 0x0003d71c, 0x0003da1c,
+	0x0000631c, 0x0000011d, 0x0003ee1d, 0x0000651d, 0x0000661d, 0x0000671d, 0x0000681d, 0x0004151d,
+	0x0000691d, 0x00006a1d, 0x00006b1d, 0x0004331d, 0x00006c1d, 0x00006d1d, 0x00000b1d, 0x00006f1d,
+	0x00045a1d, 0x0000701d, 0x0000711d, 0x0000721d, 0x0004791d, 0x0000731d, 0x0000741d, 0x0000751d,
+	0x0004981d, 0x0000761d, 0x0000771d, 0x00000c1d, 0x0000791d, 0x0004bf1d, 0x00007a1d, 0x00007b1d,
+	0x00007c1d, 0x0004de1d, 0x00007d1d, 0x00007e1d, 0x00007f1d, 0x0000801d, 0x0005041d, 0x0000811d,
+	0x00000d1d, 0x0000831d, 0x0005231d, 0x0000841d, 0x0000851d, 0x0000861d, 0x0000871d, 0x00054a1d,
+	0x0000881d, 0x0000891d, 0x00008a1d, 0x0005691d, 0x00008b1d, 0x00000e1d, 0x00008d1d, 0x0005881d,
+	0x00008e1d, 0x00008f1d, 0x0000901d, 0x0000911d, 0x0005af1d, 0x0000921d, 0x0000931d, 0x0000941d,
+	0x0005ce1d, 0x0000951d, 0x00000f1d, 0x0000971d, 0x0000981d, 0x0005f41d, 0x0000991d, 0x00009a1d,
+	0x00009b1d, 0x0006131d, 0x00009c1d, 0x00009d1d, 0x00009e1d, 0x0006321d, 0x00009f1d, 0x0000101d,
+	0x0000a11d, 0x0000a21d, 0x0006591d, 0x0000a31d, 0x0000a41d, 0x0000a51d, 0x0006781d, 0x0000a61d,
+	0x0000a71d, 0x0000a81d, 0x0000a91d, 0x00069e1d, 0x0000111d, 0x0000ab1d, 0x0000ac1d, 0x0006bd1d,
+	0x0000ad1d, 0x0000ae1d, 0x0000af1d, 0x0000b01d, 0x0006e41d, 0x0000b11d, 0x0000b21d, 0x0000b31d,
+	0x0007031d, 0x0000121d, 0x0000b51d, 0x0000b61d, 0x0007221d, 0x0000b71d, 0x0000b81d, 0x0000b91d,
+	0x0000ba1d, 0x0007491d, 0x0000bb1d, 0x0000bc1d, 0x0000bd1d, 0x0007681d, 0x0000131d, 0x0000bf1d,
+	0x0000c01d, 0x0000c11d, 0x00078e1d, 0x0000c21d, 0x0000c31d, 0x0000c41d, 0x0007ad1d, 0x0000c51d,
+	0x0000c61d, 0x0000021d, 0x0000c91d, 0x0000cb1d, 0x0000cc1d, 0x0000ce1d, 0x0000cf1d, 0x0000d11d,
+	0x0000151d, 0x0000d41d, 0x0000d61d, 0x0000d71d, 0x0000d91d, 0x0000da1d, 0x0000161d, 0x0000dd1d,
+	0x0000df1d, 0x0000e01d, 0x0000e21d, 0x0000e31d, 0x0000e51d, 0x0000171d, 0x0000e81d, 0x0000ea1d,
+	0x0000eb1d, 0x0000ed1d, 0x0000ee1d, 0x0000181d, 0x0000f11d, 0x0000f31d, 0x0000f41d, 0x0000f61d,
+	0x0000f81d, 0x0000f91d, 0x0000191d, 0x0000fc1d, 0x0000fe1d, 0x0000ff1d, 0x0001011d, 0x0001021d,
+	0x00001a1d, 0x0001061d, 0x0001071d, 0x0001091d, 0x00010a1d, 0x00010c1d, 0x00001b1d, 0x00010f1d,
+	0x0001101d, 0x0001121d, 0x0001131d, 0x0001151d, 0x0001171d, 0x00001c1d, 0x00011a1d, 0x00011b1d,
+	0x00011d1d, 0x00011e1d, 0x0001201d, 0x00001d1d, 0x0001231d, 0x0001241d, 0x0001261d, 0x0001281d,
+	0x0001291d, 0x00012b1d, 0x0000031d, 0x00012e1d, 0x00012f1d, 0x0001311d, 0x0001321d, 0x0001341d,
+	0x00001f1d, 0x0001371d, 0x0001391d, 0x00013a1d, 0x00013c1d, 0x00013d1d, 0x00013f1d, 0x0000201d,
+	0x0001421d, 0x0001431d, 0x0001451d, 0x0001471d, 0x0001481d, 0x0000211d, 0x00014b1d, 0x00014d1d,
+	0x00014e1d, 0x0001501d, 0x0001511d, 0x0001531d, 0x0000221d, 0x0001561d, 0x0001581d, 0x0001591d,
+	0x00015b1d, 0x00015c1d, 0x0000231d, 0x00015f1d, 0x0001611d, 0x0001621d, 0x0001641d, 0x0001651d,
+	0x0001671d, 0x0000241d, 0x00016a1d, 0x00016c1d, 0x00016d1d, 0x00016f1d, 0x0001701d, 0x0000251d,
+	0x0001731d, 0x0001751d, 0x0001761d, 0x0001781d, 0x00017a1d, 0x00017b1d, 0x0000261d, 0x00017e1d,
+	0x0001801d, 0x0001811d, 0x0001831d, 0x0001841d, 0x0000271d, 0x0001871d, 0x0001891d, 0x00018b1d,
+	0x00018c1d, 0x0000041d, 0x0001921d, 0x0001951d, 0x0000291d, 0x00019c1d, 0x00019f1d, 0x0001a21d,
+	0x00002a1d, 0x0001a81d, 0x0001ab1d, 0x00002b1d, 0x0001b11d, 0x0001b41d, 0x00002c1d, 0x0001bb1d,
+	0x0001be1d, 0x00002d1d, 0x0001c41d, 0x0001c71d, 0x0001ca1d, 0x00002e1d, 0x0001d01d, 0x0001d31d,
+	0x00002f1d, 0x0001da1d, 0x0001dd1d, 0x0000301d, 0x0001e31d, 0x0001e61d, 0x0000311d, 0x0001ec1d,
+	0x0001ef1d, 0x0001f21d, 0x0000051d, 0x0001f81d, 0x0001fc1d, 0x0000331d, 0x0002021d, 0x0002051d,
+	0x0000341d, 0x00020b1d, 0x00020e1d, 0x0000351d, 0x0002141d, 0x0002171d, 0x0000361d, 0x00021e1d,
+	0x0002211d, 0x0002241d, 0x0000371d, 0x00022a1d, 0x00022d1d, 0x0000381d, 0x0002331d, 0x0002361d,
+	0x0000391d, 0x00023d1d, 0x0002401d, 0x00003a1d, 0x0002461d, 0x0002491d, 0x00024c1d, 0x00003b1d,
+	0x0002521d, 0x0002551d, 0x0000061d, 0x00025b1d, 0x00025f1d, 0x00003d1d, 0x0002651d, 0x0002681d,
+	0x00003e1d, 0x00026e1d, 0x0002711d, 0x0002741d, 0x00003f1d, 0x00027a1d, 0x00027e1d, 0x0000401d,
+	0x0002841d, 0x0002871d, 0x0000411d, 0x00028d1d, 0x0002901d, 0x0000421d, 0x0002961d, 0x0002991d,
+	0x0000431d, 0x0002a01d, 0x0002a31d, 0x0002a61d, 0x0000441d, 0x0002ac1d, 0x0002af1d, 0x0000451d,
+	0x0002b51d, 0x0002b81d, 0x0000071d, 0x0002bf1d, 0x0002c21d, 0x0000471d, 0x0002c81d, 0x0002cb1d,
+	0x0002ce1d, 0x0000481d, 0x0002d41d, 0x0002d71d, 0x0000491d, 0x0002dd1d, 0x0002e11d, 0x00004a1d,
+	0x0002e71d, 0x0002ea1d, 0x00004b1d, 0x0002f01d, 0x0002f31d, 0x0002f61d, 0x00004c1d, 0x0002fc1d,
+	0x0003001d, 0x00004d1d, 0x0003061d, 0x0003091d, 0x00004e1d, 0x00030f1d, 0x0003121d, 0x00004f1d,
+	0x0003181d, 0x0000081d, 0x0003251d, 0x0000511d, 0x0000521d, 0x0003371d, 0x0000531d, 0x0003441d,
+	0x0000541d, 0x0000551d, 0x0003561d, 0x0000561d, 0x0003631d, 0x0000571d, 0x0000581d, 0x0003751d,
+	0x0000591d, 0x0000091d, 0x0003881d, 0x00005b1d, 0x0003941d, 0x00005c1d, 0x00005d1d, 0x0003a71d,
+	0x00005e1d, 0x00005f1d, 0x0003b91d, 0x0000601d, 0x0003c61d, 0x0000611d, 0x0000621d, 0x0003d81d,
+	0x0000631d, 0x0003e51d, 0x0000011e, 0x0000651e, 0x0003f71e, 0x0000661e, 0x0000671e, 0x00040a1e,
+	0x0000681e, 0x0004161e, 0x0000691e, 0x00006a1e, 0x0004291e, 0x00006b1e, 0x00006c1e, 0x00043b1e,
+	0x00006d1e, 0x0004481e, 0x00000b1e, 0x00006f1e, 0x00045a1e, 0x0000701e, 0x0004671e, 0x0000711e,
+	0x0000721e, 0x0004791e, 0x0000731e, 0x0000741e, 0x00048c1e, 0x0000751e, 0x0004981e, 0x0000761e,
+	0x0000771e, 0x0004ab1e, 0x00000c1e, 0x0000791e, 0x0004bd1e, 0x00007a1e, 0x0004ca1e, 0x00007b1e,
+	0x00007c1e, 0x0004dc1e, 0x00007d1e, 0x0004e91e, 0x00007e1e, 0x00007f1e, 0x0004fb1e, 0x0000801e,
+	0x0000811e, 0x00050e1e, 0x00000d1e, 0x00051a1e, 0x0000831e, 0x0000841e, 0x00052d1e, 0x0000851e,
+	0x0000861e, 0x00053f1e, 0x0000871e, 0x00054c1e, 0x0000881e, 0x0000891e, 0x00055e1e, 0x00008a1e,
+	0x00056a1e, 0x00008b1e, 0x00000e1e, 0x00057d1e, 0x00008d1e, 0x00008e1e, 0x0005901e, 0x00008f1e,
+	0x00059c1e, 0x0000901e, 0x0000911e, 0x0005af1e, 0x0000921e, 0x0000931e, 0x0005c11e, 0x0000941e,
+	0x0005ce1e, 0x0000951e, 0x00000f1e, 0x0005e01e, 0x0000971e, 0x0005ec1e, 0x0000981e, 0x0000991e,
+	0x0005ff1e, 0x00009a1e, 0x00009b1e, 0x0006121e, 0x00009c1e, 0x00061e1e, 0x00009d1e, 0x00009e1e,
+	0x00009f1e, 0x0000101e, 0x0000a11e, 0x0000a21e, 0x0000a31e, 0x0000a51e, 0x0000a61e, 0x0000a71e,
+	0x0000a81e, 0x0000111e, 0x0000ab1e, 0x0000ac1e, 0x0000ad1e, 0x0000af1e, 0x0000b01e, 0x0000b11e,
+	0x0000b21e, 0x0000121e, 0x0000b51e, 0x0000b61e, 0x0000b71e, 0x0000b81e, 0x0000ba1e, 0x0000bb1e,
+	0x0000bc1e, 0x0000131e, 0x0000bf1e, 0x0000c01e, 0x0000c11e, 0x0000c21e, 0x0000c41e, 0x0000c51e,
+	0x0000c61e, 0x0000c71e, 0x0000021e, 0x0000ca1e, 0x0000cb1e, 0x0000cc1e, 0x0000cd1e, 0x0000cf1e,
+	0x0000d01e, 0x0000d11e, 0x0000151e, 0x0000d41e, 0x0000d51e, 0x0000d61e, 0x0000d71e, 0x0000d91e,
+	0x0000da1e, 0x0000db1e, 0x0000161e, 0x0000de1e, 0x0000df1e, 0x0000e01e, 0x0000e11e, 0x0000e31e,
+	0x0000e41e, 0x0000e51e, 0x0000171e, 0x0000e71e, 0x0000e91e, 0x0000ea1e, 0x0000eb1e, 0x0000ec1e,
+	0x0000ee1e, 0x0000ef1e, 0x0000181e, 0x0000f11e, 0x0000f31e, 0x0000f41e, 0x0000f51e, 0x0000f61e,
+	0x0000f81e, 0x0000f91e, 0x0000191e, 0x0000fb1e, 0x0000fd1e, 0x0000fe1e, 0x0000ff1e, 0x0001001e,
+	0x0001011e, 0x0001031e, 0x00001a1e, 0x0001051e, 0x0001061e, 0x0001081e, 0x0001091e, 0x00010a1e,
+	0x00010b1e, 0x00010d1e, 0x00001b1e, 0x00010f1e, 0x0001101e, 0x0001121e, 0x0001131e, 0x0001141e,
+	0x0001151e, 0x0001171e, 0x00001c1e, 0x0001191e, 0x00011a1e, 0x00011b1e, 0x00011d1e, 0x00011e1e,
+	0x00011f1e, 0x0001201e, 0x00001d1e, 0x0001231e, 0x0001241e, 0x0001251e, 0x0001271e, 0x0001281e,
+	0x0001291e, 0x00012a1e, 0x0000031e, 0x00012d1e, 0x00012e1e, 0x00012f1e, 0x0001311e, 0x0001321e,
+	0x0001331e, 0x0001341e, 0x00001f1e, 0x0001371e, 0x0001381e, 0x0001391e, 0x00013a1e, 0x00013c1e,
+	0x00013d1e, 0x0000201e, 0x0001421e, 0x0001441e, 0x0001471e, 0x0000211e, 0x00014c1e, 0x00014e1e,
+	0x0001511e, 0x0000221e, 0x0001561e, 0x0001581e, 0x00015b1e, 0x0000231e, 0x0001601e, 0x0001621e,
+	0x0001651e, 0x0000241e, 0x0001691e, 0x00016c1e, 0x00016e1e, 0x0000251e, 0x0001731e, 0x0001761e,
+	0x0001781e, 0x0000261e, 0x00017d1e, 0x0001801e, 0x0001821e, 0x0001851e, 0x0000271e, 0x00018a1e,
+	0x00018c1e, 0x00018f1e, 0x0000041e, 0x0001941e, 0x0001961e, 0x0001991e, 0x0000291e, 0x00019d1e,
+	0x0001a01e, 0x0001a21e, 0x00002a1e, 0x0001a71e, 0x0001aa1e, 0x0001ac1e, 0x00002b1e, 0x0001b11e,
+	0x0001b41e, 0x0001b61e, 0x00002c1e, 0x0001bb1e, 0x0001be1e, 0x0001c01e, 0x00002d1e, 0x0001c51e,
+	0x0001c81e, 0x0001ca1e, 0x00002e1e, 0x0001cf1e, 0x0001d11e, 0x0001d41e, 0x00002f1e, 0x0001d91e,
+	0x0001db1e, 0x0001de1e, 0x0000301e, 0x0001e31e, 0x0001e51e, 0x0001e81e, 0x0000311e, 0x0001ed1e,
+	0x0001ef1e, 0x0001f21e, 0x0000051e, 0x0001f71e, 0x0001f91e, 0x0001fc1e, 0x0000331e, 0x0002011e,
+	0x0002031e, 0x0002051e, 0x0000341e, 0x00020a1e, 0x00020d1e, 0x00020f1e, 0x0000351e, 0x0002141e,
+	0x0002171e, 0x0002191e, 0x0000361e, 0x00021e1e, 0x0002211e, 0x0002231e, 0x0000371e, 0x0002281e,
+	0x00022b1e, 0x00022d1e, 0x0000381e, 0x0002321e, 0x0002351e, 0x0002371e, 0x0000391e, 0x00023c1e,
+	0x00023e1e, 0x0002411e, 0x00003a1e, 0x0002461e, 0x0002481e, 0x00024b1e, 0x00003b1e, 0x0002501e,
+	0x0002521e, 0x0002551e, 0x0000061e, 0x00025a1e, 0x00025c1e, 0x00025f1e, 0x00003d1e, 0x0002641e,
+	0x0002661e, 0x0002681e, 0x00003e1e, 0x00026d1e, 0x0002701e, 0x0002721e, 0x00003f1e, 0x0002771e,
+	0x00027a1e, 0x0000401e, 0x0002841e, 0x0000411e, 0x00028e1e, 0x0000421e, 0x0002981e, 0x0000431e,
+	0x0002a11e, 0x0000441e, 0x0002ab1e, 0x0000451e, 0x0002b51e, 0x0000071e, 0x0002bf1e, 0x0000471e,
+	0x0002c91e, 0x0000481e, 0x0002d31e, 0x0000491e, 0x0002dd1e, 0x00004a1e, 0x0002e71e, 0x00004b1e,
+	0x0002f11e, 0x00004c1e, 0x0002fb1e, 0x0003001e, 0x00004d1e, 0x0003091e, 0x00004e1e, 0x0003131e,
+	0x00004f1e, 0x00031d1e, 0x0000081e, 0x0003271e, 0x0000511e, 0x0003311e, 0x0000521e, 0x00033b1e,
+	0x0000531e, 0x0003451e, 0x0000541e, 0x00034f1e, 0x0000551e, 0x0003591e, 0x0000561e, 0x0003631e,
+	0x0000571e, 0x00036c1e, 0x0000581e, 0x0003761e, 0x0000591e, 0x0003801e, 0x0000091e, 0x00038a1e,
+	0x00005b1e, 0x0003941e, 0x00005c1e, 0x00039e1e, 0x00005d1e, 0x0003a81e, 0x00005e1e, 0x0003b21e,
+	0x00005f1e, 0x0003bc1e, 0x0000601e, 0x0003c61e, 0x0000611e, 0x0003cf1e, 0x0000621e, 0x0003d91e,
+	0x0000631e, 0x0003e31e, 0x0000011f, 0x0003ed1f, 0x0000651f, 0x0003f71f, 0x0000661f, 0x0004011f,
+	0x0000671f, 0x00040b1f, 0x0000681f, 0x0004151f, 0x0000691f, 0x00041f1f, 0x00006a1f, 0x0004291f,
+	0x00006b1f, 0x0004331f, 0x00006c1f, 0x00043c1f, 0x00006d1f, 0x0004461f, 0x00000b1f, 0x0004501f,
+	0x00006f1f, 0x00045a1f, 0x0000701f, 0x0004641f, 0x0000711f, 0x00046e1f, 0x0000721f, 0x0004781f,
+	0x0000731f, 0x0004821f, 0x0000741f, 0x00048c1f, 0x0000751f, 0x0004961f, 0x0000761f, 0x00049f1f,
+	0x0000771f, 0x0004a91f, 0x00000c1f, 0x0004b31f, 0x0000791f, 0x0004bd1f, 0x00007a1f, 0x0004c71f,
+	0x00007b1f, 0x0004d11f, 0x00007c1f, 0x0004db1f, 0x00007d1f, 0x0004e51f, 0x00007e1f, 0x0004ef1f,
+	0x00007f1f, 0x0000801f, 0x0000811f, 0x00000d1f, 0x0000831f, 0x0000841f, 0x0000851f, 0x0000861f,
+	0x0000871f, 0x0000881f, 0x0000891f, 0x00008a1f, 0x00008b1f, 0x00000e1f, 0x00008d1f, 0x00008e1f,
+	0x00008f1f, 0x0000901f, 0x0000911f, 0x0000921f, 0x0000931f, 0x0000941f, 0x0000951f, 0x00000f1f,
+	0x0000971f, 0x0000981f, 0x0000991f, 0x0005ff1f, 0x00009a1f, 0x00009b1f, 0x00009c1f, 0x00009d1f,
+	0x00009e1f, 0x00009f1f, 0x0000101f, 0x0000a11f, 0x0000a21f, 0x0000a31f, 0x0000a41f, 0x0000a51f,
+	0x0000a61f, 0x0000a71f, 0x0000a81f, 0x0000a91f, 0x0000111f, 0x0000ab1f, 0x0000ac1f, 0x0000ad1f,
+	0x0000ae1f, 0x0000af1f, 0x0000b01f, 0x0000b11f, 0x0000b21f, 0x0000b31f, 0x0000121f, 0x0000b51f,
+	0x0000b61f, 0x0000b71f, 0x0000b81f, 0x0000b91f, 0x0000ba1f, 0x0000bb1f, 0x0000bc1f, 0x0000bd1f,
+	0x0000131f, 0x0000bf1f, 0x0000c01f, 0x0000c11f, 0x0000c21f, 0x0000c31f, 0x0000c41f, 0x0000c51f,
+	0x0000c61f, 0x0000c71f, 0x0000021f, 0x0000c91f, 0x0000ca1f, 0x0000cb1f, 0x0000cc1f, 0x0000cd1f,
+	0x0000ce1f, 0x0000cf1f, 0x0000d01f, 0x0000d11f, 0x0000151f, 0x0000d31f, 0x0000d41f, 0x0000d51f,
+	0x0000d61f, 0x0000d71f, 0x0000d81f, 0x0000d91f, 0x0000da1f, 0x0000db1f, 0x0000161f, 0x0000dd1f,
+	0x0000de1f, 0x0000df1f, 0x0000e01f, 0x0000e11f, 0x0000e21f, 0x0000e31f, 0x0000e41f, 0x0000e51f,
+	0x0000171f, 0x0000e71f, 0x0000e81f, 0x0000e91f, 0x0000ea1f, 0x0000eb1f, 0x0000ec1f, 0x0000ed1f,
+	0x0000ee1f, 0x0000ef1f, 0x0000181f, 0x0000f11f, 0x0000f21f, 0x0000f31f, 0x0000f41f, 0x0000f51f,
+	0x0000f61f, 0x0000f71f, 0x0000f81f, 0x0000f91f, 0x0000191f, 0x0000fb1f, 0x0000fc1f, 0x0000fd1f,
+	0x0000fe1f, 0x0001001f, 0x0001011f, 0x00001a1f, 0x0001051f, 0x0001071f, 0x0001091f, 0x00010b1f,
+	0x00001b1f, 0x00010f1f, 0x0001111f, 0x0001131f, 0x0001151f, 0x00001c1f, 0x0001191f, 0x00011b1f,
+	0x00011d1f, 0x00011f1f, 0x00001d1f, 0x0001231f, 0x0001251f, 0x0001271f, 0x0001291f, 0x0000031f,
+	0x00012d1f, 0x00012f1f, 0x0001311f, 0x0001331f, 0x0001351f, 0x00001f1f, 0x0001391f, 0x00013b1f,
+	0x00013d1f, 0x00013f1f, 0x0000201f, 0x0001431f, 0x0001451f, 0x0001471f, 0x0001491f, 0x0000211f,
+	0x00014d1f, 0x00014f1f, 0x0001511f, 0x0001531f, 0x0000221f, 0x0001571f, 0x0001591f, 0x00015b1f,
+	0x00015d1f, 0x0000231f, 0x0001611f, 0x0001631f, 0x0001651f, 0x0001671f, 0x0000241f, 0x00016a1f,
+	0x00016c1f, 0x00016e1f, 0x0001701f, 0x0000251f, 0x0001741f, 0x0001761f, 0x0001781f, 0x00017a1f,
+	0x0000261f, 0x00017e1f, 0x0001801f, 0x0001821f, 0x0001841f, 0x0000271f, 0x0001881f, 0x00018a1f,
+	0x00018c1f, 0x00018e1f, 0x0000041f, 0x0001921f, 0x0001941f, 0x0001961f, 0x0001981f, 0x0000291f,
+	0x00019c1f, 0x00019e1f, 0x0001a01f, 0x0001a21f, 0x00002a1f, 0x0001a61f, 0x0001a81f, 0x0001aa1f,
+	0x0001ac1f, 0x00002b1f, 0x0001b01f, 0x0001b21f, 0x0001b41f, 0x0001b61f, 0x00002c1f, 0x0001ba1f,
+	0x0001bc1f, 0x0001be1f, 0x0001c01f, 0x00002d1f, 0x0001c41f, 0x0001c61f, 0x0001c81f, 0x0001ca1f,
+	0x00002e1f, 0x0001ce1f, 0x0001cf1f, 0x0001d11f, 0x0001d31f, 0x00002f1f, 0x0001d71f, 0x0001d91f,
+	0x0001db1f, 0x0001dd1f, 0x0000301f, 0x0001e11f, 0x0001e31f, 0x0001e51f, 0x0001e71f, 0x0000311f,
+	0x0001eb1f, 0x0001ed1f, 0x0001ef1f, 0x0001f11f, 0x0000051f, 0x0001f51f, 0x0001f71f, 0x0001f91f,
+	0x0001fb1f, 0x0000331f, 0x0002031f, 0x0000341f, 0x00020b1f, 0x00020f1f, 0x0000351f, 0x0002171f,
+	0x0000361f, 0x00021f1f, 0x0002231f, 0x0000371f, 0x00022b1f, 0x0000381f, 0x0002331f, 0x0002361f,
+	0x0000391f, 0x00023e1f, 0x00003a1f, 0x0002461f, 0x00024a1f, 0x00003b1f, 0x0002521f, 0x0000061f,
+	0x00025a1f, 0x00025e1f, 0x00003d1f, 0x0002661f, 0x00026a1f, 0x00003e1f, 0x0002721f, 0x00003f1f,
+	0x00027a1f, 0x00027e1f, 0x0000401f, 0x0002861f, 0x0000411f, 0x00028e1f, 0x0002921f, 0x0000421f,
+	0x00029a1f, 0x0000431f, 0x0002a11f, 0x0002a51f, 0x0000441f, 0x0002ad1f, 0x0000451f, 0x0002b51f,
+	0x0002b91f, 0x0000071f, 0x0002c11f, 0x0000471f, 0x0002c91f, 0x0002cd1f, 0x0000481f, 0x0002d51f,
+	0x0000491f, 0x0002dd1f, 0x0002e11f, 0x00004a1f, 0x0002e91f, 0x00004b1f, 0x0002f11f, 0x0002f51f,
+	0x00004c1f, 0x0002fd1f, 0x00004d1f, 0x0003041f, 0x0003081f, 0x00004e1f, 0x0003101f, 0x00004f1f,
+	0x0003181f, 0x00031c1f, 0x0000081f, 0x0003241f, 0x0000511f, 0x00032c1f, 0x0003301f, 0x0000521f,
+	0x0003381f, 0x00033c1f, 0x0000531f, 0x0003441f, 0x0000541f, 0x00034c1f, 0x0003501f, 0x0000551f,
+	0x0003581f, 0x0000561f, 0x0003601f, 0x0003641f, 0x0000571f, 0x00036b1f, 0x0000581f, 0x0003731f,
+	0x0003771f, 0x0000591f, 0x00037f1f, 0x0000091f, 0x0003871f, 0x00038b1f, 0x00005b1f, 0x0003931f,
+	0x00005c1f, 0x00039b1f, 0x00039f1f, 0x00005d1f, 0x0003a71f, 0x00005e1f, 0x0003af1f, 0x0003b31f,
+	0x00005f1f, 0x0003bb1f, 0x0000601f, 0x0003c31f, 0x0003c71f, 0x0000611f, 0x0003cf1f, 0x0000621f,
+	0x0003d61f, 0x0003da1f, 0x0000631f, 0x0003e21f, 0x00000120, 0x0003ea20, 0x0003ee20, 0x00006520,
+	0x0003f620, 0x00006620, 0x00006720, 0x00006820, 0x00041620, 0x00006920, 0x00006a20, 0x00006b20,
+	0x00006c20, 0x00043d20, 0x00006d20, 0x00000b20, 0x00006f20, 0x00007020, 0x00046520, 0x00007120,
+	0x00007220, 0x00007320, 0x00007420, 0x00048d20, 0x00007520, 0x00007620, 0x00007720, 0x00000c20,
+	0x0004b420, 0x00007920, 0x00007a20, 0x00007b20, 0x0004d420, 0x00007c20, 0x00007d20, 0x00007e20,
+	0x00007f20, 0x0004fc20, 0x00008020, 0x00008120, 0x00000d20, 0x00008320, 0x00052320, 0x00008420,
+	0x00008520, 0x00008620, 0x00008720, 0x00054b20, 0x00008820, 0x00008920, 0x00008a20, 0x00008b20,
+	0x00057220, 0x00000e20, 0x00008d20, 0x00008e20, 0x00008f20, 0x00059a20, 0x00009020, 0x00009120,
+	0x00009220, 0x0005ba20, 0x00009320, 0x00009420, 0x00009520, 0x00000f20, 0x0005e120, 0x00009720,
+	0x00009820, 0x00009920, 0x00009a20, 0x00060920, 0x00009b20, 0x00009c20, 0x00009d20, 0x00009e20,
+	0x00063120, 0x00009f20, 0x00001020, 0x0000a120, 0x0000a220, 0x00065820, 0x0000a320, 0x0000a420,
+	0x0000a520, 0x00067820, 0x0000a620, 0x0000a720, 0x0000a820, 0x0000a920, 0x00069f20, 0x00001120,
+	0x0000ab20, 0x0000ac20, 0x0000ad20, 0x0006c720, 0x0000ae20, 0x0000af20, 0x0000b020, 0x0000b120,
+	0x0006ef20, 0x0000b220, 0x0000b320, 0x00001220, 0x0000b520, 0x00071620, 0x0000b620, 0x0000b720,
+	0x0000b820, 0x00073620, 0x0000b920, 0x0000ba20, 0x0000bb20, 0x0000bc20, 0x00075e20, 0x0000bd20,
+	0x00001320, 0x0000bf20, 0x0000c020, 0x00078520, 0x0000c120, 0x0000c220, 0x0000c320, 0x0000c420,
+	0x0007ad20, 0x0000c520, 0x0000c620, 0x0000c720, 0x00000220, 0x0007d420, 0x0000c920, 0x0000ca20,
+	0x0000cb20, 0x0000cc20, 0x0000ce20, 0x0000d020, 0x0000d120, 0x00001520, 0x0000d420, 0x0000d620,
+	0x0000d820, 0x0000d920, 0x0000db20, 0x00001620, 0x0000de20, 0x0000df20, 0x0000e120, 0x0000e320,
+	0x0000e420, 0x00001720, 0x0000e720, 0x0000e920, 0x0000eb20, 0x0000ec20, 0x0000ee20, 0x00001820,
+	0x0000f120, 0x0000f220, 0x0000f420, 0x0000f620, 0x0000f720, 0x0000f920, 0x00001920, 0x0000fc20,
+	0x0000fe20, 0x0000ff20, 0x00010120, 0x00010220, 0x00001a20, 0x00010520, 0x00010720, 0x00010920,
+	0x00010a20, 0x00010c20, 0x00001b20, 0x00010f20, 0x00011120, 0x00011220, 0x00011420, 0x00011520,
+	0x00011720, 0x00001c20, 0x00011a20, 0x00011c20, 0x00011d20, 0x00011f20, 0x00012020, 0x00001d20,
+	0x00012420, 0x00012520, 0x00012720, 0x00012820, 0x00012a20, 0x00000320, 0x00012d20, 0x00012f20,
+	0x00013020, 0x00013220, 0x00013320, 0x00013520, 0x00001f20, 0x00013820, 0x00013a20, 0x00013b20,
+	0x00013d20, 0x00013e20, 0x00002020, 0x00014220, 0x00014320, 0x00014520, 0x00014620, 0x00014820,
+	0x00002120, 0x00014b20, 0x00014d20, 0x00014e20, 0x00015020, 0x00015220, 0x00015320, 0x00002220,
+	0x00015620, 0x00015820, 0x00015920, 0x00015b20, 0x00015d20, 0x00002320, 0x00016020, 0x00016120,
+	0x00016320, 0x00016520, 0x00016620, 0x00002420, 0x00016920, 0x00016b20, 0x00016c20, 0x00016e20,
+	0x00017020, 0x00017120, 0x00002520, 0x00017420, 0x00017620, 0x00017820, 0x00017920, 0x00017b20,
+	0x00002620, 0x00017e20, 0x00017f20, 0x00018120, 0x00018320, 0x00018420, 0x00002720, 0x00018720,
+	0x00018920, 0x00018b20, 0x00018c20, 0x00018e20, 0x00000420, 0x00019120, 0x00019220, 0x00019420,
+	0x00019620, 0x00002920, 0x00019c20, 0x00019f20, 0x0001a220, 0x00002a20, 0x0001a920, 0x0001ac20,
+	0x00002b20, 0x0001b220, 0x0001b520, 0x00002c20, 0x0001bc20, 0x0001bf20, 0x00002d20, 0x0001c520,
+	0x0001c820, 0x00002e20, 0x0001cf20, 0x0001d220, 0x00002f20, 0x0001d820, 0x0001db20, 0x00003020,
+	0x0001e220, 0x0001e520, 0x0001e820, 0x00003120, 0x0001ee20, 0x0001f220, 0x00000520, 0x0001f820,
+	0x0001fb20, 0x00003320, 0x00020120, 0x00020520, 0x00003420, 0x00020b20, 0x00020e20, 0x00003520,
+	0x00021420, 0x00021820, 0x00003620, 0x00021e20, 0x00022120, 0x00022420, 0x00003720, 0x00022b20,
+	0x00022e20, 0x00003820, 0x00023420, 0x00023720, 0x00003920, 0x00023e20, 0x00024120, 0x00003a20,
+	0x00024720, 0x00024a20, 0x00003b20, 0x00025120, 0x00025420, 0x00000620, 0x00025a20, 0x00025d20,
+	0x00003d20, 0x00026420, 0x00026720, 0x00026a20, 0x00003e20, 0x00027020, 0x00027320, 0x00003f20,
+	0x00027a20, 0x00027d20, 0x00004020, 0x00028320, 0x00028720, 0x00004120, 0x00028d20, 0x00029020,
+	0x00004220, 0x00029620, 0x00029a20, 0x00004320, 0x0002a020, 0x0002a320, 0x0002a620, 0x00004420,
+	0x0002ad20, 0x0002b020, 0x00004520, 0x0002b620, 0x0002b920, 0x00000720, 0x0002c020, 0x0002c320,
+	0x00004720, 0x0002c920, 0x0002cc20, 0x00004820, 0x0002d320, 0x0002d620, 0x00004920, 0x0002dc20,
+	0x0002df20, 0x0002e220, 0x00004a20, 0x0002e920, 0x0002ec20, 0x00004b20, 0x0002f220, 0x0002f520,
+	0x00004c20, 0x0002fc20, 0x0002ff20, 0x00004d20, 0x00030520, 0x00030820, 0x00004e20, 0x00030f20,
+	0x00031220, 0x00004f20, 0x00031820, 0x00031b20, 0x00000820, 0x00032220, 0x00032520, 0x00032820,
+	0x00005120, 0x00005220, 0x00033820, 0x00005320, 0x00034520, 0x00005420, 0x00005520, 0x00035820,
+	0x00005620, 0x00005720, 0x00036b20, 0x00005820, 0x00005920, 0x00037e20, 0x00000920, 0x00038a20,
+	0x00005b20, 0x00005c20, 0x00039d20, 0x00005d20, 0x00005e20, 0x0003b020, 0x00005f20, 0x00006020,
+	0x0003c320, 0x00006120, 0x0003d020, 0x00006220, 0x00006320, 0x0003e320, 0x00000121, 0x00006521,
+	0x0003f621, 0x00006621, 0x00040321, 0x00006721, 0x00006821, 0x00041621, 0x00006921, 0x00006a21,
+	0x00042921, 0x00006b21, 0x00006c21, 0x00043c21, 0x00006d21, 0x00044921, 0x00000b21, 0x00006f21,
+	0x00045c21, 0x00007021, 0x00007121, 0x00046f21, 0x00007221, 0x00007321, 0x00048221, 0x00007421,
+	0x00048e21, 0x00007521, 0x00007621, 0x0004a121, 0x00007721, 0x00000c21, 0x0004b421, 0x00007921,
+	0x00007a21, 0x0004c721, 0x00007b21, 0x0004d421, 0x00007c21, 0x00007d21, 0x0004e721, 0x00007e21,
+	0x00007f21, 0x0004fa21, 0x00008021, 0x00050721, 0x00008121, 0x00000d21, 0x00051a21, 0x00008321,
+	0x00008421, 0x00052d21, 0x00008521, 0x00008621, 0x00054021, 0x00008721, 0x00054c21, 0x00008821,
+	0x00008921, 0x00055f21, 0x00008a21, 0x00008b21, 0x00057221, 0x00000e21, 0x00008d21, 0x00058521,
+	0x00008e21, 0x00059221, 0x00008f21, 0x00009021, 0x0005a521, 0x00009121, 0x00009221, 0x0005b821,
+	0x00009321, 0x0005c521, 0x00009421, 0x00009521, 0x0005d821, 0x00000f21, 0x00009721, 0x0005eb21,
+	0x00009821, 0x00009921, 0x0005fe21, 0x00009a21, 0x00060b21, 0x00009b21, 0x00009c21, 0x00061e21,
+	0x00009d21, 0x00009e21, 0x00063121, 0x00009f21, 0x00001021, 0x00064421, 0x0000a121, 0x00065021,
+	0x0000a221, 0x0000a421, 0x0000a521, 0x0000a621, 0x0000a721, 0x0000a921, 0x00001121, 0x0000ab21,
+	0x0000ac21, 0x0000ae21, 0x0000af21, 0x0000b021, 0x0000b121, 0x0000b321, 0x00001221, 0x0000b521,
+	0x0000b721, 0x0000b821, 0x0000b921, 0x0000ba21, 0x0000bc21, 0x0000bd21, 0x00001321, 0x0000bf21,
+	0x0000c121, 0x0000c221, 0x0000c321, 0x0000c421, 0x0000c621, 0x0000c721, 0x00000221, 0x0000ca21,
+	0x0000cb21, 0x0000cc21, 0x0000cd21, 0x0000cf21, 0x0000d021, 0x0000d121, 0x00001521, 0x0000d421,
+	0x0000d521, 0x0000d621, 0x0000d821, 0x0000d921, 0x0000da21, 0x0000db21, 0x00001621, 0x0000de21,
+	0x0000df21, 0x0000e021, 0x0000e221, 0x0000e321, 0x0000e421, 0x00001721, 0x0000e721, 0x0000e821,
+	0x0000e921, 0x0000eb21, 0x0000ec21, 0x0000ed21, 0x0000ee21, 0x00001821, 0x0000f121, 0x0000f221,
+	0x0000f321, 0x0000f521, 0x0000f621, 0x0000f721, 0x0000f821, 0x00001921, 0x0000fb21, 0x0000fc21,
+	0x0000fe21, 0x0000ff21, 0x00010021, 0x00010121, 0x00010321, 0x00001a21, 0x00010521, 0x00010621,
+	0x00010821, 0x00010921, 0x00010a21, 0x00010b21, 0x00010d21, 0x00001b21, 0x00010f21, 0x00011121,
+	0x00011221, 0x00011321, 0x00011421, 0x00011621, 0x00011721, 0x00001c21, 0x00011921, 0x00011b21,
+	0x00011c21, 0x00011d21, 0x00011e21, 0x00012021, 0x00012121, 0x00001d21, 0x00012421, 0x00012521,
+	0x00012621, 0x00012721, 0x00012921, 0x00012a21, 0x00012b21, 0x00000321, 0x00012e21, 0x00012f21,
+	0x00013021, 0x00013221, 0x00013321, 0x00013421, 0x00013521, 0x00001f21, 0x00013821, 0x00013921,
+	0x00013a21, 0x00013c21, 0x00013d21, 0x00013e21, 0x00002021, 0x00014121, 0x00014221, 0x00014321,
+	0x00014521, 0x00014721, 0x00002121, 0x00014c21, 0x00014f21, 0x00015121, 0x00002221, 0x00015621,
+	0x00015921, 0x00015b21, 0x00002321, 0x00016021, 0x00016321, 0x00016521, 0x00002421, 0x00016b21,
+	0x00016d21, 0x00017021, 0x00002521, 0x00017521, 0x00017721, 0x00017a21, 0x00002621, 0x00017f21,
+	0x00018121, 0x00018421, 0x00002721, 0x00018921, 0x00018c21, 0x00018e21, 0x00000421, 0x00019321,
+	0x00019621, 0x00019821, 0x00002921, 0x00019d21, 0x0001a021, 0x0001a221, 0x00002a21, 0x0001a721,
+	0x0001aa21, 0x0001ac21, 0x00002b21, 0x0001b221, 0x0001b421, 0x0001b721, 0x00002c21, 0x0001bc21,
+	0x0001be21, 0x00002d21, 0x0001c321, 0x0001c621, 0x0001c821, 0x00002e21, 0x0001cd21, 0x0001d021,
+	0x0001d221, 0x00002f21, 0x0001d821, 0x0001da21, 0x0001dd21, 0x00003021, 0x0001e221, 0x0001e421,
+	0x0001e721, 0x00003121, 0x0001ec21, 0x0001ee21, 0x0001f121, 0x00000521, 0x0001f621, 0x0001f921,
+	0x0001fb21, 0x00003321, 0x00020021, 0x00020321, 0x00020521, 0x00003421, 0x00020a21, 0x00020d21,
+	0x00020f21, 0x00003521, 0x00021421, 0x00021721, 0x00021921, 0x00003621, 0x00021f21, 0x00022121,
+	0x00022421, 0x00003721, 0x00022921, 0x00022b21, 0x00022e21, 0x00003821, 0x00023321, 0x00023521,
+	0x00023821, 0x00003921, 0x00023d21, 0x00024021, 0x00024221, 0x00003a21, 0x00024721, 0x00024a21,
+	0x00024c21, 0x00003b21, 0x00025121, 0x00025421, 0x00025621, 0x00000621, 0x00025b21, 0x00025e21,
+	0x00026021, 0x00003d21, 0x00026621, 0x00026821, 0x00026b21, 0x00003e21, 0x00027021, 0x00027221,
+	0x00003f21, 0x00027721, 0x00027a21, 0x00027c21, 0x00004021, 0x00028121, 0x00028421, 0x00028721,
+	0x00004121, 0x00028e21, 0x00004221, 0x00029821, 0x00004321, 0x0002a221, 0x00004421, 0x0002ad21,
+	0x00004521, 0x0002b721, 0x00000721, 0x0002c121, 0x00004721, 0x0002cb21, 0x00004821, 0x0002d521,
+	0x00004921, 0x0002df21, 0x00004a21, 0x0002e921, 0x00004b21, 0x0002f421, 0x00004c21, 0x0002fe21,
+	0x00004d21, 0x00030821, 0x00004e21, 0x00031221, 0x00004f21, 0x00031c21, 0x00000821, 0x00032621,
+	0x00005121, 0x00033021, 0x00005221, 0x00033b21, 0x00005321, 0x00034521, 0x00005421, 0x00034f21,
+	0x00005521, 0x00035921, 0x00005621, 0x00036321, 0x00005721, 0x00036d21, 0x00005821, 0x00037721,
+	0x00005921, 0x00000921, 0x00038721, 0x00005b21, 0x00039121, 0x00005c21, 0x00039b21, 0x00005d21,
+	0x0003a521, 0x00005e21, 0x0003af21, 0x00005f21, 0x0003b921, 0x00006021, 0x0003c321, 0x00006121,
+	0x0003ce21, 0x00006221, 0x0003d821, 0x00006321, 0x0003e221, 0x00000122, 0x0003ec22, 0x00006522,
+	0x0003f622, 0x00006622, 0x00040022, 0x00006722, 0x00040a22, 0x00006822, 0x00041522, 0x00006922,
+	0x00041f22, 0x00006a22, 0x00042922, 0x00006b22, 0x00043322, 0x00006c22, 0x00043d22, 0x00006d22,
+	0x00044722, 0x00000b22, 0x00045122, 0x00006f22, 0x00045c22, 0x00007022, 0x00046622, 0x00007122,
+	0x00047022, 0x00007222, 0x00047a22, 0x00007322, 0x00048422, 0x00007422, 0x00048e22, 0x00007522,
+	0x00049822, 0x00007622, 0x0004a322, 0x00007722, 0x0004ad22, 0x00000c22, 0x0004b722, 0x00007922,
+	0x0004c122, 0x00007a22, 0x0004cb22, 0x00007b22, 0x0004d522, 0x00007c22, 0x0004df22, 0x00007d22,
+	0x00007e22, 0x0004ef22, 0x00007f22, 0x0004f922, 0x00008022, 0x00050322, 0x00008122, 0x00050d22,
+	0x00000d22, 0x00008322, 0x00008422, 0x00008522, 0x00008622, 0x00008722, 0x00008822, 0x00008922,
+	0x00008a22, 0x00008b22, 0x00000e22, 0x00008d22, 0x00008e22, 0x00008f22, 0x00009022, 0x00009122,
+	0x00009222, 0x00009322, 0x00009422, 0x00009522, 0x00000f22, 0x00009722, 0x00009822, 0x00009922,
+	0x00009a22, 0x00009b22, 0x00009c22, 0x00009d22, 0x00009e22, 0x00009f22, 0x00001022, 0x0000a122,
+	0x0000a222, 0x0000a322, 0x0000a422, 0x0000a522, 0x0000a622, 0x0000a722, 0x0000a822, 0x0000a922,
+	0x00001122, 0x0000ab22, 0x0000ac22, 0x0000ad22, 0x0000ae22, 0x0000af22, 0x0000b022, 0x0000b122,
+	0x0000b222, 0x00001222, 0x0000b522, 0x0000b622, 0x0000b722, 0x0000b822, 0x0000b922, 0x0000ba22,
+	0x0000bb22, 0x0000bc22, 0x0000bd22, 0x00001322, 0x0000bf22, 0x0000c022, 0x0000c122, 0x0000c222,
+	0x0000c322, 0x0000c422, 0x0000c522, 0x0000c622, 0x0000c722, 0x00000222, 0x0000c922, 0x0000ca22,
+	0x0000cb22, 0x0000cc22, 0x0000cd22, 0x0000ce22, 0x0000cf22, 0x0000d022, 0x0000d122, 0x00001522,
+	0x0000d322, 0x0000d422, 0x0000d522, 0x0000d622, 0x0000d722, 0x0000d822, 0x0000d922, 0x0000da22,
+	0x0000db22, 0x00001622, 0x0000dd22, 0x0000de22, 0x0000df22, 0x0000e022, 0x0000e122, 0x0000e222,
+	0x0000e322, 0x0000e422, 0x0000e522, 0x00001722, 0x0000e722, 0x0000e822, 0x0000e922, 0x0000ea22,
+	0x0000eb22, 0x0000ec22, 0x0000ed22, 0x0000ee22, 0x0000ef22, 0x00001822, 0x0000f122, 0x0000f222,
+	0x0000f322, 0x0000f422, 0x0000f522, 0x0000f622, 0x0000f722, 0x0000f822, 0x0000f922, 0x00001922,
+	0x0000fc22, 0x0000fd22, 0x0000fe22, 0x0000ff22, 0x00010022, 0x00010122, 0x00010222, 0x00010322,
+	0x00001a22, 0x00010622, 0x00010822, 0x00010a22, 0x00010c22, 0x00001b22, 0x00011022, 0x00011222,
+	0x00011422, 0x00011622, 0x00001c22, 0x00011a22, 0x00011c22, 0x00011e22, 0x00012022, 0x00001d22,
+	0x00012422, 0x00012622, 0x00012822, 0x00012a22, 0x00000322, 0x00012e22, 0x00013022, 0x00013222,
+	0x00013422, 0x00001f22, 0x00013822, 0x00013a22, 0x00013c22, 0x00013e22, 0x00002022, 0x00014222,
+	0x00014522, 0x00014722, 0x00014922, 0x00002122, 0x00014d22, 0x00014f22, 0x00015122, 0x00015322,
+	0x00002222, 0x00015722, 0x00015922, 0x00015b22, 0x00015d22, 0x00002322, 0x00016122, 0x00016322,
+	0x00016522, 0x00002422, 0x00016922, 0x00016b22, 0x00016d22, 0x00016f22, 0x00002522, 0x00017322,
+	0x00017522, 0x00017722, 0x00017922, 0x00002622, 0x00017d22, 0x00017f22, 0x00018122, 0x00018322,
+	0x00002722, 0x00018722, 0x00018922, 0x00018c22, 0x00018e22, 0x00000422, 0x00019222, 0x00019422,
+	0x00019622, 0x00019822, 0x00002922, 0x00019c22, 0x00019e22, 0x0001a022, 0x0001a222, 0x00002a22,
+	0x0001a622, 0x0001a822, 0x0001aa22, 0x0001ac22, 0x00002b22, 0x0001b022, 0x0001b222, 0x0001b422,
+	0x0001b622, 0x00002c22, 0x0001ba22, 0x0001bc22, 0x0001be22, 0x0001c022, 0x00002d22, 0x0001c422,
+	0x0001c622, 0x0001c822, 0x0001ca22, 0x00002e22, 0x0001ce22, 0x0001d022, 0x0001d222, 0x0001d522,
+	0x00002f22, 0x0001d922, 0x0001db22, 0x0001dd22, 0x0001df22, 0x00003022, 0x0001e322, 0x0001e522,
+	0x0001e722, 0x0001e922, 0x00003122, 0x0001ed22, 0x0001ef22, 0x0001f122, 0x0001f322, 0x00000522,
+	0x0001f722, 0x0001f922, 0x0001fb22, 0x00003322, 0x0001ff22, 0x00020122, 0x00020322, 0x00020522,
+	0x00003422, 0x00020b22, 0x00020f22, 0x00003522, 0x00021722, 0x00003622, 0x00022022, 0x00022422,
+	0x00003722, 0x00022c22, 0x00003822, 0x00023422, 0x00023822, 0x00003922, 0x00024022, 0x00003a22,
+	0x00024822, 0x00003b22, 0x00025022, 0x00025422, 0x00000622, 0x00025c22, 0x00003d22, 0x00026522,
+	0x00026922, 0x00003e22, 0x00027122, 0x00003f22, 0x00027922, 0x00027d22, 0x00004022, 0x00028522,
+	0x00004122, 0x00028d22, 0x00029122, 0x00004222, 0x00029922, 0x00004322, 0x0002a122, 0x0002a522,
+	0x00004422, 0x0002ae22, 0x00004522, 0x0002b622, 0x0002ba22, 0x00000722, 0x0002c222, 0x00004722,
+	0x0002ca22, 0x00004822, 0x0002d222, 0x0002d622, 0x00004922, 0x0002de22, 0x00004a22, 0x0002e622,
+	0x0002ea22, 0x00004b22, 0x0002f322, 0x00004c22, 0x0002fb22, 0x0002ff22, 0x00004d22, 0x00030722,
+	0x00004e22, 0x00030f22, 0x00031322, 0x00004f22, 0x00031b22, 0x00000822, 0x00032322, 0x00032722,
+	0x00005122, 0x00032f22, 0x00005222, 0x00033722, 0x00033c22, 0x00005322, 0x00034422, 0x00005422,
+	0x00034c22, 0x00035022, 0x00005522, 0x00035822, 0x00005622, 0x00036022, 0x00005722, 0x00036822,
+	0x00036c22, 0x00005822, 0x00037422, 0x00005922, 0x00037c22, 0x00038022, 0x00000922, 0x00038922,
+	0x00005b22, 0x00039122, 0x00039522, 0x00005c22, 0x00039d22, 0x00005d22, 0x0003a522, 0x0003a922,
+	0x00005e22, 0x0003b122, 0x00005f22, 0x0003b922, 0x0003bd22, 0x00006022, 0x0003c522, 0x00006122,
+	0x0003ce22, 0x0003d222, 0x00006222, 0x0003da22, 0x00006322, 0x0003e222, 0x0003e622, 0x00000123,
+	0x0003ee23, 0x00006523, 0x0003f623, 0x00006623, 0x0003fe23, 0x00040223, 0x00006723, 0x00040a23,
+	0x00006823, 0x00006923, 0x00041f23, 0x00006a23, 0x00006b23, 0x00006c23, 0x00006d23, 0x00044723,
+	0x00000b23, 0x00006f23, 0x00007023, 0x00007123, 0x00047023, 0x00007223, 0x00007323, 0x00007423,
+	0x00007523, 0x00007623, 0x0004a023, 0x00007723, 0x00000c23, 0x00007923, 0x00007a23, 0x0004c923,
+	0x00007b23, 0x00007c23, 0x00007d23, 0x00007e23, 0x0004f223, 0x00007f23, 0x00008023, 0x00008123,
+	0x00000d23, 0x00008323, 0x00052223, 0x00008423, 0x00008523, 0x00008623, 0x00008723, 0x00054b23,
+	0x00008823, 0x00008923, 0x00008a23, 0x00008b23, 0x00057323, 0x00000e23, 0x00008d23, 0x00008e23,
+	0x00008f23, 0x00009023, 0x0005a423, 0x00009123, 0x00009223, 0x00009323, 0x00009423, 0x0005cd23,
+	0x00009523, 0x00000f23, 0x00009723, 0x00009823, 0x0005f523, 0x00009923, 0x00009a23, 0x00009b23,
+	0x00009c23, 0x00061e23, 0x00009d23, 0x00009e23, 0x00009f23, 0x00001023, 0x0000a123, 0x00064e23,
+	0x0000a223, 0x0000a323, 0x0000a423, 0x0000a523, 0x00067723, 0x0000a623, 0x0000a723, 0x0000a823,
+	0x0000a923, 0x0006a023, 0x00001123, 0x0000ab23, 0x0000ac23, 0x0000ad23, 0x0000ae23, 0x0006d023,
+	0x0000af23, 0x0000b023, 0x0000b123, 0x0000b223, 0x0006f923, 0x0000b323, 0x00001223, 0x0000b523,
+	0x0000b623, 0x00072123, 0x0000b723, 0x0000b823, 0x0000b923, 0x0000ba23, 0x0000bb23, 0x00075223,
+	0x0000bc23, 0x0000bd23, 0x00001323, 0x0000bf23, 0x00077b23, 0x0000c023, 0x0000c123, 0x0000c223,
+	0x0000c323, 0x0007a323, 0x0000c423, 0x0000c523, 0x0000c623, 0x0000c723, 0x0007cc23, 0x00000223,
+	0x0000c923, 0x0000ca23, 0x0000cb23, 0x0000cc23, 0x0007fc23, 0x0000cd23, 0x0000ce23, 0x0000cf23,
+	0x0000d023, 0x00001523, 0x0000d323, 0x0000d523, 0x0000d623, 0x0000d823, 0x0000d923, 0x0000db23,
+	0x00001623, 0x0000de23, 0x0000e023, 0x0000e223, 0x0000e323, 0x0000e523, 0x00001723, 0x0000e823,
+	0x0000ea23, 0x0000eb23, 0x0000ed23, 0x0000ef23, 0x00001823, 0x0000f223, 0x0000f323, 0x0000f523,
+	0x0000f723, 0x0000f823, 0x00001923, 0x0000fc23, 0x0000fd23, 0x0000ff23, 0x00010023, 0x00010223,
+	0x00001a23, 0x00010523, 0x00010723, 0x00010823, 0x00010a23, 0x00010c23, 0x00001b23, 0x00010f23,
+	0x00011123, 0x00011223, 0x00011423, 0x00011523, 0x00011723, 0x00001c23, 0x00011a23, 0x00011c23,
+	0x00011e23, 0x00011f23, 0x00012123, 0x00001d23, 0x00012423, 0x00012623, 0x00012723, 0x00012923,
+	0x00012b23, 0x00000323, 0x00012e23, 0x00012f23, 0x00013123, 0x00013323, 0x00013423, 0x00001f23,
+	0x00013823, 0x00013923, 0x00013b23, 0x00013c23, 0x00013e23, 0x00002023, 0x00014123, 0x00014323,
+	0x00014523, 0x00014623, 0x00014823, 0x00002123, 0x00014b23, 0x00014d23, 0x00014e23, 0x00015023,
+	0x00015123, 0x00015323, 0x00002223, 0x00015623, 0x00015823, 0x00015a23, 0x00015b23, 0x00015d23,
+	0x00002323, 0x00016023, 0x00016223, 0x00016323, 0x00016523, 0x00016723, 0x00002423, 0x00016a23,
+	0x00016b23, 0x00016d23, 0x00016f23, 0x00017023, 0x00002523, 0x00017423, 0x00017523, 0x00017723,
+	0x00017823, 0x00017a23, 0x00002623, 0x00017d23, 0x00017f23, 0x00018123, 0x00018223, 0x00018423,
+	0x00002723, 0x00018723, 0x00018923, 0x00018a23, 0x00018c23, 0x00018e23, 0x00018f23, 0x00000423,
+	0x00019223, 0x00019423, 0x00019623, 0x00019723, 0x00019923, 0x00002923, 0x00019c23, 0x00019e23,
+	0x00019f23, 0x00002a23, 0x0001a623, 0x0001a923, 0x0001ac23, 0x00002b23, 0x0001b323, 0x0001b623,
+	0x00002c23, 0x0001bd23, 0x0001c023, 0x00002d23, 0x0001c623, 0x0001ca23, 0x00002e23, 0x0001d023,
+	0x0001d323, 0x00002f23, 0x0001da23, 0x0001dd23, 0x00003023, 0x0001e423, 0x0001e723, 0x00003123,
+	0x0001ed23, 0x0001f123, 0x00000523, 0x0001f723, 0x0001fa23, 0x00003323, 0x00020123, 0x00020423,
+	0x00003423, 0x00020a23, 0x00020e23, 0x00003523, 0x00021423, 0x00021723, 0x00003623, 0x00021e23,
+	0x00022123, 0x00003723, 0x00022823, 0x00022b23, 0x00022e23, 0x00003823, 0x00023523, 0x00023823,
+	0x00003923, 0x00023e23, 0x00024223, 0x00003a23, 0x00024823, 0x00024b23, 0x00003b23, 0x00025223,
+	0x00025523, 0x00000623, 0x00025c23, 0x00025f23, 0x00003d23, 0x00026523, 0x00026923, 0x00003e23,
+	0x00026f23, 0x00027223, 0x00003f23, 0x00027923, 0x00027c23, 0x00004023, 0x00028323, 0x00028623,
+	0x00004123, 0x00028c23, 0x00029023, 0x00004223, 0x00029623, 0x00029923, 0x00004323, 0x0002a023,
+	0x0002a323, 0x0002a623, 0x00004423, 0x0002ad23, 0x0002b023, 0x00004523, 0x0002b623, 0x0002ba23,
+	0x00000723, 0x0002c023, 0x0002c323, 0x00004723, 0x0002ca23, 0x0002cd23, 0x00004823, 0x0002d423,
+	0x0002d723, 0x00004923, 0x0002dd23, 0x0002e123, 0x00004a23, 0x0002e723, 0x0002ea23, 0x00004b23,
+	0x0002f123, 0x0002f423, 0x00004c23, 0x0002fb23, 0x0002fe23, 0x00004d23, 0x00030423, 0x00030823,
+	0x00004e23, 0x00030e23, 0x00031123, 0x00004f23, 0x00031823, 0x00031b23, 0x00031e23, 0x00000823,
+	0x00032523, 0x00032823, 0x00005123, 0x00032f23, 0x00033223, 0x00005223, 0x00033823, 0x00033c23,
+	0x00005323, 0x00005423, 0x00034c23, 0x00005523, 0x00035923, 0x00005623, 0x00005723, 0x00036c23,
+	0x00005823, 0x00005923, 0x00038023, 0x00000923, 0x00005b23, 0x00039323, 0x00005c23, 0x00005d23,
+	0x0003a723, 0x00005e23, 0x00005f23, 0x0003ba23, 0x00006023, 0x00006123, 0x0003ce23, 0x00006223,
+	0x0003db23, 0x00006323, 0x00000124, 0x0003ee24, 0x00006524, 0x00006624, 0x00040124, 0x00006724,
+	0x00006824, 0x00041524, 0x00006924, 0x00006a24, 0x00042824, 0x00006b24, 0x00006c24, 0x00043c24,
+	0x00006d24, 0x00000b24, 0x00044f24, 0x00006f24, 0x00045c24, 0x00007024, 0x00007124, 0x00047024,
+	0x00007224, 0x00007324, 0x00048324, 0x00007424, 0x00007524, 0x00049724, 0x00007624, 0x00007724,
+	0x0004aa24, 0x00000c24, 0x00007924, 0x0004be24, 0x00007a24, 0x0004cb24, 0x00007b24, 0x00007c24,
+	0x0004de24, 0x00007d24, 0x00007e24, 0x0004f224, 0x00007f24, 0x00008024, 0x00050524, 0x00008124,
+	0x00000d24, 0x00051924, 0x00008324, 0x00008424, 0x00052c24, 0x00008524, 0x00008624, 0x00054024,
+	0x00008724, 0x00054c24, 0x00008824, 0x00008924, 0x00056024, 0x00008a24, 0x00008b24, 0x00057324,
+	0x00000e24, 0x00008d24, 0x00058724, 0x00008e24, 0x00008f24, 0x00059a24, 0x00009024, 0x00009124,
+	0x0005ae24, 0x00009224, 0x00009324, 0x0005c124, 0x00009424, 0x0005ce24, 0x00009524, 0x00000f24,
+	0x0005e224, 0x00009724, 0x00009824, 0x0005f524, 0x00009924, 0x00009a24, 0x00060924, 0x00009b24,
+	0x00009c24, 0x00061c24, 0x00009d24, 0x00009e24, 0x00063024, 0x00009f24, 0x00063d24, 0x00001024,
+	0x0000a124, 0x00065024, 0x0000a224, 0x0000a324, 0x00066424, 0x0000a424, 0x0000a524, 0x00067724,
+	0x0000a624, 0x0000a724, 0x0000a924, 0x00001124, 0x0000ab24, 0x0000ad24, 0x0000ae24, 0x0000af24,
+	0x0000b124, 0x0000b224, 0x0000b324, 0x00001224, 0x0000b624, 0x0000b724, 0x0000b824, 0x0000ba24,
+	0x0000bb24, 0x0000bc24, 0x00001324, 0x0000bf24, 0x0000c024, 0x0000c124, 0x0000c324, 0x0000c424,
+	0x0000c524, 0x0000c724, 0x00000224, 0x0000c924, 0x0000ca24, 0x0000cc24, 0x0000cd24, 0x0000ce24,
+	0x0000d024, 0x0000d124, 0x00001524, 0x0000d424, 0x0000d524, 0x0000d624, 0x0000d724, 0x0000d924,
+	0x0000da24, 0x00001624, 0x0000dd24, 0x0000de24, 0x0000df24, 0x0000e124, 0x0000e224, 0x0000e324,
+	0x0000e424, 0x00001724, 0x0000e724, 0x0000e824, 0x0000ea24, 0x0000eb24, 0x0000ec24, 0x0000ee24,
+	0x0000ef24, 0x00001824, 0x0000f124, 0x0000f324, 0x0000f424, 0x0000f524, 0x0000f724, 0x0000f824,
+	0x0000f924, 0x00001924, 0x0000fc24, 0x0000fd24, 0x0000fe24, 0x00010024, 0x00010124, 0x00010224,
+	0x00001a24, 0x00010524, 0x00010624, 0x00010824, 0x00010924, 0x00010a24, 0x00010b24, 0x00010d24,
+	0x00001b24, 0x00010f24, 0x00011124, 0x00011224, 0x00011324, 0x00011424, 0x00011624, 0x00011724,
+	0x00001c24, 0x00011a24, 0x00011b24, 0x00011c24, 0x00011e24, 0x00011f24, 0x00012024, 0x00001d24,
+	0x00012324, 0x00012424, 0x00012524, 0x00012724, 0x00012824, 0x00012924, 0x00012b24, 0x00000324,
+	0x00012d24, 0x00012e24, 0x00013024, 0x00013124, 0x00013224, 0x00013424, 0x00013524, 0x00001f24,
+	0x00013824, 0x00013924, 0x00013a24, 0x00013b24, 0x00013d24, 0x00013e24, 0x00013f24, 0x00002024,
+	0x00014224, 0x00014324, 0x00014524, 0x00014624, 0x00014724, 0x00014824, 0x00002124, 0x00014b24,
+	0x00014c24, 0x00014f24, 0x00015124, 0x00002224, 0x00015724, 0x00015924, 0x00015c24, 0x00002324,
+	0x00016124, 0x00016424, 0x00016624, 0x00002424, 0x00016b24, 0x00016e24, 0x00017124, 0x00002524,
+	0x00017624, 0x00017824, 0x00002624, 0x00017e24, 0x00018024, 0x00018324, 0x00002724, 0x00018824,
+	0x00018b24, 0x00018d24, 0x00000424, 0x00019224, 0x00019524, 0x00019824, 0x00002924, 0x00019d24,
+	0x00019f24, 0x0001a224, 0x00002a24, 0x0001a724, 0x0001aa24, 0x0001ac24, 0x00002b24, 0x0001b224,
+	0x0001b424, 0x00002c24, 0x0001b924, 0x0001bc24, 0x0001bf24, 0x00002d24, 0x0001c424, 0x0001c624,
+	0x0001c924, 0x00002e24, 0x0001ce24, 0x0001d124, 0x0001d324, 0x00002f24, 0x0001d824, 0x0001db24,
+	0x0001de24, 0x00003024, 0x0001e324, 0x0001e524, 0x0001e824, 0x00003124, 0x0001ed24, 0x0001f024,
+	0x0001f224, 0x00000524, 0x0001f824, 0x0001fa24, 0x00003324, 0x0001ff24, 0x00020224, 0x00020524,
+	0x00003424, 0x00020a24, 0x00020c24, 0x00020f24, 0x00003524, 0x00021424, 0x00021724, 0x00021924,
+	0x00003624, 0x00021f24, 0x00022124, 0x00022424, 0x00003724, 0x00022924, 0x00022c24, 0x00022e24,
+	0x00003824, 0x00023324, 0x00023624, 0x00023924, 0x00003924, 0x00023e24, 0x00024024, 0x00003a24,
+	0x00024624, 0x00024824, 0x00024b24, 0x00003b24, 0x00025024, 0x00025324, 0x00025524, 0x00000624,
+	0x00025a24, 0x00025d24, 0x00025f24, 0x00003d24, 0x00026524, 0x00026724, 0x00026a24, 0x00003e24,
+	0x00026f24, 0x00027224, 0x00027424, 0x00003f24, 0x00027924, 0x00027c24, 0x00027f24, 0x00004024,
+	0x00028424, 0x00028624, 0x00004124, 0x00028c24, 0x00028e24, 0x00029124, 0x00004224, 0x00029624,
+	0x00029924, 0x00004324, 0x0002a324, 0x00004424, 0x0002ad24, 0x00004524, 0x0002b824, 0x00000724,
+	0x0002c224, 0x00004724, 0x0002cd24, 0x00004824, 0x0002d724, 0x00004924, 0x0002e124, 0x00004a24,
+	0x00004b24, 0x0002f124, 0x00004c24, 0x0002fb24, 0x00004d24, 0x00030624, 0x00004e24, 0x00031024,
+	0x00004f24, 0x00031a24, 0x00000824, 0x00032524, 0x00005124, 0x00032f24, 0x00005224, 0x00033a24,
+	0x00005324, 0x00034424, 0x00005424, 0x00034e24, 0x00005524, 0x00035924, 0x00005624, 0x00036324,
+	0x00005724, 0x00005824, 0x00037324, 0x00005924, 0x00037d24, 0x00000924, 0x00038724, 0x00005b24,
+	0x00039224, 0x00005c24, 0x00039c24, 0x00005d24, 0x0003a724, 0x00005e24, 0x0003b124, 0x00005f24,
+	0x0003bb24, 0x00006024, 0x0003c624, 0x00006124, 0x0003d024, 0x00006224, 0x0003db24, 0x00006324,
+	0x0003e524, 0x00000125, 0x0003ef25, 0x00006525, 0x00006625, 0x0003ff25, 0x00006725, 0x00040925,
+	0x00006825, 0x00041425, 0x00006925, 0x00041e25, 0x00006a25, 0x00042825, 0x00006b25, 0x00043325,
+	0x00006c25, 0x00043d25, 0x00006d25, 0x00044825, 0x00000b25, 0x00045225, 0x00006f25, 0x00045c25,
+	0x00007025, 0x00046725, 0x00007125, 0x00047125, 0x00007225, 0x00007325, 0x00048125, 0x00007425,
+	0x00048b25, 0x00007525, 0x00049525, 0x00007625, 0x0004a025, 0x00007725, 0x0004aa25, 0x00000c25,
+	0x0004b525, 0x00007925, 0x0004bf25, 0x00007a25, 0x0004c925, 0x00007b25, 0x0004d425, 0x00007c25,
+	0x0004de25, 0x00007d25, 0x0004e925, 0x00007e25, 0x0004f325, 0x00007f25, 0x0004fd25, 0x00008025,
+	0x00008125, 0x00050d25, 0x00000d25, 0x00051725, 0x00008325, 0x00052225, 0x00008425, 0x00052c25,
+	0x00008525, 0x00008625, 0x00008725, 0x00008825, 0x00008925, 0x00008a25, 0x00008b25, 0x00000e25,
+	0x00008d25, 0x00008e25, 0x00008f25, 0x00009025, 0x00009125, 0x00009225, 0x00009325, 0x00009425,
+	0x00000f25, 0x00009725, 0x00009825, 0x00009925, 0x00009a25, 0x00009b25, 0x00009c25, 0x00009d25,
+	0x00009e25, 0x00009f25, 0x00001025, 0x0000a125, 0x0000a225, 0x0000a325, 0x0000a425, 0x0000a525,
+	0x0000a625, 0x0000a725, 0x0000a825, 0x0000a925, 0x00001125, 0x0000ab25, 0x0000ac25, 0x0000ad25,
+	0x0000ae25, 0x0000af25, 0x0000b125, 0x0000b225, 0x0000b325, 0x00001225, 0x0000b525, 0x0000b625,
+	0x0000b725, 0x0000b825, 0x0000b925, 0x0000ba25, 0x0000bb25, 0x0000bc25, 0x0000bd25, 0x00001325,
+	0x0000bf25, 0x0000c025, 0x0000c125, 0x0000c225, 0x0000c325, 0x0000c425, 0x0000c525, 0x0000c625,
+	0x0000c725, 0x00000225, 0x0000c925, 0x0000ca25, 0x0000cc25, 0x0000cd25, 0x0000ce25, 0x0000cf25,
+	0x0000d025, 0x0000d125, 0x00001525, 0x0000d325, 0x0000d425, 0x0000d525, 0x0000d625, 0x0000d725,
+	0x0000d825, 0x0000d925, 0x0000da25, 0x0000db25, 0x00001625, 0x0000dd25, 0x0000de25, 0x0000df25,
+	0x0000e025, 0x0000e125, 0x0000e225, 0x0000e325, 0x0000e425, 0x00001725, 0x0000e725, 0x0000e825,
+	0x0000e925, 0x0000ea25, 0x0000eb25, 0x0000ec25, 0x0000ed25, 0x0000ee25, 0x0000ef25, 0x00001825,
+	0x0000f125, 0x0000f225, 0x0000f325, 0x0000f425, 0x0000f525, 0x0000f625, 0x0000f725, 0x0000f825,
+	0x0000f925, 0x00001925, 0x0000fb25, 0x0000fc25, 0x0000fd25, 0x0000fe25, 0x0000ff25, 0x00010025,
+	0x00010225, 0x00010325, 0x00001a25, 0x00010525, 0x00010625, 0x00010725, 0x00010825, 0x00010925,
+	0x00010a25, 0x00010c25, 0x00001b25, 0x00011025, 0x00011225, 0x00011425, 0x00011625, 0x00001c25,
+	0x00011a25, 0x00011d25, 0x00011f25, 0x00012125, 0x00001d25, 0x00012525, 0x00012725, 0x00012925,
+	0x00000325, 0x00012d25, 0x00012f25, 0x00013125, 0x00013325, 0x00001f25, 0x00013825, 0x00013a25,
+	0x00013c25, 0x00013e25, 0x00002025, 0x00014225, 0x00014425, 0x00014625, 0x00014825, 0x00002125,
+	0x00014c25, 0x00014e25, 0x00015025, 0x00015325, 0x00002225, 0x00015725, 0x00015925, 0x00015b25,
+	0x00015d25, 0x00002325, 0x00016125, 0x00016325, 0x00016525, 0x00002425, 0x00016925, 0x00016b25,
+	0x00016e25, 0x00017025, 0x00002525, 0x00017425, 0x00017625, 0x00017825, 0x00017a25, 0x00002625,
+	0x00017e25, 0x00018025, 0x00018225, 0x00018425, 0x00002725, 0x00018925, 0x00018b25, 0x00018d25,
+	0x00018f25, 0x00000425, 0x00019325, 0x00019525, 0x00019725, 0x00002925, 0x00019b25, 0x00019d25,
+	0x00019f25, 0x0001a125, 0x00002a25, 0x0001a625, 0x0001a825, 0x0001aa25, 0x0001ac25, 0x00002b25,
+	0x0001b025, 0x0001b225, 0x0001b425, 0x0001b625, 0x00002c25, 0x0001ba25, 0x0001bc25, 0x0001bf25,
+	0x0001c125, 0x00002d25, 0x0001c525, 0x0001c725, 0x0001c925, 0x00002e25, 0x0001cd25, 0x0001cf25,
+	0x0001d125, 0x0001d325, 0x00002f25, 0x0001d725, 0x0001da25, 0x0001dc25, 0x0001de25, 0x00003025,
+	0x0001e225, 0x0001e425, 0x0001e625, 0x0001e825, 0x00003125, 0x0001ec25, 0x0001ee25, 0x0001f025,
+	0x0001f225, 0x00000525, 0x0001f725, 0x0001f925, 0x0001fb25, 0x0001fd25, 0x00003325, 0x00020125,
+	0x00020325, 0x00020525, 0x00003425, 0x00020925, 0x00020b25, 0x00020d25, 0x00021025, 0x00003525,
+	0x00021425, 0x00021825, 0x00003625, 0x00022025, 0x00003725, 0x00022825, 0x00022d25, 0x00003825,
+	0x00023525, 0x00003925, 0x00023d25, 0x00024125, 0x00003a25, 0x00024a25, 0x00003b25, 0x00025225,
+	0x00000625, 0x00025a25, 0x00025e25, 0x00003d25, 0x00026725, 0x00003e25, 0x00026f25, 0x00027325,
+	0x00003f25, 0x00027c25, 0x00004025, 0x00028425, 0x00004125, 0x00028c25, 0x00029025, 0x00004225,
+	0x00029925, 0x00004325, 0x0002a125, 0x0002a525, 0x00004425, 0x0002ad25, 0x00004525, 0x0002b625,
+	0x0002ba25, 0x00000725, 0x0002c225, 0x00004725, 0x0002ca25, 0x00004825, 0x0002d325, 0x0002d725,
+	0x00004925, 0x0002df25, 0x00004a25, 0x0002e825, 0x0002ec25, 0x00004b25, 0x0002f425, 0x00004c25,
+	0x0002fc25, 0x00004d25, 0x00030525, 0x00030925, 0x00004e25, 0x00031125, 0x00004f25, 0x00031925,
+	0x00031e25, 0x00000825, 0x00032625, 0x00005125, 0x00032e25, 0x00005225, 0x00033625, 0x00033b25,
+	0x00005325, 0x00034325, 0x00005425, 0x00034b25, 0x00034f25, 0x00005525, 0x00035825, 0x00005625,
+	0x00036025, 0x00005725, 0x00036825, 0x00036c25, 0x00005825, 0x00037525, 0x00005925, 0x00037d25,
+	0x00038125, 0x00000925, 0x00038a25, 0x00005b25, 0x00039225, 0x00005c25, 0x00039a25, 0x00039e25,
+	0x00005d25, 0x0003a725, 0x00005e25, 0x0003af25, 0x0003b325, 0x00005f25, 0x0003bb25, 0x00006025,
+	0x0003c425, 0x0003c825, 0x00006125, 0x0003d025, 0x00006225, 0x0003d825, 0x00006325, 0x0003e125,
+	0x0003e525, 0x00000126, 0x0003ed26, 0x00006526, 0x0003f626, 0x0003fa26, 0x00006626, 0x00040226,
+	0x00006726, 0x00040a26, 0x00006826, 0x00041326, 0x00041726, 0x00006926, 0x00041f26, 0x00006a26,
+	0x00042726, 0x00006b26, 0x00006c26, 0x00006d26, 0x00000b26, 0x00045126, 0x00006f26, 0x00007026,
+	0x00007126, 0x00007226, 0x00007326, 0x00048326, 0x00007426, 0x00007526, 0x00007626, 0x00007726,
+	0x00000c26, 0x0004b526, 0x00007926, 0x00007a26, 0x00007b26, 0x00007c26, 0x00007d26, 0x0004e626,
+	0x00007e26, 0x00007f26, 0x00008026, 0x00008126, 0x00000d26, 0x00051826, 0x00008326, 0x00008426,
+	0x00008526, 0x00008626, 0x00054226, 0x00008726, 0x00008826, 0x00008926, 0x00008a26, 0x00008b26,
+	0x00057426, 0x00000e26, 0x00008d26, 0x00008e26, 0x00008f26, 0x00009026, 0x0005a626, 0x00009126,
+	0x00009226, 0x00009326, 0x00009426, 0x00009526, 0x0005d726, 0x00000f26, 0x00009726, 0x00009826,
+	0x00009926, 0x00009a26, 0x00060926, 0x00009b26, 0x00009c26, 0x00009d26, 0x00009e26, 0x00009f26,
+	0x00063b26, 0x00001026, 0x0000a126, 0x0000a226, 0x0000a326, 0x0000a426, 0x00066d26, 0x0000a526,
+	0x0000a626, 0x0000a726, 0x0000a826, 0x0000a926, 0x00069f26, 0x00001126, 0x0000ab26, 0x0000ac26,
+	0x0000ad26, 0x0000ae26, 0x0006d126, 0x0000af26, 0x0000b026, 0x0000b126, 0x0000b226, 0x0000b326,
+	0x00070226, 0x00001226, 0x0000b526, 0x0000b626, 0x0000b726, 0x0000b826, 0x00073426, 0x0000b926,
+	0x0000ba26, 0x0000bb26, 0x0000bc26, 0x00075e26, 0x0000bd26, 0x00001326, 0x0000bf26, 0x0000c026,
+	0x0000c126, 0x00079026, 0x0000c226, 0x0000c326, 0x0000c426, 0x0000c526, 0x0000c626, 0x0007c226,
+	0x0000c726, 0x00000226, 0x0000c926, 0x0000ca26, 0x0000cb26, 0x0007f326, 0x0000cc26, 0x0000cd26,
+	0x0000ce26, 0x0000cf26, 0x0000d026, 0x00082526, 0x0000d126, 0x00001526, 0x0000d326, 0x0000d426,
+	0x0000d526, 0x0000d626, 0x0000d826, 0x0000da26, 0x00001626, 0x0000dd26, 0x0000df26, 0x0000e026,
+	0x0000e226, 0x0000e426, 0x00001726, 0x0000e726, 0x0000e926, 0x0000ea26, 0x0000ec26, 0x0000ee26,
+	0x00001826, 0x0000f126, 0x0000f326, 0x0000f426, 0x0000f626, 0x0000f826, 0x00001926, 0x0000fb26,
+	0x0000fd26, 0x0000fe26, 0x00010026, 0x00010226, 0x00001a26, 0x00010526, 0x00010726, 0x00010826,
+	0x00010a26, 0x00010c26, 0x00010d26, 0x00001b26, 0x00011026, 0x00011226, 0x00011426, 0x00011526,
+	0x00011726, 0x00001c26, 0x00011a26, 0x00011c26, 0x00011e26, 0x00011f26, 0x00012126, 0x00001d26,
+	0x00012426, 0x00012626, 0x00012826, 0x00012926, 0x00012b26, 0x00000326, 0x00012e26, 0x00013026,
+	0x00013226, 0x00013326, 0x00013526, 0x00001f26, 0x00013826, 0x00013a26, 0x00013c26, 0x00013d26,
+	0x00013f26, 0x00002026, 0x00014226, 0x00014426, 0x00014626, 0x00014726, 0x00014926, 0x00002126,
+	0x00014c26, 0x00014e26, 0x00015026, 0x00015126, 0x00015326, 0x00002226, 0x00015626, 0x00015826,
+	0x00015a26, 0x00015b26, 0x00015d26, 0x00002326, 0x00016026, 0x00016226, 0x00016426, 0x00016526,
+	0x00016726, 0x00002426, 0x00016a26, 0x00016c26, 0x00016e26, 0x00016f26, 0x00017126, 0x00002526,
+	0x00017426, 0x00017626, 0x00017826, 0x00017926, 0x00017b26, 0x00002626, 0x00017e26, 0x00018026,
+	0x00018126, 0x00018326, 0x00018526, 0x00002726, 0x00018826, 0x00018a26, 0x00018b26, 0x00018d26,
+	0x00018f26, 0x00000426, 0x00019226, 0x00019426, 0x00019526, 0x00019726, 0x00019926, 0x00002926,
+	0x00019c26, 0x00019e26, 0x00019f26, 0x0001a126, 0x0001a326, 0x00002a26, 0x0001a626, 0x0001a826,
+	0x0001a926, 0x00002b26, 0x0001b026, 0x0001b326, 0x00002c26, 0x0001ba26, 0x0001bd26, 0x00002d26,
+	0x0001c426, 0x0001c726, 0x00002e26, 0x0001ce26, 0x0001d126, 0x00002f26, 0x0001d826, 0x0001db26,
+	0x00003026, 0x0001e226, 0x0001e526, 0x00003126, 0x0001ec26, 0x0001ef26, 0x00000526, 0x0001f626,
+	0x0001f926, 0x00003326, 0x00020026, 0x00020326, 0x00003426, 0x00020a26, 0x00020d26, 0x00003526,
+	0x00021426, 0x00021726, 0x00021a26, 0x00003626, 0x00022126, 0x00022426, 0x00003726, 0x00022b26,
+	0x00022e26, 0x00003826, 0x00023526, 0x00023826, 0x00003926, 0x00023f26, 0x00024226, 0x00003a26,
+	0x00024926, 0x00024c26, 0x00003b26, 0x00025326, 0x00025626, 0x00000626, 0x00025d26, 0x00026026,
+	0x00003d26, 0x00026726, 0x00026a26, 0x00003e26, 0x00027126, 0x00027426, 0x00003f26, 0x00027b26,
+	0x00027e26, 0x00004026, 0x00028526, 0x00028826, 0x00004126, 0x00028f26, 0x00029226, 0x00004226,
+	0x00029926, 0x00029c26, 0x00004326, 0x0002a326, 0x0002a626, 0x00004426, 0x0002ad26, 0x0002b026,
+	0x00004526, 0x0002b726, 0x0002ba26, 0x00000726, 0x0002c026, 0x0002c426, 0x00004726, 0x0002ca26,
+	0x0002ce26, 0x00004826, 0x0002d426, 0x0002d826, 0x00004926, 0x0002de26, 0x0002e226, 0x00004a26,
+	0x0002e826, 0x0002ec26, 0x00004b26, 0x0002f226, 0x0002f626, 0x00004c26, 0x0002fc26, 0x00030026,
+	0x00004d26, 0x00030626, 0x00030a26, 0x00004e26, 0x00031026, 0x00031426, 0x00004f26, 0x00031a26,
+	0x00031e26, 0x00000826, 0x00032426, 0x00032826, 0x00005126, 0x00032e26, 0x00033126, 0x00005226,
+	0x00033826, 0x00033b26, 0x00005326, 0x00034226, 0x00034526, 0x00005426, 0x00034c26, 0x00034f26,
+	0x00005526, 0x00005626, 0x00036026, 0x00005726, 0x00005826, 0x00037426, 0x00005926, 0x00000926,
+	0x00038826, 0x00005b26, 0x00005c26, 0x00039c26, 0x00005d26, 0x00005e26, 0x0003b026, 0x00005f26,
+	0x00006026, 0x0003c426, 0x00006126, 0x00006226, 0x0003d826, 0x00006326, 0x00000127, 0x0003ec27,
+	0x00006527, 0x00006627, 0x00040027, 0x00006727, 0x00006827, 0x00041327, 0x00006927, 0x00006a27,
+	0x00042727, 0x00006b27, 0x00043527, 0x00006c27, 0x00006d27, 0x00044927, 0x00000b27, 0x00006f27,
+	0x00045d27, 0x00007027, 0x00007127, 0x00047027, 0x00007227, 0x00007327, 0x00048427, 0x00007427,
+	0x00007527, 0x00049827, 0x00007627, 0x00007727, 0x0004ac27, 0x00000c27, 0x00007927, 0x0004c027,
+	0x00007a27, 0x00007b27, 0x0004d427, 0x00007c27, 0x00007d27, 0x0004e827, 0x00007e27, 0x00007f27,
+	0x0004fc27, 0x00008027, 0x00008127, 0x00051027, 0x00000d27, 0x00008327, 0x00052427, 0x00008427,
+	0x00008527, 0x00053827, 0x00008627, 0x00008727, 0x00054c27, 0x00008827, 0x00008927, 0x00056027,
+	0x00008a27, 0x00008b27, 0x00057427, 0x00000e27, 0x00008d27, 0x00058827, 0x00008e27, 0x00008f27,
+	0x00059c27, 0x00009027, 0x00009127, 0x0005b027, 0x00009227, 0x00009327, 0x0005c327, 0x00009427,
+	0x00009527, 0x0005d727, 0x00000f27, 0x00009727, 0x0005eb27, 0x00009827, 0x00009927, 0x0005ff27,
+	0x00009a27, 0x00009b27, 0x00061327, 0x00009c27, 0x00009d27, 0x00062727, 0x00009e27, 0x00009f27,
+	0x00063b27, 0x00001027, 0x0000a127, 0x00064f27, 0x0000a227, 0x0000a327, 0x00066327, 0x0000a427,
+	0x0000a527, 0x00067727, 0x0000a627, 0x0000a727, 0x00068b27, 0x0000a827, 0x0000a927, 0x00069f27,
+	0x00001127, 0x0000ab27, 0x0000ad27, 0x0000ae27, 0x0000af27, 0x0000b127, 0x0000b227, 0x00001227,
+	0x0000b527, 0x0000b627, 0x0000b727, 0x0000b927, 0x0000ba27, 0x0000bb27, 0x0000bd27, 0x00001327,
+	0x0000bf27, 0x0000c127, 0x0000c227, 0x0000c327, 0x0000c527, 0x0000c627, 0x00000227, 0x0000c927,
+	0x0000ca27, 0x0000cb27, 0x0000cd27, 0x0000ce27, 0x0000cf27, 0x0000d127, 0x00001527, 0x0000d327,
+	0x0000d527, 0x0000d627, 0x0000d727, 0x0000d927, 0x0000da27, 0x0000db27, 0x00001627, 0x0000de27,
+	0x0000df27, 0x0000e127, 0x0000e227, 0x0000e327, 0x0000e527, 0x00001727, 0x0000e727, 0x0000e927,
+	0x0000ea27, 0x0000eb27, 0x0000ed27, 0x0000ee27, 0x0000ef27, 0x00001827, 0x0000f227, 0x0000f327,
+	0x0000f527, 0x0000f627, 0x0000f727, 0x0000f927, 0x00001927, 0x0000fb27, 0x0000fd27, 0x0000fe27,
+	0x0000ff27, 0x00010127, 0x00010227, 0x00010327, 0x00001a27, 0x00010627, 0x00010727, 0x00010927,
+	0x00010a27, 0x00010b27, 0x00010d27, 0x00001b27, 0x00010f27, 0x00011027, 0x00011227, 0x00011327,
+	0x00011427, 0x00011627, 0x00011727, 0x00001c27, 0x00011a27, 0x00011b27, 0x00011c27, 0x00011e27,
+	0x00011f27, 0x00012027, 0x00001d27, 0x00012327, 0x00012427, 0x00012627, 0x00012727, 0x00012827,
+	0x00012a27, 0x00012b27, 0x00000327, 0x00012e27, 0x00012f27, 0x00013027, 0x00013227, 0x00013327,
+	0x00013427, 0x00001f27, 0x00013727, 0x00013827, 0x00013a27, 0x00013b27, 0x00013c27, 0x00013e27,
+	0x00013f27, 0x00002027, 0x00014227, 0x00014327, 0x00014427, 0x00014627, 0x00014727, 0x00014827,
+	0x00002127, 0x00014b27, 0x00014c27, 0x00014e27, 0x00014f27, 0x00015027, 0x00015227, 0x00015327,
+};
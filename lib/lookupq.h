@@ -0,0 +1,356 @@
+#define LOOKUPQ_TABLE_LEN (sizeof(lookupq_table) / sizeof(struct pow256_t))
+#define LOOKUPQ_TABLE_MIN (-4896)
+#define LOOKUPQ_TABLE_STEP 32
+static const struct pow256_t lookupq_table[] = {
+	{ { 0xf0c25fe1b57f0502, 0x711c6b626c46bd89, 0x29608b2d0accdac3, 0xe5224aa15f397d98 }, -16520 },
+	{ { 0xdc628f87c4589f17, 0x2bfb20990dedb270, 0xac63454249b771c8, 0x8d36f6971766349c }, -16413 },
+	{ { 0x5e6520fe462e57a0, 0xef6fa39d44ec7c03, 0x7aeb29f92abeb4ca, 0xae0f80a2a8960b10 }, -16307 },
+	{ { 0x53b2a5bf9b61e838, 0x6b6ff5a002416e72, 0x326cb526b3747638, 0xd68bd3c92066a797 }, -16201 },
+	{ { 0xdc5ed8e29765b084, 0x479ecc43d5cb00ce, 0xfe110a64e32dd81b, 0x84396c05c0eebc9d }, -16094 },
+	{ { 0x0a1b8776e70cec81, 0x4c2692ffb4103a61, 0xc62364c260a887e2, 0xa2faa242a3bd093c }, -15988 },
+	{ { 0xe4b75ae27bec50bf, 0x25b0419765fdfcdb, 0x0915564d8ab057ee, 0xc8e31de056f89c19 }, -15882 },
+	{ { 0x3ff4fd8f537a8334, 0xa4fbd971b7335438, 0xa6246cc005e1b086, 0xf79cd0bc0a9865e1 }, -15776 },
+	{ { 0xfe54015f47f53413, 0x8d631bd52c704336, 0x4574b3f93355188b, 0x989a5fa7953007a7 }, -15669 },
+	{ { 0x49245cf985eea6b7, 0x4a0ad081b987938a, 0x41a8bcd577f7a7d8, 0xbc1905f3e898cca2 }, -15563 },
+	{ { 0x12bd93ac7c7d70ee, 0x445a492626c350c5, 0x62eae6f47049fc2f, 0xe7d92f014768e772 }, -15457 },
+	{ { 0x722fa8210ca7121a, 0xc17503760879f1d7, 0x62648d93cdf05ba2, 0x8ee3393b07698e29 }, -15350 },
+	{ { 0xea86191e93ffb5a8, 0x5bfa3f9e0731f955, 0x78e2aad3ddd1e309, 0xb01f5fc35203ed1b }, -15244 },
+	{ { 0xdadd9645f360cb51, 0xf290163350ecb3eb, 0xa8edffdccfe4db4b, 0xd9167ab0c1965798 }, -15138 },
+	{ { 0xbea63da71da9a264, 0x646def3e1b8dbce5, 0xdcf0fb000a652614, 0x85ca6acd9d3e7daf }, -15031 },
+	{ { 0xd8ebff5fba5462de, 0x890f060f9004cede, 0xd49596808f0f2914, 0xa4e8e60beec08b8f }, -14925 },
+	{ { 0xe81189ae24fdce12, 0x6489536309952135, 0xec6ec617f2819a18, 0xcb44585821c722ec }, -14819 },
+	{ { 0x5d108da0223a3d5f, 0x842dc41b89ca32c7, 0x31c0368ccb2c5757, 0xfa8bbf517f29408a }, -14713 },
+	{ { 0x37453b30f32b97a6, 0xbb9eff7a25c44471, 0x8389c148c919653a, 0x9a692bd43b368fc3 }, -14606 },
+	{ { 0x0276eb2becf6ace2, 0x57b5b173d643f3d4, 0x6c682809ba47ff0e, 0xbe53771cc8f1b8bb }, -14500 },
+	{ { 0xb93897a6cf5d3e61, 0x18746fcc6a190db9, 0x66e849253e5da0c2, 0xea984ec57de69f13 }, -14394 },
+	{ { 0xa61fb09d649d06b3, 0x9e48b99391902b00, 0xd6960685c12cd7c1, 0x90948ea6c52e5802 }, -14287 },
+	{ { 0xcaede25913c85be4, 0x02d3da4742419c16, 0xaead36c237cbf749, 0xb2357fc2d76029b7 }, -14181 },
+	{ { 0x83bc371bf0dc6ae5, 0x39c70812ffdfd468, 0xf0fc278b7f968212, 0xdba8d6d20f6b5894 }, -14075 },
+	{ { 0xf42790dcab88cf3b, 0x38bbb32aa29cba1b, 0x54aca7f5709cb082, 0x876029ad8859b2fd }, -13968 },
+	{ { 0x5e2d7403972f6f2b, 0x20305d0244e091ba, 0x2de38123a1c3cffc, 0xa6dd04c8d2ce9fde }, -13862 },
+	{ { 0x8b679443a95c3a4c, 0xd464c19aa11439b1, 0x96eda1512f2fc323, 0xcdacca69a2d4c45a }, -13756 },
+	{ { 0x9eb9296cc5749dba, 0x48324e275376dfdd, 0x5052e9289f0f2333, 0xfd83933eda772c0b }, -13650 },
+	{ { 0x699bc7e3ea459020, 0xf95dc6f12034f381, 0x24b99688d11e41bc, 0x9c3d73864f3805c0 }, -13543 },
+	{ { 0xa6453f6b1f6a06f3, 0x30a0ea226e12164b, 0x1a096fc7358788c3, 0xc094aa3eddb202e4 }, -13437 },
+	{ { 0xcfc678cd6ac0eae4, 0xc28ee543e6934d15, 0xba641fe889dfd27b, 0xed5fc2e513417a2f }, -13331 },
+	{ { 0xf3017365ac5c688a, 0xbf3f2e0ffc99e3cb, 0x1436a2dad831490d, 0x924b063d1ceb45b3 }, -13224 },
+	{ { 0xe9508409fc5a1c42, 0xed3ebb135bb7a7fd, 0x73e14bc8e5edd724, 0xb451f3982a13e433 }, -13118 },
+	{ { 0x825b397e11354a97, 0xb171e37a76c65371, 0x1463ef488d5226cb, 0xde42ff8d37cad87f }, -13012 },
+	{ { 0x0bdc0c67a220687b, 0x44a66a6d6fd6537b, 0x3f1f93f1943ca9b6, 0x88fab70d8b44952a }, -12905 },
+	{ { 0x76485e859b9221af, 0x7fc103fc5525486d, 0x2409ac6534c33030, 0xa8d7103b2a9fddbf }, -12799 },
+	{ { 0xbfd0636fd593ef91, 0x43ef9da83aa68800, 0x437abd5769e5212f, 0xd01c89f80cd9e07e }, -12693 },
+	{ { 0xeae08f8e91d839c1, 0xfa0c3128067e32ad, 0x752cd52fafaf4af1, 0x804233bf4b0b191c }, -12586 },
+	{ { 0x3ee4d85a1eca149b, 0xf67e17045a0cf99b, 0x759a4eadddc5db0c, 0x9e17475e42d0bfac }, -12480 },
+	{ { 0x9d2480e6a30373b8, 0x80d0a82031a0123f, 0x75af8412a0d013fc, 0xc2dcb3d89fb0f90e }, -12374 },
+	{ { 0x0292ed6bd0baa9ff, 0x815f276911639e7b, 0x7f437695d5ccdbe0, 0xf02fa4a2ce256606 }, -12268 },
+	{ { 0x982b64e953ac4e27, 0x45efb05f20cf48b3, 0x4b4de34e0ebc3e06, 0x9406af8f83fd6265 }, -12161 },
+	{ { 0xa9b9ab6fa1b1a3d9, 0x0f0fb1c7b2581a51, 0x4fe1e9b0fcdf7b3d, 0xb674ce73bf10ea47 }, -12055 },
+	{ { 0x6ddd26ef279b0d05, 0x294d82f85639fb9c, 0x81884dd8cb5eb34a, 0xe0e50c894cc21dfd }, -11949 },
+	{ { 0x6919335498fefe0d, 0x9a78f9dc1f575daf, 0x576c105a49a6f1ad, 0x8a9a21815fad9d9c }, -11842 },
+	{ { 0x980aa8fad888f870, 0x6ad4b3205eb000af, 0x5086fdecf2f641c6, 0xaad71a5aab16dc6c }, -11736 },
+	{ { 0x7ae6487fcb3d852e, 0xf62ee38148951dcc, 0x09cd28999c147c35, 0xd293ad28f3512f42 }, -11630 },
+	{ { 0x3ba001e967ee3c08, 0x6546f97a4c6298ce, 0x5e580222f2f811ae, 0x81c72bae7e65dad8 }, -11523 },
+	{ { 0x06789d038697142f, 0x7a466a75be73db21, 0x60dbd8aa443b560f, 0x9ff6b82ef415d222 }, -11417 },
+	{ { 0x1c0b623f2299cb95, 0xa42303e570b87e7f, 0x9e98cb984f0d3050, 0xc52ba8a6aeb15d92 }, -11311 },
+	{ { 0x802577908bdb89df, 0x0f34cea9a11a2970, 0x71e6a2e9bbbf5a4b, 0xf3080d8e10f7553f }, -11205 },
+	{ { 0x82bfc54641b7630f, 0xa0d0f971c37719e7, 0x3615915d6df7666f, 0x95c79a5ea669fe86 }, -11098 },
+	{ { 0x7fb5407edd361c0c, 0xf9e0da6255cdd977, 0xf4d741c050aaa631, 0xb89e23c03d3d9b7f }, -10992 },
+	{ { 0xed2504513092b5cd, 0x3b735f721430e99d, 0x31ea85e808deba7f, 0xe38f15b51b8440f7 }, -10886 },
+	{ { 0x7a1e0fcf55c35512, 0xbbc5732f8acee6ac, 0x7fef20156b676076, 0x8c3e77c8f46d23bf }, -10779 },
+	{ { 0x6b9d538c192cfb1b, 0x1c5af3bd4d2c60b5, 0xec41c1793d69d0d1, 0xacdd3555869159d1 }, -10673 },
+	{ { 0x2d656e8f280399fa, 0x5624493713d5e9b7, 0x4a1ccb32d5c21bf6, 0xd5124a6513c582c0 }, -10567 },
+	{ { 0xf81e8a916ca9106b, 0xe8a94db92ca5841f, 0xe79e236bf8bf47a8, 0x8350bf3c91575a87 }, -10460 },
+	{ { 0x7a6969ce5da52887, 0xe798899f46500cca, 0xbde5e7aab8410244, 0xa1dbd6fe468072a2 }, -10354 },
+	{ { 0xf8487e84cc0cb08c, 0x961cd07660c85d2f, 0x4e6570cd8536b61f, 0xc7819da48dde4790 }, -10248 },
+	{ { 0xe2dcd20938c8c2d6, 0xa447d2c248554843, 0x7087cecf10e2b5a5, 0xf5e91783c229830c }, -10142 },
+	{ { 0xb619c2e78d128abc, 0xfdbcb2ba98abab84, 0xe1e20cfd1289138c, 0x978dd69af60dc360 }, -10035 },
+	{ { 0x887dede507f2b618, 0x359a8fa0d014b9a7, 0x7c4c65d15c614c56, 0xbace07232df1c802 }, -9929 },
+	{ { 0x12bc6fe717ccf422, 0x8ee58fdc35fd6c67, 0xdb67cf7bbbac365a, 0xe641334805f3e36f }, -9823 },
+	{ { 0xe291f6ceef29272e, 0xb5c3206a72838925, 0x071d3350ff673295, 0x8de7c8d0f396cdf1 }, -9716 },
+	{ { 0xf73aec8b34d883c2, 0xb7d1f78b317fae11, 0xe3187c34500d9ab3, 0xaee973911228abca }, -9610 },
+	{ { 0xdb55d41b693e51ee, 0xc5de035910b89a52, 0xd94d2137a3a6f4f4, 0xd798785921820787 }, -9504 },
+	{ { 0x221ae8bf1986af23, 0xd121690c160997ac, 0x67ac7c1d9ccd8266, 0x84defc62f01c45b0 }, -9397 },
+	{ { 0x91aa958fcbf8114c, 0x2ae0a362438df8af, 0x52d9655bdf62f25c, 0xa3c6b505bda91bcc }, -9291 },
+	{ { 0x42032f9f971bfc07, 0x9fb576046ab35018, 0x474b3cb1fe1d6a7f, 0xc9dea80d6283a34c }, -9185 },
+	{ { 0x946e2f2071475aca, 0x50d3e92e2e4f8210, 0x9492db3d978aaca8, 0xf8d2dcaf37504b51 }, -9079 },
+	{ { 0xed7c65abc6b00b8a, 0x5cbd0ea3f3b06e00, 0x212da7006dc4e43b, 0x995974653b7e0231 }, -8972 },
+	{ { 0x1399ae170536e36b, 0x71e3ef6c20696a76, 0x9736b4514993e0ba, 0xbd048c7daf8acadb }, -8866 },
+	{ { 0x49ce2be1d65f0a25, 0x5ad05b84c7c4be7d, 0x598eec7d41754c09, 0xe8fb7dc2dec0a404 }, -8760 },
+	{ { 0x1af60d40f4a56933, 0x886901bc29574cc8, 0x8ce3c290df62726a, 0x8f9623b34a2198af }, -8653 },
+	{ { 0xbf9536f5cf4202a0, 0x217b35d5cf1d588a, 0xf73cbde9febc8fce, 0xb0fbe7aa6ce75997 }, -8547 },
+	{ { 0xa0f076652f69ad08, 0x9d19c341f5f42f2a, 0x742ab8f3864562c8, 0xda264df693ac3e30 }, -8441 },
+	{ { 0x5a01dfc3ce5de7a5, 0x860aab5af5540cca, 0x138204ea625927f7, 0x8671f14568278bea }, -8334 },
+	{ { 0x900a50db8a9343d8, 0x640c845b2afc2b47, 0x0a0f429d93058121, 0xa5b763b319d7f1dc }, -8228 },
+	{ { 0x5ef1eebff7941925, 0x47ea18be2f96d249, 0x1d8106ccf8ee85b4, 0xcc42dd5cb5091819 }, -8122 },
+	{ { 0x2bfa89e99690397e, 0x91e46480554bb648, 0x3781bf4a97122fbc, 0xfbc5778b22fff09b }, -8016 },
+	{ { 0xe752a5fb23fc74c4, 0x660bdfd108ba7989, 0xe393a9c032fb0c34, 0x9b2a840f28a1638f }, -7909 },
+	{ { 0x025177c9c50e64dc, 0xfef1284b77763e05, 0x65de36dc36a40a10, 0xbf41c7ed2a1d370b }, -7803 },
+	{ { 0xe8c5f5a63fd0fbd1, 0x0ccc12293f1d7a58, 0x131565be33dda91a, 0xebbe0df0c8201ac5 }, -7697 },
+	{ { 0x9517af8a79e456d7, 0x5524d2ad7f16bb08, 0xd902ef9ea5baf811, 0x914997b7b12b451c }, -7590 },
+	{ { 0x8e428200409793db, 0xeed30cce7c442265, 0x9063016130392df7, 0xb314a47728f9cd6c }, -7484 },
+	{ { 0xffe1aa505617bb66, 0x4c301eefc58cd34a, 0xd18f7aece789392b, 0xdcbbe27475ceff9c }, -7378 },
+	{ { 0xb226de162a880b07, 0xbb3cdbb623256638, 0xbae63e54a2044ddd, 0x8809ac32a8a8a8ed }, -7271 },
+	{ { 0xe807eec244c52c93, 0x0ab478814180685d, 0x205c4faf4edd7b60, 0xa7adf4a8f66ff68e }, -7165 },
+	{ { 0x71aad59046c74249, 0x8263ca5cbc774bd9, 0x492512d4f2ead2cb, 0xceae534f34362de4 }, -7059 },
+	{ { 0x9589f4637a50cbb5, 0xea8242b0030e4a51, 0x6c656c3b1f2c9d91, 0xfec102e2857bc1f9 }, -6953 },
+	{ { 0x09bd1946fa3ceaac, 0xe67e4dcd407bd3ee, 0x699b5f371124cf4f, 0x9d01161bed052bb7 }, -6846 },
+	{ { 0x1f9af19037ddd8fc, 0x33377f3919795592, 0x50e167ba79e975e1, 0xc185cdcc064a81ba }, -6740 },
+	{ { 0xdf6332a738ad39cd, 0x50a8dc181a6ae467, 0xbfe3c33c58668242, 0xee88fce8152a48df }, -6634 },
+	{ { 0xb07ebf906d8f85d6, 0x56a1bbb0fe3e2f7a, 0x69852cc6a07d2f0c, 0x9302345438dc0e7a }, -6527 },
+	{ { 0xd8adfef042f23094, 0x2bf87d930ebf4396, 0x11800af4bc788512, 0xb533bd05f6e01fed }, -6421 },
+	{ { 0xd74b88321c31fe03, 0x2a050b26f584d3ee, 0x007a33e8d271b7ca, 0xdf594d503addf379 }, -6315 },
+	{ { 0xb62593291c768919, 0xc098e6ed0bfbd6f6, 0x6c83ad1260ff20f4, 0x89a63ba4c497b50e }, -6208 },
+	{ { 0xd80861cec00fa387, 0x464ce38e212dd612, 0xddcce19614fb7834, 0xa9aa79bf6a3aac53 }, -6102 },
+	{ { 0xf5f378bd88b5e339, 0x70b449709c8d8001, 0x0fc4eafedd191926, 0xd1211fe37ac6a148 }, -5996 },
+	{ { 0xe23af0723b5dafae, 0x38839eeb7babe846, 0xb5a21af135506167, 0x80e2cce8d01f963a }, -5889 },
+	{ { 0x95abef79db0c6387, 0x6276e8b3738d2f80, 0x52ffa3f3adcdf125, 0x9edd3b40cbf457e6 }, -5783 },
+	{ { 0x81b2aa73a435c1c1, 0xe6bd6fc40aaf5034, 0x322b56a3f15dc601, 0xc3d0b2b266412778 }, -5677 },
+	{ { 0x6d086b163b4631b8, 0x8cf6873ef4426490, 0x75d9b3727e6e5a47, 0xf15c640b2de17b85 }, -5571 },
+	{ { 0xfc04df783488a410, 0x64d1f15da2c146b1, 0x43cf71d5c4fd7868, 0x94c0092dd4ef9511 }, -5464 },
+	{ { 0xfad3d6bb39dfd932, 0x0fd924be26af7592, 0x68e1eb75340122d4, 0xb759449f52a711b2 }, -5358 },
+	{ { 0xff78b1792fcfdda7, 0xf3b74cf7cb18828f, 0x621601d613047373, 0xe1fea64e92b8f6f8 }, -5252 },
+	{ { 0x202349253a58ecc0, 0xa6498798ba280923, 0x1754b16beba6aad6, 0x8b47ae41b64bda30 }, -5145 },
+	{ { 0xa7ee44db1cd1a617, 0x5c197e9eabacb12e, 0x5770075139d01ff3, 0xabad0504a999d9e0 }, -5039 },
+	{ { 0x0c450d29cf87049d, 0x4e241e61e269d4e8, 0x7b5b520aa67d2087, 0xd39b595ad755ea09 }, -4933 },
+	{ { 0x5c149ff4db2c84a5, 0xdf9bcccedee33586, 0x0655af3873eee5a6, 0x8269abe37634aee0 }, -4826 },
+	{ { 0x63ddfb68f971b0c5, 0x2822e38faf74b26e, 0x6e1f7f1642ebaac8, 0xa0bf0465b455e921 }, -4720 },
+	{ { 0xf741d7ac8728cbc2, 0xf48ee971d1ec008d, 0x14037e4fb249456b, 0xc6228b76e0edde17 }, -4614 },
+	{ { 0xcd5140f638d331b3, 0xddee7f83569c8b33, 0x1f4bf6653cd3b977, 0xf4385d0975edbabe }, -4508 },
+	{ { 0xa80ec51f1cbd5473, 0x8509c1bd793fd615, 0x2913574e1b92c759, 0x96832618eae7fbea }, -4401 },
+	{ { 0x4edfad695e16755f, 0x9360dcae892a2b6b, 0xa7890845b98cde15, 0xb9854ec6332e5955 }, -4295 },
+	{ { 0xe951e5ea4ddae111, 0x0daf84cd3acf4a00, 0x4c7284f9edda793d, 0xe4ac057c4237088f }, -4189 },
+	{ { 0xa3804f4d3dfeea1a, 0xe4ceee3337dec382, 0x1668cd8fad294d80, 0x8cee12dbe4a0d94d }, -4082 },
+	{ { 0x7db1b3f8e100eb43, 0x2862b1f61d64ddc3, 0x61363686961a41e5, 0xadb5a8bdaaa53051 }, -3976 },
+	{ { 0xa219c141c2ba9b3b, 0x7a26b9c407754a71, 0xff2f89082e46b1ae, 0xd61d163a16a90d2f }, -3870 },
+	{ { 0x68923ec3fc88b108, 0xf545aab1b59d6386, 0xd6e5a8dc8bd7642d, 0x83f52c420a0a1bf8 }, -3763 },
+	{ { 0xc0eaff3755a2ddcd, 0xf53e94d1b2357c32, 0x87a601586bd3f698, 0xa2a682a5da57c0bd }, -3657 },
+	{ { 0xff6c5e79ce9603bc, 0xb48c0255fbcb6141, 0x7855b18ac87d35cc, 0xc87b6d2f3f64789e }, -3551 },
+	{ { 0xa1cfa20a06ef6273, 0x49c126b8ac219f55, 0x52e84de3b97f1642, 0xf71d01e03613f568 }, -3445 },
+	{ { 0x7ed7db93bf1b3a6a, 0x4bc70aefb308d9aa, 0x402596199721b820, 0x984b9b19e1f045dd }, -3338 },
+	{ { 0x276e3f0f67f0553b, 0x00de73d9d5be6974, 0x6d4aa5b50bb5dc0d, 0xbbb7ef38bb827f2d }, -3232 },
+	{ { 0x3b89bf12d3e7ee55, 0x2db077be9d18b000, 0x07cd71a4ad11c394, 0xe761832efdc06462 }, -3126 },
+	{ { 0xeadb2f393fc07de2, 0xd4e7468e07450e42, 0xe31578d4e269d267, 0x8e997872a9b05ac7 }, -3019 },
+	{ { 0xd0474452db441fcd, 0xff7fc50083dc5b75, 0xd7be2621598b9454, 0xafc47766cb39a7b0 }, -2913 },
+	{ { 0x39f87391a061c7dd, 0x4d0525af79e132c3, 0x5ae1b25946117390, 0xd8a66d4a505de96b }, -2807 },
+	{ { 0x862a012c5fea4155, 0x5bc9d091bbf3cb01, 0x4b48b0e153cdce9a, 0x85855c0f774fb85e }, -2700 },
+	{ { 0xfd141efbe7ff38dd, 0xf2d5c346258da620, 0xd521d9abbfeb2fed, 0xa493c75052eb8374 }, -2594 },
+	{ { 0x92c17acb2d08d5fd, 0xc26ffb8e81532725, 0x2ffff1289a804c5a, 0xcadb6d313c8736fc }, -2488 },
+	{ { 0x8c59134b7b7ab7f2, 0x112ee12926d4bbd2, 0xd04ee5efc60d3e49, 0xfa0a6cdb8871347c }, -2382 },
+	{ { 0x4b582ca7eccea978, 0xa490a57c5710577a, 0x1c6b313713a077e7, 0x9a197865b4730dd0 }, -2275 },
+	{ { 0x42410a94cb61b332, 0xf834911ffc964b3e, 0x8904f03c4c1d014a, 0xbdf139f0ee5092c6 }, -2169 },
+	{ { 0x36b400c90134f182, 0x804749d9365aa654, 0x36c30d4bce887fe1, 0xea1f3806467f9466 }, -2063 },
+	{ { 0xd4c94a9da0693e0c, 0xe7317d62209b6a93, 0x7132d332e3f204d4, 0x9049ee32db23d21c }, -1956 },
+	{ { 0xd613f4ab883c13df, 0x52dffab57332add4, 0x61eb52e27ba1a893, 0xb1d983b479007736 }, -1850 },
+	{ { 0x5c8a5dc65d745a24, 0x2726c48a85389fa7, 0x84c663cee6b86e7c, 0xdb377599b6074244 }, -1744 },
+	{ { 0x118873312db79242, 0xd7cc4fee9ed6c1d9, 0x1a4eb006f7ce07de, 0x871a49813ffc68a6 }, -1637 },
+	{ { 0xd391c92b7b5f748b, 0xa8562a3d2ff7c888, 0x88db9fffd5e6810e, 0xa686e3e8b11b0857 }, -1531 },
+	{ { 0xe4b3c0739b01e5c4, 0x79d697654eced1ab, 0x0092757bf2623727, 0xcd42a11346f34f7d }, -1425 },
+	{ { 0xb2a230093c93f6fd, 0xab9fac96b03d8443, 0x8920b098955522b4, 0xfd00b897478238d0 }, -1319 },
+	{ { 0x365c73531f1533de, 0xbefa78253027da9d, 0x4ee367f9430aec32, 0x9becce62836ac577 }, -1212 },
+	{ { 0x9b03537708b1648f, 0xa23e2ed27766e8cc, 0xfa911155fefb5308, 0xc0314325637a1939 }, -1106 },
+	{ { 0x9bdbfc21260dd1ad, 0x4609ac5c7899ca36, 0xa4f8bf5635246428, 0xece53cec4a314ebd }, -1000 },
+	{ { 0x2e63f619de93a2c6, 0x1c5a40917d0fa664, 0x7b6306a34627ddcf, 0x91ff83775423cc06 }, -893 },
+	{ { 0xd0c5b868313a262b, 0x8fe5b452e6b166cd, 0x59ed216765690f56, 0xb3f4e093db73a093 }, -787 },
+	{ { 0x4ed775fc49f27952, 0xe26ca6063461fffa, 0xac7cb3f6d05ddbde, 0xddd0467c64bce4a0 }, -681 },
+	{ { 0xe3eeb1a5e1589918, 0x690c0db23e2755ee, 0x11dbcb0218ebb414, 0x88b402f7fd75539b }, -574 },
+	{ { 0x0e128b5d938cfb3f, 0x2a1fee40d90aab31, 0x3f2398d747b36224, 0xa87fea27a539e9a5 }, -468 },
+	{ { 0x59e338e387ad8e28, 0x0b5b1aa028ccd99e, 0x67de18eda5814af2, 0xcfb11ead453994ba }, -362 },
+	{ { 0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x8000000000000000 }, -255 },
+	{ { 0x0000000000000000, 0x0000000000000000, 0xf020000000000000, 0x9dc5ada82b70b59d }, -149 },
+	{ { 0x0000000000000000, 0x50f8080000000000, 0x3cbf6b71c76b25fb, 0xc2781f49ffcfa6d5 }, -43 },
+	{ { 0xc22f1d0200000000, 0x388da035c8f16477, 0xc5cfe94ef3ea101e, 0xefb3ab16c59b14a2 }, 63 },
+	{ { 0x0bc3c54e3f40f7e6, 0x0234f3fd7b08dd39, 0xc66f336c36b10137, 0x93ba47c980e98cdf }, 170 },
+	{ { 0x95d7ddc421413571, 0x2381cf8591999d63, 0x577b986b314d6009, 0xb616a12b7fe617aa }, 276 },
+	{ { 0xceb740079a8b3d33, 0x0f118a2758e233b1, 0x85bbe253f47b1417, 0xe070f78d3927556a }, 382 },
+	{ { 0xd7924bff833149fa, 0xbc10c5c5cda97c8d, 0x82bd6b70d99aaa6f, 0x8a5296ffe33cc92f }, 489 },
+	{ { 0xae780c7fea81c788, 0x851e4cbf3de2f98a, 0xddbb901b98feeab7, 0xaa7eebfb9df9de8d }, 595 },
+	{ { 0x75e7c7e8f2099e01, 0xe2228cbf49612182, 0x73832eec6fff3111, 0xd226fc195c6a2f8c }, 701 },
+	{ { 0x4f0aabd7e1be4da6, 0x21ceb9ec7b8c62ed, 0xe6a1158300d46640, 0x81842f29f2cce375 }, 808 },
+	{ { 0xf477189fa875f113, 0x9df3e0bd5f019366, 0x5ebf18b6d27795ff, 0x9fa42700db900ad2 }, 914 },
+	{ { 0x9c34cce922010bac, 0xe117befa6fab7d19, 0x1027fff56784f444, 0xc4c5e310aef8aa17 }, 1020 },
+	{ { 0x6a447a848ce130a5, 0x8b5081209b8475f5, 0xb5e54f71127ad372, 0xf28a9c07e9b09c58 }, 1126 },
+	{ { 0xffa6738a27dcf7a3, 0x3c11d8430d5c4802, 0xa7ea9c8838ce9437, 0x957a4ae1ebf7f3d3 }, 1233 },
+	{ { 0x0ded6f62797d4cc4, 0xe14b2084a15836ec, 0x7df40a744e446163, 0xb83ed8dc0795a262 }, 1339 },
+	{ { 0x422d38ea3584cde4, 0x9c6583981d134cba, 0xcc655c54bc5058f8, 0xe319a0aea60e91c6 }, 1445 },
+	{ { 0x66dcd0e4cf27470a, 0x0db2ff19c0ca0b65, 0xc80cff6ec76dde09, 0x8bf61451432d7bc2 }, 1552 },
+	{ { 0x4a581611df8700f9, 0xb3e40992f8b347e2, 0xc6ebceff061b64c5, 0xac83fb896b6795fc }, 1658 },
+	{ { 0xaa089c0df6b3dd53, 0x5062f7a80e35f08b, 0x9d3c1b8618251f10, 0xd4a44fb4b8fa79af }, 1764 },
+	{ { 0x90d12d8e1d4c7321, 0x2e9c7527d11d4e6b, 0x96e4ac8ae2f0a61d, 0x830cf791e54a9d1c }, 1871 },
+	{ { 0x3efb9807d86d3c6a, 0x84c10a1d22f5adc5, 0x55e04dba4b3bd4dd, 0xa1884b69ade24964 }, 1977 },
+	{ { 0x50c00f7212e04c7d, 0x83689c3cbd362290, 0x9dad43f230e1226e, 0xc71aa36a1f8f01cb }, 2083 },
+	{ { 0xc0e489398e4f110b, 0x6ec79ebf79e5bd65, 0x31a0a1f380ba36ee, 0xf56a298f437028f3 }, 2189 },
+	{ { 0x7ced4bde6b367155, 0xb0d7ba426777344d, 0x6c8d3fca02ca6de6, 0x973f9ca8cd00a68c }, 2296 },
+	{ { 0xb7bc579e9a5a1a51, 0xd9f922f5d6b023a3, 0xdf143bbe46291876, 0xba6d9b40d7cc9ecc }, 2402 },
+	{ { 0x4b5901995e76a174, 0x52210ac35b45b385, 0x23114665acc60d3b, 0xe5ca5a0b8d737f0e }, 2508 },
+	{ { 0x69ed101390142609, 0x8471baff2d83df7d, 0x7e289e1eabe77166, 0x8d9e89d11346bda5 }, 2615 },
+	{ { 0xf48b51375df06e86, 0x412fe9e72afd355e, 0x870a8d87239d8f35, 0xae8f2b2ce3d5dbe9 }, 2721 },
+	{ { 0xf2563b8b76bcf011, 0x0f235cbc4c5a9894, 0xaae8c1d6c83415a0, 0xd72930205a0c1b2f }, 2827 },
+	{ { 0x5676d47a6f66702b, 0xbbd356dd36f14528, 0xc832a5685e79350c, 0x849a672a0d2ecfd1 }, 2934 },
+	{ { 0xcdb3d062669b0397, 0x57a7feaa31cac9d8, 0x13fe73c71ddf07ef, 0xa3722c1341fa93de }, 3040 },
+	{ { 0xd6f4b6d27bd1c61c, 0x526b988275249b0f, 0x650d3d28f18b50ce, 0xc976758681750c17 }, 3146 },
+	{ { 0xdee898d39a991c48, 0x93b6e3a9ae4e696a, 0x8686ad2b30c2d961, 0xf8526dcaa67e0b77 }, 3252 },
+	{ { 0xb1f68718ca0242b6, 0x06a04e1f1626b5d2, 0x1eac5b7d1142d87c, 0x990a4d36997a9834 }, 3359 },
+	{ { 0xf0461526b4201aa5, 0x7fe40defe17e55f5, 0x9eb5cb19647508c5, 0xbca2fc30cc19f090 }, 3465 },
+	{ { 0x4d789b006e44eaf3, 0x0e2bc6f6e25d9e83, 0xdc18d6ce622438a3, 0xe8833c181c3bbfe0 }, 3571 },
+	{ { 0x6d557c6ea1e06555, 0x718b9618b3c6d176, 0x0a40de037c9ad730, 0x8f4c0691750e8305 }, 3678 },
+	{ { 0x38e55892ccddb68e, 0x5ecc5ab963d91b0b, 0x026b8897e82cde8d, 0xb0a08d798abce436 }, 3784 },
+	{ { 0x7c5a221438f9d058, 0x318a871f113842d3, 0x75bd95cf6d4e57f9, 0xd9b5b441df1ca24a }, 3890 },
+	{ { 0xb8a89f2441e0083f, 0xecff2e2c1eae9db9, 0x085bccd5c05ee9f9, 0x862c8c0eeb856ecb }, 3997 },
+	{ { 0xaebd4bb2e3516eda, 0xe87c8e95fa932e7c, 0x202e275e2e6472b2, 0xa561da6259253f91 }, 4103 },
+	{ { 0xd8adfb2e00494c5e, 0x72435286baf0e84e, 0xbeb7fbdc1cbe8b37, 0xcbd96ed6466cf081 }, 4209 },
+	{ { 0xcb5b643380f31ac5, 0x57d614660af3d416, 0xeca608d886d5085f, 0xfb4383271a87a1ce }, 4315 },
+	{ { 0xe00e35abda0c5952, 0x57e155f4ae05d035, 0x2f1a208fdedff747, 0x9ada6cd496ef0e05 }, 4422 },
+	{ { 0x37e079f6e28e3e0c, 0x143904e69c22ea22, 0xb77caf58b4a564e0, 0xbedf0fbeeaa56989 }, 4528 },
+	{ { 0xfe834dce2059475e, 0xf0c01c012927f616, 0xbc921b2c3eb25c7b, 0xeb445f92a877bb09 }, 4634 },
+	{ { 0x2a8b53bda73f31df, 0xa24769cecae0563a, 0x4ec0aaeb679e4d79, 0x90fe99d23e8df6cf }, 4741 },
+	{ { 0x0badb504e5728cb4, 0x7704bd1bb5a5802f, 0x4257ac3b4c1d7794, 0xb2b8353b3993a7e4 }, 4847 },
+	{ { 0xcff72d64bc79e429, 0xccc52c236decd778, 0xfb0b98f6bbc4f0cb, 0xdc49f3445824e360 }, 4953 },
+	{ { 0x82171c2863dc80b5, 0x779afc75bb5d53be, 0x532430e7002aca8e, 0x87c37487ccf4b0bf }, 5060 },
+	{ { 0xb15fe539c7113ae0, 0x035862a2937636e6, 0xe75dd664b8f76aa1, 0xa75767f07481436f }, 5166 },
+	{ { 0x562ca41d21f9f2ce, 0x5b1545b7a4a86071, 0x7877892520ee1715, 0xce43a50ae4f7fb8e }, 5272 },
+	{ { 0x7045a314089378a5, 0x05df329b2fbba8d7, 0xd440a4ff74d6af6a, 0xfe3d8461cb764145 }, 5378 },
+	{ { 0x2239a394574e2e86, 0x5c0648c4e9e45faa, 0x2e61aa868501e740, 0x9cb00bfd6f025339 }, 5485 },
+	{ { 0xa0fabf269da95b04, 0x698cf65b7421d879, 0xf84df185fc7d1bfd, 0xc121ea3b1aa714b6 }, 5591 },
+	{ { 0xbf34ff7963028cd9, 0xc20578fa3851488b, 0x2d4070f33b21ab7b, 0xee0ddd84924ab88c }, 5697 },
+	{ { 0xb15b788142078913, 0x7ce0ab319ae71a12, 0x555c13432402e523, 0x92b6530184ed7fb3 }, 5804 },
+	{ { 0xdcfa6ad81bf61987, 0xd92f8109437a02b1, 0xf33ce3d6f17b62d1, 0xb4d63576caa95365 }, 5910 },
+	{ { 0x87c1f2d5082524b5, 0x367cfb0ad3f10bff, 0xf9d2e9fd2f16711f, 0xdee60499182f84b2 }, 6016 },
+	{ { 0xc2a7c78bc844d71e, 0xdea7bf8e2153308d, 0xbc3bc2377649deef, 0x895f2f074b86004c }, 6123 },
+	{ { 0xef5fefc9d0d480c2, 0x54dd4ecfd8e2bbd7, 0x83f904625bf851b2, 0xa952e68c74f91e40 }, 6229 },
+	{ { 0xaebd2aef647650da, 0x351091ed9695d569, 0xfc8ea8820c829fe6, 0xd0b52e179d84f732 }, 6335 },
+	{ { 0xef23a4cbc039f0c2, 0xbb3f8498a972f18e, 0xb7b1ada9cdeba84d, 0x80a046447e3d49f1 }, 6442 },
+	{ { 0x77154ce2bcba1964, 0x6a3197bbebe3034f, 0xa74d28ce329ace52, 0x9e8b3b5dc53d5de4 }, 6548 },
+	{ { 0x5f933109be407d85, 0xc3c0dd2c7292ba15, 0xbd05b64feb6d2fff, 0xc36ba032dd07ddfe }, 6654 },
+	{ { 0x23e0fe4273aabd5b, 0x95d9ca3d05c2de20, 0x6e2cb3e7e6c76433, 0xf0dfcf43277d1129 }, 6760 },
+	{ { 0x9ce16b4b6239551d, 0xc276ee727a4bbdd2, 0xd9df435d26c85dd5, 0x947341bc28b52123 }, 6867 },
+	{ { 0x6ae82736619c70a4, 0x006deaf7b163aa51, 0x180f7fcdf9f88b9d, 0xb6faa16ac604d6f6 }, 6973 },
+	{ { 0x90e639dd31e3ddd7, 0x13a63e05b09f7f59, 0x6c0854dee9fe3499, 0xe189fff88a6e300a }, 7079 },
+	{ { 0x63093ad0caadb06c, 0x31be1482014cdaf0, 0x1e34291b1ef566c7, 0x8affca2bd1f88549 }, 7186 },
+	{ { 0xfda0c7c68ff50423, 0x1dbb78c82d0be125, 0x212bbb6587ce8d13, 0xab54683b3d20e23b }, 7292 },
+	{ { 0xe701f7bc8d1a0383, 0x03baa2f38e35464f, 0x3f50c802040f4ccc, 0xd32e203241f4806f }, 7398 },
+	{ { 0xbebfda1ef83f43a5, 0x5b00ad4466dbcebd, 0xffe39290a06447d6, 0x82265b7e7efc84e0 }, 7505 },
+	{ { 0x0c61cdd68ac8e8b5, 0x1f17dfae241cfad8, 0xd51af6a3244a6983, 0xa06c0bd4ce9db63f }, 7611 },
+	{ { 0xf9eebaf429b2649e, 0xcc84a2629670b8e9, 0xb2c46d6d298a0658, 0xc5bc4672073224f7 }, 7717 },
+	{ { 0x155051a9ae17e1c9, 0xe182161815aa3827, 0x17f49abd213c38b8, 0xf3ba4e7089c084e0 }, 7823 },
+	{ { 0xd4e6b6e847550caa, 0x56a3106227b87706, 0x7efa7d29c44e11b7, 0x963575ce63b6332d }, 7930 },
+	{ { 0x5d512195d0175bc1, 0xe906612b94cc94b7, 0x0c1beb6383dd861c, 0xb9258c901050bc53 }, 8036 },
+	{ { 0xd5ae1b791c98df7e, 0xde442da4f65a1f9f, 0x2cda83ae165bf80e, 0xe435fd6309d4fb29 }, 8142 },
+	{ { 0x126d388625960d50, 0xaef839a8a7f6a14c, 0x5dfed09922680a06, 0x8ca554c020a1f0a6 }, 8249 },
+	{ { 0x1b1f0ab570c00a25, 0x15e6adb85c868cc9, 0x2ab1aa038b8d63a1, 0xad5bff3854ff2560 }, 8355 },
+	{ { 0x93fc56e82f86fdec, 0x616a13318ff341b2, 0x1e914685a756a7d6, 0xd5ae91d3ff7a6f8e }, 8461 },
+	{ { 0x5ad2b390c9eb073d, 0xf3f69093398e2573, 0x111ae5735ec0e878, 0x83b10fb893300cde }, 8568 },
+	{ { 0x8cd036553f38a1e8, 0x5e997e9f45d7897d, 0xf09e780bcc8238d9, 0xa2528e74eaf101fc }, 8674 },
+	{ { 0xbe87c0e3a22e3851, 0x83e02c1bbde40e2f, 0x5be12541bd907f81, 0xc813f2038018dcc4 }, 8780 },
+	{ { 0x3cb8494e84b16f5b, 0x507a83727a7becf5, 0x5e0a5c3957f5dbb8, 0xf69d74fc97aee56a }, 8886 },
+	{ { 0xd8a1d91d4d71d1f1, 0x5ce629d11d5b38eb, 0x97ecac7332c473b4, 0x97fcff3458a37b0c }, 8993 },
+	{ { 0x10e980a1c0ccfd83, 0x6fc5802cde0b3272, 0x4c808753bb22fef8, 0xbb570a9a9bd977cc }, 9099 },
+	{ { 0x4633c72ef9dc880f, 0x2fa6b3ca5812ef91, 0xe471d787c5786319, 0xe6ea1521bb43aebc }, 9205 },
+	{ { 0xc6a9720eef2ccaa1, 0x452107c368a41805, 0xd1445b3f1cc9a09c, 0x8e4fddbbd3e242b6 }, 9312 },
+	{ { 0x46b6aae34cfd26fc, 0x00db7d919b136c68, 0x7730e00421da4d55, 0xaf69bdf68fc6a740 }, 9418 },
+	{ { 0x765ffec978435914, 0x2839eebbd2636ad9, 0xb1a05a0d64a2e6e8, 0xd83699ba2ae37e0c }, 9524 },
+	{ { 0xf9f45544b239e665, 0xcf27866b2c6bd991, 0x2fcf6c219d9e0e06, 0x854070f666f8939f }, 9631 },
+	{ { 0xd83ca9b2bffd7a99, 0xac18f659182b0e63, 0xba5da243711d4f39, 0xa43ed4844001a59e }, 9737 },
+	{ { 0x5700a0eb8653e8a9, 0x65d2c975f1b0b016, 0xb5ceaf53c9875f4b, 0xca72b831ff7bef2d }, 9843 },
+	{ { 0x7c9361e0fab6d091, 0xf02c90b784b4227a, 0xfdd08c4da13655ec, 0xf9895d25d88b5a8a }, 9949 },
+	{ { 0x482e463a3076c99f, 0x19d07d3da2917426, 0x605990407cf18034, 0x99c9ee1aa45cbdb6 }, 10056 },
+	{ { 0x302349e12f45c73f, 0xb494bcc96d53e49c, 0x566765461bd2f61b, 0xbd8f2f7a1ba47d6d }, 10162 },
+	{ { 0x7266c802e3138830, 0x1fb6dd3f85dab6c0, 0xae2c6960d0c96141, 0xe9a65fc76a44aad4 }, 10268 },
+	{ { 0xb802599e6f482a0a, 0x357c0a5a746a6e67, 0x36ff0ad5e3a835b0, 0x8fff7443ec2f51ed }, 10375 },
+	{ { 0x0b9d5893e0ac162e, 0x9a567cbbbf855bc8, 0x7407cb9251918021, 0xb17db720b3868e94 }, 10481 },
+	{ { 0x18135131d3bd6276, 0xbeb1ad9e2863c8c1, 0x032727c1ccef13ba, 0xdac64ee70f466ae5 }, 10587 },
+	{ { 0x7b52bf8d740a0f1f, 0x62cc2e73300f409f, 0xd4e1e0f5d911bd40, 0x86d48d6626c27eeb }, 10694 },
+	{ { 0x0c7a3cbe3d82a042, 0xfca81f202c5d111a, 0x50e3660235410f98, 0xa630ef7d5699fe45 }, 10800 },
+	{ { 0xb5eaef7441511eb9, 0xc9cf998035a91664, 0x12e29f09d9061609, 0xccd8ae88cf70ad84 }, 10906 },
+	{ { 0x4b12afaa89fdde70, 0x192df5f08f7399f1, 0x7119aa2c0c5ee694, 0xfc7e217a6ace9f0f }, 11012 },
+	{ { 0x5026a4e5854eb675, 0x3ae0052860cf9f41, 0xc1afeb8941b07ae6, 0x9b9c52def0f2f4ff }, 11119 },
+	{ { 0x5e72b10d5be4a787, 0x9c65e36ac2d966ac, 0xda1276a2f5debc0b, 0xbfce0f5ab8a6761d }, 11225 },
+	{ { 0x8ed156a50b8782cd, 0x0a233b0e1ff48f38, 0xb33c91ded66ff3b9, 0xec6af63168693f51 }, 11331 },
+	{ { 0x69ee0def60b61c3d, 0xead238211605495c, 0xf739f1ca6f8ae61e, 0x91b427ab57bce6ad }, 11438 },
+	{ { 0x51d5c0b9a08cc6cf, 0xd38e9d0e472b2647, 0xae7edaa76fbbd922, 0xb397fd9a22d732d7 }, 11544 },
+	{ { 0x134ca67a679b84ae, 0x8909e424a112a3cd, 0x95aa118ec1d08317, 0xdd5dc8a2bf27f3f7 }, 11650 },
+	{ { 0x9270c1d792547432, 0xb5901f20440f369f, 0x04b7ef7faa32153c, 0x886d7361002a7720 }, 11757 },
+	{ { 0x647f228805a4c604, 0x5e943a525ef980db, 0xe012eb55f30d3c0a, 0xa828f10fb963c71c }, 11863 },
+	{ { 0x0ebec326807272aa, 0x52aefdf41bd4842a, 0xa3f2e2617152417c, 0xcf45ead490352e65 }, 11969 },
+	{ { 0x4f2c2f1e5d743ac6, 0xb96684a8f9a28e61, 0xbb2215057a199356, 0xff7bdcd8f586aed0 }, 12075 },
+	{ { 0x3f82da9b5be76b45, 0x7efdaa0b6b264abb, 0xefd29f06b8eb7ba2, 0x9d743e108a6a5fb0 }, 12182 },
+	{ { 0xbfa81d83029ec0fa, 0xa524d2082aac030d, 0x421ddc40535f78b3, 0xc213bea5c91f03d8 }, 12288 },
+	{ { 0x365460ed91271c24, 0xabe33496aff629b4, 0xf659ede2159a45ec, 0xef37f1886f4b6690 }, 12394 },
+	{ { 0x6f75529546ee8b59, 0xd2fea4fd957ea18e, 0x8c474bb609f40287, 0x936e07737dc64f6d }, 12501 },
+	{ { 0x73ce81f969e53924, 0xe311ad3969a206e0, 0x89abf129af845214, 0xb5b8a47f8889782c }, 12607 },
+	{ { 0x92c657741ea2902d, 0xb9e4b3d49fb11547, 0xafb619b59ab7cab9, 0xdffd1e7be8191190 }, 12713 },
+	{ { 0x4a6ccaf4274f4ba4, 0xbea644e084723866, 0xce808cd18e336b0c, 0x8a0b316ba468d9fd }, 12820 },
+	{ { 0xc9cbe77e6be6e4c9, 0x96347e0589f9c013, 0xe0280dbea779d3b9, 0xaa26eb2095a94e81 }, 12926 },
+	{ { 0x093088d8cc8f6622, 0xc25558230c550f78, 0x0d5c82a286614f3e, 0xd1ba8323fe558c61 }, 13032 },
+	{ { 0xce5fec949ab87cf7, 0x0151dcd7a53488c3, 0xf22e502fcdd4bca2, 0x81415538ce493bd5 }, 13139 },
+	{ { 0x7825444ed04d0259, 0x93dde26b36357630, 0xc3720171212fda8f, 0x9f51c070f53fb4a9 }, 13245 },
+	{ { 0xdd5cf7c945f22a3f, 0x65761fb2444e2267, 0xc94c153f804a4a92, 0xc46052028a20979a }, 13351 },
+	{ { 0xd7e614a5dcdb8249, 0xaa36d42b7931d02f, 0xa5f1001d0cb47329, 0xf20d6b41853ce899 }, 13457 },
+	{ { 0x7b661fe3b805ab70, 0xab328000b197f37c, 0x92506fd4d86244d3, 0x952d234ccb7e5f2a }, 13564 },
+	{ { 0x9a96e9d13f8c1261, 0x8c77bbdf8bb17df7, 0x26289e8e9e6fce92, 0xb7dfbf27855ed611 }, 13670 },
+	{ { 0x52f908853a4fa01c, 0x4daa4a8effda676c, 0x88111764983edba9, 0xe2a46848a8d6f78b }, 13776 },
+	{ { 0x5e2075ba289a360b, 0xac376f28b45e5acc, 0x0879b2e5f6ee8b1c, 0x8badd636cc48b341 }, 13883 },
+	{ { 0xc6027c21cef76465, 0xcd09809d6b9bbacd, 0x0aebc0915f75c1f2, 0xac2aefcb5dfe300a }, 13989 },
+	{ { 0xb300ff93dbc7af73, 0xb1978daa93ecaf37, 0x75a77a3b0bc28f4d, 0xd4368dc8bb2a0e80 }, 14095 },
+	{ { 0x772939f73369efc2, 0x538567bfbe0b117a, 0x6e6c12aa02b9a1ec, 0x82c952e37be11cb4 }, 14202 },
+	{ { 0x606dd5b12db83edc, 0xbd6e64db22a2d08f, 0x578d95d780e47d84, 0xa134eaf486b5d13f }, 14308 },
+	{ { 0xf24992a6adf00ede, 0x2b9886e4fc08b272, 0xc11b18bd25918c30, 0xc6b3de56db4aef75 }, 14414 },
+	{ { 0xa9564d50d96f5b90, 0xe1f7f1156b58d831, 0x538966169d821439, 0xf4eb7d1ee4ac0571 }, 14520 },
+	{ { 0x0f7740145246fb8f, 0x186ef2c39acb4103, 0x888c9ab2fc5b3437, 0x96f18b1742aad751 }, 14627 },
+	{ { 0x086dc277a990b9e1, 0xee0ec0cc8aad3df9, 0x1f1545846aae50ee, 0xba0d61235fd033eb }, 14733 },
+	{ { 0x7d21f446270f5d38, 0x970db52e1743533b, 0xd15e6695e9fb0b3e, 0xe553be2769f4765e }, 14839 },
+	{ { 0xb7f6dc42320cc5b7, 0x22996fe1dfee605b, 0x7abcd7ed54a929d3, 0x8d55709fbdaeea74 }, 14946 },
+	{ { 0x68d759e7a3fff997, 0x5a43d43795f92ea2, 0x7ef5f8c1b3a0771c, 0xae3511626ed559f0 }, 15052 },
+	{ { 0x8945cb641bd5199c, 0x6d69cfd34cf5dade, 0x814a69258ddd6d5a, 0xd6ba215817b5591f }, 15158 },
+	{ { 0x53c426a364dcb15a, 0x3b482d9dc36e244f, 0x796ecf6adfc25225, 0x8455f5578672ad69 }, 15265 },
+	{ { 0x95a9949e04b8bff3, 0x900aa3c2f02ac9d4, 0xa28a151725a55e10, 0xa31dcec2fef14b30 }, 15371 },
+	{ { 0x7fc9903fbba6dd61, 0xd75b37a5230067e7, 0xf3be171a27bf81da, 0xc90e78c7fcbee713 }, 15477 },
+	{ { 0x715290260f98c805, 0x39e35541a56f6aee, 0x462a2bf67ddfa64b, 0xf7d24130e645ddd7 }, 15583 },
+	{ { 0x403f4d46b309c39e, 0xe1281d24c6f709e5, 0x5a050b215eebc516, 0x98bb4ee309f04d45 }, 15690 },
+	{ { 0x5e91b28cd15f3d72, 0x7c58659f028b915a, 0x6ecc7f9959c7582a, 0xbc419e3fb5e9d924 }, 15796 },
+	{ { 0x14989be4222dd137, 0xe72af3faf80453ce, 0xa6a99ee15afede53, 0xe80b387fb9146d6c }, 15902 },
+	{ { 0x0c332c8abe6dad62, 0x88e71481e4cf8efe, 0x5d9f64c557ce815d, 0x8f020fb0d2b663bd }, 16009 },
+	{ { 0x80acda113324758a, 0xded179c26d9ab828, 0x58f8fde02c03a6c6, 0xb045626fb50a35e7 }, 16115 },
+	{ { 0x05b121f42dc43417, 0x3b92c6991eec0426, 0x68fc787a6f5f923f, 0xd94554abe1e9db05 }, 16221 },
+	{ { 0xc6ceb52fba8ea409, 0x9c229c3756b9fb12, 0x215abdf4a82d15a6, 0x85e74aaa26674a71 }, 16328 },
+};
+static const uint64_t lookupq_small[LOOKUPQ_TABLE_STEP][2] = {
+	{ 0x0000000000000001, 0x0000000000000000 },
+	{ 0x000000000000000a, 0x0000000000000000 },
+	{ 0x0000000000000064, 0x0000000000000000 },
+	{ 0x00000000000003e8, 0x0000000000000000 },
+	{ 0x0000000000002710, 0x0000000000000000 },
+	{ 0x00000000000186a0, 0x0000000000000000 },
+	{ 0x00000000000f4240, 0x0000000000000000 },
+	{ 0x0000000000989680, 0x0000000000000000 },
+	{ 0x0000000005f5e100, 0x0000000000000000 },
+	{ 0x000000003b9aca00, 0x0000000000000000 },
+	{ 0x00000002540be400, 0x0000000000000000 },
+	{ 0x000000174876e800, 0x0000000000000000 },
+	{ 0x000000e8d4a51000, 0x0000000000000000 },
+	{ 0x000009184e72a000, 0x0000000000000000 },
+	{ 0x00005af3107a4000, 0x0000000000000000 },
+	{ 0x00038d7ea4c68000, 0x0000000000000000 },
+	{ 0x002386f26fc10000, 0x0000000000000000 },
+	{ 0x016345785d8a0000, 0x0000000000000000 },
+	{ 0x0de0b6b3a7640000, 0x0000000000000000 },
+	{ 0x8ac7230489e80000, 0x0000000000000000 },
+	{ 0x6bc75e2d63100000, 0x0000000000000005 },
+	{ 0x35c9adc5dea00000, 0x0000000000000036 },
+	{ 0x19e0c9bab2400000, 0x000000000000021e },
+	{ 0x02c7e14af6800000, 0x000000000000152d },
+	{ 0x1bcecceda1000000, 0x000000000000d3c2 },
+	{ 0x161401484a000000, 0x0000000000084595 },
+	{ 0xdcc80cd2e4000000, 0x000000000052b7d2 },
+	{ 0x9fd0803ce8000000, 0x00000000033b2e3c },
+	{ 0x3e25026110000000, 0x00000000204fce5e },
+	{ 0x6d7217caa0000000, 0x00000001431e0fae },
+	{ 0x4674edea40000000, 0x0000000c9f2c9cd0 },
+	{ 0xc0914b2680000000, 0x0000007e37be2022 },
+};
+#define LOOKUPQ_POW5_EXP 325
+static const uint64_t lookupq_pow5[13] = {
+	0xb8d752bd07b02335, 0x43ac931188e2f3a3, 0x311a1c6ba9844395, 0x13bc57e2c434f13c,
+	0x710ce83e47fe0aa7, 0xa118267ec11bcec6, 0xe9ce0dfb7a576b74, 0x09dd9c1197beba19,
+	0xb39ad5dd43b246a8, 0xc42cdcb08393c028, 0x149e384c5b982920, 0x00062d0293bb10df,
+	0x0000000000000000,
+};
@@ -0,0 +1,144 @@
+static const uint16_t lookupx_pow2_off[17] = {
+	0, 1, 4, 9, 16, 25, 36, 49, 64, 82, 102, 124, 148, 174, 202, 232, 265
+};
+static const uint32_t lookupx_pow2[265] = {
+	1,
+	709551616, 446744073, 18,
+	768211456, 374607431, 938463463, 282366920, 340,
+	34512896, 355444464, 666416102, 789423207, 680763835, 101735386, 6277,
+	129639936, 584007913, 564039457, 984665640, 907853269, 985008687, 195423570, 89237316,
+	115792,
+	86936576, 550022962, 725780640, 607822219, 769947041, 522356652, 114602704, 706169552,
+	82395021, 35920910, 2135987,
+	990306816, 640806627, 254884915, 611414266, 771497210, 404245721, 667948293, 270465446,
+	805079739, 100143613, 212279040, 196394479, 39402006,
+	628614656, 933534601, 606266177, 560762521, 713763565, 326191050, 113397923, 180639288,
+	281490199, 687318060, 353641360, 888004534, 549323807, 295606890, 726838724,
+	6084096, 946433649, 811946569, 853753882, 186486050, 690031858, 166903427, 801874298,
+	73546976, 721764030, 723561443, 592393377, 479365820, 205846127, 574024998, 942597099,
+	407807929, 13,
+	148699136, 916606772, 101893167, 967546155, 306751209, 351365034, 16139339, 597671426,
+	243044989, 316401061, 531867170, 897225106, 63056092, 211839914, 131349101, 647190035,
+	502521019, 104534060, 330401473, 247,
+	246603776, 82874192, 360264950, 251994674, 722214188, 252661319, 375437998, 688704721,
+	594407310, 642309573, 371399778, 912811317, 677386505, 275167208, 192517899, 559930579,
+	228507248, 291324893, 171605700, 195218641, 440617622, 4562,
+	772502016, 340692027, 149163476, 66620126, 55113571, 283578738, 430093599, 45036330,
+	940861810, 310916002, 851483408, 727501698, 415219631, 664580441, 293153818, 714468753,
+	494449099, 781751972, 436845170, 58648805, 838126082, 976115855, 174424773, 84162,
+	816057856, 892846853, 716468750, 262999193, 598444825, 265285631, 849905550, 454976020,
+	181139204, 287275041, 814391444, 580044114, 73206171, 730697131, 477950487, 408828646,
+	886330878, 952686376, 38026050, 611139052, 17116696, 555256886, 488462502, 935148979,
+	92300708, 1552518,
+	474295296, 358787106, 737583615, 930553606, 745247475, 40008231, 978776245, 801261478,
+	212102266, 874307979, 579620512, 26041564, 376700445, 860757073, 720074396, 509218999,
+	375429359, 265824628, 159345284, 5352904, 702311064, 529441449, 172170652, 490721739,
+	933674838, 204418783, 918474961, 28638903,
+	737998336, 538580897, 36476489, 396898767, 561738838, 28292751, 188404148, 232908211,
+	441053024, 517676426, 84168731, 683999005, 576908386, 978462939, 537250538, 559502685,
+	678882347, 993257128, 894674394, 887657187, 474417255, 556724859, 26673902, 127960709,
+	36121522, 518847326, 916516606, 352339784, 135665246, 528294531,
+	914110976, 828589991, 277547081, 738803104, 965612827, 363615468, 874945746, 597925394,
+	378873685, 593479218, 648352799, 655490053, 29870789, 699956473, 419531277, 296312653,
+	46577987, 865203094, 183459169, 231408668, 225304916, 882010259, 465615065, 766426102,
+	212948690, 867906457, 595007526, 876226857, 875188310, 353382387, 399999080, 745314011,
+	9,
+};
+static const uint16_t lookupx_pow5_off[18] = {
+	0, 1, 6, 16, 31, 51, 76, 106, 141, 181, 226, 276, 331, 391, 456, 526, 601, 681
+};
+static const uint32_t lookupx_pow5[681] = {
+	1,
+	712890625, 434970855, 3726400, 242752217, 542101086,
+	212890625, 863681793, 569604314, 377187926, 193021880, 454666389, 305561419, 992184134,
+	705571876, 293873587,
+	712890625, 542392730, 692611135, 594098344, 472018268, 94308987, 151305816, 338616290,
+	607388585, 519261878, 559110455, 776771180, 702888039, 113245227, 159309191,
+	212890625, 471103668, 747746862, 37770580, 466936530, 989468319, 635969950, 939461496,
+	265605472, 34722882, 579715075, 31624270, 701685918, 850237034, 644362813, 711160003,
+	628003995, 253863518, 550944446, 86361685,
+	712890625, 649814605, 110011495, 914991744, 351194232, 452290906, 454151724, 289270907,
+	692338075, 312046122, 374199149, 196391753, 906314200, 334430537, 975392646, 494866350,
+	766739996, 538603832, 163371554, 387941833, 699150233, 138586765, 271558494, 546921983,
+	46816763,
+	212890625, 78525543, 154405035, 495048944, 477530234, 827972137, 807110513, 528271807,
+	438068409, 588206682, 950668826, 164997356, 797784387, 63576761, 267027807, 713424436,
+	958466020, 910577508, 862296645, 290557842, 739324074, 978892994, 212394766, 816060603,
+	497010955, 468236188, 558305435, 232740245, 373156492, 25379418,
+	712890625, 757236480, 255927480, 109729290, 471754681, 176824141, 784423224, 247288853,
+	498848681, 678125897, 244485230, 950336399, 885892815, 224459264, 966305645, 315433079,
+	540942492, 590089077, 775561, 688138689, 729483076, 289743809, 7864681, 984866562,
+	351936415, 782046256, 186228035, 709187165, 687804518, 664295482, 161360224, 526170065,
+	763667897, 268297397, 13758210,
+	212890625, 685947418, 789578832, 153319891, 326499008, 846968657, 927433551, 646003612,
+	336516628, 337206058, 265350215, 297563699, 3222742, 31686823, 588507120, 414217260,
+	63914765, 446554365, 435262941, 204074266, 781377495, 260792318, 84691481, 164829592,
+	302660486, 728095225, 101453412, 603255836, 803361511, 890400427, 304936174, 385070118,
+	333206278, 894271518, 534600406, 837376471, 315462933, 743290965, 731200206, 7458340,
+	712890625, 864658355, 130359090, 82607858, 494965940, 937654905, 685431960, 301373084,
+	147438283, 4081327, 803649766, 31099836, 592646953, 881129376, 937200640, 101215377,
+	622022885, 36009802, 540281829, 130558853, 769592643, 917655300, 847619111, 165586285,
+	365837500, 728219668, 387263920, 646696450, 286346262, 810762895, 863682265, 54500821,
+	565758491, 98843170, 491176108, 724211360, 854106881, 806158831, 241135885, 921888273,
+	32843323, 533437926, 906630599, 611952194, 4043174,
+	212890625, 293369293, 653268255, 416880298, 984679490, 653202458, 475503872, 931934129,
+	652111858, 353390542, 200433126, 234404316, 552560965, 557909463, 782927136, 669085475,
+	757223525, 148820014, 101852455, 427575901, 667152553, 307590053, 665684780, 945223575,
+	653852460, 202719653, 204634550, 795497146, 467333818, 878272092, 806279663, 576884703,
+	211380580, 914062659, 131302343, 9026766, 256466934, 594249319, 537175892, 91665704,
+	738274147, 751315534, 608390614, 623272604, 722124036, 832630808, 107141120, 39752693,
+	349008403, 2191809,
+	712890625, 972080230, 733306325, 737924322, 451234961, 547569114, 56983567, 672626985,
+	601893786, 667809251, 624849943, 494074064, 308107292, 633289160, 163699081, 539244954,
+	127432587, 66555347, 810660578, 443838905, 178114084, 932947762, 470844363, 4407511,
+	375439013, 85224138, 168125264, 891661240, 703447139, 352410094, 988850124, 400129858,
+	860073909, 497050213, 223559615, 834120570, 404425644, 829986367, 390364907, 889689715,
+	414027367, 367921736, 643439561, 664501631, 935657888, 127223250, 905798420, 285978658,
+	395276091, 503983449, 443290544, 253646939, 889696920, 228934474, 1188182,
+	212890625, 900791168, 745473302, 690027039, 292048945, 659543763, 931451300, 503677298,
+	410144597, 919367243, 713702272, 551359607, 237792160, 991991988, 752922755, 953943779,
+	533456482, 507168686, 259685362, 979977223, 66509405, 685244835, 114768526, 426648799,
+	323577135, 173884690, 71898745, 397236838, 411215816, 557931021, 915217675, 679307732,
+	58553576, 279969607, 593206960, 34802342, 567174784, 634380270, 725910028, 49278870,
+	80605088, 532953759, 222137454, 573459045, 46257464, 474722719, 914667149, 856218084,
+	561260668, 628972522, 756036964, 323626932, 570993229, 633584307, 331443965, 250520481,
+	650336885, 330822703, 876959713, 644114,
+	712890625, 79502105, 64769186, 979975559, 740109322, 538564262, 479211129, 605982355,
+	313238409, 703513133, 770482427, 384676832, 383827092, 433919992, 446883550, 507880352,
+	270468258, 893718464, 955604755, 626684813, 6130659, 284037716, 751863150, 326522307,
+	794682357, 462820323, 462825730, 673873310, 536919914, 415613691, 728846758, 705871864,
+	445305868, 203802297, 109511591, 505126742, 718487416, 549028709, 17718792, 365566616,
+	739740493, 662058709, 841727830, 736685408, 392957433, 736340956, 593432412, 748257019,
+	426051124, 694319168, 311156490, 848456455, 310073786, 417061342, 950441384, 207833712,
+	374337233, 182185571, 730855090, 174610019, 380182354, 783003129, 289274717, 374464977,
+	349175,
+	212890625, 508213043, 66193975, 377056990, 957725263, 161160306, 543186955, 544353426,
+	752135210, 616758202, 149221783, 800945662, 174229185, 935803884, 722469079, 783339017,
+	623956413, 283755879, 666547840, 897669676, 918219424, 565657243, 498628565, 957726114,
+	127224092, 963970291, 943492021, 503974595, 968061417, 481105458, 468310317, 415470701,
+	15883199, 563743333, 403453168, 544006328, 861343716, 496245086, 923424873, 8950252,
+	736001475, 645738536, 473664514, 611620381, 658162711, 604120310, 911913818, 650806746,
+	931586602, 850308505, 172399063, 474091257, 904971161, 480764871, 250400657, 553504509,
+	798520204, 568417368, 297487986, 632702505, 72194920, 252581267, 32263073, 548384506,
+	149424763, 245064349, 255602884, 953755640, 349786683, 189288,
+	712890625, 186923980, 124747671, 713058442, 130277225, 738021298, 171174275, 308872424,
+	737579931, 881326825, 432901186, 792025870, 212883870, 4620926, 324922475, 333150570,
+	263932247, 436495284, 253270296, 709621294, 735809544, 229590477, 871201269, 665581978,
+	956291399, 389034834, 283716680, 440050909, 780278541, 478563610, 37711642, 689939291,
+	289380307, 464737151, 783897129, 636585362, 666132429, 319642653, 264756271, 53558834,
+	303947957, 912568422, 714702219, 616865133, 839858798, 509759479, 23459699, 257497062,
+	679412382, 221177644, 587739707, 851396090, 210979044, 986773079, 612013839, 980636995,
+	288753174, 528365073, 363609927, 338771803, 553255959, 513683122, 756187038, 913293590,
+	83375844, 954834316, 475400680, 262038474, 289930522, 530683080, 296852190, 732229128,
+	406233400, 420032459, 102613,
+	212890625, 115634918, 615430273, 882267024, 559966957, 411689217, 227385153, 373527284,
+	321466491, 319349449, 971173152, 579376695, 352174724, 684328083, 472418242, 579033069,
+	918822547, 857127117, 153763503, 540464179, 604036185, 331102750, 570042246, 347786926,
+	170285190, 941051121, 803070715, 141608771, 140794537, 294051183, 662825734, 841586939,
+	586657834, 816037776, 222290074, 490239782, 753719892, 802858809, 299810833, 527144151,
+	124802899, 838448395, 770466127, 996414561, 126272884, 289511290, 843748736, 994522193,
+	957621869, 897719252, 991212515, 499214790, 718012279, 416453973, 270166265, 355209381,
+	173562593, 798039126, 64590901, 990253686, 300058261, 269449838, 442970528, 400309634,
+	836502721, 810854038, 895275128, 683493275, 775514101, 78975312, 954896357, 110870347,
+	185422180, 295763833, 399511558, 101605480, 817933310, 34577255, 846462680, 55626,
+};
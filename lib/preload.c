@@ -0,0 +1,486 @@
+#undef _FORTIFY_SOURCE
+#define _GNU_SOURCE
+#include <dlfcn.h>
+#include <errno.h>
+#include <langinfo.h>
+#include <pthread.h>
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "errol.h"
+
+
+/**
+ * Real printf functions, found past the shim.
+ *   @once: Resolves the functions once, across threads.
+ *   @stats: Set to report call counts at exit.
+ *   @handled: The number of calls formatted by Errol.
+ *   @passed: The number of calls passed to the C library.
+ */
+
+struct real_t {
+	pthread_once_t once;
+	bool stats;
+	unsigned long handled, passed;
+
+	int (*vfprintf)(FILE *, const char *, va_list);
+	int (*vsprintf)(char *, const char *, va_list);
+	int (*vsnprintf)(char *, size_t, const char *, va_list);
+	int (*vfprintf_chk)(FILE *, int, const char *, va_list);
+	int (*vsprintf_chk)(char *, int, size_t, const char *, va_list);
+	int (*vsnprintf_chk)(char *, size_t, int, size_t, const char *, va_list);
+};
+
+static struct real_t real = { .once = PTHREAD_ONCE_INIT };
+
+/*
+ * fortified entry points, not declared by the C library headers
+ */
+
+int __printf_chk(int flag, const char *fmt, ...);
+int __fprintf_chk(FILE *file, int flag, const char *fmt, ...);
+int __sprintf_chk(char *buf, int flag, size_t slen, const char *fmt, ...);
+int __snprintf_chk(char *buf, size_t size, int flag, size_t slen, const char *fmt, ...);
+int __vprintf_chk(int flag, const char *fmt, va_list args);
+int __vfprintf_chk(FILE *file, int flag, const char *fmt, va_list args);
+int __vsprintf_chk(char *buf, int flag, size_t slen, const char *fmt, va_list args);
+int __vsnprintf_chk(char *buf, size_t size, int flag, size_t slen, const char *fmt, va_list args);
+void __chk_fail(void) __attribute__((noreturn));
+
+/*
+ * local function declarations
+ */
+
+static void shim_init(void);
+static void shim_fini(void) __attribute__((destructor));
+static bool shim_accept(const char *fmt);
+static int shim_write(FILE *file, const char *fmt, va_list args);
+
+
+/**
+ * Formatted print to standard output.
+ *   @fmt: The format.
+ *   &returns: The number of characters written, negative on error.
+ */
+
+int printf(const char *fmt, ...)
+{
+	int len;
+	va_list args;
+
+	va_start(args, fmt);
+	len = vfprintf(stdout, fmt, args);
+	va_end(args);
+
+	return len;
+}
+
+/**
+ * Formatted print to a stream.
+ *   @file: The stream.
+ *   @fmt: The format.
+ *   &returns: The number of characters written, negative on error.
+ */
+
+int fprintf(FILE *file, const char *fmt, ...)
+{
+	int len;
+	va_list args;
+
+	va_start(args, fmt);
+	len = vfprintf(file, fmt, args);
+	va_end(args);
+
+	return len;
+}
+
+/**
+ * Formatted print to an unbounded buffer.
+ *   @buf: The buffer.
+ *   @fmt: The format.
+ *   &returns: The number of characters written.
+ */
+
+int sprintf(char *buf, const char *fmt, ...)
+{
+	int len;
+	va_list args;
+
+	va_start(args, fmt);
+	len = vsprintf(buf, fmt, args);
+	va_end(args);
+
+	return len;
+}
+
+/**
+ * Formatted print to a bounded buffer.
+ *   @buf: The buffer.
+ *   @size: The buffer size.
+ *   @fmt: The format.
+ *   &returns: The length of the full output.
+ */
+
+int snprintf(char *buf, size_t size, const char *fmt, ...)
+{
+	int len;
+	va_list args;
+
+	va_start(args, fmt);
+	len = vsnprintf(buf, size, fmt, args);
+	va_end(args);
+
+	return len;
+}
+
+/**
+ * Formatted print to standard output from an argument list.
+ *   @fmt: The format.
+ *   @args: The argument list.
+ *   &returns: The number of characters written, negative on error.
+ */
+
+int vprintf(const char *fmt, va_list args)
+{
+	return vfprintf(stdout, fmt, args);
+}
+
+/**
+ * Formatted print to a stream from an argument list.
+ *   @file: The stream.
+ *   @fmt: The format.
+ *   @args: The argument list.
+ *   &returns: The number of characters written, negative on error.
+ */
+
+int vfprintf(FILE *file, const char *fmt, va_list args)
+{
+	if(shim_accept(fmt))
+		return shim_write(file, fmt, args);
+
+	return real.vfprintf(file, fmt, args);
+}
+
+/**
+ * Formatted print to an unbounded buffer from an argument list.
+ *   @buf: The buffer.
+ *   @fmt: The format.
+ *   @args: The argument list.
+ *   &returns: The number of characters written.
+ */
+
+int vsprintf(char *buf, const char *fmt, va_list args)
+{
+	if(shim_accept(fmt))
+		return errol_vsnprintf(buf, SIZE_MAX / 2, fmt, args);
+
+	return real.vsprintf(buf, fmt, args);
+}
+
+/**
+ * Formatted print to a bounded buffer from an argument list.
+ *   @buf: The buffer.
+ *   @size: The buffer size.
+ *   @fmt: The format.
+ *   @args: The argument list.
+ *   &returns: The length of the full output.
+ */
+
+int vsnprintf(char *buf, size_t size, const char *fmt, va_list args)
+{
+	if(shim_accept(fmt))
+		return errol_vsnprintf(buf, size, fmt, args);
+
+	return real.vsnprintf(buf, size, fmt, args);
+}
+
+/**
+ * Fortified printf.
+ *   @flag: The fortify level.
+ *   @fmt: The format.
+ *   &returns: The number of characters written, negative on error.
+ */
+
+int __printf_chk(int flag, const char *fmt, ...)
+{
+	int len;
+	va_list args;
+
+	va_start(args, fmt);
+	len = __vfprintf_chk(stdout, flag, fmt, args);
+	va_end(args);
+
+	return len;
+}
+
+/**
+ * Fortified fprintf.
+ *   @file: The stream.
+ *   @flag: The fortify level.
+ *   @fmt: The format.
+ *   &returns: The number of characters written, negative on error.
+ */
+
+int __fprintf_chk(FILE *file, int flag, const char *fmt, ...)
+{
+	int len;
+	va_list args;
+
+	va_start(args, fmt);
+	len = __vfprintf_chk(file, flag, fmt, args);
+	va_end(args);
+
+	return len;
+}
+
+/**
+ * Fortified sprintf.
+ *   @buf: The buffer.
+ *   @flag: The fortify level.
+ *   @slen: The object size of the buffer.
+ *   @fmt: The format.
+ *   &returns: The number of characters written.
+ */
+
+int __sprintf_chk(char *buf, int flag, size_t slen, const char *fmt, ...)
+{
+	int len;
+	va_list args;
+
+	va_start(args, fmt);
+	len = __vsprintf_chk(buf, flag, slen, fmt, args);
+	va_end(args);
+
+	return len;
+}
+
+/**
+ * Fortified snprintf.
+ *   @buf: The buffer.
+ *   @size: The buffer size.
+ *   @flag: The fortify level.
+ *   @slen: The object size of the buffer.
+ *   @fmt: The format.
+ *   &returns: The length of the full output.
+ */
+
+int __snprintf_chk(char *buf, size_t size, int flag, size_t slen, const char *fmt, ...)
+{
+	int len;
+	va_list args;
+
+	va_start(args, fmt);
+	len = __vsnprintf_chk(buf, size, flag, slen, fmt, args);
+	va_end(args);
+
+	return len;
+}
+
+/**
+ * Fortified vprintf.
+ *   @flag: The fortify level.
+ *   @fmt: The format.
+ *   @args: The argument list.
+ *   &returns: The number of characters written, negative on error.
+ */
+
+int __vprintf_chk(int flag, const char *fmt, va_list args)
+{
+	return __vfprintf_chk(stdout, flag, fmt, args);
+}
+
+/**
+ * Fortified vfprintf.
+ *   @file: The stream.
+ *   @flag: The fortify level.
+ *   @fmt: The format.
+ *   @args: The argument list.
+ *   &returns: The number of characters written, negative on error.
+ */
+
+int __vfprintf_chk(FILE *file, int flag, const char *fmt, va_list args)
+{
+	if(shim_accept(fmt))
+		return shim_write(file, fmt, args);
+
+	return real.vfprintf_chk(file, flag, fmt, args);
+}
+
+/**
+ * Fortified vsprintf, aborting on overflow of the buffer object.
+ *   @buf: The buffer.
+ *   @flag: The fortify level.
+ *   @slen: The object size of the buffer.
+ *   @fmt: The format.
+ *   @args: The argument list.
+ *   &returns: The number of characters written.
+ */
+
+int __vsprintf_chk(char *buf, int flag, size_t slen, const char *fmt, va_list args)
+{
+	int len;
+
+	if(!shim_accept(fmt))
+		return real.vsprintf_chk(buf, flag, slen, fmt, args);
+
+	len = errol_vsnprintf(buf, slen, fmt, args);
+	if((size_t)len >= slen)
+		__chk_fail();
+
+	return len;
+}
+
+/**
+ * Fortified vsnprintf, aborting if the size exceeds the buffer object.
+ *   @buf: The buffer.
+ *   @size: The buffer size.
+ *   @flag: The fortify level.
+ *   @slen: The object size of the buffer.
+ *   @fmt: The format.
+ *   @args: The argument list.
+ *   &returns: The length of the full output.
+ */
+
+int __vsnprintf_chk(char *buf, size_t size, int flag, size_t slen, const char *fmt, va_list args)
+{
+	if((slen < size) || !shim_accept(fmt))
+		return real.vsnprintf_chk(buf, size, flag, slen, fmt, args);
+
+	return errol_vsnprintf(buf, size, fmt, args);
+}
+
+
+/**
+ * Resolve the real functions, on first use since other constructors may
+ * print before ours runs. Called through pthread_once, so threads that
+ * print concurrently resolve them once.
+ */
+
+static void shim_init(void)
+{
+	int err = errno;
+
+	real.vfprintf = dlsym(RTLD_NEXT, "vfprintf");
+	real.vsprintf = dlsym(RTLD_NEXT, "vsprintf");
+	real.vsnprintf = dlsym(RTLD_NEXT, "vsnprintf");
+	real.vfprintf_chk = dlsym(RTLD_NEXT, "__vfprintf_chk");
+	real.vsprintf_chk = dlsym(RTLD_NEXT, "__vsprintf_chk");
+	real.vsnprintf_chk = dlsym(RTLD_NEXT, "__vsnprintf_chk");
+	real.stats = (getenv("ERROL_PRELOAD_STATS") != NULL);
+
+	/* a passed %m still sees the caller's errno */
+
+	errno = err;
+}
+
+/**
+ * Report the call counts to standard error, if requested.
+ */
+
+static void shim_fini(void)
+{
+	char buf[128];
+
+	if(!real.stats)
+		return;
+
+	errol_snprintf(buf, sizeof(buf), "errol-preload: %lu handled, %lu passed\n", real.handled, real.passed);
+	fputs(buf, stderr);
+}
+
+/**
+ * Check if a format has a floating-point conversion and nothing that
+ * errol_vsnprintf handles differently from the C library: positional
+ * arguments, %n, %m, %p, wide characters, long doubles, which glibc also
+ * reads for 'll' on floating conversions, the grouping flag, or a locale
+ * decimal point other than '.'.
+ *   @fmt: The format.
+ *   &returns: True if Errol should format it.
+ */
+
+static bool shim_accept(const char *fmt)
+{
+	char mod;
+	bool flt = false;
+
+	pthread_once(&real.once, shim_init);
+
+	while((fmt = strchr(fmt, '%')) != NULL) {
+		fmt += 1 + strspn(fmt + 1, "-+ #0");
+		if(*fmt == '*')
+			fmt++;
+		else {
+			while((*fmt >= '0') && (*fmt <= '9'))
+				fmt++;
+		}
+
+		if(*fmt == '.') {
+			if(*++fmt == '*')
+				fmt++;
+			else {
+				while((*fmt >= '0') && (*fmt <= '9'))
+					fmt++;
+			}
+		}
+
+		mod = '\0';
+		if((fmt[0] == 'h') && (fmt[1] == 'h'))
+			fmt += 2;
+		else if((fmt[0] == 'l') && (fmt[1] == 'l'))
+			fmt += 2, mod = 'q';
+		else if((*fmt != '\0') && strchr("hljztL", *fmt))
+			mod = *fmt++;
+
+		if((*fmt == '\0') || (mod == 'L') || ((mod == 'q') && strchr("eEfFgGaA", *fmt)))
+			break;
+		else if(strchr("eEfFgGaA", *fmt))
+			flt = true;
+		else if(!strchr("diouxX%cs", *fmt) || ((mod == 'l') && ((*fmt == 'c') || (*fmt == 's'))))
+			break;
+
+		fmt++;
+	}
+
+	flt = flt && (fmt == NULL) && (strcmp(nl_langinfo(RADIXCHAR), ".") == 0);
+	if(real.stats)
+		__atomic_fetch_add(flt ? &real.handled : &real.passed, 1, __ATOMIC_RELAXED);
+
+	return flt;
+}
+
+/**
+ * Format with Errol and write to a stream.
+ *   @file: The stream.
+ *   @fmt: The format.
+ *   @args: The argument list.
+ *   &returns: The number of characters written, negative on error.
+ */
+
+static int shim_write(FILE *file, const char *fmt, va_list args)
+{
+	int len;
+	char buf[512], *str = buf;
+	va_list copy;
+
+	va_copy(copy, args);
+	len = errol_vsnprintf(buf, sizeof(buf), fmt, copy);
+	va_end(copy);
+
+	if(len >= (int)sizeof(buf)) {
+		str = malloc(len + 1);
+		if(str == NULL)
+			return -1;
+
+		errol_vsnprintf(str, len + 1, fmt, args);
+	}
+
+	if(fwrite(str, 1, len, file) < (size_t)len)
+		len = -1;
+
+	if(str != buf)
+		free(str);
+
+	return len;
+}
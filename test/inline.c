@@ -0,0 +1,84 @@
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#define ERROL_STATIC
+#include <errol_all.h>
+
+
+/*
+ * local function declarations
+ */
+
+static inline uint64_t rdtsc(void);
+
+
+/**
+ * JSON double to string through this file's static copy of Errol.
+ *   @val: The value.
+ *   @buf: The output buffer.
+ *   &returns: The length.
+ */
+
+int inline_json(double val, char *buf)
+{
+	return errol_json_dtoa(val, buf);
+}
+
+/**
+ * Benchmark serializing a row of magnitudes near a value as a JSON array
+ * through the static copy of Errol, where the conversion is inlined into
+ * the loop and knows its input is positive. Mirrors outline_bench.
+ *   @val: The value.
+ *   &returns: The number of cycles.
+ */
+
+uint32_t inline_bench(double val)
+{
+	int i;
+	uint64_t tm;
+	double row[16];
+	char buf[16 * ERR_JSON_LEN], *p = buf;
+
+	for(i = 0; i < 16; i++)
+		row[i] = val * (1.0 + i / 64.0);
+
+	tm = rdtsc();
+	*p++ = '[';
+	for(i = 0; i < 16; i++) {
+		double mag = fabs(row[i]);
+
+		if(mag > 0.0)
+			p += errol_json_dtoa(mag, p);
+		else
+			*p++ = '0';
+
+		*p++ = ',';
+	}
+
+	p[-1] = ']';
+	tm = rdtsc() - tm;
+
+	__asm__ __volatile__("" : : "r" (buf) : "memory");
+
+	return tm;
+}
+
+
+/**
+ * Read the time source clock.
+ *   &returns: The source clock as a 64-bit unsignd integer.
+ */
+
+static inline uint64_t rdtsc(void)
+{
+	uint32_t a, d;
+
+	__asm__ __volatile__(
+			"rdtscp;"
+			: "=a" (a), "=d" (d)
+			:
+			: "%rcx", "%rbx", "memory");
+
+	return ((uint64_t)a) | (((uint64_t)d) << 32);
+}
@@ -1,11 +1,18 @@
+#include <double-conversion/double-conversion.h>
 #include <double-conversion/fast-dtoa.h>
 #include <errol.h>
+#include <errol.hpp>
 #include "dragon4.h"
 #include <stdio.h>
 #include <string.h>
 #include <cmath>
+#include <codecvt>
+#include <iomanip>
 #include <random>
+#include <sstream>
+#include <string>
 #include <immintrin.h>
+#include <quadmath.h>
 
 /*
  * namespaces
@@ -78,6 +85,86 @@ extern "C" double rndval(double lower, double upper)
 }
 
 
+/**
+ * Retrieve a random index.
+ *   @n: The number of indices.
+ *   &returns: The random index within [0, n).
+ */
+
+extern "C" uint32_t rndidx(uint32_t n)
+{
+	std::uniform_int_distribution<uint32_t> dist(0, n - 1);
+
+	return dist(global_rng());
+}
+
+/**
+ * Create a random positive, finite binary128 value. Half of the values have
+ * a random number of trailing significand bits cleared.
+ *   &returns: The random value.
+ */
+
+extern "C" __float128 rndvalq()
+{
+	errol_qbits_t r;
+	std::uniform_int_distribution<uint64_t> dist(0, 0x7FFEFFFFFFFFFFFF);
+	std::uniform_int_distribution<unsigned int> bits(0, 223);
+
+	do {
+		unsigned int n = bits(global_rng());
+
+		r.i = ((__uint128_t)dist(global_rng()) << 64) | global_rng()();
+		if(n < 112)
+			r.i &= ~(((__uint128_t)1 << n) - 1);
+	} while(r.i == 0);
+
+	return r.q;
+}
+
+/**
+ * Retrieve a random binary32 value.
+ *   &returns: The random, positive, finite value.
+ */
+
+extern "C" float rndvalf()
+{
+	errol_fbits_t r;
+	std::uniform_int_distribution<uint32_t> dist(1, 0x7F7FFFFF);
+
+	r.i = dist(global_rng());
+
+	return r.f;
+}
+
+/**
+ * Retrieve a random x87 extended precision value.
+ *   &returns: The random, positive, finite value.
+ */
+
+extern "C" long double rndvalld()
+{
+	errol_ldbits_t r = { 0 };
+	std::uniform_int_distribution<unsigned int> exp(0, 0x7FFE);
+	std::uniform_int_distribution<unsigned int> bits(0, 127);
+
+	do {
+		unsigned int n = bits(global_rng());
+
+		r.s.exp = exp(global_rng());
+		r.s.m = global_rng()();
+		if(r.s.exp > 0)
+			r.s.m |= 1ULL << 63;
+		else
+			r.s.m &= ~(1ULL << 63);
+
+		if(n < 63)
+			r.s.m &= ~((1ULL << n) - 1);
+	} while(r.s.m == 0);
+
+	return r.ld;
+}
+
+
 /**
  * Seed the global random engine.
  *   @value: The seed to use.
@@ -136,6 +223,102 @@ extern "C" int grisu3_proc(double val, char *buf, bool *suc)
 }
 
 
+/**
+ * Convert a double using the ECMAScript converter of double-conversion.
+ *   @val: The value.
+ *   @buf: The output buffer.
+ *   &returns: The length of the string.
+ */
+
+extern "C" int ecma_proc(double val, char *buf)
+{
+	int len;
+	StringBuilder builder(buf, 100);
+
+	DoubleToStringConverter::EcmaScriptConverter().ToShortest(val, &builder);
+	len = builder.position();
+	builder.Finalize();
+
+	return len;
+}
+
+/**
+ * Benchmark JSON double to string using Errol.
+ *   @val: The value.
+ *   &returns: The number of cycles.
+ */
+
+extern "C" uint32_t errolj_bench(double val)
+{
+	uint64_t tm;
+	char buf[ERR_JSON_LEN];
+
+	tm = rdtsc();
+	errol_json_dtoa(val, buf);
+	tm = rdtsc() - tm;
+
+	return tm;
+}
+
+/**
+ * Benchmark serializing a row of magnitudes near a value as a JSON array
+ * through calls into liberrol. Mirrors inline_bench.
+ *   @val: The value.
+ *   &returns: The number of cycles.
+ */
+
+extern "C" uint32_t outline_bench(double val)
+{
+	int i;
+	uint64_t tm;
+	double row[16];
+	char buf[16 * ERR_JSON_LEN], *p = buf;
+
+	for(i = 0; i < 16; i++)
+		row[i] = val * (1.0 + i / 64.0);
+
+	tm = rdtsc();
+	*p++ = '[';
+	for(i = 0; i < 16; i++) {
+		double mag = fabs(row[i]);
+
+		if(mag > 0.0)
+			p += errol_json_dtoa(mag, p);
+		else
+			*p++ = '0';
+
+		*p++ = ',';
+	}
+
+	p[-1] = ']';
+	tm = rdtsc() - tm;
+
+	__asm__ __volatile__("" : : "r" (buf) : "memory");
+
+	return tm;
+}
+
+/**
+ * Benchmark JSON double to string using the ECMAScript converter.
+ *   @val: The value.
+ *   &returns: The number of cycles.
+ */
+
+extern "C" uint32_t ecma_bench(double val)
+{
+	uint64_t tm;
+	char buf[100];
+	StringBuilder builder(buf, sizeof(buf));
+
+	tm = rdtsc();
+	DoubleToStringConverter::EcmaScriptConverter().ToShortest(val, &builder);
+	builder.Finalize();
+	tm = rdtsc() - tm;
+
+	return tm;
+}
+
+
 /**
  * Benchmark decimal to string using Dragon4.
  *   @val: The value.
@@ -214,6 +397,8 @@ extern "C" bool errolN_check(unsigned int n, double val)
 	case 2: errol2_dtoa(val, errol, &opt); break;
 	case 3: errol3_dtoa(val, errol); break;
 	case 4: errol4_dtoa(val, errol); break;
+	case 5: errol5_dtoa(val, errol); break;
+	case 6: errol6_dtoa(val, errol); break;
 	}
 
 	dragon4_proc(val, dragon);
@@ -261,6 +446,8 @@ extern "C" int errolN_proc(unsigned int n, double val, char *buf, bool *opt)
 	case 2: return errol2_dtoa(val, buf, opt);
 	case 3: return errol3_dtoa(val, buf);
 	case 4: return errol4_dtoa(val, buf);
+	case 5: return errol5_dtoa(val, buf);
+	case 6: return errol6_dtoa(val, buf);
 	}
 
 	assert(false);
@@ -312,6 +499,18 @@ extern "C" uint32_t errolN_bench(unsigned int n, double val, bool *suc)
 		tm = rdtsc() - tm;
 		break;
 
+	case 5:
+		tm = rdtsc();
+		errol5_dtoa(val, buf);
+		tm = rdtsc() - tm;
+		break;
+
+	case 6:
+		tm = rdtsc();
+		errol6_dtoa(val, buf);
+		tm = rdtsc() - tm;
+		break;
+
 	default:
 		assert(true);
 		tm = 0;
@@ -322,3 +521,404 @@ extern "C" uint32_t errolN_bench(unsigned int n, double val, bool *suc)
 
 	return tm;
 }
+
+/**
+ * Benchmark Errolq.
+ *   @val: The value.
+ *   &returns: The number of cycles.
+ */
+
+extern "C" uint32_t errolq_bench(__float128 val)
+{
+	uint64_t tm;
+	char buf[100];
+
+	tm = rdtsc();
+	errolq_dtoa(val, buf);
+	tm = rdtsc() - tm;
+
+	return tm;
+}
+
+/**
+ * Benchmark binary128 to string using quadmath_snprintf.
+ *   @val: The value.
+ *   &returns: The number of cycles.
+ */
+
+extern "C" uint32_t quadmath_bench(__float128 val)
+{
+	uint64_t tm;
+	char buf[100];
+
+	tm = rdtsc();
+	quadmath_snprintf(buf, sizeof(buf), "%.36Qe", val);
+	tm = rdtsc() - tm;
+
+	return tm;
+}
+
+/**
+ * Benchmark x87 extended precision to string using Errolld.
+ *   @val: The value.
+ *   &returns: The number of cycles.
+ */
+
+extern "C" uint32_t errolld_bench(long double val)
+{
+	uint64_t tm;
+	char buf[100];
+
+	tm = rdtsc();
+	errol_ldtoa(val, buf);
+	tm = rdtsc() - tm;
+
+	return tm;
+}
+
+/**
+ * Benchmark x87 extended precision to string using snprintf.
+ *   @val: The value.
+ *   &returns: The number of cycles.
+ */
+
+extern "C" uint32_t snprintfld_bench(long double val)
+{
+	uint64_t tm;
+	char buf[100];
+
+	tm = rdtsc();
+	snprintf(buf, sizeof(buf), "%.20Le", val);
+	tm = rdtsc() - tm;
+
+	return tm;
+}
+
+/**
+ * Benchmark exact double to string using Errol.
+ *   @val: The value.
+ *   &returns: The number of cycles.
+ */
+
+extern "C" uint32_t errolx_bench(double val)
+{
+	uint64_t tm;
+	char buf[ERR_EXACT_LEN];
+
+	tm = rdtsc();
+	errol_dtoa_exact(val, buf);
+	tm = rdtsc() - tm;
+
+	return tm;
+}
+
+/**
+ * Benchmark exact double to string using snprintf.
+ *   @val: The value.
+ *   &returns: The number of cycles.
+ */
+
+extern "C" uint32_t snprintfx_bench(double val)
+{
+	uint64_t tm;
+	char buf[ERR_EXACT_LEN + 16];
+
+	tm = rdtsc();
+	snprintf(buf, sizeof(buf), "%.767e", val);
+	tm = rdtsc() - tm;
+
+	return tm;
+}
+
+/**
+ * Check the conversions in one character type against char output.
+ *   @val: The value.
+ *   @json: The errol_json_dtoa output.
+ *   @len: Its length.
+ *   @dig: The errol6_dtoa digits, if the value is finite and nonzero.
+ *   @exp: Their exponent.
+ *   &returns: True if the outputs match.
+ */
+
+template<class CharT>
+static bool wide_match(double val, const char *json, int len, const char *dig, int exp)
+{
+	CharT buf[ERR_JSON_LEN];
+	bool ok = (errol::json_dtoa(val, buf) == len);
+
+	for(int i = 0; ok && (i <= len); i++)
+		ok = (buf[i] == (CharT)json[i]);
+
+	if(ok && (val == val) && (val - val == 0.0) && (val != 0.0)) {
+		ok = (errol::dtoa(val, buf) == exp);
+		for(int i = 0; ok && (dig[i] != '\0'); i++)
+			ok = (buf[i] == (CharT)dig[i]);
+	}
+
+	return ok;
+}
+
+/**
+ * Check the character-type conversions against their char counterparts.
+ *   @val: The value.
+ *   &returns: True if every character type matches.
+ */
+
+extern "C" bool wide_check(double val)
+{
+	int len, exp = 0;
+	char json[ERR_JSON_LEN], dig[ERR_LEN];
+
+	len = errol_json_dtoa(val, json);
+	if((val == val) && (val - val == 0.0) && (val != 0.0))
+		exp = errol6_dtoa(fabs(val), dig);
+
+	return wide_match<char>(val, json, len, dig, exp) && wide_match<char16_t>(val, json, len, dig, exp) &&
+	       wide_match<char32_t>(val, json, len, dig, exp) && wide_match<wchar_t>(val, json, len, dig, exp);
+}
+
+/**
+ * Benchmark UTF-16 JSON output directly from errol::json_dtoa.
+ *   @val: The value.
+ *   &returns: The number of cycles.
+ */
+
+extern "C" uint32_t errolw_bench(double val)
+{
+	uint64_t tm;
+	char16_t buf[ERR_JSON_LEN];
+
+	tm = rdtsc();
+	errol::json_dtoa(val, buf);
+	tm = rdtsc() - tm;
+
+	return tm;
+}
+
+/**
+ * Benchmark UTF-16 JSON output through char and a widening pass.
+ *   @val: The value.
+ *   &returns: The number of cycles.
+ */
+
+extern "C" uint32_t widen_bench(double val)
+{
+	int i, len;
+	uint64_t tm;
+	char buf[ERR_JSON_LEN];
+	char16_t wbuf[ERR_JSON_LEN];
+
+	tm = rdtsc();
+	len = errol_json_dtoa(val, buf);
+	for(i = 0; i <= len; i++)
+		wbuf[i] = buf[i];
+	tm = rdtsc() - tm;
+
+	__asm__ __volatile__("" : : "r" (wbuf) : "memory");
+
+	return tm;
+}
+
+/**
+ * Benchmark UTF-16 JSON output through char and std::wstring_convert.
+ *   @val: The value.
+ *   &returns: The number of cycles.
+ */
+
+extern "C" uint32_t codecvt_bench(double val)
+{
+	uint64_t tm;
+	char buf[ERR_JSON_LEN];
+	static std::wstring_convert<std::codecvt_utf8_utf16<char16_t>, char16_t> conv;
+
+	tm = rdtsc();
+	errol_json_dtoa(val, buf);
+	std::u16string str = conv.from_bytes(buf);
+	tm = rdtsc() - tm;
+
+	return tm;
+}
+
+/**
+ * Stream a double with random stream state.
+ *   @val: The value.
+ *   @mode: The floatfield in bits 0-1 (none, fixed, scientific, both), showpoint
+ *     in bit 2, showpos in bit 3, uppercase in bit 4, the adjustfield in bits
+ *     5-6 (none, left, right, internal), and the manipulator in bit 7.
+ *   @prec: The precision.
+ *   @width: The width.
+ *   @errol: Use Errol if set, otherwise std::num_put.
+ *   @buf: The output buffer, at least 1024 bytes.
+ *   &returns: The output length.
+ */
+
+extern "C" int stream_proc(double val, unsigned int mode, int prec, int width, bool errol, char *buf)
+{
+	static const std::ios_base::fmtflags field[4] = { std::ios_base::fmtflags(0), std::ios_base::fixed, std::ios_base::scientific, std::ios_base::fixed | std::ios_base::scientific };
+	static const std::ios_base::fmtflags adjust[4] = { std::ios_base::fmtflags(0), std::ios_base::left, std::ios_base::right, std::ios_base::internal };
+	static const std::locale loc(std::locale::classic(), new errol::num_put<char>);
+	std::ostringstream os;
+
+	if(errol && !(mode & 0x80))
+		os.imbue(loc);
+
+	os.flags(field[mode & 0x3] | adjust[(mode >> 5) & 0x3]);
+	if(mode & 0x4)
+		os.setf(std::ios_base::showpoint);
+
+	if(mode & 0x8)
+		os.setf(std::ios_base::showpos);
+
+	if(mode & 0x10)
+		os.setf(std::ios_base::uppercase);
+
+	os << std::setprecision(prec) << std::setfill('*') << std::setw(width);
+	if(errol && (mode & 0x80))
+		os << errol::put_double(val) << '|';
+	else
+		os << val << '|';
+
+	snprintf(buf, 1024, "%s", os.str().c_str());
+
+	return os.str().size();
+}
+
+/**
+ * Stream buffer over a fixed array, for benchmarking.
+ */
+
+class bench_buf : public std::streambuf {
+public:
+	char data[512];
+
+	void reset() { setp(data, data + sizeof(data)); }
+};
+
+/**
+ * Benchmark streaming a double.
+ *   @val: The value.
+ *   @prec: The precision.
+ *   @kind: The formatter, std::num_put, errol::num_put, or errol::put_double.
+ *   &returns: The number of cycles.
+ */
+
+extern "C" uint32_t stream_bench(double val, int prec, int kind)
+{
+	static bench_buf buf;
+	static std::ostream os(&buf), eos(&buf);
+	static bool init = false;
+	uint64_t tm;
+
+	if(!init) {
+		eos.imbue(std::locale(std::locale::classic(), new errol::num_put<char>));
+		init = true;
+	}
+
+	buf.reset();
+	os.precision(prec);
+	eos.precision(prec);
+
+	tm = rdtsc();
+	if(kind == 0)
+		os << val;
+	else if(kind == 1)
+		eos << val;
+	else
+		os << errol::put_double(val);
+	tm = rdtsc() - tm;
+
+	return tm;
+}
+
+/**
+ * Benchmark formatting a double using errol_snprintf.
+ *   @fmt: The format string.
+ *   @val: The value.
+ *   &returns: The number of cycles.
+ */
+
+extern "C" uint32_t errolp_bench(const char *fmt, double val)
+{
+	uint64_t tm;
+	char buf[512];
+
+	tm = rdtsc();
+	errol_snprintf(buf, sizeof(buf), fmt, val);
+	tm = rdtsc() - tm;
+
+	return tm;
+}
+
+/**
+ * Benchmark formatting a double using snprintf.
+ *   @fmt: The format string.
+ *   @val: The value.
+ *   &returns: The number of cycles.
+ */
+
+extern "C" uint32_t snprintfp_bench(const char *fmt, double val)
+{
+	uint64_t tm;
+	char buf[512];
+
+	tm = rdtsc();
+	snprintf(buf, sizeof(buf), fmt, val);
+	tm = rdtsc() - tm;
+
+	return tm;
+}
+
+/**
+ * Benchmark double to string using the cached Errol3.
+ *   @val: The value.
+ *   &returns: The number of cycles.
+ */
+
+extern "C" uint32_t errol3c_bench(double val)
+{
+	uint64_t tm;
+	char buf[100];
+
+	tm = rdtsc();
+	errol3c_dtoa(val, buf);
+	tm = rdtsc() - tm;
+
+	return tm;
+}
+
+/**
+ * Benchmark double to string using the Errol3 sequence converter.
+ *   @seq: The sequence state.
+ *   @val: The value.
+ *   &returns: The number of cycles.
+ */
+
+extern "C" uint32_t errol_seq_bench(struct errol_seq_t *seq, double val)
+{
+	uint64_t tm;
+	char buf[100];
+
+	tm = rdtsc();
+	errol_seq_dtoa(seq, val, buf);
+	tm = rdtsc() - tm;
+
+	return tm;
+}
+
+/**
+ * Benchmark float-originated double to string using Errol3f.
+ *   @val: The value.
+ *   &returns: The number of cycles.
+ */
+
+extern "C" uint32_t errol3f_bench(double val)
+{
+	uint64_t tm;
+	char buf[100];
+
+	tm = rdtsc();
+	errol3f_dtoa(val, buf);
+	tm = rdtsc() - tm;
+
+	return tm;
+}
@@ -8,6 +8,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include <unistd.h>
+#include <wchar.h>
 #include <errol.h>
 #include <gmp.h>
 #include <inttypes.h>
@@ -23,6 +24,7 @@ static bool opt_real(char ***arg, const char *pre, double *num);
 
 static int intsort(const void *left, const void *right);
 static int err_t_sort(const void *left, const void *right);
+static int dblsort(const void *left, const void *right);
 
 static double chk_conv(double val, const char *str, int exp, bool *cor, bool *opt, bool *best);
 
@@ -30,11 +32,31 @@ static void table_add(struct errol_err_t[static 1024], int i, double val);
 static void table_enum(unsigned int ver, bool bld);
 static void table_to_tree(struct errol_err_t *table, int n);
 
+static bool errolf_check(float val, bool verbose);
+static bool errolq_check(__float128 val, bool verbose);
+static __float128 table_valq(int e, unsigned int p, __uint128_t k);
+static bool errolld_check(long double val, bool verbose);
+static long double table_valld(int e, unsigned int p, __uint128_t k);
+static bool errolN_dcheck(unsigned int n, double val, bool verbose);
+static double table_vald(int e, unsigned int p, __uint128_t k);
+static bool table_checkw(unsigned int P, unsigned int E, int e, unsigned int p, __uint128_t k);
+static void table_enumw(unsigned int P, unsigned int E);
+static void table_lookupq(void);
+static void table_lookupi(void);
+static void table_lookupx(void);
+static int width_fit(double val, int d, int *k);
+static void width_trunc(char *str);
+static void table_limbs(FILE *file, const char *name, unsigned int b, unsigned int n);
+static uint32_t table_valh(uint16_t val, unsigned int P, unsigned int E, int *q, bool *asym);
+static void table_lookuph(void);
+static void table_checkh(void);
+
 /*
  * interop function declarations
  */
 
 double rndval(double lower, double upper);
+uint32_t rndidx(uint32_t n);
 void reseed(uint_fast64_t value);
 uint_fast64_t get_seed();
 
@@ -49,11 +71,57 @@ bool errolNu_check(unsigned int n, double val);
 int errolN_proc(unsigned int n, double val, char *buf, bool *opt);
 uint32_t errolN_bench(unsigned int n, double val, bool *suc);
 
+float rndvalf(void);
+uint32_t errol3f_bench(double val);
+uint32_t errol3c_bench(double val);
+uint32_t errol_seq_bench(struct errol_seq_t *seq, double val);
+__float128 rndvalq(void);
+uint32_t errolq_bench(__float128 val);
+uint32_t quadmath_bench(__float128 val);
+long double rndvalld(void);
+uint32_t errolld_bench(long double val);
+uint32_t snprintfld_bench(long double val);
+uint32_t errolx_bench(double val);
+uint32_t snprintfx_bench(double val);
+uint32_t errolp_bench(const char *fmt, double val);
+uint32_t snprintfp_bench(const char *fmt, double val);
+int stream_proc(double val, unsigned int mode, int prec, int width, bool errol, char *buf);
+uint32_t stream_bench(double val, int prec, int kind);
+bool wide_check(double val);
+uint32_t errolw_bench(double val);
+uint32_t widen_bench(double val);
+uint32_t codecvt_bench(double val);
+uint32_t errolj_bench(double val);
+uint32_t outline_bench(double val);
+uint32_t ecma_bench(double val);
+int ecma_proc(double val, char *buf);
+
 /*
  * proof function declarations
  */
 
-int64_t *proof_enum(mpz_t delta, mpz_t m0, mpz_t alpha, mpz_t tau, unsigned int p);
+__int128_t *proof_enum(mpz_t delta, mpz_t m0, mpz_t alpha, mpz_t tau, unsigned int p);
+
+/*
+ * oracle function declarations
+ */
+
+int oracle_proc(mpz_t m, int q, bool asym, char *buf);
+int oraclef_proc(float val, char *buf);
+int oracleq_proc(__float128 val, char *buf);
+int oracleld_proc(long double val, char *buf);
+int oracle_in(double lo, double hi, char *buf);
+int oracle_dir(double val, bool up, char *buf);
+int oracle_exact(double val, char *buf);
+int oracleh_proc(uint16_t val, char *buf);
+int oraclebf_proc(uint16_t val, char *buf);
+
+/*
+ * amalgamation function declarations
+ */
+
+int inline_json(double val, char *buf);
+uint32_t inline_bench(double val);
 
 
 /**
@@ -66,8 +134,8 @@ int64_t *proof_enum(mpz_t delta, mpz_t m0, mpz_t alpha, mpz_t tau, unsigned int
 int main(int argc, char **argv)
 {
 	char **arg;
-	bool quiet = false, enum3 = false, enum4 = false, check3 = false, check4 = false;
-	int n, perf = 0, fuzz[5] = { 0, 0, 0, 0, 0 };
+	bool quiet = false, enum3 = false, enum4 = false, check3 = false, check4 = false, enumq = false, enumld = false, enum5 = false, enum6 = false, lookupq = false, lookupi = false, lookupx = false, lookuph = false, checkh = false;
+	int n, perf = 0, fuzz[7] = { 0, 0, 0, 0, 0, 0, 0 }, fuzzq = 0, perfq = 0, fuzzld = 0, perfld = 0, fuzzf = 0, perff = 0, cache = 0, seq = 0, fuzzin = 0, fuzzdir = 0, fuzzx = 0, perfx = 0, fuzzkey = 0, fuzzbid = 0, fuzzjson = 0, perfjson = 0, fuzzwidth = 0, fuzzprintf = 0, perfprintf = 0, fuzzstream = 0, perfstream = 0, fuzzwide = 0, perfwide = 0, fuzzamalg = 0, perfamalg = 0;
 	double lower = nextafter(0.0, DBL_MIN), upper = DBL_MAX;
 
 	for(arg = argv + 1; *arg != NULL; ) {
@@ -81,12 +149,68 @@ int main(int argc, char **argv)
 			fuzz[3] = n;
 		else if(opt_num(&arg, "fuzz4", &n))
 			fuzz[4] = n;
+		else if(opt_num(&arg, "fuzz5", &n))
+			fuzz[5] = n;
+		else if(opt_num(&arg, "fuzz6", &n))
+			fuzz[6] = n;
+		else if(opt_num(&arg, "fuzzf", &n))
+			fuzzf = n;
+		else if(opt_num(&arg, "fuzzin", &n))
+			fuzzin = n;
+		else if(opt_num(&arg, "fuzzdir", &n))
+			fuzzdir = n;
+		else if(opt_num(&arg, "fuzzx", &n))
+			fuzzx = n;
+		else if(opt_num(&arg, "perfx", &n))
+			perfx = n;
+		else if(opt_num(&arg, "fuzzkey", &n))
+			fuzzkey = n;
+		else if(opt_num(&arg, "fuzzbid", &n))
+			fuzzbid = n;
+		else if(opt_num(&arg, "fuzzjson", &n))
+			fuzzjson = n;
+		else if(opt_num(&arg, "perfjson", &n))
+			perfjson = n;
+		else if(opt_num(&arg, "fuzzwidth", &n))
+			fuzzwidth = n;
+		else if(opt_num(&arg, "fuzzprintf", &n))
+			fuzzprintf = n;
+		else if(opt_num(&arg, "perfprintf", &n))
+			perfprintf = n;
+		else if(opt_num(&arg, "fuzzstream", &n))
+			fuzzstream = n;
+		else if(opt_num(&arg, "perfstream", &n))
+			perfstream = n;
+		else if(opt_num(&arg, "fuzzwide", &n))
+			fuzzwide = n;
+		else if(opt_num(&arg, "perfwide", &n))
+			perfwide = n;
+		else if(opt_num(&arg, "fuzzamalg", &n))
+			fuzzamalg = n;
+		else if(opt_num(&arg, "perfamalg", &n))
+			perfamalg = n;
+		else if(opt_num(&arg, "perff", &n))
+			perff = n;
+		else if(opt_num(&arg, "fuzzq", &n))
+			fuzzq = n;
+		else if(opt_num(&arg, "perfq", &n))
+			perfq = n;
+		else if(opt_num(&arg, "fuzzld", &n))
+			fuzzld = n;
+		else if(opt_num(&arg, "perfld", &n))
+			perfld = n;
 		else if(opt_num(&arg, "perf", &n))
 			perf = n;
+		else if(opt_num(&arg, "cache", &n))
+			cache = n;
+		else if(opt_num(&arg, "seq", &n))
+			seq = n;
 		else if(opt_real(&arg, "lower", &lower))
 			;
 		else if(opt_real(&arg, "upper", &upper))
 			;
+		else if(opt_long(&arg, "subnormal", NULL))
+			lower = nextafter(0.0, DBL_MIN), upper = nextafter(DBL_MIN, 0.0);
 		else if(opt_long(&arg, "enum3", NULL))
 			enum3 = true;
 		else if(opt_long(&arg, "enum4", NULL))
@@ -95,6 +219,24 @@ int main(int argc, char **argv)
 			check3 = true;
 		else if(opt_long(&arg, "check4", NULL))
 			check4 = true;
+		else if(opt_long(&arg, "enumq", NULL))
+			enumq = true;
+		else if(opt_long(&arg, "enumld", NULL))
+			enumld = true;
+		else if(opt_long(&arg, "enum5", NULL))
+			enum5 = true;
+		else if(opt_long(&arg, "enum6", NULL))
+			enum6 = true;
+		else if(opt_long(&arg, "lookupq", NULL))
+			lookupq = true;
+		else if(opt_long(&arg, "lookupi", NULL))
+			lookupi = true;
+		else if(opt_long(&arg, "lookupx", NULL))
+			lookupx = true;
+		else if(opt_long(&arg, "lookuph", NULL))
+			lookuph = true;
+		else if(opt_long(&arg, "checkh", NULL))
+			checkh = true;
 		else
 			fprintf(stderr, "Invalid option '%s'.\n", *arg), abort();
 	}
@@ -106,7 +248,7 @@ int main(int argc, char **argv)
 
 	rndval(lower, upper);
 
-	for(n = 0; n < 5; n++) {
+	for(n = 0; n < 7; n++) {
 		unsigned int i, nfail = 0, subopt = 0, notbest = 0;
 
 		if(fuzz[n] == 0)
@@ -143,6 +285,704 @@ int main(int argc, char **argv)
 		printf("\x1b[G\x1b[KFuzzing Errol%u done on %u numbers, %u failures (%.3f%%), %u suboptimal (%.3f%%), %u notbest (%.3f%%)\n", n, fuzz[n], nfail, 100.0 * (double)nfail / (double)fuzz[n], subopt, 100.0 * (double)subopt / (double)fuzz[n], notbest, 100.0 * (double)notbest / (double)fuzz[n]);
 	}
 
+	if(fuzzf > 0) {
+		unsigned int i, nfail = 0;
+
+		for(i = 0; i < fuzzf; i++) {
+			if((i % 1000) == 0) {
+				printf("\x1b[G\x1b[KFuzzing Errolf... %uk/%uk %2.2f%%", i / 1000, fuzzf / 1000, 100.0 * (double)i / (double)fuzzf);
+				fflush(stdout);
+			}
+
+			if(!errolf_check(rndvalf(), !quiet))
+				nfail++;
+		}
+
+		printf("\x1b[G\x1b[KFuzzing Errolf done on %u numbers, %u failures (%.3f%%)\n", fuzzf, nfail, 100.0 * (double)nfail / (double)fuzzf);
+	}
+
+	if(fuzzq > 0) {
+		unsigned int i, nfail = 0;
+
+		for(i = 0; i < fuzzq; i++) {
+			if((i % 1000) == 0) {
+				printf("\x1b[G\x1b[KFuzzing Errolq... %uk/%uk %2.2f%%", i / 1000, fuzzq / 1000, 100.0 * (double)i / (double)fuzzq);
+				fflush(stdout);
+			}
+
+			if(!errolq_check(rndvalq(), !quiet))
+				nfail++;
+		}
+
+		printf("\x1b[G\x1b[KFuzzing Errolq done on %u numbers, %u failures (%.3f%%)\n", fuzzq, nfail, 100.0 * (double)nfail / (double)fuzzq);
+	}
+
+	if(fuzzld > 0) {
+		unsigned int i, nfail = 0;
+
+		for(i = 0; i < fuzzld; i++) {
+			if((i % 1000) == 0) {
+				printf("\x1b[G\x1b[KFuzzing Errolld... %uk/%uk %2.2f%%", i / 1000, fuzzld / 1000, 100.0 * (double)i / (double)fuzzld);
+				fflush(stdout);
+			}
+
+			if(!errolld_check(rndvalld(), !quiet))
+				nfail++;
+		}
+
+		printf("\x1b[G\x1b[KFuzzing Errolld done on %u numbers, %u failures (%.3f%%)\n", fuzzld, nfail, 100.0 * (double)nfail / (double)fuzzld);
+	}
+
+	if(fuzzin > 0) {
+		unsigned int i, nfail = 0;
+
+		/* wide intervals whose shortest candidates span several decades */
+
+		static const struct { double lo, hi; const char *str; int exp; } wide[] = {
+			{ 1.0, 100.0, "5", 2 }, { 2.0, 100.0, "5", 2 }, { 37.5, 112.5, "8", 2 },
+			{ 0.09, 0.5, "3", 0 }, { 9.0, 1e4, "5", 4 },
+		};
+
+		for(i = 0; i < sizeof(wide) / sizeof(wide[0]); i++) {
+			int exp;
+			char str[48];
+
+			exp = errol_shortest_in(wide[i].lo, wide[i].hi, str);
+			if((exp != wide[i].exp) || strcmp(str, wide[i].str)) {
+				if(!quiet)
+					fprintf(stderr, "Interval conversion failed for [%.17e, %.17e]. Expected 0.%se%d. Actual 0.%se%d.\n", wide[i].lo, wide[i].hi, wide[i].str, wide[i].exp, str, exp);
+
+				nfail++;
+			}
+		}
+
+		for(i = 0; i < fuzzin; i++) {
+			int exp, oexp;
+			char str[48], ostr[48], *o = ostr;
+			double val, lo, hi, tol;
+
+			if((i % 1000) == 0) {
+				printf("\x1b[G\x1b[KFuzzing Errol intervals... %uk/%uk %2.2f%%", i / 1000, fuzzin / 1000, 100.0 * (double)i / (double)fuzzin);
+				fflush(stdout);
+			}
+
+			/* alternate random intervals and random tolerances */
+			val = rndval(lower, upper);
+			if(i % 2 == 0) {
+				lo = val;
+				hi = rndval(lower, upper);
+				if(hi < lo)
+					tol = lo, lo = hi, hi = tol;
+				else if(hi == lo)
+					continue;
+
+				exp = errol_shortest_in(lo, hi, str);
+				oexp = oracle_in(lo, hi, ostr);
+			}
+			else {
+				tol = pow(10.0, -1.0 - rndidx(16));
+				lo = val - val * tol;
+				hi = fmin(val + val * tol, DBL_MAX);
+
+				/* negative values take the sign apart, and -0.0 is zero */
+
+				if(rndidx(2))
+					*o++ = '-', val = -val;
+
+				if(rndidx(64) == 0)
+					val = 0.0 * val, lo = hi = 0.0, o = ostr;
+
+				exp = errol_dtoa_tol(val, tol, str);
+				if(val == 0.0)
+					strcpy(o, "0"), oexp = 0;
+				else if((lo >= nextafter(fabs(val), 0.0)) && (hi <= nextafter(fabs(val), INFINITY)))
+					oexp = dragon4_proc(fabs(val), o);
+				else
+					oexp = oracle_in((lo > 0.0) ? lo : nextafter(0.0, 1.0), hi, o);
+			}
+
+			if((exp != oexp) || strcmp(str, ostr)) {
+				if(!quiet)
+					fprintf(stderr, "Interval conversion failed for [%.17e, %.17e]. Expected 0.%se%d. Actual 0.%se%d.\n", lo, hi, ostr, oexp, str, exp);
+
+				nfail++;
+			}
+		}
+
+		printf("\x1b[G\x1b[KFuzzing Errol intervals done on %u numbers, %u failures (%.3f%%)\n", fuzzin, nfail, 100.0 * (double)nfail / (double)fuzzin);
+	}
+
+	if(fuzzdir > 0) {
+		unsigned int i, nfail = 0;
+
+		for(i = 0; i < fuzzdir; i++) {
+			int exp, oexp;
+			bool up = (i % 2) == 0, neg = rndidx(2);
+			char str[48], ostr[48], chk[64];
+			double val;
+
+			if((i % 1000) == 0) {
+				printf("\x1b[G\x1b[KFuzzing Errol directed... %uk/%uk %2.2f%%", i / 1000, fuzzdir / 1000, 100.0 * (double)i / (double)fuzzdir);
+				fflush(stdout);
+			}
+
+			/* a negative bound rounds its magnitude the other way, and -0.0 is zero */
+
+			val = (rndidx(64) == 0) ? 0.0 : rndval(lower, upper);
+			if(neg)
+				val = -val;
+
+			neg = (val < 0.0);
+			if(neg)
+				ostr[0] = '-';
+
+			exp = up ? errol_dtoa_up(val, str) : errol_dtoa_down(val, str);
+			if(val == 0.0)
+				strcpy(ostr, "0"), oexp = 0;
+			else
+				oexp = oracle_dir(fabs(val), up != neg, ostr + neg);
+
+			sprintf(chk, "%s0.%se%d", neg ? "-" : "", str + neg, exp);
+
+			if((exp != oexp) || strcmp(str, ostr) || (strtod(chk, NULL) != val)) {
+				if(!quiet)
+					fprintf(stderr, "Directed conversion failed for %.17e (%s). Expected 0.%se%d. Actual 0.%se%d.\n", val, up ? "up" : "down", ostr, oexp, str, exp);
+
+				nfail++;
+			}
+		}
+
+		printf("\x1b[G\x1b[KFuzzing Errol directed done on %u numbers, %u failures (%.3f%%)\n", fuzzdir, nfail, 100.0 * (double)nfail / (double)fuzzdir);
+	}
+
+	if(fuzzx > 0) {
+		unsigned int i, nfail = 0;
+
+		for(i = 0; i < fuzzx; i++) {
+			int exp, oexp;
+			char str[ERR_EXACT_LEN], ostr[ERR_EXACT_LEN];
+			double val;
+
+			if((i % 1000) == 0) {
+				printf("\x1b[G\x1b[KFuzzing Errol exact... %uk/%uk %2.2f%%", i / 1000, fuzzx / 1000, 100.0 * (double)i / (double)fuzzx);
+				fflush(stdout);
+			}
+
+			val = rndval(lower, upper);
+			exp = errol_dtoa_exact(val, str);
+			oexp = oracle_exact(val, ostr);
+
+			if((exp != oexp) || strcmp(str, ostr)) {
+				if(!quiet)
+					fprintf(stderr, "Exact conversion failed for %.17e. Expected 0.%se%d. Actual 0.%se%d.\n", val, ostr, oexp, str, exp);
+
+				nfail++;
+			}
+		}
+
+		printf("\x1b[G\x1b[KFuzzing Errol exact done on %u numbers, %u failures (%.3f%%)\n", fuzzx, nfail, 100.0 * (double)nfail / (double)fuzzx);
+	}
+
+	if(fuzzkey > 0) {
+		unsigned int i, nfail = 0;
+		const double special[] = { 0.0, -0.0, INFINITY, -INFINITY, NAN, DBL_MAX, -DBL_MAX, DBL_MIN, nextafter(0.0, 1.0) };
+
+		for(i = 0; i < fuzzkey; i++) {
+			int j, cmp, ocmp;
+			char key[2][ERR_KEY_LEN];
+			double val[2];
+
+			if((i % 1000) == 0) {
+				printf("\x1b[G\x1b[KFuzzing Errol sort keys... %uk/%uk %2.2f%%", i / 1000, fuzzkey / 1000, 100.0 * (double)i / (double)fuzzkey);
+				fflush(stdout);
+			}
+
+			/* mix random pairs, neighbouring pairs and special values */
+			val[0] = rndval(lower, upper);
+			switch(i % 4) {
+			case 0: val[1] = rndval(lower, upper); break;
+			case 1: val[1] = nextafter(val[0], INFINITY); break;
+			case 2: val[1] = val[0] * (1.0 + 1.0 / (1 + rndidx(1000))); break;
+			default: val[1] = special[rndidx(sizeof(special) / sizeof(double))]; break;
+			}
+
+			for(j = 0; j < 2; j++) {
+				if(rndidx(2))
+					val[j] = -val[j];
+
+				errol_sortkey(val[j], key[j]);
+				if(!((val[j] == errol_sortkey_decode(key[j])) || (isnan(val[j]) && isnan(errol_sortkey_decode(key[j]))))) {
+					if(!quiet)
+						fprintf(stderr, "Sort key decoding failed for %.17e. Key %s.\n", val[j], key[j]);
+
+					nfail++;
+				}
+			}
+
+			cmp = strcmp(key[0], key[1]);
+			cmp = (cmp > 0) - (cmp < 0);
+			if(isnan(val[0]) || isnan(val[1]))
+				ocmp = isnan(val[0]) - isnan(val[1]);
+			else
+				ocmp = (val[0] > val[1]) - (val[0] < val[1]);
+
+			if(cmp != ocmp) {
+				if(!quiet)
+					fprintf(stderr, "Sort key order failed for %.17e (%s) and %.17e (%s).\n", val[0], key[0], val[1], key[1]);
+
+				nfail++;
+			}
+		}
+
+		printf("\x1b[G\x1b[KFuzzing Errol sort keys done on %u pairs, %u failures (%.3f%%)\n", fuzzkey, nfail, 100.0 * (double)nfail / (double)fuzzkey);
+	}
+
+	if(fuzzbid > 0) {
+		unsigned int i, nfail = 0;
+
+		for(i = 0; i < fuzzbid; i++) {
+			int j, exp, oexp;
+			bool neg, shortest = (i % 2) == 0;
+			char str[ERR_EXACT_LEN], ostr[ERR_EXACT_LEN];
+			uint64_t bid, c;
+			double val;
+
+			if((i % 1000) == 0) {
+				printf("\x1b[G\x1b[KFuzzing Errol decimal64... %uk/%uk %2.2f%%", i / 1000, fuzzbid / 1000, 100.0 * (double)i / (double)fuzzbid);
+				fflush(stdout);
+			}
+
+			val = rndval(lower, upper);
+			neg = rndidx(2);
+			bid = errol_to_decimal64_bid(neg ? -val : val, shortest);
+
+			/* decode the coefficient and exponent */
+			if((bid & (3ULL << 61)) == (3ULL << 61))
+				c = (bid & ((1ULL << 51) - 1)) | (1ULL << 53), exp = (int)((bid >> 51) & 0x3FF) - 398;
+			else
+				c = bid & ((1ULL << 53) - 1), exp = (int)((bid >> 53) & 0x3FF) - 398;
+
+			sprintf(str, "%" PRIu64, c);
+			exp += strlen(str);
+			for(j = strlen(str); str[j - 1] == '0'; j--)
+				str[j - 1] = '\0';
+
+			/* the exact digits rounded to 16, ties to even */
+			oexp = errol6_dtoa(val, ostr);
+			if(!shortest || (strlen(ostr) > 16)) {
+				oexp = oracle_exact(val, ostr);
+				if(strlen(ostr) > 16) {
+					bool up = (ostr[16] > '5') || ((ostr[16] == '5') && ((ostr[17] != '\0') || ((ostr[15] - '0') & 0x1)));
+
+					ostr[16] = '\0';
+					for(j = 15; up && (j >= 0); j--) {
+						if(ostr[j] == '9')
+							ostr[j] = '0';
+						else
+							ostr[j]++, up = false;
+					}
+
+					if(up)
+						strcpy(ostr, "1"), oexp++;
+
+					for(j = 16; ostr[j - 1] == '0'; j--)
+						ostr[j - 1] = '\0';
+				}
+			}
+
+			if((exp != oexp) || strcmp(str, ostr) || ((bid >> 63) != neg)) {
+				if(!quiet)
+					fprintf(stderr, "Decimal64 conversion failed for %.17e (%s). Expected 0.%se%d. Actual 0.%se%d.\n", val, shortest ? "shortest" : "rounded", ostr, oexp, str, exp);
+
+				nfail++;
+			}
+		}
+
+		printf("\x1b[G\x1b[KFuzzing Errol decimal64 done on %u numbers, %u failures (%.3f%%)\n", fuzzbid, nfail, 100.0 * (double)nfail / (double)fuzzbid);
+	}
+
+	if(fuzzjson > 0) {
+		unsigned int i, nfail = 0;
+
+		for(i = 0; i < fuzzjson; i++) {
+			int len, olen;
+			char str[ERR_JSON_LEN], ostr[100];
+			double val;
+
+			if((i % 1000) == 0) {
+				printf("\x1b[G\x1b[KFuzzing Errol JSON... %uk/%uk %2.2f%%", i / 1000, fuzzjson / 1000, 100.0 * (double)i / (double)fuzzjson);
+				fflush(stdout);
+			}
+
+			/* alternate random values and values near the notation switches */
+			val = pow(10.0, (double)rndidx(32) - 10.0);
+			if(i % 4 == 0)
+				val = rndval(lower, upper);
+			else if(i % 4 != 3)
+				val = rndval(val / 4.0, val * 4.0);
+
+			if(rndidx(2))
+				val = -val;
+
+			len = errol_json_dtoa(val, str);
+			olen = ecma_proc(val, ostr);
+
+			if((len != olen) || strcmp(str, ostr)) {
+				if(!quiet)
+					fprintf(stderr, "JSON conversion failed for %.17e. Expected %s. Actual %s.\n", val, ostr, str);
+
+				nfail++;
+			}
+		}
+
+		printf("\x1b[G\x1b[KFuzzing Errol JSON done on %u numbers, %u failures (%.3f%%)\n", fuzzjson, nfail, 100.0 * (double)nfail / (double)fuzzjson);
+	}
+
+	if(fuzzwidth > 0) {
+		unsigned int i, nfail = 0;
+
+		for(i = 0; i < fuzzwidth; i++) {
+			int j, k, d, width, flags, len;
+			bool ok, hash;
+			char str[64], trim[64], rnd[64];
+			const char *s;
+			double val;
+
+			if((i % 1000) == 0) {
+				printf("\x1b[G\x1b[KFuzzing Errol width... %uk/%uk %2.2f%%", i / 1000, fuzzwidth / 1000, 100.0 * (double)i / (double)fuzzwidth);
+				fflush(stdout);
+			}
+
+			val = (i % 2) ? rndval(lower, upper) : rndval(1e-8, 1e12);
+			if(i % 16 == 2)
+				val = (rndidx(4) == 0) ? DBL_MAX : rndval(1.7e308, DBL_MAX);
+
+			if(rndidx(2))
+				val = -val;
+
+			width = 1 + rndidx(24);
+			flags = rndidx(4);
+			errol_dtoa_width(val, width, flags, str);
+
+			/* the field is padded on the side away from the alignment */
+			for(j = 0, s = str; *s == ' '; s++);
+			while((*s != '\0') && (*s != ' '))
+				trim[j++] = *s++;
+
+			trim[j] = '\0';
+			len = j;
+			hash = (trim[0] == '#');
+			ok = ((int)strlen(str) == width) && (*s == '\0' || (flags & ERR_WIDTH_LEFT)) && ((str[0] != ' ') || !(flags & ERR_WIDTH_LEFT));
+
+			if(!(flags & ERR_WIDTH_ROUND) || (width_fit(val, 0, &k) <= width)) {
+				if(width_fit(val, 0, &k) <= width)
+					ok = ok && !hash && (strtod(trim, NULL) == val) && (len == width_fit(val, 0, &k));
+				else
+					ok = ok && hash;
+			}
+			else if(hash) {
+				/* fewer digits are not always shorter, as with 97 and 1e2 */
+				for(d = 1; d <= 17; d++)
+					ok = ok && (width_fit(val, d, &k) > width);
+			}
+			else {
+				/* correctly rounded, and one more digit would not fit */
+				for(d = 0, s = trim; (*s != '\0') && (*s != 'e'); s++) {
+					if((*s >= '1') && (*s <= '9'))
+						d = (s - trim) + 1;
+				}
+
+				for(j = 0, s = trim; (*s != '\0') && (*s != 'e'); s++) {
+					if((*s >= '0') && (*s <= '9') && ((j > 0) || (*s != '0')) && ((s - trim) < d))
+						j++;
+				}
+
+				sprintf(rnd, "%.*e", j - 1, val);
+				width_trunc(rnd);
+				ok = ok && (strtod(trim, NULL) == strtod(rnd, NULL)) && (len == width_fit(val, j, &k));
+				ok = ok && ((width_fit(val, j + 1, &k) > width) || (k <= j));
+			}
+
+			if(!ok) {
+				if(!quiet)
+					fprintf(stderr, "Width conversion failed for %.17e, width %d, flags %d. Actual '%s'.\n", val, width, flags, str);
+
+				nfail++;
+			}
+		}
+
+		/* a finite value never rounds to text that reads back as infinity */
+
+		{
+			char str[8];
+
+			errol_dtoa_width(DBL_MAX, 5, ERR_WIDTH_ROUND, str);
+			if(strcmp(str, "1e308")) {
+				if(!quiet)
+					fprintf(stderr, "Width conversion failed for DBL_MAX, width 5. Expected '1e308'. Actual '%s'.\n", str);
+
+				nfail++;
+			}
+		}
+
+		printf("\x1b[G\x1b[KFuzzing Errol width done on %u numbers, %u failures (%.3f%%)\n", fuzzwidth, nfail, 100.0 * (double)nfail / (double)fuzzwidth);
+	}
+
+	if(fuzzprintf > 0) {
+		unsigned int i, nfail = 0;
+
+		/* wide characters and strings, formatted by the C library */
+
+		static const char *wide[] = { "%ls|", "%-6ls|", "%.2ls|", "%lc|", "%3lc|" };
+
+		for(i = 0; i < sizeof(wide) / sizeof(wide[0]); i++) {
+			int len, olen;
+			char str[64], ostr[64];
+
+			if(strchr(wide[i], 's')) {
+				len = errol_snprintf(str, sizeof(str), wide[i], L"abc");
+				olen = snprintf(ostr, sizeof(ostr), wide[i], L"abc");
+			}
+			else {
+				len = errol_snprintf(str, sizeof(str), wide[i], (wint_t)L'z');
+				olen = snprintf(ostr, sizeof(ostr), wide[i], (wint_t)L'z');
+			}
+
+			if((len != olen) || strcmp(str, ostr)) {
+				if(!quiet)
+					fprintf(stderr, "printf conversion failed for '%s'. Expected '%s'. Actual '%s'.\n", wide[i], ostr, str);
+
+				nfail++;
+			}
+		}
+
+		/* grouping, positional arguments, and 'll' floats, formatted by the C library */
+
+		static const char *posix[] = { "%'.2f|%d", "%'g|%'d", "%1$g %1$e|%2$d", "%2$d %1$.3f", "%1$'f|%2$'5d", "%%%'f%d", "%llg|", "%-12.3lle|" };
+
+		for(i = 0; i < sizeof(posix) / sizeof(posix[0]); i++) {
+			int len, olen;
+			char str[64], ostr[64];
+
+			if(strstr(posix[i], "ll")) {
+				len = errol_snprintf(str, sizeof(str), posix[i], 1234567.891L);
+				olen = snprintf(ostr, sizeof(ostr), posix[i], 1234567.891L);
+			}
+			else {
+				len = errol_snprintf(str, sizeof(str), posix[i], 1234567.891, 42);
+				olen = snprintf(ostr, sizeof(ostr), posix[i], 1234567.891, 42);
+			}
+
+			if((len != olen) || strcmp(str, ostr)) {
+				if(!quiet)
+					fprintf(stderr, "printf conversion failed for '%s'. Expected '%s'. Actual '%s'.\n", posix[i], ostr, str);
+
+				nfail++;
+			}
+		}
+
+		for(i = 0; i < fuzzprintf; i++) {
+			int j, len, olen;
+			size_t size;
+			char fmt[32], str[1024], ostr[1024];
+			double val;
+			long double lval;
+			int64_t ival;
+
+			if((i % 1000) == 0) {
+				printf("\x1b[G\x1b[KFuzzing Errol printf... %uk/%uk %2.2f%%", i / 1000, fuzzprintf / 1000, 100.0 * (double)i / (double)fuzzprintf);
+				fflush(stdout);
+			}
+
+			/* random flags, width, and precision */
+			j = 0;
+			fmt[j++] = '%';
+			for(const char *f = "-+ #0"; *f != '\0'; f++) {
+				if(rndidx(4) == 0)
+					fmt[j++] = *f;
+			}
+
+			if(rndidx(2))
+				j += sprintf(fmt + j, "%u", rndidx(30));
+
+			if(rndidx(2))
+				j += sprintf(fmt + j, ".%u", rndidx(4) ? rndidx(25) : rndidx(400));
+
+			/* mostly floats, near ties and notation switches too */
+			size = rndidx(4) ? sizeof(str) : rndidx(40);
+			if(i % 8 == 7) {
+				const char *mod[5] = { "", "l", "ll", "h", "hh" };
+				int k = rndidx(5);
+
+				ival = ((int64_t)rndidx(~0U) << 32) | rndidx(~0U);
+				ival >>= rndidx(64);
+				sprintf(fmt + j, "%s%c", mod[k], "diuoxX"[rndidx(6)]);
+				if(k == 1 || k == 2) {
+					len = errol_snprintf(str, size, fmt, (long long)ival);
+					olen = snprintf(ostr, size, fmt, (long long)ival);
+				}
+				else {
+					len = errol_snprintf(str, size, fmt, (int)ival);
+					olen = snprintf(ostr, size, fmt, (int)ival);
+				}
+			}
+			else if(i % 8 == 6) {
+				/* long doubles, with more precision and range than doubles */
+				sprintf(fmt + j, "L%c", "eEfFgGaA"[rndidx(8)]);
+
+				lval = (long double)rndval(lower, upper) / 3.0L;
+				if(rndidx(4) == 0)
+					lval = powl(10.0L, (long double)rndidx(9000) - 4500.0L) * (1.0L + (long double)rndidx(~0U) / 4294967296.0L);
+				else if(rndidx(64) == 0)
+					lval = (long double[]){ 0.0L, INFINITY, NAN, LDBL_MAX, LDBL_MIN / 3.0L }[rndidx(5)];
+
+				if(rndidx(2))
+					lval = -lval;
+
+				len = errol_snprintf(str, size, fmt, lval);
+				olen = snprintf(ostr, size, fmt, lval);
+			}
+			else {
+				fmt[j++] = "eEfFgGaA"[rndidx(8)];
+				fmt[j] = '\0';
+
+				val = pow(10.0, (double)rndidx(40) - 20.0);
+				if(i % 4 == 0)
+					val = rndval(lower, upper);
+				else if(i % 4 == 1)
+					val = rndval(val / 4.0, val * 4.0);
+				else if(i % 4 == 2)
+					val = (double)rndidx(10000) / (double)(1 << rndidx(12));
+				else if(rndidx(64) == 0)
+					val = (double[]){ 0.0, INFINITY, NAN }[rndidx(3)];
+
+				if(rndidx(2))
+					val = -val;
+
+				len = errol_snprintf(str, size, fmt, val);
+				olen = snprintf(ostr, size, fmt, val);
+			}
+
+			if((len != olen) || ((size > 0) && strcmp(str, ostr))) {
+				if(!quiet)
+					fprintf(stderr, "printf conversion failed for '%s', size %zu. Expected '%s'. Actual '%s'.\n", fmt, size, (size > 0) ? ostr : "", (size > 0) ? str : "");
+
+				nfail++;
+			}
+		}
+
+		printf("\x1b[G\x1b[KFuzzing Errol printf done on %u numbers, %u failures (%.3f%%)\n", fuzzprintf, nfail, 100.0 * (double)nfail / (double)fuzzprintf);
+	}
+
+	if(fuzzstream > 0) {
+		unsigned int i, nfail = 0;
+
+		for(i = 0; i < fuzzstream; i++) {
+			int len, olen, prec, width;
+			unsigned int mode;
+			char str[1024], ostr[1024];
+			double val;
+
+			if((i % 1000) == 0) {
+				printf("\x1b[G\x1b[KFuzzing Errol stream... %uk/%uk %2.2f%%", i / 1000, fuzzstream / 1000, 100.0 * (double)i / (double)fuzzstream);
+				fflush(stdout);
+			}
+
+			val = pow(10.0, (double)rndidx(40) - 20.0);
+			if(i % 4 == 0)
+				val = rndval(lower, upper);
+			else if(i % 4 == 1)
+				val = rndval(val / 4.0, val * 4.0);
+			else if(rndidx(64) == 0)
+				val = (double[]){ 0.0, INFINITY, NAN }[rndidx(3)];
+
+			if(rndidx(2))
+				val = -val;
+
+			/* random stream state, either through the facet or the manipulator */
+			mode = rndidx(256);
+			prec = rndidx(8) ? rndidx(20) : rndidx(40);
+			width = rndidx(2) ? rndidx(40) : 0;
+
+			len = stream_proc(val, mode, prec, width, true, str);
+			olen = stream_proc(val, mode, prec, width, false, ostr);
+
+			if((len != olen) || strcmp(str, ostr)) {
+				if(!quiet)
+					fprintf(stderr, "Stream conversion failed for %.17e, mode %u, precision %d, width %d. Expected '%s'. Actual '%s'.\n", val, mode, prec, width, ostr, str);
+
+				nfail++;
+			}
+		}
+
+		printf("\x1b[G\x1b[KFuzzing Errol stream done on %u numbers, %u failures (%.3f%%)\n", fuzzstream, nfail, 100.0 * (double)nfail / (double)fuzzstream);
+	}
+
+	if(fuzzwide > 0) {
+		unsigned int i, nfail = 0;
+
+		for(i = 0; i < fuzzwide; i++) {
+			double val;
+
+			if((i % 1000) == 0) {
+				printf("\x1b[G\x1b[KFuzzing Errol wide... %uk/%uk %2.2f%%", i / 1000, fuzzwide / 1000, 100.0 * (double)i / (double)fuzzwide);
+				fflush(stdout);
+			}
+
+			val = pow(10.0, (double)rndidx(32) - 10.0);
+			if(i % 4 == 0)
+				val = rndval(lower, upper);
+			else if(i % 4 != 3)
+				val = rndval(val / 4.0, val * 4.0);
+			else if(rndidx(64) == 0)
+				val = (double[]){ 0.0, INFINITY, NAN }[rndidx(3)];
+
+			if(rndidx(2))
+				val = -val;
+
+			if(!wide_check(val)) {
+				if(!quiet)
+					fprintf(stderr, "Wide conversion failed for %.17e.\n", val);
+
+				nfail++;
+			}
+		}
+
+		printf("\x1b[G\x1b[KFuzzing Errol wide done on %u numbers, %u failures (%.3f%%)\n", fuzzwide, nfail, 100.0 * (double)nfail / (double)fuzzwide);
+	}
+
+	if(fuzzamalg > 0) {
+		unsigned int i, nfail = 0;
+		char lib[ERR_JSON_LEN], amal[ERR_JSON_LEN];
+
+		for(i = 0; i < fuzzamalg; i++) {
+			double val;
+
+			if((i % 1000) == 0) {
+				printf("\x1b[G\x1b[KFuzzing Errol amalgamation... %uk/%uk %2.2f%%", i / 1000, fuzzamalg / 1000, 100.0 * (double)i / (double)fuzzamalg);
+				fflush(stdout);
+			}
+
+			val = rndval(lower, upper);
+			if(i % 2)
+				val = pow(10.0, (double)rndidx(600) - 320.0) * (1.0 + rndval(0.0, 1.0));
+			else if(rndidx(64) == 0)
+				val = (double[]){ 0.0, INFINITY, NAN }[rndidx(3)];
+
+			if(rndidx(2))
+				val = -val;
+
+			if((inline_json(val, amal) != errol_json_dtoa(val, lib)) || (strcmp(amal, lib) != 0)) {
+				if(!quiet)
+					fprintf(stderr, "Amalgamation failed for %.17e. Expected %s. Actual %s.\n", val, lib, amal);
+
+				nfail++;
+			}
+		}
+
+		printf("\x1b[G\x1b[KFuzzing Errol amalgamation done on %u numbers, %u failures (%.3f%%)\n", fuzzamalg, nfail, 100.0 * (double)nfail / (double)fuzzamalg);
+	}
+
 	if(perf > 0) {
 #define N	100
 #define Nlow	(N / 10)
@@ -150,9 +990,9 @@ int main(int argc, char **argv)
 #define Nsize	(Nhigh - Nlow)
 
 		uint_fast64_t seed = get_seed();
-		uint32_t dragon4 = 0, grisu3 = 0, errol[5] = { 0, 0, 0, 0, 0 }, adj3 = 0;
+		uint32_t dragon4 = 0, grisu3 = 0, errol[7] = { 0, 0, 0, 0, 0, 0, 0 }, adj3 = 0;
 		unsigned int i, j;
-		static uint32_t dragon4all[20000][N], grisu3all[20000][N], errolNall[5][20000][N], adj3all[20000][N];
+		static uint32_t dragon4all[20000][N], grisu3all[20000][N], errolNall[7][20000][N], adj3all[20000][N];
 
 		if(perf > 20000)
 			fprintf(stderr, "Cannot support more than 20k performance numberss.\n"), abort();
@@ -171,6 +1011,8 @@ int main(int argc, char **argv)
 				errolNall[2][i][j] = errolN_bench(2, val, &suc);
 				errolNall[3][i][j] = errolN_bench(3, val, &suc);
 				errolNall[4][i][j] = errolN_bench(4, val, &suc);
+				errolNall[5][i][j] = errolN_bench(5, val, &suc);
+				errolNall[6][i][j] = errolN_bench(6, val, &suc);
 				grisu3all[i][j] = grisu_bench(val, &suc);
 				adj3all[i][j] = suc ? grisu3all[i][j] : dragon4all[i][j];
 			}
@@ -180,7 +1022,7 @@ int main(int argc, char **argv)
 
 		for(i = 0; i < perf; i++) {
 			double val = rndval(lower, upper);
-			uint32_t dragon4tm = 0, grisu3tm = 0, errolNtm[5] = { 0, 0, 0, 0, 0 }, adj3tm = 0;
+			uint32_t dragon4tm = 0, grisu3tm = 0, errolNtm[7] = { 0, 0, 0, 0, 0, 0, 0 }, adj3tm = 0;
 
 			qsort(dragon4all[i], N, sizeof(uint32_t), intsort);
 			qsort(errolNall[0][i], N, sizeof(uint32_t), intsort);
@@ -188,6 +1030,8 @@ int main(int argc, char **argv)
 			qsort(errolNall[2][i], N, sizeof(uint32_t), intsort);
 			qsort(errolNall[3][i], N, sizeof(uint32_t), intsort);
 			qsort(errolNall[4][i], N, sizeof(uint32_t), intsort);
+			qsort(errolNall[5][i], N, sizeof(uint32_t), intsort);
+			qsort(errolNall[6][i], N, sizeof(uint32_t), intsort);
 			qsort(grisu3all[i], N, sizeof(uint32_t), intsort);
 			qsort(adj3all[i], N, sizeof(uint32_t), intsort);
 
@@ -198,6 +1042,8 @@ int main(int argc, char **argv)
 				errolNtm[2] += errolNall[2][i][j];
 				errolNtm[3] += errolNall[3][i][j];
 				errolNtm[4] += errolNall[4][i][j];
+				errolNtm[5] += errolNall[5][i][j];
+				errolNtm[6] += errolNall[6][i][j];
 				grisu3tm += grisu3all[i][j];
 				adj3tm += adj3all[i][j];
 			}
@@ -208,10 +1054,12 @@ int main(int argc, char **argv)
 			errol[2] += errolNtm[2] /= Nsize;
 			errol[3] += errolNtm[3] /= Nsize;
 			errol[4] += errolNtm[4] /= Nsize;
+			errol[5] += errolNtm[5] /= Nsize;
+			errol[6] += errolNtm[6] /= Nsize;
 			grisu3 += grisu3tm /= Nsize;
 			adj3 += adj3tm /= Nsize;
 
-			fprintf(stderr, "%.18e\t%u\t%u\t%u\t%u\t%u\t%u\t%u\t%u\n", val, errolNtm[0], errolNtm[1], errolNtm[2], errolNtm[3], errolNtm[4], grisu3tm, dragon4tm, adj3tm);
+			fprintf(stderr, "%.18e\t%u\t%u\t%u\t%u\t%u\t%u\t%u\t%u\t%u\t%u\n", val, errolNtm[0], errolNtm[1], errolNtm[2], errolNtm[3], errolNtm[4], errolNtm[5], errolNtm[6], grisu3tm, dragon4tm, adj3tm);
 		}
 
 		printf("\x1b[G\x1b[KBenchmarking done,\n");
@@ -221,6 +1069,8 @@ int main(int argc, char **argv)
 		printf("Errol2            %u cycles\n", errol[2] / perf);
 		printf("Errol3            %u cycles\n", errol[3] / perf);
 		printf("Errol4            %u cycles\n", errol[4] / perf);
+		printf("Errol5            %u cycles\n", errol[5] / perf);
+		printf("Errol6            %u cycles\n", errol[6] / perf);
 		printf("Grisu3            %u cycles\n", grisu3 / perf);
 		printf("Dragon4           %u cycles\n", dragon4 / perf);
 		printf("Grisu3 w/fallback %u cycles\n", adj3 / perf);
@@ -234,6 +1084,379 @@ int main(int argc, char **argv)
 		printf("Grisu3 w/fallback %.2fx\n", (double)adj3 / (double)errol[4]);
 	}
 
+	if(cache > 0) {
+		unsigned int i, nfail = 0;
+		uint64_t errol3 = 0, errol3c = 0;
+		double pool[4096];
+		struct errol_cache_t *memo;
+		bool suc;
+
+		memo = errol_cache_new(14);
+		errol_cache_select(memo);
+
+		/* empty slots must not match any finite value, zero included */
+		for(i = 0; i < (1u << 14); i++) {
+			errol_bits_t key = { .i = memo->memo[i].key };
+
+			if(isfinite(key.d)) {
+				if(!quiet)
+					fprintf(stderr, "Cache slot %u has finite key %.17e.\n", i, key.d);
+
+				nfail++;
+			}
+		}
+
+		/* a repetitive stream drawn from a few thousand values */
+		for(i = 0; i < 4096; i++)
+			pool[i] = rndval(lower, upper);
+
+		for(i = 0; i < cache; i++) {
+			int exp, cexp;
+			char str[32], cstr[32];
+			double val = pool[rndidx(4096)];
+
+			exp = errol3_dtoa(val, str);
+			cexp = errol3c_dtoa(val, cstr);
+			if((exp != cexp) || strcmp(str, cstr)) {
+				if(!quiet)
+					fprintf(stderr, "Cached conversion failed for %.17e. Expected 0.%se%d. Actual 0.%se%d.\n", val, str, exp, cstr, cexp);
+
+				nfail++;
+			}
+
+			errol3 += errolN_bench(3, val, &suc);
+			errol3c += errol3c_bench(val);
+		}
+
+		printf("Caching Errol3 done on %u numbers, %u failures, %" PRIu64 " hits, %" PRIu64 " misses\n", cache, nfail, memo->hits, memo->misses);
+		printf("Errol3c           %" PRIu64 " cycles\n", errol3c / cache);
+		printf("Errol3            %" PRIu64 " cycles\n", errol3 / cache);
+
+		errol_cache_select(NULL);
+		errol_cache_delete(memo);
+	}
+
+	if(seq > 0) {
+		unsigned int i, nfail = 0;
+		uint64_t errol3 = 0, errol3s = 0;
+		double *arr;
+		struct errol_seq_t state;
+		bool suc;
+
+		/* a sorted column of values */
+		arr = malloc(seq * sizeof(double));
+		for(i = 0; i < seq; i++)
+			arr[i] = rndval(lower, upper);
+
+		qsort(arr, seq, sizeof(double), dblsort);
+
+		errol_seq_init(&state);
+		for(i = 0; i < seq; i++) {
+			int exp, sexp;
+			char str[32], sstr[32];
+
+			exp = errol3_dtoa(arr[i], str);
+			sexp = errol_seq_dtoa(&state, arr[i], sstr);
+			if((exp != sexp) || strcmp(str, sstr)) {
+				if(!quiet)
+					fprintf(stderr, "Sequence conversion failed for %.17e. Expected 0.%se%d. Actual 0.%se%d.\n", arr[i], str, exp, sstr, sexp);
+
+				nfail++;
+			}
+		}
+
+		errol_seq_init(&state);
+		for(i = 0; i < seq; i++) {
+			errol3 += errolN_bench(3, arr[i], &suc);
+			errol3s += errol_seq_bench(&state, arr[i]);
+		}
+
+		printf("Sequence Errol3 done on %u sorted numbers, %u failures\n", seq, nfail);
+		printf("Errol3 sequence   %" PRIu64 " cycles\n", errol3s / seq);
+		printf("Errol3            %" PRIu64 " cycles\n", errol3 / seq);
+
+		free(arr);
+	}
+
+	if(perff > 0) {
+		unsigned int i, j;
+		uint64_t errol3 = 0, errol3f = 0;
+		uint32_t errol3all[N], errol3fall[N];
+		bool suc;
+
+		for(i = 0; i < perff; i++) {
+			double val = rndvalf();
+
+			for(j = 0; j < N; j++) {
+				errol3all[j] = errolN_bench(3, val, &suc);
+				errol3fall[j] = errol3f_bench(val);
+			}
+
+			qsort(errol3all, N, sizeof(uint32_t), intsort);
+			qsort(errol3fall, N, sizeof(uint32_t), intsort);
+
+			for(j = Nlow; j < Nhigh; j++) {
+				errol3 += errol3all[j];
+				errol3f += errol3fall[j];
+			}
+		}
+
+		printf("==== Absolute Results ====\n");
+		printf("Errol3f           %" PRIu64 " cycles\n", errol3f / Nsize / perff);
+		printf("Errol3            %" PRIu64 " cycles\n", errol3 / Nsize / perff);
+		printf("==== Relative Speedup of Errol3f ====\n");
+		printf("Errol3            %.2fx\n", (double)errol3 / (double)errol3f);
+	}
+
+	if(perfq > 0) {
+		unsigned int i, j;
+		uint64_t errolq = 0, quadmath = 0;
+		uint32_t errolqall[N], quadmathall[N];
+
+		for(i = 0; i < perfq; i++) {
+			__float128 val = rndvalq();
+
+			for(j = 0; j < N; j++) {
+				errolqall[j] = errolq_bench(val);
+				quadmathall[j] = quadmath_bench(val);
+			}
+
+			qsort(errolqall, N, sizeof(uint32_t), intsort);
+			qsort(quadmathall, N, sizeof(uint32_t), intsort);
+
+			for(j = Nlow; j < Nhigh; j++) {
+				errolq += errolqall[j];
+				quadmath += quadmathall[j];
+			}
+		}
+
+		printf("==== Absolute Results ====\n");
+		printf("Errolq            %" PRIu64 " cycles\n", errolq / Nsize / perfq);
+		printf("quadmath_snprintf %" PRIu64 " cycles\n", quadmath / Nsize / perfq);
+		printf("==== Relative Speedup of Errolq ====\n");
+		printf("quadmath_snprintf %.2fx\n", (double)quadmath / (double)errolq);
+	}
+
+	if(perfld > 0) {
+		unsigned int i, j;
+		uint64_t errolld = 0, snprintfld = 0;
+		uint32_t errolldall[N], snprintfldall[N];
+
+		for(i = 0; i < perfld; i++) {
+			long double val = rndvalld();
+
+			for(j = 0; j < N; j++) {
+				errolldall[j] = errolld_bench(val);
+				snprintfldall[j] = snprintfld_bench(val);
+			}
+
+			qsort(errolldall, N, sizeof(uint32_t), intsort);
+			qsort(snprintfldall, N, sizeof(uint32_t), intsort);
+
+			for(j = Nlow; j < Nhigh; j++) {
+				errolld += errolldall[j];
+				snprintfld += snprintfldall[j];
+			}
+		}
+
+		printf("==== Absolute Results ====\n");
+		printf("Errolld           %" PRIu64 " cycles\n", errolld / Nsize / perfld);
+		printf("snprintf          %" PRIu64 " cycles\n", snprintfld / Nsize / perfld);
+		printf("==== Relative Speedup of Errolld ====\n");
+		printf("snprintf          %.2fx\n", (double)snprintfld / (double)errolld);
+	}
+
+	if(perfx > 0) {
+		unsigned int i, j;
+		uint64_t errolx = 0, snprintfx = 0;
+		uint32_t errolxall[N], snprintfxall[N];
+
+		for(i = 0; i < perfx; i++) {
+			double val = rndval(lower, upper);
+
+			for(j = 0; j < N; j++) {
+				errolxall[j] = errolx_bench(val);
+				snprintfxall[j] = snprintfx_bench(val);
+			}
+
+			qsort(errolxall, N, sizeof(uint32_t), intsort);
+			qsort(snprintfxall, N, sizeof(uint32_t), intsort);
+
+			for(j = Nlow; j < Nhigh; j++) {
+				errolx += errolxall[j];
+				snprintfx += snprintfxall[j];
+			}
+		}
+
+		printf("==== Absolute Results ====\n");
+		printf("Errol exact       %" PRIu64 " cycles\n", errolx / Nsize / perfx);
+		printf("snprintf          %" PRIu64 " cycles\n", snprintfx / Nsize / perfx);
+		printf("==== Relative Speedup of Errol exact ====\n");
+		printf("snprintf          %.2fx\n", (double)snprintfx / (double)errolx);
+	}
+
+	if(perfjson > 0) {
+		unsigned int i, j;
+		uint64_t errolj = 0, ecma = 0;
+		uint32_t erroljall[N], ecmaall[N];
+
+		for(i = 0; i < perfjson; i++) {
+			double val = rndval(lower, upper);
+
+			for(j = 0; j < N; j++) {
+				erroljall[j] = errolj_bench(val);
+				ecmaall[j] = ecma_bench(val);
+			}
+
+			qsort(erroljall, N, sizeof(uint32_t), intsort);
+			qsort(ecmaall, N, sizeof(uint32_t), intsort);
+
+			for(j = Nlow; j < Nhigh; j++) {
+				errolj += erroljall[j];
+				ecma += ecmaall[j];
+			}
+		}
+
+		printf("==== Absolute Results ====\n");
+		printf("Errol JSON        %" PRIu64 " cycles\n", errolj / Nsize / perfjson);
+		printf("EcmaScript        %" PRIu64 " cycles\n", ecma / Nsize / perfjson);
+		printf("==== Relative Speedup of Errol JSON ====\n");
+		printf("EcmaScript        %.2fx\n", (double)ecma / (double)errolj);
+	}
+
+	if(perfprintf > 0) {
+		unsigned int i, j, f;
+		const char *fmt[5] = { "%.17g", "%g", "%e", "%f", "%a" };
+		uint64_t errolp[5] = { 0 }, snprintfp[5] = { 0 };
+		uint32_t errolpall[N], snprintfpall[N];
+
+		for(i = 0; i < perfprintf; i++) {
+			double val = rndval(lower, upper);
+
+			for(f = 0; f < 5; f++) {
+				for(j = 0; j < N; j++) {
+					errolpall[j] = errolp_bench(fmt[f], val);
+					snprintfpall[j] = snprintfp_bench(fmt[f], val);
+				}
+
+				qsort(errolpall, N, sizeof(uint32_t), intsort);
+				qsort(snprintfpall, N, sizeof(uint32_t), intsort);
+
+				for(j = Nlow; j < Nhigh; j++) {
+					errolp[f] += errolpall[j];
+					snprintfp[f] += snprintfpall[j];
+				}
+			}
+		}
+
+		printf("==== Absolute Results ====\n");
+		for(f = 0; f < 5; f++)
+			printf("%-6s Errol %6" PRIu64 ", snprintf %6" PRIu64 " cycles\n", fmt[f], errolp[f] / Nsize / perfprintf, snprintfp[f] / Nsize / perfprintf);
+
+		printf("==== Relative Speedup of errol_snprintf ====\n");
+		for(f = 0; f < 5; f++)
+			printf("%-6s %.2fx\n", fmt[f], (double)snprintfp[f] / (double)errolp[f]);
+	}
+
+	if(perfstream > 0) {
+		unsigned int i, j, k, p;
+		const int prec[2] = { 6, 17 };
+		const char *name[3] = { "std::num_put", "errol::num_put", "put_double" };
+		uint64_t streams[2][3] = { { 0 } };
+		uint32_t streamall[N];
+
+		for(i = 0; i < perfstream; i++) {
+			double val = rndval(lower, upper);
+
+			for(p = 0; p < 2; p++) {
+				for(k = 0; k < 3; k++) {
+					for(j = 0; j < N; j++)
+						streamall[j] = stream_bench(val, prec[p], k);
+
+					qsort(streamall, N, sizeof(uint32_t), intsort);
+
+					for(j = Nlow; j < Nhigh; j++)
+						streams[p][k] += streamall[j];
+				}
+			}
+		}
+
+		printf("==== Absolute Results ====\n");
+		for(p = 0; p < 2; p++) {
+			for(k = 0; k < 3; k++)
+				printf("precision %-2d %-15s %6" PRIu64 " cycles\n", prec[p], name[k], streams[p][k] / Nsize / perfstream);
+		}
+
+		printf("==== Relative Speedup over std::num_put ====\n");
+		for(p = 0; p < 2; p++) {
+			for(k = 1; k < 3; k++)
+				printf("precision %-2d %-15s %.2fx\n", prec[p], name[k], (double)streams[p][0] / (double)streams[p][k]);
+		}
+	}
+
+	if(perfwide > 0) {
+		unsigned int i, j;
+		uint64_t errolw = 0, widen = 0, codecvt = 0;
+		uint32_t errolwall[N], widenall[N], codecvtall[N];
+
+		for(i = 0; i < perfwide; i++) {
+			double val = rndval(lower, upper);
+
+			for(j = 0; j < N; j++) {
+				errolwall[j] = errolw_bench(val);
+				widenall[j] = widen_bench(val);
+				codecvtall[j] = codecvt_bench(val);
+			}
+
+			qsort(errolwall, N, sizeof(uint32_t), intsort);
+			qsort(widenall, N, sizeof(uint32_t), intsort);
+			qsort(codecvtall, N, sizeof(uint32_t), intsort);
+
+			for(j = Nlow; j < Nhigh; j++) {
+				errolw += errolwall[j];
+				widen += widenall[j];
+				codecvt += codecvtall[j];
+			}
+		}
+
+		printf("==== Absolute Results ====\n");
+		printf("Errol UTF-16      %" PRIu64 " cycles\n", errolw / Nsize / perfwide);
+		printf("char and widen    %" PRIu64 " cycles\n", widen / Nsize / perfwide);
+		printf("char and codecvt  %" PRIu64 " cycles\n", codecvt / Nsize / perfwide);
+		printf("==== Relative Speedup of Errol UTF-16 ====\n");
+		printf("char and widen    %.2fx\n", (double)widen / (double)errolw);
+		printf("char and codecvt  %.2fx\n", (double)codecvt / (double)errolw);
+	}
+
+	if(perfamalg > 0) {
+		unsigned int i, j;
+		uint64_t inl = 0, outl = 0;
+		uint32_t inlall[N], outlall[N];
+
+		for(i = 0; i < perfamalg; i++) {
+			double val = rndval(lower, upper);
+
+			for(j = 0; j < N; j++) {
+				inlall[j] = inline_bench(val);
+				outlall[j] = outline_bench(val);
+			}
+
+			qsort(inlall, N, sizeof(uint32_t), intsort);
+			qsort(outlall, N, sizeof(uint32_t), intsort);
+
+			for(j = Nlow; j < Nhigh; j++) {
+				inl += inlall[j];
+				outl += outlall[j];
+			}
+		}
+
+		printf("==== Absolute Results, 16-value JSON row ====\n");
+		printf("Errol inlined     %" PRIu64 " cycles\n", inl / Nsize / perfamalg);
+		printf("Errol library     %" PRIu64 " cycles\n", outl / Nsize / perfamalg);
+		printf("==== Relative Speedup of inlined Errol ====\n");
+		printf("Errol library     %.2fx\n", (double)outl / (double)inl);
+	}
+
 	if(enum3)
 		table_enum(3, true);
 
@@ -246,6 +1469,33 @@ int main(int argc, char **argv)
 	if(check4)
 		table_enum(4, false);
 
+	if(enumq)
+		table_enumw(112, 254);
+
+	if(enumld)
+		table_enumw(63, 254);
+
+	if(enum5)
+		table_enumw(52, 254);
+
+	if(enum6)
+		table_enumw(52, 126);
+
+	if(lookupq)
+		table_lookupq();
+
+	if(lookupi)
+		table_lookupi();
+
+	if(lookupx)
+		table_lookupx();
+
+	if(lookuph)
+		table_lookuph();
+
+	if(checkh)
+		table_checkh();
+
 	return 0;
 }
 
@@ -392,6 +1642,23 @@ static int err_t_sort(const void *left, const void *right)
 		return 1;
 }
 
+/**
+ * Sort doubles in ascending order.
+ *   @left: The left pointer.
+ *   @right: The right pointer.
+ *   &returns: The order.
+ */
+
+static int dblsort(const void *left, const void *right)
+{
+	if(*(const double *)left < *(const double *)right)
+		return -1;
+	else if(*(const double *)left > *(const double *)right)
+		return 1;
+	else
+		return 0;
+}
+
 
 /**
  * Check a conversion.
@@ -445,7 +1712,7 @@ static void table_add(struct errol_err_t table[static 1024], int i, double val)
 static void table_enum(unsigned int ver, bool bld)
 {
 	int i, e, n, p, exp, cnt = 0;
-	int64_t *arr;
+	__int128_t *arr;
 	mpz_t delta, m0, alpha, tau, t;
 	struct errol_err_t table[1024] = {{ 0 }};
 	static unsigned int D = 17, P = 52;
@@ -588,10 +1855,17 @@ static void table_enum(unsigned int ver, bool bld)
 		}
 
 		fprintf(file, "};\n");
-		fprintf(file, "static struct errol_slab_t errol_enum%d_data[%d] = {\n", ver, cnt);
+		fprintf(file, "static const uint64_t errol_enum%d_sig[%d] = {\n", ver, cnt);
+
+		for(i = 0; i < cnt; i++) {
+			fprintf(file, "\t%s,\n", table[i].str);
+		}
+
+		fprintf(file, "};\n");
+		fprintf(file, "static const int16_t errol_enum%d_exp[%d] = {\n", ver, cnt);
 
 		for(i = 0; i < cnt; i++) {
-			fprintf(file, "\t{ \"%s\", %d },\n", table[i].str, table[i].exp);
+			fprintf(file, "\t%d,\n", table[i].exp);
 		}
 
 		fprintf(file, "};\n");
@@ -661,3 +1935,683 @@ static void table_to_tree(struct errol_err_t *table, int n)
 	memcpy(from, table, n * sizeof(struct errol_err_t));
 	table_to_tree_iter(table, 0, from, n);
 }
+
+
+/**
+ * Check Errolf against the exact oracle, and check that Errol3f produces the
+ * same digits for the value upcast to a double.
+ *   @val: The value.
+ *   @verbose: Print mismatches if set.
+ *   &returns: True if correct, false otherwise.
+ */
+
+static bool errolf_check(float val, bool verbose)
+{
+	int exp, oexp, dexp;
+	char str[32], ostr[32], dstr[32];
+
+	exp = errol_ftoa(val, str);
+	oexp = oraclef_proc(val, ostr);
+	dexp = errol3f_dtoa(val, dstr);
+
+	if((exp == oexp) && !strcmp(str, ostr) && (dexp == oexp) && !strcmp(dstr, ostr))
+		return true;
+
+	if(verbose) {
+		errol_fbits_t bits = { val };
+
+		fprintf(stderr, "Conversion failed for %08" PRIx32 ". Expected 0.%se%d. Actual 0.%se%d, 0.%se%d.\n", bits.i, ostr, oexp, str, exp, dstr, dexp);
+	}
+
+	return false;
+}
+
+/**
+ * Check Errolq against the exact oracle.
+ *   @val: The value.
+ *   @verbose: Print mismatches if set.
+ *   &returns: True if correct, false otherwise.
+ */
+
+static bool errolq_check(__float128 val, bool verbose)
+{
+	int exp, oexp;
+	char str[48], ostr[48];
+
+	exp = errolq_dtoa(val, str);
+	oexp = oracleq_proc(val, ostr);
+
+	if((exp == oexp) && !strcmp(str, ostr))
+		return true;
+
+	if(verbose) {
+		errol_qbits_t bits = { val };
+
+		fprintf(stderr, "Conversion failed for %016" PRIx64 "%016" PRIx64 ". Expected 0.%se%d. Actual 0.%se%d.\n", (uint64_t)(bits.i >> 64), (uint64_t)bits.i, ostr, oexp, str, exp);
+	}
+
+	return false;
+}
+
+/**
+ * Check Errolld against the exact oracle.
+ *   @val: The value.
+ *   @verbose: Print mismatches if set.
+ *   &returns: True if correct, false otherwise.
+ */
+
+static bool errolld_check(long double val, bool verbose)
+{
+	int exp, oexp;
+	char str[32], ostr[32];
+
+	exp = errol_ldtoa(val, str);
+	oexp = oracleld_proc(val, ostr);
+
+	if((exp == oexp) && !strcmp(str, ostr))
+		return true;
+
+	if(verbose) {
+		errol_ldbits_t bits = { val };
+
+		fprintf(stderr, "Conversion failed for %04x%016" PRIx64 ". Expected 0.%se%d. Actual 0.%se%d.\n", bits.s.exp, bits.s.m, ostr, oexp, str, exp);
+	}
+
+	return false;
+}
+
+/**
+ * Construct the binary128 value 2^e (1 + k / 2^p).
+ *   @e: The binary exponent.
+ *   @p: The bits of precision.
+ *   @k: The index.
+ *   &returns: The value.
+ */
+
+static __float128 table_valq(int e, unsigned int p, __uint128_t k)
+{
+	errol_qbits_t bits;
+
+	if(e >= -16382)
+		bits.i = ((__uint128_t)(e + 16383) << 112) + (k << (112 - p));
+	else
+		bits.i = ((__uint128_t)1 << p) + k;
+
+	return bits.q;
+}
+
+/**
+ * Construct the x87 extended precision value 2^e (1 + k / 2^p).
+ *   @e: The binary exponent.
+ *   @p: The bits of precision.
+ *   @k: The index.
+ *   &returns: The value.
+ */
+
+static long double table_valld(int e, unsigned int p, __uint128_t k)
+{
+	errol_ldbits_t bits = { 0 };
+
+	if(e >= -16382) {
+		bits.s.exp = e + 16383;
+		bits.s.m = (1ULL << 63) + ((uint64_t)k << (63 - p));
+	}
+	else
+		bits.s.m = (1ULL << p) + (uint64_t)k;
+
+	return bits.ld;
+}
+
+/**
+ * Check a table-free Errol against Dragon4.
+ *   @n: The version, 5 or 6.
+ *   @val: The value.
+ *   @verbose: Print mismatches if set.
+ *   &returns: True if correct, false otherwise.
+ */
+
+static bool errolN_dcheck(unsigned int n, double val, bool verbose)
+{
+	int exp, oexp;
+	char str[32], ostr[32];
+
+	exp = (n == 6) ? errol6_dtoa(val, str) : errol5_dtoa(val, str);
+	oexp = dragon4_proc(val, ostr);
+
+	if((exp == oexp) && !strcmp(str, ostr))
+		return true;
+
+	if(verbose) {
+		errol_bits_t bits = { val };
+
+		fprintf(stderr, "Conversion failed for %016" PRIx64 ". Expected 0.%se%d. Actual 0.%se%d.\n", bits.i, ostr, oexp, str, exp);
+	}
+
+	return false;
+}
+
+/**
+ * Construct the double value 2^e (1 + k / 2^p).
+ *   @e: The binary exponent.
+ *   @p: The bits of precision.
+ *   @k: The index.
+ *   &returns: The value.
+ */
+
+static double table_vald(int e, unsigned int p, __uint128_t k)
+{
+	errol_bits_t bits;
+
+	if(e >= -1022)
+		bits.i = ((uint64_t)(e + 1023) << 52) + ((uint64_t)k << (52 - p));
+	else
+		bits.i = (1ULL << p) + (uint64_t)k;
+
+	return bits.d;
+}
+
+/**
+ * Check the wide conversion of the value 2^e (1 + k / 2^p).
+ *   @P: The significand width, 112 for binary128, 63 for x87 or 52 for
+ *     doubles.
+ *   @E: The precision of the powers of ten, 254 for the wide conversion or
+ *     126 for the integer conversion of Errol6.
+ *   @e: The binary exponent.
+ *   @p: The bits of precision.
+ *   @k: The index.
+ *   &returns: True if correct, false otherwise.
+ */
+
+static bool table_checkw(unsigned int P, unsigned int E, int e, unsigned int p, __uint128_t k)
+{
+	if(P == 52)
+		return errolN_dcheck((E == 126) ? 6 : 5, table_vald(e, p, k), true);
+	else if(P == 63)
+		return errolld_check(table_valld(e, p, k), true);
+	else
+		return errolq_check(table_valq(e, p, k), true);
+}
+
+/**
+ * Process the enumeration algorithm for the fixed point conversions used by
+ * Errolq, Errolld, Errol5 and Errol6. A truncated power of ten with E bits
+ * bounds the relative error by 2^-E. The wide conversion scales the
+ * boundaries below 10^37 with E = 254 for an absolute error under 2^-131,
+ * and the integer conversion scales them below 10^19 with E = 126 for an
+ * absolute error under 2^-62. Binades where the boundaries lie on a grid
+ * coarser than that are exact or well separated and skipped.
+ *   @P: The significand width, 112 for binary128, 63 for x87 or 52 for
+ *     doubles.
+ *   @E: The precision of the powers of ten, 254 or 126.
+ */
+
+static void table_enumw(unsigned int P, unsigned int E)
+{
+	int i, e, n, p, x, q, cnt = 0, num = 0;
+	int emin = (P == 52) ? -1022 : -16382;
+	int d = (E == 126) ? 17 : 35, D = d + 3;
+	double grid, bound = E - ceil((d + 2) * log2(10.0));
+	__int128_t *arr;
+	mpz_t delta, m0, alpha, tau, t0, t1;
+	const char *name = (E == 126) ? "Errol6" : (P == 52) ? "Errol5" : (P == 63) ? "Errolld" : "Errolq";
+
+	mpz_inits(delta, m0, alpha, tau, t0, t1, NULL);
+
+	for(e = emin - (int)P; e <= 1 - emin; e++) {
+		/* bits of precision */
+		p = (e >= emin) ? P : (e - emin + P);
+
+		/* the asymmetric boundary at the start of the binade */
+		cnt += table_checkw(P, E, e, p, 0) ? 0 : 1;
+		num++;
+
+		/* grid of the boundaries b 2^(q-2) 10^x */
+		q = e - p;
+		x = d - floor(e * log10(2.0));
+		grid = ((q - 2 + x < 0) ? -(q - 2 + x) : 0) + ((x < 0) ? -x * log2(5.0) : 0);
+		if(grid < bound)
+			continue;
+
+		if(x >= 0) {
+			/* log10(5^{-e+p+1}2^{p+1}) - D + 2 */
+			n = floor((-e+p+1)*log10(5.0) + (p+1)*log10(2.0)) - D + 2;
+
+			mpz_ui_pow_ui(t0, 5, -e+p+1-n);
+			mpz_ui_pow_ui(t1, 2, P-1);
+
+			/* Δ = 2^{P+p+1-E}5^{-e+p+1-n} */
+			mpz_mul_2exp(delta, t0, P+p+1);
+			mpz_cdiv_q_2exp(delta, delta, E);
+
+			/* α = 2*5^{-e+p+1-n}2^{P-1} */
+			mpz_mul(alpha, t0, t1);
+			mpz_mul_ui(alpha, alpha, 2);
+
+			/* τ = 2^n2^{P-1} */
+			mpz_mul_2exp(tau, t1, n);
+
+			/* m0 = (2^{p+1} + 1)5^{-e+p+1-n}2^{P-1} */
+			mpz_mul_2exp(m0, t0, p+1);
+			mpz_add(m0, m0, t0);
+			mpz_mul(m0, m0, t1);
+		}
+		else {
+			/* log10(2^{e+1}) - D + 2 */
+			n = floor((e+1.0)*log10(2.0)) - D + 2;
+
+			/* Δ = 2^{e-n+1-E} */
+			mpz_set_ui(delta, 1);
+			if(e - n + 1 > E)
+				mpz_mul_2exp(delta, delta, e - n + 1 - E);
+
+			/* α = 2^(e-p-n) */
+			mpz_ui_pow_ui(alpha, 2, e - p - n);
+
+			/* τ = 5^n */
+			mpz_ui_pow_ui(tau, 5, n);
+
+			/* m0 = 2^(e-n) + 2^(e-p-1-n) */
+			mpz_ui_pow_ui(m0, 2, e-n);
+			mpz_ui_pow_ui(t0, 2, e-p-n-1);
+			mpz_add(m0, m0, t0);
+		}
+
+		/* find possible failures */
+		arr = proof_enum(delta, m0, alpha, tau, p);
+
+		for(i = 0; arr[i] >= 0; i++) {
+			cnt += table_checkw(P, E, e, p, arr[i]) ? 0 : 1;
+			cnt += table_checkw(P, E, e, p, arr[i] + 1) ? 0 : 1;
+			num += 2;
+		}
+
+		free(arr);
+
+		if((e % 1000) == 0) {
+			printf("\x1b[G\x1b[KEnumerating %s... %d", name, e);
+			fflush(stdout);
+		}
+	}
+
+	mpz_clears(delta, m0, alpha, tau, t0, t1, NULL);
+
+	printf("\x1b[G\x1b[KEnumerating %s, %u candidates, %u failures\n", name, num, cnt);
+}
+
+/**
+ * Generate the binary128 power of ten table.
+ */
+
+static void table_lookupq(void)
+{
+	int i, j, pw, exp;
+	FILE *file;
+	mpz_t w, t;
+	uint64_t limbs[4], limbs13[13];
+
+	mpz_inits(w, t, NULL);
+
+	file = fopen("lookupq.h", "w");
+	fprintf(file, "#define LOOKUPQ_TABLE_LEN (sizeof(lookupq_table) / sizeof(struct pow256_t))\n");
+	fprintf(file, "#define LOOKUPQ_TABLE_MIN (-4896)\n");
+	fprintf(file, "#define LOOKUPQ_TABLE_STEP 32\n");
+	fprintf(file, "static const struct pow256_t lookupq_table[] = {\n");
+
+	for(i = 0; i < 310; i++) {
+		pw = -4896 + 32 * i;
+
+		/* truncate 10^pw to a 256-bit significand */
+		if(pw >= 0) {
+			mpz_ui_pow_ui(w, 10, pw);
+			exp = (int)mpz_sizeinbase(w, 2) - 256;
+			if(exp >= 0)
+				mpz_fdiv_q_2exp(w, w, exp);
+			else
+				mpz_mul_2exp(w, w, -exp);
+		}
+		else {
+			mpz_ui_pow_ui(t, 10, -pw);
+			exp = -256 - (int)mpz_sizeinbase(t, 2);
+			mpz_set_ui(w, 1);
+			mpz_mul_2exp(w, w, -exp);
+			mpz_fdiv_q(w, w, t);
+			if(mpz_sizeinbase(w, 2) > 256)
+				mpz_fdiv_q_2exp(w, w, 1), exp++;
+		}
+
+		memset(limbs, 0, sizeof(limbs));
+		mpz_export(limbs, NULL, -1, sizeof(uint64_t), 0, 0, w);
+
+		fprintf(file, "\t{ { ");
+		for(j = 0; j < 4; j++)
+			fprintf(file, "0x%.16" PRIx64 "%s", limbs[j], (j < 3) ? ", " : "");
+		fprintf(file, " }, %d },\n", exp);
+	}
+
+	fprintf(file, "};\n");
+	fprintf(file, "static const uint64_t lookupq_small[LOOKUPQ_TABLE_STEP][2] = {\n");
+
+	for(i = 0; i < 32; i++) {
+		mpz_ui_pow_ui(w, 10, i);
+		memset(limbs, 0, sizeof(limbs));
+		mpz_export(limbs, NULL, -1, sizeof(uint64_t), 0, 0, w);
+		fprintf(file, "\t{ 0x%.16" PRIx64 ", 0x%.16" PRIx64 " },\n", limbs[0], limbs[1]);
+	}
+
+	fprintf(file, "};\n");
+
+	/* exact 5^325, for scaling subnormal doubles */
+	mpz_ui_pow_ui(w, 5, 325);
+	memset(limbs13, 0, sizeof(limbs13));
+	mpz_export(limbs13, NULL, -1, sizeof(uint64_t), 0, 0, w);
+	fprintf(file, "#define LOOKUPQ_POW5_EXP 325\n");
+	fprintf(file, "static const uint64_t lookupq_pow5[13] = {\n");
+	for(i = 0; i < 13; i++)
+		fprintf(file, "%s0x%.16" PRIx64 ",%s", ((i % 4) == 0) ? "\t" : "", limbs13[i], (((i % 4) == 3) || (i == 12)) ? "\n" : " ");
+	fprintf(file, "};\n");
+
+	fclose(file);
+
+	mpz_clears(w, t, NULL);
+}
+
+/**
+ * Generate the 128-bit power of ten table used by Errol6.
+ */
+
+static void table_lookupi(void)
+{
+	int pw, exp;
+	FILE *file;
+	mpz_t w, t;
+	uint64_t limbs[2];
+
+	mpz_inits(w, t, NULL);
+
+	file = fopen("lookupi.h", "w");
+	fprintf(file, "#define LOOKUPI_TABLE_MIN (-290)\n");
+	fprintf(file, "static const struct pow128_t lookupi_table[] = {\n");
+
+	for(pw = -290; pw <= 341; pw++) {
+		/* truncate 10^pw to a 128-bit significand */
+		if(pw >= 0) {
+			mpz_ui_pow_ui(w, 10, pw);
+			exp = (int)mpz_sizeinbase(w, 2) - 128;
+			if(exp >= 0)
+				mpz_fdiv_q_2exp(w, w, exp);
+			else
+				mpz_mul_2exp(w, w, -exp);
+		}
+		else {
+			mpz_ui_pow_ui(t, 10, -pw);
+			exp = -128 - (int)mpz_sizeinbase(t, 2);
+			mpz_set_ui(w, 1);
+			mpz_mul_2exp(w, w, -exp);
+			mpz_fdiv_q(w, w, t);
+			if(mpz_sizeinbase(w, 2) > 128)
+				mpz_fdiv_q_2exp(w, w, 1), exp++;
+		}
+
+		memset(limbs, 0, sizeof(limbs));
+		mpz_export(limbs, NULL, -1, sizeof(uint64_t), 0, 0, w);
+		fprintf(file, "\t{ { 0x%.16" PRIx64 ", 0x%.16" PRIx64 " }, %d },\n", limbs[0], limbs[1], exp);
+	}
+
+	fprintf(file, "};\n");
+	fclose(file);
+
+	mpz_clears(w, t, NULL);
+}
+
+/**
+ * Write a table of powers in base 10^9 limbs, least significant first.
+ *   @file: The output file.
+ *   @name: The table name.
+ *   @b: The base of the powers.
+ *   @n: The number of powers, stepping the exponent by 64.
+ */
+
+static void table_limbs(FILE *file, const char *name, unsigned int b, unsigned int n)
+{
+	unsigned int i, j, len, off[n + 1];
+	mpz_t w;
+
+	mpz_init(w);
+
+	off[0] = 0;
+	for(i = 0; i < n; i++) {
+		char *str;
+
+		mpz_ui_pow_ui(w, b, 64 * i);
+		str = mpz_get_str(NULL, 10, w);
+		off[i + 1] = off[i] + (strlen(str) + 8) / 9;
+		free(str);
+	}
+
+	fprintf(file, "static const uint16_t %s_off[%u] = {\n\t", name, n + 1);
+	for(i = 0; i <= n; i++)
+		fprintf(file, "%u%s", off[i], (i < n) ? ", " : "\n");
+	fprintf(file, "};\n");
+
+	fprintf(file, "static const uint32_t %s[%u] = {\n", name, off[n]);
+	for(i = 0; i < n; i++) {
+		mpz_ui_pow_ui(w, b, 64 * i);
+		len = off[i + 1] - off[i];
+
+		for(j = 0; j < len; j++)
+			fprintf(file, "%s%lu,%s", ((j % 8) == 0) ? "\t" : "", mpz_fdiv_q_ui(w, w, 1000000000), (((j % 8) == 7) || (j == len - 1)) ? "\n" : " ");
+	}
+	fprintf(file, "};\n");
+
+	mpz_clear(w);
+}
+
+/**
+ * Generate the power tables used by the exact expansion.
+ */
+
+static void table_lookupx(void)
+{
+	FILE *file;
+
+	file = fopen("lookupx.h", "w");
+	table_limbs(file, "lookupx_pow2", 2, 16);
+	table_limbs(file, "lookupx_pow5", 5, 17);
+	fclose(file);
+}
+
+/**
+ * Decode a 16-bit floating point value.
+ *   @val: The bit pattern.
+ *   @P: The number of fraction bits.
+ *   @E: The number of exponent bits.
+ *   @q: Out. The binary exponent.
+ *   @asym: Out. Whether the lower gap is half of the upper gap.
+ *   &returns: The significand.
+ */
+
+static uint32_t table_valh(uint16_t val, unsigned int P, unsigned int E, int *q, bool *asym)
+{
+	int bias = (1 << (E - 1)) - 1;
+	unsigned int bexp = (val >> P) & ((1 << E) - 1);
+	uint32_t m = val & ((1 << P) - 1);
+
+	*asym = (m == 0) && (bexp > 1);
+
+	if(bexp > 0) {
+		*q = (int)bexp - bias - (int)P;
+		return m | (1 << P);
+	}
+	else {
+		*q = 1 - bias - (int)P;
+		return m;
+	}
+}
+
+/**
+ * Generate the binary16 and bfloat16 shortest digit tables. Each entry packs
+ * the digits in the upper 24 bits and the exponent in the lower 8 bits.
+ */
+
+static void table_lookuph(void)
+{
+	unsigned int i, f, n;
+	FILE *file;
+	char str[32];
+	int exp;
+
+	file = fopen("lookuph.h", "w");
+
+	for(f = 0; f < 2; f++) {
+		n = (f == 0) ? 0x7C00 : 0x7F80;
+		fprintf(file, "static const uint32_t %s[0x%X] = {\n", (f == 0) ? "lookuph_table" : "lookupbf_table", n);
+
+		for(i = 0; i < n; i++) {
+			if(i == 0)
+				str[0] = '0', str[1] = '\0', exp = 0;
+			else
+				exp = (f == 0) ? oracleh_proc(i, str) : oraclebf_proc(i, str);
+
+			fprintf(file, "%s0x%.8" PRIx32 ",%s", ((i % 8) == 0) ? "\t" : "", ((uint32_t)atoi(str) << 8) | (uint8_t)exp, ((i % 8) == 7) ? "\n" : " ");
+		}
+
+		fprintf(file, "%s};\n", ((n % 8) == 0) ? "" : "\n");
+	}
+
+	fclose(file);
+}
+
+/**
+ * Exhaustively check the binary16 and bfloat16 tables against the exact
+ * oracle and verify that each output reads back as the original value.
+ */
+
+static void table_checkh(void)
+{
+	unsigned int i, f, n, cnt = 0;
+	char str[32], ostr[32], rd[48];
+	int exp, oexp, q;
+	bool asym;
+	uint32_t m;
+	double val, lo, hi, chk;
+	uint16_t pat[0x8000];
+	struct errol_slab_t *slab;
+
+	for(f = 0; f < 2; f++) {
+		n = (f == 0) ? 0x7C00 : 0x7F80;
+
+		for(i = 1; i < n; i++) {
+			if(f == 0) {
+				exp = errol_h_dtoa(i, str);
+				oexp = oracleh_proc(i, ostr);
+				m = table_valh(i, 10, 5, &q, &asym);
+			}
+			else {
+				exp = errol_bf16_dtoa(i, str);
+				oexp = oraclebf_proc(i, ostr);
+				m = table_valh(i, 7, 8, &q, &asym);
+			}
+
+			/* midpoints to the neighbours are exact in double */
+			val = ldexp(m, q);
+			lo = ldexp(asym ? (4.0 * m - 1) : (2.0 * m - 1), asym ? (q - 2) : (q - 1));
+			hi = ldexp(2.0 * m + 1, q - 1);
+
+			sprintf(rd, "0.%se%d", str, exp);
+			chk = strtod(rd, NULL);
+
+			if((exp != oexp) || strcmp(str, ostr) || (chk < lo) || (chk > hi) || ((m & 0x1) && ((chk == lo) || (chk == hi)))) {
+				fprintf(stderr, "Conversion failed for %s %04x (%.17g). Expected 0.%se%d. Actual 0.%se%d.\n", (f == 0) ? "binary16" : "bfloat16", i, val, ostr, oexp, str, exp);
+				cnt++;
+			}
+		}
+
+		/* infinities and NaNs lie past the table */
+		for(i = n; i < 0x8000; i++) {
+			exp = (f == 0) ? errol_h_dtoa(i, str) : errol_bf16_dtoa(i, str);
+			if((exp != ERR_NONFINITE) || strcmp(str, (i == n) ? "inf" : "nan")) {
+				fprintf(stderr, "Conversion failed for %s %04x. Expected %s. Actual 0.%se%d.\n", (f == 0) ? "binary16" : "bfloat16", i, (i == n) ? "inf" : "nan", str, exp);
+				cnt++;
+			}
+		}
+
+		/* the batch conversion must agree with the single conversion */
+		for(i = 0; i < 0x8000; i++)
+			pat[i] = i | 0x8000;
+
+		slab = malloc(0x8000 * sizeof(struct errol_slab_t));
+		if(f == 0)
+			errol_h_dtoa_n(pat, 0x8000, slab);
+		else
+			errol_bf16_dtoa_n(pat, 0x8000, slab);
+
+		for(i = 0; i < 0x8000; i++) {
+			exp = (f == 0) ? errol_h_dtoa(i, str) : errol_bf16_dtoa(i, str);
+			if((exp != slab[i].exp) || strcmp(str, slab[i].str)) {
+				fprintf(stderr, "Batch conversion failed for %s %04x.\n", (f == 0) ? "binary16" : "bfloat16", i);
+				cnt++;
+			}
+		}
+
+		free(slab);
+	}
+
+	printf("Checking binary16 and bfloat16 tables, %u failures\n", cnt);
+}
+
+/**
+ * Shortest length of a value in fixed or exponent notation.
+ *   @val: The value.
+ *   @d: The number of digits to round to, or zero for the shortest digits.
+ *   @k: Out. The number of significant digits.
+ *   &returns: The length, including the sign.
+ */
+
+static int width_fit(double val, int d, int *k)
+{
+	int n, e, fix, sci;
+	char str[64], *p;
+
+	if(d == 0)
+		n = errol6_dtoa(fabs(val), str);
+	else {
+		sprintf(str, "%.*e", d - 1, fabs(val));
+		width_trunc(str);
+		p = strchr(str, 'e');
+		n = atoi(p + 1) + 1;
+		*p = '\0';
+		if(str[1] == '.')
+			memmove(str + 1, str + 2, strlen(str + 2) + 1);
+	}
+
+	for(p = str + strlen(str); p[-1] == '0'; p--)
+		p[-1] = '\0';
+
+	*k = strlen(str);
+	e = (n > 0) ? (n - 1) : (1 - n);
+	sci = *k + (*k > 1) + 1 + (n <= 0) + ((e >= 100) ? 3 : ((e >= 10) ? 2 : 1));
+	fix = (n >= *k) ? n : ((n > 0) ? (*k + 1) : (2 - n + *k));
+
+	return ((fix < sci) ? fix : sci) + (val < 0.0);
+}
+
+/**
+ * Truncate a number in exponent notation that was rounded past DBL_MAX,
+ * by taking one off its last digit.
+ *   @str: The number.
+ */
+
+static void width_trunc(char *str)
+{
+	char *p;
+
+	if(!isinf(strtod(str, NULL)))
+		return;
+
+	for(p = strchr(str, 'e') - 1; (*p == '.') || (*p == '0'); p--) {
+		if(*p == '0')
+			*p = '9';
+	}
+
+	(*p)--;
+}
@@ -0,0 +1,430 @@
+#include <gmp.h>
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errol.h>
+
+
+/*
+ * local function declarations
+ */
+
+static bool scale(mpz_t res, mpz_t val, int s, int t, bool up);
+static int oracle_half(uint16_t val, unsigned int P, unsigned int E, char *buf);
+
+
+/**
+ * Exact shortest conversion of the value m * 2^q, using GMP. The boundaries
+ * are inclusive when m is even, and the candidate nearest to the value is
+ * chosen with ties broken to even.
+ *   @m: The significand.
+ *   @q: The binary exponent.
+ *   @asym: Whether the lower gap is half of the upper gap.
+ *   @buf: The output buffer.
+ *   &returns: The exponent.
+ */
+
+int oracle_proc(mpz_t m, int q, bool asym, char *buf)
+{
+	int t;
+	bool incl, exact;
+	mpz_t low, mid, high, lq, hq, c, c2;
+
+	mpz_inits(low, mid, high, lq, hq, c, c2, NULL);
+
+	incl = mpz_even_p(m);
+
+	/* boundaries in units of 2^(q-2) */
+
+	mpz_mul_2exp(mid, m, 2);
+	mpz_sub_ui(low, mid, asym ? 1 : 2);
+	mpz_add_ui(high, mid, 2);
+
+	/* find the largest power of ten with a multiple in range */
+
+	t = ceil(((double)mpz_sizeinbase(high, 2) + q - 2) * log10(2.0)) + 1;
+
+	for(;; t--) {
+		if(scale(hq, high, q - 2, t, false) && !incl)
+			mpz_sub_ui(hq, hq, 1);
+
+		if(scale(lq, low, q - 2, t, true) && !incl)
+			mpz_add_ui(lq, lq, 1);
+
+		if(mpz_cmp(lq, hq) <= 0)
+			break;
+	}
+
+	/* round the midpoint to nearest, ties to even */
+
+	scale(c, mid, q - 2, t, false);
+	exact = scale(c2, mid, q - 1, t, false);
+	mpz_submul_ui(c2, c, 2);
+	if((mpz_cmp_ui(c2, 1) == 0) && (!exact || mpz_odd_p(c)))
+		mpz_add_ui(c, c, 1);
+
+	if(mpz_cmp(c, lq) < 0)
+		mpz_set(c, lq);
+	else if(mpz_cmp(c, hq) > 0)
+		mpz_set(c, hq);
+
+	mpz_get_str(buf, 10, c);
+
+	mpz_clears(low, mid, high, lq, hq, c, c2, NULL);
+
+	return t + strlen(buf);
+}
+
+/**
+ * Exact shortest conversion of a binary128 value.
+ *   @val: The value.
+ *   @buf: The output buffer.
+ *   &returns: The exponent.
+ */
+
+int oracleq_proc(__float128 val, char *buf)
+{
+	int q, exp;
+	mpz_t m;
+	errol_qbits_t bits = { val };
+	unsigned int bexp = (bits.i >> 112) & 0x7FFF;
+	__uint128_t frac = bits.i & (((__uint128_t)1 << 112) - 1);
+	uint64_t w[2] = { (uint64_t)frac, (uint64_t)(frac >> 64) };
+
+	mpz_init(m);
+	mpz_import(m, 2, -1, sizeof(uint64_t), 0, 0, w);
+
+	if(bexp > 0) {
+		mpz_setbit(m, 112);
+		q = (int)bexp - 16383 - 112;
+	}
+	else
+		q = 1 - 16383 - 112;
+
+	exp = oracle_proc(m, q, (frac == 0) && (bexp > 1), buf);
+
+	mpz_clear(m);
+
+	return exp;
+}
+
+/**
+ * Exact shortest conversion of an x87 extended precision value.
+ *   @val: The value.
+ *   @buf: The output buffer.
+ *   &returns: The exponent.
+ */
+
+int oracleld_proc(long double val, char *buf)
+{
+	int q, exp;
+	mpz_t m;
+	errol_ldbits_t bits = { val };
+	unsigned int bexp = bits.s.exp & 0x7FFF;
+
+	mpz_init(m);
+	mpz_import(m, 1, -1, sizeof(uint64_t), 0, 0, &bits.s.m);
+
+	q = ((bexp > 0) ? (int)bexp : 1) - 16383 - 63;
+	exp = oracle_proc(m, q, (bits.s.m == (1ULL << 63)) && (bexp > 1), buf);
+
+	mpz_clear(m);
+
+	return exp;
+}
+
+/**
+ * Exact shortest conversion of a binary32 value.
+ *   @val: The value.
+ *   @buf: The output buffer.
+ *   &returns: The exponent.
+ */
+
+int oraclef_proc(float val, char *buf)
+{
+	int q, exp;
+	mpz_t m;
+	errol_fbits_t bits = { val };
+	unsigned int bexp = (bits.i >> 23) & 0xFF;
+	uint32_t frac = bits.i & 0x7FFFFF;
+
+	mpz_init_set_ui(m, frac);
+
+	if(bexp > 0) {
+		mpz_setbit(m, 23);
+		q = (int)bexp - 127 - 23;
+	}
+	else
+		q = 1 - 127 - 23;
+
+	exp = oracle_proc(m, q, (frac == 0) && (bexp > 1), buf);
+
+	mpz_clear(m);
+
+	return exp;
+}
+
+/**
+ * Exact shortest decimal within a closed interval of positive doubles,
+ * nearest to the midpoint with ties going to the larger, by brute force:
+ * for each digit count n and each decade, the n-digit candidates on either
+ * side of the midpoint are compared in exact rationals.
+ *   @lo: The lower bound.
+ *   @hi: The upper bound, greater than the lower bound.
+ *   @buf: The output buffer.
+ *   &returns: The exponent.
+ */
+
+int oracle_in(double lo, double hi, char *buf)
+{
+	int n, d, e, k, exp = 0;
+	bool found = false;
+	mpz_t pw, c, sel, min, max, best;
+	mpq_t l, h, mid, unit, quo, cand, dist, bdist;
+
+	mpz_inits(pw, c, sel, min, max, best, NULL);
+	mpq_inits(l, h, mid, unit, quo, cand, dist, bdist, NULL);
+
+	mpq_set_d(l, lo);
+	mpq_set_d(h, hi);
+	mpq_add(mid, l, h);
+	mpq_div_2exp(mid, mid, 1);
+
+	for(n = 1; !found; n++) {
+		mpz_ui_pow_ui(min, 10, n - 1);
+		mpz_ui_pow_ui(max, 10, n);
+		mpz_sub_ui(max, max, 1);
+
+		for(d = (int)floor(log10(lo)) - 1; d <= (int)floor(log10(hi)) + 1; d++) {
+			e = d - n + 1;
+			mpz_ui_pow_ui(pw, 10, abs(e));
+			mpq_set_z(unit, pw);
+			if(e < 0)
+				mpq_inv(unit, unit);
+
+			/* the floor and ceiling of the midpoint, kept to n digits */
+
+			mpq_div(quo, mid, unit);
+			mpz_fdiv_q(c, mpq_numref(quo), mpq_denref(quo));
+
+			for(k = 0; k < 2; k++, mpz_add_ui(c, c, 1)) {
+				mpz_set(sel, (mpz_cmp(c, min) < 0) ? min : (mpz_cmp(c, max) > 0) ? max : c);
+				mpq_set_z(cand, sel);
+				mpq_mul(cand, cand, unit);
+				if((mpq_cmp(cand, l) < 0) || (mpq_cmp(cand, h) > 0))
+					continue;
+
+				mpq_sub(dist, cand, mid);
+				mpq_abs(dist, dist);
+				if(found && (mpq_cmp(dist, bdist) > 0))
+					continue;
+
+				found = true;
+				mpq_set(bdist, dist);
+				mpz_set(best, sel);
+				exp = e;
+			}
+		}
+	}
+
+	mpz_get_str(buf, 10, best);
+
+	mpz_clears(pw, c, sel, min, max, best, NULL);
+	mpq_clears(l, h, mid, unit, quo, cand, dist, bdist, NULL);
+
+	return exp + strlen(buf);
+}
+
+/**
+ * Exact directed shortest conversion of a positive double. The rounding
+ * interval is cut at the value and the candidate nearest to it is chosen.
+ *   @val: The value.
+ *   @up: Round up if set, otherwise round down.
+ *   @buf: The output buffer.
+ *   &returns: The exponent.
+ */
+
+int oracle_dir(double val, bool up, char *buf)
+{
+	int t, q;
+	bool incl;
+	mpz_t m, low, high, lq, hq;
+	errol_bits_t bits = { val };
+
+	mpz_inits(m, low, high, lq, hq, NULL);
+
+	mpz_set_ui(m, bits.i & ((1ULL << 52) - 1));
+	q = ((bits.i >> 52) > 0) ? ((int)(bits.i >> 52) - 1075) : -1074;
+	if((bits.i >> 52) > 0)
+		mpz_setbit(m, 52);
+
+	incl = mpz_even_p(m);
+
+	/* bounds in units of 2^(q-2), the value itself always included */
+
+	mpz_mul_2exp(low, m, 2);
+	mpz_set(high, low);
+	if(up)
+		mpz_add_ui(high, high, 2);
+	else
+		mpz_sub_ui(low, low, (((bits.i & ((1ULL << 52) - 1)) == 0) && ((bits.i >> 52) > 1)) ? 1 : 2);
+
+	t = ceil(((double)mpz_sizeinbase(high, 2) + q - 2) * log10(2.0)) + 1;
+
+	for(;; t--) {
+		if(scale(hq, high, q - 2, t, false) && !incl && up)
+			mpz_sub_ui(hq, hq, 1);
+
+		if(scale(lq, low, q - 2, t, true) && !incl && !up)
+			mpz_add_ui(lq, lq, 1);
+
+		if(mpz_cmp(lq, hq) <= 0)
+			break;
+	}
+
+	mpz_get_str(buf, 10, up ? lq : hq);
+
+	mpz_clears(m, low, high, lq, hq, NULL);
+
+	return t + strlen(buf);
+}
+
+/**
+ * Exact full decimal expansion of a positive double.
+ *   @val: The value.
+ *   @buf: The output buffer.
+ *   &returns: The exponent.
+ */
+
+int oracle_exact(double val, char *buf)
+{
+	int q, n, exp;
+	mpz_t m, p;
+	errol_bits_t bits = { val };
+
+	mpz_inits(m, p, NULL);
+
+	mpz_set_ui(m, bits.i & ((1ULL << 52) - 1));
+	q = ((bits.i >> 52) > 0) ? ((int)(bits.i >> 52) - 1075) : -1074;
+	if((bits.i >> 52) > 0)
+		mpz_setbit(m, 52);
+
+	if(q >= 0)
+		mpz_mul_2exp(m, m, q);
+	else {
+		mpz_ui_pow_ui(p, 5, -q);
+		mpz_mul(m, m, p);
+	}
+
+	mpz_get_str(buf, 10, m);
+	exp = n = strlen(buf);
+	while(buf[n - 1] == '0')
+		buf[--n] = '\0';
+
+	mpz_clears(m, p, NULL);
+
+	return exp + ((q < 0) ? q : 0);
+}
+
+/**
+ * Exact shortest conversion of a binary16 value.
+ *   @val: The bit pattern.
+ *   @buf: The output buffer.
+ *   &returns: The exponent.
+ */
+
+int oracleh_proc(uint16_t val, char *buf)
+{
+	return oracle_half(val, 10, 5, buf);
+}
+
+/**
+ * Exact shortest conversion of a bfloat16 value.
+ *   @val: The bit pattern.
+ *   @buf: The output buffer.
+ *   &returns: The exponent.
+ */
+
+int oraclebf_proc(uint16_t val, char *buf)
+{
+	return oracle_half(val, 7, 8, buf);
+}
+
+
+/**
+ * Exact shortest conversion of a 16-bit floating point value.
+ *   @val: The bit pattern.
+ *   @P: The number of fraction bits.
+ *   @E: The number of exponent bits.
+ *   @buf: The output buffer.
+ *   &returns: The exponent.
+ */
+
+static int oracle_half(uint16_t val, unsigned int P, unsigned int E, char *buf)
+{
+	int q, exp, bias = (1 << (E - 1)) - 1;
+	mpz_t m;
+	unsigned int bexp = (val >> P) & ((1 << E) - 1);
+	unsigned int frac = val & ((1 << P) - 1);
+
+	mpz_init_set_ui(m, frac);
+
+	if(bexp > 0) {
+		mpz_setbit(m, P);
+		q = (int)bexp - bias - (int)P;
+	}
+	else
+		q = 1 - bias - (int)P;
+
+	exp = oracle_proc(m, q, (frac == 0) && (bexp > 1), buf);
+
+	mpz_clear(m);
+
+	return exp;
+}
+
+/**
+ * Scale an integer by 2^s / 10^t and round it.
+ *   @res: The result.
+ *   @val: The value.
+ *   @s: The binary exponent.
+ *   @t: The decimal exponent.
+ *   @up: Round up if set, otherwise round down.
+ *   &returns: True if the scaling was exact.
+ */
+
+static bool scale(mpz_t res, mpz_t val, int s, int t, bool up)
+{
+	bool exact;
+	mpz_t num, den;
+
+	mpz_init_set(num, val);
+	mpz_init_set_ui(den, 1);
+
+	if(s >= 0)
+		mpz_mul_2exp(num, num, s);
+	else
+		mpz_mul_2exp(den, den, -s);
+
+	if(t >= 0) {
+		mpz_ui_pow_ui(res, 10, t);
+		mpz_mul(den, den, res);
+	}
+	else {
+		mpz_ui_pow_ui(res, 10, -t);
+		mpz_mul(num, num, res);
+	}
+
+	exact = mpz_divisible_p(num, den);
+
+	if(up)
+		mpz_cdiv_q(res, num, den);
+	else
+		mpz_fdiv_q(res, num, den);
+
+	mpz_clears(num, den, NULL);
+
+	return exact;
+}
@@ -0,0 +1,10 @@
+#!/bin/sh
+# Time an unmodified binary with and without the Errol preload shim.
+#   usage: bench.sh <liberrol-preload.so> <binary> [calls]
+
+set -e
+
+echo "==== C library ===="
+"$2" --bench ${3:-1000000}
+echo "==== Errol preload ===="
+LD_PRELOAD="$1" "$2" --bench ${3:-1000000}
@@ -0,0 +1,21 @@
+#!/bin/sh
+# Compare the output of unmodified binaries with and without the Errol
+# preload shim, and check that the shim formatted some of it.
+#   usage: check.sh <liberrol-preload.so> <binary>...
+
+set -e
+
+shim="$1"
+shift
+
+dir=$(mktemp -d)
+trap 'rm -rf "$dir"' EXIT
+
+for bin in "$@"; do
+	"$bin" > "$dir/libc"
+	LD_PRELOAD="$shim" ERROL_PRELOAD_STATS=1 "$bin" > "$dir/errol" 2> "$dir/stats"
+
+	cmp "$dir/libc" "$dir/errol"
+	grep -q "errol-preload: [1-9][0-9]* handled, [1-9][0-9]* passed" "$dir/stats"
+	echo "$(basename "$bin"): $(wc -l < "$dir/libc") lines match, $(cat "$dir/stats")"
+done
@@ -0,0 +1,219 @@
+#define _POSIX_C_SOURCE 200809L
+#include <errno.h>
+#include <math.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+
+/*
+ * local function declarations
+ */
+
+static double corpus_val(uint64_t *state, unsigned int i);
+static int corpus_vsnprintf(char *buf, size_t size, const char *fmt, ...);
+static double corpus_bench(const char *fmt, FILE *file, unsigned int n);
+
+/*
+ * floating-point formats, then formats the shim passes to the C library
+ */
+
+static const char *corpus_flt[] = {
+	"%g", "%e", "%f", "%a", "%G", "%E", "%F", "%A", "%.17g", "%.15g",
+	"%.0e", "%.0f", "%.1f", "%.2f", "%.3e", "%.30f", "%.40e", "%.300f",
+	"%#g", "%#.0f", "%#.0e", "%#x%#g", "%-12.4f|", "%+010.3e", "% g",
+	"%012g", "%-+8.2g|", "%.0a", "%.3a", "%#A", "%30.20a", "%lf", "%d %g %s",
+};
+
+static const char *corpus_pass[] = {
+	"%1$g %1$e", "%'g", "%Lg", "%llg", "%lle", "%ls", "%m", "%p",
+};
+
+
+/**
+ * Print a corpus of formatted doubles, or time printing them. The program
+ * uses only the C library so its output can be compared with and without
+ * the Errol preload shim.
+ *   @argc: The number of arguments.
+ *   @argv: The arguments, "--bench n" to time n calls per format.
+ *   &returns: The error code.
+ */
+
+int main(int argc, char **argv)
+{
+	unsigned int i, j, n;
+	uint64_t state = 0x9e3779b97f4a7c15ULL;
+	char buf[1024];
+	FILE *null;
+
+	if((argc > 1) && (strcmp(argv[1], "--bench") == 0)) {
+		n = (argc > 2) ? atoi(argv[2]) : 1000000;
+		null = fopen("/dev/null", "w");
+		if(null == NULL)
+			return 1;
+
+		printf("snprintf %%g     %7.1f ns\n", corpus_bench("%g", NULL, n));
+		printf("snprintf %%.17g  %7.1f ns\n", corpus_bench("%.17g", NULL, n));
+		printf("snprintf %%f     %7.1f ns\n", corpus_bench("%f", NULL, n));
+		printf("fprintf %%g      %7.1f ns\n", corpus_bench("%g\n", null, n));
+		fclose(null);
+
+		return 0;
+	}
+
+	for(i = 0; i < 4000; i++) {
+		double val = corpus_val(&state, i);
+
+		for(j = 0; j < sizeof(corpus_flt) / sizeof(corpus_flt[0]); j++) {
+			const char *fmt = corpus_flt[j];
+			int len;
+
+			if(strchr(fmt, 's'))
+				len = snprintf(buf, sizeof(buf), fmt, (int)i, val, "str");
+			else if(strchr(fmt, 'x'))
+				len = snprintf(buf, sizeof(buf), fmt, i, val);
+			else
+				len = snprintf(buf, sizeof(buf), fmt, val);
+
+			printf("%d [%s]\n", len, buf);
+			if(strchr(fmt, 's') || strchr(fmt, 'x'))
+				continue;
+
+			/* the other entry points, and truncation */
+
+			switch((i + j) % 4) {
+			case 0:
+				len = printf(fmt, val);
+				printf(" %d\n", len);
+				break;
+
+			case 1:
+				len = fprintf(stdout, fmt, val);
+				fprintf(stdout, " %d\n", len);
+				break;
+
+			case 2:
+				len = sprintf(buf, fmt, val);
+				printf("%d {%s}\n", len, buf);
+				break;
+
+			default:
+				len = corpus_vsnprintf(buf, i % 16, fmt, val);
+				printf("%d <%s>\n", len, (i % 16) ? buf : "");
+			}
+		}
+
+		for(j = 0; j < sizeof(corpus_pass) / sizeof(corpus_pass[0]); j++) {
+			const char *fmt = corpus_pass[j];
+
+			if(strstr(fmt, "Lg") || strstr(fmt, "ll"))
+				snprintf(buf, sizeof(buf), fmt, (long double)val);
+			else if(strstr(fmt, "ls"))
+				snprintf(buf, sizeof(buf), fmt, L"wide");
+			else if(strchr(fmt, 'p'))
+				snprintf(buf, sizeof(buf), fmt, (void *)(uintptr_t)i);
+			else if(strchr(fmt, 'm'))
+				errno = ERANGE, snprintf(buf, sizeof(buf), fmt);
+			else
+				snprintf(buf, sizeof(buf), fmt, val);
+
+			printf("[%s]\n", buf);
+		}
+	}
+
+	return 0;
+}
+
+
+/**
+ * Corpus value: random bits, short decimals, values near ties and
+ * powers of ten, and the special values.
+ *   @state: The generator state.
+ *   @i: The index.
+ *   &returns: The value.
+ */
+
+static double corpus_val(uint64_t *state, unsigned int i)
+{
+	double val;
+	uint64_t bits;
+
+	*state ^= *state << 13, *state ^= *state >> 7, *state ^= *state << 17;
+	bits = *state;
+
+	switch(i % 5) {
+	case 0:
+		memcpy(&val, &bits, sizeof(val));
+		if(isnan(val))
+			val = (bits & 1) ? NAN : INFINITY;
+
+		return val;
+
+	case 1:
+		return (double)(int64_t)(bits % 2000001 - 1000000) / 1000.0;
+
+	case 2:
+		return (double)(bits % 4096) / 8.0 + 0.0625;
+
+	case 3:
+		return pow(10.0, (double)(int)(bits % 60) - 30.0) * ((bits & 1) ? 1.0 : -0.95);
+
+	default:
+		return (double[]){ 0.0, -0.0, INFINITY, -INFINITY, NAN, 5e-324, 1.7976931348623157e308 }[bits % 7];
+	}
+}
+
+/**
+ * Format through vsnprintf.
+ *   @buf: The buffer.
+ *   @size: The buffer size.
+ *   @fmt: The format.
+ *   &returns: The length of the full output.
+ */
+
+static int corpus_vsnprintf(char *buf, size_t size, const char *fmt, ...)
+{
+	int len;
+	va_list args;
+
+	va_start(args, fmt);
+	len = vsnprintf(buf, size, fmt, args);
+	va_end(args);
+
+	return len;
+}
+
+/**
+ * Time formatting a spread of doubles.
+ *   @fmt: The format.
+ *   @file: The stream, or null to format into a buffer.
+ *   @n: The number of calls.
+ *   &returns: The mean time per call in nanoseconds.
+ */
+
+static double corpus_bench(const char *fmt, FILE *file, unsigned int n)
+{
+	unsigned int i;
+	uint64_t state = 0x2545f4914f6cdd1dULL;
+	char buf[512];
+	double vals[1024];
+	struct timespec start, end;
+
+	for(i = 0; i < 1024; i++)
+		vals[i] = corpus_val(&state, 5 * i + 1) * corpus_val(&state, 5 * i + 3);
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	for(i = 0; i < n; i++) {
+		if(file != NULL)
+			fprintf(file, fmt, vals[i % 1024]);
+		else
+			snprintf(buf, sizeof(buf), fmt, vals[i % 1024]);
+	}
+
+	clock_gettime(CLOCK_MONOTONIC, &end);
+
+	return ((end.tv_sec - start.tv_sec) * 1e9 + (end.tv_nsec - start.tv_nsec)) / n;
+}
@@ -14,7 +14,7 @@
  */
 
 struct shift_t {
-	uint64_t idx;
+	__uint128_t idx;
 	mpz_t val;
 };
 
@@ -30,7 +30,7 @@ struct list_t {
 };
 
 struct point_t {
-	uint64_t idx;
+	__uint128_t idx;
 	mpz_t val;
 };
 
@@ -46,24 +46,35 @@ struct set_t {
 
 static struct list_t list_init(void);
 static void list_destroy(struct list_t *list);
-static void list_add(struct list_t *list, uint64_t idx, mpz_t val);
+static void list_add(struct list_t *list, __uint128_t idx, mpz_t val);
 static struct shift_t *list_last(struct list_t *list);
 static struct shift_t *list_smaller(struct list_t *list, mpz_t val);
 static struct shift_t *list_atmost(struct list_t *list, mpz_t val);
 
-static int64_t *arr_new(unsigned int *len);
-static void arr_add(int64_t **arr, unsigned int *len, int64_t idx);
+static __int128_t *arr_new(unsigned int *len);
+static void arr_add(__int128_t **arr, unsigned int *len, __int128_t idx);
 
 static struct set_t set_init(void);
 static void set_destroy(struct set_t *set);
-static void set_add(struct set_t *set, uint64_t idx, mpz_t val);
+static void set_add(struct set_t *set, __uint128_t idx, mpz_t val);
 
 
-int64_t *proof_enum(mpz_t delta, mpz_t m0, mpz_t alpha, mpz_t tau, unsigned int p)
+/**
+ * Enumerate the significands whose boundary may fall within delta of a
+ * decimal cut, for significands of up to 127 bits.
+ *   @delta: The error bound.
+ *   @m0: The scaled boundary of the first significand.
+ *   @alpha: The scaled boundary step.
+ *   @tau: The scaled decimal cut.
+ *   @p: The number of bits of precision.
+ *   &returns: The array of candidate indices, terminated with a negative.
+ */
+
+__int128_t *proof_enum(mpz_t delta, mpz_t m0, mpz_t alpha, mpz_t tau, unsigned int p)
 {
 	mpz_t t, v;
-	int64_t *arr;
-	uint64_t idx;
+	__int128_t *arr;
+	__uint128_t idx, lim = (__uint128_t)1 << p;
 	unsigned int len;
 	struct shift_t *shift;
 	struct list_t up, down;
@@ -114,7 +125,7 @@ int64_t *proof_enum(mpz_t delta, mpz_t m0, mpz_t alpha, mpz_t tau, unsigned int
 
 		}
 
-		if((idx >= (1ul << p)) || (mpz_cmp_si(t, 0) == 0))
+		if((idx >= lim) || (mpz_cmp_si(t, 0) == 0))
 			break;
 	}
 
@@ -127,7 +138,7 @@ int64_t *proof_enum(mpz_t delta, mpz_t m0, mpz_t alpha, mpz_t tau, unsigned int
 		mpz_set(v, t);
 
 	while(true) {
-		if((mpz_cmpabs(v, delta) <= 0) || (idx >= (1ul << p)))
+		if((mpz_cmpabs(v, delta) <= 0) || (idx >= lim))
 			break;
 
 		if(mpz_sgn(v) < 0) {
@@ -153,7 +164,7 @@ int64_t *proof_enum(mpz_t delta, mpz_t m0, mpz_t alpha, mpz_t tau, unsigned int
 
 	arr = arr_new(&len);
 
-	if((idx < (1ul << p)) && (shift != NULL)) {
+	if((idx < lim) && (shift != NULL)) {
 		int i, j;
 		struct set_t set;
 
@@ -170,7 +181,7 @@ int64_t *proof_enum(mpz_t delta, mpz_t m0, mpz_t alpha, mpz_t tau, unsigned int
 
 			for(j = up.len - 1; j >= 0; j--) {
 				idx = set.arr[i].idx + up.arr[j].idx;
-				if(idx >= (1ul << p))
+				if(idx >= lim)
 					continue;
 
 				mpz_add(v, set.arr[i].val, up.arr[j].val);
@@ -182,7 +193,7 @@ int64_t *proof_enum(mpz_t delta, mpz_t m0, mpz_t alpha, mpz_t tau, unsigned int
 
 			for(j = down.len - 1; j >= 0; j--) {
 				idx = set.arr[i].idx + down.arr[j].idx;
-				if(idx >= (1ul << p))
+				if(idx >= lim)
 					continue;
 
 				mpz_add(v, set.arr[i].val, down.arr[j].val);
@@ -237,7 +248,7 @@ static void list_destroy(struct list_t *list)
  *   @val: The value.
  */
 
-static void list_add(struct list_t *list, uint64_t idx, mpz_t val)
+static void list_add(struct list_t *list, __uint128_t idx, mpz_t val)
 {
 	unsigned int n = list->len;
 
@@ -324,11 +335,11 @@ static struct shift_t *list_atmost(struct list_t *list, mpz_t val)
  *   &returns: The empty array.
  */
 
-static int64_t *arr_new(unsigned int *len)
+static __int128_t *arr_new(unsigned int *len)
 {
-	int64_t *arr;
+	__int128_t *arr;
 
-	arr = malloc(sizeof(int64_t));
+	arr = malloc(sizeof(__int128_t));
 	arr[0] = -1;
 
 	*len = 0;
@@ -343,9 +354,9 @@ static int64_t *arr_new(unsigned int *len)
  *   @idx: The index to add.
  */
 
-static void arr_add(int64_t **arr, unsigned int *len, int64_t idx)
+static void arr_add(__int128_t **arr, unsigned int *len, __int128_t idx)
 {
-	(*arr) = realloc(*arr, (*len + 2) * sizeof(int64_t));
+	(*arr) = realloc(*arr, (*len + 2) * sizeof(__int128_t));
 	(*arr)[*len+0] = idx;
 	(*arr)[*len+1] = -1;
 	(*len)++;
@@ -375,7 +386,7 @@ static void set_destroy(struct set_t *set)
 		mpz_clear(set->arr[i].val);
 }
 
-static void set_add(struct set_t *set, uint64_t idx, mpz_t val)
+static void set_add(struct set_t *set, __uint128_t idx, mpz_t val)
 {
 	unsigned int i;
 